@@ -72,8 +72,8 @@ macro(dune_probe_cxx)
   if(NOT DUNE_CXX_NAME)
     check_symbol_exists(__GNUC__ stdio.h DUNE_CXX_GNU)
     if(DUNE_CXX_GNU)
-      exec_program(${CMAKE_CXX_COMPILER} ARGS -dumpversion OUTPUT_VARIABLE verinfo)
-      string(REPLACE "." ";" gxxver ${verinfo})
+      exec_program(${CMAKE_CXX_COMPILER} ARGS -dumpfullversion -dumpversion OUTPUT_VARIABLE verinfo)
+      string(REPLACE "." ";" gxxver "${verinfo}.0")
       list(GET gxxver 0 gxxmaj)
       list(GET gxxver 1 gxxmin)
 
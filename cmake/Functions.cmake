@@ -208,6 +208,12 @@ macro(dune_probe_functions)
     "pthread.h"
     DUNE_SYS_HAS_PTHREAD_WIN32_PROCESS_ATTACH_NP)
 
+  dune_test_function(recvmmsg
+    "int"
+    "int;struct mmsghdr*;unsigned int;int;struct timespec*"
+    "sys/types.h;sys/socket.h;time.h"
+    DUNE_SYS_HAS_RECVMMSG)
+
   dune_test_function(sigaction
     "int"
     "int;struct sigaction*;struct sigaction*"
@@ -30,6 +30,14 @@
 if(DUNE_PROGRAM_PYTHON)
   set(IMC_TAG "master" CACHE STRING "IMC git branch name, commit id or tag")
   set(IMC_URL "https://www.github.com/LSTS/imc" CACHE STRING "IMC git URL")
+  set(IMC_WHITELIST "" CACHE FILEPATH
+    "File with one IMC message abbreviation per line, restricting code generation to that subset")
+
+  if(IMC_WHITELIST)
+    set(DUNE_IMC_WHITELIST_FLAGS -w ${IMC_WHITELIST})
+  else()
+    set(DUNE_IMC_WHITELIST_FLAGS "")
+  endif()
 
   if(EXISTS "${CMAKE_BINARY_DIR}/imc/IMC.xml")
     set(DUNE_IMC_XML ${CMAKE_BINARY_DIR}/imc/IMC.xml)
@@ -54,6 +62,7 @@ if(DUNE_PROGRAM_PYTHON)
       COMMAND ${DUNE_PROGRAM_PYTHON}
       ${PROJECT_SOURCE_DIR}/programs/generators/imc_code.py
       ${extra_flags}
+      ${DUNE_IMC_WHITELIST_FLAGS}
       -x ${DUNE_IMC_XML} ${DUNE_IMC_FOLDER}
 
       COMMAND ${DUNE_PROGRAM_PYTHON}
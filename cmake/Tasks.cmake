@@ -132,7 +132,7 @@ macro(dune_add_task root_folder task)
         endif(DUNE_CPU_32B)
       endif(DUNE_CXX_MICROSOFT AND DUNE_CPU_X86)
       set(creator_sign "DUNE::Tasks::Task* create${TASK_NAME_MANGLED}(const std::string&, DUNE::Tasks::Context&);\n")
-      set(creator_init "DUNE::Tasks::Factory::registerStaticTask(\"${TASK_LABEL}\", create${TASK_NAME_MANGLED});\n")
+      set(creator_init "  {\"${TASK_LABEL}\", create${TASK_NAME_MANGLED}},\n")
       set(STATIC_TASKS_SIGNATURES "${STATIC_TASKS_SIGNATURES}${creator_sign}")
       set(STATIC_TASKS_CREATORS "${STATIC_TASKS_CREATORS}${creator_init}")
       set(DUNE_STATIC_TASKS "${DUNE_STATIC_TASKS};${TASK_LABEL}")
@@ -35,38 +35,154 @@
 #include <cstring>
 #include <cstdlib>
 #include <map>
+#include <set>
+#include <vector>
 
 // DUNE headers.
 #include <DUNE/DUNE.hpp>
 
 using DUNE_NAMESPACES;
 
+//! Filtered output of one input log. Workers fill these in parallel;
+//! the main thread concatenates them in input order so the output is
+//! identical to a sequential run.
+struct FileResult
+{
+  FileResult(void):
+    count(0),
+    first_ts(0),
+    has_first(false),
+    failed(false)
+  { }
+
+  //! Serialized filtered messages.
+  std::vector<char> data;
+  //! Number of filtered messages.
+  uint32_t count;
+  //! Time stamp of the first message in the log.
+  double first_ts;
+  //! True if the log held at least one message.
+  bool has_first;
+  //! True if processing failed.
+  bool failed;
+  //! Failure description.
+  std::string error;
+};
+
+//! Worker thread: pulls input logs from a shared cursor and runs a
+//! full decompression and parse pipeline per log.
+class FilterWorker: public Concurrency::Thread
+{
+public:
+  FilterWorker(const std::set<uint32_t>& ids, char** files,
+               unsigned file_count, Concurrency::AtomicInteger& next,
+               std::vector<FileResult>& results):
+    m_ids(ids),
+    m_files(files),
+    m_file_count(file_count),
+    m_next(next),
+    m_results(results)
+  { }
+
+private:
+  const std::set<uint32_t>& m_ids;
+  char** m_files;
+  unsigned m_file_count;
+  Concurrency::AtomicInteger& m_next;
+  std::vector<FileResult>& m_results;
+
+  void
+  run(void)
+  {
+    while (true)
+    {
+      long j = m_next.increment() - 1;
+      if (j >= (long)m_file_count)
+        break;
+
+      processFile((unsigned)j);
+    }
+  }
+
+  void
+  processFile(unsigned j)
+  {
+    FileResult& result = m_results[j];
+
+    std::istream* is = 0;
+
+    try
+    {
+      Compression::Methods method = Compression::Factory::detect(m_files[j]);
+      if (method == METHOD_UNKNOWN)
+        is = new std::ifstream(m_files[j], std::ios::binary);
+      else
+        is = new Compression::FileInput(m_files[j], method);
+
+      ByteBuffer buffer;
+      IMC::Message* msg;
+
+      while ((msg = IMC::Packet::deserialize(*is)) != 0)
+      {
+        if (!result.has_first)
+        {
+          result.first_ts = msg->getTimeStamp();
+          result.has_first = true;
+        }
+
+        if (m_ids.find(msg->getId()) != m_ids.end())
+        {
+          IMC::Packet::serialize(msg, buffer);
+          result.data.insert(result.data.end(), buffer.getBufferSigned(),
+                             buffer.getBufferSigned() + buffer.getSize());
+          ++result.count;
+        }
+
+        delete msg;
+      }
+    }
+    catch (std::runtime_error& e)
+    {
+      result.failed = true;
+      result.error = e.what();
+    }
+
+    delete is;
+  }
+};
+
 int
 main(int32_t argc, char** argv)
 {
-  if (argc < 2)
+  unsigned workers = 1;
+  int arg = 1;
+
+  if (argc > 2 && std::strncmp(argv[1], "-j", 2) == 0)
   {
-    std::cerr << "Usage: " << argv[0] << " <abbrev of imc message 1>,<abbrev of imc message 2>,..,"
+    workers = std::atoi(argv[1] + 2);
+    if (workers < 1)
+      workers = 1;
+    ++arg;
+  }
+
+  if (argc < arg + 2)
+  {
+    std::cerr << "Usage: " << argv[0] << " [-jN] <abbrev of imc message 1>,<abbrev of imc message 2>,..,"
               << "<abbrev of imc message n> Data.lsf[.gz] .. Data.lsf[.gz]"
               << std::endl;
     std::cerr << argv[0] << " accepts multiple IMC messages comma separated and "
               << "multiple Data.lsf files space separated." << std::endl;
     std::cerr << "This program does not sort the input Data.lsf files." << std::endl;
+    std::cerr << "With -jN the input files are fanned out across N worker "
+              << "threads; the output is still ordered by input file." << std::endl;
     return 1;
   }
 
-  ByteBuffer buffer;
-  std::ofstream lsf("FilteredData.lsf", std::ios::binary);
-
-  IMC::Message* msg;
-
-  uint32_t accum = 0;
-
-  bool done_first = false;
+  const char* abbrevs = argv[arg];
 
   std::set<uint32_t> ids;
   std::vector<std::string> msgs;
-  Utils::String::split(argv[1], ",", msgs);
+  Utils::String::split(abbrevs, ",", msgs);
 
   for (unsigned k = 0; k < msgs.size(); ++k)
   {
@@ -74,60 +190,64 @@ main(int32_t argc, char** argv)
     ids.insert(got);
   }
 
-  for (uint32_t j = 2; j < (uint32_t)argc; ++j)
-  {
-    std::istream* is = 0;
-    Compression::Methods method = Compression::Factory::detect(argv[j]);
-    if (method == METHOD_UNKNOWN)
-      is = new std::ifstream(argv[j], std::ios::binary);
-    else
-      is = new Compression::FileInput(argv[j], method);
+  char** files = argv + arg + 1;
+  unsigned file_count = argc - arg - 1;
 
-    uint32_t i = 0;
+  std::vector<FileResult> results(file_count);
+  Concurrency::AtomicInteger next;
 
-    try
-    {
-      while ((msg = IMC::Packet::deserialize(*is)) != 0)
-      {
-        if (!done_first)
-        {
-          // place an empty estimatedstate message in the log
-          IMC::EstimatedState state;
-          state.setTimeStamp(msg->getTimeStamp());
-          IMC::Packet::serialize(&state, buffer);
-          lsf.write(buffer.getBufferSigned(), buffer.getSize());
-          done_first = true;
-        }
+  if (workers > file_count)
+    workers = file_count;
 
-        std::set<uint32_t>::const_iterator it;
-        it = ids.find(msg->getId());
+  std::vector<FilterWorker*> pool;
+  for (unsigned w = 0; w < workers; ++w)
+    pool.push_back(new FilterWorker(ids, files, file_count, next, results));
 
-        if (it != ids.end())
-        {
-          IMC::Packet::serialize(msg, buffer);
-          lsf.write(buffer.getBufferSigned(), buffer.getSize());
+  for (unsigned w = 0; w < workers; ++w)
+    pool[w]->start();
 
-          ++i;
-        }
+  for (unsigned w = 0; w < workers; ++w)
+  {
+    pool[w]->join();
+    delete pool[w];
+  }
 
-        delete msg;
-      }
-    }
-    catch (std::runtime_error& e)
+  std::ofstream lsf("FilteredData.lsf", std::ios::binary);
+
+  uint32_t accum = 0;
+  bool done_first = false;
+
+  for (unsigned j = 0; j < file_count; ++j)
+  {
+    FileResult& result = results[j];
+
+    if (result.failed)
     {
-      std::cerr << "ERROR: " << e.what() << std::endl;
+      std::cerr << "ERROR: " << result.error << std::endl;
       return -1;
     }
 
-    std::cerr << i << " messages in " << argv[j] << std::endl;
-    accum += i;
+    if (!done_first && result.has_first)
+    {
+      // place an empty estimatedstate message in the log
+      IMC::EstimatedState state;
+      state.setTimeStamp(result.first_ts);
+      ByteBuffer buffer;
+      IMC::Packet::serialize(&state, buffer);
+      lsf.write(buffer.getBufferSigned(), buffer.getSize());
+      done_first = true;
+    }
 
-    delete is;
+    if (!result.data.empty())
+      lsf.write(&result.data[0], result.data.size());
+
+    std::cerr << result.count << " messages in " << files[j] << std::endl;
+    accum += result.count;
   }
 
   lsf.close();
 
-  std::cerr << "Total of " << accum << " " << argv[1] << " messages." << std::endl;
+  std::cerr << "Total of " << accum << " " << abbrevs << " messages." << std::endl;
 
   return 0;
 }
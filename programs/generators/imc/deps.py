@@ -58,3 +58,8 @@ class Dependencies:
         for msg in self._root.findall('message'):
             self.get_deps(msg.get('abbrev'))
         return self._abbrevs
+
+    def get_subset(self, abbrevs):
+        for abbrev in abbrevs:
+            self.get_deps(abbrev)
+        return self._abbrevs
@@ -375,6 +375,9 @@ parser.add_argument('-x', '--xml', metavar='IMC_XML',
                     help="IMC XML file")
 parser.add_argument('-f', '--force', action='store_true', required=False,
                     help="Force creation of blob file")
+parser.add_argument('-w', '--whitelist', metavar='WHITELIST', required=False,
+                    help="File with one message abbrev per line; only these"
+                    " messages (and the messages they contain) are generated")
 args = parser.parse_args()
 
 xml_md5 = compute_md5(args.xml)
@@ -385,6 +388,25 @@ import xml.etree.ElementTree as ET
 tree = ET.parse(args.xml)
 root = tree.getroot()
 
+# Restrict generation to a subset of messages. Messages referenced by
+# 'message' or 'message-list' fields of whitelisted messages are pulled
+# in automatically.
+if args.whitelist:
+    wanted = []
+    with open(args.whitelist) as fd:
+        for line in fd:
+            line = line.split('#')[0].strip()
+            if len(line) == 0:
+                continue
+            if root.find("message[@abbrev='%s']" % line) is None:
+                print("* Warning: whitelisted message '%s' does not exist" % line)
+                continue
+            wanted.append(line)
+    keep = Dependencies(root).get_subset(wanted)
+    for msg in root.findall('message'):
+        if msg.get('abbrev') not in keep:
+            root.remove(msg)
+
 # Initialize constant values.
 consts = {}
 
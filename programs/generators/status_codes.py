@@ -77,12 +77,31 @@ fd.write()
 get = Function('getString', 'const char*',  [Var('code', 'Code')])
 get.add_body('return c_status_messages[code];')
 
+# Translated getter function.
+get_i18n = Function('getTranslatedString', 'const std::string&', [Var('code', 'Code')])
+get_i18n.add_body('if (!c_translated_ready)\n'
+                  '{\n'
+                  'for (unsigned i = 0; i < %u; ++i)\n' % count +
+                  '{\n'
+                  'c_translated_messages[i] = DTR(c_status_messages[i]);\n'
+                  '}\n'
+                  '\n'
+                  'c_translated_ready = true;\n'
+                  '}\n'
+                  '\n'
+                  'return c_translated_messages[code];')
+
 # CPP.
 fd = File('Messages.cpp', dst_folder, ns = ['DUNE', 'Status'], skip_md5 = True)
+fd.add_isoc_headers('string')
 fd.add_dune_headers('Config.hpp', 'Status/Messages.hpp')
 fd.append('static const char* c_status_messages[%u] =\n{' % count)
 strings = ['DTR_RT("%(string)s")' % msg for msg in msgs]
 fd.append(',\n'.join(strings))
 fd.append('};\n')
+fd.append('// Translated messages, interned on first use.')
+fd.append('static std::string c_translated_messages[%u];' % count)
+fd.append('static bool c_translated_ready = false;\n')
 fd.append(get);
+fd.append(get_i18n);
 fd.write()
@@ -0,0 +1,186 @@
+# -*- coding: utf-8 -*-
+############################################################################
+# Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      #
+# Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  #
+############################################################################
+# This file is part of DUNE: Unified Navigation Environment.               #
+#                                                                          #
+# Commercial Licence Usage                                                 #
+# Licencees holding valid commercial DUNE licences may use this file in    #
+# accordance with the commercial licence agreement provided with the      #
+# Software or, alternatively, in accordance with the terms contained in a  #
+# written agreement between you and Faculdade de Engenharia da             #
+# Universidade do Porto. For licensing terms, conditions, and further      #
+# information contact lsts@fe.up.pt.                                       #
+#                                                                          #
+# Modified European Union Public Licence - EUPL v.1.1 Usage                #
+# Alternatively, this file may be used under the terms of the Modified     #
+# EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md #
+# included in the packaging of this file. You may not use this work        #
+# except in compliance with the Licence. Unless required by applicable     #
+# law or agreed to in writing, software distributed under the Licence is   #
+# distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     #
+# ANY KIND, either express or implied. See the Licence for the specific    #
+# language governing permissions and limitations at                        #
+# https://github.com/LSTS/dune/blob/master/LICENCE.md and                  #
+# http://ec.europa.eu/idabc/eupl.html.                                     #
+############################################################################
+# Author: Ricardo Martins                                                  #
+############################################################################
+# Generate DUNE/IMC/FieldVisitors.hpp from the generated message           #
+# definitions, emitting one statically typed forEachField() per concrete   #
+# message plus an id-switch dispatcher. Run whenever Definitions.hpp is    #
+# regenerated:                                                             #
+#                                                                          #
+#   python programs/scripts/dune-create-field-visitors.py                  #
+############################################################################
+
+import os
+import re
+import sys
+
+CLASS_RE = re.compile(r'^    class (\w+): public (\w+)$')
+FIELD_RE = re.compile(r'^      ([\w:]+(?:<[\w:, ]+>)?) (\w+);$')
+ID_RE = re.compile(r'getIdStatic\(void\)\s*\{\s*return (\d+);', re.S)
+
+
+def parse(path):
+    '''Extract (name, parent, fields, id) of every message class.'''
+    classes = []
+    name = None
+    body = []
+
+    for line in open(path):
+        line = line.rstrip('\n')
+        m = CLASS_RE.match(line)
+        if m is not None:
+            name, parent = m.group(1), m.group(2)
+            body = []
+            fields = []
+            in_enum = False
+            in_fields = True
+            continue
+
+        if name is None:
+            continue
+
+        body.append(line)
+
+        if line == '    };':
+            text = '\n'.join(body)
+            m = ID_RE.search(text)
+            msg_id = int(m.group(1)) if m is not None else None
+            classes.append((name, parent, fields, msg_id))
+            name = None
+            continue
+
+        if in_fields:
+            if 'enum ' in line:
+                in_enum = True
+            elif in_enum:
+                if line.strip() == '};':
+                    in_enum = False
+            elif '(' in line:
+                # First method declaration ends the field block.
+                in_fields = False
+            else:
+                m = FIELD_RE.match(line)
+                if m is not None:
+                    fields.append((m.group(1), m.group(2)))
+
+    return classes
+
+
+def all_fields(name, index):
+    '''Fields of a message including the ones of its parents.'''
+    if name == 'Message' or name not in index:
+        return []
+
+    parent, fields = index[name]
+    return all_fields(parent, index) + fields
+
+
+def banner(defs_path):
+    '''License banner of the generated definitions.'''
+    lines = []
+    for line in open(defs_path):
+        lines.append(line)
+        if 'IMC XML MD5' in line:
+            lines.append('//' + '*' * 75 + '\n')
+            break
+    return ''.join(lines)
+
+
+def main():
+    root = os.path.join(os.path.dirname(__file__), '..', '..')
+    defs = os.path.join(root, 'src', 'DUNE', 'IMC', 'Definitions.hpp')
+    out_path = os.path.join(root, 'src', 'DUNE', 'IMC', 'FieldVisitors.hpp')
+
+    classes = parse(defs)
+    index = dict((name, (parent, fields)) for name, parent, fields, _ in classes)
+
+    out = open(out_path, 'w')
+    out.write(banner(defs))
+    out.write('''
+#ifndef DUNE_IMC_FIELD_VISITORS_HPP_INCLUDED_
+#define DUNE_IMC_FIELD_VISITORS_HPP_INCLUDED_
+
+// DUNE headers.
+#include <DUNE/IMC/Definitions.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+''')
+
+    concrete = [(name, msg_id) for name, _, _, msg_id in classes
+                if msg_id is not None]
+
+    for name, parent, fields, msg_id in classes:
+        if msg_id is None:
+            continue
+
+        out.write('    //! Visit the fields of %s.\n' % name)
+        out.write('    //! @param[in] msg__ message.\n')
+        out.write('    //! @param[in] v__ visitor.\n')
+        out.write('    template <typename V>\n    inline void\n')
+        out.write('    forEachField(const %s& msg__, V& v__)\n    {\n' % name)
+        flds = all_fields(name, index)
+        if not flds:
+            out.write('      (void)msg__;\n      (void)v__;\n')
+        for _, fname in flds:
+            out.write('      v__.field("%s", msg__.%s);\n' % (fname, fname))
+        out.write('    }\n\n')
+
+    out.write('''    //! Visit the fields of a message of runtime type,
+    //! dispatching to the statically typed visitor.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    //! @return true if the message type is known, false otherwise.
+    template <typename V>
+    inline bool
+    forEachField(const Message& msg__, V& v__)
+    {
+      switch (msg__.getId())
+      {
+''')
+    for name, msg_id in sorted(concrete, key=lambda c: c[1]):
+        out.write('        case %d:\n' % msg_id)
+        out.write('          forEachField(static_cast<const %s&>(msg__), v__);\n' % name)
+        out.write('          return true;\n')
+    out.write('''        default:
+          return false;
+      }
+    }
+  }
+}
+
+#endif
+''')
+    out.close()
+    sys.stdout.write('generated %s (%u messages)\n' % (out_path, len(concrete)))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,473 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: DUNE Developers                                                  *
+//***************************************************************************
+// Performance regression suite for the hot paths of the runtime: bus     *
+// dispatch, packet serialization and parsing, matrix operations, WGS-84  *
+// displacements, NMEA parsing and gzip compression. Results are emitted  *
+// as JSON; pointing DUNE_BENCH_BASELINE at the JSON of a previous run    *
+// fails the test when a benchmark drops below a fraction of its recorded *
+// rate (DUNE_BENCH_THRESHOLD, default 0.5), catching order-of-magnitude  *
+// regressions before they reach vehicles. DUNE_BENCH_OUTPUT saves the    *
+// JSON of the current run to a file for use as the next baseline.        *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+using DUNE_NAMESPACES;
+
+// Local headers.
+#include "Test.hpp"
+
+//! One benchmark result.
+struct Result
+{
+  //! Benchmark name.
+  std::string name;
+  //! Number of operations timed.
+  unsigned iterations;
+  //! Elapsed time in seconds.
+  double seconds;
+  //! Operations per second.
+  double rate;
+};
+
+//! Message sink counting deliveries, used to benchmark bus dispatch.
+class Sink: public Tasks::AbstractTask
+{
+public:
+  Sink(void):
+    m_count(0)
+  { }
+
+  void
+  receive(const IMC::Message* msg)
+  {
+    (void)msg;
+    ++m_count;
+  }
+
+  void
+  receive(IMC::SharedMessage* msg)
+  {
+    (void)msg;
+    ++m_count;
+  }
+
+  const char*
+  getName(void) const
+  {
+    return "sink";
+  }
+
+  void
+  inf(const char* format, ...)
+  {
+    (void)format;
+  }
+
+  void
+  war(const char* format, ...)
+  {
+    (void)format;
+  }
+
+  void
+  err(const char* format, ...)
+  {
+    (void)format;
+  }
+
+  void
+  cri(const char* format, ...)
+  {
+    (void)format;
+  }
+
+  void
+  debug(const char* format, ...)
+  {
+    (void)format;
+  }
+
+  void
+  trace(const char* format, ...)
+  {
+    (void)format;
+  }
+
+  void
+  spew(const char* format, ...)
+  {
+    (void)format;
+  }
+
+  unsigned
+  count(void) const
+  {
+    return m_count;
+  }
+
+private:
+  //! Number of received messages.
+  unsigned m_count;
+
+  void
+  run(void)
+  { }
+};
+
+//! Fill an EstimatedState with representative values.
+static void
+fillState(IMC::EstimatedState& es)
+{
+  es.lat = 0.71881385;
+  es.lon = -0.15195186;
+  es.height = 0.0;
+  es.x = 123.45;
+  es.y = -67.89;
+  es.z = 2.5;
+  es.phi = 0.01;
+  es.theta = -0.05;
+  es.psi = 1.57;
+  es.u = 1.25;
+  es.v = 0.05;
+  es.w = -0.01;
+  es.setTimeStamp(1234567890.123);
+  es.setSource(0x1234);
+  es.setSourceEntity(42);
+}
+
+static Result
+benchBusDispatch(void)
+{
+  IMC::Bus bus;
+  std::vector<Sink*> sinks;
+  for (unsigned i = 0; i < 4; ++i)
+  {
+    Sink* sink = new Sink;
+    bus.registerRecipient(sink, DUNE_IMC_ESTIMATEDSTATE);
+    sinks.push_back(sink);
+  }
+
+  IMC::EstimatedState es;
+  fillState(es);
+
+  Result res;
+  res.name = "bus_dispatch";
+  res.iterations = 100000;
+
+  double start = Clock::get();
+  for (unsigned i = 0; i < res.iterations; ++i)
+    bus.dispatch(&es);
+  res.seconds = Clock::get() - start;
+  res.rate = res.iterations / res.seconds;
+
+  for (unsigned i = 0; i < sinks.size(); ++i)
+  {
+    bus.unregisterRecipient(sinks[i], DUNE_IMC_ESTIMATEDSTATE);
+    delete sinks[i];
+  }
+
+  return res;
+}
+
+static Result
+benchPacketSerialize(void)
+{
+  IMC::EstimatedState es;
+  fillState(es);
+
+  ByteBuffer bfr;
+
+  Result res;
+  res.name = "packet_serialize";
+  res.iterations = 500000;
+
+  double start = Clock::get();
+  for (unsigned i = 0; i < res.iterations; ++i)
+    IMC::Packet::serialize(&es, bfr);
+  res.seconds = Clock::get() - start;
+  res.rate = res.iterations / res.seconds;
+
+  return res;
+}
+
+static Result
+benchPacketDeserialize(void)
+{
+  IMC::EstimatedState es;
+  fillState(es);
+
+  ByteBuffer bfr;
+  IMC::Packet::serialize(&es, bfr);
+
+  Result res;
+  res.name = "packet_deserialize";
+  res.iterations = 500000;
+
+  double start = Clock::get();
+  for (unsigned i = 0; i < res.iterations; ++i)
+  {
+    IMC::Message* msg = IMC::Packet::deserialize(bfr.getBuffer(), bfr.getSize());
+    delete msg;
+  }
+  res.seconds = Clock::get() - start;
+  res.rate = res.iterations / res.seconds;
+
+  return res;
+}
+
+static Result
+benchMatrixMultiply(void)
+{
+  Matrix a(6, 6);
+  Matrix b(6, 6);
+  for (int i = 0; i < 6; ++i)
+  {
+    for (int j = 0; j < 6; ++j)
+    {
+      a(i, j) = (i + 1) * 0.5 + j * 0.25;
+      b(i, j) = (j + 1) * 0.75 - i * 0.125;
+    }
+  }
+
+  Result res;
+  res.name = "matrix_multiply";
+  res.iterations = 200000;
+
+  double acc = 0.0;
+  double start = Clock::get();
+  for (unsigned i = 0; i < res.iterations; ++i)
+  {
+    Matrix c = a * b;
+    acc += c(0, 0);
+  }
+  res.seconds = Clock::get() - start;
+  res.rate = res.iterations / res.seconds;
+
+  // Keep the optimizer honest.
+  if (acc == 42.0)
+    std::fprintf(stderr, "%f\n", acc);
+
+  return res;
+}
+
+static Result
+benchWGS84Displacement(void)
+{
+  double rlat = 0.71881385;
+  double rlon = -0.15195186;
+
+  Result res;
+  res.name = "wgs84_displacement";
+  res.iterations = 500000;
+
+  double acc = 0.0;
+  double start = Clock::get();
+  for (unsigned i = 0; i < res.iterations; ++i)
+  {
+    double n = 0.0;
+    double e = 0.0;
+    double d = 0.0;
+    WGS84::displacement(rlat, rlon, 0.0,
+                        rlat + 1e-5, rlon + (i % 100) * 1e-7, 2.0,
+                        &n, &e, &d);
+    acc += n + e + d;
+  }
+  res.seconds = Clock::get() - start;
+  res.rate = res.iterations / res.seconds;
+
+  if (acc == 42.0)
+    std::fprintf(stderr, "%f\n", acc);
+
+  return res;
+}
+
+static Result
+benchNMEAParse(void)
+{
+  const std::string stn = "$GPGGA,123519,4807.038,N,01131.000,E,1,08,0.9,545.4,M,46.9,M,,*47";
+
+  Result res;
+  res.name = "nmea_parse";
+  res.iterations = 200000;
+
+  double acc = 0.0;
+  double start = Clock::get();
+  for (unsigned i = 0; i < res.iterations; ++i)
+  {
+    NMEAReader reader(stn);
+    double time = 0.0;
+    double lat = 0.0;
+    std::string hemisphere;
+    reader >> time >> lat >> hemisphere;
+    acc += time + lat;
+  }
+  res.seconds = Clock::get() - start;
+  res.rate = res.iterations / res.seconds;
+
+  if (acc == 42.0)
+    std::fprintf(stderr, "%f\n", acc);
+
+  return res;
+}
+
+static Result
+benchGzipCompress(void)
+{
+  // Log-like payload: repetitive text with varying numbers.
+  std::ostringstream os;
+  for (unsigned i = 0; i < 1024; ++i)
+    os << "2026/08/27 12:00:" << (i % 60) << " [Navigation.General] position ("
+       << i * 0.25 << ", " << i * -0.5 << ", " << i * 0.01 << ")\n";
+  std::string data = os.str();
+
+  Result res;
+  res.name = "gzip_compress";
+  res.iterations = 200;
+
+  GzipCompressor cmp;
+  ByteBuffer out;
+
+  double start = Clock::get();
+  for (unsigned i = 0; i < res.iterations; ++i)
+    cmp.compress(out, (char*)data.c_str(), (unsigned long)data.size());
+  res.seconds = Clock::get() - start;
+  res.rate = (res.iterations * (double)data.size()) / res.seconds;
+
+  return res;
+}
+
+//! Write results as a JSON document.
+static std::string
+toJSON(const std::vector<Result>& results)
+{
+  std::ostringstream os;
+  os << "{\"benchmarks\": [\n";
+  for (unsigned i = 0; i < results.size(); ++i)
+  {
+    if (i > 0)
+      os << ",\n";
+    os << "  {\"name\": \"" << results[i].name << "\""
+       << ", \"iterations\": " << results[i].iterations
+       << ", \"seconds\": " << results[i].seconds
+       << ", \"rate\": " << results[i].rate << "}";
+  }
+  os << "\n]}\n";
+  return os.str();
+}
+
+//! Read the rate of one benchmark from a baseline JSON document
+//! produced by toJSON().
+//! @return recorded rate, negative if the benchmark is not present.
+static double
+baselineRate(const std::string& doc, const std::string& name)
+{
+  std::string::size_type idx = doc.find("\"" + name + "\"");
+  if (idx == std::string::npos)
+    return -1.0;
+
+  idx = doc.find("\"rate\": ", idx);
+  if (idx == std::string::npos)
+    return -1.0;
+
+  return std::atof(doc.c_str() + idx + 8);
+}
+
+int
+main(void)
+{
+  Test test("Benchmarks");
+
+  std::vector<Result> results;
+  results.push_back(benchBusDispatch());
+  results.push_back(benchPacketSerialize());
+  results.push_back(benchPacketDeserialize());
+  results.push_back(benchMatrixMultiply());
+  results.push_back(benchWGS84Displacement());
+  results.push_back(benchNMEAParse());
+  results.push_back(benchGzipCompress());
+
+  std::string doc = toJSON(results);
+  std::fputs(doc.c_str(), stdout);
+
+  // Every benchmark must have measured something.
+  for (unsigned i = 0; i < results.size(); ++i)
+    test.boolean(results[i].name.c_str(),
+                 results[i].seconds > 0.0 && results[i].rate > 0.0);
+
+  // Compare against a recorded baseline, when one is given.
+  const char* baseline_path = std::getenv("DUNE_BENCH_BASELINE");
+  if (baseline_path != NULL)
+  {
+    double threshold = 0.5;
+    const char* threshold_var = std::getenv("DUNE_BENCH_THRESHOLD");
+    if (threshold_var != NULL)
+      threshold = std::atof(threshold_var);
+
+    std::ifstream ifs(baseline_path);
+    std::ostringstream bos;
+    bos << ifs.rdbuf();
+    std::string baseline = bos.str();
+
+    for (unsigned i = 0; i < results.size(); ++i)
+    {
+      double recorded = baselineRate(baseline, results[i].name);
+      if (recorded <= 0.0)
+        continue;
+
+      std::string desc = results[i].name + " vs baseline";
+      bool ok = results[i].rate >= recorded * threshold;
+      if (!ok)
+        std::fprintf(stderr, "%s: %0.0f ops/s is below %0.0f%% of the"
+                     " recorded %0.0f ops/s\n", results[i].name.c_str(),
+                     results[i].rate, threshold * 100.0, recorded);
+      test.boolean(desc.c_str(), ok);
+    }
+  }
+
+  // Save the run for use as a future baseline.
+  const char* output_path = std::getenv("DUNE_BENCH_OUTPUT");
+  if (output_path != NULL)
+  {
+    std::ofstream ofs(output_path);
+    ofs << doc;
+  }
+
+  return test.getReturnValue();
+}
@@ -0,0 +1,117 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Carlos Oliveira                                                  *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstdlib>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Utils/BitBuffer.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using namespace DUNE::Utils;
+
+int
+main(int argc, char** argv)
+{
+  Test test("Utils::BitBuffer");
+
+  {
+    BitBuffer bb(64);
+    bb.appendData(0x5, 3);
+    bb.appendData(0x3, 2);
+    bb.appendData(0x1ff, 9);
+
+    test.boolean("getBitsize()", bb.getBitsize() == 14);
+    test.boolean("getData(0, 3)", bb.getData(0, 3) == 0x5);
+    test.boolean("getData(3, 2)", bb.getData(3, 2) == 0x3);
+    test.boolean("getData(5, 9)", bb.getData(5, 9) == 0x1ff);
+    // First byte: 101 11 111 (LSB first).
+    test.boolean("getData(0, 8)", bb.getData(0, 8) == 0xfd);
+  }
+
+  {
+    BitBuffer bb(64);
+    bb.appendData(0xdeadbeef, 32);
+    test.boolean("32 bit round-trip", bb.getData(0, 32) == 0xdeadbeef);
+    test.boolean("value wider than field is masked", (bb.appendData(0xff, 4), bb.getData(32, 4)) == 0xf);
+  }
+
+  {
+    BitBuffer bb(64);
+    bb.appendZeros(3);
+    bb.appendOnes(13);
+    test.boolean("appendOnes() across bytes", bb.getData(0, 16) == 0xfff8);
+  }
+
+  // Fuzz: random widths and values, checked bit by bit and field by
+  // field against a plain bit vector.
+  {
+    std::srand(27);
+
+    BitBuffer bb(8192);
+    std::vector<uint32_t> values;
+    std::vector<uint8_t> widths;
+    std::vector<bool> bits;
+
+    while (bits.size() + 32 < 8192 * 8)
+    {
+      uint8_t width = 1 + std::rand() % 32;
+      uint32_t value = ((uint32_t)std::rand() << 17) ^ (uint32_t)std::rand();
+      if (width < 32)
+        value &= (1ul << width) - 1;
+
+      bb.appendData(value, width);
+      values.push_back(value);
+      widths.push_back(width);
+      for (unsigned i = 0; i < width; ++i)
+        bits.push_back((value >> i) & 1);
+    }
+
+    test.boolean("fuzz: getBitsize()", bb.getBitsize() == bits.size());
+
+    bool bits_ok = true;
+    for (uint64_t i = 0; i < bits.size(); ++i)
+      bits_ok = bits_ok && (bb.getBit(i) == bits[i]);
+    test.boolean("fuzz: getBit()", bits_ok);
+
+    bool fields_ok = true;
+    uint64_t index = 0;
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+      fields_ok = fields_ok && (bb.getData(index, widths[i]) == values[i]);
+      index += widths[i];
+    }
+    test.boolean("fuzz: getData()", fields_ok);
+  }
+
+  return test.getReturnValue();
+}
@@ -0,0 +1,219 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+//***************************************************************************
+// Test program and micro-benchmark for the checksum algorithms used by    *
+// frame-based transports and log integrity (CRC8, CRC-16-IBM, CRC-32,     *
+// XOR checksum).                                                          *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstdio>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+using DUNE_NAMESPACES;
+
+// Local headers.
+#include "Test.hpp"
+
+// Buffer sizes representative of serial frames up to log blocks.
+static const unsigned c_sizes[] = {16, 64, 256, 1024, 8192};
+// Number of buffer sizes.
+static const unsigned c_size_count = sizeof(c_sizes) / sizeof(c_sizes[0]);
+// Bytes to process per benchmark measurement.
+static const unsigned c_bench_bytes = 16 * 1024 * 1024;
+
+//! Bitwise CRC8 reference (any polynomial).
+static uint8_t
+referenceCRC8(const uint8_t* data, unsigned size, uint8_t poly, uint8_t crc)
+{
+  while (size--)
+  {
+    crc ^= *data++;
+    for (int i = 0; i < 8; ++i)
+      crc = (crc & 0x80) ? (uint8_t)((crc << 1) ^ poly) : (uint8_t)(crc << 1);
+  }
+
+  return crc;
+}
+
+//! Bitwise CRC-16-IBM reference (reflected, polynomial 0xA001).
+static uint16_t
+referenceCRC16(const uint8_t* data, unsigned size, uint16_t crc)
+{
+  while (size--)
+  {
+    crc ^= *data++;
+    for (int i = 0; i < 8; ++i)
+      crc = (crc & 1) ? (uint16_t)((crc >> 1) ^ 0xA001) : (uint16_t)(crc >> 1);
+  }
+
+  return crc;
+}
+
+//! Bitwise CRC-32 reference (reflected, polynomial 0xEDB88320).
+static uint32_t
+referenceCRC32(const uint8_t* data, unsigned size, uint32_t crc)
+{
+  crc = ~crc;
+
+  while (size--)
+  {
+    crc ^= *data++;
+    for (int i = 0; i < 8; ++i)
+      crc = (crc & 1) ? ((crc >> 1) ^ 0xEDB88320) : (crc >> 1);
+  }
+
+  return ~crc;
+}
+
+//! Single accumulator XOR reference.
+static uint8_t
+referenceXOR(const uint8_t* data, unsigned size, uint8_t sum)
+{
+  while (size--)
+    sum ^= *data++;
+
+  return sum;
+}
+
+//! Measure throughput in MB/s of one algorithm over a buffer size.
+template <typename Func>
+static double
+throughput(Func func, const uint8_t* data, unsigned size)
+{
+  unsigned reps = c_bench_bytes / size;
+  volatile unsigned sink = 0;
+
+  double start = Clock::get();
+  for (unsigned i = 0; i < reps; ++i)
+    sink += func(data, size);
+  double elapsed = Clock::get() - start;
+  (void)sink;
+
+  return ((double)reps * size) / (elapsed * 1024.0 * 1024.0);
+}
+
+static unsigned
+runCRC8(const uint8_t* data, unsigned size)
+{
+  CRC8 crc(CRC8::c_ccitt_polynomial);
+  return crc.putArray(data, size);
+}
+
+static unsigned
+runCRC16(const uint8_t* data, unsigned size)
+{
+  return CRC16::compute(data, size);
+}
+
+static unsigned
+runCRC32(const uint8_t* data, unsigned size)
+{
+  return CRC32::compute(data, size);
+}
+
+static unsigned
+runXOR(const uint8_t* data, unsigned size)
+{
+  return XORChecksum::compute(data, size);
+}
+
+int
+main(void)
+{
+  Test test("Algorithms::Checksums");
+
+  Random::Generator* gen = Random::Factory::create(Random::Factory::c_default, 42);
+
+  std::vector<uint8_t> data(c_sizes[c_size_count - 1]);
+  for (unsigned i = 0; i < data.size(); ++i)
+    data[i] = (uint8_t)gen->random();
+  delete gen;
+
+  // Correctness: table/sliced implementations must match the bitwise
+  // references for all sizes, including non multiples of eight.
+  bool crc8_ok = true;
+  bool crc16_ok = true;
+  bool crc32_ok = true;
+  bool xor_ok = true;
+  for (unsigned size = 0; size <= 64; ++size)
+  {
+    CRC8 crc(CRC8::c_ccitt_polynomial, 0x5a);
+    crc.putArray(&data[0], size);
+    if (crc.get() != referenceCRC8(&data[0], size, CRC8::c_ccitt_polynomial, 0x5a))
+      crc8_ok = false;
+
+    if (CRC16::compute(&data[0], size, 0x1234) != referenceCRC16(&data[0], size, 0x1234))
+      crc16_ok = false;
+
+    if (CRC32::compute(&data[0], size, 0x1234) != referenceCRC32(&data[0], size, 0x1234))
+      crc32_ok = false;
+
+    if (XORChecksum::compute(&data[0], size, 0x5a) != referenceXOR(&data[0], size, 0x5a))
+      xor_ok = false;
+  }
+
+  test.boolean("CRC8 matches bitwise reference", crc8_ok);
+  test.boolean("CRC16 matches bitwise reference", crc16_ok);
+  test.boolean("CRC32 matches bitwise reference", crc32_ok);
+  test.boolean("XORChecksum matches single accumulator", xor_ok);
+
+  // CRC-32 check value of "123456789".
+  test.boolean("CRC32 check value",
+               CRC32::compute((const uint8_t*)"123456789", 9) == 0xCBF43926);
+
+  // Chaining: the CRC of a concatenation can be computed in parts.
+  test.boolean("CRC32 chaining",
+               CRC32::compute(&data[32], 32, CRC32::compute(&data[0], 32))
+               == CRC32::compute(&data[0], 64));
+
+  // A polynomial without tables must still use the bitwise path.
+  CRC8 other(0x31, 0xff);
+  other.putArray(&data[0], 32);
+  test.boolean("CRC8 generic polynomial",
+               other.get() == referenceCRC8(&data[0], 32, 0x31, 0xff));
+
+  // Micro-benchmark: throughput per algorithm and buffer size. Timings
+  // are informational only, no pass/fail thresholds.
+  std::printf("\n%8s %12s %12s %12s %12s\n", "size", "CRC8", "CRC16", "CRC32", "XOR");
+  for (unsigned i = 0; i < c_size_count; ++i)
+  {
+    unsigned size = c_sizes[i];
+    std::printf("%8u %10.1f MB/s %8.1f MB/s %8.1f MB/s %8.1f MB/s\n", size,
+                throughput(runCRC8, &data[0], size),
+                throughput(runCRC16, &data[0], size),
+                throughput(runCRC32, &data[0], size),
+                throughput(runXOR, &data[0], size));
+  }
+
+  return test.getReturnValue();
+}
@@ -0,0 +1,145 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <sstream>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/IMC/FieldVisitors.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using namespace DUNE::IMC;
+
+//! Visitor that counts fields and records scalar values as text.
+struct Recorder
+{
+  std::ostringstream text;
+  unsigned count;
+
+  Recorder(void):
+    count(0)
+  { }
+
+  template <typename T>
+  void
+  field(const char* name, const T& value)
+  {
+    text << name << '=' << value << ';';
+    ++count;
+  }
+
+  void
+  field(const char* name, uint8_t value)
+  {
+    text << name << '=' << (unsigned)value << ';';
+    ++count;
+  }
+
+  void
+  field(const char* name, const std::vector<char>& value)
+  {
+    text << name << '(' << value.size() << ");";
+    ++count;
+  }
+
+  template <typename T>
+  void
+  field(const char* name, const MessageList<T>& value)
+  {
+    text << name << "[" << value.size() << "];";
+    ++count;
+  }
+
+  template <typename T>
+  void
+  field(const char* name, const InlineMessage<T>& value)
+  {
+    (void)value;
+    text << name << "{};";
+    ++count;
+  }
+};
+
+int
+main(int argc, char** argv)
+{
+  Test test("IMC::FieldVisitors");
+
+  {
+    EntityInfo msg;
+    msg.id = 7;
+    msg.label = "ahrs";
+    msg.act_time = 10;
+
+    Recorder rec;
+    forEachField(msg, rec);
+    test.boolean("static visit: all fields, declared order",
+                 rec.text.str() == "id=7;label=ahrs;component=;"
+                 "act_time=10;deact_time=0;");
+  }
+
+  {
+    // Inherited fields are visited before the derived ones.
+    DesiredZ msg;
+    msg.value = 2.5;
+    msg.z_units = Z_DEPTH;
+
+    Recorder rec;
+    forEachField(msg, rec);
+    test.boolean("inherited fields", rec.count == 2);
+  }
+
+  {
+    PlanSpecification msg;
+    msg.plan_id = "survey";
+    msg.maneuvers.push_back(PlanManeuver());
+
+    Recorder rec;
+    forEachField(msg, rec);
+    test.boolean("message list fields",
+                 rec.text.str().find("maneuvers[1];") != std::string::npos);
+  }
+
+  {
+    // Runtime dispatch through the base class.
+    EntityState msg;
+    msg.description = "ok";
+
+    Recorder rec;
+    const Message& ref = msg;
+    bool known = forEachField(ref, rec);
+    test.boolean("runtime dispatch", known && rec.count == 3);
+  }
+
+  return test.getReturnValue();
+}
@@ -0,0 +1,116 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstdlib>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+#include <DUNE/Network/Fragments.hpp>
+#include <DUNE/Network/FragmentedMessage.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using namespace DUNE;
+
+static IMC::DevDataBinary*
+makeMessage(size_t size)
+{
+  IMC::DevDataBinary* msg = new IMC::DevDataBinary;
+  msg->setSource(42);
+  for (size_t i = 0; i < size; ++i)
+    msg->value.push_back((char)(std::rand() & 0xff));
+  return msg;
+}
+
+int
+main(void)
+{
+  Test test("Network::FragmentedMessage");
+  std::srand(7);
+
+  {
+    IMC::DevDataBinary* msg = makeMessage(900);
+    Network::Fragments frags(msg, 100);
+    int n = frags.getNumberOfFragments();
+    test.boolean("fragmented", n > 1);
+
+    Network::FragmentedMessage rx;
+    IMC::Message* out = NULL;
+    for (int i = 0; i < n; ++i)
+      out = rx.setFragment(frags.getFragment(i));
+
+    test.boolean("reassembled", (out != NULL) && (*out == *msg));
+    delete out;
+    delete msg;
+  }
+
+  {
+    IMC::DevDataBinary* msg = makeMessage(901);
+    Network::Fragments plain(msg, 100);
+    Network::Fragments frags(msg, 100, 4);
+    test.boolean("parity fragments present",
+                 frags.getNumberOfFragments() > plain.getNumberOfFragments());
+
+    int n = frags.getNumberOfFragments();
+    int data_frags = frags.getFragment(0)->num_frags;
+
+    // Drop one data fragment of each group of 4.
+    Network::FragmentedMessage rx;
+    IMC::Message* out = NULL;
+    for (int i = 0; i < n; ++i)
+    {
+      if (i < data_frags && (i % 4) == (i / 4) % 4)
+        continue;
+      out = rx.setFragment(frags.getFragment(i));
+    }
+
+    test.boolean("recovered from parity", (out != NULL) && (*out == *msg));
+    delete out;
+    delete msg;
+  }
+
+  {
+    IMC::DevDataBinary* msg = makeMessage(900);
+    Network::Fragments frags(msg, 100, 4);
+
+    // Two losses in the same group cannot be recovered.
+    Network::FragmentedMessage rx;
+    IMC::Message* out = NULL;
+    for (int i = 2; i < frags.getNumberOfFragments(); ++i)
+      out = rx.setFragment(frags.getFragment(i));
+
+    test.boolean("double loss not recoverable", out == NULL);
+    test.boolean("two fragments missing", rx.getFragmentsMissing() == 2);
+    delete msg;
+  }
+
+  return 0;
+}
@@ -0,0 +1,173 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: José Braga                                                       *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cmath>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Navigation/KalmanFilter.hpp>
+#include <DUNE/Math/Matrix.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using DUNE::Navigation::KalmanFilter;
+using DUNE::Math::Matrix;
+
+int
+main(int argc, char** argv)
+{
+  Test test("Navigation::KalmanFilter");
+
+  // Constant-position filter with a random-walk model.
+  KalmanFilter kf;
+  kf.reset(1, 1);
+  kf.setProcessNoise(0.1);
+  kf.setMeasurementNoise(1.0);
+  kf.setCovariance(1.0);
+  kf.setObservation(0, 0, 1.0);
+
+  {
+    // Delayed fusion disabled: updateDelayed() must refuse.
+    Matrix c(1, 1, 1.0);
+    Matrix z(1, 1, 0.0);
+    Matrix r(1, 1, 1.0);
+    test.boolean("fusion disabled", kf.updateDelayed(c, z, r, 0, 0.0) == -1);
+  }
+
+  kf.setDelayedFusion(8);
+
+  for (unsigned i = 0; i < 4; ++i)
+    kf.predict();
+
+  {
+    // Zero delay must match the standard update equations.
+    Matrix c(1, 1, 1.0);
+    Matrix z(1, 1, 2.0);
+    Matrix r(1, 1, 1.0);
+
+    double p = kf.getCovariance(0, 0);
+    double gain = p / (p + 1.0);
+
+    test.boolean("zero delay accepted", kf.updateDelayed(c, z, r, 0, 0.0) == 0);
+    test.boolean("zero delay state", std::fabs(kf.getState(0) - gain * 2.0) < 1e-9);
+    test.boolean("zero delay covariance",
+                 std::fabs(kf.getCovariance(0, 0) - (p - gain * p)) < 1e-9);
+  }
+
+  {
+    // A measurement older than the ring must be refused.
+    Matrix c(1, 1, 1.0);
+    Matrix z(1, 1, 0.0);
+    Matrix r(1, 1, 1.0);
+    test.boolean("delay beyond ring", kf.updateDelayed(c, z, r, 10, 0.0) == -1);
+  }
+
+  {
+    // With an identity transition and no intermediate updates, a
+    // delayed measurement must pull the estimate towards it.
+    double before = kf.getState(0);
+    Matrix c(1, 1, 1.0);
+    Matrix z(1, 1, 4.0);
+    Matrix r(1, 1, 1.0);
+    test.boolean("delayed accepted", kf.updateDelayed(c, z, r, 3, 0.0) == 0);
+    test.boolean("delayed pulls estimate", kf.getState(0) > before);
+    test.boolean("delayed stays bounded", kf.getState(0) < 4.0);
+  }
+
+  {
+    // Innovation gating.
+    Matrix c(1, 1, 1.0);
+    Matrix z(1, 1, 1000.0);
+    Matrix r(1, 1, 1.0);
+    kf.predict();
+    test.boolean("innovation rejected", kf.updateDelayed(c, z, r, 1, 9.0) == -1);
+  }
+
+  {
+    // Block structured propagation must match dense propagation for
+    // a transition with zero cross blocks.
+    KalmanFilter dense;
+    KalmanFilter sparse;
+    dense.reset(6, 1);
+    sparse.reset(6, 1);
+
+    Matrix a(6, 6, 0.0);
+    a.identity();
+    // Position/velocity coupling inside the first block, decoupled
+    // bias random walks in the second.
+    a(0, 2) = 0.1;
+    a(1, 3) = 0.1;
+
+    dense.setTransitions(a);
+    sparse.setTransitions(a);
+    dense.setProcessNoise(0.01);
+    sparse.setProcessNoise(0.01);
+    dense.setCovariance(1.0);
+    sparse.setCovariance(1.0);
+
+    std::vector<size_t> blocks;
+    blocks.push_back(4);
+    blocks.push_back(2);
+    sparse.setBlockStructure(blocks);
+
+    bool mismatch = false;
+    for (unsigned i = 0; i < 5; ++i)
+    {
+      dense.predict();
+      sparse.predict();
+    }
+
+    for (short i = 0; i < 6 && !mismatch; ++i)
+      for (short j = 0; j < 6; ++j)
+        if (std::fabs(dense.getCovariance(i, j) - sparse.getCovariance(i, j)) > 1e-12)
+        {
+          mismatch = true;
+          break;
+        }
+
+    test.boolean("block propagation matches dense", !mismatch);
+
+    // An ill-sized partition must be refused.
+    bool thrown = false;
+    blocks.push_back(3);
+    try
+    {
+      sparse.setBlockStructure(blocks);
+    }
+    catch (std::runtime_error&)
+    {
+      thrown = true;
+    }
+    test.boolean("invalid partition refused", thrown);
+  }
+
+  return test.getReturnValue();
+}
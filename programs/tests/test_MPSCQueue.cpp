@@ -0,0 +1,139 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+
+// ISO C++ 98 headers.
+#include <set>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using namespace DUNE::Concurrency;
+
+//! Number of producer threads.
+static const unsigned c_producers = 4;
+//! Elements pushed by each producer.
+static const unsigned c_items = 20000;
+
+typedef MPSCQueue<uint32_t, 1024> Queue;
+
+class Producer: public Thread
+{
+public:
+  Producer(Queue& queue, uint32_t base):
+    m_queue(queue),
+    m_base(base)
+  { }
+
+  void
+  run(void)
+  {
+    for (unsigned i = 0; i < c_items; ++i)
+    {
+      while (!m_queue.push(m_base + i))
+        Scheduler::yield();
+    }
+  }
+
+private:
+  Queue& m_queue;
+  uint32_t m_base;
+};
+
+int
+main(void)
+{
+  Test test("Concurrency::MPSCQueue");
+
+  {
+    Queue queue;
+    test.boolean("empty()", queue.empty());
+    test.boolean("getCapacity()", queue.getCapacity() == 1024);
+
+    uint32_t v = 0;
+    test.boolean("pop() on empty queue", !queue.pop(v));
+
+    queue.push(42);
+    test.boolean("push()/pop()", queue.pop(v) && v == 42);
+
+    // Fill to capacity: the next push must be rejected.
+    for (uint32_t i = 0; i < queue.getCapacity(); ++i)
+      queue.push(i);
+    test.boolean("push() on full queue", !queue.push(0));
+  }
+
+  {
+    // FIFO order is preserved per producer.
+    Queue queue;
+    Producer* producers[c_producers];
+    for (unsigned i = 0; i < c_producers; ++i)
+    {
+      producers[i] = new Producer(queue, i * c_items);
+      producers[i]->start();
+    }
+
+    std::vector<uint32_t> last(c_producers, 0);
+    std::set<uint32_t> seen;
+    bool ordered = true;
+    while (seen.size() < c_producers * c_items)
+    {
+      uint32_t v = 0;
+      if (!queue.pop(v))
+      {
+        Scheduler::yield();
+        continue;
+      }
+
+      unsigned src = v / c_items;
+      if (!seen.empty() && seen.find(v) == seen.end() && v % c_items != 0)
+      {
+        if (v <= last[src] && last[src] != 0)
+          ordered = false;
+      }
+      last[src] = v;
+      seen.insert(v);
+    }
+
+    for (unsigned i = 0; i < c_producers; ++i)
+    {
+      producers[i]->stopAndJoin();
+      delete producers[i];
+    }
+
+    test.boolean("all elements delivered", seen.size() == c_producers * c_items);
+    test.boolean("per-producer order preserved", ordered);
+    test.boolean("queue drained", queue.empty());
+  }
+
+  return test.getReturnValue();
+}
@@ -0,0 +1,202 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+// Test program and micro-benchmark for DUNE::Math::Matrix kernels.         *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Math/Matrix.hpp>
+#include <DUNE/Math/Random.hpp>
+#include <DUNE/Time/Clock.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using namespace DUNE;
+
+// Covariance block dimension used by the benchmark.
+static const int c_dim = 60;
+// Benchmark repetitions.
+static const int c_reps = 200;
+
+//! Reference product with no kernel tricks.
+static Math::Matrix
+referenceProduct(const Math::Matrix& a, const Math::Matrix& b)
+{
+  Math::Matrix s(a.rows(), b.columns(), 0.0);
+
+  for (int i = 0; i < a.rows(); ++i)
+    for (int j = 0; j < b.columns(); ++j)
+      for (int k = 0; k < a.columns(); ++k)
+        s(i, j) += a(i, k) * b(k, j);
+
+  return s;
+}
+
+//! Largest absolute element difference between two matrices.
+static double
+maxError(const Math::Matrix& a, const Math::Matrix& b)
+{
+  double err = 0.0;
+
+  for (int i = 0; i < a.rows(); ++i)
+  {
+    for (int j = 0; j < a.columns(); ++j)
+    {
+      double e = std::fabs(a(i, j) - b(i, j));
+      if (e > err)
+        err = e;
+    }
+  }
+
+  return err;
+}
+
+int
+main(void)
+{
+  Test test("Math::Matrix");
+
+  Math::Random::Generator* rnd = Math::Random::Factory::create("drand48", 0);
+
+  Math::Matrix a(c_dim, c_dim);
+  Math::Matrix b(c_dim, c_dim);
+
+  for (int i = 0; i < c_dim; ++i)
+  {
+    for (int j = 0; j < c_dim; ++j)
+    {
+      a(i, j) = rnd->uniform();
+      b(i, j) = rnd->uniform();
+    }
+    // Diagonal dominance keeps the inversion well conditioned.
+    a(i, i) += c_dim;
+  }
+
+  // Correctness of the multiply kernels against the reference.
+  Math::Matrix ref = referenceProduct(a, b);
+
+  test.boolean("operator*", maxError(a * b, ref) < 1e-9);
+
+  Math::Matrix d;
+  Math::Matrix::multiply(a, b, d);
+  test.boolean("multiply()", maxError(d, ref) < 1e-9);
+
+  Math::Matrix dt;
+  Math::Matrix::multiplyByTranspose(a, transpose(b), dt);
+  test.boolean("multiplyByTranspose()", maxError(dt, ref) < 1e-9);
+
+  Math::Matrix acc = ref;
+  Math::Matrix::multiplyAdd(a, b, acc);
+  Math::Matrix::multiplySub(a, b, acc);
+  test.boolean("multiplyAdd()/multiplySub()", maxError(acc, ref) < 1e-9);
+
+  // Block sparse kernels: skipping zero cross blocks must not change
+  // the result.
+  {
+    std::vector<size_t> blocks;
+    blocks.push_back(3);
+    blocks.push_back(4);
+    blocks.push_back(2);
+
+    Math::Matrix sa(9, 9, 0.0);
+    Math::Matrix p(9, 9);
+
+    // Dense diagonal blocks, one coupled off-diagonal block, the
+    // rest zero.
+    for (int i = 0; i < 9; ++i)
+      for (int j = 0; j < 9; ++j)
+        p(i, j) = rnd->uniform();
+
+    for (int i = 0; i < 3; ++i)
+      for (int j = 0; j < 3; ++j)
+        sa(i, j) = rnd->uniform();
+
+    for (int i = 3; i < 7; ++i)
+      for (int j = 3; j < 7; ++j)
+        sa(i, j) = rnd->uniform();
+
+    for (int i = 7; i < 9; ++i)
+      for (int j = 7; j < 9; ++j)
+        sa(i, j) = rnd->uniform();
+
+    for (int i = 0; i < 3; ++i)
+      for (int j = 3; j < 7; ++j)
+        sa(i, j) = rnd->uniform();
+
+    Math::Matrix bd;
+    Math::Matrix::multiplyBlocks(sa, p, bd, blocks);
+    test.boolean("multiplyBlocks()", maxError(bd, referenceProduct(sa, p)) < 1e-9);
+
+    Math::Matrix bt;
+    Math::Matrix::multiplyByTransposeBlocks(p, sa, bt, blocks);
+    test.boolean("multiplyByTransposeBlocks()",
+                 maxError(bt, referenceProduct(p, transpose(sa))) < 1e-9);
+  }
+
+  // Inversion sanity.
+  Math::Matrix ia = inverse(a);
+  Math::Matrix eye(c_dim);
+  test.boolean("inverse()", maxError(a * ia, eye) < 1e-6);
+
+  // Micro-benchmark: track kernel regressions over time. Timings are
+  // informative only and never fail the test.
+  double start = Time::Clock::get();
+  for (int i = 0; i < c_reps; ++i)
+    d = a * b;
+  double mul_time = Time::Clock::get() - start;
+
+  start = Time::Clock::get();
+  for (int i = 0; i < c_reps; ++i)
+    Math::Matrix::multiply(a, b, d);
+  double fused_time = Time::Clock::get() - start;
+
+  start = Time::Clock::get();
+  for (int i = 0; i < c_reps; ++i)
+    Math::Matrix::multiplyByTranspose(a, b, d);
+  double tmul_time = Time::Clock::get() - start;
+
+  start = Time::Clock::get();
+  for (int i = 0; i < c_reps; ++i)
+    ia = inverse(a);
+  double inv_time = Time::Clock::get() - start;
+
+  std::printf("%dx%d multiply (operator*):   %0.3f ms/op\n", c_dim, c_dim, 1000.0 * mul_time / c_reps);
+  std::printf("%dx%d multiply (fused):       %0.3f ms/op\n", c_dim, c_dim, 1000.0 * fused_time / c_reps);
+  std::printf("%dx%d multiply by transpose:  %0.3f ms/op\n", c_dim, c_dim, 1000.0 * tmul_time / c_reps);
+  std::printf("%dx%d inverse:                %0.3f ms/op\n", c_dim, c_dim, 1000.0 * inv_time / c_reps);
+
+  delete rnd;
+
+  return 0;
+}
@@ -0,0 +1,144 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+// Test program for the DUNE::Memory allocator suite (arena with     *
+// scope reset, block pool with size-segregated free lists).         *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstring>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+using DUNE_NAMESPACES;
+
+// Local headers.
+#include "Test.hpp"
+
+int
+main(void)
+{
+  Test test("Memory");
+
+  // Arena: allocations are aligned and served from chained blocks.
+  {
+    Memory::Arena arena(128);
+    void* a = arena.allocate(10);
+    void* b = arena.allocate(10);
+    test.boolean("arena: allocations are distinct",
+                 a != b);
+    test.boolean("arena: allocations are aligned",
+                 ((size_t)a % sizeof(double)) == 0 && ((size_t)b % sizeof(double)) == 0);
+
+    void* big = arena.allocate(1000);
+    test.boolean("arena: oversized request is served", big != NULL);
+  }
+
+  // Arena: rewinding to a mark reuses storage without new blocks.
+  {
+    Memory::Arena arena(128);
+    arena.allocate(64);
+    size_t capacity = arena.getCapacity();
+
+    Memory::Arena::Mark mrk = arena.mark();
+    void* a = arena.allocate(32);
+    arena.rewind(mrk);
+    void* b = arena.allocate(32);
+    test.boolean("arena: rewind reuses storage", a == b);
+    test.boolean("arena: rewind keeps blocks", arena.getCapacity() == capacity);
+
+    arena.clear();
+    void* c = arena.allocate(8);
+    arena.clear();
+    test.boolean("arena: clear rewinds to the start", arena.allocate(8) == c);
+  }
+
+  // Arena: a scope rewinds on destruction.
+  {
+    Memory::Arena arena;
+    void* before;
+    {
+      Memory::Arena::Scope scope(arena);
+      before = arena.allocate(16);
+    }
+    test.boolean("arena: scope rewinds on destruction",
+                 arena.allocate(16) == before);
+  }
+
+#if defined(DUNE_MEMORY_POISON)
+  // Arena: rewound storage is poisoned.
+  {
+    Memory::Arena arena;
+    Memory::Arena::Mark mrk = arena.mark();
+    uint8_t* ptr = (uint8_t*)arena.allocate(16);
+    std::memset(ptr, 0, 16);
+    arena.rewind(mrk);
+
+    bool poisoned = true;
+    for (unsigned i = 0; i < 16; ++i)
+      poisoned = poisoned && (ptr[i] == 0xDE);
+    test.boolean("arena: rewound storage is poisoned", poisoned);
+  }
+#endif
+
+  // BlockPool: freed blocks are recycled, oversized requests fall
+  // back to the heap.
+  {
+    size_t sizes[] = {32, 64};
+    Memory::BlockPool pool(sizes, 2, 16);
+
+    void* a = pool.allocate(20);
+    pool.deallocate(a);
+    void* b = pool.allocate(30);
+    test.boolean("pool: freed block is recycled", a == b);
+
+    void* big = pool.allocate(100);
+    test.boolean("pool: oversized request is served", big != NULL);
+    pool.deallocate(big);
+    pool.deallocate(b);
+    pool.clear();
+  }
+
+  // ByteBuffer: contents survive growth through the pool.
+  {
+    ByteBuffer bfr;
+    std::vector<uint8_t> data(3000);
+    for (unsigned i = 0; i < data.size(); ++i)
+      data[i] = (uint8_t)(i * 7);
+
+    for (unsigned i = 0; i < data.size(); ++i)
+      bfr.append(&data[i], 1);
+
+    test.boolean("byte buffer: contents survive growth",
+                 bfr.getSize() == data.size()
+                 && std::memcmp(bfr.getBuffer(), &data[0], data.size()) == 0);
+  }
+
+  return test.getReturnValue();
+}
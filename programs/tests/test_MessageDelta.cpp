@@ -0,0 +1,136 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using DUNE_NAMESPACES;
+
+int
+main(int argc, char** argv)
+{
+  Test test("IMC::MessageDelta");
+
+  uint8_t bfr[1024];
+
+  // No previous instance: full payload, decodable without context.
+  {
+    IMC::EstimatedState es;
+    es.lat = 0.71;
+    es.lon = -0.15;
+    es.depth = 2.5;
+
+    uint16_t rv = IMC::MessageDelta::encode(NULL, &es, bfr, sizeof(bfr));
+    test.boolean("full: encode", rv > 0);
+
+    IMC::Message* msg = IMC::MessageDelta::decode(NULL, bfr, rv);
+    test.boolean("full: decode type", msg->getId() == IMC::EstimatedState::getIdStatic());
+    test.boolean("full: fields equal", msg->fieldsEqual(es));
+    delete msg;
+  }
+
+  // Few changed fields: delta smaller than the full payload.
+  {
+    IMC::EstimatedState prev;
+    prev.lat = 0.71;
+    prev.lon = -0.15;
+    prev.depth = 2.5;
+    prev.psi = 1.0;
+
+    IMC::EstimatedState cur(prev);
+    cur.depth = 2.6f;
+    cur.psi = 1.1f;
+
+    uint16_t full = IMC::MessageDelta::encode(NULL, &cur, bfr, sizeof(bfr));
+    uint16_t delta = IMC::MessageDelta::encode(&prev, &cur, bfr, sizeof(bfr));
+    test.boolean("delta: smaller than full", delta < full);
+
+    IMC::Message* msg = IMC::MessageDelta::decode(&prev, bfr, delta);
+    test.boolean("delta: fields equal", msg->fieldsEqual(cur));
+    delete msg;
+  }
+
+  // Identical instances: only header and mask on the wire.
+  {
+    IMC::EstimatedState prev;
+    prev.lat = 0.71;
+
+    IMC::EstimatedState cur(prev);
+
+    uint16_t rv = IMC::MessageDelta::encode(&prev, &cur, bfr, sizeof(bfr));
+    test.boolean("no change: tiny encoding", rv < 16);
+
+    IMC::Message* msg = IMC::MessageDelta::decode(&prev, bfr, rv);
+    test.boolean("no change: fields equal", msg->fieldsEqual(cur));
+    delete msg;
+  }
+
+  // Variable length payload changed size: falls back to full form and
+  // still round-trips.
+  {
+    IMC::LogBookEntry prev;
+    prev.text = "short";
+
+    IMC::LogBookEntry cur;
+    cur.text = "a considerably longer log book entry";
+
+    uint16_t rv = IMC::MessageDelta::encode(&prev, &cur, bfr, sizeof(bfr));
+    IMC::Message* msg = IMC::MessageDelta::decode(&prev, bfr, rv);
+    test.boolean("variable size: fields equal", msg->fieldsEqual(cur));
+    delete msg;
+  }
+
+  // Delta against the wrong baseline must not decode.
+  {
+    IMC::EstimatedState prev;
+    prev.lat = 0.71;
+
+    IMC::EstimatedState cur(prev);
+    cur.depth = 3.0;
+
+    uint16_t rv = IMC::MessageDelta::encode(&prev, &cur, bfr, sizeof(bfr));
+
+    bool caught = false;
+    try
+    {
+      IMC::Message* msg = IMC::MessageDelta::decode(NULL, bfr, rv);
+      delete msg;
+    }
+    catch (IMC::InvalidFormat& e)
+    {
+      caught = true;
+    }
+    test.boolean("missing baseline: InvalidFormat", caught);
+  }
+
+  return test.getReturnValue();
+}
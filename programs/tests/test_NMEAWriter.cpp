@@ -0,0 +1,88 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <string>
+
+// DUNE headers.
+#include <DUNE/Parsers/NMEAWriter.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using namespace DUNE::Parsers;
+
+int
+main(int argc, char** argv)
+{
+  Test test("Parsers::NMEAWriter");
+
+  {
+    NMEAWriter w("GPGGA");
+    w << 123519 << "4807.038" << std::string("N") << 1u << true
+      << 0.5 << -12.3456789 << 1234567.89 << 0.000012345;
+    test.boolean("mixed fields",
+                 w.sentence() == "$GPGGA,123519,4807.038,N,1,1,0.5,"
+                 "-12.3457,1.23457e+06,1.2345e-05*3B\r\n");
+  }
+
+  {
+    NMEAWriter w("PUBX");
+    w << false << -5 << 3.14159265358979;
+    test.boolean("checksum", w.sentence() == "$PUBX,0,-5,3.14159*3E\r\n");
+  }
+
+  {
+    NMEAWriter w("PDUNE");
+    test.boolean("no fields", w.sentence() == "$PDUNE*4A\r\n");
+  }
+
+  {
+    // Reuse after clear() keeps the sentence type prefix.
+    NMEAWriter w("PUBX");
+    w << 1 << 2;
+    w.clear();
+    w << false << -5 << 3.14159265358979;
+    test.boolean("reuse after clear",
+                 w.sentence() == "$PUBX,0,-5,3.14159*3E\r\n");
+
+    // Caller buffer output matches the string output.
+    char bfr[64];
+    size_t size = w.sentence(bfr, sizeof(bfr));
+    test.boolean("caller buffer",
+                 std::string(bfr, size) == "$PUBX,0,-5,3.14159*3E\r\n");
+
+    // Truncation to a small buffer is reported.
+    char small[8];
+    test.boolean("caller buffer truncation",
+                 w.sentence(small, sizeof(small)) == sizeof(small) - 1);
+  }
+
+  return test.getReturnValue();
+}
@@ -0,0 +1,157 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cmath>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Parsers/PD0.hpp>
+#include <DUNE/Math/Constants.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using DUNE::Parsers::PD0;
+
+static void
+pushU16(std::vector<uint8_t>& frame, uint16_t value)
+{
+  frame.push_back(value & 0xff);
+  frame.push_back(value >> 8);
+}
+
+//! Build a minimal valid ensemble with a fixed leader, a variable
+//! leader and a velocity profile of two cells by four beams.
+static std::vector<uint8_t>
+buildEnsemble(void)
+{
+  std::vector<uint8_t> fixed(34, 0);
+  fixed[8] = 4;
+  fixed[9] = 2;
+  fixed[12] = 200 & 0xff;
+  fixed[13] = 200 >> 8;
+  fixed[32] = 150 & 0xff;
+  fixed[33] = 150 >> 8;
+
+  std::vector<uint8_t> variable(28, 0);
+  variable[0] = 0x80;
+  variable[2] = 42;
+  variable[14] = 1500 & 0xff;
+  variable[15] = 1500 >> 8;
+  variable[16] = 125 & 0xff;
+  variable[17] = 125 >> 8;
+  variable[18] = 9000 & 0xff;
+  variable[19] = 9000 >> 8;
+  variable[26] = 1234 & 0xff;
+  variable[27] = 1234 >> 8;
+
+  std::vector<uint8_t> velocity;
+  pushU16(velocity, 0x0100);
+  // Cell 0: four valid beams.
+  pushU16(velocity, (uint16_t)100);
+  pushU16(velocity, (uint16_t)-200);
+  pushU16(velocity, (uint16_t)300);
+  pushU16(velocity, (uint16_t)0);
+  // Cell 1: beam 1 invalid.
+  pushU16(velocity, (uint16_t)50);
+  pushU16(velocity, (uint16_t)-32768);
+  pushU16(velocity, (uint16_t)-50);
+  pushU16(velocity, (uint16_t)25);
+
+  unsigned hdr_size = 6 + 2 * 3;
+  unsigned size = hdr_size + fixed.size() + variable.size() + velocity.size();
+
+  std::vector<uint8_t> frame;
+  frame.push_back(0x7f);
+  frame.push_back(0x7f);
+  pushU16(frame, size);
+  frame.push_back(0);
+  frame.push_back(3);
+  pushU16(frame, hdr_size);
+  pushU16(frame, hdr_size + fixed.size());
+  pushU16(frame, hdr_size + fixed.size() + variable.size());
+  frame.insert(frame.end(), fixed.begin(), fixed.end());
+  frame.insert(frame.end(), variable.begin(), variable.end());
+  frame.insert(frame.end(), velocity.begin(), velocity.end());
+
+  uint16_t csum = 0;
+  for (unsigned i = 0; i < frame.size(); ++i)
+    csum += frame[i];
+  pushU16(frame, csum);
+
+  return frame;
+}
+
+int
+main(int argc, char** argv)
+{
+  Test test("Parsers::PD0");
+
+  std::vector<uint8_t> frame = buildEnsemble();
+
+  {
+    PD0 parser;
+    bool done = false;
+    for (unsigned i = 0; i < frame.size(); ++i)
+      done = parser.parse(frame[i]) || done;
+
+    test.boolean("ensemble decoded", done);
+
+    const PD0::Data* data = parser.data();
+    test.boolean("ensemble number", data->ensemble == 42);
+    test.boolean("geometry", data->n_beams == 4 && data->n_cells == 2);
+    test.boolean("cell length", std::fabs(data->cell_length - 2.0) < 0.001);
+    test.boolean("bin 1 distance", std::fabs(data->bin1_dist - 1.5) < 0.001);
+    test.boolean("sound speed", std::fabs(data->sound_speed - 1500.0) < 0.001);
+    test.boolean("depth", std::fabs(data->depth - 12.5) < 0.001);
+    test.boolean("heading", std::fabs(data->heading - DUNE::Math::c_half_pi) < 0.001);
+    test.boolean("temperature", std::fabs(data->temperature - 12.34) < 0.001);
+    test.boolean("cell 0 validity", data->vel_validity[0] == 0x0f);
+    test.boolean("cell 0 velocity", std::fabs(data->vel[0][1] + 0.2) < 0.0001);
+    test.boolean("cell 1 validity", data->vel_validity[1] == 0x0d);
+    test.boolean("cell 1 velocity", std::fabs(data->vel[1][3] - 0.025) < 0.0001);
+  }
+
+  {
+    // A corrupted byte must invalidate the ensemble, and a fresh
+    // frame afterwards must still be decoded.
+    PD0 parser;
+    bool done = false;
+    for (unsigned i = 0; i < frame.size(); ++i)
+      done = parser.parse(i == 20 ? frame[i] ^ 0xff : frame[i]) || done;
+    test.boolean("corrupted rejected", !done);
+
+    for (unsigned i = 0; i < frame.size(); ++i)
+      done = parser.parse(frame[i]) || done;
+    test.boolean("recovery after corruption", done);
+  }
+
+  return test.getReturnValue();
+}
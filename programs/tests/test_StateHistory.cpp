@@ -0,0 +1,88 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Pedro Calado                                                     *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cmath>
+
+// DUNE headers.
+#include <DUNE/Navigation/StateHistory.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using namespace DUNE;
+using namespace DUNE::Navigation;
+
+int
+main(int argc, char** argv)
+{
+  Test test("Navigation::StateHistory");
+
+  StateHistory hist(4);
+  IMC::EstimatedState out;
+
+  test.boolean("empty lookup fails", !hist.get(1.0, out));
+
+  for (unsigned i = 0; i < 6; ++i)
+  {
+    IMC::EstimatedState state;
+    state.setTimeStamp((double)i);
+    state.x = (double)i * 10.0;
+    state.psi = 0.0;
+    hist.insert(state);
+  }
+
+  // Ring capacity is 4: samples 0 and 1 were overwritten.
+  test.boolean("oldest overwritten", !hist.get(1.0, out));
+
+  test.boolean("interpolated position",
+               hist.get(3.5, out) && std::fabs(out.x - 35.0) < 1e-6);
+
+  test.boolean("exact match",
+               hist.get(4.0, out) && std::fabs(out.x - 40.0) < 1e-6);
+
+  test.boolean("future lookup fails", !hist.get(5.5, out));
+
+  {
+    StateHistory ang(2);
+    IMC::EstimatedState state;
+    state.setTimeStamp(0.0);
+    state.psi = 3.0;
+    ang.insert(state);
+    state.setTimeStamp(1.0);
+    state.psi = -3.0;
+    ang.insert(state);
+
+    // Shortest arc crosses +/- pi, not zero.
+    test.boolean("angle wrap",
+                 ang.get(0.5, out) && std::fabs(std::fabs(out.psi) - DUNE::Math::c_pi) < 1e-6);
+  }
+
+  return test.getReturnValue();
+}
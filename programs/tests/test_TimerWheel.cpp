@@ -0,0 +1,161 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstdio>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+using DUNE_NAMESPACES;
+
+// Local headers.
+#include "Test.hpp"
+
+//! Listener recording expiry order and times.
+class Recorder: public TimerWheel::Listener
+{
+public:
+  std::vector<TimerWheel::TimerId> order;
+  std::vector<double> times;
+  TimerWheel* wheel;
+  double rearm_delay;
+
+  Recorder(void):
+    wheel(NULL),
+    rearm_delay(-1.0)
+  { }
+
+  void
+  onTimerExpired(TimerWheel::TimerId id, void* data)
+  {
+    (void)data;
+    order.push_back(id);
+    times.push_back(Clock::get());
+
+    if (wheel != NULL && rearm_delay >= 0.0)
+    {
+      wheel->add(rearm_delay, this);
+      rearm_delay = -1.0;
+    }
+  }
+};
+
+int
+main(void)
+{
+  Test test("Time::TimerWheel");
+
+  // Expiry order and timing.
+  {
+    TimerWheel wheel(0.01);
+    Recorder rec;
+
+    double start = Clock::get();
+    TimerWheel::TimerId t2 = wheel.add(0.10, &rec);
+    TimerWheel::TimerId t0 = wheel.add(0.02, &rec);
+    TimerWheel::TimerId t1 = wheel.add(0.05, &rec);
+    test.boolean("size is 3", wheel.size() == 3);
+
+    double eta = wheel.getEta();
+    test.boolean("eta close to first deadline", eta > 0.0 && eta <= 0.04);
+
+    while (wheel.size() > 0 && Clock::get() - start < 1.0)
+    {
+      Delay::wait(0.005);
+      wheel.advance();
+    }
+
+    bool in_order = rec.order.size() == 3 && rec.order[0] == t0
+                    && rec.order[1] == t1 && rec.order[2] == t2;
+    test.boolean("timers fired in deadline order", in_order);
+
+    bool not_early = rec.times.size() == 3
+                     && rec.times[0] - start >= 0.02
+                     && rec.times[1] - start >= 0.05
+                     && rec.times[2] - start >= 0.10;
+    test.boolean("timers never fired early", not_early);
+    test.boolean("eta negative when empty", wheel.getEta() < 0.0);
+  }
+
+  // Cancellation.
+  {
+    TimerWheel wheel(0.01);
+    Recorder rec;
+
+    TimerWheel::TimerId keep = wheel.add(0.02, &rec);
+    TimerWheel::TimerId drop = wheel.add(0.02, &rec);
+    test.boolean("cancel pending timer", wheel.cancel(drop));
+    test.boolean("cancel unknown timer", !wheel.cancel(drop));
+
+    Delay::wait(0.05);
+    wheel.advance();
+    test.boolean("cancelled timer did not fire",
+                 rec.order.size() == 1 && rec.order[0] == keep);
+  }
+
+  // Rearming from inside the callback.
+  {
+    TimerWheel wheel(0.01);
+    Recorder rec;
+    rec.wheel = &wheel;
+    rec.rearm_delay = 0.02;
+
+    wheel.add(0.02, &rec);
+    double start = Clock::get();
+    while (rec.order.size() < 2 && Clock::get() - start < 1.0)
+    {
+      Delay::wait(0.005);
+      wheel.advance();
+    }
+
+    test.boolean("rearmed timer fired", rec.order.size() == 2);
+  }
+
+  // Long deadlines cascade through the upper wheel levels.
+  {
+    TimerWheel wheel(0.0001);
+    Recorder rec;
+
+    // 5000 ticks: lives in the second level until cascaded.
+    wheel.add(0.5, &rec);
+    double start = Clock::get();
+    while (rec.order.empty() && Clock::get() - start < 2.0)
+    {
+      Delay::wait(0.01);
+      wheel.advance();
+    }
+
+    test.boolean("upper level timer fired",
+                 rec.order.size() == 1 && Clock::get() - start >= 0.5);
+  }
+
+  return test.getReturnValue();
+}
@@ -0,0 +1,188 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+// Accuracy and speed test for Math::TrigApprox against libm and for the   *
+// trig-free Angles::minSignedAngle.                                       *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstdio>
+#include <cmath>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+using DUNE_NAMESPACES;
+
+// Local headers.
+#include "Test.hpp"
+
+// Documented error bound of TrigApprox::sin / TrigApprox::cos.
+static const double c_sin_bound = 1e-7;
+// Documented error bound of TrigApprox::atan2.
+static const double c_atan2_bound = 1e-8;
+// Number of samples per accuracy sweep.
+static const unsigned c_sweep = 200000;
+// Number of calls per benchmark measurement.
+static const unsigned c_bench_calls = 10 * 1000 * 1000;
+
+//! Largest absolute error of TrigApprox::sin over [-range, range].
+static double
+maxErrorSin(double range)
+{
+  double max_err = 0;
+  for (unsigned i = 0; i <= c_sweep; ++i)
+  {
+    double a = -range + (2 * range * i) / c_sweep;
+    double err = std::fabs(TrigApprox::sin(a) - std::sin(a));
+    if (err > max_err)
+      max_err = err;
+  }
+
+  return max_err;
+}
+
+//! Largest absolute error of TrigApprox::cos over [-range, range].
+static double
+maxErrorCos(double range)
+{
+  double max_err = 0;
+  for (unsigned i = 0; i <= c_sweep; ++i)
+  {
+    double a = -range + (2 * range * i) / c_sweep;
+    double err = std::fabs(TrigApprox::cos(a) - std::cos(a));
+    if (err > max_err)
+      max_err = err;
+  }
+
+  return max_err;
+}
+
+//! Largest absolute error of TrigApprox::atan2 over a grid of
+//! (y, x) pairs covering all quadrants and slopes.
+static double
+maxErrorAtan2(void)
+{
+  double max_err = 0;
+  for (int yi = -300; yi <= 300; ++yi)
+  {
+    for (int xi = -300; xi <= 300; ++xi)
+    {
+      double y = yi / 7.0;
+      double x = xi / 7.0;
+      if (y == 0 && x == 0)
+        continue;
+
+      double err = std::fabs(TrigApprox::atan2(y, x) - std::atan2(y, x));
+      if (err > max_err)
+        max_err = err;
+    }
+  }
+
+  return max_err;
+}
+
+//! Benchmark one sin-like function, returning calls per second. The
+//! accumulator is returned through sum to keep the calls observable.
+static double
+benchmarkSin(double (*func)(double), double& sum)
+{
+  double arg = -10.0;
+  double step = 20.0 / c_bench_calls;
+
+  double start = Time::Clock::get();
+  for (unsigned i = 0; i < c_bench_calls; ++i)
+  {
+    sum += func(arg);
+    arg += step;
+  }
+  double elapsed = Time::Clock::get() - start;
+
+  return c_bench_calls / elapsed;
+}
+
+static double
+stdSin(double a)
+{
+  return std::sin(a);
+}
+
+static double
+oldMinSignedAngle(double source, double target)
+{
+  return std::atan2(std::sin(target - source), std::cos(target - source));
+}
+
+int
+main(void)
+{
+  Test test("Math::TrigApprox");
+
+  test.boolean("sin error bound over [-pi, pi]",
+               maxErrorSin(Math::c_pi) <= c_sin_bound);
+
+  test.boolean("sin error bound over [-100, 100]",
+               maxErrorSin(100.0) <= c_sin_bound);
+
+  test.boolean("cos error bound over [-100, 100]",
+               maxErrorCos(100.0) <= c_sin_bound);
+
+  test.boolean("atan2 error bound", maxErrorAtan2() <= c_atan2_bound);
+
+  test.boolean("atan2 of origin is zero", TrigApprox::atan2(0.0, 0.0) == 0.0);
+
+  // Angles::minSignedAngle no longer goes through atan2(sin, cos);
+  // check it still matches the transcendental form. The two differ
+  // only at an exact half turn, where +pi and -pi name the same
+  // angle.
+  {
+    double max_err = 0;
+    for (unsigned i = 0; i <= c_sweep; ++i)
+    {
+      double source = -15.0 + (30.0 * i) / c_sweep;
+      double target = 15.0 - (27.0 * i) / c_sweep;
+      double err = std::fabs(Angles::minSignedAngle(source, target)
+                             - oldMinSignedAngle(source, target));
+      if (err > max_err)
+        max_err = err;
+    }
+    test.boolean("minSignedAngle matches atan2(sin, cos)", max_err <= 1e-9);
+  }
+
+  // Informational benchmark.
+  {
+    double sum = 0;
+    double std_rate = benchmarkSin(stdSin, sum);
+    double apx_rate = benchmarkSin(TrigApprox::sin, sum);
+    std::printf("%-16s %12s %12s %8s\n", "Benchmark", "libm", "approx", "ratio");
+    std::printf("%-16s %10.1f/us %10.1f/us %7.2fx (checksum %g)\n", "sin",
+                std_rate / 1e6, apx_rate / 1e6, apx_rate / std_rate, sum);
+  }
+
+  return test.getReturnValue();
+}
@@ -0,0 +1,76 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Eduardo Marques                                                  *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <string>
+
+// DUNE headers.
+#include <DUNE/Utils/TupleList.hpp>
+
+// Local headers.
+#include "Test.hpp"
+
+using namespace DUNE::Utils;
+
+int
+main(int argc, char** argv)
+{
+  Test test("Utils::TupleList");
+
+  {
+    TupleList tl("zulu=1; alpha = two ;mike=3.5;junk;");
+    test.boolean("get string", tl.get("alpha") == "two");
+    test.boolean("get int", tl.get("zulu", 0) == 1);
+    test.boolean("get double", tl.get("mike", 0.0) == 3.5);
+    test.boolean("missing uses default", tl.get("oscar", 7) == 7);
+    test.boolean("missing is empty", tl.get("oscar") == "");
+
+    // Looking up a missing label must not create an entry.
+    std::string out;
+    out << tl;
+    test.boolean("insertion order kept", out == "zulu=1;alpha=two;mike=3.5;");
+  }
+
+  {
+    TupleList tl("Speed=10", "=", ";", true);
+    test.boolean("ignore case", tl.get("speed", 0) == 10);
+  }
+
+  {
+    TupleList tl("a=1;b=2");
+    tl << "b=3;c=4";
+    test.boolean("update keeps position", tl.get("b", 0) == 3);
+
+    std::string out;
+    out << tl;
+    test.boolean("append order", out == "a=1;b=3;c=4;");
+  }
+
+  return test.getReturnValue();
+}
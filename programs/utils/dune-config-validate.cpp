@@ -0,0 +1,291 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+// Utility program to validate configuration files by instantiating the     *
+// parameter table of every enabled task, without starting threads or       *
+// touching devices.                                                        *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+using DUNE_NAMESPACES;
+
+void
+registerStaticTasks(void);
+
+//! Default number of worker threads.
+static const char* c_default_workers = "4";
+
+//! Recorded validation failure.
+struct Failure
+{
+  //! Configuration section.
+  std::string section;
+  //! Error description.
+  std::string message;
+};
+
+//! Worker validating task sections taken from a shared list. Each
+//! section is checked exactly the way the daemon does at boot:
+//! Tasks::Factory::produce() builds the task and its parameter table
+//! and Task::loadConfig() parses, validates and commits every option
+//! of the section. The task is destroyed without ever being started.
+class Worker: public Concurrency::Thread
+{
+public:
+  Worker(Tasks::Context& ctx, const std::vector<std::string>& sections,
+         size_t& next, Concurrency::Mutex& lock, std::vector<Failure>& failures):
+    m_ctx(ctx),
+    m_sections(sections),
+    m_next(next),
+    m_lock(lock),
+    m_failures(failures)
+  { }
+
+protected:
+  void
+  run(void)
+  {
+    while (true)
+    {
+      std::string section;
+
+      {
+        Concurrency::ScopedMutex l(m_lock);
+        if (m_next == m_sections.size())
+          return;
+
+        section = m_sections[m_next++];
+      }
+
+      validate(section);
+    }
+  }
+
+private:
+  //! Task context.
+  Tasks::Context& m_ctx;
+  //! Sections under validation.
+  const std::vector<std::string>& m_sections;
+  //! Index of the next section to validate.
+  size_t& m_next;
+  //! Lock protecting the section index and the failure list.
+  Concurrency::Mutex& m_lock;
+  //! Recorded failures.
+  std::vector<Failure>& m_failures;
+
+  void
+  validate(const std::string& section)
+  {
+    Tasks::Task* task = NULL;
+
+    try
+    {
+      task = Tasks::Factory::produce(Tasks::Manager::getTaskName(section), section, m_ctx);
+      task->loadConfig();
+    }
+    catch (std::exception& e)
+    {
+      Concurrency::ScopedMutex l(m_lock);
+      Failure failure;
+      failure.section = section;
+      failure.message = e.what();
+      m_failures.push_back(failure);
+    }
+
+    delete task;
+  }
+};
+
+int
+main(int argc, char** argv)
+{
+  Tasks::Context context;
+  I18N::setLanguage(context.dir_i18n);
+
+  OptionParser options;
+  options.executable("dune-config-validate")
+  .program(DUNE_SHORT_NAME)
+  .copyright(DUNE_COPYRIGHT)
+  .email(DUNE_CONTACT)
+  .version(getFullVersion())
+  .date(getCompileDate())
+  .arch(DUNE_SYSTEM_NAME)
+  .add("-d", "--config-dir",
+       "Configuration directory", "DIR")
+  .add("-c", "--config-file",
+       "Load configuration file CONFIG", "CONFIG")
+  .add("-p", "--profiles",
+       "Execution Profiles", "PROFILES")
+  .add("-t", "--threads",
+       "Number of worker threads", "COUNT");
+
+  // Parse command line arguments.
+  if (!options.parse(argc, argv))
+  {
+    if (options.bad())
+      std::cerr << "ERROR: " << options.error() << std::endl;
+    options.usage();
+    return 1;
+  }
+
+  // If requested, set alternate configuration directory.
+  if (options.value("--config-dir") != "")
+    context.dir_cfg = options.value("--config-dir");
+
+  unsigned workers = 0;
+  if (!castLexical(options.value("--threads").empty() ? c_default_workers : options.value("--threads"), workers) || workers == 0)
+  {
+    std::cerr << "ERROR: invalid thread count" << std::endl;
+    return 1;
+  }
+
+  DUNE::Tasks::Factory::registerDynamicTasks(context.dir_lib.c_str());
+  registerStaticTasks();
+
+  // Retrieve configuration file and try parsing it.
+  if (options.value("--config-file") == "")
+  {
+    std::cerr << "ERROR: no configuration file was given, see option --config-file"
+              << std::endl;
+    return 1;
+  }
+
+  Path cfg_file = context.dir_cfg / options.value("--config-file") + ".ini";
+  try
+  {
+    context.config.parseFile(cfg_file.c_str());
+  }
+  catch (std::runtime_error& e)
+  {
+    try
+    {
+      cfg_file = context.dir_usr_cfg / options.value("--config-file") + ".ini";
+      context.config.parseFile(cfg_file.c_str());
+      context.dir_cfg = context.dir_usr_cfg;
+    }
+    catch (std::runtime_error& e2)
+    {
+      std::cerr << String::str("ERROR: %s\n", e.what())
+                << String::str("ERROR: %s\n", e2.what()) << std::endl;
+      return 1;
+    }
+  }
+
+  // Add commonly used profiles.
+  context.profiles.add("Hardware", "Pure Hardware");
+  context.profiles.add("Simulation", "Pure Simulation");
+  context.profiles.add("Hardware/Simulation", "Simulation with Hardware-in-the-loop");
+
+  // Add user defined profiles.
+  std::vector<std::string> pros = context.config.options("Profiles");
+  for (unsigned i = 0; i < pros.size(); ++i)
+  {
+    std::string desc;
+    context.config.get("Profiles", pros[i], "No description given", desc);
+    context.profiles.add(pros[i], desc);
+  }
+
+  if (options.value("--profiles") != "")
+    context.profiles.select(options.value("--profiles"));
+
+  // Tasks are never started, so messages dispatched while loading
+  // configurations must not pile up.
+  context.mbus.pause();
+
+  double start_time = Clock::get();
+
+  // Collect the sections the daemon would turn into tasks, recording
+  // task-like sections whose task does not exist in this build.
+  std::vector<Failure> failures;
+  std::vector<std::string> sections;
+  std::vector<std::string> all = context.config.sections();
+  for (unsigned i = 0; i < all.size(); ++i)
+  {
+    std::string name = Tasks::Manager::getTaskName(all[i]);
+
+    // Decide whether the section is task-like before reading
+    // "Enabled": Config::get writes the default back into the
+    // section, and data-only sections consumed verbatim by tasks
+    // must not be polluted.
+    if (name.find_first_of(".") == std::string::npos)
+      continue;
+
+    std::string profiles;
+    context.config.get(all[i], "Enabled", "Never", profiles);
+    if (!context.profiles.isSelected(profiles))
+      continue;
+
+    if (!Tasks::Factory::exists(name))
+    {
+      Failure failure;
+      failure.section = all[i];
+      failure.message = "task does not exist in this build";
+      failures.push_back(failure);
+      continue;
+    }
+
+    sections.push_back(all[i]);
+  }
+
+  // Validate in parallel: sections are independent and the factory
+  // table and message bus are safe for concurrent use.
+  size_t next = 0;
+  Concurrency::Mutex lock;
+  std::vector<Worker*> pool;
+
+  for (unsigned i = 0; i < workers; ++i)
+    pool.push_back(new Worker(context, sections, next, lock, failures));
+
+  for (unsigned i = 0; i < pool.size(); ++i)
+    pool[i]->start();
+
+  for (unsigned i = 0; i < pool.size(); ++i)
+  {
+    pool[i]->join();
+    delete pool[i];
+  }
+
+  for (unsigned i = 0; i < failures.size(); ++i)
+    std::cerr << "ERROR: " << failures[i].section << ": "
+              << failures[i].message << std::endl;
+
+  std::cerr << String::str("checked %u tasks in %0.2f s, %u errors",
+                           (unsigned)sections.size(),
+                           Clock::get() - start_time,
+                           (unsigned)failures.size())
+            << std::endl;
+
+  return failures.empty() ? 0 : 1;
+}
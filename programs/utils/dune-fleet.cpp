@@ -0,0 +1,359 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+// Fleet scenario driver: launches one DUNE daemon per vehicle and
+// replays a timed event script against the running fleet.
+//
+// The scenario is a standard INI file:
+//
+//   [Fleet]
+//   Executable = dune          # daemon binary
+//   Profiles = Simulation      # profiles passed to every daemon
+//   Address = 127.0.0.1        # address of the control links
+//   Duration = 0               # seconds to run after the last event,
+//                              # 0 runs until interrupted
+//
+//   [Vehicle lauv-simulator-1]
+//   Configuration = lauv-simulator-1
+//   Control Port = 6002        # Transports.UDP port of this vehicle
+//
+//   [Event 1]
+//   Time = 5.0                 # seconds from fleet start
+//   Vehicle = lauv-simulator-1
+//   Action = Start Plan        # Start Plan, Stop Plan, Abort, Kill
+//   Plan = survey              # plan id, Start/Stop Plan only
+//
+// Vehicles discover each other through the normal announce layer, so
+// inter-vehicle traffic needs no support from this driver. The Kill
+// action terminates a daemon without warning, simulating the loss of
+// a vehicle mid-operation.
+
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <csignal>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+#if defined(DUNE_SYS_HAS_UNISTD_H)
+#  include <unistd.h>
+#endif
+
+#if defined(DUNE_SYS_HAS_SYS_WAIT_H)
+#  include <sys/wait.h>
+#endif
+
+using DUNE_NAMESPACES;
+
+#if defined(DUNE_SYS_HAS_FORK)
+
+//! One vehicle of the fleet.
+struct Vehicle
+{
+  //! Vehicle name.
+  std::string name;
+  //! Configuration passed to the daemon.
+  std::string config;
+  //! Port of the vehicle's UDP transport.
+  unsigned port;
+  //! Daemon process.
+  pid_t pid;
+  //! False after a Kill event or daemon exit.
+  bool alive;
+};
+
+//! One timed action of the scenario.
+struct ScenarioEvent
+{
+  //! Seconds from fleet start.
+  double time;
+  //! Target vehicle name.
+  std::string vehicle;
+  //! Action name.
+  std::string action;
+  //! Plan identifier, for plan actions.
+  std::string plan;
+
+  bool
+  operator<(const ScenarioEvent& other) const
+  {
+    return time < other.time;
+  }
+};
+
+//! Set by the termination signal handlers.
+static volatile sig_atomic_t s_stop = 0;
+
+static void
+handleTerminate(int signo)
+{
+  (void)signo;
+  s_stop = 1;
+}
+
+static void
+usage(const char* name)
+{
+  std::fprintf(stderr, "DUNE fleet scenario driver\n\n");
+  std::fprintf(stderr, "Usage: %s <scenario.ini>\n", name);
+}
+
+//! Launch the daemon of one vehicle.
+static bool
+launch(Vehicle& vehicle, const std::string& executable, const std::string& profiles)
+{
+  pid_t pid = fork();
+  if (pid < 0)
+    return false;
+
+  if (pid == 0)
+  {
+    execlp(executable.c_str(), executable.c_str(),
+           "-c", vehicle.config.c_str(),
+           "-p", profiles.c_str(),
+           (char*)NULL);
+    std::fprintf(stderr, "ERROR: failed to execute '%s'\n", executable.c_str());
+    _exit(1);
+  }
+
+  vehicle.pid = pid;
+  vehicle.alive = true;
+  return true;
+}
+
+//! Send one message to the control port of a vehicle.
+static void
+send(UDPSocket& sock, const Address& addr, const Vehicle& vehicle, IMC::Message& msg)
+{
+  uint8_t bfr[1024] = {0};
+  msg.setTimeStamp();
+  uint16_t rv = IMC::Packet::serialize(&msg, bfr, sizeof(bfr));
+
+  try
+  {
+    sock.write(bfr, rv, addr, vehicle.port);
+  }
+  catch (std::runtime_error& e)
+  {
+    std::fprintf(stderr, "ERROR: %s: %s\n", vehicle.name.c_str(), e.what());
+  }
+}
+
+static void
+perform(const ScenarioEvent& event, Vehicle& vehicle, UDPSocket& sock, const Address& addr)
+{
+  std::fprintf(stderr, "[%0.1f] %s: %s\n", event.time, vehicle.name.c_str(),
+               event.action.c_str());
+
+  if (event.action == "Start Plan" || event.action == "Stop Plan")
+  {
+    IMC::PlanControl pc;
+    pc.type = IMC::PlanControl::PC_REQUEST;
+    pc.op = (event.action == "Start Plan") ? IMC::PlanControl::PC_START : IMC::PlanControl::PC_STOP;
+    pc.plan_id = event.plan;
+    send(sock, addr, vehicle, pc);
+    return;
+  }
+
+  if (event.action == "Abort")
+  {
+    IMC::Abort abort_msg;
+    send(sock, addr, vehicle, abort_msg);
+    return;
+  }
+
+  if (event.action == "Kill")
+  {
+    if (vehicle.alive)
+    {
+      kill(vehicle.pid, SIGKILL);
+      waitpid(vehicle.pid, 0, 0);
+      vehicle.alive = false;
+    }
+    return;
+  }
+
+  std::fprintf(stderr, "ERROR: unknown action '%s'\n", event.action.c_str());
+}
+
+int
+main(int argc, char** argv)
+{
+  if (argc != 2)
+  {
+    usage(argv[0]);
+    return 1;
+  }
+
+  Config cfg;
+  try
+  {
+    cfg.parseFile(argv[1]);
+  }
+  catch (std::runtime_error& e)
+  {
+    std::fprintf(stderr, "ERROR: %s\n", e.what());
+    return 1;
+  }
+
+  std::string executable;
+  std::string profiles;
+  std::string address;
+  double duration = 0;
+  cfg.get("Fleet", "Executable", "dune", executable);
+  cfg.get("Fleet", "Profiles", "Simulation", profiles);
+  cfg.get("Fleet", "Address", "127.0.0.1", address);
+  cfg.get("Fleet", "Duration", "0", duration);
+
+  // Collect vehicles and events.
+  std::map<std::string, Vehicle> fleet;
+  std::vector<ScenarioEvent> events;
+  std::vector<std::string> sections = cfg.sections();
+
+  for (unsigned i = 0; i < sections.size(); ++i)
+  {
+    if (String::startsWith(sections[i], "Vehicle "))
+    {
+      Vehicle vehicle;
+      vehicle.name = sections[i].substr(8);
+      vehicle.pid = -1;
+      vehicle.alive = false;
+      cfg.get(sections[i], "Configuration", vehicle.name, vehicle.config);
+      cfg.get(sections[i], "Control Port", "6002", vehicle.port);
+      fleet[vehicle.name] = vehicle;
+    }
+    else if (String::startsWith(sections[i], "Event "))
+    {
+      ScenarioEvent event;
+      cfg.get(sections[i], "Time", "0", event.time);
+      cfg.get(sections[i], "Vehicle", "", event.vehicle);
+      cfg.get(sections[i], "Action", "", event.action);
+      cfg.get(sections[i], "Plan", "", event.plan);
+      events.push_back(event);
+    }
+  }
+
+  if (fleet.empty())
+  {
+    std::fprintf(stderr, "ERROR: scenario defines no vehicles\n");
+    return 1;
+  }
+
+  for (unsigned i = 0; i < events.size(); ++i)
+  {
+    if (fleet.find(events[i].vehicle) == fleet.end())
+    {
+      std::fprintf(stderr, "ERROR: event targets unknown vehicle '%s'\n",
+                   events[i].vehicle.c_str());
+      return 1;
+    }
+  }
+
+  std::sort(events.begin(), events.end());
+
+  std::signal(SIGINT, handleTerminate);
+  std::signal(SIGTERM, handleTerminate);
+
+  // Launch the fleet.
+  std::map<std::string, Vehicle>::iterator itr = fleet.begin();
+  for (; itr != fleet.end(); ++itr)
+  {
+    if (!launch(itr->second, executable, profiles))
+    {
+      std::fprintf(stderr, "ERROR: failed to launch '%s'\n", itr->first.c_str());
+      s_stop = 1;
+      break;
+    }
+
+    std::fprintf(stderr, "launched '%s' (pid %d)\n", itr->first.c_str(),
+                 (int)itr->second.pid);
+  }
+
+  UDPSocket sock;
+  Address addr(address.c_str());
+  double start = Clock::get();
+
+  // Replay the event script.
+  for (unsigned i = 0; i < events.size() && !s_stop; ++i)
+  {
+    while (!s_stop && (Clock::get() - start) < events[i].time)
+      Delay::wait(0.1);
+
+    if (s_stop)
+      break;
+
+    perform(events[i], fleet[events[i].vehicle], sock, addr);
+  }
+
+  // Keep the fleet running for the requested duration.
+  double elapsed = Clock::get() - start;
+  while (!s_stop && (duration <= 0 || elapsed < duration))
+  {
+    Delay::wait(0.1);
+    elapsed = Clock::get() - start;
+  }
+
+  // Orderly shutdown.
+  for (itr = fleet.begin(); itr != fleet.end(); ++itr)
+  {
+    if (itr->second.alive)
+      kill(itr->second.pid, SIGTERM);
+  }
+
+  for (itr = fleet.begin(); itr != fleet.end(); ++itr)
+  {
+    if (itr->second.alive)
+    {
+      waitpid(itr->second.pid, 0, 0);
+      itr->second.alive = false;
+    }
+  }
+
+  return 0;
+}
+
+#else
+
+int
+main(int argc, char** argv)
+{
+  (void)argc;
+  (void)argv;
+
+  std::fprintf(stderr, "ERROR: this program requires fork support\n");
+  return 1;
+}
+
+#endif
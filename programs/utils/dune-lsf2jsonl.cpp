@@ -0,0 +1,252 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+// Export LSF logs to JSON Lines (one compact JSON object per message), *
+// the format ingested by shore-side data pipelines.                     *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Compression.hpp>
+#include <DUNE/IMC.hpp>
+#include <DUNE/Time/Clock.hpp>
+
+namespace IMC = DUNE::IMC;
+namespace Compression = DUNE::Compression;
+
+//! Flush threshold of the output accumulator.
+static const size_t c_flush_size = 1 << 20;
+
+//! Stream buffer over reusable growable storage: serializing each
+//! message into it avoids the allocation and copy of an
+//! ostringstream per message.
+class ScratchBuffer: public std::streambuf
+{
+public:
+  ScratchBuffer(void):
+    m_bfr(1 << 16)
+  {
+    reset();
+  }
+
+  void
+  reset(void)
+  {
+    setp(&m_bfr[0], &m_bfr[0] + m_bfr.size());
+  }
+
+  const char*
+  data(void) const
+  {
+    return pbase();
+  }
+
+  size_t
+  size(void) const
+  {
+    return pptr() - pbase();
+  }
+
+protected:
+  int_type
+  overflow(int_type c)
+  {
+    size_t used = size();
+    m_bfr.resize(m_bfr.size() * 2);
+    setp(&m_bfr[0], &m_bfr[0] + m_bfr.size());
+    pbump((int)used);
+
+    if (c != traits_type::eof())
+      sputc((char)c);
+
+    return c;
+  }
+
+private:
+  //! Storage.
+  std::vector<char> m_bfr;
+};
+
+//! Append the pretty JSON of one message as a single compact line:
+//! the multi-line layout produced by Message::toJSON only breaks
+//! lines at field boundaries (string values have control characters
+//! escaped), so stripping newlines and the indent that follows them
+//! yields the same object.
+static void
+compact(const char* pretty, size_t size, std::string& out)
+{
+  size_t i = 0;
+
+  while (i < size)
+  {
+    if (pretty[i] == '\n')
+    {
+      ++i;
+      while (i < size && pretty[i] == ' ')
+        ++i;
+      continue;
+    }
+
+    out.push_back(pretty[i]);
+    ++i;
+  }
+
+  out.push_back('\n');
+}
+
+static bool
+convert(const char* file, uint64_t& total_in, uint64_t& total_msg)
+{
+  std::string out_file(file);
+  size_t dot = out_file.find(".lsf");
+  if (dot == std::string::npos)
+  {
+    std::cerr << file << ": not an LSF file" << std::endl;
+    return false;
+  }
+  out_file = out_file.substr(0, dot) + ".jsonl";
+
+  std::ofstream ofs(out_file.c_str(), std::ios::binary);
+  if (!ofs.is_open())
+  {
+    std::cerr << out_file << ": unable to create" << std::endl;
+    return false;
+  }
+
+  std::string acc;
+  acc.reserve(c_flush_size + (1 << 16));
+  ScratchBuffer sbfr;
+  std::ostream ss(&sbfr);
+
+  bool ok = true;
+  try
+  {
+    Compression::Methods method = Compression::Factory::detect(file);
+    if (method == Compression::METHOD_UNKNOWN)
+    {
+      // Plain logs go through the memory-mapped reader.
+      IMC::LSFReader reader;
+      reader.open(file);
+
+      IMC::Message* msg = NULL;
+      while ((msg = reader.next()) != NULL)
+      {
+        sbfr.reset();
+        msg->toJSON(ss);
+        compact(sbfr.data(), sbfr.size(), acc);
+        delete msg;
+
+        ++total_msg;
+        if (acc.size() >= c_flush_size)
+        {
+          ofs.write(acc.data(), acc.size());
+          acc.clear();
+        }
+      }
+
+      total_in += reader.getSize();
+    }
+    else
+    {
+      // Compressed logs are parsed as a byte stream.
+      Compression::FileInput ifs(file, method);
+      IMC::Parser parser;
+      std::vector<char> bfr(1 << 16);
+
+      while (ifs.read(&bfr[0], bfr.size()) || ifs.gcount() > 0)
+      {
+        size_t len = ifs.gcount();
+        total_in += len;
+
+        for (size_t i = 0; i < len; ++i)
+        {
+          IMC::Message* msg = parser.parse((uint8_t)bfr[i]);
+          if (msg == NULL)
+            continue;
+
+          sbfr.reset();
+          msg->toJSON(ss);
+          compact(sbfr.data(), sbfr.size(), acc);
+          delete msg;
+
+          ++total_msg;
+          if (acc.size() >= c_flush_size)
+          {
+            ofs.write(acc.data(), acc.size());
+            acc.clear();
+          }
+        }
+      }
+    }
+  }
+  catch (std::exception& e)
+  {
+    std::cerr << file << ": " << e.what() << std::endl;
+    ok = false;
+  }
+
+  ofs.write(acc.data(), acc.size());
+  return ok;
+}
+
+int
+main(int argc, char** argv)
+{
+  if (argc < 2)
+  {
+    std::cerr << "Usage: " << argv[0] << " <log.lsf[.gz]> ..." << std::endl;
+    std::cerr << "Writes a '.jsonl' file next to each log." << std::endl;
+    return 1;
+  }
+
+  uint64_t total_in = 0;
+  uint64_t total_msg = 0;
+  double start = DUNE::Time::Clock::get();
+
+  int rv = 0;
+  for (int i = 1; i < argc; ++i)
+  {
+    if (!convert(argv[i], total_in, total_msg))
+      rv = 1;
+  }
+
+  double elapsed = DUNE::Time::Clock::get() - start;
+  std::fprintf(stderr, "%llu messages, %0.1f MB in %0.2f s (%0.1f MB/s)\n",
+               (unsigned long long)total_msg,
+               total_in / 1e6, elapsed,
+               (elapsed > 0) ? total_in / 1e6 / elapsed : 0.0);
+
+  return rv;
+}
@@ -0,0 +1,171 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+// Verify LSF files against the integrity sidecar ('.chk') written by     *
+// Transports/Logging: each record holds the offset, length and CRC-32 of *
+// one chunk of the uncompressed LSF stream.                               *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Algorithms/CRC32.hpp>
+#include <DUNE/Compression.hpp>
+
+using DUNE::Algorithms::CRC32;
+namespace Compression = DUNE::Compression;
+
+static bool
+verify(const char* file)
+{
+  std::string chk_file = std::string(file) + ".chk";
+  std::ifstream chk(chk_file.c_str());
+  if (!chk.is_open())
+  {
+    std::cerr << file << ": no sidecar '" << chk_file << "'" << std::endl;
+    return false;
+  }
+
+  std::string magic;
+  unsigned version = 0;
+  chk >> magic >> version;
+  if (magic != "LSFCHK" || version != 1)
+  {
+    std::cerr << file << ": unrecognized sidecar format" << std::endl;
+    return false;
+  }
+
+  std::istream* lsf = NULL;
+  std::ifstream ifs(file, std::ios::binary);
+  if (!ifs.is_open())
+  {
+    std::cerr << file << ": unable to open" << std::endl;
+    return false;
+  }
+
+  Compression::Methods method = Compression::Factory::detect(file);
+  if (method == Compression::METHOD_UNKNOWN)
+    lsf = &ifs;
+  else
+    lsf = new Compression::FileInput(file, method);
+
+  bool ok = true;
+  unsigned chunks = 0;
+  unsigned long long position = 0;
+  std::vector<char> bfr;
+
+  unsigned long long offset = 0;
+  unsigned long length = 0;
+  std::string crc_str;
+  while (chk >> offset >> length >> crc_str)
+  {
+    uint32_t crc = (uint32_t)std::strtoul(crc_str.c_str(), NULL, 16);
+
+    if (offset != position)
+    {
+      std::cerr << file << ": sidecar not sequential at offset "
+                << offset << std::endl;
+      ok = false;
+      break;
+    }
+
+    bfr.resize(length);
+    lsf->read(&bfr[0], length);
+    if ((unsigned long)lsf->gcount() != length)
+    {
+      std::cerr << file << ": truncated at offset " << position
+                << " (" << lsf->gcount() << " of " << length
+                << " bytes of chunk " << chunks << ")" << std::endl;
+      ok = false;
+      break;
+    }
+
+    if (CRC32::compute((const uint8_t*)&bfr[0], length) != crc)
+    {
+      std::cerr << file << ": checksum mismatch in chunk " << chunks
+                << " at offset " << position << std::endl;
+      ok = false;
+      break;
+    }
+
+    position += length;
+    ++chunks;
+  }
+
+  if (ok)
+  {
+    // Bytes written after the last sidecar flush are unverifiable
+    // but expected when a log ends abruptly.
+    char c = 0;
+    unsigned long long trailing = 0;
+    while (lsf->read(&c, 1))
+      ++trailing;
+
+    std::cout << file << ": ok (" << chunks << " chunks, " << position
+              << " bytes";
+    if (trailing > 0)
+      std::cout << ", " << trailing << " unverified trailing bytes";
+    std::cout << ")" << std::endl;
+  }
+
+  if (lsf != &ifs)
+    delete lsf;
+
+  return ok;
+}
+
+int
+main(int argc, char** argv)
+{
+  --argc;
+  ++argv;
+
+  if (!argc)
+  {
+    std::cerr << "Usage: dune-lsfcheck file1.lsf[.gz] ... filen.lsf[.gz]" << std::endl;
+    return 1;
+  }
+
+  int failed = 0;
+  do
+  {
+    if (!verify(*argv))
+      ++failed;
+    ++argv;
+  }
+  while (--argc);
+
+  return (failed == 0) ? 0 : 1;
+}
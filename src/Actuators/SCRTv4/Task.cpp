@@ -86,6 +86,21 @@ namespace Actuators
       std::vector<double> servo_dirs;
     };
 
+    //! Protocol frame accumulator: stands in for the port in
+    //! LUCL::ProtocolParser::sendCommand() so several commands can be
+    //! sent to the board in a single port write.
+    struct FrameBatch
+    {
+      //! Accumulated frames.
+      ByteBuffer bfr;
+
+      void
+      write(const uint8_t* data, int size)
+      {
+        bfr.append(data, size);
+      }
+    };
+
     struct Task: public Tasks::Task
     {
       //! Task arguments.
@@ -112,6 +127,12 @@ namespace Actuators
       unsigned m_stat_timeout;
       //! Watchdog.
       Counter<double> m_wdog;
+      //! Pending servo demands (rad).
+      double m_servo_cmd[c_servo_count];
+      //! Servos with a demand not yet written to the board.
+      bool m_servo_dirty[c_servo_count];
+      //! Accumulator of protocol frames, flushed in one port write.
+      FrameBatch m_batch;
 
       Task(const std::string& name, Tasks::Context& ctx):
         Tasks::Task(name, ctx),
@@ -119,6 +140,12 @@ namespace Actuators
         m_listener(NULL),
         m_demand_res(0)
       {
+        for (unsigned i = 0; i < c_servo_count; ++i)
+        {
+          m_servo_cmd[i] = 0.0;
+          m_servo_dirty[i] = false;
+        }
+
         // Define configuration parameters.
         param("Serial Port - Device", m_args.uart_dev)
         .defaultValue("")
@@ -210,7 +237,36 @@ namespace Actuators
         if (msg->id >= c_servo_count)
           return;
 
-        setServoPosition(msg->id, msg->value);
+        // Per-channel commands of one control cycle are coalesced
+        // and written to the board in a single port transaction.
+        m_servo_cmd[msg->id] = msg->value;
+        m_servo_dirty[msg->id] = true;
+      }
+
+      //! Write every pending servo demand in one port write.
+      void
+      flushServoCommands(void)
+      {
+        m_batch.bfr.setSize(0);
+
+        for (unsigned i = 0; i < c_servo_count; ++i)
+        {
+          if (!m_servo_dirty[i])
+            continue;
+
+          m_servo_dirty[i] = false;
+
+          uint8_t data[] =
+          {
+            (uint8_t)i,
+            convertAngleToDemand(i, m_servo_cmd[i])
+          };
+
+          LUCL::ProtocolParser::sendCommand(CMD_SERVO_SET, data, sizeof(data), &m_batch);
+        }
+
+        if (m_batch.bfr.getSize() > 0)
+          m_uart->write(m_batch.bfr.getBuffer(), m_batch.bfr.getSize());
       }
 
       bool
@@ -409,6 +465,8 @@ namespace Actuators
         while (!stopping())
         {
           consumeMessages();
+          flushServoCommands();
+
           if (m_listener->waitForCommand(1.0))
           {
             while ((cmd = m_listener->pop()) != NULL)
@@ -232,6 +232,8 @@ namespace Control
         std::queue<mavlink_message_t> m_mission_items;
         //! Desired gimbal angles
         float m_gb_pan, m_gb_tilt, m_gb_retract;
+        //! Compiled mask of the HITL execution profile.
+        uint32_t m_hitl_mask;
 
         Task(const std::string& name, Tasks::Context& ctx):
           Tasks::Task(name, ctx),
@@ -260,7 +262,8 @@ namespace Control
           m_dspeed(20),
           m_vehicle_type(VEHICLE_UNKNOWN),
           m_service(false),
-          m_last_wp(0)
+          m_last_wp(0),
+          m_hitl_mask(ctx.profiles.compile("HITL"))
         {
           param("Communications Timeout", m_args.comm_timeout)
           .minimumValue("1")
@@ -284,7 +287,7 @@ namespace Control
           .description("Address for connection to Ardupilot");
 
           param("IPv4 - Address", m_args.ip)
-          .defaultValue("")
+          .defaultValue("0.0.0.0")
           .description("Address for neptus connection to Ardupilot");
 
           param("Telemetry Rate", m_args.trate)
@@ -1294,7 +1297,7 @@ namespace Control
         void
         consume(const IMC::SimulatedState* sim_state)
         {
-          if (!m_ctx.profiles.isSelected("HITL"))
+          if (!m_ctx.profiles.isSelected(m_hitl_mask))
             return;
 
           mavlink_message_t msg;
@@ -40,7 +40,7 @@ namespace DUNE
     // Export DLL Symbol.
     class DUNE_DLL_SYM CRC16;
 
-    extern const uint16_t c_crc16_ibm_table[256];
+    extern const uint16_t c_crc16_ibm_tables[8][256];
 
     //! CRC-16-IBM Algorithm.
     //! The polynomial used is x^16 + x^15 + x^2 + 1 (0x8005)
@@ -55,8 +55,25 @@ namespace DUNE
       static inline uint16_t
       compute(const uint8_t* buffer, uint16_t len, uint16_t crc = 0)
       {
+        // Fold eight bytes per iteration (slice-by-8): the CRC only
+        // spans the first two bytes, the remaining six depend on the
+        // input alone, so all eight table lookups are independent.
+        while (len >= 8)
+        {
+          crc = c_crc16_ibm_tables[7][(crc ^ buffer[0]) & 0xff]
+                ^ c_crc16_ibm_tables[6][((crc >> 8) ^ buffer[1]) & 0xff]
+                ^ c_crc16_ibm_tables[5][buffer[2]]
+                ^ c_crc16_ibm_tables[4][buffer[3]]
+                ^ c_crc16_ibm_tables[3][buffer[4]]
+                ^ c_crc16_ibm_tables[2][buffer[5]]
+                ^ c_crc16_ibm_tables[1][buffer[6]]
+                ^ c_crc16_ibm_tables[0][buffer[7]];
+          buffer += 8;
+          len -= 8;
+        }
+
         while (len--)
-          crc = (crc >> 8) ^ c_crc16_ibm_table[(crc ^ *buffer++) & 0xff];
+          crc = (crc >> 8) ^ c_crc16_ibm_tables[0][(crc ^ *buffer++) & 0xff];
 
         return crc;
       }
@@ -68,7 +85,7 @@ namespace DUNE
       static inline uint16_t
       compute(uint8_t byte, uint16_t crc = 0)
       {
-        return (crc >> 8) ^ c_crc16_ibm_table[(crc ^ byte) & 0xff];
+        return (crc >> 8) ^ c_crc16_ibm_tables[0][(crc ^ byte) & 0xff];
       }
     };
   }
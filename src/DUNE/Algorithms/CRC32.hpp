@@ -0,0 +1,77 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+#ifndef DUNE_ALGORITHMS_CRC32_HPP_INCLUDED_
+#define DUNE_ALGORITHMS_CRC32_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <cstddef>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+
+namespace DUNE
+{
+  namespace Algorithms
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM CRC32;
+
+    extern const uint32_t c_crc32_table[256];
+
+    //! CRC-32 (IEEE 802.3) Algorithm.
+    //! The polynomial used is the reflected form of
+    //! x^32 + x^26 + x^23 + x^22 + x^16 + x^12 + x^11 + x^10 + x^8 +
+    //! x^7 + x^5 + x^4 + x^2 + x + 1 (0xEDB88320).
+    class CRC32
+    {
+    public:
+      //! Compute the CRC-32 of a given data buffer. The CRC of a
+      //! concatenation of buffers can be computed by feeding the
+      //! value returned for one buffer as the initial value for the
+      //! next.
+      //! @param buffer data buffer.
+      //! @param len data buffer length.
+      //! @param crc CRC-32 value to update.
+      //! @return computed CRC-32.
+      static inline uint32_t
+      compute(const uint8_t* buffer, size_t len, uint32_t crc = 0)
+      {
+        crc = ~crc;
+
+        while (len--)
+          crc = (crc >> 8) ^ c_crc32_table[(crc ^ *buffer++) & 0xff];
+
+        return ~crc;
+      }
+    };
+  }
+}
+
+#endif
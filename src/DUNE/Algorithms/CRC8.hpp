@@ -40,10 +40,16 @@ namespace DUNE
     // Export DLL Symbol.
     class DUNE_DLL_SYM CRC8;
 
+    extern const uint8_t c_crc8_ccitt_tables[8][256];
+
     //! Generic computation of 8-bit CRCs.
     class CRC8
     {
     public:
+      //! Polynomial covered by the precomputed lookup tables
+      //! (CRC-8-CCITT, x^8 + x^2 + x + 1).
+      static const uint8_t c_ccitt_polynomial = 0x07;
+
       //! Constructor.
       //! @param[in] polynomial polynomial.
       //! @param[in] value initial CRC8 value.
@@ -74,6 +80,12 @@ namespace DUNE
       uint8_t
       putByte(uint8_t byte)
       {
+        if (m_polynomial == c_ccitt_polynomial)
+        {
+          m_value = c_crc8_ccitt_tables[0][m_value ^ byte];
+          return m_value;
+        }
+
         m_value ^= byte;
 
         for (uint8_t i = 0; i < 8; ++i)
@@ -99,6 +111,26 @@ namespace DUNE
       uint8_t
       putArray(const uint8_t* data, unsigned int data_size)
       {
+        if (m_polynomial == c_ccitt_polynomial)
+        {
+          // Fold eight bytes per iteration (slice-by-8): the CRC state
+          // only spans the first byte, the remaining seven depend on
+          // the input alone, so all eight lookups are independent.
+          while (data_size >= 8)
+          {
+            m_value = c_crc8_ccitt_tables[7][m_value ^ data[0]]
+                      ^ c_crc8_ccitt_tables[6][data[1]]
+                      ^ c_crc8_ccitt_tables[5][data[2]]
+                      ^ c_crc8_ccitt_tables[4][data[3]]
+                      ^ c_crc8_ccitt_tables[3][data[4]]
+                      ^ c_crc8_ccitt_tables[2][data[5]]
+                      ^ c_crc8_ccitt_tables[1][data[6]]
+                      ^ c_crc8_ccitt_tables[0][data[7]];
+            data += 8;
+            data_size -= 8;
+          }
+        }
+
         while (data_size > 0)
         {
           putByte(*data++);
@@ -43,14 +43,19 @@ namespace DUNE
 #include <DUNE/Compression/Exceptions.hpp>
 #include <DUNE/Compression/Factory.hpp>
 #include <DUNE/Compression/GzipCompressor.hpp>
+#include <DUNE/Compression/ParallelGzipCompressor.hpp>
 #include <DUNE/Compression/Bzip2Compressor.hpp>
 #include <DUNE/Compression/ZlibCompressor.hpp>
+#include <DUNE/Compression/Lz4Compressor.hpp>
 #include <DUNE/Compression/Bzip2Decompressor.hpp>
 #include <DUNE/Compression/ZlibDecompressor.hpp>
+#include <DUNE/Compression/Lz4Decompressor.hpp>
 #include <DUNE/Compression/StreamBuffer.hpp>
+#include <DUNE/Compression/ReadaheadBuffer.hpp>
 #include <DUNE/Compression/FilterInput.hpp>
 #include <DUNE/Compression/FilterOutput.hpp>
 #include <DUNE/Compression/FileInput.hpp>
+#include <DUNE/Compression/ReadaheadInput.hpp>
 #include <DUNE/Compression/FileOutput.hpp>
 
 #endif
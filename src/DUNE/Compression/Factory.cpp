@@ -38,6 +38,8 @@
 #include <DUNE/Compression/Bzip2Compressor.hpp>
 #include <DUNE/Compression/ZlibDecompressor.hpp>
 #include <DUNE/Compression/Bzip2Decompressor.hpp>
+#include <DUNE/Compression/Lz4Compressor.hpp>
+#include <DUNE/Compression/Lz4Decompressor.hpp>
 #include <DUNE/Compression/Factory.hpp>
 
 namespace DUNE
@@ -56,6 +58,9 @@ namespace DUNE
       if (name == "bzip2")
         return METHOD_BZIP2;
 
+      if (name == "lz4")
+        return METHOD_LZ4;
+
       return METHOD_UNKNOWN;
     }
 
@@ -70,6 +75,8 @@ namespace DUNE
           return "gzip";
         case METHOD_BZIP2:
           return "bzip2";
+        case METHOD_LZ4:
+          return "lz4";
         case METHOD_UNKNOWN:
           break;
       }
@@ -88,6 +95,8 @@ namespace DUNE
           return ".gz";
         case METHOD_BZIP2:
           return ".bz2";
+        case METHOD_LZ4:
+          return ".lz4";
         case METHOD_UNKNOWN:
           break;
       }
@@ -118,6 +127,10 @@ namespace DUNE
       if (std::memcmp("BZ", bfr, 2) == 0)
         return METHOD_BZIP2;
 
+      // LZ4 frame format magic number (little endian).
+      if (std::memcmp("\x04\x22", bfr, 2) == 0)
+        return METHOD_LZ4;
+
       return METHOD_UNKNOWN;
     }
 
@@ -132,6 +145,8 @@ namespace DUNE
           return new GzipCompressor;
         case METHOD_BZIP2:
           return new Bzip2Compressor;
+        case METHOD_LZ4:
+          return new Lz4Compressor;
         default:
           break;
       }
@@ -156,6 +171,8 @@ namespace DUNE
           return new ZlibDecompressor(true);
         case METHOD_BZIP2:
           return new Bzip2Decompressor;
+        case METHOD_LZ4:
+          return new Lz4Decompressor;
         default:
           break;
       }
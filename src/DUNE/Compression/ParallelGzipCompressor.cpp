@@ -0,0 +1,213 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <fstream>
+#include <map>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Concurrency/Thread.hpp>
+#include <DUNE/Concurrency/TSQueue.hpp>
+#include <DUNE/Compression/Exceptions.hpp>
+#include <DUNE/Compression/GzipCompressor.hpp>
+#include <DUNE/Compression/ParallelGzipCompressor.hpp>
+#include <DUNE/Utils/ByteBuffer.hpp>
+
+namespace DUNE
+{
+  namespace Compression
+  {
+    //! One unit of work: an uncompressed chunk and its compressed
+    //! gzip member.
+    struct Chunk
+    {
+      //! Position of the chunk in the input file.
+      unsigned seq;
+      //! Uncompressed data.
+      Utils::ByteBuffer in;
+      //! Number of valid bytes in 'in'.
+      unsigned long in_len;
+      //! Compressed gzip member.
+      Utils::ByteBuffer out;
+      //! Number of valid bytes in 'out'.
+      unsigned long out_len;
+    };
+
+    //! Worker thread: pops chunks, compresses each one into a
+    //! complete gzip member and pushes it to the done queue.
+    class GzipWorker: public Concurrency::Thread
+    {
+    public:
+      GzipWorker(Concurrency::TSQueue<Chunk*>& jobs, Concurrency::TSQueue<Chunk*>& done, int level):
+        m_jobs(jobs),
+        m_done(done),
+        m_gzip(level)
+      { }
+
+    private:
+      Concurrency::TSQueue<Chunk*>& m_jobs;
+      Concurrency::TSQueue<Chunk*>& m_done;
+      GzipCompressor m_gzip;
+
+      void
+      run(void)
+      {
+        while (isRunning())
+        {
+          if (!m_jobs.waitForItems(0.5))
+            continue;
+
+          Chunk* chunk = m_jobs.pop();
+          if (chunk == NULL)
+            continue;
+
+          m_gzip.compress(chunk->out, chunk->in.getBufferSigned(), chunk->in_len);
+          chunk->out_len = m_gzip.compressed();
+          m_done.push(chunk);
+        }
+      }
+    };
+
+    ParallelGzipCompressor::ParallelGzipCompressor(unsigned worker_count, int a_level):
+      m_worker_count(worker_count),
+      m_level(a_level)
+    {
+      if (m_worker_count == 0)
+        m_worker_count = 1;
+    }
+
+    void
+    ParallelGzipCompressor::compress(const char* src_file, const char* dst_file)
+    {
+      std::ifstream ifs(src_file, std::ios::binary);
+      if (!ifs.is_open())
+        throw Error("failed to open input file");
+
+      std::ofstream ofs(dst_file, std::ios::binary);
+      if (!ofs.is_open())
+        throw Error("failed to open output file");
+
+      Concurrency::TSQueue<Chunk*> jobs;
+      Concurrency::TSQueue<Chunk*> done;
+      Concurrency::TSQueue<Chunk*> clean;
+
+      // Bound the amount of in-flight data to two chunks per worker.
+      std::vector<Chunk*> pool;
+      for (unsigned i = 0; i < m_worker_count * 2; ++i)
+      {
+        Chunk* chunk = new Chunk;
+        chunk->in.setSize(c_chunk_size);
+        pool.push_back(chunk);
+        clean.push(chunk);
+      }
+
+      std::vector<GzipWorker*> workers;
+      for (unsigned i = 0; i < m_worker_count; ++i)
+      {
+        GzipWorker* worker = new GzipWorker(jobs, done, m_level);
+        workers.push_back(worker);
+        worker->start();
+      }
+
+      unsigned read_count = 0;
+      unsigned write_count = 0;
+      bool eof = false;
+      std::map<unsigned, Chunk*> ready;
+
+      try
+      {
+        while (!eof || write_count < read_count)
+        {
+          // Feed available chunks to the workers.
+          while (!eof && !clean.empty())
+          {
+            Chunk* chunk = clean.pop();
+            if (chunk == NULL)
+              break;
+
+            ifs.read(chunk->in.getBufferSigned(), c_chunk_size);
+            chunk->in_len = ifs.gcount();
+            eof = ifs.eof();
+
+            // Produce at least one member so that empty files still
+            // yield a valid gzip stream.
+            if (chunk->in_len == 0 && read_count > 0)
+            {
+              clean.push(chunk);
+              break;
+            }
+
+            chunk->seq = read_count++;
+            jobs.push(chunk);
+          }
+
+          // Collect finished members and write them in order.
+          if (done.waitForItems(0.5))
+          {
+            Chunk* chunk = done.pop();
+            if (chunk != NULL)
+              ready[chunk->seq] = chunk;
+          }
+
+          std::map<unsigned, Chunk*>::iterator itr;
+          while ((itr = ready.find(write_count)) != ready.end())
+          {
+            ofs.write(itr->second->out.getBufferSigned(), itr->second->out_len);
+            clean.push(itr->second);
+            ready.erase(itr);
+            ++write_count;
+          }
+        }
+      }
+      catch (...)
+      {
+        for (unsigned i = 0; i < workers.size(); ++i)
+        {
+          workers[i]->stopAndJoin();
+          delete workers[i];
+        }
+
+        for (unsigned i = 0; i < pool.size(); ++i)
+          delete pool[i];
+
+        throw;
+      }
+
+      for (unsigned i = 0; i < workers.size(); ++i)
+      {
+        workers[i]->stopAndJoin();
+        delete workers[i];
+      }
+
+      for (unsigned i = 0; i < pool.size(); ++i)
+        delete pool[i];
+    }
+  }
+}
@@ -0,0 +1,85 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+#ifndef DUNE_COMPRESSION_PARALLEL_GZIP_COMPRESSOR_HPP_INCLUDED_
+#define DUNE_COMPRESSION_PARALLEL_GZIP_COMPRESSOR_HPP_INCLUDED_
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+
+namespace DUNE
+{
+  namespace Compression
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM ParallelGzipCompressor;
+
+    //! Whole-file gzip compressor that spreads the deflate work over
+    //! a pool of worker threads. The input is split into fixed-size
+    //! chunks, each chunk is compressed independently into a complete
+    //! gzip member and the members are concatenated in order, which
+    //! yields a standard gzip stream (the same layout produced by
+    //! pigz). Compared to a single-threaded pass the wall-clock cost
+    //! of rotating a large log drops roughly by the worker count, and
+    //! no worker ever holds more than one chunk in memory.
+    class ParallelGzipCompressor
+    {
+    public:
+      //! Constructor.
+      //! @param[in] worker_count number of worker threads.
+      //! @param[in] a_level compression level, -1 for the zlib
+      //! default.
+      ParallelGzipCompressor(unsigned worker_count = 2, int a_level = -1);
+
+      //! Compress one file into another as concatenated gzip
+      //! members.
+      //! @param[in] src_file path to the input file.
+      //! @param[in] dst_file path to the output file.
+      void
+      compress(const char* src_file, const char* dst_file);
+
+    private:
+      //! Size of each independently compressed chunk.
+      static const unsigned c_chunk_size = 1048576;
+      //! Number of worker threads.
+      unsigned m_worker_count;
+      //! Compression level.
+      int m_level;
+
+      //! Non - copyable.
+      ParallelGzipCompressor(const ParallelGzipCompressor&);
+
+      //! Non - assignable.
+      ParallelGzipCompressor&
+      operator=(const ParallelGzipCompressor&);
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,186 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstring>
+
+// DUNE headers.
+#include <DUNE/Compression/ReadaheadBuffer.hpp>
+#include <DUNE/Concurrency/Thread.hpp>
+
+namespace DUNE
+{
+  namespace Compression
+  {
+    //! Worker thread: pops free chunks, fills each one from the
+    //! associated stream and pushes it to the full queue. A chunk of
+    //! length zero marks the end of the stream.
+    class ReadaheadBuffer::Filler: public Concurrency::Thread
+    {
+    public:
+      Filler(std::istream* stream, Concurrency::TSQueue<Chunk*>& free_q,
+             Concurrency::TSQueue<Chunk*>& full_q):
+        m_stream(stream),
+        m_free(free_q),
+        m_full(full_q)
+      { }
+
+    private:
+      //! Associated stream.
+      std::istream* m_stream;
+      //! Chunks available for filling.
+      Concurrency::TSQueue<Chunk*>& m_free;
+      //! Filled chunks.
+      Concurrency::TSQueue<Chunk*>& m_full;
+
+      void
+      run(void)
+      {
+        while (isRunning())
+        {
+          if (!m_free.waitForItems(0.5))
+            continue;
+
+          Chunk* chunk = m_free.pop();
+          if (chunk == NULL)
+            continue;
+
+          m_stream->read(chunk->data.getBufferSigned(), chunk->data.getSize());
+          chunk->len = m_stream->gcount();
+          m_full.push(chunk);
+
+          if (chunk->len == 0)
+            break;
+        }
+      }
+    };
+
+    ReadaheadBuffer::ReadaheadBuffer(std::istream* stream, unsigned depth,
+                                     size_t chunk_size):
+      m_chunk(NULL),
+      m_eof(false)
+    {
+      if (depth == 0)
+        depth = 1;
+
+      for (unsigned i = 0; i < depth; ++i)
+      {
+        Chunk* chunk = new Chunk;
+        chunk->data.setSize(chunk_size);
+        chunk->len = 0;
+        m_free.push(chunk);
+      }
+
+      m_filler = new Filler(stream, m_free, m_full);
+      m_filler->start();
+    }
+
+    ReadaheadBuffer::~ReadaheadBuffer(void)
+    {
+      m_filler->stopAndJoin();
+      delete m_filler;
+
+      delete m_chunk;
+
+      while (!m_free.empty())
+        delete m_free.pop();
+
+      while (!m_full.empty())
+        delete m_full.pop();
+    }
+
+    bool
+    ReadaheadBuffer::fetch(void)
+    {
+      if (m_eof)
+        return false;
+
+      if (m_chunk != NULL)
+      {
+        m_free.push(m_chunk);
+        m_chunk = NULL;
+      }
+
+      while (m_chunk == NULL)
+      {
+        if (!m_full.waitForItems(0.5))
+          continue;
+
+        m_chunk = m_full.pop();
+      }
+
+      if (m_chunk->len == 0)
+      {
+        m_eof = true;
+        return false;
+      }
+
+      char* data = m_chunk->data.getBufferSigned();
+      setg(data, data, data + m_chunk->len);
+      return true;
+    }
+
+    ReadaheadBuffer::int_type
+    ReadaheadBuffer::underflow(void)
+    {
+      if (gptr() < egptr())
+        return traits_type::to_int_type(*gptr());
+
+      if (!fetch())
+        return traits_type::eof();
+
+      return traits_type::to_int_type(*gptr());
+    }
+
+    std::streamsize
+    ReadaheadBuffer::xsgetn(char* bfr, std::streamsize bfr_len)
+    {
+      std::streamsize total = 0;
+
+      while (total < bfr_len)
+      {
+        if (gptr() >= egptr())
+        {
+          if (!fetch())
+            break;
+        }
+
+        std::streamsize chunk = egptr() - gptr();
+        if (chunk > bfr_len - total)
+          chunk = bfr_len - total;
+
+        std::memcpy(bfr + total, gptr(), chunk);
+        gbump(chunk);
+        total += chunk;
+      }
+
+      return total;
+    }
+  }
+}
@@ -0,0 +1,136 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+#ifndef DUNE_COMPRESSION_READAHEAD_BUFFER_HPP_INCLUDED_
+#define DUNE_COMPRESSION_READAHEAD_BUFFER_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <streambuf>
+#include <istream>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Concurrency/TSQueue.hpp>
+#include <DUNE/Utils/ByteBuffer.hpp>
+
+namespace DUNE
+{
+  namespace Compression
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM ReadaheadBuffer;
+
+    //! Stream buffer that reads ahead of the consumer on a worker
+    //! thread.
+    //!
+    //! The worker fills a bounded ring of chunks from the associated
+    //! stream; when that stream is a FilterInput or FileInput the
+    //! decompression work itself runs on the worker. Chunks move
+    //! between the threads by pointer only and the get area is set
+    //! directly over the filled chunk, so handing a chunk to the
+    //! consumer copies nothing.
+    //!
+    //! Seeking is not supported, matching StreamBuffer.
+    class ReadaheadBuffer: public std::streambuf
+    {
+    public:
+      //! Default readahead depth in chunks.
+      static const unsigned c_default_depth = 4;
+      //! Default chunk size in bytes.
+      static const size_t c_default_chunk_size = 256 * 1024;
+
+      //! Constructor.
+      //! @param[in] stream stream to read from.
+      //! @param[in] depth number of chunks read ahead of the consumer.
+      //! @param[in] chunk_size size of each chunk in bytes.
+      ReadaheadBuffer(std::istream* stream, unsigned depth = c_default_depth,
+                      size_t chunk_size = c_default_chunk_size);
+
+      virtual
+      ~ReadaheadBuffer(void);
+
+    protected:
+      virtual int_type
+      underflow(void);
+
+      virtual std::streamsize
+      xsgetn(char* bfr, std::streamsize bfr_len);
+
+      virtual std::streampos
+      seekoff(std::streamoff off, std::ios_base::seekdir way,
+              std::ios_base::openmode which = std::ios_base::in | std::ios_base::out)
+      {
+        (void)off;
+        (void)way;
+        (void)which;
+
+        return -1;
+      }
+
+    private:
+      //! One ring chunk.
+      struct Chunk
+      {
+        //! Storage.
+        Utils::ByteBuffer data;
+        //! Number of valid bytes, zero at end of stream.
+        std::streamsize len;
+      };
+
+      // Forward declaration.
+      class Filler;
+
+      //! Worker thread.
+      Filler* m_filler;
+      //! Chunks available to the worker.
+      Concurrency::TSQueue<Chunk*> m_free;
+      //! Chunks filled by the worker, in stream order.
+      Concurrency::TSQueue<Chunk*> m_full;
+      //! Chunk currently backing the get area.
+      Chunk* m_chunk;
+      //! True once the worker signalled end of stream.
+      bool m_eof;
+
+      //! Hand the current chunk back to the worker and make the next
+      //! filled chunk the get area.
+      //! @return true if data is available, false at end of stream.
+      bool
+      fetch(void);
+
+      // Non - copyable.
+      ReadaheadBuffer(const ReadaheadBuffer&);
+
+      // Non - assignable.
+      ReadaheadBuffer&
+      operator=(const ReadaheadBuffer&);
+    };
+  }
+}
+
+#endif
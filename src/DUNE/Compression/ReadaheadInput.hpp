@@ -0,0 +1,83 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+#ifndef DUNE_COMPRESSION_READAHEAD_INPUT_HPP_INCLUDED_
+#define DUNE_COMPRESSION_READAHEAD_INPUT_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <istream>
+
+// DUNE headers.
+#include <DUNE/Compression/FileInput.hpp>
+#include <DUNE/Compression/ReadaheadBuffer.hpp>
+#include <DUNE/Compression/Methods.hpp>
+
+namespace DUNE
+{
+  namespace Compression
+  {
+    //! Compressed file input stream that decompresses ahead of the
+    //! consumer on a worker thread. A drop-in replacement for
+    //! FileInput in sequential replay and log processing, where the
+    //! consumer no longer stalls on decompression bursts.
+    class ReadaheadInput: public std::istream
+    {
+    public:
+      //! Constructor.
+      //! @param[in] filename name of the compressed file.
+      //! @param[in] method compression method.
+      //! @param[in] depth number of chunks decompressed ahead of the
+      //! consumer.
+      //! @param[in] chunk_size size of each chunk in bytes.
+      ReadaheadInput(const char* filename, Methods method,
+                     unsigned depth = ReadaheadBuffer::c_default_depth,
+                     size_t chunk_size = ReadaheadBuffer::c_default_chunk_size):
+        std::istream(0),
+        m_file(filename, method),
+        m_buffer(0)
+      {
+        m_buffer = new ReadaheadBuffer(&m_file, depth, chunk_size);
+        rdbuf(m_buffer);
+      }
+
+      ~ReadaheadInput(void)
+      {
+        delete m_buffer;
+      }
+
+    protected:
+      //! Decompressing file stream, read by the worker.
+      FileInput m_file;
+      //! Readahead stream buffer.
+      ReadaheadBuffer* m_buffer;
+    };
+  }
+}
+
+#endif
@@ -45,6 +45,7 @@ namespace DUNE
 #include <DUNE/Concurrency/RWLock.hpp>
 #include <DUNE/Concurrency/ScopedRWLock.hpp>
 #include <DUNE/Concurrency/Condition.hpp>
+#include <DUNE/Concurrency/Heartbeat.hpp>
 #include <DUNE/Concurrency/ScopedCondition.hpp>
 #include <DUNE/Concurrency/Thread.hpp>
 #include <DUNE/Concurrency/Barrier.hpp>
@@ -53,6 +54,8 @@ namespace DUNE
 #include <DUNE/Concurrency/Scheduler.hpp>
 #include <DUNE/Concurrency/Constants.hpp>
 #include <DUNE/Concurrency/TSQueue.hpp>
+#include <DUNE/Concurrency/SPSCQueue.hpp>
+#include <DUNE/Concurrency/MPSCQueue.hpp>
 #include <DUNE/Concurrency/Process.hpp>
 #include <DUNE/Concurrency/SharedMemory.hpp>
 #include <DUNE/Concurrency/Semaphore.hpp>
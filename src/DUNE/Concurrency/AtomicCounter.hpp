@@ -77,6 +77,14 @@ namespace DUNE
 #endif
       }
 
+      //! Atomically retrieve the current value.
+      //! @return current value.
+      inline int
+      get(void)
+      {
+        return add(0);
+      }
+
       //! Atomically subtract a number to the current value and return
       //! the result.
       //! @param value number to subtract.
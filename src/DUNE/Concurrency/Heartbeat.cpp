@@ -0,0 +1,120 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstring>
+
+// DUNE headers.
+#include <DUNE/Concurrency/Heartbeat.hpp>
+#include <DUNE/Concurrency/ScopedMutex.hpp>
+#include <DUNE/Time/Clock.hpp>
+
+namespace DUNE
+{
+  namespace Concurrency
+  {
+    HeartbeatRegistry::HeartbeatRegistry(void)
+    {
+      std::memset(m_slots, 0, sizeof(m_slots));
+      std::memset(m_seen_beat, 0, sizeof(m_seen_beat));
+      std::memset(m_seen_time, 0, sizeof(m_seen_time));
+      std::memset(m_flagged, 0, sizeof(m_flagged));
+    }
+
+    HeartbeatSlot*
+    HeartbeatRegistry::acquire(const std::string& name)
+    {
+      ScopedMutex l(m_lock);
+
+      for (unsigned i = 0; i < c_heartbeat_slots; ++i)
+      {
+        if (m_slots[i].used)
+          continue;
+
+        HeartbeatSlot& slot = m_slots[i];
+        slot.beat = 0;
+        slot.context = c_heartbeat_no_context;
+        std::strncpy(slot.name, name.c_str(), sizeof(slot.name) - 1);
+        slot.name[sizeof(slot.name) - 1] = '\0';
+        slot.used = 1;
+
+        m_seen_beat[i] = 0;
+        m_seen_time[i] = Time::Clock::get();
+        m_flagged[i] = false;
+
+        return &slot;
+      }
+
+      return NULL;
+    }
+
+    void
+    HeartbeatRegistry::release(HeartbeatSlot* slot)
+    {
+      if (slot == NULL)
+        return;
+
+      ScopedMutex l(m_lock);
+      slot->used = 0;
+    }
+
+    void
+    HeartbeatRegistry::scan(double timeout, std::vector<Stall>& stalls)
+    {
+      ScopedMutex l(m_lock);
+
+      double now = Time::Clock::get();
+
+      for (unsigned i = 0; i < c_heartbeat_slots; ++i)
+      {
+        if (!m_slots[i].used)
+          continue;
+
+        uint32_t beat = m_slots[i].beat;
+        if (beat != m_seen_beat[i])
+        {
+          m_seen_beat[i] = beat;
+          m_seen_time[i] = now;
+          m_flagged[i] = false;
+          continue;
+        }
+
+        if (m_flagged[i] || (now - m_seen_time[i]) < timeout)
+          continue;
+
+        Stall stall;
+        stall.name = m_slots[i].name;
+        stall.context = m_slots[i].context;
+        stall.duration = now - m_seen_time[i];
+        stalls.push_back(stall);
+        m_flagged[i] = true;
+      }
+    }
+  }
+}
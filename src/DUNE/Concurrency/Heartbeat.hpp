@@ -0,0 +1,136 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+#ifndef DUNE_CONCURRENCY_HEARTBEAT_HPP_INCLUDED_
+#define DUNE_CONCURRENCY_HEARTBEAT_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Concurrency/Mutex.hpp>
+
+namespace DUNE
+{
+  namespace Concurrency
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM HeartbeatRegistry;
+
+    //! Maximum number of threads tracked by the registry.
+    static const unsigned c_heartbeat_slots = 128;
+
+    //! Context value of a slot whose thread is not delivering a
+    //! message.
+    static const uint32_t c_heartbeat_no_context = 0xffffffff;
+
+    //! Liveness slot of one thread. The owning thread is the only
+    //! writer, so touching a slot is a plain store with no locking;
+    //! the supervisor only reads. The slot occupies a full cache
+    //! line so threads never share one.
+    struct HeartbeatSlot
+    {
+      //! Beat counter, incremented only by the owning thread.
+      volatile uint32_t beat;
+      //! Identifier of the message being delivered,
+      //! c_heartbeat_no_context when none.
+      volatile uint32_t context;
+      //! Non zero while a thread owns the slot.
+      uint32_t used;
+      //! Name of the owning thread.
+      char name[52];
+
+      //! Signal that the owning thread is making progress.
+      inline void
+      touch(void)
+      {
+        beat = beat + 1;
+      }
+    };
+
+    //! Registry of the liveness slots of all threads of a context.
+    //! Message loops touch their slot on every iteration and a
+    //! supervisor scans the registry periodically, flagging threads
+    //! whose beat counter stopped advancing.
+    class HeartbeatRegistry
+    {
+    public:
+      //! One stalled thread found by scan().
+      struct Stall
+      {
+        //! Name of the stalled thread.
+        std::string name;
+        //! Identifier of the message it was delivering,
+        //! c_heartbeat_no_context when it was not inside a consumer.
+        uint32_t context;
+        //! Time since the last observed beat (s).
+        double duration;
+      };
+
+      //! Constructor.
+      HeartbeatRegistry(void);
+
+      //! Acquire a slot for the calling thread.
+      //! @param[in] name thread name.
+      //! @return slot pointer, NULL when the registry is full.
+      HeartbeatSlot*
+      acquire(const std::string& name);
+
+      //! Release a slot.
+      //! @param[in] slot slot pointer, NULL is ignored.
+      void
+      release(HeartbeatSlot* slot);
+
+      //! Scan all slots for threads whose beat counter did not
+      //! advance for longer than the given timeout. Each stall is
+      //! reported once, when first detected; a thread that resumes
+      //! beating is eligible to be reported again.
+      //! @param[in] timeout stall detection timeout (s).
+      //! @param[out] stalls stalled threads.
+      void
+      scan(double timeout, std::vector<Stall>& stalls);
+
+    private:
+      //! Liveness slots.
+      HeartbeatSlot m_slots[c_heartbeat_slots];
+      //! Beat value of each slot at the last scan.
+      uint32_t m_seen_beat[c_heartbeat_slots];
+      //! Time at which each slot's beat was last seen advancing.
+      double m_seen_time[c_heartbeat_slots];
+      //! True for slots already reported as stalled.
+      bool m_flagged[c_heartbeat_slots];
+      //! Lock serializing slot ownership changes and scans.
+      Mutex m_lock;
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,223 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+#ifndef DUNE_CONCURRENCY_MPSC_QUEUE_HPP_INCLUDED_
+#define DUNE_CONCURRENCY_MPSC_QUEUE_HPP_INCLUDED_
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Concurrency/Mutex.hpp>
+#include <DUNE/Concurrency/ScopedMutex.hpp>
+
+// Check if we can use GCC's atomic functions.
+#if defined(DUNE_SYS_HAS___SYNC_ADD_AND_FETCH) && defined(DUNE_SYS_HAS___SYNC_SUB_AND_FETCH)
+#  ifndef DUNE_CONCURRENCY_MPSC_QUEUE_LOCK_FREE
+#    define DUNE_CONCURRENCY_MPSC_QUEUE_LOCK_FREE
+#  endif
+#endif
+
+namespace DUNE
+{
+  namespace Concurrency
+  {
+    //! Bounded lock-free queue for multiple producer threads and
+    //! exactly one consumer thread.
+    //!
+    //! Each slot carries a sequence number: producers claim a slot by
+    //! advancing the tail index with a compare-and-swap and publish
+    //! the contents by bumping the slot's sequence, so the consumer
+    //! never observes a claimed but unwritten slot. The head and tail
+    //! indices live on separate cache lines to keep producers and the
+    //! consumer from invalidating each other's line on every
+    //! operation. Capacity is fixed at compile time and must be a
+    //! power of two. For a fixed producer/consumer pair prefer
+    //! SPSCQueue, which needs no atomic read-modify-write at all.
+    template <typename T, uint32_t N>
+    class MPSCQueue
+    {
+    public:
+      //! Constructor.
+      MPSCQueue(void):
+        m_head(0),
+        m_tail(0)
+      {
+        // Capacity must be a non-zero power of two.
+        typedef char CapacityCheck[(N != 0 && (N & (N - 1)) == 0) ? 1 : -1];
+        (void)sizeof(CapacityCheck);
+
+        for (uint32_t i = 0; i < N; ++i)
+          m_slots[i].seq = i;
+      }
+
+      //! Add an element to the end of the queue (producer side).
+      //! @param v variable to insert.
+      //! @return true if the element was inserted, false if the
+      //! queue is full.
+      inline bool
+      push(const T& v)
+      {
+#if defined(DUNE_CONCURRENCY_MPSC_QUEUE_LOCK_FREE)
+        uint32_t pos = m_tail;
+
+        while (true)
+        {
+          Slot& slot = m_slots[pos & (N - 1)];
+          int32_t dif = (int32_t)(slot.seq - pos);
+
+          if (dif == 0)
+          {
+            if (__sync_bool_compare_and_swap(&m_tail, pos, pos + 1))
+            {
+              slot.data = v;
+
+              // Publish the contents before exposing the slot to the
+              // consumer.
+              __sync_synchronize();
+              slot.seq = pos + 1;
+              return true;
+            }
+            pos = m_tail;
+          }
+          else if (dif < 0)
+          {
+            return false;
+          }
+          else
+          {
+            pos = m_tail;
+          }
+        }
+#else
+        ScopedMutex l(m_lock);
+        Slot& slot = m_slots[m_tail & (N - 1)];
+        if ((int32_t)(slot.seq - m_tail) != 0)
+          return false;
+
+        slot.data = v;
+        slot.seq = m_tail + 1;
+        ++m_tail;
+        return true;
+#endif
+      }
+
+      //! Retrieve the first element of the queue and remove it from
+      //! the queue (consumer side).
+      //! @param[out] v retrieved element, untouched if the queue is
+      //! empty.
+      //! @return true if an element was retrieved, false if the
+      //! queue is empty.
+      inline bool
+      pop(T& v)
+      {
+#if defined(DUNE_CONCURRENCY_MPSC_QUEUE_LOCK_FREE)
+        Slot& slot = m_slots[m_head & (N - 1)];
+        if ((int32_t)(slot.seq - (m_head + 1)) != 0)
+          return false;
+
+        // Observe the sequence before reading the contents.
+        __sync_synchronize();
+        v = slot.data;
+
+        // Recycle the slot for the producer one lap ahead.
+        __sync_synchronize();
+        slot.seq = m_head + N;
+        ++m_head;
+        return true;
+#else
+        ScopedMutex l(m_lock);
+        Slot& slot = m_slots[m_head & (N - 1)];
+        if ((int32_t)(slot.seq - (m_head + 1)) != 0)
+          return false;
+
+        v = slot.data;
+        slot.seq = m_head + N;
+        ++m_head;
+        return true;
+#endif
+      }
+
+      //! Verify if the queue has elements. Only meaningful on the
+      //! consumer side: producers may be publishing concurrently.
+      //! @return true if the queue has no elements, false otherwise.
+      inline bool
+      empty(void) const
+      {
+        const Slot& slot = m_slots[m_head & (N - 1)];
+        return (int32_t)(slot.seq - (m_head + 1)) != 0;
+      }
+
+      //! Retrieve the queue's capacity.
+      //! @return maximum number of elements.
+      inline uint32_t
+      getCapacity(void) const
+      {
+        return N;
+      }
+
+    private:
+      //! Assumed size of a cache line.
+      static const uint32_t c_cache_line = 64;
+
+      //! Queue slot: sequence number plus contents.
+      struct Slot
+      {
+        //! Sequence number: pos when free, pos + 1 when filled.
+        volatile uint32_t seq;
+        //! Contents.
+        T data;
+      };
+
+      //! Slot storage.
+      Slot m_slots[N];
+      //! Padding between the slots and the consumer index.
+      char m_pad0[c_cache_line];
+      //! Head index, written only by the consumer.
+      volatile uint32_t m_head;
+      //! Padding between the consumer and producer indices.
+      char m_pad1[c_cache_line - sizeof(uint32_t)];
+      //! Tail index, advanced by producers with compare-and-swap.
+      volatile uint32_t m_tail;
+      //! Padding after the producer index.
+      char m_pad2[c_cache_line - sizeof(uint32_t)];
+#if !defined(DUNE_CONCURRENCY_MPSC_QUEUE_LOCK_FREE)
+      //! Fallback lock used when atomic builtins are unavailable.
+      Mutex m_lock;
+#endif
+
+      //! Non - copyable.
+      MPSCQueue(const MPSCQueue&);
+
+      //! Non - assignable.
+      MPSCQueue&
+      operator=(const MPSCQueue&);
+    };
+  }
+}
+
+#endif
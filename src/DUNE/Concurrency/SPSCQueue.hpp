@@ -0,0 +1,211 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+#ifndef DUNE_CONCURRENCY_SPSC_QUEUE_HPP_INCLUDED_
+#define DUNE_CONCURRENCY_SPSC_QUEUE_HPP_INCLUDED_
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Concurrency/ScopedCondition.hpp>
+
+// Check if we can use GCC's atomic functions.
+#if defined(DUNE_SYS_HAS___SYNC_ADD_AND_FETCH) && defined(DUNE_SYS_HAS___SYNC_SUB_AND_FETCH)
+#  define DUNE_CONCURRENCY_SPSC_QUEUE_BARRIER __sync_synchronize()
+#else
+#  define DUNE_CONCURRENCY_SPSC_QUEUE_BARRIER
+#endif
+
+namespace DUNE
+{
+  namespace Concurrency
+  {
+    //! Bounded lock-free queue for exactly one producer thread and
+    //! one consumer thread.
+    //!
+    //! Unlike TSQueue, push and pop never take a lock: the producer
+    //! only writes the head index and the consumer only writes the
+    //! tail index, so a single memory barrier on each side is enough
+    //! to order slot contents with index publication. The condition
+    //! variable is touched only when the consumer declares itself
+    //! asleep, keeping the hot path free of system calls. Use this
+    //! queue for high-rate handoff between a fixed pair of threads
+    //! (e.g. driver reader thread to task); use TSQueue whenever
+    //! multiple producers are involved.
+    template <typename T>
+    class SPSCQueue
+    {
+    public:
+      //! Constructor.
+      //! @param capacity queue capacity, rounded up to a power of two.
+      SPSCQueue(unsigned capacity = 1024):
+        m_head(0),
+        m_tail(0),
+        m_waiting(false)
+      {
+        m_capacity = 1;
+        while (m_capacity < capacity)
+          m_capacity <<= 1;
+
+        m_mask = m_capacity - 1;
+        m_data = new T[m_capacity];
+      }
+
+      //! Destructor.
+      ~SPSCQueue(void)
+      {
+        delete [] m_data;
+      }
+
+      //! Add an element to the end of the queue (producer side).
+      //! @param v variable to insert.
+      //! @return true if the element was inserted, false if the
+      //! queue is full.
+      inline bool
+      push(const T& v)
+      {
+        uint32_t head = m_head;
+        if (head - m_tail >= m_capacity)
+          return false;
+
+        m_data[head & m_mask] = v;
+
+        // Publish the slot before advancing the head index.
+        DUNE_CONCURRENCY_SPSC_QUEUE_BARRIER;
+        m_head = head + 1;
+
+        // Wake the consumer if it declared itself asleep.
+        DUNE_CONCURRENCY_SPSC_QUEUE_BARRIER;
+        if (m_waiting)
+        {
+          ScopedCondition l(m_cond);
+          m_cond.signal();
+        }
+
+        return true;
+      }
+
+      //! Retrieve the first element of the queue and remove it from
+      //! the queue (consumer side).
+      //! @return first element of the queue or a default constructed
+      //! value if the queue is empty.
+      inline T
+      pop(void)
+      {
+        uint32_t tail = m_tail;
+        if (tail == m_head)
+          return T();
+
+        T v = m_data[tail & m_mask];
+
+        // Consume the slot before advancing the tail index.
+        DUNE_CONCURRENCY_SPSC_QUEUE_BARRIER;
+        m_tail = tail + 1;
+        return v;
+      }
+
+      //! Wait for items to be available (consumer side).
+      //! @param timeout timeout in seconds, use a negative number to
+      //! wait forever.
+      //! @return true if at least one element is available, false
+      //! otherwise.
+      inline bool
+      waitForItems(double timeout = -1.0)
+      {
+        if (!empty())
+          return true;
+
+        ScopedCondition l(m_cond);
+        m_waiting = true;
+
+        // Re-check after declaring intent to sleep: a producer that
+        // published after the first check will observe m_waiting and
+        // block on the condition lock to signal us.
+        DUNE_CONCURRENCY_SPSC_QUEUE_BARRIER;
+        if (!empty())
+        {
+          m_waiting = false;
+          return true;
+        }
+
+        m_cond.wait(timeout);
+        m_waiting = false;
+        return !empty();
+      }
+
+      //! Verify if the queue has elements.
+      //! @return true if the queue has no elements, false otherwise.
+      inline bool
+      empty(void) const
+      {
+        return m_head == m_tail;
+      }
+
+      //! Retrieve the number of elements currently in the queue.
+      //! @return number of elements of the queue.
+      inline unsigned
+      size(void) const
+      {
+        return m_head - m_tail;
+      }
+
+      //! Retrieve the queue's capacity.
+      //! @return maximum number of elements.
+      inline unsigned
+      getCapacity(void) const
+      {
+        return m_capacity;
+      }
+
+    private:
+      //! Slot storage.
+      T* m_data;
+      //! Capacity (power of two).
+      uint32_t m_capacity;
+      //! Index mask.
+      uint32_t m_mask;
+      //! Head index, written only by the producer.
+      volatile uint32_t m_head;
+      //! Tail index, written only by the consumer.
+      volatile uint32_t m_tail;
+      //! True while the consumer is blocked on the condition.
+      volatile bool m_waiting;
+      //! Consumer sleep condition.
+      Condition m_cond;
+
+      //! Non - copyable.
+      SPSCQueue(const SPSCQueue&);
+
+      //! Non - assignable.
+      SPSCQueue&
+      operator=(const SPSCQueue&);
+    };
+  }
+}
+
+#endif
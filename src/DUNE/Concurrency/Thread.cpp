@@ -226,6 +226,31 @@ namespace DUNE
       return 0;
     }
 
+    void
+    Thread::setAffinity(const std::vector<unsigned>& cpus)
+    {
+#if defined(DUNE_OS_LINUX)
+      if (m_id < 0 || cpus.empty())
+        return;
+
+      // Build the kernel CPU mask by hand so we do not depend on the
+      // GNU-only cpu_set_t macros.
+      unsigned long mask[16] = {0};
+      const unsigned bits = 8 * sizeof(unsigned long);
+
+      for (unsigned i = 0; i < cpus.size(); ++i)
+      {
+        if (cpus[i] / bits < sizeof(mask) / sizeof(mask[0]))
+          mask[cpus[i] / bits] |= 1ul << (cpus[i] % bits);
+      }
+
+      if (syscall(SYS_sched_setaffinity, m_id, sizeof(mask), mask) != 0)
+        throw ThreadError("unable to set thread affinity", errno);
+#else
+      (void)cpus;
+#endif
+    }
+
     Runnable::State
     Thread::getStateImpl(void)
     {
@@ -32,6 +32,7 @@
 
 // ISO C++ 98 headers.
 #include <string>
+#include <vector>
 
 // DUNE headers.
 #include <DUNE/Config.hpp>
@@ -74,6 +75,13 @@ namespace DUNE
       int
       getProcessorUsage(void);
 
+      //! Restrict the thread to a set of CPUs. Only effective after
+      //! the thread started; silently ignored on systems without
+      //! support for thread affinity.
+      //! @param[in] cpus CPU numbers the thread may execute on.
+      void
+      setAffinity(const std::vector<unsigned>& cpus);
+
     protected:
       void
       startImpl(void);
@@ -32,6 +32,7 @@
 
 // DUNE headers.
 #include <DUNE/Control/PathController.hpp>
+#include <DUNE/Tasks/RealTimeGuard.hpp>
 #include <DUNE/Math/General.hpp>
 #include <DUNE/Math/Angles.hpp>
 #include <DUNE/Time.hpp>
@@ -546,6 +547,10 @@ namespace DUNE
     void
     PathController::consume(const IMC::EstimatedState* es)
     {
+      // The steering path must not allocate or block; enable
+      // DUNE_RT_CHECK to enforce this at runtime.
+      Tasks::RealTimeGuard rtg("PathController");
+
       // Pass EstimatedStates from the specified vehicle.
       if (sourceFilter(es))
         return;
@@ -718,7 +723,9 @@ namespace DUNE
       getBearingAndRange(m_estate, m_ts.end, &m_ts.los_angle, &m_ts.range);
 
       // Ground course and speed
-      m_ts.course = m_ts.cc ? std::atan2(m_estate.vy, m_estate.vx) : m_estate.psi;
+      // Approximate trig is used on this per-cycle path; its error
+      // (see Math::TrigApprox) is well below navigation noise.
+      m_ts.course = m_ts.cc ? TrigApprox::atan2(m_estate.vy, m_estate.vx) : m_estate.psi;
       m_ts.speed = m_ts.cc ? Math::norm(m_estate.vx, m_estate.vy) : m_estate.u;
 
       if (!m_ts.loitering)
@@ -766,9 +773,9 @@ namespace DUNE
       }
 
       m_ts.track_pos.z = m_estate.z - m_ts.end.z; // vertical-track
-      m_ts.track_vel.x = m_ts.speed * std::cos(m_ts.course_error); // along-track
-      m_ts.track_vel.y = m_ts.speed * std::sin(m_ts.course_error); // cross-track
-      m_ts.track_vel.z = std::sin(m_estate.theta) * m_estate.vz; // vertical-track
+      m_ts.track_vel.x = m_ts.speed * TrigApprox::cos(m_ts.course_error); // along-track
+      m_ts.track_vel.y = m_ts.speed * TrigApprox::sin(m_ts.course_error); // cross-track
+      m_ts.track_vel.z = TrigApprox::sin(m_estate.theta) * m_estate.vz; // vertical-track
     }
 
     bool
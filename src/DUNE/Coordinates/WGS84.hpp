@@ -285,6 +285,277 @@ namespace DUNE
         getNEBearingAndRange(lat1, lon1, lat2, lon2, azimuth, &tmp);
       }
 
+      //! Cached local tangent plane at a reference coordinate.
+      //!
+      //! Precomputes the earth radii and plane rotation terms of a
+      //! reference point so that callers reusing the same reference
+      //! every cycle (navigation filters, path controllers) get
+      //! displacement computations that degenerate to a few
+      //! multiplications. The approximation is accurate to better
+      //! than 0.2 m within 10 km of the origin; queries beyond the
+      //! configured validity radius fall back to the exact routines
+      //! and a change of the reference point re-centers the cache.
+      class CachedOrigin
+      {
+      public:
+        //! Constructor.
+        //! @param valid_radius radius around the origin within which
+        //! the tangent plane approximation is used (m).
+        CachedOrigin(double valid_radius = 10000.0):
+          m_lat(0), m_lon(0), m_hae(0),
+          m_rm(0), m_rn(0), m_rn_clat(0), m_rn_slat(0), m_tilt(0),
+          m_radius(valid_radius),
+          m_valid(false)
+        { }
+
+        //! Compute North-East-Down displacement between two WGS-84
+        //! coordinates (@see WGS84::displacement).
+        //!
+        //! @param[in] rlat reference WGS-84 latitude (rad).
+        //! @param[in] rlon reference WGS-84 longitude (rad).
+        //! @param[in] rhae reference WGS-84 coordinate height (m).
+        //! @param[in] lat Offset coordinate WGS-84 latitude (rad).
+        //! @param[in] lon Offset coordinate WGS-84 longitude (rad).
+        //! @param[in] hae Offset coordinate height (m).
+        //! @param[out] n storage for North offset (m).
+        //! @param[out] e storage for East offset (m).
+        //! @param[out] d storage for Down offset (m).
+        template <typename Ta, typename Tb, typename Tc, typename Td, typename Te>
+        void
+        displacement(Ta rlat, Ta rlon, Tb rhae,
+                     Tc lat, Tc lon, Td hae,
+                     Te* n, Te* e, Te* d = NULL)
+        {
+          if (!m_valid || (double)rlat != m_lat || (double)rlon != m_lon)
+            recenter(rlat, rlon, rhae);
+          else
+            m_hae = rhae;
+
+          double dlat = lat - m_lat;
+          double dlon = lon - m_lon;
+          double pn = dlat * m_rm;
+          double pe = dlon * m_rn_clat;
+
+          if (std::fabs(pn) > m_radius || std::fabs(pe) > m_radius)
+          {
+            WGS84::displacement(rlat, rlon, rhae, lat, lon, hae, n, e, d);
+            return;
+          }
+
+          // Second order terms of the tangent plane rotation.
+          pn += 0.5 * m_rn_slat * m_rn_clat / m_rn * dlon * dlon;
+          pe -= m_rn_slat * dlat * dlon;
+
+          if (n != NULL)
+            *n = pn;
+
+          if (e != NULL)
+            *e = pe;
+
+          // Curvature drop of the plane below the ellipsoid.
+          if (d != NULL)
+            *d = (m_hae - hae) + (pn * pn + pe * pe) / (2.0 * m_rn);
+        }
+
+        //! Displace a WGS-84 coordinate in the NED frame according to
+        //! given offsets (@see WGS84::displace).
+        //!
+        //! @param[in] n North offset (m).
+        //! @param[in] e East offset (m).
+        //! @param[in] d Down offset (m).
+        //! @param[in,out] lat reference latitude on entry, displaced
+        //!                latitude on exit (rad).
+        //! @param[in,out] lon reference longitude entry, displaced
+        //!                longitude on exit (rad).
+        //! @param[in,out] hae reference height on entry, displaced
+        //!                height on exit (m).
+        template <typename Ta, typename Tb, typename Tc, typename Td>
+        void
+        displace(Ta n, Ta e, Tb d,
+                 Tc* lat, Tc* lon, Td* hae)
+        {
+          if (std::fabs((double)n) > m_radius || std::fabs((double)e) > m_radius)
+          {
+            WGS84::displace(n, e, d, lat, lon, hae);
+            return;
+          }
+
+          if (!m_valid || (double)*lat != m_lat || (double)*lon != m_lon)
+            recenter(*lat, *lon, *hae);
+          else
+            m_hae = *hae;
+
+          double dlon0 = e / m_rn_clat;
+          double dlat = (n - 0.5 * m_rn_slat * m_rn_clat / m_rn * dlon0 * dlon0) / m_rm;
+          double dlon = (e + m_rn_slat * dlat * dlon0) / m_rn_clat;
+
+          *lat = m_lat + dlat;
+          *lon = m_lon + dlon;
+
+          // Match WGS84::displace(), whose height output carries the
+          // tilt of the geocentric tangent plane and the curvature
+          // rise of the geodetic one.
+          *hae = m_hae - d + n * m_tilt
+                 + ((double)n * n + (double)e * e) / (2.0 * m_rn);
+        }
+
+        //! Batch version of displacement() for struct-of-arrays data,
+        //! converting many points against a single reference with one
+        //! multiplication-only loop (e.g. georeferencing sonar swaths).
+        //! Points beyond the validity radius fall back individually to
+        //! the exact routine.
+        //!
+        //! @param[in] rlat reference WGS-84 latitude (rad).
+        //! @param[in] rlon reference WGS-84 longitude (rad).
+        //! @param[in] rhae reference WGS-84 coordinate height (m).
+        //! @param[in] lat array of WGS-84 latitudes (rad).
+        //! @param[in] lon array of WGS-84 longitudes (rad).
+        //! @param[in] hae array of heights (m), may be NULL for zero.
+        //! @param[in] count number of points.
+        //! @param[out] n storage for North offsets (m).
+        //! @param[out] e storage for East offsets (m).
+        //! @param[out] d storage for Down offsets (m), may be NULL.
+        void
+        displacement(double rlat, double rlon, double rhae,
+                     const double* lat, const double* lon, const double* hae,
+                     size_t count, double* n, double* e, double* d = NULL)
+        {
+          if (!m_valid || rlat != m_lat || rlon != m_lon)
+            recenter(rlat, rlon, rhae);
+          else
+            m_hae = rhae;
+
+          double c_n2 = 0.5 * m_rn_slat * m_rn_clat / m_rn;
+          double inv_2rn = 1.0 / (2.0 * m_rn);
+
+          for (size_t i = 0; i < count; ++i)
+          {
+            double dlat = lat[i] - m_lat;
+            double dlon = lon[i] - m_lon;
+            double pn = dlat * m_rm;
+            double pe = dlon * m_rn_clat;
+
+            if (std::fabs(pn) > m_radius || std::fabs(pe) > m_radius)
+            {
+              double h = (hae != NULL) ? hae[i] : 0.0;
+              WGS84::displacement(rlat, rlon, rhae, lat[i], lon[i], h,
+                                  &n[i], &e[i], (d != NULL) ? &d[i] : NULL);
+              continue;
+            }
+
+            pn += c_n2 * dlon * dlon;
+            pe -= m_rn_slat * dlat * dlon;
+            n[i] = pn;
+            e[i] = pe;
+
+            if (d != NULL)
+            {
+              double h = (hae != NULL) ? hae[i] : 0.0;
+              d[i] = (m_hae - h) + (pn * pn + pe * pe) * inv_2rn;
+            }
+          }
+        }
+
+        //! Batch version of displace() for struct-of-arrays data,
+        //! converting many NED offsets from a single reference into
+        //! geodetic coordinates with one multiplication-only loop.
+        //! Offsets beyond the validity radius fall back individually
+        //! to the exact routine.
+        //!
+        //! @param[in] rlat reference WGS-84 latitude (rad).
+        //! @param[in] rlon reference WGS-84 longitude (rad).
+        //! @param[in] rhae reference WGS-84 coordinate height (m).
+        //! @param[in] n array of North offsets (m).
+        //! @param[in] e array of East offsets (m).
+        //! @param[in] d array of Down offsets (m), may be NULL for zero.
+        //! @param[in] count number of points.
+        //! @param[out] lat storage for displaced latitudes (rad).
+        //! @param[out] lon storage for displaced longitudes (rad).
+        //! @param[out] hae storage for displaced heights (m), may be NULL.
+        void
+        displace(double rlat, double rlon, double rhae,
+                 const double* n, const double* e, const double* d,
+                 size_t count, double* lat, double* lon, double* hae = NULL)
+        {
+          if (!m_valid || rlat != m_lat || rlon != m_lon)
+            recenter(rlat, rlon, rhae);
+          else
+            m_hae = rhae;
+
+          double c_n2 = 0.5 * m_rn_slat * m_rn_clat / m_rn;
+          double inv_2rn = 1.0 / (2.0 * m_rn);
+
+          for (size_t i = 0; i < count; ++i)
+          {
+            if (std::fabs(n[i]) > m_radius || std::fabs(e[i]) > m_radius)
+            {
+              lat[i] = rlat;
+              lon[i] = rlon;
+              double h = rhae;
+              WGS84::displace(n[i], e[i], (d != NULL) ? d[i] : 0.0,
+                              &lat[i], &lon[i], &h);
+              if (hae != NULL)
+                hae[i] = h;
+              continue;
+            }
+
+            double dlon0 = e[i] / m_rn_clat;
+            double dlat = (n[i] - c_n2 * dlon0 * dlon0) / m_rm;
+            double dlon = (e[i] + m_rn_slat * dlat * dlon0) / m_rn_clat;
+            lat[i] = m_lat + dlat;
+            lon[i] = m_lon + dlon;
+
+            if (hae != NULL)
+              hae[i] = m_hae - ((d != NULL) ? d[i] : 0.0) + n[i] * m_tilt
+                       + (n[i] * n[i] + e[i] * e[i]) * inv_2rn;
+          }
+        }
+
+      private:
+        //! Origin latitude (rad).
+        double m_lat;
+        //! Origin longitude (rad).
+        double m_lon;
+        //! Origin height (m).
+        double m_hae;
+        //! Radius of curvature in the meridian at the origin.
+        double m_rm;
+        //! Radius of curvature in the prime vertical at the origin.
+        double m_rn;
+        //! Rn scaled by the cosine of the origin latitude.
+        double m_rn_clat;
+        //! Rn scaled by the sine of the origin latitude.
+        double m_rn_slat;
+        //! Tilt of the geocentric tangent plane used by displace().
+        double m_tilt;
+        //! Validity radius of the tangent plane approximation (m).
+        double m_radius;
+        //! True if the cached terms match the origin.
+        bool m_valid;
+
+        //! Recompute the cached terms for a new origin.
+        //! @param[in] lat origin WGS-84 latitude (rad).
+        //! @param[in] lon origin WGS-84 longitude (rad).
+        //! @param[in] hae origin height (m).
+        void
+        recenter(double lat, double lon, double hae)
+        {
+          double slat = std::sin(lat);
+          double clat = std::cos(lat);
+          double den = 1 - c_wgs84_e2 * slat * slat;
+
+          m_lat = lat;
+          m_lon = lon;
+          m_hae = hae;
+          m_rn = c_wgs84_a / std::sqrt(den);
+          m_rm = c_wgs84_a * (1 - c_wgs84_e2) / std::sqrt(den * den * den);
+          m_rn_clat = m_rn * clat;
+          m_rn_slat = m_rn * slat;
+          m_tilt = c_wgs84_e2 * slat * clat;
+          m_valid = true;
+        }
+      };
+
     private:
       //! Convert WGS-84 coordinates to ECEF (Earch Center Earth Fixed) coordinates.
       //!
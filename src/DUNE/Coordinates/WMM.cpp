@@ -32,6 +32,7 @@
 // ISO C++ 98 headers.
 #include <cmath>
 #include <cstdlib>
+#include <cstring>
 
 // DUNE headers.
 #include <DUNE/Coordinates/WMM.hpp>
@@ -47,6 +48,126 @@ namespace DUNE
   {
     static const unsigned c_num_geoid_cols = 1441;
     static const unsigned c_num_geoid_rows = 721;
+    //! Distance a query may drift from the cached declination point
+    //! before the expansion is evaluated again (m).
+    static const double c_decl_cache_dist = 2000.0;
+    //! Height drift tolerated by the declination cache (m).
+    static const double c_decl_cache_height = 1000.0;
+    //! Mean earth radius used for the cache drift test (m).
+    static const double c_mean_radius = 6371000.0;
+
+    //! One line of the WMM coefficient file.
+    struct WMMCoefficient
+    {
+      int n;
+      int m;
+      double gnm;
+      double hnm;
+      double dgnm;
+      double dhnm;
+    };
+
+    //! Epoch of the embedded model.
+    static const double c_wmm_epoch = 2015.0;
+    //! Name of the embedded model.
+    static const char* c_wmm_name = "WMM-2015";
+    //! Degree of the embedded model.
+    static const int c_wmm_nmax = 12;
+    //! Spherical harmonic coefficients of WMM-2015, embedded so that
+    //! model initialization does not touch the filesystem.
+    static const WMMCoefficient c_wmm_cof[] =
+    {
+      { 1,  0,   -29438.5,        0.0,     10.7,      0.0},
+      { 1,  1,    -1501.1,     4796.2,     17.9,    -26.8},
+      { 2,  0,    -2445.3,        0.0,     -8.6,      0.0},
+      { 2,  1,     3012.5,    -2845.6,     -3.3,    -27.1},
+      { 2,  2,     1676.6,     -642.0,      2.4,    -13.3},
+      { 3,  0,     1351.1,        0.0,      3.1,      0.0},
+      { 3,  1,    -2352.3,     -115.3,     -6.2,      8.4},
+      { 3,  2,     1225.6,      245.0,     -0.4,     -0.4},
+      { 3,  3,      581.9,     -538.3,    -10.4,      2.3},
+      { 4,  0,      907.2,        0.0,     -0.4,      0.0},
+      { 4,  1,      813.7,      283.4,      0.8,     -0.6},
+      { 4,  2,      120.3,     -188.6,     -9.2,      5.3},
+      { 4,  3,     -335.0,      180.9,      4.0,      3.0},
+      { 4,  4,       70.3,     -329.5,     -4.2,     -5.3},
+      { 5,  0,     -232.6,        0.0,     -0.2,      0.0},
+      { 5,  1,      360.1,       47.4,      0.1,      0.4},
+      { 5,  2,      192.4,      196.9,     -1.4,      1.6},
+      { 5,  3,     -141.0,     -119.4,      0.0,     -1.1},
+      { 5,  4,     -157.4,       16.1,      1.3,      3.3},
+      { 5,  5,        4.3,      100.1,      3.8,      0.1},
+      { 6,  0,       69.5,        0.0,     -0.5,      0.0},
+      { 6,  1,       67.4,      -20.7,     -0.2,      0.0},
+      { 6,  2,       72.8,       33.2,     -0.6,     -2.2},
+      { 6,  3,     -129.8,       58.8,      2.4,     -0.7},
+      { 6,  4,      -29.0,      -66.5,     -1.1,      0.1},
+      { 6,  5,       13.2,        7.3,      0.3,      1.0},
+      { 6,  6,      -70.9,       62.5,      1.5,      1.3},
+      { 7,  0,       81.6,        0.0,      0.2,      0.0},
+      { 7,  1,      -76.1,      -54.1,     -0.2,      0.7},
+      { 7,  2,       -6.8,      -19.4,     -0.4,      0.5},
+      { 7,  3,       51.9,        5.6,      1.3,     -0.2},
+      { 7,  4,       15.0,       24.4,      0.2,     -0.1},
+      { 7,  5,        9.3,        3.3,     -0.4,     -0.7},
+      { 7,  6,       -2.8,      -27.5,     -0.9,      0.1},
+      { 7,  7,        6.7,       -2.3,      0.3,      0.1},
+      { 8,  0,       24.0,        0.0,      0.0,      0.0},
+      { 8,  1,        8.6,       10.2,      0.1,     -0.3},
+      { 8,  2,      -16.9,      -18.1,     -0.5,      0.3},
+      { 8,  3,       -3.2,       13.2,      0.5,      0.3},
+      { 8,  4,      -20.6,      -14.6,     -0.2,      0.6},
+      { 8,  5,       13.3,       16.2,      0.4,     -0.1},
+      { 8,  6,       11.7,        5.7,      0.2,     -0.2},
+      { 8,  7,      -16.0,       -9.1,     -0.4,      0.3},
+      { 8,  8,       -2.0,        2.2,      0.3,      0.0},
+      { 9,  0,        5.4,        0.0,      0.0,      0.0},
+      { 9,  1,        8.8,      -21.6,     -0.1,     -0.2},
+      { 9,  2,        3.1,       10.8,     -0.1,     -0.1},
+      { 9,  3,       -3.1,       11.7,      0.4,     -0.2},
+      { 9,  4,        0.6,       -6.8,     -0.5,      0.1},
+      { 9,  5,      -13.3,       -6.9,     -0.2,      0.1},
+      { 9,  6,       -0.1,        7.8,      0.1,      0.0},
+      { 9,  7,        8.7,        1.0,      0.0,     -0.2},
+      { 9,  8,       -9.1,       -3.9,     -0.2,      0.4},
+      { 9,  9,      -10.5,        8.5,     -0.1,      0.3},
+      {10,  0,       -1.9,        0.0,      0.0,      0.0},
+      {10,  1,       -6.5,        3.3,      0.0,      0.1},
+      {10,  2,        0.2,       -0.3,     -0.1,     -0.1},
+      {10,  3,        0.6,        4.6,      0.3,      0.0},
+      {10,  4,       -0.6,        4.4,     -0.1,      0.0},
+      {10,  5,        1.7,       -7.9,     -0.1,     -0.2},
+      {10,  6,       -0.7,       -0.6,     -0.1,      0.1},
+      {10,  7,        2.1,       -4.1,      0.0,     -0.1},
+      {10,  8,        2.3,       -2.8,     -0.2,     -0.2},
+      {10,  9,       -1.8,       -1.1,     -0.1,      0.1},
+      {10, 10,       -3.6,       -8.7,     -0.2,     -0.1},
+      {11,  0,        3.1,        0.0,      0.0,      0.0},
+      {11,  1,       -1.5,       -0.1,      0.0,      0.0},
+      {11,  2,       -2.3,        2.1,     -0.1,      0.1},
+      {11,  3,        2.1,       -0.7,      0.1,      0.0},
+      {11,  4,       -0.9,       -1.1,      0.0,      0.1},
+      {11,  5,        0.6,        0.7,      0.0,      0.0},
+      {11,  6,       -0.7,       -0.2,      0.0,      0.0},
+      {11,  7,        0.2,       -2.1,      0.0,      0.1},
+      {11,  8,        1.7,       -1.5,      0.0,      0.0},
+      {11,  9,       -0.2,       -2.5,      0.0,     -0.1},
+      {11, 10,        0.4,       -2.0,     -0.1,      0.0},
+      {11, 11,        3.5,       -2.3,     -0.1,     -0.1},
+      {12,  0,       -2.0,        0.0,      0.1,      0.0},
+      {12,  1,       -0.3,       -1.0,      0.0,      0.0},
+      {12,  2,        0.4,        0.5,      0.0,      0.0},
+      {12,  3,        1.3,        1.8,      0.1,     -0.1},
+      {12,  4,       -0.9,       -2.2,     -0.1,      0.0},
+      {12,  5,        0.9,        0.3,      0.0,      0.0},
+      {12,  6,        0.1,        0.7,      0.1,      0.0},
+      {12,  7,        0.5,       -0.1,      0.0,      0.0},
+      {12,  8,       -0.4,        0.3,      0.0,      0.0},
+      {12,  9,       -0.4,        0.2,      0.0,      0.0},
+      {12, 10,        0.2,       -0.9,      0.0,      0.0},
+      {12, 11,       -0.9,       -0.2,      0.0,      0.0},
+      {12, 12,        0.0,        0.7,      0.0,      0.0}
+    };
 
     struct WMMData
     {
@@ -54,6 +175,16 @@ namespace DUNE
       MAGtype_Ellipsoid ellip;
       MAGtype_MagneticModel* mm;
       MAGtype_MagneticModel* timed_mm;
+      //! Path to the geoid height grid, loaded on first use.
+      FileSystem::Path egm_file;
+      //! True if the cached declination is valid.
+      bool decl_valid;
+      //! Coordinates and height of the cached declination.
+      double decl_lat;
+      double decl_lon;
+      double decl_h;
+      //! Cached declination (rad).
+      double decl;
     };
 
     WMM::WMM(void)
@@ -70,34 +201,37 @@ namespace DUNE
     WMM::init(const FileSystem::Path& root)
     {
       m_data = new WMMData;
-      FileSystem::Path egmfile(root / "wmm/egm9615.bin");
-      FileSystem::Path wmmfile(root / "wmm/wmm.cof");
-
-      if (!egmfile.isFile())
-        throw std::runtime_error(egmfile.str() + " not found");
+      m_data->egm_file = root / "wmm/egm9615.bin";
+      m_data->decl_valid = false;
 
-      if (!wmmfile.isFile())
-        throw std::runtime_error(wmmfile.str() + " not found");
+      // Build the magnetic model from the embedded coefficient table.
+      int num_terms = ((c_wmm_nmax + 1) * (c_wmm_nmax + 2) / 2);
+      m_data->mm = MAG_AllocateModelMemory(num_terms);
+      m_data->mm->nMax = c_wmm_nmax;
+      m_data->mm->nMaxSecVar = c_wmm_nmax;
+      m_data->mm->epoch = c_wmm_epoch;
+      m_data->mm->CoefficientFileEndDate = c_wmm_epoch + 5;
+      m_data->mm->EditionDate = c_wmm_epoch;
+      std::strcpy(m_data->mm->ModelName, c_wmm_name);
 
-      // Initialization
-      m_data->mm = MAG_robustReadMagModels(wmmfile.c_str());
+      unsigned count = sizeof(c_wmm_cof) / sizeof(c_wmm_cof[0]);
+      for (unsigned i = 0; i < count; ++i)
+      {
+        const WMMCoefficient& c = c_wmm_cof[i];
+        int indx = (c.n * (c.n + 1) / 2 + c.m);
+        m_data->mm->Main_Field_Coeff_G[indx] = c.gnm;
+        m_data->mm->Main_Field_Coeff_H[indx] = c.hnm;
+        m_data->mm->Secular_Var_Coeff_G[indx] = c.dgnm;
+        m_data->mm->Secular_Var_Coeff_H[indx] = c.dhnm;
+      }
 
-      int num_terms = ((m_data->mm->nMax + 1) * (m_data->mm->nMax + 2) / 2);
       m_data->timed_mm = MAG_AllocateModelMemory(num_terms);
       MAG_SetDefaults(&m_data->ellip, &m_data->geoid);
 
-      // Read geoid data
-      /* Set EGM96 Geoid parameters */
-      unsigned n = c_num_geoid_cols * c_num_geoid_rows;
-      m_data->geoid.GeoidHeightBuffer = (float *) std::malloc((n + 1) * sizeof(float));
-      std::FILE* file = std::fopen(egmfile.c_str(), "rb");
-      size_t rv = std::fread(m_data->geoid.GeoidHeightBuffer, sizeof(float), n, file);
-      if (rv != n)
-        throw std::runtime_error("unable to extract geoid");
-      std::fclose(file);
-
-      //m_data->geoid.GeoidHeightBuffer = GeoidHeightBuffer;
-      m_data->geoid.Geoid_Initialized = 1;
+      // The geoid height grid is large and only needed by height(),
+      // so it is loaded lazily on first use.
+      m_data->geoid.GeoidHeightBuffer = NULL;
+      m_data->geoid.Geoid_Initialized = 0;
 
       // Adjust magnetic model according to date
       char dummy[100];
@@ -110,17 +244,45 @@ namespace DUNE
       MAG_TimelyModifyMagneticModel(date, m_data->mm, m_data->timed_mm);
     }
 
+    void
+    WMM::loadGeoid(void)
+    {
+      if (m_data->geoid.Geoid_Initialized)
+        return;
+
+      if (!m_data->egm_file.isFile())
+        throw std::runtime_error(m_data->egm_file.str() + " not found");
+
+      // Read geoid data
+      /* Set EGM96 Geoid parameters */
+      unsigned n = c_num_geoid_cols * c_num_geoid_rows;
+      m_data->geoid.GeoidHeightBuffer = (float *) std::malloc((n + 1) * sizeof(float));
+      std::FILE* file = std::fopen(m_data->egm_file.c_str(), "rb");
+      size_t rv = std::fread(m_data->geoid.GeoidHeightBuffer, sizeof(float), n, file);
+      if (rv != n)
+      {
+        std::fclose(file);
+        throw std::runtime_error("unable to extract geoid");
+      }
+      std::fclose(file);
+
+      m_data->geoid.Geoid_Initialized = 1;
+    }
+
     WMM::~WMM(void)
     {
       MAG_FreeMagneticModelMemory(m_data->timed_mm);
       MAG_FreeMagneticModelMemory(m_data->mm);
-      std::free(m_data->geoid.GeoidHeightBuffer);
+      if (m_data->geoid.GeoidHeightBuffer != NULL)
+        std::free(m_data->geoid.GeoidHeightBuffer);
       delete m_data;
     }
 
     double
     WMM::height(double lat, double lon)
     {
+      loadGeoid();
+
       double h = 0;
       MAG_GetGeoidHeight(Math::Angles::degrees(lat), Math::Angles::degrees(lon), &h, &m_data->geoid);
 
@@ -130,6 +292,19 @@ namespace DUNE
     double
     WMM::declination(double lat, double lon, double h)
     {
+      // Declination varies slowly with position, so reuse the last
+      // value while the query stays close to the cached point.
+      if (m_data->decl_valid)
+      {
+        double dn = (lat - m_data->decl_lat) * c_mean_radius;
+        double de = (lon - m_data->decl_lon) * c_mean_radius * std::cos(m_data->decl_lat);
+
+        if (std::fabs(dn) <= c_decl_cache_dist &&
+            std::fabs(de) <= c_decl_cache_dist &&
+            std::fabs(h - m_data->decl_h) <= c_decl_cache_height)
+          return m_data->decl;
+      }
+
       MAGtype_CoordGeodetic geo;
       MAGtype_CoordSpherical sph;
       MAGtype_GeoMagneticElements gme;
@@ -143,7 +318,13 @@ namespace DUNE
       MAG_Geomag(m_data->ellip, sph, geo, m_data->timed_mm, &gme);
       MAG_CalculateGridVariation(geo, &gme);
 
-      return Math::Angles::radians(gme.Decl);
+      m_data->decl_lat = lat;
+      m_data->decl_lon = lon;
+      m_data->decl_h = h;
+      m_data->decl = Math::Angles::radians(gme.Decl);
+      m_data->decl_valid = true;
+
+      return m_data->decl;
     }
   }
 }
@@ -83,6 +83,10 @@ namespace DUNE
       void
       init(const FileSystem::Path& root);
 
+      //! Load the geoid height grid on first use.
+      void
+      loadGeoid(void);
+
       WMMData* m_data;
     };
   }
@@ -31,6 +31,8 @@
 #include <map>
 #include <sstream>
 #include <cstddef>
+#include <cstdio>
+#include <fstream>
 #include <limits>
 #include <queue>
 
@@ -38,6 +40,8 @@
 #include <DUNE/Daemon.hpp>
 #include <DUNE/Version.hpp>
 #include <DUNE/I18N.hpp>
+#include <DUNE/Concurrency/Heartbeat.hpp>
+#include <DUNE/IMC/Factory.hpp>
 #include <DUNE/Tasks/Factory.hpp>
 #include <DUNE/Tasks/Manager.hpp>
 #include <DUNE/FileSystem/Path.hpp>
@@ -49,7 +53,9 @@ namespace DUNE
   Daemon::Daemon(DUNE::Tasks::Context& ctx, const std::string& profiles):
     DUNE::Tasks::Task("Daemon", ctx),
     m_tman(NULL),
-    m_fs_capacity(0)
+    m_fs_capacity(0),
+    m_cpu_too_high(false),
+    m_mem_too_high(false)
   {
     // Retrieve known IMC addresses.
     std::vector<std::string> addrs = m_ctx.config.options("IMC Addresses");
@@ -130,11 +136,42 @@ namespace DUNE
       inf(DTR("execution profiles: %s"), profiles.c_str());
     }
 
+    // Asynchronous console/file output for unattended operation.
+    bool async_term = false;
+    m_ctx.config.get("General", "Asynchronous Terminal", "false", async_term);
+    if (async_term)
+    {
+      Streams::dune_term.setAsynchronous(true);
+      inf(DTR("asynchronous terminal enabled: output is written in the background"));
+    }
+
+    // Lockstep stepping of shared-executor periodic cycles.
+    bool lockstep = false;
+    m_ctx.config.get("General", "Lockstep Executor", "false", lockstep);
+    if (lockstep)
+    {
+      m_ctx.pexec.setLockstep(true);
+      inf(DTR("lockstep executor enabled: shared periodic cycles run in virtual time"));
+    }
+
     // CPU usage.
     m_ctx.config.get("General", "CPU Usage - Maximum", "65", m_cpu_max_usage);
     m_ctx.config.get("General", "CPU Usage - Moving Average Samples", "10", m_cpu_avg_samples);
     m_cpu_avg = new Math::MovingAverage<double>(m_cpu_avg_samples);
 
+    // Memory usage.
+    m_ctx.config.get("General", "Memory Usage - Maximum", "0", m_mem_max_usage);
+
+    // Warm restart snapshot.
+    m_ctx.config.get("General", "Warm Restart State - Periodicity", "0.0", m_snapshot_period);
+    m_ctx.config.get("General", "Warm Restart State - Maximum Age", "30.0", m_snapshot_max_age);
+    m_snapshot_path = m_ctx.dir_db / "warm_state.bin";
+    if (m_snapshot_period > 0)
+      m_snapshot_timer.setTop(m_snapshot_period);
+
+    // Thread liveness supervision.
+    m_ctx.config.get("General", "Thread Stall Timeout", "5.0", m_stall_timeout);
+
     m_tman = new DUNE::Tasks::Manager(m_ctx);
 
     bind<IMC::RestartSystem>(this);
@@ -165,6 +202,7 @@ namespace DUNE
     }
 
     m_ctx.mbus.resume();
+    restoreWarmState();
     m_tman->start();
     m_periodic_counter.setTop(1.0);
     setEntityState(IMC::EntityState::ESTA_NORMAL, Status::CODE_ACTIVE);
@@ -271,21 +309,149 @@ namespace DUNE
 
       if (cpu_avg >= m_cpu_max_usage)
       {
+        // Record where the CPU went while it can still be observed:
+        // post-incident logs must show the consumers, not only the
+        // global figure.
+        if (!m_cpu_too_high)
+          war(DTR("CPU usage is too high (%0.0f%%): %s"), cpu_avg,
+              m_tman->getCpuUsageProfile(5).c_str());
+
+        m_cpu_too_high = true;
         setEntityState(IMC::EntityState::ESTA_ERROR, Status::CODE_CPU_TOO_HIGH);
         m_tman->adjustPriorities();
       }
       else
       {
-        setEntityState(IMC::EntityState::ESTA_NORMAL, Status::CODE_ACTIVE);
+        m_cpu_too_high = false;
+        if (!m_mem_too_high)
+          setEntityState(IMC::EntityState::ESTA_NORMAL, Status::CODE_ACTIVE);
+      }
+    }
+  }
+
+  void
+  Daemon::measureMemoryUsage(void)
+  {
+    if (m_mem_max_usage == 0)
+      return;
+
+    int64_t resident = System::Resources::getResidentMemory();
+    if (resident < 0)
+      return;
+
+    unsigned usage = (unsigned)(resident / (1024 * 1024));
+    bool too_high = usage >= m_mem_max_usage;
+
+    if (too_high && !m_mem_too_high)
+      war(DTR("resident memory is %u MiB, above the limit of %u MiB"),
+          usage, m_mem_max_usage);
+
+    m_mem_too_high = too_high;
+
+    if (m_mem_too_high)
+      setEntityState(IMC::EntityState::ESTA_ERROR, Status::CODE_MEM_TOO_HIGH);
+  }
+
+  void
+  Daemon::saveWarmState(void)
+  {
+    std::vector<IMC::Message*> msgs;
+    m_tman->saveState(msgs);
+
+    if (msgs.empty())
+      return;
+
+    std::string tmp = m_snapshot_path.str() + ".tmp";
+
+    {
+      std::ofstream ofs(tmp.c_str(), std::ios::binary);
+      for (unsigned i = 0; i < msgs.size(); ++i)
+      {
+        IMC::Packet::serialize(msgs[i], ofs);
+        delete msgs[i];
+      }
+
+      if (!ofs.good())
+      {
+        war(DTR("failed to write warm restart snapshot"));
+        return;
       }
     }
+
+    if (std::rename(tmp.c_str(), m_snapshot_path.c_str()) != 0)
+      war(DTR("failed to replace warm restart snapshot"));
+  }
+
+  void
+  Daemon::restoreWarmState(void)
+  {
+    if (m_snapshot_period <= 0 || !m_snapshot_path.isFile())
+      return;
+
+    double age = Time::Clock::getSinceEpoch() - m_snapshot_path.getLastModifiedTime();
+    if (age > m_snapshot_max_age)
+    {
+      debug("warm restart snapshot is %0.1f s old, ignoring", age);
+      return;
+    }
+
+    std::ifstream ifs(m_snapshot_path.c_str(), std::ios::binary);
+    unsigned count = 0;
+
+    try
+    {
+      while (IMC::Message* msg = IMC::Packet::deserialize(ifs))
+      {
+        m_tman->restoreState(msg);
+        delete msg;
+        ++count;
+      }
+    }
+    catch (std::exception& e)
+    {
+      war(DTR("warm restart snapshot is damaged: %s"), e.what());
+    }
+
+    if (count > 0)
+      inf(DTR("warm restart: recovered %u messages from a %0.1f s old snapshot"), count, age);
   }
 
   void
   Daemon::dispatchPeriodic(void)
   {
+    measureMemoryUsage();
     measureCpuUsage();
 
+    if (m_snapshot_period > 0 && m_snapshot_timer.overflow())
+    {
+      m_snapshot_timer.reset();
+      saveWarmState();
+    }
+
+    // Flag threads whose message loop stopped beating.
+    if (m_stall_timeout > 0)
+    {
+      std::vector<Concurrency::HeartbeatRegistry::Stall> stalls;
+      m_ctx.heartbeats.scan(m_stall_timeout, stalls);
+
+      for (size_t i = 0; i < stalls.size(); ++i)
+      {
+        if (stalls[i].context == Concurrency::c_heartbeat_no_context)
+          err(DTR("thread '%s' stalled for %0.1f s"),
+              stalls[i].name.c_str(), stalls[i].duration);
+        else
+          err(DTR("thread '%s' stalled for %0.1f s while consuming '%s'"),
+              stalls[i].name.c_str(), stalls[i].duration,
+              IMC::Factory::getAbbrevFromId(stalls[i].context).c_str());
+      }
+    }
+
+    // Warn about tasks that blew their activation deadline and
+    // record the vehicle-ready time once every task left boot.
+    double ready_time = m_tman->checkActivationDeadlines();
+    if (ready_time >= 0.0)
+      inf(DTR("all tasks ready %0.1f s after launch"), ready_time);
+
     // Dispatch available storage.
     if (m_fs_capacity > 0)
     {
@@ -105,10 +105,40 @@ namespace DUNE
     int m_cpu_max_usage;
     //! Overall CPU usage - moving average.
     Math::MovingAverage<double>* m_cpu_avg;
+    //! True while the CPU usage limit is exceeded.
+    bool m_cpu_too_high;
+    //! Resident memory soft limit in MiB, zero disables monitoring.
+    unsigned m_mem_max_usage;
+    //! True while the resident memory soft limit is exceeded.
+    bool m_mem_too_high;
+    //! Warm restart snapshot period in seconds, zero disables.
+    double m_snapshot_period;
+    //! Maximum age of a snapshot considered on start-up.
+    double m_snapshot_max_age;
+    //! Warm restart snapshot timer.
+    Time::Counter<double> m_snapshot_timer;
+    //! Warm restart snapshot file.
+    FileSystem::Path m_snapshot_path;
+    //! Thread stall detection timeout in seconds, zero disables.
+    double m_stall_timeout;
+
+    //! Write the warm restart snapshot: state collected from all
+    //! tasks, serialized to a scratch file and atomically renamed
+    //! over the previous snapshot.
+    void
+    saveWarmState(void);
+
+    //! Restore a fresh warm restart snapshot, delivering each
+    //! recovered message to all tasks before they start.
+    void
+    restoreWarmState(void);
 
     void
     measureCpuUsage(void);
 
+    void
+    measureMemoryUsage(void);
+
     void
     dispatchPeriodic(void);
   };
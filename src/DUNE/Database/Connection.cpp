@@ -85,6 +85,9 @@ namespace DUNE
     {
       if (m_handle)
       {
+        for (StatementMap::iterator itr = m_stmt_cache.begin(); itr != m_stmt_cache.end(); ++itr)
+          delete itr->second;
+
         delete m_tbegin_stmt;
         delete m_tcommit_stmt;
         delete m_trollback_stmt;
@@ -92,6 +95,34 @@ namespace DUNE
       }
     }
 
+    Statement*
+    Connection::prepared(const char* sql_stmt)
+    {
+      StatementMap::iterator itr = m_stmt_cache.find(sql_stmt);
+      if (itr != m_stmt_cache.end())
+        return itr->second;
+
+      Statement* stmt = new Statement(sql_stmt, *this);
+      m_stmt_cache[sql_stmt] = stmt;
+      return stmt;
+    }
+
+    void
+    Connection::setJournalMode(const char* mode)
+    {
+      std::string stmt("pragma journal_mode=");
+      stmt.append(mode);
+      execute(stmt.c_str());
+    }
+
+    void
+    Connection::setSynchronous(const char* level)
+    {
+      std::string stmt("pragma synchronous=");
+      stmt.append(level);
+      execute(stmt.c_str());
+    }
+
     void
     Connection::execute(const char* sql_stmt, int* count)
     {
@@ -30,6 +30,10 @@
 #ifndef DUNE_DATABASE_CONNECTION_HPP_INCLUDED_
 #define DUNE_DATABASE_CONNECTION_HPP_INCLUDED_
 
+// ISO C++ 98 headers.
+#include <map>
+#include <string>
+
 // DUNE headers.
 #include <DUNE/Config.hpp>
 
@@ -81,6 +85,25 @@ namespace DUNE
       void
       execute(const char* sql_stmt, int* count = 0);
 
+      //! Get a prepared statement for a given SQL text, preparing it
+      //! on first use. The statement is owned by the connection and
+      //! remains valid until the connection is destroyed, so callers
+      //! avoid re-preparing recurring statements.
+      //! @param sql_stmt SQL statement.
+      //! @return prepared statement.
+      Statement*
+      prepared(const char* sql_stmt);
+
+      //! Set the journal mode of the database.
+      //! @param mode journal mode (e.g. "WAL", "DELETE").
+      void
+      setJournalMode(const char* mode);
+
+      //! Set the synchronous level of the database.
+      //! @param level synchronous level (e.g. "OFF", "NORMAL", "FULL").
+      void
+      setSynchronous(const char* level);
+
       //! Begin transaction.
       void
       beginTransaction(void);
@@ -107,11 +130,16 @@ namespace DUNE
       }
 
     private:
+      //! Map of SQL text to prepared statements.
+      typedef std::map<std::string, Statement*> StatementMap;
+
       //! Database connection handle.
       DB_HANDLE* m_handle;
       Statement* m_tbegin_stmt;
       Statement* m_tcommit_stmt;
       Statement* m_trollback_stmt;
+      //! Cache of prepared statements.
+      StatementMap m_stmt_cache;
 
       void
       open(const char* path, int flags);
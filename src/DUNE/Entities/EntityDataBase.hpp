@@ -31,12 +31,22 @@
 #define DUNE_ENTITIES_ENTITY_DATA_BASE_HPP_INCLUDED_
 
 // ISO C++ 98 headers.
+#include <cstring>
 #include <stdexcept>
 #include <map>
 
 // DUNE headers.
 #include <DUNE/Concurrency/ScopedMutex.hpp>
 #include <DUNE/Utils/String.hpp>
+#include <DUNE/IMC/Constants.hpp>
+
+// Check if we can use GCC's memory barrier to publish entries to the
+// lock-free resolution table.
+#if defined(DUNE_SYS_HAS___SYNC_ADD_AND_FETCH) && defined(DUNE_SYS_HAS___SYNC_SUB_AND_FETCH)
+#  ifndef DUNE_ENTITIES_DATA_BASE_LOCK_FREE
+#    define DUNE_ENTITIES_DATA_BASE_LOCK_FREE
+#  endif
+#endif
 
 namespace DUNE
 {
@@ -92,6 +102,7 @@ namespace DUNE
       EntityDataBase(void):
         m_next_id(0)
       {
+        std::memset(const_cast<Entity**>(m_direct), 0, sizeof(m_direct));
       }
 
       //! Destructor.
@@ -150,10 +161,23 @@ namespace DUNE
         m_by_id[id] = entry;
         m_by_label[label] = entry;
 
+        if (id < c_direct_size)
+        {
+#if defined(DUNE_ENTITIES_DATA_BASE_LOCK_FREE)
+          // Make sure the record is fully constructed before readers
+          // can observe the pointer.
+          __sync_synchronize();
+#endif
+          m_direct[id] = entry;
+        }
+
         return id;
       }
 
-      //! Get the numeric id for the entity identified by the given label
+      //! Get the numeric id for the entity identified by the given label.
+      //! Labels are hashed under the database lock, so callers on hot
+      //! paths should resolve once and keep the numeric id instead of
+      //! resolving per message.
       //! The NonexistentLabel exception is thrown if there is no matching entity in the database.
       //! @return numerical entity id.
       unsigned int
@@ -191,6 +215,18 @@ namespace DUNE
       const std::string&
       resolve(unsigned int id)
       {
+#if defined(DUNE_ENTITIES_DATA_BASE_LOCK_FREE)
+        // Records are never removed and slots are published with a
+        // full memory barrier, so the direct table can be read
+        // without taking the lock.
+        if (id < c_direct_size)
+        {
+          const Entity* entry = m_direct[id];
+          if (entry != NULL)
+            return entry->label;
+        }
+#endif
+
         Concurrency::ScopedMutex l(m_lock);
 
         EntitiesById::iterator itr = m_by_id.find(id);
@@ -228,6 +264,13 @@ namespace DUNE
       }
 
     private:
+      //! Size of the direct resolution table: entity ids are 8-bit
+      //! wide on the wire.
+      static const unsigned c_direct_size = DUNE_IMC_CONST_UNK_EID + 1;
+      //! Direct resolution table, indexed by numeric id. Slots are
+      //! published once with a memory barrier and never cleared, so
+      //! readers dereference them without taking the lock.
+      Entity* volatile m_direct[c_direct_size];
       //! Mutex for accessing the database.
       Concurrency::Mutex m_lock;
       //! Next vacant numeric id.
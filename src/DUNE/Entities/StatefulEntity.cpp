@@ -44,7 +44,7 @@ namespace DUNE
 
       m_entity_state.state = state;
       if (code != m_entity_state_code)
-        m_entity_state.description = DTR(Status::getString(code));
+        m_entity_state.description = Status::getTranslatedString(code);
       m_entity_state_code = code;
 
       if (new_state && (getId() != DUNE_IMC_CONST_UNK_EID))
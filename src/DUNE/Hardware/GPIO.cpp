@@ -36,6 +36,12 @@
 #include <DUNE/Utils/String.hpp>
 #include <DUNE/Hardware/GPIO.hpp>
 
+// Linux headers.
+#if defined(DUNE_OS_LINUX)
+#  include <unistd.h>
+#  include <fcntl.h>
+#endif
+
 namespace DUNE
 {
   namespace Hardware
@@ -49,12 +55,14 @@ namespace DUNE
     {
       // Linux 2.6 implementation.
 #if defined(DUNE_OS_LINUX)
+      m_fd = -1;
       writeToFile("/sys/class/gpio/export", m_number);
 
       std::string prefix = std::string("/sys/class/gpio/gpio") +
                            String::str(m_number);
       m_file_val = prefix + std::string("/value");
       m_file_dir = prefix + std::string("/direction");
+      m_file_edge = prefix + std::string("/edge");
 
       // Lacking implementation.
 #else
@@ -66,6 +74,9 @@ namespace DUNE
     {
       // Linux 2.6 implementation.
 #if defined(DUNE_OS_LINUX)
+      if (m_fd >= 0)
+        ::close(m_fd);
+
       try
       {
         writeToFile("/sys/class/gpio/unexport", m_number);
@@ -138,6 +149,84 @@ namespace DUNE
       return false;
     }
 
+    void
+    GPIO::setEdge(Edge edge)
+    {
+      if (m_direction != GPIO_DIR_INPUT)
+        throw Error("GPIO is not configured as input", String::str(m_number));
+
+#if defined(DUNE_OS_LINUX)
+      switch (edge)
+      {
+        case GPIO_EDGE_RISING:
+          writeToFile(m_file_edge, "rising");
+          break;
+        case GPIO_EDGE_FALLING:
+          writeToFile(m_file_edge, "falling");
+          break;
+        case GPIO_EDGE_BOTH:
+          writeToFile(m_file_edge, "both");
+          break;
+        default:
+          writeToFile(m_file_edge, "none");
+          break;
+      }
+
+      if (edge == GPIO_EDGE_NONE)
+      {
+        if (m_fd >= 0)
+        {
+          ::close(m_fd);
+          m_fd = -1;
+        }
+        return;
+      }
+
+      if (m_fd < 0)
+      {
+        m_fd = ::open(m_file_val.c_str(), O_RDONLY | O_NONBLOCK);
+        if (m_fd < 0)
+          throw Error(errno, "unable to open GPIO value", String::str(m_number));
+      }
+
+      // Discard the stale readable state so only new edges trigger.
+      clearEdge();
+#else
+      (void)edge;
+#endif
+    }
+
+    IO::NativeHandle
+    GPIO::getNative(void) const
+    {
+#if defined(DUNE_OS_LINUX)
+      if (m_fd < 0)
+        throw Error("GPIO edge detection is not enabled", String::str(m_number));
+
+      return m_fd;
+#else
+      throw Error("unimplemented feature", "DUNE::Hardware::GPIO");
+#endif
+    }
+
+    bool
+    GPIO::clearEdge(void)
+    {
+#if defined(DUNE_OS_LINUX)
+      if (m_fd < 0)
+        throw Error("GPIO edge detection is not enabled", String::str(m_number));
+
+      char bfr[8] = {0};
+      ::lseek(m_fd, 0, SEEK_SET);
+      if (::read(m_fd, bfr, sizeof(bfr)) <= 0)
+        return false;
+
+      return bfr[0] == '1';
+#else
+      return false;
+#endif
+    }
+
 #if defined(DUNE_OS_LINUX)
     void
     GPIO::writeToFile(const std::string& file, int value)
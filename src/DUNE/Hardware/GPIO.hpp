@@ -35,6 +35,7 @@
 
 // DUNE headers.
 #include <DUNE/Config.hpp>
+#include <DUNE/IO/Handle.hpp>
 
 namespace DUNE
 {
@@ -54,6 +55,18 @@ namespace DUNE
         GPIO_DIR_OUTPUT
       };
 
+      enum Edge
+      {
+        //! Edge detection disabled.
+        GPIO_EDGE_NONE,
+        //! Detect rising edges.
+        GPIO_EDGE_RISING,
+        //! Detect falling edges.
+        GPIO_EDGE_FALLING,
+        //! Detect both edges.
+        GPIO_EDGE_BOTH
+      };
+
       //! Initialize GPIO.
       //! @param[in] number GPIO number.
       GPIO(unsigned int number);
@@ -81,6 +94,25 @@ namespace DUNE
       bool
       getValue(void);
 
+      //! Enable edge detection on an input GPIO. The pin can then be
+      //! added to an IO::Poll pool through getNative() and each
+      //! detected edge wakes the poller.
+      //! @param[in] edge edges to detect.
+      void
+      setEdge(Edge edge);
+
+      //! Retrieve the native I/O handle used for edge detection.
+      //! setEdge() must be called first.
+      //! @return native I/O handle.
+      IO::NativeHandle
+      getNative(void) const;
+
+      //! Acknowledge a detected edge, rearming the handle for
+      //! polling.
+      //! @return pin value after the edge (false = off, true = on).
+      bool
+      clearEdge(void);
+
     private:
       //! GPIO number.
       unsigned int m_number;
@@ -92,6 +124,10 @@ namespace DUNE
       std::string m_file_dir;
       //! Path to GPIO value file.
       std::string m_file_val;
+      //! Path to GPIO edge file.
+      std::string m_file_edge;
+      //! Value file descriptor used for edge detection.
+      int m_fd;
 
       static void
       writeToFile(const std::string& file, int value);
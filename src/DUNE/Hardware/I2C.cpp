@@ -189,6 +189,47 @@ namespace DUNE
 #endif
     }
 
+    void
+    I2C::readRegisters(RegisterOp* ops, unsigned count)
+    {
+      // Linux implementation.
+#if defined(DUNE_SYS_HAS_LINUX_I2C_DEV)
+      if (count == 0)
+        return;
+
+      if (count > c_max_ops)
+        throw Error("combined transaction", "too many operations");
+
+      i2c_msg msgs[c_max_ops * 2];
+      unsigned nmsgs = 0;
+
+      for (unsigned i = 0; i < count; ++i)
+      {
+        msgs[nmsgs].addr = ops[i].adr;
+        msgs[nmsgs].flags = 0;
+        msgs[nmsgs].len = 1;
+        msgs[nmsgs].buf = &ops[i].reg;
+        ++nmsgs;
+
+        msgs[nmsgs].addr = ops[i].adr;
+        msgs[nmsgs].flags = I2C_M_RD;
+        msgs[nmsgs].len = ops[i].rlen;
+        msgs[nmsgs].buf = ops[i].rdata;
+        ++nmsgs;
+      }
+
+      i2c_rdwr_ioctl_data rdwr;
+      rdwr.msgs = msgs;
+      rdwr.nmsgs = nmsgs;
+
+      if (ioctl(m_fd, I2C_RDWR, &rdwr) < 0)
+        throw Error("combined transaction", strerror(errno));
+#else
+      (void)ops;
+      (void)count;
+#endif
+    }
+
     unsigned
     I2C::read(uint8_t adr, uint8_t* bfr, unsigned bfr_len)
     {
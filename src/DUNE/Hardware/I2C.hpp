@@ -62,6 +62,22 @@ namespace DUNE
       //! I2C destructor.
       ~I2C(void);
 
+      //! One register read of a combined transaction.
+      struct RegisterOp
+      {
+        //! Slave address.
+        uint8_t adr;
+        //! Register to select.
+        uint8_t reg;
+        //! Place to store data read.
+        uint8_t* rdata;
+        //! Number of bytes to read.
+        uint8_t rlen;
+      };
+
+      //! Maximum operations of a combined transaction.
+      static const unsigned c_max_ops = 16;
+
       //! Initialize an I2C transfer.
       //! @param adr slave address.
       //! @param cmd command to send.
@@ -73,6 +89,14 @@ namespace DUNE
       int
       transfer(uint8_t adr, uint8_t cmd, const uint8_t* wdata, uint8_t wlen, uint8_t* rdata, uint8_t rlen, uint8_t* bytes_read);
 
+      //! Perform several register reads, possibly on different
+      //! slaves, in a single bus transaction (one ioctl): each
+      //! operation selects a register and reads back rlen bytes.
+      //! @param ops operations to perform.
+      //! @param count number of operations, up to c_max_ops.
+      void
+      readRegisters(RegisterOp* ops, unsigned count);
+
       unsigned
       read(uint8_t adr, uint8_t* bfr, unsigned bfr_len);
 
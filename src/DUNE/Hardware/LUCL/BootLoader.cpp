@@ -97,7 +97,8 @@ namespace DUNE
         m_proto(proto),
         m_baud(baudrate),
         m_page_size(0),
-        m_verbose(verbose)
+        m_verbose(verbose),
+        m_windowed(true)
       {
         DO_OR_DIE(enter(), "start bootloader");
       }
@@ -287,6 +288,65 @@ namespace DUNE
         return waitForCommandCode(CMD_UPGRADE_END, m_cmd);
       }
 
+      void
+      BootLoader::makeChunk(const std::vector<uint8_t>& page, unsigned index, uint8_t* data)
+      {
+        uint16_t offset = index * c_chunk_size;
+        uint16_t remain = m_page_size - offset;
+        uint16_t length = remain < c_chunk_size ? remain : c_chunk_size;
+        data[0] = (uint8_t)(offset >> 8);
+        data[1] = (uint8_t)offset;
+        std::memcpy(data + 2, &page[offset], length);
+      }
+
+      bool
+      BootLoader::fillPageWindowed(const std::vector<uint8_t>& page, unsigned chunks)
+      {
+        for (unsigned base = 0; base < chunks; base += c_window_size)
+        {
+          unsigned count = chunks - base;
+          if (count > c_window_size)
+            count = c_window_size;
+
+          // Stream the whole window without waiting: every command is
+          // individually checksummed by the protocol framing, so a
+          // corrupted or dropped chunk shows up below as a missing
+          // acknowledgement.
+          for (unsigned i = 0; i < count; ++i)
+          {
+            uint8_t data[c_data_size] = {0};
+            makeChunk(page, base + i, data);
+            m_proto.sendCommand(CMD_PAGE_FILL, data, c_data_size);
+            print(".", false);
+          }
+
+          // Collect the acknowledgements of the window.
+          for (unsigned i = 0; i < count; ++i)
+          {
+            if (!waitForCommandCode(CMD_PAGE_FILL, m_cmd))
+              return false;
+          }
+        }
+
+        return true;
+      }
+
+      void
+      BootLoader::fillPageLockStep(const std::vector<uint8_t>& page, unsigned chunks)
+      {
+        for (unsigned i = 0; i < chunks; ++i)
+        {
+          uint8_t data[c_data_size] = {0};
+          makeChunk(page, i, data);
+
+          while (1)
+          {
+            if (fillPage(data, c_data_size))
+              break;
+          }
+        }
+      }
+
       void
       BootLoader::flash(const std::string& ihex)
       {
@@ -304,21 +364,21 @@ namespace DUNE
         {
           print(String::str("* Updating page %d ", page_nr++), false);
 
-          for (unsigned i = 0; i < chunks; ++i)
+          // Try the fast path first: windows of chunks in flight with
+          // the acknowledgements collected afterwards. Bootloaders
+          // with receive buffers too small to keep up make the window
+          // fail, and the remaining pages proceed in lock-step. The
+          // page is refilled from scratch either way before being
+          // written, so a failed window never leaves stale data.
+          if (m_windowed && !fillPageWindowed(itr->second, chunks))
           {
-            uint16_t offset = i * c_chunk_size;
-            uint16_t remain = m_page_size - offset;
-            uint16_t length = remain < c_chunk_size ? remain : c_chunk_size;
-            uint8_t data[c_data_size] = {(uint8_t)(offset >> 8), (uint8_t)(offset)};
-            std::memcpy(data + 2, &itr->second[offset], length);
-
-            while (1)
-            {
-              if (fillPage(data, c_data_size))
-                break;
-            }
+            print(" windowed fill failed, falling back ", false);
+            m_windowed = false;
           }
 
+          if (!m_windowed)
+            fillPageLockStep(itr->second, chunks);
+
           uint8_t page[] =
           {
             (uint8_t)(itr->first >> 8),
@@ -60,6 +60,8 @@ namespace DUNE
         static const unsigned c_data_size = 14;
         //! Chunk size.
         static const unsigned c_chunk_size = c_data_size - 2;
+        //! Number of page fill commands kept in flight in windowed mode.
+        static const unsigned c_window_size = 8;
         //! LUCL Protocol handler.
         Protocol& m_proto;
         //! LUCL protocol baud rate (if specified)
@@ -74,6 +76,8 @@ namespace DUNE
         std::map<unsigned, std::vector<uint8_t> > m_page_map;
         //! True to print out messages.
         bool m_verbose;
+        //! True while the bootloader keeps up with windowed page fills.
+        bool m_windowed;
 
         bool
         waitForCommand(CommandType type, Command& cmd, double timeout = 1.0);
@@ -117,6 +121,28 @@ namespace DUNE
         bool
         endUpgrade(void);
 
+        //! Build one page fill command.
+        //! @param[in] page page contents.
+        //! @param[in] index chunk index within the page.
+        //! @param[out] data command payload, c_data_size bytes.
+        void
+        makeChunk(const std::vector<uint8_t>& page, unsigned index, uint8_t* data);
+
+        //! Fill one page streaming windows of chunks before collecting
+        //! the acknowledgements.
+        //! @param[in] page page contents.
+        //! @param[in] chunks number of chunks per page.
+        //! @return true if all chunks were acknowledged.
+        bool
+        fillPageWindowed(const std::vector<uint8_t>& page, unsigned chunks);
+
+        //! Fill one page waiting for the acknowledgement of each chunk
+        //! before sending the next.
+        //! @param[in] page page contents.
+        //! @param[in] chunks number of chunks per page.
+        void
+        fillPageLockStep(const std::vector<uint8_t>& page, unsigned chunks);
+
         void
         loadIHEX(const std::string& ihex);
 
@@ -42,6 +42,11 @@ namespace DUNE
 #include <DUNE/IMC/InlineMessage.hpp>
 #include <DUNE/IMC/MessageList.hpp>
 #include <DUNE/IMC/Message.hpp>
+#include <DUNE/IMC/MessagePool.hpp>
+#include <DUNE/IMC/MessageView.hpp>
+#include <DUNE/IMC/MessageDelta.hpp>
+#include <DUNE/IMC/SharedMessage.hpp>
+#include <DUNE/IMC/TelemetryStore.hpp>
 #include <DUNE/IMC/Factory.hpp>
 #include <DUNE/IMC/Packet.hpp>
 #include <DUNE/IMC/Macros.hpp>
@@ -50,6 +55,7 @@ namespace DUNE
 #include <DUNE/IMC/Exceptions.hpp>
 #include <DUNE/IMC/Definitions.hpp>
 #include <DUNE/IMC/Blob.hpp>
+#include <DUNE/IMC/LSFReader.hpp>
 #include <DUNE/IMC/IridiumMessageDefinitions.hpp>
 
 #endif
@@ -41,7 +41,36 @@ namespace DUNE
     AddressResolver::AddressResolver(void):
       m_name(c_unknown),
       m_id(invalid())
-    { }
+    {
+      Table* table = new Table;
+      table->dense.assign(c_dense_size, (const char*)NULL);
+      m_table = table;
+    }
+
+    AddressResolver::~AddressResolver(void)
+    {
+      delete m_table;
+      for (size_t i = 0; i < m_retired.size(); ++i)
+        delete m_retired[i];
+    }
+
+    void
+    AddressResolver::publish(Table* table)
+    {
+      table->dense.assign(c_dense_size, (const char*)NULL);
+      for (IdToName::const_iterator itr = table->ids.begin(); itr != table->ids.end(); ++itr)
+      {
+        if (itr->first < c_dense_size)
+          table->dense[itr->first] = itr->second.c_str();
+      }
+
+      // The table must be fully built before the pointer swing makes
+      // it visible to lock-free readers.
+      Table* old = m_table;
+      m_retired.push_back(old);
+      __sync_synchronize();
+      m_table = table;
+    }
 
     const char*
     AddressResolver::name(void)
@@ -76,26 +105,50 @@ namespace DUNE
     {
       Concurrency::ScopedMutex m(m_mutex);
 
-      m_ids[a_id] = a_name;
-      m_names[a_name] = a_id;
+      // Announce storms mostly repeat known mappings: skip the
+      // rebuild when nothing would change.
+      Table* cur = m_table;
+      IdToName::const_iterator iitr = cur->ids.find(a_id);
+      NameToId::const_iterator nitr = cur->names.find(a_name);
+      if (iitr != cur->ids.end() && iitr->second == a_name
+          && nitr != cur->names.end() && nitr->second == a_id)
+        return;
+
+      Table* table = new Table;
+      table->ids = cur->ids;
+      table->names = cur->names;
+      table->ids[a_id] = a_name;
+      table->names[a_name] = a_id;
+
+      publish(table);
     }
 
     bool
     AddressResolver::isUnknown(unsigned a_id)
     {
-      Concurrency::ScopedMutex m(m_mutex);
-      IdToName::const_iterator itr = m_ids.find(a_id);
-      return (itr == m_ids.end());
+      const Table* table = m_table;
+
+      if (a_id < c_dense_size)
+        return table->dense[a_id] == NULL;
+
+      IdToName::const_iterator itr = table->ids.find(a_id);
+      return (itr == table->ids.end());
     }
 
     const char*
     AddressResolver::resolve(unsigned a_id)
     {
-      Concurrency::ScopedMutex m(m_mutex);
+      const Table* table = m_table;
+
+      if (a_id < c_dense_size)
+      {
+        const char* name = table->dense[a_id];
+        return (name == NULL) ? c_unknown : name;
+      }
 
-      IdToName::const_iterator itr = m_ids.find(a_id);
+      IdToName::const_iterator itr = table->ids.find(a_id);
 
-      if (itr == m_ids.end())
+      if (itr == table->ids.end())
         return c_unknown;
 
       return itr->second.c_str();
@@ -104,11 +157,11 @@ namespace DUNE
     unsigned
     AddressResolver::resolve(const std::string& a_name)
     {
-      Concurrency::ScopedMutex m(m_mutex);
+      const Table* table = m_table;
 
-      NameToId::const_iterator itr = m_names.find(a_name);
+      NameToId::const_iterator itr = table->names.find(a_name);
 
-      if (itr == m_names.end())
+      if (itr == table->names.end())
         return invalid();
 
       return itr->second;
@@ -33,6 +33,7 @@
 // ISO C++ 98 headers.
 #include <string>
 #include <map>
+#include <vector>
 
 // DUNE headers.
 #include <DUNE/Config.hpp>
@@ -45,12 +46,21 @@ namespace DUNE
     // Export DLL Symbol.
     class DUNE_DLL_SYM AddressResolver;
 
+    //! Resolver of IMC addresses to system names and back.
+    //!
+    //! Lookups read an immutable table through a single pointer and
+    //! take no lock: writers build a fresh table and publish it as a
+    //! whole, so resolution on message reception paths is wait-free
+    //! even while announces churn the registry.
     class AddressResolver
     {
     public:
       //! Default constructor.
       AddressResolver(void);
 
+      //! Destructor.
+      ~AddressResolver(void);
+
       //! Retrieve the address name of this instance.
       //! @return the address name of this instance.
       const char*
@@ -116,16 +126,50 @@ namespace DUNE
       typedef std::map<unsigned, std::string> IdToName;
       //! Name to id map.
       typedef std::map<std::string, unsigned> NameToId;
-      //! List of known addresses, indexed by id.
-      IdToName m_ids;
-      //! List of known addresses, indexed by name.
-      NameToId m_names;
+
+      //! Resolution table. Instances are immutable once published:
+      //! readers follow m_table without locking and rely on the
+      //! contents never changing underneath them.
+      struct Table
+      {
+        //! List of known addresses, indexed by id.
+        IdToName ids;
+        //! List of known addresses, indexed by name.
+        NameToId names;
+        //! Direct reverse-lookup array for the dense low id range,
+        //! pointing into 'ids'; NULL marks an unknown id.
+        std::vector<const char*> dense;
+
+      private:
+        // Non - copyable: 'dense' points into this instance's 'ids'.
+        Table(const Table&);
+        Table& operator=(const Table&);
+
+      public:
+        Table(void)
+        { }
+      };
+
+      //! Size of the dense reverse-lookup array.
+      static const unsigned c_dense_size = 4096;
+
+      //! Current resolution table, replaced as a whole on change.
+      Table* volatile m_table;
+      //! Replaced tables, kept until destruction since a reader may
+      //! still hold a reference. Rebuilds happen only when a new
+      //! mapping is registered, so this is bounded by fleet size.
+      std::vector<Table*> m_retired;
       //! Address name of this instance.
       std::string m_name;
       //! Address id of this instance.
       unsigned m_id;
-      //! Mutex used for safe concurrent accesses.
+      //! Mutex serializing writers.
       Concurrency::Mutex m_mutex;
+
+      //! Publish a new table and retire the current one.
+      //! @param[in] table new resolution table.
+      void
+      publish(Table* table);
     };
   }
 }
@@ -29,6 +29,7 @@
 
 // ISO C++ 98 headers.
 #include <algorithm>
+#include <cstring>
 
 // DUNE headers.
 #include <DUNE/Streams/Terminal.hpp>
@@ -36,6 +37,7 @@
 #include <DUNE/IMC/Factory.hpp>
 #include <DUNE/IMC/Bus.hpp>
 #include <DUNE/IMC/Message.hpp>
+#include <DUNE/IMC/SharedMessage.hpp>
 #include <DUNE/IMC/Definitions.hpp>
 
 namespace DUNE
@@ -45,24 +47,33 @@ namespace DUNE
     struct BackLogEntry
     {
       BackLogEntry(const Message* msg, Tasks::AbstractTask* exc):
-        message(msg->clone()),
+        message(SharedMessage::create(msg)),
+        exclude(exc)
+      {  }
+
+      BackLogEntry(SharedMessage* env, Tasks::AbstractTask* exc):
+        message(env->addRef()),
         exclude(exc)
       {  }
 
       ~BackLogEntry(void)
       {
-        delete message;
+        message->release();
       }
 
-      //! Message.
-      Message* message;
+      //! Message envelope.
+      SharedMessage* message;
       //! Exclude this task.
       Tasks::AbstractTask* exclude;
     };
 
     Bus::Bus(void):
       m_paused(false)
-    { }
+    {
+      std::memset(const_cast<TransportList**>(m_recipients), 0, sizeof(m_recipients));
+      std::memset(const_cast<uint32_t*>(m_stat_count), 0, sizeof(m_stat_count));
+      std::memset(const_cast<uint32_t*>(m_stat_fanout), 0, sizeof(m_stat_fanout));
+    }
 
     Bus::~Bus(void)
     {
@@ -75,11 +86,58 @@ namespace DUNE
 
       for (unsigned i = 0; i < m_bind_msgs.size(); ++i)
         delete m_bind_msgs[i];
+
+      for (unsigned i = 0; i <= DUNE_IMC_CONST_NULL_ID; ++i)
+        delete m_recipients[i];
+
+      for (unsigned i = 0; i < m_retired.size(); ++i)
+        delete m_retired[i];
+    }
+
+    void
+    Bus::publish(uint16_t id, TransportList* list)
+    {
+      TransportList* old = m_recipients[id];
+
+#if defined(DUNE_IMC_BUS_LOCK_FREE)
+      // Make sure the new list is fully constructed before readers
+      // can observe the pointer.
+      __sync_synchronize();
+#endif
+
+      m_recipients[id] = list;
+
+      if (old != NULL)
+        m_retired.push_back(old);
     }
 
     void
-    Bus::registerRecipient(Tasks::AbstractTask* task, uint16_t id)
+    Bus::registerRecipient(Tasks::AbstractTask* task, uint16_t id, double max_rate)
     {
+      double min_sep = (max_rate > 0.0) ? (1.0 / max_rate) : 0.0;
+
+      Concurrency::ScopedMutex l(m_write_lock);
+
+      TransportList* old = m_recipients[id];
+      if (old != NULL)
+      {
+        for (TransportList::iterator itr = old->begin(); itr != old->end(); ++itr)
+        {
+          if (itr->task != task)
+            continue;
+
+          // Already registered: keep the least restrictive rate.
+          if (min_sep < itr->min_sep)
+          {
+            TransportList* fresh = new TransportList(*old);
+            (*fresh)[itr - old->begin()].min_sep = min_sep;
+            publish(id, fresh);
+          }
+
+          return;
+        }
+      }
+
       TransportBindings* bind = new TransportBindings;
       bind->setSourceEntity(DUNE_IMC_CONST_SYS_EID);
       bind->setTimeStamp();
@@ -87,17 +145,35 @@ namespace DUNE
       bind->message_id = id;
       m_bind_msgs.push_back(bind);
 
-      Concurrency::ScopedRWLock l(m_lock, true);
-      TransportList::iterator itr = std::find(m_recipients[id].begin(), m_recipients[id].end(), task);
-      if (itr == m_recipients[id].end())
-        m_recipients[id].push_back(task);
+      Recipient rec;
+      rec.task = task;
+      rec.min_sep = min_sep;
+      rec.last = 0.0;
+
+      TransportList* fresh = old != NULL ? new TransportList(*old) : new TransportList;
+      fresh->push_back(rec);
+      publish(id, fresh);
     }
 
     void
     Bus::unregisterRecipient(Tasks::AbstractTask* task, uint16_t id)
     {
-      Concurrency::ScopedRWLock l(m_lock, true);
-      m_recipients[id].remove(task);
+      Concurrency::ScopedMutex l(m_write_lock);
+
+      TransportList* old = m_recipients[id];
+      if (old == NULL)
+        return;
+
+      for (TransportList::iterator itr = old->begin(); itr != old->end(); ++itr)
+      {
+        if (itr->task != task)
+          continue;
+
+        TransportList* fresh = new TransportList(*old);
+        fresh->erase(fresh->begin() + (itr - old->begin()));
+        publish(id, fresh);
+        return;
+      }
     }
 
     void
@@ -113,12 +189,105 @@ namespace DUNE
       }
 
       uint16_t id = msg->getId();
-      Concurrency::ScopedRWLock l(m_lock);
-      TransportList& dlst(m_recipients[id]);
-      for (TransportList::iterator itr = dlst.begin(); itr != dlst.end(); ++itr)
+
+#if !defined(DUNE_IMC_BUS_LOCK_FREE)
+      Concurrency::ScopedMutex l(m_write_lock);
+#endif
+
+      // The membership of published lists is immutable, so reading
+      // the slot is enough to safely iterate recipients without
+      // taking any lock.
+      TransportList* dlst = m_recipients[id];
+      if (dlst == NULL || dlst->empty())
+        return;
+
+      double ts = msg->getTimeStamp();
+
+      // Clone the message once into a shared envelope: recipients
+      // acquire references instead of cloning it again.
+      SharedMessage* env = SharedMessage::create(msg);
+      uint32_t deliveries = 0;
+      for (TransportList::iterator itr = dlst->begin(); itr != dlst->end(); ++itr)
+      {
+        if (itr->task == task)
+          continue;
+
+        // Decimate before enqueue: recipients above their declared
+        // rate are never cloned for, queued to or woken.
+        if (itr->min_sep > 0.0)
+        {
+          if (ts - itr->last < itr->min_sep)
+            continue;
+          itr->last = ts;
+        }
+
+        itr->task->receive(env);
+        ++deliveries;
+      }
+      env->release();
+
+      accountDispatch(id, deliveries);
+    }
+
+    void
+    Bus::dispatch(SharedMessage* env, Tasks::AbstractTask* task)
+    {
       {
-        if (*itr != task)
-          (*itr)->receive(msg);
+        Concurrency::ScopedMutex lock(m_paused_lock);
+        if (m_paused)
+        {
+          m_back_log.push(new BackLogEntry(env, task));
+          return;
+        }
+      }
+
+      uint16_t id = env->get()->getId();
+
+#if !defined(DUNE_IMC_BUS_LOCK_FREE)
+      Concurrency::ScopedMutex l(m_write_lock);
+#endif
+
+      TransportList* dlst = m_recipients[id];
+      if (dlst == NULL || dlst->empty())
+        return;
+
+      double ts = env->get()->getTimeStamp();
+
+      uint32_t deliveries = 0;
+      for (TransportList::iterator itr = dlst->begin(); itr != dlst->end(); ++itr)
+      {
+        if (itr->task == task)
+          continue;
+
+        if (itr->min_sep > 0.0)
+        {
+          if (ts - itr->last < itr->min_sep)
+            continue;
+          itr->last = ts;
+        }
+
+        itr->task->receive(env);
+        ++deliveries;
+      }
+
+      accountDispatch(id, deliveries);
+    }
+
+    void
+    Bus::getDispatchStats(std::vector<DispatchStats>& list)
+    {
+      list.clear();
+
+      for (unsigned i = 0; i <= DUNE_IMC_CONST_NULL_ID; ++i)
+      {
+        if (m_stat_count[i] == 0)
+          continue;
+
+        DispatchStats stats;
+        stats.id = (uint16_t)i;
+        stats.count = m_stat_count[i];
+        stats.fanout = m_stat_fanout[i];
+        list.push_back(stats);
       }
     }
 
@@ -134,7 +303,7 @@ namespace DUNE
         BackLogEntry* entry = m_back_log.pop();
         if (entry != NULL)
         {
-          dispatch(entry->message, entry->exclude);
+          dispatch(entry->message->get(), entry->exclude);
           delete entry;
         }
       }
@@ -143,6 +312,7 @@ namespace DUNE
     const std::vector<TransportBindings*>
     Bus::getBindings(void)
     {
+      Concurrency::ScopedMutex l(m_write_lock);
       return m_bind_msgs;
     }
   }
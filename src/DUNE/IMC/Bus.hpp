@@ -32,8 +32,6 @@
 
 // ISO C++ 98 headers.
 #include <cstddef>
-#include <map>
-#include <list>
 #include <string>
 #include <utility>
 #include <vector>
@@ -43,7 +41,15 @@
 #include <DUNE/Tasks/AbstractTask.hpp>
 #include <DUNE/Concurrency/TSQueue.hpp>
 #include <DUNE/Concurrency/ScopedMutex.hpp>
-#include <DUNE/Concurrency/ScopedRWLock.hpp>
+#include <DUNE/IMC/Constants.hpp>
+
+// Check if we can use GCC's atomic functions for the lock-free
+// recipient table.
+#if defined(DUNE_SYS_HAS___SYNC_ADD_AND_FETCH) && defined(DUNE_SYS_HAS___SYNC_SUB_AND_FETCH)
+#  ifndef DUNE_IMC_BUS_LOCK_FREE
+#    define DUNE_IMC_BUS_LOCK_FREE
+#  endif
+#endif
 
 namespace DUNE
 {
@@ -51,6 +57,7 @@ namespace DUNE
   {
     // Forward declarations.
     struct BackLogEntry;
+    class SharedMessage;
     class TransportBindings;
 
     // Export DLL Symbol.
@@ -66,11 +73,18 @@ namespace DUNE
       ~Bus(void);
 
       //! Register a task as a recipient a given message
-      //! identification number.
+      //! identification number, optionally declaring the maximum
+      //! rate at which it wants deliveries. Messages above that rate
+      //! are decimated bus-side, before any cloning, queueing or
+      //! wake-up. Registering the same pair again keeps the least
+      //! restrictive rate.
       //! @param task task object.
       //! @param id message identification number.
+      //! @param max_rate maximum delivery rate in Hertz (0 delivers
+      //! every message).
       void
-      registerRecipient(Tasks::AbstractTask* task, uint16_t id);
+      registerRecipient(Tasks::AbstractTask* task, uint16_t id,
+                        double max_rate = 0.0);
 
       //! Unregister a task as a recipient of a given message
       //! identification number.
@@ -85,6 +99,32 @@ namespace DUNE
       void
       dispatch(const Message* msg, Tasks::AbstractTask* task = NULL);
 
+      //! Dispatches an already enveloped message to registered
+      //! listeners without cloning it. The caller retains its
+      //! reference to the envelope.
+      //! @param env message envelope to dispatch.
+      //! @param task do not deliver message to this task.
+      void
+      dispatch(SharedMessage* env, Tasks::AbstractTask* task = NULL);
+
+      //! Dispatch counters of one message type.
+      struct DispatchStats
+      {
+        //! Message identification number.
+        uint16_t id;
+        //! Number of dispatches.
+        uint32_t count;
+        //! Total number of deliveries (dispatches times recipients).
+        uint32_t fanout;
+      };
+
+      //! Retrieve the dispatch counters of all message types seen on
+      //! the bus since start-up.
+      //! @param[out] list counters of message types with at least one
+      //! dispatch.
+      void
+      getDispatchStats(std::vector<DispatchStats>& list);
+
       inline void
       pause(void)
       {
@@ -99,11 +139,35 @@ namespace DUNE
       getBindings(void);
 
     private:
-      typedef std::list<Tasks::AbstractTask*> TransportList;
-      //! Table of recipients.
-      std::map<uint16_t, TransportList> m_recipients;
-      //! Internal list lock.
-      Concurrency::RWLock m_lock;
+      //! Recipient of one message identification number.
+      struct Recipient
+      {
+        //! Recipient task.
+        Tasks::AbstractTask* task;
+        //! Minimum separation between deliveries, per the declared
+        //! maximum rate (0 delivers every message).
+        double min_sep;
+        //! Timestamp of the last delivered message. Concurrent
+        //! dispatchers may race on this field; the worst outcome is
+        //! an occasional extra delivery.
+        double last;
+      };
+
+      //! List of recipients: its membership is immutable — once
+      //! published to the table it is only replaced, never resized —
+      //! but the per-recipient decimation timestamps are updated in
+      //! place.
+      typedef std::vector<Recipient> TransportList;
+      //! Table of recipients, indexed by message identification
+      //! number. Readers dereference entries without taking any lock
+      //! (RCU-style); writers build a fresh list, publish it with a
+      //! full memory barrier and retire the previous one.
+      TransportList* volatile m_recipients[DUNE_IMC_CONST_NULL_ID + 1];
+      //! Writers' lock: serializes updates to the recipient table.
+      Concurrency::Mutex m_write_lock;
+      //! Retired recipient lists. Readers may still hold references
+      //! to superseded lists, so they are only freed on destruction.
+      std::vector<TransportList*> m_retired;
       //! Bus is paused.
       bool m_paused;
       //! Pause lock.
@@ -112,6 +176,34 @@ namespace DUNE
       std::vector<TransportBindings*> m_bind_msgs;
       //! Back log queue. Saves messages when Bus is paused.
       Concurrency::TSQueue<BackLogEntry*> m_back_log;
+      //! Dispatch count by message identification number.
+      volatile uint32_t m_stat_count[DUNE_IMC_CONST_NULL_ID + 1];
+      //! Delivery count by message identification number.
+      volatile uint32_t m_stat_fanout[DUNE_IMC_CONST_NULL_ID + 1];
+
+      //! Account for one dispatch.
+      //! @param id message identification number.
+      //! @param deliveries number of recipients the message was
+      //! delivered to.
+      inline void
+      accountDispatch(uint16_t id, uint32_t deliveries)
+      {
+#if defined(DUNE_IMC_BUS_LOCK_FREE)
+        __sync_fetch_and_add(&m_stat_count[id], 1);
+        __sync_fetch_and_add(&m_stat_fanout[id], deliveries);
+#else
+        // Dispatch holds the writers' lock in this configuration.
+        ++m_stat_count[id];
+        m_stat_fanout[id] += deliveries;
+#endif
+      }
+
+      //! Publish a recipient list to the table, retiring the
+      //! previous one. Must be called with the writers' lock held.
+      //! @param id message identification number.
+      //! @param list list to publish (may be NULL).
+      void
+      publish(uint16_t id, TransportList* list);
 
       //! Non - copyable.
       Bus(Bus const&);
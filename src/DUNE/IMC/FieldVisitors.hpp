@@ -0,0 +1,4698 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+// Automatically generated.                                                 *
+//***************************************************************************
+// IMC XML MD5: d292e724592557940354dddbfc5a9d32                            *
+//***************************************************************************
+
+#ifndef DUNE_IMC_FIELD_VISITORS_HPP_INCLUDED_
+#define DUNE_IMC_FIELD_VISITORS_HPP_INCLUDED_
+
+// DUNE headers.
+#include <DUNE/IMC/Definitions.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    //! Visit the fields of EntityState.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const EntityState& msg__, V& v__)
+    {
+      v__.field("state", msg__.state);
+      v__.field("flags", msg__.flags);
+      v__.field("description", msg__.description);
+    }
+
+    //! Visit the fields of QueryEntityState.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const QueryEntityState& msg__, V& v__)
+    {
+      (void)msg__;
+      (void)v__;
+    }
+
+    //! Visit the fields of EntityInfo.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const EntityInfo& msg__, V& v__)
+    {
+      v__.field("id", msg__.id);
+      v__.field("label", msg__.label);
+      v__.field("component", msg__.component);
+      v__.field("act_time", msg__.act_time);
+      v__.field("deact_time", msg__.deact_time);
+    }
+
+    //! Visit the fields of QueryEntityInfo.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const QueryEntityInfo& msg__, V& v__)
+    {
+      v__.field("id", msg__.id);
+    }
+
+    //! Visit the fields of EntityList.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const EntityList& msg__, V& v__)
+    {
+      v__.field("op", msg__.op);
+      v__.field("list", msg__.list);
+    }
+
+    //! Visit the fields of CpuUsage.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const CpuUsage& msg__, V& v__)
+    {
+      v__.field("value", msg__.value);
+    }
+
+    //! Visit the fields of TransportBindings.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const TransportBindings& msg__, V& v__)
+    {
+      v__.field("consumer", msg__.consumer);
+      v__.field("message_id", msg__.message_id);
+    }
+
+    //! Visit the fields of RestartSystem.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const RestartSystem& msg__, V& v__)
+    {
+      (void)msg__;
+      (void)v__;
+    }
+
+    //! Visit the fields of DevCalibrationControl.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const DevCalibrationControl& msg__, V& v__)
+    {
+      v__.field("op", msg__.op);
+    }
+
+    //! Visit the fields of DevCalibrationState.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const DevCalibrationState& msg__, V& v__)
+    {
+      v__.field("total_steps", msg__.total_steps);
+      v__.field("step_number", msg__.step_number);
+      v__.field("step", msg__.step);
+      v__.field("flags", msg__.flags);
+    }
+
+    //! Visit the fields of EntityActivationState.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const EntityActivationState& msg__, V& v__)
+    {
+      v__.field("state", msg__.state);
+      v__.field("error", msg__.error);
+    }
+
+    //! Visit the fields of QueryEntityActivationState.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const QueryEntityActivationState& msg__, V& v__)
+    {
+      (void)msg__;
+      (void)v__;
+    }
+
+    //! Visit the fields of VehicleOperationalLimits.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const VehicleOperationalLimits& msg__, V& v__)
+    {
+      v__.field("op", msg__.op);
+      v__.field("speed_min", msg__.speed_min);
+      v__.field("speed_max", msg__.speed_max);
+      v__.field("long_accel", msg__.long_accel);
+      v__.field("alt_max_msl", msg__.alt_max_msl);
+      v__.field("dive_fraction_max", msg__.dive_fraction_max);
+      v__.field("climb_fraction_max", msg__.climb_fraction_max);
+      v__.field("bank_max", msg__.bank_max);
+      v__.field("p_max", msg__.p_max);
+      v__.field("pitch_min", msg__.pitch_min);
+      v__.field("pitch_max", msg__.pitch_max);
+      v__.field("q_max", msg__.q_max);
+      v__.field("g_min", msg__.g_min);
+      v__.field("g_max", msg__.g_max);
+      v__.field("g_lat_max", msg__.g_lat_max);
+      v__.field("rpm_min", msg__.rpm_min);
+      v__.field("rpm_max", msg__.rpm_max);
+      v__.field("rpm_rate_max", msg__.rpm_rate_max);
+    }
+
+    //! Visit the fields of MsgList.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const MsgList& msg__, V& v__)
+    {
+      v__.field("msgs", msg__.msgs);
+    }
+
+    //! Visit the fields of SimulatedState.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const SimulatedState& msg__, V& v__)
+    {
+      (void)msg__;
+      (void)v__;
+    }
+
+    //! Visit the fields of LeakSimulation.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const LeakSimulation& msg__, V& v__)
+    {
+      v__.field("op", msg__.op);
+      v__.field("entities", msg__.entities);
+    }
+
+    //! Visit the fields of UASimulation.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const UASimulation& msg__, V& v__)
+    {
+      v__.field("type", msg__.type);
+      v__.field("speed", msg__.speed);
+      v__.field("data", msg__.data);
+    }
+
+    //! Visit the fields of DynamicsSimParam.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const DynamicsSimParam& msg__, V& v__)
+    {
+      v__.field("op", msg__.op);
+      v__.field("tas2acc_pgain", msg__.tas2acc_pgain);
+      v__.field("bank2p_pgain", msg__.bank2p_pgain);
+    }
+
+    //! Visit the fields of StorageUsage.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const StorageUsage& msg__, V& v__)
+    {
+      v__.field("available", msg__.available);
+      v__.field("value", msg__.value);
+    }
+
+    //! Visit the fields of CacheControl.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const CacheControl& msg__, V& v__)
+    {
+      v__.field("op", msg__.op);
+      v__.field("snapshot", msg__.snapshot);
+      v__.field("message", msg__.message);
+    }
+
+    //! Visit the fields of LoggingControl.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const LoggingControl& msg__, V& v__)
+    {
+      v__.field("op", msg__.op);
+      v__.field("name", msg__.name);
+    }
+
+    //! Visit the fields of LogBookEntry.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const LogBookEntry& msg__, V& v__)
+    {
+      v__.field("type", msg__.type);
+      v__.field("htime", msg__.htime);
+      v__.field("context", msg__.context);
+      v__.field("text", msg__.text);
+    }
+
+    //! Visit the fields of LogBookControl.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const LogBookControl& msg__, V& v__)
+    {
+      v__.field("command", msg__.command);
+      v__.field("htime", msg__.htime);
+      v__.field("msg", msg__.msg);
+    }
+
+    //! Visit the fields of ReplayControl.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const ReplayControl& msg__, V& v__)
+    {
+      v__.field("op", msg__.op);
+      v__.field("file", msg__.file);
+    }
+
+    //! Visit the fields of ClockControl.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const ClockControl& msg__, V& v__)
+    {
+      v__.field("op", msg__.op);
+      v__.field("clock", msg__.clock);
+      v__.field("tz", msg__.tz);
+    }
+
+    //! Visit the fields of HistoricCTD.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const HistoricCTD& msg__, V& v__)
+    {
+      v__.field("conductivity", msg__.conductivity);
+      v__.field("temperature", msg__.temperature);
+      v__.field("depth", msg__.depth);
+    }
+
+    //! Visit the fields of HistoricTelemetry.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const HistoricTelemetry& msg__, V& v__)
+    {
+      v__.field("altitude", msg__.altitude);
+      v__.field("roll", msg__.roll);
+      v__.field("pitch", msg__.pitch);
+      v__.field("yaw", msg__.yaw);
+      v__.field("speed", msg__.speed);
+    }
+
+    //! Visit the fields of HistoricSonarData.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const HistoricSonarData& msg__, V& v__)
+    {
+      v__.field("altitude", msg__.altitude);
+      v__.field("width", msg__.width);
+      v__.field("length", msg__.length);
+      v__.field("bearing", msg__.bearing);
+      v__.field("pxl", msg__.pxl);
+      v__.field("encoding", msg__.encoding);
+      v__.field("sonar_data", msg__.sonar_data);
+    }
+
+    //! Visit the fields of HistoricEvent.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const HistoricEvent& msg__, V& v__)
+    {
+      v__.field("text", msg__.text);
+      v__.field("type", msg__.type);
+    }
+
+    //! Visit the fields of Heartbeat.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const Heartbeat& msg__, V& v__)
+    {
+      (void)msg__;
+      (void)v__;
+    }
+
+    //! Visit the fields of Announce.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const Announce& msg__, V& v__)
+    {
+      v__.field("sys_name", msg__.sys_name);
+      v__.field("sys_type", msg__.sys_type);
+      v__.field("owner", msg__.owner);
+      v__.field("lat", msg__.lat);
+      v__.field("lon", msg__.lon);
+      v__.field("height", msg__.height);
+      v__.field("services", msg__.services);
+    }
+
+    //! Visit the fields of AnnounceService.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const AnnounceService& msg__, V& v__)
+    {
+      v__.field("service", msg__.service);
+      v__.field("service_type", msg__.service_type);
+    }
+
+    //! Visit the fields of RSSI.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const RSSI& msg__, V& v__)
+    {
+      v__.field("value", msg__.value);
+    }
+
+    //! Visit the fields of VSWR.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const VSWR& msg__, V& v__)
+    {
+      v__.field("value", msg__.value);
+    }
+
+    //! Visit the fields of LinkLevel.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const LinkLevel& msg__, V& v__)
+    {
+      v__.field("value", msg__.value);
+    }
+
+    //! Visit the fields of Sms.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const Sms& msg__, V& v__)
+    {
+      v__.field("number", msg__.number);
+      v__.field("timeout", msg__.timeout);
+      v__.field("contents", msg__.contents);
+    }
+
+    //! Visit the fields of SmsTx.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const SmsTx& msg__, V& v__)
+    {
+      v__.field("seq", msg__.seq);
+      v__.field("destination", msg__.destination);
+      v__.field("timeout", msg__.timeout);
+      v__.field("data", msg__.data);
+    }
+
+    //! Visit the fields of SmsRx.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const SmsRx& msg__, V& v__)
+    {
+      v__.field("source", msg__.source);
+      v__.field("data", msg__.data);
+    }
+
+    //! Visit the fields of SmsState.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const SmsState& msg__, V& v__)
+    {
+      v__.field("seq", msg__.seq);
+      v__.field("state", msg__.state);
+      v__.field("error", msg__.error);
+    }
+
+    //! Visit the fields of TextMessage.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const TextMessage& msg__, V& v__)
+    {
+      v__.field("origin", msg__.origin);
+      v__.field("text", msg__.text);
+    }
+
+    //! Visit the fields of IridiumMsgRx.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const IridiumMsgRx& msg__, V& v__)
+    {
+      v__.field("origin", msg__.origin);
+      v__.field("htime", msg__.htime);
+      v__.field("lat", msg__.lat);
+      v__.field("lon", msg__.lon);
+      v__.field("data", msg__.data);
+    }
+
+    //! Visit the fields of IridiumMsgTx.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const IridiumMsgTx& msg__, V& v__)
+    {
+      v__.field("req_id", msg__.req_id);
+      v__.field("ttl", msg__.ttl);
+      v__.field("destination", msg__.destination);
+      v__.field("data", msg__.data);
+    }
+
+    //! Visit the fields of IridiumTxStatus.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const IridiumTxStatus& msg__, V& v__)
+    {
+      v__.field("req_id", msg__.req_id);
+      v__.field("status", msg__.status);
+      v__.field("text", msg__.text);
+    }
+
+    //! Visit the fields of GroupMembershipState.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const GroupMembershipState& msg__, V& v__)
+    {
+      v__.field("group_name", msg__.group_name);
+      v__.field("links", msg__.links);
+    }
+
+    //! Visit the fields of SystemGroup.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const SystemGroup& msg__, V& v__)
+    {
+      v__.field("groupname", msg__.groupname);
+      v__.field("action", msg__.action);
+      v__.field("grouplist", msg__.grouplist);
+    }
+
+    //! Visit the fields of LinkLatency.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const LinkLatency& msg__, V& v__)
+    {
+      v__.field("value", msg__.value);
+      v__.field("sys_src", msg__.sys_src);
+    }
+
+    //! Visit the fields of ExtendedRSSI.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const ExtendedRSSI& msg__, V& v__)
+    {
+      v__.field("value", msg__.value);
+      v__.field("units", msg__.units);
+    }
+
+    //! Visit the fields of HistoricData.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const HistoricData& msg__, V& v__)
+    {
+      v__.field("base_lat", msg__.base_lat);
+      v__.field("base_lon", msg__.base_lon);
+      v__.field("base_time", msg__.base_time);
+      v__.field("data", msg__.data);
+    }
+
+    //! Visit the fields of CompressedHistory.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const CompressedHistory& msg__, V& v__)
+    {
+      v__.field("base_lat", msg__.base_lat);
+      v__.field("base_lon", msg__.base_lon);
+      v__.field("base_time", msg__.base_time);
+      v__.field("data", msg__.data);
+    }
+
+    //! Visit the fields of HistoricSample.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const HistoricSample& msg__, V& v__)
+    {
+      v__.field("sys_id", msg__.sys_id);
+      v__.field("priority", msg__.priority);
+      v__.field("x", msg__.x);
+      v__.field("y", msg__.y);
+      v__.field("z", msg__.z);
+      v__.field("t", msg__.t);
+      v__.field("sample", msg__.sample);
+    }
+
+    //! Visit the fields of HistoricDataQuery.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const HistoricDataQuery& msg__, V& v__)
+    {
+      v__.field("req_id", msg__.req_id);
+      v__.field("type", msg__.type);
+      v__.field("max_size", msg__.max_size);
+      v__.field("data", msg__.data);
+    }
+
+    //! Visit the fields of RemoteCommand.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const RemoteCommand& msg__, V& v__)
+    {
+      v__.field("original_source", msg__.original_source);
+      v__.field("destination", msg__.destination);
+      v__.field("timeout", msg__.timeout);
+      v__.field("cmd", msg__.cmd);
+    }
+
+    //! Visit the fields of LblRange.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const LblRange& msg__, V& v__)
+    {
+      v__.field("id", msg__.id);
+      v__.field("range", msg__.range);
+    }
+
+    //! Visit the fields of LblBeacon.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const LblBeacon& msg__, V& v__)
+    {
+      v__.field("beacon", msg__.beacon);
+      v__.field("lat", msg__.lat);
+      v__.field("lon", msg__.lon);
+      v__.field("depth", msg__.depth);
+      v__.field("query_channel", msg__.query_channel);
+      v__.field("reply_channel", msg__.reply_channel);
+      v__.field("transponder_delay", msg__.transponder_delay);
+    }
+
+    //! Visit the fields of LblConfig.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const LblConfig& msg__, V& v__)
+    {
+      v__.field("op", msg__.op);
+      v__.field("beacons", msg__.beacons);
+    }
+
+    //! Visit the fields of AcousticMessage.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const AcousticMessage& msg__, V& v__)
+    {
+      v__.field("message", msg__.message);
+    }
+
+    //! Visit the fields of AcousticOperation.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const AcousticOperation& msg__, V& v__)
+    {
+      v__.field("op", msg__.op);
+      v__.field("system", msg__.system);
+      v__.field("range", msg__.range);
+      v__.field("msg", msg__.msg);
+    }
+
+    //! Visit the fields of AcousticSystemsQuery.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const AcousticSystemsQuery& msg__, V& v__)
+    {
+      (void)msg__;
+      (void)v__;
+    }
+
+    //! Visit the fields of AcousticSystems.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const AcousticSystems& msg__, V& v__)
+    {
+      v__.field("list", msg__.list);
+    }
+
+    //! Visit the fields of AcousticLink.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const AcousticLink& msg__, V& v__)
+    {
+      v__.field("peer", msg__.peer);
+      v__.field("rssi", msg__.rssi);
+      v__.field("integrity", msg__.integrity);
+    }
+
+    //! Visit the fields of Rpm.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const Rpm& msg__, V& v__)
+    {
+      v__.field("value", msg__.value);
+    }
+
+    //! Visit the fields of Voltage.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const Voltage& msg__, V& v__)
+    {
+      v__.field("value", msg__.value);
+    }
+
+    //! Visit the fields of Current.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const Current& msg__, V& v__)
+    {
+      v__.field("value", msg__.value);
+    }
+
+    //! Visit the fields of GpsFix.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const GpsFix& msg__, V& v__)
+    {
+      v__.field("validity", msg__.validity);
+      v__.field("type", msg__.type);
+      v__.field("utc_year", msg__.utc_year);
+      v__.field("utc_month", msg__.utc_month);
+      v__.field("utc_day", msg__.utc_day);
+      v__.field("utc_time", msg__.utc_time);
+      v__.field("lat", msg__.lat);
+      v__.field("lon", msg__.lon);
+      v__.field("height", msg__.height);
+      v__.field("satellites", msg__.satellites);
+      v__.field("cog", msg__.cog);
+      v__.field("sog", msg__.sog);
+      v__.field("hdop", msg__.hdop);
+      v__.field("vdop", msg__.vdop);
+      v__.field("hacc", msg__.hacc);
+      v__.field("vacc", msg__.vacc);
+    }
+
+    //! Visit the fields of EulerAngles.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const EulerAngles& msg__, V& v__)
+    {
+      v__.field("time", msg__.time);
+      v__.field("phi", msg__.phi);
+      v__.field("theta", msg__.theta);
+    }
+
+    //! Visit the fields of EulerAnglesDelta.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const EulerAnglesDelta& msg__, V& v__)
+    {
+      v__.field("time", msg__.time);
+      v__.field("x", msg__.x);
+      v__.field("y", msg__.y);
+      v__.field("z", msg__.z);
+      v__.field("timestep", msg__.timestep);
+    }
+
+    //! Visit the fields of AngularVelocity.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const AngularVelocity& msg__, V& v__)
+    {
+      v__.field("time", msg__.time);
+      v__.field("x", msg__.x);
+      v__.field("y", msg__.y);
+      v__.field("z", msg__.z);
+    }
+
+    //! Visit the fields of Acceleration.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const Acceleration& msg__, V& v__)
+    {
+      v__.field("time", msg__.time);
+      v__.field("x", msg__.x);
+      v__.field("y", msg__.y);
+      v__.field("z", msg__.z);
+    }
+
+    //! Visit the fields of MagneticField.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const MagneticField& msg__, V& v__)
+    {
+      v__.field("time", msg__.time);
+      v__.field("x", msg__.x);
+      v__.field("y", msg__.y);
+      v__.field("z", msg__.z);
+    }
+
+    //! Visit the fields of GroundVelocity.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const GroundVelocity& msg__, V& v__)
+    {
+      v__.field("validity", msg__.validity);
+      v__.field("x", msg__.x);
+      v__.field("y", msg__.y);
+      v__.field("z", msg__.z);
+    }
+
+    //! Visit the fields of WaterVelocity.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const WaterVelocity& msg__, V& v__)
+    {
+      v__.field("validity", msg__.validity);
+      v__.field("x", msg__.x);
+      v__.field("y", msg__.y);
+      v__.field("z", msg__.z);
+    }
+
+    //! Visit the fields of VelocityDelta.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const VelocityDelta& msg__, V& v__)
+    {
+      v__.field("time", msg__.time);
+      v__.field("x", msg__.x);
+      v__.field("y", msg__.y);
+      v__.field("z", msg__.z);
+    }
+
+    //! Visit the fields of DeviceState.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const DeviceState& msg__, V& v__)
+    {
+      v__.field("x", msg__.x);
+      v__.field("y", msg__.y);
+      v__.field("z", msg__.z);
+      v__.field("phi", msg__.phi);
+      v__.field("theta", msg__.theta);
+      v__.field("psi", msg__.psi);
+    }
+
+    //! Visit the fields of BeamConfig.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const BeamConfig& msg__, V& v__)
+    {
+      v__.field("beam_width", msg__.beam_width);
+      v__.field("beam_height", msg__.beam_height);
+    }
+
+    //! Visit the fields of Distance.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const Distance& msg__, V& v__)
+    {
+      v__.field("validity", msg__.validity);
+      v__.field("location", msg__.location);
+      v__.field("beam_config", msg__.beam_config);
+      v__.field("value", msg__.value);
+    }
+
+    //! Visit the fields of Temperature.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const Temperature& msg__, V& v__)
+    {
+      v__.field("value", msg__.value);
+    }
+
+    //! Visit the fields of Pressure.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const Pressure& msg__, V& v__)
+    {
+      v__.field("value", msg__.value);
+    }
+
+    //! Visit the fields of Depth.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const Depth& msg__, V& v__)
+    {
+      v__.field("value", msg__.value);
+    }
+
+    //! Visit the fields of DepthOffset.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const DepthOffset& msg__, V& v__)
+    {
+      v__.field("value", msg__.value);
+    }
+
+    //! Visit the fields of SoundSpeed.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const SoundSpeed& msg__, V& v__)
+    {
+      v__.field("value", msg__.value);
+    }
+
+    //! Visit the fields of WaterDensity.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const WaterDensity& msg__, V& v__)
+    {
+      v__.field("value", msg__.value);
+    }
+
+    //! Visit the fields of Conductivity.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const Conductivity& msg__, V& v__)
+    {
+      v__.field("value", msg__.value);
+    }
+
+    //! Visit the fields of Salinity.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const Salinity& msg__, V& v__)
+    {
+      v__.field("value", msg__.value);
+    }
+
+    //! Visit the fields of WindSpeed.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const WindSpeed& msg__, V& v__)
+    {
+      v__.field("direction", msg__.direction);
+      v__.field("speed", msg__.speed);
+      v__.field("turbulence", msg__.turbulence);
+    }
+
+    //! Visit the fields of RelativeHumidity.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const RelativeHumidity& msg__, V& v__)
+    {
+      v__.field("value", msg__.value);
+    }
+
+    //! Visit the fields of DevDataText.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const DevDataText& msg__, V& v__)
+    {
+      v__.field("value", msg__.value);
+    }
+
+    //! Visit the fields of DevDataBinary.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const DevDataBinary& msg__, V& v__)
+    {
+      v__.field("value", msg__.value);
+    }
+
+    //! Visit the fields of SonarData.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const SonarData& msg__, V& v__)
+    {
+      v__.field("type", msg__.type);
+      v__.field("frequency", msg__.frequency);
+      v__.field("min_range", msg__.min_range);
+      v__.field("max_range", msg__.max_range);
+      v__.field("bits_per_point", msg__.bits_per_point);
+      v__.field("scale_factor", msg__.scale_factor);
+      v__.field("beam_config", msg__.beam_config);
+      v__.field("data", msg__.data);
+    }
+
+    //! Visit the fields of Pulse.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const Pulse& msg__, V& v__)
+    {
+      (void)msg__;
+      (void)v__;
+    }
+
+    //! Visit the fields of PulseDetectionControl.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const PulseDetectionControl& msg__, V& v__)
+    {
+      v__.field("op", msg__.op);
+    }
+
+    //! Visit the fields of FuelLevel.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const FuelLevel& msg__, V& v__)
+    {
+      v__.field("value", msg__.value);
+      v__.field("confidence", msg__.confidence);
+      v__.field("opmodes", msg__.opmodes);
+    }
+
+    //! Visit the fields of GpsNavData.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const GpsNavData& msg__, V& v__)
+    {
+      v__.field("itow", msg__.itow);
+      v__.field("lat", msg__.lat);
+      v__.field("lon", msg__.lon);
+      v__.field("height_ell", msg__.height_ell);
+      v__.field("height_sea", msg__.height_sea);
+      v__.field("hacc", msg__.hacc);
+      v__.field("vacc", msg__.vacc);
+      v__.field("vel_n", msg__.vel_n);
+      v__.field("vel_e", msg__.vel_e);
+      v__.field("vel_d", msg__.vel_d);
+    }
+
+    //! Visit the fields of ServoPosition.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const ServoPosition& msg__, V& v__)
+    {
+      v__.field("id", msg__.id);
+      v__.field("value", msg__.value);
+    }
+
+    //! Visit the fields of DataSanity.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const DataSanity& msg__, V& v__)
+    {
+      v__.field("sane", msg__.sane);
+    }
+
+    //! Visit the fields of RhodamineDye.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const RhodamineDye& msg__, V& v__)
+    {
+      v__.field("value", msg__.value);
+    }
+
+    //! Visit the fields of CrudeOil.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const CrudeOil& msg__, V& v__)
+    {
+      v__.field("value", msg__.value);
+    }
+
+    //! Visit the fields of FineOil.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const FineOil& msg__, V& v__)
+    {
+      v__.field("value", msg__.value);
+    }
+
+    //! Visit the fields of Turbidity.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const Turbidity& msg__, V& v__)
+    {
+      v__.field("value", msg__.value);
+    }
+
+    //! Visit the fields of Chlorophyll.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const Chlorophyll& msg__, V& v__)
+    {
+      v__.field("value", msg__.value);
+    }
+
+    //! Visit the fields of Fluorescein.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const Fluorescein& msg__, V& v__)
+    {
+      v__.field("value", msg__.value);
+    }
+
+    //! Visit the fields of Phycocyanin.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const Phycocyanin& msg__, V& v__)
+    {
+      v__.field("value", msg__.value);
+    }
+
+    //! Visit the fields of Phycoerythrin.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const Phycoerythrin& msg__, V& v__)
+    {
+      v__.field("value", msg__.value);
+    }
+
+    //! Visit the fields of GpsFixRtk.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const GpsFixRtk& msg__, V& v__)
+    {
+      v__.field("validity", msg__.validity);
+      v__.field("type", msg__.type);
+      v__.field("tow", msg__.tow);
+      v__.field("base_lat", msg__.base_lat);
+      v__.field("base_lon", msg__.base_lon);
+      v__.field("base_height", msg__.base_height);
+      v__.field("n", msg__.n);
+      v__.field("e", msg__.e);
+      v__.field("d", msg__.d);
+      v__.field("v_n", msg__.v_n);
+      v__.field("v_e", msg__.v_e);
+      v__.field("v_d", msg__.v_d);
+      v__.field("satellites", msg__.satellites);
+      v__.field("iar_hyp", msg__.iar_hyp);
+      v__.field("iar_ratio", msg__.iar_ratio);
+    }
+
+    //! Visit the fields of EstimatedState.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const EstimatedState& msg__, V& v__)
+    {
+      (void)msg__;
+      (void)v__;
+    }
+
+    //! Visit the fields of ExternalNavData.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const ExternalNavData& msg__, V& v__)
+    {
+      v__.field("state", msg__.state);
+      v__.field("type", msg__.type);
+    }
+
+    //! Visit the fields of DissolvedOxygen.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const DissolvedOxygen& msg__, V& v__)
+    {
+      v__.field("value", msg__.value);
+    }
+
+    //! Visit the fields of AirSaturation.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const AirSaturation& msg__, V& v__)
+    {
+      v__.field("value", msg__.value);
+    }
+
+    //! Visit the fields of Throttle.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const Throttle& msg__, V& v__)
+    {
+      v__.field("value", msg__.value);
+    }
+
+    //! Visit the fields of PH.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const PH& msg__, V& v__)
+    {
+      v__.field("value", msg__.value);
+    }
+
+    //! Visit the fields of Redox.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const Redox& msg__, V& v__)
+    {
+      v__.field("value", msg__.value);
+    }
+
+    //! Visit the fields of CameraZoom.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const CameraZoom& msg__, V& v__)
+    {
+      v__.field("id", msg__.id);
+      v__.field("zoom", msg__.zoom);
+      v__.field("action", msg__.action);
+    }
+
+    //! Visit the fields of SetThrusterActuation.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const SetThrusterActuation& msg__, V& v__)
+    {
+      v__.field("id", msg__.id);
+      v__.field("value", msg__.value);
+    }
+
+    //! Visit the fields of SetServoPosition.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const SetServoPosition& msg__, V& v__)
+    {
+      v__.field("id", msg__.id);
+      v__.field("value", msg__.value);
+    }
+
+    //! Visit the fields of SetControlSurfaceDeflection.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const SetControlSurfaceDeflection& msg__, V& v__)
+    {
+      v__.field("id", msg__.id);
+      v__.field("angle", msg__.angle);
+    }
+
+    //! Visit the fields of RemoteActionsRequest.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const RemoteActionsRequest& msg__, V& v__)
+    {
+      v__.field("op", msg__.op);
+      v__.field("actions", msg__.actions);
+    }
+
+    //! Visit the fields of RemoteActions.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const RemoteActions& msg__, V& v__)
+    {
+      v__.field("actions", msg__.actions);
+    }
+
+    //! Visit the fields of ButtonEvent.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const ButtonEvent& msg__, V& v__)
+    {
+      v__.field("button", msg__.button);
+      v__.field("value", msg__.value);
+    }
+
+    //! Visit the fields of LcdControl.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const LcdControl& msg__, V& v__)
+    {
+      v__.field("op", msg__.op);
+      v__.field("text", msg__.text);
+    }
+
+    //! Visit the fields of PowerOperation.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const PowerOperation& msg__, V& v__)
+    {
+      v__.field("op", msg__.op);
+      v__.field("time_remain", msg__.time_remain);
+      v__.field("sched_time", msg__.sched_time);
+    }
+
+    //! Visit the fields of PowerChannelControl.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const PowerChannelControl& msg__, V& v__)
+    {
+      v__.field("name", msg__.name);
+      v__.field("op", msg__.op);
+      v__.field("sched_time", msg__.sched_time);
+    }
+
+    //! Visit the fields of QueryPowerChannelState.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const QueryPowerChannelState& msg__, V& v__)
+    {
+      (void)msg__;
+      (void)v__;
+    }
+
+    //! Visit the fields of PowerChannelState.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const PowerChannelState& msg__, V& v__)
+    {
+      v__.field("name", msg__.name);
+      v__.field("state", msg__.state);
+    }
+
+    //! Visit the fields of LedBrightness.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const LedBrightness& msg__, V& v__)
+    {
+      v__.field("name", msg__.name);
+      v__.field("value", msg__.value);
+    }
+
+    //! Visit the fields of QueryLedBrightness.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const QueryLedBrightness& msg__, V& v__)
+    {
+      v__.field("name", msg__.name);
+    }
+
+    //! Visit the fields of SetLedBrightness.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const SetLedBrightness& msg__, V& v__)
+    {
+      v__.field("name", msg__.name);
+      v__.field("value", msg__.value);
+    }
+
+    //! Visit the fields of SetPWM.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const SetPWM& msg__, V& v__)
+    {
+      v__.field("id", msg__.id);
+      v__.field("period", msg__.period);
+      v__.field("duty_cycle", msg__.duty_cycle);
+    }
+
+    //! Visit the fields of PWM.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const PWM& msg__, V& v__)
+    {
+      v__.field("id", msg__.id);
+      v__.field("period", msg__.period);
+      v__.field("duty_cycle", msg__.duty_cycle);
+    }
+
+    //! Visit the fields of EstimatedStreamVelocity.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const EstimatedStreamVelocity& msg__, V& v__)
+    {
+      (void)msg__;
+      (void)v__;
+    }
+
+    //! Visit the fields of IndicatedSpeed.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const IndicatedSpeed& msg__, V& v__)
+    {
+      v__.field("value", msg__.value);
+    }
+
+    //! Visit the fields of TrueSpeed.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const TrueSpeed& msg__, V& v__)
+    {
+      v__.field("value", msg__.value);
+    }
+
+    //! Visit the fields of NavigationUncertainty.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const NavigationUncertainty& msg__, V& v__)
+    {
+      v__.field("x", msg__.x);
+      v__.field("y", msg__.y);
+      v__.field("z", msg__.z);
+      v__.field("phi", msg__.phi);
+      v__.field("theta", msg__.theta);
+      v__.field("psi", msg__.psi);
+      v__.field("p", msg__.p);
+      v__.field("q", msg__.q);
+      v__.field("r", msg__.r);
+      v__.field("u", msg__.u);
+      v__.field("v", msg__.v);
+      v__.field("w", msg__.w);
+      v__.field("bias_psi", msg__.bias_psi);
+      v__.field("bias_r", msg__.bias_r);
+    }
+
+    //! Visit the fields of NavigationData.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const NavigationData& msg__, V& v__)
+    {
+      v__.field("bias_psi", msg__.bias_psi);
+      v__.field("bias_r", msg__.bias_r);
+      v__.field("cog", msg__.cog);
+      v__.field("cyaw", msg__.cyaw);
+      v__.field("lbl_rej_level", msg__.lbl_rej_level);
+      v__.field("gps_rej_level", msg__.gps_rej_level);
+      v__.field("custom_x", msg__.custom_x);
+      v__.field("custom_y", msg__.custom_y);
+      v__.field("custom_z", msg__.custom_z);
+    }
+
+    //! Visit the fields of GpsFixRejection.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const GpsFixRejection& msg__, V& v__)
+    {
+      v__.field("utc_time", msg__.utc_time);
+      v__.field("reason", msg__.reason);
+    }
+
+    //! Visit the fields of LblRangeAcceptance.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const LblRangeAcceptance& msg__, V& v__)
+    {
+      v__.field("id", msg__.id);
+      v__.field("range", msg__.range);
+      v__.field("acceptance", msg__.acceptance);
+    }
+
+    //! Visit the fields of DvlRejection.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const DvlRejection& msg__, V& v__)
+    {
+      v__.field("type", msg__.type);
+      v__.field("reason", msg__.reason);
+      v__.field("value", msg__.value);
+      v__.field("timestep", msg__.timestep);
+    }
+
+    //! Visit the fields of LblEstimate.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const LblEstimate& msg__, V& v__)
+    {
+      v__.field("beacon", msg__.beacon);
+      v__.field("x", msg__.x);
+      v__.field("y", msg__.y);
+      v__.field("var_x", msg__.var_x);
+      v__.field("var_y", msg__.var_y);
+      v__.field("distance", msg__.distance);
+    }
+
+    //! Visit the fields of AlignmentState.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const AlignmentState& msg__, V& v__)
+    {
+      v__.field("state", msg__.state);
+    }
+
+    //! Visit the fields of GroupStreamVelocity.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const GroupStreamVelocity& msg__, V& v__)
+    {
+      (void)msg__;
+      (void)v__;
+    }
+
+    //! Visit the fields of Airflow.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const Airflow& msg__, V& v__)
+    {
+      v__.field("va", msg__.va);
+      v__.field("aoa", msg__.aoa);
+      v__.field("ssa", msg__.ssa);
+    }
+
+    //! Visit the fields of DesiredHeading.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const DesiredHeading& msg__, V& v__)
+    {
+      v__.field("value", msg__.value);
+    }
+
+    //! Visit the fields of DesiredZ.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const DesiredZ& msg__, V& v__)
+    {
+      v__.field("value", msg__.value);
+      v__.field("z_units", msg__.z_units);
+    }
+
+    //! Visit the fields of DesiredSpeed.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const DesiredSpeed& msg__, V& v__)
+    {
+      v__.field("value", msg__.value);
+      v__.field("speed_units", msg__.speed_units);
+    }
+
+    //! Visit the fields of DesiredRoll.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const DesiredRoll& msg__, V& v__)
+    {
+      v__.field("value", msg__.value);
+    }
+
+    //! Visit the fields of DesiredPitch.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const DesiredPitch& msg__, V& v__)
+    {
+      v__.field("value", msg__.value);
+    }
+
+    //! Visit the fields of DesiredVerticalRate.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const DesiredVerticalRate& msg__, V& v__)
+    {
+      v__.field("value", msg__.value);
+    }
+
+    //! Visit the fields of DesiredPath.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const DesiredPath& msg__, V& v__)
+    {
+      v__.field("path_ref", msg__.path_ref);
+      v__.field("start_lat", msg__.start_lat);
+      v__.field("start_lon", msg__.start_lon);
+      v__.field("start_z", msg__.start_z);
+      v__.field("start_z_units", msg__.start_z_units);
+      v__.field("end_lat", msg__.end_lat);
+      v__.field("end_lon", msg__.end_lon);
+      v__.field("end_z", msg__.end_z);
+      v__.field("end_z_units", msg__.end_z_units);
+      v__.field("speed", msg__.speed);
+      v__.field("speed_units", msg__.speed_units);
+      v__.field("lradius", msg__.lradius);
+      v__.field("flags", msg__.flags);
+    }
+
+    //! Visit the fields of DesiredControl.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const DesiredControl& msg__, V& v__)
+    {
+      v__.field("x", msg__.x);
+      v__.field("y", msg__.y);
+      v__.field("z", msg__.z);
+      v__.field("k", msg__.k);
+      v__.field("m", msg__.m);
+      v__.field("n", msg__.n);
+      v__.field("flags", msg__.flags);
+    }
+
+    //! Visit the fields of DesiredHeadingRate.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const DesiredHeadingRate& msg__, V& v__)
+    {
+      v__.field("value", msg__.value);
+    }
+
+    //! Visit the fields of DesiredVelocity.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const DesiredVelocity& msg__, V& v__)
+    {
+      v__.field("u", msg__.u);
+      v__.field("v", msg__.v);
+      v__.field("w", msg__.w);
+      v__.field("p", msg__.p);
+      v__.field("q", msg__.q);
+      v__.field("r", msg__.r);
+      v__.field("flags", msg__.flags);
+    }
+
+    //! Visit the fields of PathControlState.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const PathControlState& msg__, V& v__)
+    {
+      v__.field("path_ref", msg__.path_ref);
+      v__.field("start_lat", msg__.start_lat);
+      v__.field("start_lon", msg__.start_lon);
+      v__.field("start_z", msg__.start_z);
+      v__.field("start_z_units", msg__.start_z_units);
+      v__.field("end_lat", msg__.end_lat);
+      v__.field("end_lon", msg__.end_lon);
+      v__.field("end_z", msg__.end_z);
+      v__.field("end_z_units", msg__.end_z_units);
+      v__.field("lradius", msg__.lradius);
+      v__.field("flags", msg__.flags);
+      v__.field("x", msg__.x);
+      v__.field("y", msg__.y);
+      v__.field("z", msg__.z);
+      v__.field("vx", msg__.vx);
+      v__.field("vy", msg__.vy);
+      v__.field("vz", msg__.vz);
+      v__.field("course_error", msg__.course_error);
+    }
+
+    //! Visit the fields of AllocatedControlTorques.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const AllocatedControlTorques& msg__, V& v__)
+    {
+      v__.field("k", msg__.k);
+      v__.field("m", msg__.m);
+      v__.field("n", msg__.n);
+    }
+
+    //! Visit the fields of ControlParcel.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const ControlParcel& msg__, V& v__)
+    {
+      v__.field("p", msg__.p);
+      v__.field("i", msg__.i);
+      v__.field("d", msg__.d);
+      v__.field("a", msg__.a);
+    }
+
+    //! Visit the fields of Brake.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const Brake& msg__, V& v__)
+    {
+      v__.field("op", msg__.op);
+    }
+
+    //! Visit the fields of DesiredLinearState.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const DesiredLinearState& msg__, V& v__)
+    {
+      v__.field("x", msg__.x);
+      v__.field("y", msg__.y);
+      v__.field("z", msg__.z);
+      v__.field("vx", msg__.vx);
+      v__.field("vy", msg__.vy);
+      v__.field("vz", msg__.vz);
+      v__.field("ax", msg__.ax);
+      v__.field("ay", msg__.ay);
+      v__.field("az", msg__.az);
+      v__.field("flags", msg__.flags);
+    }
+
+    //! Visit the fields of DesiredThrottle.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const DesiredThrottle& msg__, V& v__)
+    {
+      v__.field("value", msg__.value);
+    }
+
+    //! Visit the fields of Goto.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const Goto& msg__, V& v__)
+    {
+      v__.field("timeout", msg__.timeout);
+      v__.field("lat", msg__.lat);
+      v__.field("lon", msg__.lon);
+      v__.field("z", msg__.z);
+      v__.field("z_units", msg__.z_units);
+      v__.field("speed", msg__.speed);
+      v__.field("speed_units", msg__.speed_units);
+      v__.field("roll", msg__.roll);
+      v__.field("pitch", msg__.pitch);
+      v__.field("yaw", msg__.yaw);
+      v__.field("custom", msg__.custom);
+    }
+
+    //! Visit the fields of PopUp.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const PopUp& msg__, V& v__)
+    {
+      v__.field("timeout", msg__.timeout);
+      v__.field("lat", msg__.lat);
+      v__.field("lon", msg__.lon);
+      v__.field("z", msg__.z);
+      v__.field("z_units", msg__.z_units);
+      v__.field("speed", msg__.speed);
+      v__.field("speed_units", msg__.speed_units);
+      v__.field("duration", msg__.duration);
+      v__.field("radius", msg__.radius);
+      v__.field("flags", msg__.flags);
+      v__.field("custom", msg__.custom);
+    }
+
+    //! Visit the fields of Teleoperation.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const Teleoperation& msg__, V& v__)
+    {
+      v__.field("custom", msg__.custom);
+    }
+
+    //! Visit the fields of Loiter.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const Loiter& msg__, V& v__)
+    {
+      v__.field("timeout", msg__.timeout);
+      v__.field("lat", msg__.lat);
+      v__.field("lon", msg__.lon);
+      v__.field("z", msg__.z);
+      v__.field("z_units", msg__.z_units);
+      v__.field("duration", msg__.duration);
+      v__.field("speed", msg__.speed);
+      v__.field("speed_units", msg__.speed_units);
+      v__.field("type", msg__.type);
+      v__.field("radius", msg__.radius);
+      v__.field("length", msg__.length);
+      v__.field("bearing", msg__.bearing);
+      v__.field("direction", msg__.direction);
+      v__.field("custom", msg__.custom);
+    }
+
+    //! Visit the fields of IdleManeuver.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const IdleManeuver& msg__, V& v__)
+    {
+      v__.field("duration", msg__.duration);
+      v__.field("custom", msg__.custom);
+    }
+
+    //! Visit the fields of LowLevelControl.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const LowLevelControl& msg__, V& v__)
+    {
+      v__.field("control", msg__.control);
+      v__.field("duration", msg__.duration);
+      v__.field("custom", msg__.custom);
+    }
+
+    //! Visit the fields of Rows.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const Rows& msg__, V& v__)
+    {
+      v__.field("timeout", msg__.timeout);
+      v__.field("lat", msg__.lat);
+      v__.field("lon", msg__.lon);
+      v__.field("z", msg__.z);
+      v__.field("z_units", msg__.z_units);
+      v__.field("speed", msg__.speed);
+      v__.field("speed_units", msg__.speed_units);
+      v__.field("bearing", msg__.bearing);
+      v__.field("cross_angle", msg__.cross_angle);
+      v__.field("width", msg__.width);
+      v__.field("length", msg__.length);
+      v__.field("hstep", msg__.hstep);
+      v__.field("coff", msg__.coff);
+      v__.field("alternation", msg__.alternation);
+      v__.field("flags", msg__.flags);
+      v__.field("custom", msg__.custom);
+    }
+
+    //! Visit the fields of PathPoint.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const PathPoint& msg__, V& v__)
+    {
+      (void)msg__;
+      (void)v__;
+    }
+
+    //! Visit the fields of FollowPath.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const FollowPath& msg__, V& v__)
+    {
+      v__.field("timeout", msg__.timeout);
+      v__.field("lat", msg__.lat);
+      v__.field("lon", msg__.lon);
+      v__.field("z", msg__.z);
+      v__.field("z_units", msg__.z_units);
+      v__.field("speed", msg__.speed);
+      v__.field("speed_units", msg__.speed_units);
+      v__.field("points", msg__.points);
+      v__.field("custom", msg__.custom);
+    }
+
+    //! Visit the fields of YoYo.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const YoYo& msg__, V& v__)
+    {
+      v__.field("timeout", msg__.timeout);
+      v__.field("lat", msg__.lat);
+      v__.field("lon", msg__.lon);
+      v__.field("z", msg__.z);
+      v__.field("z_units", msg__.z_units);
+      v__.field("amplitude", msg__.amplitude);
+      v__.field("pitch", msg__.pitch);
+      v__.field("speed", msg__.speed);
+      v__.field("speed_units", msg__.speed_units);
+      v__.field("custom", msg__.custom);
+    }
+
+    //! Visit the fields of TeleoperationDone.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const TeleoperationDone& msg__, V& v__)
+    {
+      (void)msg__;
+      (void)v__;
+    }
+
+    //! Visit the fields of StationKeeping.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const StationKeeping& msg__, V& v__)
+    {
+      v__.field("lat", msg__.lat);
+      v__.field("lon", msg__.lon);
+      v__.field("z", msg__.z);
+      v__.field("z_units", msg__.z_units);
+      v__.field("radius", msg__.radius);
+      v__.field("duration", msg__.duration);
+      v__.field("speed", msg__.speed);
+      v__.field("speed_units", msg__.speed_units);
+      v__.field("custom", msg__.custom);
+    }
+
+    //! Visit the fields of Elevator.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const Elevator& msg__, V& v__)
+    {
+      v__.field("timeout", msg__.timeout);
+      v__.field("flags", msg__.flags);
+      v__.field("lat", msg__.lat);
+      v__.field("lon", msg__.lon);
+      v__.field("start_z", msg__.start_z);
+      v__.field("start_z_units", msg__.start_z_units);
+      v__.field("end_z", msg__.end_z);
+      v__.field("end_z_units", msg__.end_z_units);
+      v__.field("radius", msg__.radius);
+      v__.field("speed", msg__.speed);
+      v__.field("speed_units", msg__.speed_units);
+      v__.field("custom", msg__.custom);
+    }
+
+    //! Visit the fields of TrajectoryPoint.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const TrajectoryPoint& msg__, V& v__)
+    {
+      (void)msg__;
+      (void)v__;
+    }
+
+    //! Visit the fields of FollowTrajectory.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const FollowTrajectory& msg__, V& v__)
+    {
+      v__.field("timeout", msg__.timeout);
+      v__.field("lat", msg__.lat);
+      v__.field("lon", msg__.lon);
+      v__.field("z", msg__.z);
+      v__.field("z_units", msg__.z_units);
+      v__.field("speed", msg__.speed);
+      v__.field("speed_units", msg__.speed_units);
+      v__.field("points", msg__.points);
+      v__.field("custom", msg__.custom);
+    }
+
+    //! Visit the fields of CustomManeuver.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const CustomManeuver& msg__, V& v__)
+    {
+      v__.field("timeout", msg__.timeout);
+      v__.field("name", msg__.name);
+      v__.field("custom", msg__.custom);
+    }
+
+    //! Visit the fields of VehicleFormationParticipant.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const VehicleFormationParticipant& msg__, V& v__)
+    {
+      (void)msg__;
+      (void)v__;
+    }
+
+    //! Visit the fields of VehicleFormation.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const VehicleFormation& msg__, V& v__)
+    {
+      v__.field("lat", msg__.lat);
+      v__.field("lon", msg__.lon);
+      v__.field("z", msg__.z);
+      v__.field("z_units", msg__.z_units);
+      v__.field("speed", msg__.speed);
+      v__.field("speed_units", msg__.speed_units);
+      v__.field("points", msg__.points);
+      v__.field("participants", msg__.participants);
+      v__.field("start_time", msg__.start_time);
+      v__.field("custom", msg__.custom);
+    }
+
+    //! Visit the fields of StopManeuver.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const StopManeuver& msg__, V& v__)
+    {
+      (void)msg__;
+      (void)v__;
+    }
+
+    //! Visit the fields of RegisterManeuver.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const RegisterManeuver& msg__, V& v__)
+    {
+      v__.field("mid", msg__.mid);
+    }
+
+    //! Visit the fields of ManeuverControlState.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const ManeuverControlState& msg__, V& v__)
+    {
+      v__.field("state", msg__.state);
+      v__.field("eta", msg__.eta);
+      v__.field("info", msg__.info);
+    }
+
+    //! Visit the fields of FollowSystem.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const FollowSystem& msg__, V& v__)
+    {
+      v__.field("system", msg__.system);
+      v__.field("duration", msg__.duration);
+      v__.field("speed", msg__.speed);
+      v__.field("speed_units", msg__.speed_units);
+      v__.field("x", msg__.x);
+      v__.field("y", msg__.y);
+      v__.field("z", msg__.z);
+      v__.field("z_units", msg__.z_units);
+    }
+
+    //! Visit the fields of CommsRelay.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const CommsRelay& msg__, V& v__)
+    {
+      v__.field("lat", msg__.lat);
+      v__.field("lon", msg__.lon);
+      v__.field("speed", msg__.speed);
+      v__.field("speed_units", msg__.speed_units);
+      v__.field("duration", msg__.duration);
+      v__.field("sys_a", msg__.sys_a);
+      v__.field("sys_b", msg__.sys_b);
+      v__.field("move_threshold", msg__.move_threshold);
+    }
+
+    //! Visit the fields of PolygonVertex.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const PolygonVertex& msg__, V& v__)
+    {
+      v__.field("lat", msg__.lat);
+      v__.field("lon", msg__.lon);
+    }
+
+    //! Visit the fields of CoverArea.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const CoverArea& msg__, V& v__)
+    {
+      v__.field("lat", msg__.lat);
+      v__.field("lon", msg__.lon);
+      v__.field("z", msg__.z);
+      v__.field("z_units", msg__.z_units);
+      v__.field("speed", msg__.speed);
+      v__.field("speed_units", msg__.speed_units);
+      v__.field("polygon", msg__.polygon);
+      v__.field("custom", msg__.custom);
+    }
+
+    //! Visit the fields of CompassCalibration.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const CompassCalibration& msg__, V& v__)
+    {
+      v__.field("timeout", msg__.timeout);
+      v__.field("lat", msg__.lat);
+      v__.field("lon", msg__.lon);
+      v__.field("z", msg__.z);
+      v__.field("z_units", msg__.z_units);
+      v__.field("pitch", msg__.pitch);
+      v__.field("amplitude", msg__.amplitude);
+      v__.field("duration", msg__.duration);
+      v__.field("speed", msg__.speed);
+      v__.field("speed_units", msg__.speed_units);
+      v__.field("radius", msg__.radius);
+      v__.field("direction", msg__.direction);
+      v__.field("custom", msg__.custom);
+    }
+
+    //! Visit the fields of FormationParameters.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const FormationParameters& msg__, V& v__)
+    {
+      v__.field("formation_name", msg__.formation_name);
+      v__.field("reference_frame", msg__.reference_frame);
+      v__.field("participants", msg__.participants);
+      v__.field("custom", msg__.custom);
+    }
+
+    //! Visit the fields of FormationPlanExecution.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const FormationPlanExecution& msg__, V& v__)
+    {
+      v__.field("group_name", msg__.group_name);
+      v__.field("formation_name", msg__.formation_name);
+      v__.field("plan_id", msg__.plan_id);
+      v__.field("description", msg__.description);
+      v__.field("leader_speed", msg__.leader_speed);
+      v__.field("leader_bank_lim", msg__.leader_bank_lim);
+      v__.field("pos_sim_err_lim", msg__.pos_sim_err_lim);
+      v__.field("pos_sim_err_wrn", msg__.pos_sim_err_wrn);
+      v__.field("pos_sim_err_timeout", msg__.pos_sim_err_timeout);
+      v__.field("converg_max", msg__.converg_max);
+      v__.field("converg_timeout", msg__.converg_timeout);
+      v__.field("comms_timeout", msg__.comms_timeout);
+      v__.field("turb_lim", msg__.turb_lim);
+      v__.field("custom", msg__.custom);
+    }
+
+    //! Visit the fields of FollowReference.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const FollowReference& msg__, V& v__)
+    {
+      v__.field("control_src", msg__.control_src);
+      v__.field("control_ent", msg__.control_ent);
+      v__.field("timeout", msg__.timeout);
+      v__.field("loiter_radius", msg__.loiter_radius);
+      v__.field("altitude_interval", msg__.altitude_interval);
+    }
+
+    //! Visit the fields of Reference.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const Reference& msg__, V& v__)
+    {
+      v__.field("flags", msg__.flags);
+      v__.field("speed", msg__.speed);
+      v__.field("z", msg__.z);
+      v__.field("lat", msg__.lat);
+      v__.field("lon", msg__.lon);
+      v__.field("radius", msg__.radius);
+    }
+
+    //! Visit the fields of FollowRefState.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const FollowRefState& msg__, V& v__)
+    {
+      v__.field("control_src", msg__.control_src);
+      v__.field("control_ent", msg__.control_ent);
+      v__.field("reference", msg__.reference);
+      v__.field("state", msg__.state);
+      v__.field("proximity", msg__.proximity);
+    }
+
+    //! Visit the fields of RelativeState.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const RelativeState& msg__, V& v__)
+    {
+      v__.field("s_id", msg__.s_id);
+      v__.field("dist", msg__.dist);
+      v__.field("err", msg__.err);
+      v__.field("ctrl_imp", msg__.ctrl_imp);
+    }
+
+    //! Visit the fields of FormationMonitor.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const FormationMonitor& msg__, V& v__)
+    {
+      (void)msg__;
+      (void)v__;
+    }
+
+    //! Visit the fields of Dislodge.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const Dislodge& msg__, V& v__)
+    {
+      v__.field("timeout", msg__.timeout);
+      v__.field("rpm", msg__.rpm);
+      v__.field("direction", msg__.direction);
+      v__.field("custom", msg__.custom);
+    }
+
+    //! Visit the fields of Formation.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const Formation& msg__, V& v__)
+    {
+      v__.field("formation_name", msg__.formation_name);
+      v__.field("type", msg__.type);
+      v__.field("op", msg__.op);
+      v__.field("group_name", msg__.group_name);
+      v__.field("plan_id", msg__.plan_id);
+      v__.field("description", msg__.description);
+      v__.field("reference_frame", msg__.reference_frame);
+      v__.field("participants", msg__.participants);
+      v__.field("leader_bank_lim", msg__.leader_bank_lim);
+      v__.field("leader_speed_min", msg__.leader_speed_min);
+      v__.field("leader_speed_max", msg__.leader_speed_max);
+      v__.field("leader_alt_min", msg__.leader_alt_min);
+      v__.field("leader_alt_max", msg__.leader_alt_max);
+      v__.field("pos_sim_err_lim", msg__.pos_sim_err_lim);
+      v__.field("pos_sim_err_wrn", msg__.pos_sim_err_wrn);
+      v__.field("pos_sim_err_timeout", msg__.pos_sim_err_timeout);
+      v__.field("converg_max", msg__.converg_max);
+      v__.field("converg_timeout", msg__.converg_timeout);
+      v__.field("comms_timeout", msg__.comms_timeout);
+      v__.field("turb_lim", msg__.turb_lim);
+      v__.field("custom", msg__.custom);
+    }
+
+    //! Visit the fields of Launch.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const Launch& msg__, V& v__)
+    {
+      v__.field("timeout", msg__.timeout);
+      v__.field("lat", msg__.lat);
+      v__.field("lon", msg__.lon);
+      v__.field("z", msg__.z);
+      v__.field("z_units", msg__.z_units);
+      v__.field("speed", msg__.speed);
+      v__.field("speed_units", msg__.speed_units);
+      v__.field("custom", msg__.custom);
+    }
+
+    //! Visit the fields of Drop.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const Drop& msg__, V& v__)
+    {
+      v__.field("timeout", msg__.timeout);
+      v__.field("lat", msg__.lat);
+      v__.field("lon", msg__.lon);
+      v__.field("z", msg__.z);
+      v__.field("z_units", msg__.z_units);
+      v__.field("speed", msg__.speed);
+      v__.field("speed_units", msg__.speed_units);
+      v__.field("custom", msg__.custom);
+    }
+
+    //! Visit the fields of ScheduledGoto.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const ScheduledGoto& msg__, V& v__)
+    {
+      v__.field("arrival_time", msg__.arrival_time);
+      v__.field("lat", msg__.lat);
+      v__.field("lon", msg__.lon);
+      v__.field("z", msg__.z);
+      v__.field("z_units", msg__.z_units);
+      v__.field("travel_z", msg__.travel_z);
+      v__.field("travel_z_units", msg__.travel_z_units);
+      v__.field("delayed", msg__.delayed);
+    }
+
+    //! Visit the fields of RowsCoverage.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const RowsCoverage& msg__, V& v__)
+    {
+      v__.field("lat", msg__.lat);
+      v__.field("lon", msg__.lon);
+      v__.field("z", msg__.z);
+      v__.field("z_units", msg__.z_units);
+      v__.field("speed", msg__.speed);
+      v__.field("speed_units", msg__.speed_units);
+      v__.field("bearing", msg__.bearing);
+      v__.field("cross_angle", msg__.cross_angle);
+      v__.field("width", msg__.width);
+      v__.field("length", msg__.length);
+      v__.field("coff", msg__.coff);
+      v__.field("angaperture", msg__.angaperture);
+      v__.field("range", msg__.range);
+      v__.field("overlap", msg__.overlap);
+      v__.field("flags", msg__.flags);
+      v__.field("custom", msg__.custom);
+    }
+
+    //! Visit the fields of Sample.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const Sample& msg__, V& v__)
+    {
+      v__.field("timeout", msg__.timeout);
+      v__.field("lat", msg__.lat);
+      v__.field("lon", msg__.lon);
+      v__.field("z", msg__.z);
+      v__.field("z_units", msg__.z_units);
+      v__.field("speed", msg__.speed);
+      v__.field("speed_units", msg__.speed_units);
+      v__.field("syringe0", msg__.syringe0);
+      v__.field("syringe1", msg__.syringe1);
+      v__.field("syringe2", msg__.syringe2);
+      v__.field("custom", msg__.custom);
+    }
+
+    //! Visit the fields of ImageTracking.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const ImageTracking& msg__, V& v__)
+    {
+      (void)msg__;
+      (void)v__;
+    }
+
+    //! Visit the fields of Takeoff.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const Takeoff& msg__, V& v__)
+    {
+      v__.field("lat", msg__.lat);
+      v__.field("lon", msg__.lon);
+      v__.field("z", msg__.z);
+      v__.field("z_units", msg__.z_units);
+      v__.field("speed", msg__.speed);
+      v__.field("speed_units", msg__.speed_units);
+      v__.field("takeoff_pitch", msg__.takeoff_pitch);
+      v__.field("custom", msg__.custom);
+    }
+
+    //! Visit the fields of Land.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const Land& msg__, V& v__)
+    {
+      v__.field("lat", msg__.lat);
+      v__.field("lon", msg__.lon);
+      v__.field("z", msg__.z);
+      v__.field("z_units", msg__.z_units);
+      v__.field("speed", msg__.speed);
+      v__.field("speed_units", msg__.speed_units);
+      v__.field("abort_z", msg__.abort_z);
+      v__.field("bearing", msg__.bearing);
+      v__.field("glide_slope", msg__.glide_slope);
+      v__.field("glide_slope_alt", msg__.glide_slope_alt);
+      v__.field("custom", msg__.custom);
+    }
+
+    //! Visit the fields of AutonomousSection.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const AutonomousSection& msg__, V& v__)
+    {
+      v__.field("lat", msg__.lat);
+      v__.field("lon", msg__.lon);
+      v__.field("speed", msg__.speed);
+      v__.field("speed_units", msg__.speed_units);
+      v__.field("limits", msg__.limits);
+      v__.field("max_depth", msg__.max_depth);
+      v__.field("min_alt", msg__.min_alt);
+      v__.field("time_limit", msg__.time_limit);
+      v__.field("area_limits", msg__.area_limits);
+      v__.field("controller", msg__.controller);
+      v__.field("custom", msg__.custom);
+    }
+
+    //! Visit the fields of FollowPoint.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const FollowPoint& msg__, V& v__)
+    {
+      v__.field("target", msg__.target);
+      v__.field("max_speed", msg__.max_speed);
+      v__.field("speed_units", msg__.speed_units);
+      v__.field("lat", msg__.lat);
+      v__.field("lon", msg__.lon);
+      v__.field("z", msg__.z);
+      v__.field("z_units", msg__.z_units);
+      v__.field("custom", msg__.custom);
+    }
+
+    //! Visit the fields of VehicleState.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const VehicleState& msg__, V& v__)
+    {
+      v__.field("op_mode", msg__.op_mode);
+      v__.field("error_count", msg__.error_count);
+      v__.field("error_ents", msg__.error_ents);
+      v__.field("maneuver_type", msg__.maneuver_type);
+      v__.field("maneuver_stime", msg__.maneuver_stime);
+      v__.field("maneuver_eta", msg__.maneuver_eta);
+      v__.field("control_loops", msg__.control_loops);
+      v__.field("flags", msg__.flags);
+      v__.field("last_error", msg__.last_error);
+      v__.field("last_error_time", msg__.last_error_time);
+    }
+
+    //! Visit the fields of VehicleCommand.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const VehicleCommand& msg__, V& v__)
+    {
+      v__.field("type", msg__.type);
+      v__.field("request_id", msg__.request_id);
+      v__.field("command", msg__.command);
+      v__.field("maneuver", msg__.maneuver);
+      v__.field("calib_time", msg__.calib_time);
+      v__.field("info", msg__.info);
+    }
+
+    //! Visit the fields of MonitorEntityState.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const MonitorEntityState& msg__, V& v__)
+    {
+      v__.field("command", msg__.command);
+      v__.field("entities", msg__.entities);
+    }
+
+    //! Visit the fields of EntityMonitoringState.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const EntityMonitoringState& msg__, V& v__)
+    {
+      v__.field("mcount", msg__.mcount);
+      v__.field("mnames", msg__.mnames);
+      v__.field("ecount", msg__.ecount);
+      v__.field("enames", msg__.enames);
+      v__.field("ccount", msg__.ccount);
+      v__.field("cnames", msg__.cnames);
+      v__.field("last_error", msg__.last_error);
+      v__.field("last_error_time", msg__.last_error_time);
+    }
+
+    //! Visit the fields of OperationalLimits.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const OperationalLimits& msg__, V& v__)
+    {
+      v__.field("mask", msg__.mask);
+      v__.field("max_depth", msg__.max_depth);
+      v__.field("min_altitude", msg__.min_altitude);
+      v__.field("max_altitude", msg__.max_altitude);
+      v__.field("min_speed", msg__.min_speed);
+      v__.field("max_speed", msg__.max_speed);
+      v__.field("max_vrate", msg__.max_vrate);
+      v__.field("lat", msg__.lat);
+      v__.field("lon", msg__.lon);
+      v__.field("orientation", msg__.orientation);
+      v__.field("width", msg__.width);
+      v__.field("length", msg__.length);
+    }
+
+    //! Visit the fields of GetOperationalLimits.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const GetOperationalLimits& msg__, V& v__)
+    {
+      (void)msg__;
+      (void)v__;
+    }
+
+    //! Visit the fields of Calibration.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const Calibration& msg__, V& v__)
+    {
+      v__.field("duration", msg__.duration);
+    }
+
+    //! Visit the fields of ControlLoops.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const ControlLoops& msg__, V& v__)
+    {
+      v__.field("enable", msg__.enable);
+      v__.field("mask", msg__.mask);
+      v__.field("scope_ref", msg__.scope_ref);
+    }
+
+    //! Visit the fields of VehicleMedium.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const VehicleMedium& msg__, V& v__)
+    {
+      v__.field("medium", msg__.medium);
+    }
+
+    //! Visit the fields of Collision.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const Collision& msg__, V& v__)
+    {
+      v__.field("value", msg__.value);
+      v__.field("type", msg__.type);
+    }
+
+    //! Visit the fields of FormState.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const FormState& msg__, V& v__)
+    {
+      v__.field("possimerr", msg__.possimerr);
+      v__.field("converg", msg__.converg);
+      v__.field("turbulence", msg__.turbulence);
+      v__.field("possimmon", msg__.possimmon);
+      v__.field("commmon", msg__.commmon);
+      v__.field("convergmon", msg__.convergmon);
+    }
+
+    //! Visit the fields of AutopilotMode.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const AutopilotMode& msg__, V& v__)
+    {
+      v__.field("autonomy", msg__.autonomy);
+      v__.field("mode", msg__.mode);
+    }
+
+    //! Visit the fields of FormationState.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const FormationState& msg__, V& v__)
+    {
+      v__.field("type", msg__.type);
+      v__.field("op", msg__.op);
+      v__.field("possimerr", msg__.possimerr);
+      v__.field("converg", msg__.converg);
+      v__.field("turbulence", msg__.turbulence);
+      v__.field("possimmon", msg__.possimmon);
+      v__.field("commmon", msg__.commmon);
+      v__.field("convergmon", msg__.convergmon);
+    }
+
+    //! Visit the fields of ReportControl.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const ReportControl& msg__, V& v__)
+    {
+      v__.field("op", msg__.op);
+      v__.field("comm_interface", msg__.comm_interface);
+      v__.field("period", msg__.period);
+      v__.field("sys_dst", msg__.sys_dst);
+    }
+
+    //! Visit the fields of Abort.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const Abort& msg__, V& v__)
+    {
+      (void)msg__;
+      (void)v__;
+    }
+
+    //! Visit the fields of PlanVariable.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const PlanVariable& msg__, V& v__)
+    {
+      v__.field("name", msg__.name);
+      v__.field("value", msg__.value);
+      v__.field("type", msg__.type);
+      v__.field("access", msg__.access);
+    }
+
+    //! Visit the fields of PlanManeuver.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const PlanManeuver& msg__, V& v__)
+    {
+      v__.field("maneuver_id", msg__.maneuver_id);
+      v__.field("data", msg__.data);
+      v__.field("start_actions", msg__.start_actions);
+      v__.field("end_actions", msg__.end_actions);
+    }
+
+    //! Visit the fields of PlanTransition.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const PlanTransition& msg__, V& v__)
+    {
+      v__.field("source_man", msg__.source_man);
+      v__.field("dest_man", msg__.dest_man);
+      v__.field("conditions", msg__.conditions);
+      v__.field("actions", msg__.actions);
+    }
+
+    //! Visit the fields of PlanSpecification.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const PlanSpecification& msg__, V& v__)
+    {
+      v__.field("plan_id", msg__.plan_id);
+      v__.field("description", msg__.description);
+      v__.field("vnamespace", msg__.vnamespace);
+      v__.field("variables", msg__.variables);
+      v__.field("start_man_id", msg__.start_man_id);
+      v__.field("maneuvers", msg__.maneuvers);
+      v__.field("transitions", msg__.transitions);
+      v__.field("start_actions", msg__.start_actions);
+      v__.field("end_actions", msg__.end_actions);
+    }
+
+    //! Visit the fields of EmergencyControl.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const EmergencyControl& msg__, V& v__)
+    {
+      v__.field("command", msg__.command);
+      v__.field("plan", msg__.plan);
+    }
+
+    //! Visit the fields of EmergencyControlState.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const EmergencyControlState& msg__, V& v__)
+    {
+      v__.field("state", msg__.state);
+      v__.field("plan_id", msg__.plan_id);
+      v__.field("comm_level", msg__.comm_level);
+    }
+
+    //! Visit the fields of PlanDB.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const PlanDB& msg__, V& v__)
+    {
+      v__.field("type", msg__.type);
+      v__.field("op", msg__.op);
+      v__.field("request_id", msg__.request_id);
+      v__.field("plan_id", msg__.plan_id);
+      v__.field("arg", msg__.arg);
+      v__.field("info", msg__.info);
+    }
+
+    //! Visit the fields of PlanDBInformation.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const PlanDBInformation& msg__, V& v__)
+    {
+      v__.field("plan_id", msg__.plan_id);
+      v__.field("plan_size", msg__.plan_size);
+      v__.field("change_time", msg__.change_time);
+      v__.field("change_sid", msg__.change_sid);
+      v__.field("change_sname", msg__.change_sname);
+      v__.field("md5", msg__.md5);
+    }
+
+    //! Visit the fields of PlanDBState.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const PlanDBState& msg__, V& v__)
+    {
+      v__.field("plan_count", msg__.plan_count);
+      v__.field("plan_size", msg__.plan_size);
+      v__.field("change_time", msg__.change_time);
+      v__.field("change_sid", msg__.change_sid);
+      v__.field("change_sname", msg__.change_sname);
+      v__.field("md5", msg__.md5);
+      v__.field("plans_info", msg__.plans_info);
+    }
+
+    //! Visit the fields of PlanControl.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const PlanControl& msg__, V& v__)
+    {
+      v__.field("type", msg__.type);
+      v__.field("op", msg__.op);
+      v__.field("request_id", msg__.request_id);
+      v__.field("plan_id", msg__.plan_id);
+      v__.field("flags", msg__.flags);
+      v__.field("arg", msg__.arg);
+      v__.field("info", msg__.info);
+    }
+
+    //! Visit the fields of PlanControlState.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const PlanControlState& msg__, V& v__)
+    {
+      v__.field("state", msg__.state);
+      v__.field("plan_id", msg__.plan_id);
+      v__.field("plan_eta", msg__.plan_eta);
+      v__.field("plan_progress", msg__.plan_progress);
+      v__.field("man_id", msg__.man_id);
+      v__.field("man_type", msg__.man_type);
+      v__.field("man_eta", msg__.man_eta);
+      v__.field("last_outcome", msg__.last_outcome);
+    }
+
+    //! Visit the fields of PlanGeneration.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const PlanGeneration& msg__, V& v__)
+    {
+      v__.field("cmd", msg__.cmd);
+      v__.field("op", msg__.op);
+      v__.field("plan_id", msg__.plan_id);
+      v__.field("params", msg__.params);
+    }
+
+    //! Visit the fields of LeaderState.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const LeaderState& msg__, V& v__)
+    {
+      v__.field("group_name", msg__.group_name);
+      v__.field("op", msg__.op);
+    }
+
+    //! Visit the fields of PlanStatistics.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const PlanStatistics& msg__, V& v__)
+    {
+      v__.field("plan_id", msg__.plan_id);
+      v__.field("type", msg__.type);
+      v__.field("properties", msg__.properties);
+      v__.field("durations", msg__.durations);
+      v__.field("distances", msg__.distances);
+      v__.field("actions", msg__.actions);
+      v__.field("fuel", msg__.fuel);
+    }
+
+    //! Visit the fields of ReportedState.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const ReportedState& msg__, V& v__)
+    {
+      v__.field("lat", msg__.lat);
+      v__.field("lon", msg__.lon);
+      v__.field("depth", msg__.depth);
+      v__.field("roll", msg__.roll);
+      v__.field("pitch", msg__.pitch);
+      v__.field("yaw", msg__.yaw);
+      v__.field("rcp_time", msg__.rcp_time);
+      v__.field("sid", msg__.sid);
+      v__.field("s_type", msg__.s_type);
+    }
+
+    //! Visit the fields of RemoteSensorInfo.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const RemoteSensorInfo& msg__, V& v__)
+    {
+      v__.field("id", msg__.id);
+      v__.field("sensor_class", msg__.sensor_class);
+      v__.field("lat", msg__.lat);
+      v__.field("lon", msg__.lon);
+      v__.field("alt", msg__.alt);
+      v__.field("heading", msg__.heading);
+      v__.field("data", msg__.data);
+    }
+
+    //! Visit the fields of MapPoint.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const MapPoint& msg__, V& v__)
+    {
+      v__.field("lat", msg__.lat);
+      v__.field("lon", msg__.lon);
+      v__.field("alt", msg__.alt);
+    }
+
+    //! Visit the fields of MapFeature.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const MapFeature& msg__, V& v__)
+    {
+      v__.field("id", msg__.id);
+      v__.field("feature_type", msg__.feature_type);
+      v__.field("rgb_red", msg__.rgb_red);
+      v__.field("rgb_green", msg__.rgb_green);
+      v__.field("rgb_blue", msg__.rgb_blue);
+      v__.field("feature", msg__.feature);
+    }
+
+    //! Visit the fields of Map.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const Map& msg__, V& v__)
+    {
+      v__.field("id", msg__.id);
+      v__.field("features", msg__.features);
+    }
+
+    //! Visit the fields of CcuEvent.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const CcuEvent& msg__, V& v__)
+    {
+      v__.field("type", msg__.type);
+      v__.field("id", msg__.id);
+      v__.field("arg", msg__.arg);
+    }
+
+    //! Visit the fields of VehicleLinks.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const VehicleLinks& msg__, V& v__)
+    {
+      v__.field("localname", msg__.localname);
+      v__.field("links", msg__.links);
+    }
+
+    //! Visit the fields of TrexObservation.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const TrexObservation& msg__, V& v__)
+    {
+      v__.field("timeline", msg__.timeline);
+      v__.field("predicate", msg__.predicate);
+      v__.field("attributes", msg__.attributes);
+    }
+
+    //! Visit the fields of TrexCommand.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const TrexCommand& msg__, V& v__)
+    {
+      v__.field("command", msg__.command);
+      v__.field("goal_id", msg__.goal_id);
+      v__.field("goal_xml", msg__.goal_xml);
+    }
+
+    //! Visit the fields of TrexAttribute.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const TrexAttribute& msg__, V& v__)
+    {
+      v__.field("name", msg__.name);
+      v__.field("attr_type", msg__.attr_type);
+      v__.field("min", msg__.min);
+      v__.field("max", msg__.max);
+    }
+
+    //! Visit the fields of TrexToken.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const TrexToken& msg__, V& v__)
+    {
+      v__.field("timeline", msg__.timeline);
+      v__.field("predicate", msg__.predicate);
+      v__.field("attributes", msg__.attributes);
+    }
+
+    //! Visit the fields of TrexOperation.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const TrexOperation& msg__, V& v__)
+    {
+      v__.field("op", msg__.op);
+      v__.field("goal_id", msg__.goal_id);
+      v__.field("token", msg__.token);
+    }
+
+    //! Visit the fields of TrexPlan.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const TrexPlan& msg__, V& v__)
+    {
+      v__.field("reactor", msg__.reactor);
+      v__.field("tokens", msg__.tokens);
+    }
+
+    //! Visit the fields of Event.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const Event& msg__, V& v__)
+    {
+      v__.field("topic", msg__.topic);
+      v__.field("data", msg__.data);
+    }
+
+    //! Visit the fields of CompressedImage.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const CompressedImage& msg__, V& v__)
+    {
+      v__.field("frameid", msg__.frameid);
+      v__.field("data", msg__.data);
+    }
+
+    //! Visit the fields of ImageTxSettings.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const ImageTxSettings& msg__, V& v__)
+    {
+      v__.field("fps", msg__.fps);
+      v__.field("quality", msg__.quality);
+      v__.field("reps", msg__.reps);
+      v__.field("tsize", msg__.tsize);
+    }
+
+    //! Visit the fields of RemoteState.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const RemoteState& msg__, V& v__)
+    {
+      v__.field("lat", msg__.lat);
+      v__.field("lon", msg__.lon);
+      v__.field("depth", msg__.depth);
+      v__.field("speed", msg__.speed);
+      v__.field("psi", msg__.psi);
+    }
+
+    //! Visit the fields of Target.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const Target& msg__, V& v__)
+    {
+      v__.field("label", msg__.label);
+      v__.field("lat", msg__.lat);
+      v__.field("lon", msg__.lon);
+      v__.field("z", msg__.z);
+      v__.field("z_units", msg__.z_units);
+      v__.field("cog", msg__.cog);
+      v__.field("sog", msg__.sog);
+    }
+
+    //! Visit the fields of EntityParameter.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const EntityParameter& msg__, V& v__)
+    {
+      v__.field("name", msg__.name);
+      v__.field("value", msg__.value);
+    }
+
+    //! Visit the fields of EntityParameters.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const EntityParameters& msg__, V& v__)
+    {
+      v__.field("name", msg__.name);
+      v__.field("params", msg__.params);
+    }
+
+    //! Visit the fields of QueryEntityParameters.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const QueryEntityParameters& msg__, V& v__)
+    {
+      v__.field("name", msg__.name);
+      v__.field("visibility", msg__.visibility);
+      v__.field("scope", msg__.scope);
+    }
+
+    //! Visit the fields of SetEntityParameters.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const SetEntityParameters& msg__, V& v__)
+    {
+      v__.field("name", msg__.name);
+      v__.field("params", msg__.params);
+    }
+
+    //! Visit the fields of SaveEntityParameters.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const SaveEntityParameters& msg__, V& v__)
+    {
+      v__.field("name", msg__.name);
+    }
+
+    //! Visit the fields of CreateSession.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const CreateSession& msg__, V& v__)
+    {
+      v__.field("timeout", msg__.timeout);
+    }
+
+    //! Visit the fields of CloseSession.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const CloseSession& msg__, V& v__)
+    {
+      v__.field("sessid", msg__.sessid);
+    }
+
+    //! Visit the fields of SessionSubscription.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const SessionSubscription& msg__, V& v__)
+    {
+      v__.field("sessid", msg__.sessid);
+      v__.field("messages", msg__.messages);
+    }
+
+    //! Visit the fields of SessionKeepAlive.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const SessionKeepAlive& msg__, V& v__)
+    {
+      v__.field("sessid", msg__.sessid);
+    }
+
+    //! Visit the fields of SessionStatus.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const SessionStatus& msg__, V& v__)
+    {
+      v__.field("sessid", msg__.sessid);
+      v__.field("status", msg__.status);
+    }
+
+    //! Visit the fields of PushEntityParameters.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const PushEntityParameters& msg__, V& v__)
+    {
+      v__.field("name", msg__.name);
+    }
+
+    //! Visit the fields of PopEntityParameters.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const PopEntityParameters& msg__, V& v__)
+    {
+      v__.field("name", msg__.name);
+    }
+
+    //! Visit the fields of IoEvent.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const IoEvent& msg__, V& v__)
+    {
+      v__.field("type", msg__.type);
+      v__.field("error", msg__.error);
+    }
+
+    //! Visit the fields of UamTxFrame.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const UamTxFrame& msg__, V& v__)
+    {
+      v__.field("seq", msg__.seq);
+      v__.field("sys_dst", msg__.sys_dst);
+      v__.field("flags", msg__.flags);
+      v__.field("data", msg__.data);
+    }
+
+    //! Visit the fields of UamRxFrame.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const UamRxFrame& msg__, V& v__)
+    {
+      v__.field("sys_src", msg__.sys_src);
+      v__.field("sys_dst", msg__.sys_dst);
+      v__.field("flags", msg__.flags);
+      v__.field("data", msg__.data);
+    }
+
+    //! Visit the fields of UamTxStatus.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const UamTxStatus& msg__, V& v__)
+    {
+      v__.field("seq", msg__.seq);
+      v__.field("value", msg__.value);
+      v__.field("error", msg__.error);
+    }
+
+    //! Visit the fields of UamRxRange.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const UamRxRange& msg__, V& v__)
+    {
+      v__.field("seq", msg__.seq);
+      v__.field("sys", msg__.sys);
+      v__.field("value", msg__.value);
+    }
+
+    //! Visit the fields of FormCtrlParam.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const FormCtrlParam& msg__, V& v__)
+    {
+      v__.field("action", msg__.action);
+      v__.field("longain", msg__.longain);
+      v__.field("latgain", msg__.latgain);
+      v__.field("bondthick", msg__.bondthick);
+      v__.field("leadgain", msg__.leadgain);
+      v__.field("deconflgain", msg__.deconflgain);
+    }
+
+    //! Visit the fields of FormationEval.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const FormationEval& msg__, V& v__)
+    {
+      v__.field("err_mean", msg__.err_mean);
+      v__.field("dist_min_abs", msg__.dist_min_abs);
+      v__.field("dist_min_mean", msg__.dist_min_mean);
+    }
+
+    //! Visit the fields of FormationControlParams.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const FormationControlParams& msg__, V& v__)
+    {
+      v__.field("action", msg__.action);
+      v__.field("lon_gain", msg__.lon_gain);
+      v__.field("lat_gain", msg__.lat_gain);
+      v__.field("bond_thick", msg__.bond_thick);
+      v__.field("lead_gain", msg__.lead_gain);
+      v__.field("deconfl_gain", msg__.deconfl_gain);
+      v__.field("accel_switch_gain", msg__.accel_switch_gain);
+      v__.field("safe_dist", msg__.safe_dist);
+      v__.field("deconflict_offset", msg__.deconflict_offset);
+      v__.field("accel_safe_margin", msg__.accel_safe_margin);
+      v__.field("accel_lim_x", msg__.accel_lim_x);
+    }
+
+    //! Visit the fields of FormationEvaluation.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const FormationEvaluation& msg__, V& v__)
+    {
+      v__.field("type", msg__.type);
+      v__.field("op", msg__.op);
+      v__.field("err_mean", msg__.err_mean);
+      v__.field("dist_min_abs", msg__.dist_min_abs);
+      v__.field("dist_min_mean", msg__.dist_min_mean);
+      v__.field("roll_rate_mean", msg__.roll_rate_mean);
+      v__.field("time", msg__.time);
+      v__.field("controlparams", msg__.controlparams);
+    }
+
+    //! Visit the fields of MessagePart.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const MessagePart& msg__, V& v__)
+    {
+      v__.field("uid", msg__.uid);
+      v__.field("frag_number", msg__.frag_number);
+      v__.field("num_frags", msg__.num_frags);
+      v__.field("data", msg__.data);
+    }
+
+    //! Visit the fields of NeptusBlob.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const NeptusBlob& msg__, V& v__)
+    {
+      v__.field("content_type", msg__.content_type);
+      v__.field("content", msg__.content);
+    }
+
+    //! Visit the fields of Aborted.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const Aborted& msg__, V& v__)
+    {
+      (void)msg__;
+      (void)v__;
+    }
+
+    //! Visit the fields of UsblAngles.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const UsblAngles& msg__, V& v__)
+    {
+      v__.field("target", msg__.target);
+      v__.field("bearing", msg__.bearing);
+      v__.field("elevation", msg__.elevation);
+    }
+
+    //! Visit the fields of UsblPosition.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const UsblPosition& msg__, V& v__)
+    {
+      v__.field("target", msg__.target);
+      v__.field("x", msg__.x);
+      v__.field("y", msg__.y);
+      v__.field("z", msg__.z);
+    }
+
+    //! Visit the fields of UsblFix.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const UsblFix& msg__, V& v__)
+    {
+      v__.field("target", msg__.target);
+    }
+
+    //! Visit the fields of ParametersXml.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const ParametersXml& msg__, V& v__)
+    {
+      v__.field("locale", msg__.locale);
+      v__.field("config", msg__.config);
+    }
+
+    //! Visit the fields of GetParametersXml.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const GetParametersXml& msg__, V& v__)
+    {
+      (void)msg__;
+      (void)v__;
+    }
+
+    //! Visit the fields of SetImageCoords.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const SetImageCoords& msg__, V& v__)
+    {
+      v__.field("camid", msg__.camid);
+      v__.field("x", msg__.x);
+      v__.field("y", msg__.y);
+    }
+
+    //! Visit the fields of GetImageCoords.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const GetImageCoords& msg__, V& v__)
+    {
+      v__.field("camid", msg__.camid);
+      v__.field("x", msg__.x);
+      v__.field("y", msg__.y);
+    }
+
+    //! Visit the fields of GetWorldCoordinates.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const GetWorldCoordinates& msg__, V& v__)
+    {
+      v__.field("tracking", msg__.tracking);
+      v__.field("lat", msg__.lat);
+      v__.field("lon", msg__.lon);
+      v__.field("x", msg__.x);
+      v__.field("y", msg__.y);
+      v__.field("z", msg__.z);
+    }
+
+    //! Visit the fields of UsblAnglesExtended.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const UsblAnglesExtended& msg__, V& v__)
+    {
+      v__.field("target", msg__.target);
+      v__.field("lbearing", msg__.lbearing);
+      v__.field("lelevation", msg__.lelevation);
+      v__.field("bearing", msg__.bearing);
+      v__.field("elevation", msg__.elevation);
+      v__.field("phi", msg__.phi);
+      v__.field("theta", msg__.theta);
+      v__.field("psi", msg__.psi);
+      v__.field("accuracy", msg__.accuracy);
+    }
+
+    //! Visit the fields of UsblPositionExtended.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const UsblPositionExtended& msg__, V& v__)
+    {
+      v__.field("target", msg__.target);
+      v__.field("x", msg__.x);
+      v__.field("y", msg__.y);
+      v__.field("z", msg__.z);
+      v__.field("n", msg__.n);
+      v__.field("e", msg__.e);
+      v__.field("d", msg__.d);
+      v__.field("phi", msg__.phi);
+      v__.field("theta", msg__.theta);
+      v__.field("psi", msg__.psi);
+      v__.field("accuracy", msg__.accuracy);
+    }
+
+    //! Visit the fields of UsblFixExtended.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const UsblFixExtended& msg__, V& v__)
+    {
+      v__.field("target", msg__.target);
+    }
+
+    //! Visit the fields of UsblModem.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const UsblModem& msg__, V& v__)
+    {
+      v__.field("name", msg__.name);
+      v__.field("lat", msg__.lat);
+      v__.field("lon", msg__.lon);
+      v__.field("z", msg__.z);
+      v__.field("z_units", msg__.z_units);
+    }
+
+    //! Visit the fields of UsblConfig.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const UsblConfig& msg__, V& v__)
+    {
+      v__.field("op", msg__.op);
+      v__.field("modems", msg__.modems);
+    }
+
+    //! Visit the fields of DissolvedOrganicMatter.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const DissolvedOrganicMatter& msg__, V& v__)
+    {
+      v__.field("value", msg__.value);
+      v__.field("type", msg__.type);
+    }
+
+    //! Visit the fields of OpticalBackscatter.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const OpticalBackscatter& msg__, V& v__)
+    {
+      v__.field("value", msg__.value);
+    }
+
+    //! Visit the fields of Tachograph.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const Tachograph& msg__, V& v__)
+    {
+      v__.field("timestamp_last_service", msg__.timestamp_last_service);
+      v__.field("time_next_service", msg__.time_next_service);
+      v__.field("time_motor_next_service", msg__.time_motor_next_service);
+      v__.field("time_idle_ground", msg__.time_idle_ground);
+      v__.field("time_idle_air", msg__.time_idle_air);
+      v__.field("time_idle_water", msg__.time_idle_water);
+      v__.field("time_idle_underwater", msg__.time_idle_underwater);
+      v__.field("time_idle_unknown", msg__.time_idle_unknown);
+      v__.field("time_motor_ground", msg__.time_motor_ground);
+      v__.field("time_motor_air", msg__.time_motor_air);
+      v__.field("time_motor_water", msg__.time_motor_water);
+      v__.field("time_motor_underwater", msg__.time_motor_underwater);
+      v__.field("time_motor_unknown", msg__.time_motor_unknown);
+      v__.field("rpm_min", msg__.rpm_min);
+      v__.field("rpm_max", msg__.rpm_max);
+      v__.field("depth_max", msg__.depth_max);
+    }
+
+    //! Visit the fields of ApmStatus.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const ApmStatus& msg__, V& v__)
+    {
+      v__.field("severity", msg__.severity);
+      v__.field("text", msg__.text);
+    }
+
+    //! Visit the fields of SadcReadings.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    template <typename V>
+    inline void
+    forEachField(const SadcReadings& msg__, V& v__)
+    {
+      v__.field("channel", msg__.channel);
+      v__.field("value", msg__.value);
+      v__.field("gain", msg__.gain);
+    }
+
+    //! Visit the fields of a message of runtime type,
+    //! dispatching to the statically typed visitor.
+    //! @param[in] msg__ message.
+    //! @param[in] v__ visitor.
+    //! @return true if the message type is known, false otherwise.
+    template <typename V>
+    inline bool
+    forEachField(const Message& msg__, V& v__)
+    {
+      switch (msg__.getId())
+      {
+        case 1:
+          forEachField(static_cast<const EntityState&>(msg__), v__);
+          return true;
+        case 2:
+          forEachField(static_cast<const QueryEntityState&>(msg__), v__);
+          return true;
+        case 3:
+          forEachField(static_cast<const EntityInfo&>(msg__), v__);
+          return true;
+        case 4:
+          forEachField(static_cast<const QueryEntityInfo&>(msg__), v__);
+          return true;
+        case 5:
+          forEachField(static_cast<const EntityList&>(msg__), v__);
+          return true;
+        case 7:
+          forEachField(static_cast<const CpuUsage&>(msg__), v__);
+          return true;
+        case 8:
+          forEachField(static_cast<const TransportBindings&>(msg__), v__);
+          return true;
+        case 9:
+          forEachField(static_cast<const RestartSystem&>(msg__), v__);
+          return true;
+        case 12:
+          forEachField(static_cast<const DevCalibrationControl&>(msg__), v__);
+          return true;
+        case 13:
+          forEachField(static_cast<const DevCalibrationState&>(msg__), v__);
+          return true;
+        case 14:
+          forEachField(static_cast<const EntityActivationState&>(msg__), v__);
+          return true;
+        case 15:
+          forEachField(static_cast<const QueryEntityActivationState&>(msg__), v__);
+          return true;
+        case 16:
+          forEachField(static_cast<const VehicleOperationalLimits&>(msg__), v__);
+          return true;
+        case 20:
+          forEachField(static_cast<const MsgList&>(msg__), v__);
+          return true;
+        case 50:
+          forEachField(static_cast<const SimulatedState&>(msg__), v__);
+          return true;
+        case 51:
+          forEachField(static_cast<const LeakSimulation&>(msg__), v__);
+          return true;
+        case 52:
+          forEachField(static_cast<const UASimulation&>(msg__), v__);
+          return true;
+        case 53:
+          forEachField(static_cast<const DynamicsSimParam&>(msg__), v__);
+          return true;
+        case 100:
+          forEachField(static_cast<const StorageUsage&>(msg__), v__);
+          return true;
+        case 101:
+          forEachField(static_cast<const CacheControl&>(msg__), v__);
+          return true;
+        case 102:
+          forEachField(static_cast<const LoggingControl&>(msg__), v__);
+          return true;
+        case 103:
+          forEachField(static_cast<const LogBookEntry&>(msg__), v__);
+          return true;
+        case 104:
+          forEachField(static_cast<const LogBookControl&>(msg__), v__);
+          return true;
+        case 105:
+          forEachField(static_cast<const ReplayControl&>(msg__), v__);
+          return true;
+        case 106:
+          forEachField(static_cast<const ClockControl&>(msg__), v__);
+          return true;
+        case 107:
+          forEachField(static_cast<const HistoricCTD&>(msg__), v__);
+          return true;
+        case 108:
+          forEachField(static_cast<const HistoricTelemetry&>(msg__), v__);
+          return true;
+        case 109:
+          forEachField(static_cast<const HistoricSonarData&>(msg__), v__);
+          return true;
+        case 110:
+          forEachField(static_cast<const HistoricEvent&>(msg__), v__);
+          return true;
+        case 150:
+          forEachField(static_cast<const Heartbeat&>(msg__), v__);
+          return true;
+        case 151:
+          forEachField(static_cast<const Announce&>(msg__), v__);
+          return true;
+        case 152:
+          forEachField(static_cast<const AnnounceService&>(msg__), v__);
+          return true;
+        case 153:
+          forEachField(static_cast<const RSSI&>(msg__), v__);
+          return true;
+        case 154:
+          forEachField(static_cast<const VSWR&>(msg__), v__);
+          return true;
+        case 155:
+          forEachField(static_cast<const LinkLevel&>(msg__), v__);
+          return true;
+        case 156:
+          forEachField(static_cast<const Sms&>(msg__), v__);
+          return true;
+        case 157:
+          forEachField(static_cast<const SmsTx&>(msg__), v__);
+          return true;
+        case 158:
+          forEachField(static_cast<const SmsRx&>(msg__), v__);
+          return true;
+        case 159:
+          forEachField(static_cast<const SmsState&>(msg__), v__);
+          return true;
+        case 160:
+          forEachField(static_cast<const TextMessage&>(msg__), v__);
+          return true;
+        case 170:
+          forEachField(static_cast<const IridiumMsgRx&>(msg__), v__);
+          return true;
+        case 171:
+          forEachField(static_cast<const IridiumMsgTx&>(msg__), v__);
+          return true;
+        case 172:
+          forEachField(static_cast<const IridiumTxStatus&>(msg__), v__);
+          return true;
+        case 180:
+          forEachField(static_cast<const GroupMembershipState&>(msg__), v__);
+          return true;
+        case 181:
+          forEachField(static_cast<const SystemGroup&>(msg__), v__);
+          return true;
+        case 182:
+          forEachField(static_cast<const LinkLatency&>(msg__), v__);
+          return true;
+        case 183:
+          forEachField(static_cast<const ExtendedRSSI&>(msg__), v__);
+          return true;
+        case 184:
+          forEachField(static_cast<const HistoricData&>(msg__), v__);
+          return true;
+        case 185:
+          forEachField(static_cast<const CompressedHistory&>(msg__), v__);
+          return true;
+        case 186:
+          forEachField(static_cast<const HistoricSample&>(msg__), v__);
+          return true;
+        case 187:
+          forEachField(static_cast<const HistoricDataQuery&>(msg__), v__);
+          return true;
+        case 188:
+          forEachField(static_cast<const RemoteCommand&>(msg__), v__);
+          return true;
+        case 200:
+          forEachField(static_cast<const LblRange&>(msg__), v__);
+          return true;
+        case 202:
+          forEachField(static_cast<const LblBeacon&>(msg__), v__);
+          return true;
+        case 203:
+          forEachField(static_cast<const LblConfig&>(msg__), v__);
+          return true;
+        case 206:
+          forEachField(static_cast<const AcousticMessage&>(msg__), v__);
+          return true;
+        case 211:
+          forEachField(static_cast<const AcousticOperation&>(msg__), v__);
+          return true;
+        case 212:
+          forEachField(static_cast<const AcousticSystemsQuery&>(msg__), v__);
+          return true;
+        case 213:
+          forEachField(static_cast<const AcousticSystems&>(msg__), v__);
+          return true;
+        case 214:
+          forEachField(static_cast<const AcousticLink&>(msg__), v__);
+          return true;
+        case 250:
+          forEachField(static_cast<const Rpm&>(msg__), v__);
+          return true;
+        case 251:
+          forEachField(static_cast<const Voltage&>(msg__), v__);
+          return true;
+        case 252:
+          forEachField(static_cast<const Current&>(msg__), v__);
+          return true;
+        case 253:
+          forEachField(static_cast<const GpsFix&>(msg__), v__);
+          return true;
+        case 254:
+          forEachField(static_cast<const EulerAngles&>(msg__), v__);
+          return true;
+        case 255:
+          forEachField(static_cast<const EulerAnglesDelta&>(msg__), v__);
+          return true;
+        case 256:
+          forEachField(static_cast<const AngularVelocity&>(msg__), v__);
+          return true;
+        case 257:
+          forEachField(static_cast<const Acceleration&>(msg__), v__);
+          return true;
+        case 258:
+          forEachField(static_cast<const MagneticField&>(msg__), v__);
+          return true;
+        case 259:
+          forEachField(static_cast<const GroundVelocity&>(msg__), v__);
+          return true;
+        case 260:
+          forEachField(static_cast<const WaterVelocity&>(msg__), v__);
+          return true;
+        case 261:
+          forEachField(static_cast<const VelocityDelta&>(msg__), v__);
+          return true;
+        case 262:
+          forEachField(static_cast<const Distance&>(msg__), v__);
+          return true;
+        case 263:
+          forEachField(static_cast<const Temperature&>(msg__), v__);
+          return true;
+        case 264:
+          forEachField(static_cast<const Pressure&>(msg__), v__);
+          return true;
+        case 265:
+          forEachField(static_cast<const Depth&>(msg__), v__);
+          return true;
+        case 266:
+          forEachField(static_cast<const DepthOffset&>(msg__), v__);
+          return true;
+        case 267:
+          forEachField(static_cast<const SoundSpeed&>(msg__), v__);
+          return true;
+        case 268:
+          forEachField(static_cast<const WaterDensity&>(msg__), v__);
+          return true;
+        case 269:
+          forEachField(static_cast<const Conductivity&>(msg__), v__);
+          return true;
+        case 270:
+          forEachField(static_cast<const Salinity&>(msg__), v__);
+          return true;
+        case 271:
+          forEachField(static_cast<const WindSpeed&>(msg__), v__);
+          return true;
+        case 272:
+          forEachField(static_cast<const RelativeHumidity&>(msg__), v__);
+          return true;
+        case 273:
+          forEachField(static_cast<const DevDataText&>(msg__), v__);
+          return true;
+        case 274:
+          forEachField(static_cast<const DevDataBinary&>(msg__), v__);
+          return true;
+        case 276:
+          forEachField(static_cast<const SonarData&>(msg__), v__);
+          return true;
+        case 277:
+          forEachField(static_cast<const Pulse&>(msg__), v__);
+          return true;
+        case 278:
+          forEachField(static_cast<const PulseDetectionControl&>(msg__), v__);
+          return true;
+        case 279:
+          forEachField(static_cast<const FuelLevel&>(msg__), v__);
+          return true;
+        case 280:
+          forEachField(static_cast<const GpsNavData&>(msg__), v__);
+          return true;
+        case 281:
+          forEachField(static_cast<const ServoPosition&>(msg__), v__);
+          return true;
+        case 282:
+          forEachField(static_cast<const DeviceState&>(msg__), v__);
+          return true;
+        case 283:
+          forEachField(static_cast<const BeamConfig&>(msg__), v__);
+          return true;
+        case 284:
+          forEachField(static_cast<const DataSanity&>(msg__), v__);
+          return true;
+        case 285:
+          forEachField(static_cast<const RhodamineDye&>(msg__), v__);
+          return true;
+        case 286:
+          forEachField(static_cast<const CrudeOil&>(msg__), v__);
+          return true;
+        case 287:
+          forEachField(static_cast<const FineOil&>(msg__), v__);
+          return true;
+        case 288:
+          forEachField(static_cast<const Turbidity&>(msg__), v__);
+          return true;
+        case 289:
+          forEachField(static_cast<const Chlorophyll&>(msg__), v__);
+          return true;
+        case 290:
+          forEachField(static_cast<const Fluorescein&>(msg__), v__);
+          return true;
+        case 291:
+          forEachField(static_cast<const Phycocyanin&>(msg__), v__);
+          return true;
+        case 292:
+          forEachField(static_cast<const Phycoerythrin&>(msg__), v__);
+          return true;
+        case 293:
+          forEachField(static_cast<const GpsFixRtk&>(msg__), v__);
+          return true;
+        case 294:
+          forEachField(static_cast<const ExternalNavData&>(msg__), v__);
+          return true;
+        case 295:
+          forEachField(static_cast<const DissolvedOxygen&>(msg__), v__);
+          return true;
+        case 296:
+          forEachField(static_cast<const AirSaturation&>(msg__), v__);
+          return true;
+        case 297:
+          forEachField(static_cast<const Throttle&>(msg__), v__);
+          return true;
+        case 298:
+          forEachField(static_cast<const PH&>(msg__), v__);
+          return true;
+        case 299:
+          forEachField(static_cast<const Redox&>(msg__), v__);
+          return true;
+        case 300:
+          forEachField(static_cast<const CameraZoom&>(msg__), v__);
+          return true;
+        case 301:
+          forEachField(static_cast<const SetThrusterActuation&>(msg__), v__);
+          return true;
+        case 302:
+          forEachField(static_cast<const SetServoPosition&>(msg__), v__);
+          return true;
+        case 303:
+          forEachField(static_cast<const SetControlSurfaceDeflection&>(msg__), v__);
+          return true;
+        case 304:
+          forEachField(static_cast<const RemoteActionsRequest&>(msg__), v__);
+          return true;
+        case 305:
+          forEachField(static_cast<const RemoteActions&>(msg__), v__);
+          return true;
+        case 306:
+          forEachField(static_cast<const ButtonEvent&>(msg__), v__);
+          return true;
+        case 307:
+          forEachField(static_cast<const LcdControl&>(msg__), v__);
+          return true;
+        case 308:
+          forEachField(static_cast<const PowerOperation&>(msg__), v__);
+          return true;
+        case 309:
+          forEachField(static_cast<const PowerChannelControl&>(msg__), v__);
+          return true;
+        case 310:
+          forEachField(static_cast<const QueryPowerChannelState&>(msg__), v__);
+          return true;
+        case 311:
+          forEachField(static_cast<const PowerChannelState&>(msg__), v__);
+          return true;
+        case 312:
+          forEachField(static_cast<const LedBrightness&>(msg__), v__);
+          return true;
+        case 313:
+          forEachField(static_cast<const QueryLedBrightness&>(msg__), v__);
+          return true;
+        case 314:
+          forEachField(static_cast<const SetLedBrightness&>(msg__), v__);
+          return true;
+        case 315:
+          forEachField(static_cast<const SetPWM&>(msg__), v__);
+          return true;
+        case 316:
+          forEachField(static_cast<const PWM&>(msg__), v__);
+          return true;
+        case 350:
+          forEachField(static_cast<const EstimatedState&>(msg__), v__);
+          return true;
+        case 351:
+          forEachField(static_cast<const EstimatedStreamVelocity&>(msg__), v__);
+          return true;
+        case 352:
+          forEachField(static_cast<const IndicatedSpeed&>(msg__), v__);
+          return true;
+        case 353:
+          forEachField(static_cast<const TrueSpeed&>(msg__), v__);
+          return true;
+        case 354:
+          forEachField(static_cast<const NavigationUncertainty&>(msg__), v__);
+          return true;
+        case 355:
+          forEachField(static_cast<const NavigationData&>(msg__), v__);
+          return true;
+        case 356:
+          forEachField(static_cast<const GpsFixRejection&>(msg__), v__);
+          return true;
+        case 357:
+          forEachField(static_cast<const LblRangeAcceptance&>(msg__), v__);
+          return true;
+        case 358:
+          forEachField(static_cast<const DvlRejection&>(msg__), v__);
+          return true;
+        case 360:
+          forEachField(static_cast<const LblEstimate&>(msg__), v__);
+          return true;
+        case 361:
+          forEachField(static_cast<const AlignmentState&>(msg__), v__);
+          return true;
+        case 362:
+          forEachField(static_cast<const GroupStreamVelocity&>(msg__), v__);
+          return true;
+        case 363:
+          forEachField(static_cast<const Airflow&>(msg__), v__);
+          return true;
+        case 400:
+          forEachField(static_cast<const DesiredHeading&>(msg__), v__);
+          return true;
+        case 401:
+          forEachField(static_cast<const DesiredZ&>(msg__), v__);
+          return true;
+        case 402:
+          forEachField(static_cast<const DesiredSpeed&>(msg__), v__);
+          return true;
+        case 403:
+          forEachField(static_cast<const DesiredRoll&>(msg__), v__);
+          return true;
+        case 404:
+          forEachField(static_cast<const DesiredPitch&>(msg__), v__);
+          return true;
+        case 405:
+          forEachField(static_cast<const DesiredVerticalRate&>(msg__), v__);
+          return true;
+        case 406:
+          forEachField(static_cast<const DesiredPath&>(msg__), v__);
+          return true;
+        case 407:
+          forEachField(static_cast<const DesiredControl&>(msg__), v__);
+          return true;
+        case 408:
+          forEachField(static_cast<const DesiredHeadingRate&>(msg__), v__);
+          return true;
+        case 409:
+          forEachField(static_cast<const DesiredVelocity&>(msg__), v__);
+          return true;
+        case 410:
+          forEachField(static_cast<const PathControlState&>(msg__), v__);
+          return true;
+        case 411:
+          forEachField(static_cast<const AllocatedControlTorques&>(msg__), v__);
+          return true;
+        case 412:
+          forEachField(static_cast<const ControlParcel&>(msg__), v__);
+          return true;
+        case 413:
+          forEachField(static_cast<const Brake&>(msg__), v__);
+          return true;
+        case 414:
+          forEachField(static_cast<const DesiredLinearState&>(msg__), v__);
+          return true;
+        case 415:
+          forEachField(static_cast<const DesiredThrottle&>(msg__), v__);
+          return true;
+        case 450:
+          forEachField(static_cast<const Goto&>(msg__), v__);
+          return true;
+        case 451:
+          forEachField(static_cast<const PopUp&>(msg__), v__);
+          return true;
+        case 452:
+          forEachField(static_cast<const Teleoperation&>(msg__), v__);
+          return true;
+        case 453:
+          forEachField(static_cast<const Loiter&>(msg__), v__);
+          return true;
+        case 454:
+          forEachField(static_cast<const IdleManeuver&>(msg__), v__);
+          return true;
+        case 455:
+          forEachField(static_cast<const LowLevelControl&>(msg__), v__);
+          return true;
+        case 456:
+          forEachField(static_cast<const Rows&>(msg__), v__);
+          return true;
+        case 457:
+          forEachField(static_cast<const FollowPath&>(msg__), v__);
+          return true;
+        case 458:
+          forEachField(static_cast<const PathPoint&>(msg__), v__);
+          return true;
+        case 459:
+          forEachField(static_cast<const YoYo&>(msg__), v__);
+          return true;
+        case 460:
+          forEachField(static_cast<const TeleoperationDone&>(msg__), v__);
+          return true;
+        case 461:
+          forEachField(static_cast<const StationKeeping&>(msg__), v__);
+          return true;
+        case 462:
+          forEachField(static_cast<const Elevator&>(msg__), v__);
+          return true;
+        case 463:
+          forEachField(static_cast<const FollowTrajectory&>(msg__), v__);
+          return true;
+        case 464:
+          forEachField(static_cast<const TrajectoryPoint&>(msg__), v__);
+          return true;
+        case 465:
+          forEachField(static_cast<const CustomManeuver&>(msg__), v__);
+          return true;
+        case 466:
+          forEachField(static_cast<const VehicleFormation&>(msg__), v__);
+          return true;
+        case 467:
+          forEachField(static_cast<const VehicleFormationParticipant&>(msg__), v__);
+          return true;
+        case 468:
+          forEachField(static_cast<const StopManeuver&>(msg__), v__);
+          return true;
+        case 469:
+          forEachField(static_cast<const RegisterManeuver&>(msg__), v__);
+          return true;
+        case 470:
+          forEachField(static_cast<const ManeuverControlState&>(msg__), v__);
+          return true;
+        case 471:
+          forEachField(static_cast<const FollowSystem&>(msg__), v__);
+          return true;
+        case 472:
+          forEachField(static_cast<const CommsRelay&>(msg__), v__);
+          return true;
+        case 473:
+          forEachField(static_cast<const CoverArea&>(msg__), v__);
+          return true;
+        case 474:
+          forEachField(static_cast<const PolygonVertex&>(msg__), v__);
+          return true;
+        case 475:
+          forEachField(static_cast<const CompassCalibration&>(msg__), v__);
+          return true;
+        case 476:
+          forEachField(static_cast<const FormationParameters&>(msg__), v__);
+          return true;
+        case 477:
+          forEachField(static_cast<const FormationPlanExecution&>(msg__), v__);
+          return true;
+        case 478:
+          forEachField(static_cast<const FollowReference&>(msg__), v__);
+          return true;
+        case 479:
+          forEachField(static_cast<const Reference&>(msg__), v__);
+          return true;
+        case 480:
+          forEachField(static_cast<const FollowRefState&>(msg__), v__);
+          return true;
+        case 481:
+          forEachField(static_cast<const FormationMonitor&>(msg__), v__);
+          return true;
+        case 482:
+          forEachField(static_cast<const RelativeState&>(msg__), v__);
+          return true;
+        case 483:
+          forEachField(static_cast<const Dislodge&>(msg__), v__);
+          return true;
+        case 484:
+          forEachField(static_cast<const Formation&>(msg__), v__);
+          return true;
+        case 485:
+          forEachField(static_cast<const Launch&>(msg__), v__);
+          return true;
+        case 486:
+          forEachField(static_cast<const Drop&>(msg__), v__);
+          return true;
+        case 487:
+          forEachField(static_cast<const ScheduledGoto&>(msg__), v__);
+          return true;
+        case 488:
+          forEachField(static_cast<const RowsCoverage&>(msg__), v__);
+          return true;
+        case 489:
+          forEachField(static_cast<const Sample&>(msg__), v__);
+          return true;
+        case 490:
+          forEachField(static_cast<const ImageTracking&>(msg__), v__);
+          return true;
+        case 491:
+          forEachField(static_cast<const Takeoff&>(msg__), v__);
+          return true;
+        case 492:
+          forEachField(static_cast<const Land&>(msg__), v__);
+          return true;
+        case 493:
+          forEachField(static_cast<const AutonomousSection&>(msg__), v__);
+          return true;
+        case 494:
+          forEachField(static_cast<const FollowPoint&>(msg__), v__);
+          return true;
+        case 500:
+          forEachField(static_cast<const VehicleState&>(msg__), v__);
+          return true;
+        case 501:
+          forEachField(static_cast<const VehicleCommand&>(msg__), v__);
+          return true;
+        case 502:
+          forEachField(static_cast<const MonitorEntityState&>(msg__), v__);
+          return true;
+        case 503:
+          forEachField(static_cast<const EntityMonitoringState&>(msg__), v__);
+          return true;
+        case 504:
+          forEachField(static_cast<const OperationalLimits&>(msg__), v__);
+          return true;
+        case 505:
+          forEachField(static_cast<const GetOperationalLimits&>(msg__), v__);
+          return true;
+        case 506:
+          forEachField(static_cast<const Calibration&>(msg__), v__);
+          return true;
+        case 507:
+          forEachField(static_cast<const ControlLoops&>(msg__), v__);
+          return true;
+        case 508:
+          forEachField(static_cast<const VehicleMedium&>(msg__), v__);
+          return true;
+        case 509:
+          forEachField(static_cast<const Collision&>(msg__), v__);
+          return true;
+        case 510:
+          forEachField(static_cast<const FormState&>(msg__), v__);
+          return true;
+        case 511:
+          forEachField(static_cast<const AutopilotMode&>(msg__), v__);
+          return true;
+        case 512:
+          forEachField(static_cast<const FormationState&>(msg__), v__);
+          return true;
+        case 513:
+          forEachField(static_cast<const ReportControl&>(msg__), v__);
+          return true;
+        case 550:
+          forEachField(static_cast<const Abort&>(msg__), v__);
+          return true;
+        case 551:
+          forEachField(static_cast<const PlanSpecification&>(msg__), v__);
+          return true;
+        case 552:
+          forEachField(static_cast<const PlanManeuver&>(msg__), v__);
+          return true;
+        case 553:
+          forEachField(static_cast<const PlanTransition&>(msg__), v__);
+          return true;
+        case 554:
+          forEachField(static_cast<const EmergencyControl&>(msg__), v__);
+          return true;
+        case 555:
+          forEachField(static_cast<const EmergencyControlState&>(msg__), v__);
+          return true;
+        case 556:
+          forEachField(static_cast<const PlanDB&>(msg__), v__);
+          return true;
+        case 557:
+          forEachField(static_cast<const PlanDBState&>(msg__), v__);
+          return true;
+        case 558:
+          forEachField(static_cast<const PlanDBInformation&>(msg__), v__);
+          return true;
+        case 559:
+          forEachField(static_cast<const PlanControl&>(msg__), v__);
+          return true;
+        case 560:
+          forEachField(static_cast<const PlanControlState&>(msg__), v__);
+          return true;
+        case 561:
+          forEachField(static_cast<const PlanVariable&>(msg__), v__);
+          return true;
+        case 562:
+          forEachField(static_cast<const PlanGeneration&>(msg__), v__);
+          return true;
+        case 563:
+          forEachField(static_cast<const LeaderState&>(msg__), v__);
+          return true;
+        case 564:
+          forEachField(static_cast<const PlanStatistics&>(msg__), v__);
+          return true;
+        case 600:
+          forEachField(static_cast<const ReportedState&>(msg__), v__);
+          return true;
+        case 601:
+          forEachField(static_cast<const RemoteSensorInfo&>(msg__), v__);
+          return true;
+        case 602:
+          forEachField(static_cast<const Map&>(msg__), v__);
+          return true;
+        case 603:
+          forEachField(static_cast<const MapFeature&>(msg__), v__);
+          return true;
+        case 604:
+          forEachField(static_cast<const MapPoint&>(msg__), v__);
+          return true;
+        case 606:
+          forEachField(static_cast<const CcuEvent&>(msg__), v__);
+          return true;
+        case 650:
+          forEachField(static_cast<const VehicleLinks&>(msg__), v__);
+          return true;
+        case 651:
+          forEachField(static_cast<const TrexObservation&>(msg__), v__);
+          return true;
+        case 652:
+          forEachField(static_cast<const TrexCommand&>(msg__), v__);
+          return true;
+        case 655:
+          forEachField(static_cast<const TrexOperation&>(msg__), v__);
+          return true;
+        case 656:
+          forEachField(static_cast<const TrexAttribute&>(msg__), v__);
+          return true;
+        case 657:
+          forEachField(static_cast<const TrexToken&>(msg__), v__);
+          return true;
+        case 658:
+          forEachField(static_cast<const TrexPlan&>(msg__), v__);
+          return true;
+        case 660:
+          forEachField(static_cast<const Event&>(msg__), v__);
+          return true;
+        case 702:
+          forEachField(static_cast<const CompressedImage&>(msg__), v__);
+          return true;
+        case 703:
+          forEachField(static_cast<const ImageTxSettings&>(msg__), v__);
+          return true;
+        case 750:
+          forEachField(static_cast<const RemoteState&>(msg__), v__);
+          return true;
+        case 800:
+          forEachField(static_cast<const Target&>(msg__), v__);
+          return true;
+        case 801:
+          forEachField(static_cast<const EntityParameter&>(msg__), v__);
+          return true;
+        case 802:
+          forEachField(static_cast<const EntityParameters&>(msg__), v__);
+          return true;
+        case 803:
+          forEachField(static_cast<const QueryEntityParameters&>(msg__), v__);
+          return true;
+        case 804:
+          forEachField(static_cast<const SetEntityParameters&>(msg__), v__);
+          return true;
+        case 805:
+          forEachField(static_cast<const SaveEntityParameters&>(msg__), v__);
+          return true;
+        case 806:
+          forEachField(static_cast<const CreateSession&>(msg__), v__);
+          return true;
+        case 807:
+          forEachField(static_cast<const CloseSession&>(msg__), v__);
+          return true;
+        case 808:
+          forEachField(static_cast<const SessionSubscription&>(msg__), v__);
+          return true;
+        case 809:
+          forEachField(static_cast<const SessionKeepAlive&>(msg__), v__);
+          return true;
+        case 810:
+          forEachField(static_cast<const SessionStatus&>(msg__), v__);
+          return true;
+        case 811:
+          forEachField(static_cast<const PushEntityParameters&>(msg__), v__);
+          return true;
+        case 812:
+          forEachField(static_cast<const PopEntityParameters&>(msg__), v__);
+          return true;
+        case 813:
+          forEachField(static_cast<const IoEvent&>(msg__), v__);
+          return true;
+        case 814:
+          forEachField(static_cast<const UamTxFrame&>(msg__), v__);
+          return true;
+        case 815:
+          forEachField(static_cast<const UamRxFrame&>(msg__), v__);
+          return true;
+        case 816:
+          forEachField(static_cast<const UamTxStatus&>(msg__), v__);
+          return true;
+        case 817:
+          forEachField(static_cast<const UamRxRange&>(msg__), v__);
+          return true;
+        case 820:
+          forEachField(static_cast<const FormCtrlParam&>(msg__), v__);
+          return true;
+        case 821:
+          forEachField(static_cast<const FormationEval&>(msg__), v__);
+          return true;
+        case 822:
+          forEachField(static_cast<const FormationControlParams&>(msg__), v__);
+          return true;
+        case 823:
+          forEachField(static_cast<const FormationEvaluation&>(msg__), v__);
+          return true;
+        case 877:
+          forEachField(static_cast<const MessagePart&>(msg__), v__);
+          return true;
+        case 888:
+          forEachField(static_cast<const NeptusBlob&>(msg__), v__);
+          return true;
+        case 889:
+          forEachField(static_cast<const Aborted&>(msg__), v__);
+          return true;
+        case 890:
+          forEachField(static_cast<const UsblAngles&>(msg__), v__);
+          return true;
+        case 891:
+          forEachField(static_cast<const UsblPosition&>(msg__), v__);
+          return true;
+        case 892:
+          forEachField(static_cast<const UsblFix&>(msg__), v__);
+          return true;
+        case 893:
+          forEachField(static_cast<const ParametersXml&>(msg__), v__);
+          return true;
+        case 894:
+          forEachField(static_cast<const GetParametersXml&>(msg__), v__);
+          return true;
+        case 895:
+          forEachField(static_cast<const SetImageCoords&>(msg__), v__);
+          return true;
+        case 896:
+          forEachField(static_cast<const GetImageCoords&>(msg__), v__);
+          return true;
+        case 897:
+          forEachField(static_cast<const GetWorldCoordinates&>(msg__), v__);
+          return true;
+        case 898:
+          forEachField(static_cast<const UsblAnglesExtended&>(msg__), v__);
+          return true;
+        case 899:
+          forEachField(static_cast<const UsblPositionExtended&>(msg__), v__);
+          return true;
+        case 900:
+          forEachField(static_cast<const UsblFixExtended&>(msg__), v__);
+          return true;
+        case 901:
+          forEachField(static_cast<const UsblModem&>(msg__), v__);
+          return true;
+        case 902:
+          forEachField(static_cast<const UsblConfig&>(msg__), v__);
+          return true;
+        case 903:
+          forEachField(static_cast<const DissolvedOrganicMatter&>(msg__), v__);
+          return true;
+        case 904:
+          forEachField(static_cast<const OpticalBackscatter&>(msg__), v__);
+          return true;
+        case 905:
+          forEachField(static_cast<const Tachograph&>(msg__), v__);
+          return true;
+        case 906:
+          forEachField(static_cast<const ApmStatus&>(msg__), v__);
+          return true;
+        case 907:
+          forEachField(static_cast<const SadcReadings&>(msg__), v__);
+          return true;
+        default:
+          return false;
+      }
+    }
+  }
+}
+
+#endif
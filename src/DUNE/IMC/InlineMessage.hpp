@@ -88,6 +88,15 @@ namespace DUNE
         set(*msg);
       }
 
+      //! Set the inline message without copying it. This instance
+      //! takes ownership of 'msg' and will release it.
+      //! @param[in] msg message.
+      void
+      take(Type* msg)
+      {
+        replace(msg);
+      }
+
       void
       clear(void)
       {
@@ -170,6 +179,9 @@ namespace DUNE
       InlineMessage&
       operator=(const InlineMessage& other)
       {
+        if (&other == this)
+          return *this;
+
         clear();
 
         if (other.m_msg != NULL)
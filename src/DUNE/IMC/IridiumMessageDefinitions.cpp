@@ -33,6 +33,11 @@
 // Local headers.
 #include "IridiumMessageDefinitions.hpp"
 
+// DUNE headers.
+#include <DUNE/Compression/Factory.hpp>
+#include <DUNE/Compression/Compressor.hpp>
+#include <DUNE/Compression/Decompressor.hpp>
+
 namespace DUNE
 {
   namespace IMC
@@ -79,6 +84,11 @@ namespace DUNE
             ret->deserialize(ptr, msg->data.size());
             return ret;
 
+        case(ID_BUNDLE):
+            ret = (IridiumBundle *) new IridiumBundle();
+            ret->deserialize(ptr, msg->data.size());
+            return ret;
+
         default:
           std::cerr << "Ignoring unrecognized Iridium message (" << msg_id
               << ")" << std::endl;
@@ -353,5 +363,110 @@ namespace DUNE
 
       return buffer - start;
     }
+
+    IridiumBundle::IridiumBundle()
+    {
+      msg_id = ID_BUNDLE;
+    }
+
+    int
+    IridiumBundle::getSerializationSize(void)
+    {
+      // Header, flags and one length prefix per member.
+      int size = 3 * sizeof(uint16_t) + sizeof(uint8_t);
+      for (size_t i = 0; i < payloads.size(); i++)
+        size += sizeof(uint16_t) + payloads[i].size();
+
+      return size;
+    }
+
+    int
+    IridiumBundle::serialize(uint8_t * buffer)
+    {
+      uint8_t* start = buffer;
+      buffer += DUNE::IMC::serialize(source, buffer);
+      buffer += DUNE::IMC::serialize(destination, buffer);
+      buffer += DUNE::IMC::serialize(msg_id, buffer);
+
+      // Payload block: each member prefixed by its length.
+      std::vector<uint8_t> block;
+      for (size_t i = 0; i < payloads.size(); i++)
+      {
+        uint8_t prefix[sizeof(uint16_t)];
+        DUNE::IMC::serialize((uint16_t)payloads[i].size(), prefix);
+        block.insert(block.end(), prefix, prefix + sizeof(prefix));
+        block.insert(block.end(), payloads[i].begin(), payloads[i].end());
+      }
+
+      // Deflate the block when that makes it smaller.
+      uint8_t flags = 0;
+      if (!block.empty())
+      {
+        Compression::Compressor* comp =
+        Compression::Factory::compressor(Compression::METHOD_ZLIB);
+        Utils::ByteBuffer packed = comp->compress((char*)&block[0], block.size());
+        delete comp;
+
+        if (packed.getSize() < block.size())
+        {
+          flags |= 0x01;
+          block.assign(packed.getBuffer(), packed.getBuffer() + packed.getSize());
+        }
+      }
+
+      buffer += DUNE::IMC::serialize(flags, buffer);
+      if (!block.empty())
+      {
+        std::memcpy(buffer, &block[0], block.size());
+        buffer += block.size();
+      }
+
+      return buffer - start;
+    }
+
+    int
+    IridiumBundle::deserialize(uint8_t * buffer, uint16_t length)
+    {
+      uint8_t* start = buffer;
+      uint8_t flags = 0;
+      buffer += DUNE::IMC::deserialize(source, buffer, length);
+      buffer += DUNE::IMC::deserialize(destination, buffer, length);
+      buffer += DUNE::IMC::deserialize(msg_id, buffer, length);
+      buffer += DUNE::IMC::deserialize(flags, buffer, length);
+
+      std::vector<uint8_t> block(buffer, buffer + length);
+      buffer += length;
+
+      if ((flags & 0x01) && !block.empty())
+      {
+        Compression::Decompressor* dec =
+        Compression::Factory::decompressor(Compression::METHOD_ZLIB);
+        Utils::ByteBuffer plain = dec->decompress((char*)&block[0], block.size());
+        delete dec;
+        block.assign(plain.getBuffer(), plain.getBuffer() + plain.getSize());
+      }
+
+      payloads.clear();
+      size_t pos = 0;
+      while (pos + sizeof(uint16_t) <= block.size())
+      {
+        uint16_t len = 0;
+        uint16_t rem = sizeof(uint16_t);
+        DUNE::IMC::deserialize(len, &block[pos], rem);
+        pos += sizeof(uint16_t);
+
+        if (pos + len > block.size())
+        {
+          std::cerr << "ERROR parsing Iridium bundle: truncated member" << std::endl;
+          break;
+        }
+
+        payloads.push_back(std::vector<uint8_t>(block.begin() + pos,
+                                                block.begin() + pos + len));
+        pos += len;
+      }
+
+      return buffer - start;
+    }
   } /* namespace IMC */
 } /* namespace DUNE */
@@ -49,6 +49,7 @@ namespace DUNE
     static const uint16_t ID_IRIDIUMCMD = 2005;
     static const uint16_t ID_IMCMESSAGE = 2010;
     static const uint16_t ID_EXTDEVUPDATE = 2011;
+    static const uint16_t ID_BUNDLE = 2012;
 
     typedef struct {
       uint16_t id;
@@ -145,6 +146,23 @@ namespace DUNE
       ~IridiumCommand(){};
     };
 
+    //! Extension to the IMC protocol used to pack several Iridium messages
+    //! into a single SBD payload (each member is itself a serialized Iridium
+    //! message, prefixed by its length). The payload block is deflated when
+    //! that makes it smaller.
+    class IridiumBundle : public IridiumMessage
+    {
+    public:
+      IridiumBundle();
+      int serialize(uint8_t * buffer);
+      int deserialize(uint8_t* data, uint16_t len);
+      //! Serialized member messages.
+      std::vector<std::vector<uint8_t> > payloads;
+      //! Retrieve the serialization size upper bound (no compression).
+      int getSerializationSize(void);
+      ~IridiumBundle(){};
+    };
+
   } /* namespace IMC */
 } /* namespace DUNE */
 #endif /* IRIDIUMMESSAGEDEFINITIONS_HPP_ */
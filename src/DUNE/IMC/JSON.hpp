@@ -34,6 +34,8 @@
 #include <ostream>
 #include <vector>
 #include <string>
+#include <cstring>
+#include <cstdio>
 
 // DUNE headers.
 #include <DUNE/Config.hpp>
@@ -49,6 +51,133 @@ namespace DUNE
     const char*
     indentJSON(unsigned count);
 
+    //! Write the decimal digits of an unsigned integer.
+    //! @param[in] ptr output position.
+    //! @param[in] value value to write.
+    //! @return position past the last digit.
+    inline char*
+    writeJSONUnsigned(char* ptr, uint64_t value)
+    {
+      char tmp[20];
+      char* dgt = tmp;
+
+      do
+      {
+        *dgt++ = (char)('0' + (value % 10));
+        value /= 10;
+      }
+      while (value != 0);
+
+      while (dgt != tmp)
+        *ptr++ = *--dgt;
+
+      return ptr;
+    }
+
+    //! Write one field with an already formatted value in a single
+    //! stream operation, bypassing the per-token formatting of
+    //! operator<<.
+    //! @param[in] os output stream.
+    //! @param[in] label label.
+    //! @param[in] value formatted value.
+    //! @param[in] value_len length of the formatted value.
+    //! @param[in] nindent number of indentation spaces.
+    //! @param[in] prefix prefix character.
+    inline void
+    writeJSONField(std::ostream& os, const char* label, const char* value,
+                   size_t value_len, unsigned nindent, char prefix)
+    {
+      // Large enough for the longest indent, label and numeric value.
+      char bfr[128];
+      char* ptr = bfr;
+
+      *ptr++ = prefix;
+      *ptr++ = '\n';
+
+      const char* indent = indentJSON(nindent);
+      while (*indent)
+        *ptr++ = *indent++;
+
+      *ptr++ = '"';
+      while (*label)
+        *ptr++ = *label++;
+      *ptr++ = '"';
+      *ptr++ = ':';
+      *ptr++ = ' ';
+      *ptr++ = '"';
+
+      std::memcpy(ptr, value, value_len);
+      ptr += value_len;
+      *ptr++ = '"';
+
+      os.write(bfr, ptr - bfr);
+    }
+
+    //! Write one field with an unsigned integer value.
+    //! @param[in] os output stream.
+    //! @param[in] label label.
+    //! @param[in] value value.
+    //! @param[in] nindent number of indentation spaces.
+    //! @param[in] prefix prefix character.
+    inline void
+    writeJSONUnsignedField(std::ostream& os, const char* label, uint64_t value,
+                           unsigned nindent, char prefix)
+    {
+      char tmp[20];
+      char* end = writeJSONUnsigned(tmp, value);
+      writeJSONField(os, label, tmp, end - tmp, nindent, prefix);
+    }
+
+    //! Write one field with a signed integer value.
+    //! @param[in] os output stream.
+    //! @param[in] label label.
+    //! @param[in] value value.
+    //! @param[in] nindent number of indentation spaces.
+    //! @param[in] prefix prefix character.
+    inline void
+    writeJSONSignedField(std::ostream& os, const char* label, int64_t value,
+                         unsigned nindent, char prefix)
+    {
+      char tmp[21];
+      char* ptr = tmp;
+
+      uint64_t mag = (uint64_t)value;
+      if (value < 0)
+      {
+        *ptr++ = '-';
+        mag = (uint64_t)0 - mag;
+      }
+
+      char* end = writeJSONUnsigned(ptr, mag);
+      writeJSONField(os, label, tmp, end - tmp, nindent, prefix);
+    }
+
+    //! Write one field with a floating point value, matching the 12
+    //! significant digits used by Message::toJSON.
+    //! @param[in] os output stream.
+    //! @param[in] label label.
+    //! @param[in] value value.
+    //! @param[in] nindent number of indentation spaces.
+    //! @param[in] prefix prefix character.
+    inline void
+    writeJSONFloatField(std::ostream& os, const char* label, fp64_t value,
+                        unsigned nindent, char prefix)
+    {
+      // Values without a fractional part - zeros above all - are very
+      // common and take the integer path, sparing the printf
+      // machinery.
+      if (value == (fp64_t)(int64_t)value
+          && value >= -9.0e15 && value <= 9.0e15)
+      {
+        writeJSONSignedField(os, label, (int64_t)value, nindent, prefix);
+        return;
+      }
+
+      char tmp[32];
+      int len = std::sprintf(tmp, "%.12g", value);
+      writeJSONField(os, label, tmp, len, nindent, prefix);
+    }
+
     //! Convert a generic type to a JSON string.
     //! @param[in] os output stream.
     //! @param[in] label label.
@@ -73,8 +202,7 @@ namespace DUNE
     inline void
     toJSON(std::ostream& os, const char* label, const int8_t& value, unsigned nindent, char prefix)
     {
-      const char* indent = indentJSON(nindent);
-      os << prefix << '\n' << indent << '"' << label << "\": \"" << (int)value << '"';
+      writeJSONSignedField(os, label, value, nindent, prefix);
     }
 
     //! Convert an 8 bit unsigned integer type to a JSON string.
@@ -87,8 +215,113 @@ namespace DUNE
     inline void
     toJSON(std::ostream& os, const char* label, const uint8_t& value, unsigned nindent, char prefix)
     {
-      const char* indent = indentJSON(nindent);
-      os << prefix << '\n' << indent << '"' << label << "\": \"" << (unsigned)value << '"';
+      writeJSONUnsignedField(os, label, value, nindent, prefix);
+    }
+
+    //! Convert a 16 bit signed integer type to a JSON string.
+    //! @param[in] os output stream.
+    //! @param[in] label label.
+    //! @param[in] value value.
+    //! @param[in] nindent number of indentation spaces.
+    //! @param[in] prefix prefix character.
+    template <>
+    inline void
+    toJSON(std::ostream& os, const char* label, const int16_t& value, unsigned nindent, char prefix)
+    {
+      writeJSONSignedField(os, label, value, nindent, prefix);
+    }
+
+    //! Convert a 16 bit unsigned integer type to a JSON string.
+    //! @param[in] os output stream.
+    //! @param[in] label label.
+    //! @param[in] value value.
+    //! @param[in] nindent number of indentation spaces.
+    //! @param[in] prefix prefix character.
+    template <>
+    inline void
+    toJSON(std::ostream& os, const char* label, const uint16_t& value, unsigned nindent, char prefix)
+    {
+      writeJSONUnsignedField(os, label, value, nindent, prefix);
+    }
+
+    //! Convert a 32 bit signed integer type to a JSON string.
+    //! @param[in] os output stream.
+    //! @param[in] label label.
+    //! @param[in] value value.
+    //! @param[in] nindent number of indentation spaces.
+    //! @param[in] prefix prefix character.
+    template <>
+    inline void
+    toJSON(std::ostream& os, const char* label, const int32_t& value, unsigned nindent, char prefix)
+    {
+      writeJSONSignedField(os, label, value, nindent, prefix);
+    }
+
+    //! Convert a 32 bit unsigned integer type to a JSON string.
+    //! @param[in] os output stream.
+    //! @param[in] label label.
+    //! @param[in] value value.
+    //! @param[in] nindent number of indentation spaces.
+    //! @param[in] prefix prefix character.
+    template <>
+    inline void
+    toJSON(std::ostream& os, const char* label, const uint32_t& value, unsigned nindent, char prefix)
+    {
+      writeJSONUnsignedField(os, label, value, nindent, prefix);
+    }
+
+    //! Convert a 64 bit signed integer type to a JSON string.
+    //! @param[in] os output stream.
+    //! @param[in] label label.
+    //! @param[in] value value.
+    //! @param[in] nindent number of indentation spaces.
+    //! @param[in] prefix prefix character.
+    template <>
+    inline void
+    toJSON(std::ostream& os, const char* label, const int64_t& value, unsigned nindent, char prefix)
+    {
+      writeJSONSignedField(os, label, value, nindent, prefix);
+    }
+
+    //! Convert a 64 bit unsigned integer type to a JSON string.
+    //! @param[in] os output stream.
+    //! @param[in] label label.
+    //! @param[in] value value.
+    //! @param[in] nindent number of indentation spaces.
+    //! @param[in] prefix prefix character.
+    template <>
+    inline void
+    toJSON(std::ostream& os, const char* label, const uint64_t& value, unsigned nindent, char prefix)
+    {
+      writeJSONUnsignedField(os, label, value, nindent, prefix);
+    }
+
+    //! Convert a single precision floating point value to a JSON
+    //! string.
+    //! @param[in] os output stream.
+    //! @param[in] label label.
+    //! @param[in] value value.
+    //! @param[in] nindent number of indentation spaces.
+    //! @param[in] prefix prefix character.
+    template <>
+    inline void
+    toJSON(std::ostream& os, const char* label, const fp32_t& value, unsigned nindent, char prefix)
+    {
+      writeJSONFloatField(os, label, value, nindent, prefix);
+    }
+
+    //! Convert a double precision floating point value to a JSON
+    //! string.
+    //! @param[in] os output stream.
+    //! @param[in] label label.
+    //! @param[in] value value.
+    //! @param[in] nindent number of indentation spaces.
+    //! @param[in] prefix prefix character.
+    template <>
+    inline void
+    toJSON(std::ostream& os, const char* label, const fp64_t& value, unsigned nindent, char prefix)
+    {
+      writeJSONFloatField(os, label, value, nindent, prefix);
     }
 
     //! Convert a string to a JSON string.
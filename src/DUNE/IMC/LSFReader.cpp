@@ -0,0 +1,352 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+// DUNE headers.
+#include <DUNE/System/Error.hpp>
+#include <DUNE/IMC/Packet.hpp>
+#include <DUNE/IMC/Exceptions.hpp>
+#include <DUNE/IMC/LSFReader.hpp>
+
+// POSIX headers.
+#if defined(DUNE_SYS_HAS_SYS_MMAN_H)
+#  include <sys/mman.h>
+#endif
+
+#if defined(DUNE_SYS_HAS_SYS_TYPES_H)
+#  include <sys/types.h>
+#endif
+
+#if defined(DUNE_SYS_HAS_SYS_STAT_H)
+#  include <sys/stat.h>
+#endif
+
+#if defined(DUNE_SYS_HAS_FCNTL_H)
+#  include <fcntl.h>
+#endif
+
+#if defined(DUNE_SYS_HAS_UNISTD_H)
+#  include <unistd.h>
+#endif
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    //! Index sidecar magic number.
+    static const char c_idx_magic[4] = {'L', 'S', 'F', 'i'};
+    //! Index sidecar format version.
+    static const uint8_t c_idx_version = 1;
+    //! Index sidecar endianness tag.
+    static const uint16_t c_idx_endian = 0x0102;
+    //! Number of messages between index samples.
+    static const unsigned c_idx_stride = 1024;
+    //! Index sidecar extension.
+    static const char* c_idx_extension = ".idx";
+
+    LSFReader::LSFReader(void):
+      m_data(NULL),
+      m_size(0),
+      m_cursor(0),
+      m_mapped(false)
+    { }
+
+    LSFReader::~LSFReader(void)
+    {
+      close();
+    }
+
+    void
+    LSFReader::open(const std::string& path)
+    {
+      close();
+
+#if defined(DUNE_SYS_HAS_MMAP)
+      int fd = ::open(path.c_str(), O_RDONLY);
+      if (fd < 0)
+        throw System::Error(errno, "open", path);
+
+      struct stat st;
+      if (fstat(fd, &st) < 0)
+      {
+        int err = errno;
+        ::close(fd);
+        throw System::Error(err, "fstat", path);
+      }
+
+      m_size = st.st_size;
+      if (m_size > 0)
+      {
+        void* ptr = mmap(0, m_size, PROT_READ, MAP_SHARED, fd, 0);
+        if (ptr == MAP_FAILED)
+        {
+          int err = errno;
+          ::close(fd);
+          throw System::Error(err, "mmap", path);
+        }
+
+        m_data = static_cast<const uint8_t*>(ptr);
+        m_mapped = true;
+      }
+
+      ::close(fd);
+#else
+      // Fallback: read the entire file into memory.
+      std::ifstream ifs(path.c_str(), std::ios::binary);
+      if (!ifs.is_open())
+        throw std::runtime_error("failed to open: " + path);
+
+      ifs.seekg(0, std::ios::end);
+      m_size = ifs.tellg();
+      ifs.seekg(0, std::ios::beg);
+
+      if (m_size > 0)
+      {
+        uint8_t* bfr = new uint8_t[m_size];
+        ifs.read(reinterpret_cast<char*>(bfr), m_size);
+        m_data = bfr;
+      }
+#endif
+
+      m_path = path;
+      m_cursor = 0;
+      loadIndex();
+    }
+
+    void
+    LSFReader::close(void)
+    {
+      if (m_data != NULL)
+      {
+#if defined(DUNE_SYS_HAS_MMAP)
+        if (m_mapped)
+          munmap(const_cast<uint8_t*>(m_data), m_size);
+        else
+          delete [] m_data;
+#else
+        delete [] m_data;
+#endif
+      }
+
+      m_data = NULL;
+      m_size = 0;
+      m_cursor = 0;
+      m_mapped = false;
+      m_path.clear();
+      m_index.clear();
+    }
+
+    bool
+    LSFReader::readHeader(uint64_t offset, Header& hdr)
+    {
+      if (offset + DUNE_IMC_CONST_HEADER_SIZE + DUNE_IMC_CONST_FOOTER_SIZE > m_size)
+        return false;
+
+      Packet::deserializeHeader(hdr, m_data + offset, DUNE_IMC_CONST_HEADER_SIZE);
+
+      uint64_t total = DUNE_IMC_CONST_HEADER_SIZE + hdr.size + DUNE_IMC_CONST_FOOTER_SIZE;
+      return offset + total <= m_size;
+    }
+
+    Message*
+    LSFReader::next(void)
+    {
+      Header hdr;
+      if (!readHeader(m_cursor, hdr))
+        return NULL;
+
+      uint64_t total = DUNE_IMC_CONST_HEADER_SIZE + hdr.size + DUNE_IMC_CONST_FOOTER_SIZE;
+      Message* msg = Packet::deserialize(m_data + m_cursor, static_cast<uint16_t>(total));
+      m_cursor += total;
+      return msg;
+    }
+
+    bool
+    LSFReader::peek(Header& hdr)
+    {
+      return readHeader(m_cursor, hdr);
+    }
+
+    bool
+    LSFReader::skip(void)
+    {
+      Header hdr;
+      if (!readHeader(m_cursor, hdr))
+        return false;
+
+      m_cursor += DUNE_IMC_CONST_HEADER_SIZE + hdr.size + DUNE_IMC_CONST_FOOTER_SIZE;
+      return true;
+    }
+
+    void
+    LSFReader::seekOffset(uint64_t offset)
+    {
+      if (offset > m_size)
+        throw std::runtime_error("seek beyond end of log: " + m_path);
+
+      m_cursor = offset;
+    }
+
+    void
+    LSFReader::seekTime(double timestamp)
+    {
+      // Binary search for the last index sample not after the
+      // requested time.
+      m_cursor = 0;
+      size_t lo = 0;
+      size_t hi = m_index.size();
+      while (lo < hi)
+      {
+        size_t mid = (lo + hi) / 2;
+        if (m_index[mid].timestamp < timestamp)
+          lo = mid + 1;
+        else
+          hi = mid;
+      }
+
+      if (lo > 0)
+        m_cursor = m_index[lo - 1].offset;
+
+      // Scan forward to the first message at or after the requested
+      // time.
+      Header hdr;
+      while (readHeader(m_cursor, hdr))
+      {
+        if (hdr.timestamp >= timestamp)
+          return;
+
+        m_cursor += DUNE_IMC_CONST_HEADER_SIZE + hdr.size + DUNE_IMC_CONST_FOOTER_SIZE;
+      }
+    }
+
+    void
+    LSFReader::loadIndex(void)
+    {
+      std::string idx_path = m_path + c_idx_extension;
+      std::ifstream ifs(idx_path.c_str(), std::ios::binary);
+
+      if (ifs.is_open())
+      {
+        char magic[4] = {0};
+        uint8_t version = 0;
+        uint16_t endian = 0;
+        uint64_t size = 0;
+        uint32_t count = 0;
+
+        ifs.read(magic, sizeof(magic));
+        ifs.read(reinterpret_cast<char*>(&version), sizeof(version));
+        ifs.read(reinterpret_cast<char*>(&endian), sizeof(endian));
+        ifs.read(reinterpret_cast<char*>(&size), sizeof(size));
+        ifs.read(reinterpret_cast<char*>(&count), sizeof(count));
+
+        if (ifs.good()
+            && std::memcmp(magic, c_idx_magic, sizeof(magic)) == 0
+            && version == c_idx_version
+            && endian == c_idx_endian
+            && size == m_size)
+        {
+          m_index.resize(count);
+          for (uint32_t i = 0; i < count && ifs.good(); ++i)
+          {
+            ifs.read(reinterpret_cast<char*>(&m_index[i].timestamp), sizeof(double));
+            ifs.read(reinterpret_cast<char*>(&m_index[i].offset), sizeof(uint64_t));
+          }
+
+          if (ifs.good())
+            return;
+
+          m_index.clear();
+        }
+      }
+
+      buildIndex();
+      saveIndex();
+    }
+
+    void
+    LSFReader::buildIndex(void)
+    {
+      m_index.clear();
+
+      uint64_t offset = 0;
+      unsigned count = 0;
+      Header hdr;
+
+      try
+      {
+        while (readHeader(offset, hdr))
+        {
+          if (count % c_idx_stride == 0)
+          {
+            IndexEntry entry;
+            entry.timestamp = hdr.timestamp;
+            entry.offset = offset;
+            m_index.push_back(entry);
+          }
+
+          offset += DUNE_IMC_CONST_HEADER_SIZE + hdr.size + DUNE_IMC_CONST_FOOTER_SIZE;
+          ++count;
+        }
+      }
+      catch (std::exception&)
+      {
+        // Corrupt trailer: index what was scanned so far.
+      }
+    }
+
+    void
+    LSFReader::saveIndex(void)
+    {
+      std::string idx_path = m_path + c_idx_extension;
+      std::ofstream ofs(idx_path.c_str(), std::ios::binary);
+
+      if (!ofs.is_open())
+        return;
+
+      uint32_t count = static_cast<uint32_t>(m_index.size());
+      ofs.write(c_idx_magic, sizeof(c_idx_magic));
+      ofs.write(reinterpret_cast<const char*>(&c_idx_version), sizeof(c_idx_version));
+      ofs.write(reinterpret_cast<const char*>(&c_idx_endian), sizeof(c_idx_endian));
+      ofs.write(reinterpret_cast<const char*>(&m_size), sizeof(m_size));
+      ofs.write(reinterpret_cast<const char*>(&count), sizeof(count));
+
+      for (uint32_t i = 0; i < count; ++i)
+      {
+        ofs.write(reinterpret_cast<const char*>(&m_index[i].timestamp), sizeof(double));
+        ofs.write(reinterpret_cast<const char*>(&m_index[i].offset), sizeof(uint64_t));
+      }
+    }
+  }
+}
@@ -0,0 +1,177 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+#ifndef DUNE_IMC_LSF_READER_HPP_INCLUDED_
+#define DUNE_IMC_LSF_READER_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/IMC/Message.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM LSFReader;
+
+    //! Reader of uncompressed LSF log files.
+    //!
+    //! The log is memory-mapped when the operating system supports
+    //! it (falling back to reading the file into memory otherwise),
+    //! so sequential deserialization touches no read syscalls and
+    //! seeking is a pointer adjustment. On open the reader loads an
+    //! index sidecar ('<log>.idx') holding (time stamp, offset)
+    //! samples; when the sidecar is missing or stale it is rebuilt by
+    //! scanning message headers and saved on a best-effort basis.
+    //! The index makes time-based seeks O(log n) plus a short linear
+    //! scan instead of a full file scan.
+    class LSFReader
+    {
+    public:
+      //! Constructor.
+      LSFReader(void);
+
+      //! Destructor.
+      ~LSFReader(void);
+
+      //! Open an LSF file.
+      //! @param path path to file.
+      void
+      open(const std::string& path);
+
+      //! Close the currently open file.
+      void
+      close(void);
+
+      //! Deserialize the message at the cursor and advance it.
+      //! @return message object or NULL at end of log. The caller
+      //! owns the returned message.
+      Message*
+      next(void);
+
+      //! Read the header of the message at the cursor without
+      //! advancing it.
+      //! @param hdr header destination.
+      //! @return true if a complete message lies at the cursor.
+      bool
+      peek(Header& hdr);
+
+      //! Advance the cursor past the message at the cursor without
+      //! deserializing it.
+      //! @return true if a message was skipped, false at end of log.
+      bool
+      skip(void);
+
+      //! Retrieve the cursor's byte offset.
+      //! @return offset from the beginning of the log.
+      uint64_t
+      getOffset(void) const
+      {
+        return m_cursor;
+      }
+
+      //! Retrieve the size of the log.
+      //! @return size in bytes.
+      uint64_t
+      getSize(void) const
+      {
+        return m_size;
+      }
+
+      //! Position the cursor at a given byte offset. The offset must
+      //! fall on a message boundary.
+      //! @param offset offset from the beginning of the log.
+      void
+      seekOffset(uint64_t offset);
+
+      //! Position the cursor at the first message whose time stamp
+      //! is not earlier than a given time.
+      //! @param timestamp time stamp in seconds since the Unix Epoch.
+      void
+      seekTime(double timestamp);
+
+    private:
+      //! Index sidecar entry.
+      struct IndexEntry
+      {
+        //! Time stamp of the indexed message.
+        double timestamp;
+        //! Byte offset of the indexed message.
+        uint64_t offset;
+      };
+
+      //! Path to the open log file.
+      std::string m_path;
+      //! Log contents.
+      const uint8_t* m_data;
+      //! Log size in bytes.
+      uint64_t m_size;
+      //! Cursor offset.
+      uint64_t m_cursor;
+      //! True if m_data is a memory mapping, false if heap memory.
+      bool m_mapped;
+      //! Index samples, ordered by offset and time stamp.
+      std::vector<IndexEntry> m_index;
+
+      //! Read the header of the message at a given offset.
+      //! @param offset offset from the beginning of the log.
+      //! @param hdr header destination.
+      //! @return true if a complete message lies at the offset.
+      bool
+      readHeader(uint64_t offset, Header& hdr);
+
+      //! Load the index sidecar, rebuilding and saving it when
+      //! missing or inconsistent with the log.
+      void
+      loadIndex(void);
+
+      //! Build the index by scanning message headers.
+      void
+      buildIndex(void);
+
+      //! Save the index sidecar (best-effort).
+      void
+      saveIndex(void);
+
+      //! Non - copyable.
+      LSFReader(const LSFReader&);
+
+      //! Non - assignable.
+      LSFReader&
+      operator=(const LSFReader&);
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,128 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+#ifndef DUNE_IMC_LOG_SINK_HPP_INCLUDED_
+#define DUNE_IMC_LOG_SINK_HPP_INCLUDED_
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Concurrency/Mutex.hpp>
+#include <DUNE/Concurrency/ScopedMutex.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM LogSink;
+    class DUNE_DLL_SYM LogSinkRegistry;
+
+    class Message;
+
+    //! Interface of a direct log sink.
+    //!
+    //! A logging task may register a sink to accept declared bulk
+    //! messages straight from the producing task, bypassing bus
+    //! dispatch, queueing and cloning. Producers offer messages with
+    //! the DF_BULK dispatch flag and fall back to regular dispatch
+    //! when the sink rejects them, so the bypass is an optimization,
+    //! never a requirement.
+    class LogSink
+    {
+    public:
+      //! Destructor.
+      virtual
+      ~LogSink(void)
+      { }
+
+      //! Offer a message for direct logging. Implementations must be
+      //! thread-safe: the call runs on the producing task's thread.
+      //! @param[in] msg message to log, already stamped.
+      //! @return true if the message was logged, false if the sink
+      //! does not accept it and it should be dispatched normally.
+      virtual bool
+      logBulk(const Message& msg) = 0;
+    };
+
+    //! Holder of the active log sink, shared through the task
+    //! context. Registration and offers are serialized, so a sink
+    //! may be safely unregistered while producers are active.
+    class LogSinkRegistry
+    {
+    public:
+      //! Constructor.
+      LogSinkRegistry(void):
+        m_sink(NULL)
+      { }
+
+      //! Register a sink, replacing any previous one.
+      //! @param[in] sink sink to register.
+      void
+      registerSink(LogSink* sink)
+      {
+        Concurrency::ScopedMutex l(m_mutex);
+        m_sink = sink;
+      }
+
+      //! Unregister a sink. On return no further calls to the sink
+      //! are in progress or will be made.
+      //! @param[in] sink sink to unregister; ignored if another sink
+      //! is registered.
+      void
+      unregisterSink(LogSink* sink)
+      {
+        Concurrency::ScopedMutex l(m_mutex);
+        if (m_sink == sink)
+          m_sink = NULL;
+      }
+
+      //! Offer a message to the registered sink.
+      //! @param[in] msg message to log, already stamped.
+      //! @return true if the message was logged, false if no sink is
+      //! registered or the sink rejected it.
+      bool
+      log(const Message& msg)
+      {
+        Concurrency::ScopedMutex l(m_mutex);
+        if (m_sink == NULL)
+          return false;
+
+        return m_sink->logBulk(msg);
+      }
+
+    private:
+      //! Registration and offer lock.
+      Concurrency::Mutex m_mutex;
+      //! Active sink, NULL if none.
+      LogSink* m_sink;
+    };
+  }
+}
+
+#endif
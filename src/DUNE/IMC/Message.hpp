@@ -35,6 +35,7 @@
 #include <DUNE/Time/Clock.hpp>
 #include <DUNE/IMC/Constants.hpp>
 #include <DUNE/IMC/Header.hpp>
+#include <DUNE/IMC/MessagePool.hpp>
 #include <DUNE/IMC/Packet.hpp>
 #include <DUNE/IMC/AddressResolver.hpp>
 
@@ -65,6 +66,23 @@ namespace DUNE
       ~Message(void)
       { }
 
+      //! Allocate a message object from the message pool.
+      //! @param size object size in bytes.
+      //! @return pointer to usable memory.
+      static void*
+      operator new(std::size_t size)
+      {
+        return MessagePool::allocate(size);
+      }
+
+      //! Return a message object's memory to the message pool.
+      //! @param ptr pointer to memory.
+      static void
+      operator delete(void* ptr)
+      {
+        MessagePool::deallocate(ptr);
+      }
+
       //! Retrieve a copy of the message.
       //! @return message copy.
       virtual Message*
@@ -313,6 +331,16 @@ namespace DUNE
         return !(*this == other);
       }
 
+      //! Compare fields for equality.
+      //! @param[in] other message to compare.
+      //! @return true if fields are equal, false otherwise.
+      virtual bool
+      fieldsEqual(const Message& other) const
+      {
+        (void)other;
+        return true;
+      }
+
     protected:
       //! Message header.
       Header m_header;
@@ -357,15 +385,6 @@ namespace DUNE
         (void)value;
       }
 
-      //! Compare fields for equality.
-      //! @param[in] other message to compare.
-      //! @return true if fields are equal, false otherwise.
-      virtual bool
-      fieldsEqual(const Message& other) const
-      {
-        (void)other;
-        return true;
-      }
     };
   }
 }
@@ -0,0 +1,198 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstring>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/IMC/MessageDelta.hpp>
+#include <DUNE/IMC/Factory.hpp>
+#include <DUNE/IMC/Exceptions.hpp>
+#include <DUNE/IMC/Serialization.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    uint16_t
+    MessageDelta::encode(const Message* prev, const Message* cur, uint8_t* bfr, uint16_t cap)
+    {
+      uint16_t size = (uint16_t)cur->getPayloadSerializationSize();
+
+      bool usable = (prev != NULL)
+                    && (prev->getId() == cur->getId())
+                    && ((uint16_t)prev->getPayloadSerializationSize() == size);
+
+      if (usable && size > 0)
+      {
+        std::vector<uint8_t> pb(size);
+        std::vector<uint8_t> cb(size);
+        prev->serializeFields(&pb[0]);
+        cur->serializeFields(&cb[0]);
+
+        unsigned chunks = (size + c_chunk_size - 1) / c_chunk_size;
+        unsigned mask_len = (chunks + 7) / 8;
+
+        std::vector<uint8_t> mask(mask_len, 0);
+        std::vector<uint8_t> changed;
+        for (unsigned i = 0; i < chunks; ++i)
+        {
+          unsigned at = i * c_chunk_size;
+          unsigned len = (at + c_chunk_size > size) ? size - at : c_chunk_size;
+          if (std::memcmp(&pb[at], &cb[at], len) != 0)
+          {
+            mask[i / 8] |= 1 << (i % 8);
+            changed.insert(changed.end(), &cb[at], &cb[at] + len);
+          }
+        }
+
+        uint16_t total = c_header_size + mask_len + changed.size();
+        if (total < c_header_size + size)
+        {
+          if (cap < total)
+            throw InternalBufferTooShort();
+
+          uint8_t* ptr = bfr;
+          *ptr++ = c_form_delta;
+          ptr += serialize((uint16_t)cur->getId(), ptr);
+          ptr += serialize(size, ptr);
+          std::memcpy(ptr, &mask[0], mask_len);
+          ptr += mask_len;
+          if (!changed.empty())
+            std::memcpy(ptr, &changed[0], changed.size());
+          return total;
+        }
+      }
+
+      if (cap < c_header_size + size)
+        throw InternalBufferTooShort();
+
+      uint8_t* ptr = bfr;
+      *ptr++ = c_form_full;
+      ptr += serialize((uint16_t)cur->getId(), ptr);
+      ptr += serialize(size, ptr);
+      cur->serializeFields(ptr);
+      return c_header_size + size;
+    }
+
+    Message*
+    MessageDelta::decode(const Message* prev, const uint8_t* bfr, uint16_t len)
+    {
+      if (len < c_header_size)
+        throw BufferTooShort();
+
+      uint8_t form = bfr[0];
+      uint16_t id = 0;
+      uint16_t size = 0;
+      uint16_t length = len - 1;
+      const uint8_t* ptr = bfr + 1;
+      ptr += deserialize(id, ptr, length);
+      ptr += deserialize(size, ptr, length);
+
+      Message* msg = Factory::produce(id);
+      if (msg == NULL)
+        throw InvalidMessageId(id);
+
+      if (form == c_form_full)
+      {
+        if (length < size)
+        {
+          delete msg;
+          throw BufferTooShort();
+        }
+
+        try
+        {
+          msg->deserializeFields(ptr, size);
+        }
+        catch (...)
+        {
+          delete msg;
+          throw;
+        }
+
+        return msg;
+      }
+
+      // Delta form: patch the previous payload with the changed chunks.
+      if (prev == NULL || prev->getId() != id
+          || (uint16_t)prev->getPayloadSerializationSize() != size)
+      {
+        delete msg;
+        throw InvalidFormat();
+      }
+
+      unsigned chunks = (size + c_chunk_size - 1) / c_chunk_size;
+      unsigned mask_len = (chunks + 7) / 8;
+      if (length < mask_len)
+      {
+        delete msg;
+        throw BufferTooShort();
+      }
+
+      std::vector<uint8_t> payload(size);
+      prev->serializeFields(&payload[0]);
+
+      const uint8_t* mask = ptr;
+      const uint8_t* data = ptr + mask_len;
+      unsigned left = length - mask_len;
+
+      for (unsigned i = 0; i < chunks; ++i)
+      {
+        if (!(mask[i / 8] & (1 << (i % 8))))
+          continue;
+
+        unsigned at = i * c_chunk_size;
+        unsigned clen = (at + c_chunk_size > size) ? size - at : c_chunk_size;
+        if (left < clen)
+        {
+          delete msg;
+          throw BufferTooShort();
+        }
+
+        std::memcpy(&payload[at], data, clen);
+        data += clen;
+        left -= clen;
+      }
+
+      try
+      {
+        msg->deserializeFields(&payload[0], size);
+      }
+      catch (...)
+      {
+        delete msg;
+        throw;
+      }
+
+      return msg;
+    }
+  }
+}
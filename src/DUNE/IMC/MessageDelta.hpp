@@ -0,0 +1,85 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+#ifndef DUNE_IMC_MESSAGE_DELTA_HPP_INCLUDED_
+#define DUNE_IMC_MESSAGE_DELTA_HPP_INCLUDED_
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/IMC/Message.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM MessageDelta;
+
+    //! Delta encoder for successive instances of the same message
+    //! type. The serialized payloads of the previous and current
+    //! instances are compared in small chunks and only the chunk
+    //! change mask plus the changed chunks are emitted, which is
+    //! considerably smaller than the full payload when few fields
+    //! change between samples. When no usable previous instance
+    //! exists, or the delta would not be smaller, the full payload is
+    //! emitted instead, so any message can always be encoded.
+    class MessageDelta
+    {
+    public:
+      //! Encode the difference between two instances of a message.
+      //! @param[in] prev previous instance or NULL.
+      //! @param[in] cur current instance.
+      //! @param[out] bfr buffer where to place the encoded delta.
+      //! @param[in] cap capacity of the buffer.
+      //! @return number of bytes written to the buffer.
+      static uint16_t
+      encode(const Message* prev, const Message* cur, uint8_t* bfr, uint16_t cap);
+
+      //! Decode a delta produced by encode().
+      //! @param[in] prev previous instance or NULL.
+      //! @param[in] bfr buffer holding the encoded delta.
+      //! @param[in] len number of bytes in the buffer.
+      //! @return decoded message, allocated with new.
+      static Message*
+      decode(const Message* prev, const uint8_t* bfr, uint16_t len);
+
+    private:
+      //! Granularity of the change mask in bytes.
+      static const unsigned c_chunk_size = 4;
+      //! Size of the encoding header in bytes.
+      static const unsigned c_header_size = 5;
+      //! Form: full serialized payload.
+      static const uint8_t c_form_full = 0;
+      //! Form: chunk change mask plus changed chunks.
+      static const uint8_t c_form_delta = 1;
+    };
+  }
+}
+
+#endif
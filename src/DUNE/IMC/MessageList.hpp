@@ -182,7 +182,9 @@ namespace DUNE
       MessageList&
       operator=(const MessageList& other)
       {
-        copy(other);
+        if (&other != this)
+          copy(other);
+
         return *this;
       }
 
@@ -264,6 +266,8 @@ namespace DUNE
         std::memcpy(&message_count, ptr, 2);
         ptr += 2;
 
+        m_list.reserve(m_list.size() + message_count);
+
         // Deserialize messages.
         for (uint16_t i = 0; i < message_count; ++i)
         {
@@ -301,6 +305,8 @@ namespace DUNE
         Utils::reverseCopy(message_count, (char*)ptr);
         ptr += 2;
 
+        m_list.reserve(m_list.size() + message_count);
+
         // Deserialize messages.
         for (uint16_t i = 0; i < message_count; ++i)
         {
@@ -446,6 +452,7 @@ namespace DUNE
         m_parent = other.m_parent;
 
         clear();
+        m_list.reserve(other.m_list.size());
 
         for (unsigned i = 0; i < other.m_list.size(); ++i)
         {
@@ -0,0 +1,60 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//**************************************************************************
+
+// DUNE headers.
+#include <DUNE/Memory/BlockPool.hpp>
+#include <DUNE/IMC/MessagePool.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    //! Size classes of the pool's free lists.
+    static const std::size_t c_class_sizes[] = {32, 64, 128, 256, 512, 1024};
+    //! Number of size classes.
+    static const unsigned c_class_count = sizeof(c_class_sizes) / sizeof(c_class_sizes[0]);
+    //! Maximum number of cached blocks per size class.
+    static const unsigned c_max_cached = 1024;
+
+    //! Backing pool.
+    static Memory::BlockPool s_pool(c_class_sizes, c_class_count, c_max_cached);
+
+    void*
+    MessagePool::allocate(std::size_t size)
+    {
+      return s_pool.allocate(size);
+    }
+
+    void
+    MessagePool::deallocate(void* ptr)
+    {
+      s_pool.deallocate(ptr);
+    }
+  }
+}
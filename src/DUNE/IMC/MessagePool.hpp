@@ -0,0 +1,73 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+#ifndef DUNE_IMC_MESSAGE_POOL_HPP_INCLUDED_
+#define DUNE_IMC_MESSAGE_POOL_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <cstddef>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM MessagePool;
+
+    //! Thread-safe pool allocator for IMC message objects.
+    //!
+    //! Message objects are small, short-lived and allocated at very
+    //! high rates on the dispatch path. The pool keeps freed blocks in
+    //! size-segregated free lists and recycles them on subsequent
+    //! allocations, bypassing the general purpose heap on the hot
+    //! path. Requests larger than the biggest size class, and blocks
+    //! freed while a free list is full, fall back to the global
+    //! operator new/delete.
+    class MessagePool
+    {
+    public:
+      //! Allocate a block of memory with at least the requested size.
+      //! @param size requested size in bytes.
+      //! @return pointer to usable memory.
+      static void*
+      allocate(std::size_t size);
+
+      //! Return a block of memory previously obtained with allocate()
+      //! to the pool.
+      //! @param ptr pointer to memory.
+      static void
+      deallocate(void* ptr);
+    };
+  }
+}
+
+#endif
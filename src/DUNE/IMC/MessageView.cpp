@@ -0,0 +1,74 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+// DUNE headers.
+#include <DUNE/IMC/MessageView.hpp>
+#include <DUNE/IMC/Packet.hpp>
+#include <DUNE/IMC/Message.hpp>
+#include <DUNE/IMC/Exceptions.hpp>
+#include <DUNE/Algorithms/CRC16.hpp>
+#include <DUNE/Utils/ByteCopy.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    void
+    MessageView::bind(const uint8_t* bfr, uint16_t bfr_len)
+    {
+      Packet::deserializeHeader(m_hdr, bfr, bfr_len);
+
+      if (m_hdr.size > bfr_len - (DUNE_IMC_CONST_HEADER_SIZE + DUNE_IMC_CONST_FOOTER_SIZE))
+        throw BufferTooShort();
+
+      // Retrieve CRC.
+      uint16_t rcrc = 0;
+
+      if (m_hdr.sync == DUNE_IMC_CONST_SYNC_REV)
+        Utils::ByteCopy::rcopy(rcrc, bfr + DUNE_IMC_CONST_HEADER_SIZE + m_hdr.size);
+      else
+        Utils::ByteCopy::copy(rcrc, bfr + DUNE_IMC_CONST_HEADER_SIZE + m_hdr.size);
+
+      // Validate CRC.
+      uint16_t crc = Algorithms::CRC16::compute(bfr, DUNE_IMC_CONST_HEADER_SIZE + m_hdr.size);
+
+      if (crc != rcrc)
+        throw InvalidCrc();
+
+      m_data = bfr;
+      m_size = bfr_len;
+    }
+
+    Message*
+    MessageView::deserialize(void) const
+    {
+      return Packet::deserializePayload(m_hdr, m_data, m_size, NULL);
+    }
+  }
+}
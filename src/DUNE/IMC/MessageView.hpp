@@ -0,0 +1,165 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+#ifndef DUNE_IMC_MESSAGE_VIEW_HPP_INCLUDED_
+#define DUNE_IMC_MESSAGE_VIEW_HPP_INCLUDED_
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/IMC/Header.hpp>
+#include <DUNE/IMC/Constants.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM MessageView;
+
+    // Forward declarations.
+    class Message;
+
+    //! View over the raw bytes of one validated IMC packet.
+    //!
+    //! Binding a view checks the synchronization number, size and
+    //! CRC, and parses only the fixed header. Payload fields stay in
+    //! wire format, so a transport that merely routes or re-emits
+    //! traffic can inspect addressing and forward the bytes verbatim
+    //! without materializing a Message object. Full deserialization
+    //! remains available on demand.
+    //!
+    //! The view does not copy nor own the underlying buffer: it is
+    //! only valid while the bound bytes are.
+    class MessageView
+    {
+    public:
+      //! Construct an unbound view.
+      MessageView(void):
+        m_data(0),
+        m_size(0)
+      { }
+
+      //! Bind the view to a raw packet, validating the header and
+      //! CRC. Throws the same exceptions as Packet::deserialize() on
+      //! malformed input.
+      //! @param[in] bfr raw packet bytes.
+      //! @param[in] bfr_len number of bytes available in 'bfr'.
+      void
+      bind(const uint8_t* bfr, uint16_t bfr_len);
+
+      //! Check if the view is bound to a packet.
+      //! @return true if bound, false otherwise.
+      bool
+      isBound(void) const
+      {
+        return m_data != 0;
+      }
+
+      //! Get message identification number.
+      //! @return message identification number.
+      uint16_t
+      getId(void) const
+      {
+        return m_hdr.mgid;
+      }
+
+      //! Get time stamp.
+      //! @return time stamp.
+      double
+      getTimeStamp(void) const
+      {
+        return m_hdr.timestamp;
+      }
+
+      //! Get source address.
+      //! @return source address.
+      uint16_t
+      getSource(void) const
+      {
+        return m_hdr.src;
+      }
+
+      //! Get source entity.
+      //! @return source entity.
+      uint8_t
+      getSourceEntity(void) const
+      {
+        return m_hdr.src_ent;
+      }
+
+      //! Get destination address.
+      //! @return destination address.
+      uint16_t
+      getDestination(void) const
+      {
+        return m_hdr.dst;
+      }
+
+      //! Get destination entity.
+      //! @return destination entity.
+      uint8_t
+      getDestinationEntity(void) const
+      {
+        return m_hdr.dst_ent;
+      }
+
+      //! Get the raw packet bytes (header, payload and footer),
+      //! suitable for re-emission without re-serialization.
+      //! @return raw packet bytes.
+      const uint8_t*
+      getData(void) const
+      {
+        return m_data;
+      }
+
+      //! Get the total size of the raw packet.
+      //! @return packet size in bytes.
+      uint16_t
+      getSize(void) const
+      {
+        return DUNE_IMC_CONST_HEADER_SIZE + m_hdr.size + DUNE_IMC_CONST_FOOTER_SIZE;
+      }
+
+      //! Fully deserialize the viewed packet.
+      //! @return message object (caller owns it).
+      Message*
+      deserialize(void) const;
+
+    private:
+      //! Raw packet bytes (not owned).
+      const uint8_t* m_data;
+      //! Number of bytes available past m_data.
+      uint16_t m_size;
+      //! Parsed fixed header.
+      Header m_hdr;
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,166 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+#ifndef DUNE_IMC_SHARED_MESSAGE_HPP_INCLUDED_
+#define DUNE_IMC_SHARED_MESSAGE_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <cstddef>
+
+// DUNE headers.
+#include <DUNE/Concurrency/AtomicCounter.hpp>
+#include <DUNE/IMC/Message.hpp>
+#include <DUNE/Time/Clock.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM SharedMessage;
+
+    //! Immutable reference-counted message envelope.
+    //!
+    //! A SharedMessage holds a single heap-allocated copy of a message
+    //! and hands it to an arbitrary number of consumers without
+    //! further cloning. The envelope is created with a reference count
+    //! of one and destroys itself, together with the enclosed message,
+    //! when the last reference is released. Consumers that need to
+    //! modify a message or retain it beyond the scope of the consume
+    //! callback must clone it explicitly.
+    class SharedMessage
+    {
+    public:
+      //! Create an envelope holding a private copy of a message.
+      //! @param msg message to copy.
+      //! @return envelope with a reference count of one.
+      static SharedMessage*
+      create(const Message* msg)
+      {
+        return new SharedMessage(msg->clone());
+      }
+
+      //! Create an envelope taking ownership of a message, without
+      //! copying it. The message must not be modified by the caller
+      //! once other references to the envelope exist.
+      //! @param msg message to enclose, ownership is transferred.
+      //! @return envelope with a reference count of one.
+      static SharedMessage*
+      wrap(Message* msg)
+      {
+        return new SharedMessage(msg);
+      }
+
+      //! Check if the caller holds the only reference to the
+      //! envelope, i.e. no consumer is still using the enclosed
+      //! message.
+      //! @return true if the reference count is one.
+      bool
+      isUnique(void)
+      {
+        return m_refs.get() == 1;
+      }
+
+      //! Retrieve the enclosed message.
+      //! @return message object.
+      const Message*
+      get(void) const
+      {
+        return m_msg;
+      }
+
+      //! Retrieve the time at which the envelope was created
+      //! (monotonic clock), i.e. when the message entered the bus.
+      //! @return creation time.
+      double
+      getCreationTime(void) const
+      {
+        return m_ctime;
+      }
+
+      //! Reset the creation time to the current time. Callers that
+      //! reuse a unique envelope for a new sample must call this so
+      //! delivery latency accounting measures the new dispatch.
+      void
+      touch(void)
+      {
+        m_ctime = Time::Clock::get();
+      }
+
+      //! Acquire an additional reference to the envelope.
+      //! @return envelope object.
+      SharedMessage*
+      addRef(void)
+      {
+        m_refs.add(1);
+        return this;
+      }
+
+      //! Release one reference to the envelope. The envelope is
+      //! destroyed when no references remain.
+      void
+      release(void)
+      {
+        if (m_refs.sub(1) == 0)
+          delete this;
+      }
+
+    private:
+      //! Enclosed message.
+      Message* m_msg;
+      //! Reference count.
+      Concurrency::AtomicCounter m_refs;
+      //! Creation time (monotonic clock).
+      double m_ctime;
+
+      //! Constructor, takes ownership of the enclosed message.
+      //! @param msg message object.
+      SharedMessage(Message* msg):
+        m_msg(msg),
+        m_refs(1),
+        m_ctime(Time::Clock::get())
+      { }
+
+      //! Destructor.
+      ~SharedMessage(void)
+      {
+        delete m_msg;
+      }
+
+      //! Non - copyable.
+      SharedMessage(const SharedMessage&);
+
+      //! Non - assignable.
+      SharedMessage&
+      operator=(const SharedMessage&);
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,265 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+// DUNE headers.
+#include <DUNE/Concurrency/ScopedMutex.hpp>
+#include <DUNE/IMC/TelemetryStore.hpp>
+#include <DUNE/IMC/Definitions.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    //! Column labels of EstimatedState.
+    static const char* const c_estate_labels[] =
+    {
+      "x", "y", "z", "phi", "theta", "psi", "u", "v", "w",
+      "vx", "vy", "vz", "depth", "alt"
+    };
+
+    //! Column labels of scalar sensor readings.
+    static const char* const c_scalar_labels[] = {"value"};
+
+    //! Pack a message identifier, source and source entity into a
+    //! series key.
+    static inline uint64_t
+    seriesKey(const Message* msg)
+    {
+      return ((uint64_t)msg->getId() << 24)
+             | ((uint64_t)msg->getSource() << 8)
+             | msg->getSourceEntity();
+    }
+
+    //! One telemetry series: fixed-capacity ring in struct-of-arrays
+    //! layout, one vector per column plus a timestamp vector.
+    struct TelemetryStore::Series
+    {
+      //! Message identification number.
+      uint16_t id;
+      //! Source address.
+      uint16_t src;
+      //! Source entity.
+      uint8_t src_ent;
+      //! Message abbreviation.
+      std::string abbrev;
+      //! Column labels.
+      const char* const* labels;
+      //! Number of columns.
+      unsigned column_count;
+      //! Ring capacity in samples.
+      unsigned capacity;
+      //! Index of the oldest sample.
+      unsigned head;
+      //! Number of valid samples.
+      unsigned size;
+      //! Timestamp ring.
+      std::vector<double> time;
+      //! Column rings.
+      std::vector<std::vector<double> > columns;
+    };
+
+    TelemetryStore::TelemetryStore(void):
+      m_capacity(c_default_capacity)
+    { }
+
+    TelemetryStore::~TelemetryStore(void)
+    {
+      for (SeriesMap::iterator itr = m_series.begin(); itr != m_series.end(); ++itr)
+        delete itr->second;
+    }
+
+    void
+    TelemetryStore::setCapacity(unsigned capacity)
+    {
+      Concurrency::ScopedMutex lock(m_lock);
+      if (capacity > 0)
+        m_capacity = capacity;
+    }
+
+    void
+    TelemetryStore::insert(const Message* msg)
+    {
+      uint16_t id = msg->getId();
+
+      if (id == EstimatedState::getIdStatic())
+      {
+        const EstimatedState* es = static_cast<const EstimatedState*>(msg);
+        double values[] =
+        {
+          es->x, es->y, es->z, es->phi, es->theta, es->psi,
+          es->u, es->v, es->w, es->vx, es->vy, es->vz,
+          es->depth, es->alt
+        };
+
+        Concurrency::ScopedMutex lock(m_lock);
+        append(msg, c_estate_labels, sizeof(values) / sizeof(values[0]), values);
+      }
+      else if (id == Voltage::getIdStatic())
+      {
+        double values[] = {static_cast<const Voltage*>(msg)->value};
+        Concurrency::ScopedMutex lock(m_lock);
+        append(msg, c_scalar_labels, 1, values);
+      }
+      else if (id == Temperature::getIdStatic())
+      {
+        double values[] = {static_cast<const Temperature*>(msg)->value};
+        Concurrency::ScopedMutex lock(m_lock);
+        append(msg, c_scalar_labels, 1, values);
+      }
+    }
+
+    void
+    TelemetryStore::append(const Message* msg, const char* const* labels,
+                           unsigned count, const double* values)
+    {
+      uint64_t key = seriesKey(msg);
+
+      SeriesMap::iterator itr = m_series.find(key);
+      Series* srs = NULL;
+      if (itr == m_series.end())
+      {
+        srs = new Series;
+        srs->id = msg->getId();
+        srs->src = msg->getSource();
+        srs->src_ent = msg->getSourceEntity();
+        srs->abbrev = msg->getName();
+        srs->labels = labels;
+        srs->column_count = count;
+        srs->capacity = m_capacity;
+        srs->head = 0;
+        srs->size = 0;
+        srs->time.resize(srs->capacity);
+        srs->columns.resize(count);
+        for (unsigned i = 0; i < count; ++i)
+          srs->columns[i].resize(srs->capacity);
+        m_series[key] = srs;
+      }
+      else
+      {
+        srs = itr->second;
+      }
+
+      // Overwrite the oldest sample when the ring is full.
+      unsigned slot;
+      if (srs->size < srs->capacity)
+      {
+        slot = (srs->head + srs->size) % srs->capacity;
+        ++srs->size;
+      }
+      else
+      {
+        slot = srs->head;
+        srs->head = (srs->head + 1) % srs->capacity;
+      }
+
+      srs->time[slot] = msg->getTimeStamp();
+      for (unsigned i = 0; i < count; ++i)
+        srs->columns[i][slot] = values[i];
+    }
+
+    void
+    TelemetryStore::listJSON(std::ostream& os)
+    {
+      Concurrency::ScopedMutex lock(m_lock);
+
+      os << "var telemetry_series = [";
+      bool first = true;
+      for (SeriesMap::iterator itr = m_series.begin(); itr != m_series.end(); ++itr)
+      {
+        Series* srs = itr->second;
+        if (!first)
+          os << ",";
+        first = false;
+
+        os << "\n  {\"abbrev\": \"" << srs->abbrev << "\""
+           << ", \"src\": " << srs->src
+           << ", \"src_ent\": " << (unsigned)srs->src_ent
+           << ", \"size\": " << srs->size
+           << ", \"capacity\": " << srs->capacity
+           << "}";
+      }
+      os << "\n];";
+    }
+
+    void
+    TelemetryStore::queryJSON(std::ostream& os, uint16_t id, double begin_time,
+                              double end_time)
+    {
+      Concurrency::ScopedMutex lock(m_lock);
+
+      // Unix timestamps need more than the default precision.
+      os.precision(15);
+
+      os << "var telemetry = [";
+      bool first = true;
+      for (SeriesMap::iterator itr = m_series.begin(); itr != m_series.end(); ++itr)
+      {
+        Series* srs = itr->second;
+        if (srs->id != id)
+          continue;
+
+        if (!first)
+          os << ",";
+        first = false;
+
+        os << "\n  {\"abbrev\": \"" << srs->abbrev << "\""
+           << ", \"src\": " << srs->src
+           << ", \"src_ent\": " << (unsigned)srs->src_ent
+           << ", \"columns\": [\"time\"";
+        for (unsigned i = 0; i < srs->column_count; ++i)
+          os << ", \"" << srs->labels[i] << "\"";
+        os << "], \"rows\": [";
+
+        bool first_row = true;
+        for (unsigned i = 0; i < srs->size; ++i)
+        {
+          unsigned slot = (srs->head + i) % srs->capacity;
+          double time = srs->time[slot];
+
+          if (begin_time >= 0 && time < begin_time)
+            continue;
+          if (end_time >= 0 && time > end_time)
+            continue;
+
+          if (!first_row)
+            os << ",";
+          first_row = false;
+
+          os << "\n    [" << time;
+          for (unsigned j = 0; j < srs->column_count; ++j)
+            os << ", " << srs->columns[j][slot];
+          os << "]";
+        }
+
+        os << "]}";
+      }
+      os << "\n];";
+    }
+  }
+}
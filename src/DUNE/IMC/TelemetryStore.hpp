@@ -0,0 +1,134 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+#ifndef DUNE_IMC_TELEMETRY_STORE_HPP_INCLUDED_
+#define DUNE_IMC_TELEMETRY_STORE_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Concurrency/Mutex.hpp>
+
+namespace DUNE
+{
+  namespace IMC
+  {
+    // Forward declarations.
+    class Message;
+
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM TelemetryStore;
+
+    //! Bounded in-memory history of high-rate numeric telemetry.
+    //!
+    //! The store keeps one fixed-capacity ring per (message
+    //! identifier, source, source entity) tuple. Rings hold the
+    //! numeric fields of a small set of high-rate message types in
+    //! struct-of-arrays layout: one column per field plus a
+    //! timestamp column, so time-series windows can be answered from
+    //! memory without replaying log files. Messages of untracked
+    //! types are ignored by insert().
+    class TelemetryStore
+    {
+    public:
+      //! Default number of samples retained per series.
+      static const unsigned c_default_capacity = 600;
+
+      //! Constructor.
+      TelemetryStore(void);
+
+      //! Destructor.
+      ~TelemetryStore(void);
+
+      //! Define the number of samples retained per series. Applies
+      //! only to series created after the call.
+      //! @param[in] capacity ring capacity in samples.
+      void
+      setCapacity(unsigned capacity);
+
+      //! Insert one sample. Messages of untracked types are ignored.
+      //! @param[in] msg message object.
+      void
+      insert(const Message* msg);
+
+      //! Write a summary of all series as a JSON array.
+      //! @param[out] os output stream.
+      void
+      listJSON(std::ostream& os);
+
+      //! Write all series of a given message type, restricted to a
+      //! time window, as a JSON array of column/row objects.
+      //! @param[out] os output stream.
+      //! @param[in] id message identification number.
+      //! @param[in] begin_time window start (Unix time), negative
+      //! for no lower bound.
+      //! @param[in] end_time window end (Unix time), negative for no
+      //! upper bound.
+      void
+      queryJSON(std::ostream& os, uint16_t id, double begin_time, double end_time);
+
+    private:
+      // Forward declaration.
+      struct Series;
+      //! Series table, indexed by packed (id, source, entity) key.
+      typedef std::map<uint64_t, Series*> SeriesMap;
+
+      //! Series table.
+      SeriesMap m_series;
+      //! Ring capacity for new series.
+      unsigned m_capacity;
+      //! Concurrency lock.
+      Concurrency::Mutex m_lock;
+
+      //! Append one sample to the series of a message, creating the
+      //! series if needed. Must be called with the lock held.
+      //! @param[in] msg message object.
+      //! @param[in] labels column labels.
+      //! @param[in] count number of columns.
+      //! @param[in] values column values.
+      void
+      append(const Message* msg, const char* const* labels, unsigned count,
+             const double* values);
+
+      //! Non - copyable.
+      TelemetryStore(const TelemetryStore&);
+
+      //! Non - assignable.
+      TelemetryStore&
+      operator=(const TelemetryStore&);
+    };
+  }
+}
+
+#endif
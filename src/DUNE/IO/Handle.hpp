@@ -36,6 +36,7 @@
 
 // DUNE headers.
 #include <DUNE/Config.hpp>
+#include <DUNE/Time/Clock.hpp>
 
 namespace DUNE
 {
@@ -50,6 +51,11 @@ namespace DUNE
     class Handle
     {
     public:
+      //! Constructor.
+      Handle(void):
+        m_recv_ts(-1.0)
+      { }
+
       //! Destructor.
       virtual
       ~Handle(void)
@@ -91,7 +97,24 @@ namespace DUNE
       size_t
       read(uint8_t* data, size_t length)
       {
-        return doRead(data, length);
+        size_t rv = doRead(data, length);
+        if (rv > 0)
+          m_recv_ts = Time::Clock::getSinceEpoch();
+
+        return rv;
+      }
+
+      //! Retrieve the time at which the last successful read returned
+      //! data. This is the closest available approximation of the
+      //! arrival time of those bytes: it is captured at the read
+      //! boundary, before any parsing, since POSIX terminal devices
+      //! expose no kernel receive timestamps.
+      //! @return time of the last successful read in seconds since
+      //! the Unix Epoch or a negative value if no data was read yet.
+      double
+      getReceiveTimestamp(void) const
+      {
+        return m_recv_ts;
       }
 
       //! Read binary data from I/O handle.
@@ -169,6 +192,10 @@ namespace DUNE
         doFlushOutput();
         doFlushInput();
       }
+
+    private:
+      //! Time of the last successful read.
+      double m_recv_ts;
     };
   }
 }
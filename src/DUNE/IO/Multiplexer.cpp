@@ -0,0 +1,148 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <stdexcept>
+
+// DUNE headers.
+#include <DUNE/Concurrency/ScopedMutex.hpp>
+#include <DUNE/Time/Delay.hpp>
+#include <DUNE/IO/Poll.hpp>
+#include <DUNE/IO/Multiplexer.hpp>
+
+namespace DUNE
+{
+  namespace IO
+  {
+    //! Poll timeout, bounds the latency of add() and remove().
+    static const double c_poll_tout = 0.1;
+
+    Multiplexer::Multiplexer(void)
+    { }
+
+    Multiplexer::~Multiplexer(void)
+    {
+      if (isRunning())
+      {
+        stop();
+        join();
+      }
+    }
+
+    void
+    Multiplexer::add(Handle* handle, Listener* listener)
+    {
+      Concurrency::ScopedMutex l(m_lock);
+      Entry entry = {handle, listener};
+      m_entries.push_back(entry);
+
+      // The thread is only started when there is something to wait
+      // on, so an unused multiplexer costs nothing.
+      if (!isRunning())
+        start();
+    }
+
+    void
+    Multiplexer::remove(Handle* handle)
+    {
+      Concurrency::ScopedMutex l(m_lock);
+      std::vector<Entry>::iterator itr = m_entries.begin();
+      for (; itr != m_entries.end(); ++itr)
+      {
+        if (itr->handle == handle)
+        {
+          m_entries.erase(itr);
+          return;
+        }
+      }
+    }
+
+    void
+    Multiplexer::dispatch(Entry& entry)
+    {
+      try
+      {
+        size_t rv = entry.handle->read(m_bfr, c_read_size);
+        if (rv > 0)
+          entry.listener->onDataReception(entry.handle, m_bfr, rv);
+      }
+      catch (std::exception& e)
+      {
+        entry.listener->onReceptionError(entry.handle, e.what());
+      }
+    }
+
+    void
+    Multiplexer::run(void)
+    {
+      while (!isStopping())
+      {
+        Poll poll;
+        std::vector<NativeHandle> natives;
+
+        {
+          Concurrency::ScopedMutex l(m_lock);
+          for (size_t i = 0; i < m_entries.size(); ++i)
+          {
+            natives.push_back(m_entries[i].handle->getNative());
+            poll.add(natives[i]);
+          }
+        }
+
+        if (natives.empty())
+        {
+          Time::Delay::wait(c_poll_tout);
+          continue;
+        }
+
+        if (!poll.poll(c_poll_tout))
+          continue;
+
+        // Dispatch under the lock: a handle removed before this point
+        // is skipped, and once remove() returns no callback can be in
+        // flight for it.
+        Concurrency::ScopedMutex l(m_lock);
+        for (size_t i = 0; i < natives.size(); ++i)
+        {
+          if (!poll.wasTriggered(natives[i]))
+            continue;
+
+          for (size_t j = 0; j < m_entries.size(); ++j)
+          {
+            if (m_entries[j].handle->getNative() == natives[i])
+            {
+              dispatch(m_entries[j]);
+              break;
+            }
+          }
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,154 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+#ifndef DUNE_IO_MULTIPLEXER_HPP_INCLUDED_
+#define DUNE_IO_MULTIPLEXER_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Concurrency/Thread.hpp>
+#include <DUNE/Concurrency/Mutex.hpp>
+#include <DUNE/IO/Handle.hpp>
+
+namespace DUNE
+{
+  namespace IO
+  {
+    // Export symbol.
+    class DUNE_DLL_SYM Multiplexer;
+
+    //! Shared input thread for an arbitrary number of I/O handles.
+    //!
+    //! A Multiplexer waits on all registered handles at once and, when
+    //! one becomes readable, drains it and hands the bytes to the
+    //! listener registered with it. A single multiplexer can therefore
+    //! service every serial sensor of a vehicle instead of each task
+    //! dedicating a thread to blocking reads. The thread is started
+    //! when the first handle is registered.
+    //!
+    //! Listener callbacks run on the multiplexer thread, while the
+    //! registration lock is held: they must not block and must not
+    //! call add() or remove(). Once remove() returns no further
+    //! callbacks are made for that handle.
+    class Multiplexer: public Concurrency::Thread
+    {
+    public:
+      //! Reception callback interface.
+      class Listener
+      {
+      public:
+        //! Destructor.
+        virtual
+        ~Listener(void)
+        { }
+
+        //! Called when data is read from a registered handle. The
+        //! buffer belongs to the multiplexer and is only valid during
+        //! the call.
+        //! @param[in] handle I/O handle the data was read from.
+        //! @param[in] bfr read bytes.
+        //! @param[in] size number of bytes read.
+        virtual void
+        onDataReception(Handle* handle, const uint8_t* bfr, size_t size) = 0;
+
+        //! Called when reading a registered handle fails. The handle
+        //! stays registered; the listener decides whether to remove
+        //! it.
+        //! @param[in] handle I/O handle that failed.
+        //! @param[in] error error description.
+        virtual void
+        onReceptionError(Handle* handle, const std::string& error)
+        {
+          (void)handle;
+          (void)error;
+        }
+      };
+
+      //! Constructor.
+      Multiplexer(void);
+
+      //! Destructor, stops the multiplexer thread.
+      ~Multiplexer(void);
+
+      //! Register an I/O handle. The handle and listener must remain
+      //! valid until remove() is called.
+      //! @param[in] handle I/O handle.
+      //! @param[in] listener reception listener.
+      void
+      add(Handle* handle, Listener* listener);
+
+      //! Unregister an I/O handle.
+      //! @param[in] handle I/O handle.
+      void
+      remove(Handle* handle);
+
+    protected:
+      void
+      run(void);
+
+    private:
+      //! Size of the read buffer.
+      static const size_t c_read_size = 1024;
+
+      //! Registered handle.
+      struct Entry
+      {
+        //! I/O handle.
+        Handle* handle;
+        //! Reception listener.
+        Listener* listener;
+      };
+
+      //! Registered handles.
+      std::vector<Entry> m_entries;
+      //! Lock to serialize registration against dispatching.
+      Concurrency::Mutex m_lock;
+      //! Read buffer.
+      uint8_t m_bfr[c_read_size];
+
+      //! Read one triggered handle and dispatch to its listener.
+      //! @param[in] entry registered handle.
+      void
+      dispatch(Entry& entry);
+
+      // Non - copyable.
+      Multiplexer(const Multiplexer&);
+
+      // Non - assignable.
+      Multiplexer&
+      operator=(const Multiplexer&);
+    };
+  }
+}
+
+#endif
@@ -38,6 +38,17 @@
 #include <DUNE/Time/Utils.hpp>
 #include <DUNE/IO/Poll.hpp>
 
+// POSIX headers.
+#if defined(DUNE_OS_POSIX)
+#  include <unistd.h>
+#  include <fcntl.h>
+#endif
+
+// Linux headers.
+#if defined(DUNE_OS_LINUX)
+#  include <sys/eventfd.h>
+#endif
+
 namespace DUNE
 {
   namespace IO
@@ -45,25 +56,113 @@ namespace DUNE
     using std::memset;
     using System::Error;
 
+    Poll::Poll(void)
+    {
+#if defined(DUNE_OS_LINUX)
+      m_epfd = epoll_create(16);
+      if (m_epfd == -1)
+        throw Error("creating epoll instance", Error::getLastMessage());
+
+      m_wakeup_fd = eventfd(0, EFD_NONBLOCK);
+      if (m_wakeup_fd == -1)
+      {
+        ::close(m_epfd);
+        throw Error("creating wakeup descriptor", Error::getLastMessage());
+      }
+
+      epoll_event ev;
+      memset(&ev, 0, sizeof(ev));
+      ev.events = EPOLLIN;
+      ev.data.fd = m_wakeup_fd;
+      epoll_ctl(m_epfd, EPOLL_CTL_ADD, m_wakeup_fd, &ev);
+      m_event_count = 0;
+
+#elif defined(DUNE_OS_POSIX)
+      if (pipe(m_pipe) == -1)
+        throw Error("creating wakeup descriptor", Error::getLastMessage());
+
+      fcntl(m_pipe[0], F_SETFL, O_NONBLOCK);
+      fcntl(m_pipe[1], F_SETFL, O_NONBLOCK);
+
+#elif defined(DUNE_OS_WINDOWS)
+      m_rv = WAIT_TIMEOUT;
+#endif
+    }
+
+    Poll::~Poll(void)
+    {
+#if defined(DUNE_OS_LINUX)
+      ::close(m_wakeup_fd);
+      ::close(m_epfd);
+#elif defined(DUNE_OS_POSIX)
+      ::close(m_pipe[0]);
+      ::close(m_pipe[1]);
+#endif
+    }
+
     void
     Poll::add(const NativeHandle& handle)
     {
+#if defined(DUNE_OS_LINUX)
+      epoll_event ev;
+      memset(&ev, 0, sizeof(ev));
+      // EPOLLPRI covers exceptional conditions such as sysfs GPIO
+      // edge events; it is inert for regular stream handles.
+      ev.events = EPOLLIN | EPOLLPRI;
+      ev.data.fd = handle;
+      if (epoll_ctl(m_epfd, EPOLL_CTL_ADD, handle, &ev) == -1)
+      {
+        if (errno != EEXIST)
+          throw Error("adding handle", Error::getLastMessage());
+      }
+#endif
       m_handles.push_back(handle);
     }
 
     void
     Poll::remove(const NativeHandle& handle)
     {
+#if defined(DUNE_OS_LINUX)
+      // The handle might already be closed, tolerate stale descriptors.
+      if (epoll_ctl(m_epfd, EPOLL_CTL_DEL, handle, NULL) == -1)
+      {
+        if (errno != ENOENT && errno != EBADF)
+          throw Error("removing handle", Error::getLastMessage());
+      }
+#endif
       std::vector<NativeHandle>::iterator itr;
       itr = std::find(m_handles.begin(), m_handles.end(), handle);
       if (itr != m_handles.end())
         m_handles.erase(itr);
     }
 
+    void
+    Poll::wakeup(void)
+    {
+#if defined(DUNE_OS_LINUX)
+      uint64_t one = 1;
+      ssize_t rv = write(m_wakeup_fd, &one, sizeof(one));
+      (void)rv;
+#elif defined(DUNE_OS_POSIX)
+      char one = 1;
+      ssize_t rv = write(m_pipe[1], &one, sizeof(one));
+      (void)rv;
+#endif
+    }
+
     bool
     Poll::wasTriggered(const NativeHandle& handle)
     {
-#if defined(DUNE_OS_POSIX)
+#if defined(DUNE_OS_LINUX)
+      for (int i = 0; i < m_event_count; ++i)
+      {
+        if (m_events[i].data.fd == handle)
+          return true;
+      }
+
+      return false;
+
+#elif defined(DUNE_OS_POSIX)
       // Only the triggered fd's remain in the set after select() exits.
       return FD_ISSET(handle, &m_rfd) != 0;
 
@@ -82,7 +181,42 @@ namespace DUNE
     bool
     Poll::poll(double timeout)
     {
-#if defined(DUNE_OS_WINDOWS)
+#if defined(DUNE_OS_LINUX)
+      // Registrations are persistent, no per-call set rebuild is needed.
+      m_events.resize(m_handles.size() + 1);
+      m_event_count = 0;
+
+      int ms = (timeout < 0.0) ? -1 : (int)(timeout * 1000);
+      int rv = epoll_wait(m_epfd, &m_events[0], (int)m_events.size(), ms);
+
+      if (rv == -1)
+      {
+        //! Workaround for when we are interrupted by a signal.
+        if (errno == EINTR)
+          return false;
+        else
+          throw Error("polling handle", Error::getLastMessage());
+      }
+
+      m_event_count = rv;
+
+      bool triggered = false;
+      for (int i = 0; i < rv; ++i)
+      {
+        if (m_events[i].data.fd == m_wakeup_fd)
+        {
+          uint64_t dummy = 0;
+          while (read(m_wakeup_fd, &dummy, sizeof(dummy)) > 0);
+        }
+        else
+        {
+          triggered = true;
+        }
+      }
+
+      return triggered;
+
+#elif defined(DUNE_OS_WINDOWS)
       DWORD count = m_handles.size();
       m_rv = WaitForMultipleObjects(count, &m_handles[0], FALSE, timeout * 1000);
 
@@ -103,8 +237,9 @@ namespace DUNE
 
 #elif defined(DUNE_OS_POSIX)
       int rv = 0;
-      NativeHandle max = 0;
+      NativeHandle max = m_pipe[0];
       FD_ZERO(&m_rfd);
+      FD_SET(m_pipe[0], &m_rfd);
 
       for (std::vector<NativeHandle>::iterator itr = m_handles.begin(); itr != m_handles.end(); ++itr)
       {
@@ -132,6 +267,14 @@ namespace DUNE
           throw Error("polling handle", Error::getLastMessage());
       }
 
+      if (FD_ISSET(m_pipe[0], &m_rfd))
+      {
+        char bfr[8];
+        while (read(m_pipe[0], bfr, sizeof(bfr)) > 0);
+        FD_CLR(m_pipe[0], &m_rfd);
+        --rv;
+      }
+
       return rv > 0;
 #endif
     }
@@ -42,6 +42,11 @@
 #  include <sys/select.h>
 #endif
 
+// Linux headers.
+#if defined(DUNE_OS_LINUX)
+#  include <sys/epoll.h>
+#endif
+
 namespace DUNE
 {
   namespace IO
@@ -52,6 +57,12 @@ namespace DUNE
     class Poll
     {
     public:
+      //! Constructor.
+      Poll(void);
+
+      //! Destructor.
+      ~Poll(void);
+
       static bool
       poll(const NativeHandle& handle, double timeout);
 
@@ -99,14 +110,37 @@ namespace DUNE
         return wasTriggered(handle.getNative());
       }
 
+      //! Unblock a thread waiting in poll(). This function is safe to
+      //! call from other threads. Wakeups are not reported by
+      //! wasTriggered().
+      void
+      wakeup(void);
+
     private:
       //! List of native I/O handles.
       std::vector<NativeHandle> m_handles;
-#if defined(DUNE_OS_POSIX)
+#if defined(DUNE_OS_LINUX)
+      //! Epoll instance with persistent handle registrations.
+      int m_epfd;
+      //! Event file descriptor used by wakeup().
+      int m_wakeup_fd;
+      //! Events reported by the last call to poll().
+      std::vector<epoll_event> m_events;
+      //! Number of valid entries in m_events.
+      int m_event_count;
+#elif defined(DUNE_OS_POSIX)
       fd_set m_rfd;
+      //! Self-pipe used by wakeup().
+      int m_pipe[2];
 #elif defined(DUNE_OS_WINDOWS)
       DWORD m_rv;
 #endif
+
+      // Non - copyable.
+      Poll(const Poll&);
+
+      // Non - assignable.
+      Poll& operator=(const Poll&);
     };
   }
 }
@@ -64,6 +64,9 @@ namespace DUNE
 
       IMC::MessageList<IMC::TrajectoryPoint>::const_iterator itr;
 
+      m_traj.clear();
+      m_traj.reserve(list->size());
+
       for (itr = list->begin(); itr != list->end(); itr++)
       {
         TPoint p;
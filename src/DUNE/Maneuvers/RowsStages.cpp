@@ -65,6 +65,32 @@ namespace DUNE
       initialize();
     }
 
+    void
+    RowsStages::reset(const IMC::Rows* maneuver)
+    {
+      m_lat = maneuver->lat;
+      m_lon = maneuver->lon;
+      m_bearing = maneuver->bearing;
+      m_cross_angle = maneuver->cross_angle;
+      m_width = maneuver->width;
+      m_length = maneuver->length;
+      m_hstep = maneuver->hstep;
+      m_coff = maneuver->coff;
+      m_alternation = maneuver->alternation;
+      m_flags = maneuver->flags;
+
+      initialize();
+    }
+
+    void
+    RowsStages::restart(void)
+    {
+      m_hstep_updated = m_hstep;
+      m_curr = 0;
+      m_sabs = Stage("undefined", 0, 0);
+      m_index = 0;
+    }
+
     //! Default constructor.
     RowsStages::RowsStages(const fp64_t lat, const fp64_t lon,
         const fp64_t bearing, const fp64_t cross_angle, const fp32_t width,
@@ -205,6 +231,11 @@ namespace DUNE
       unsigned curr = 0;
       float range;
 
+      // Rebuild the distance list from scratch and size it upfront:
+      // one entry per waypoint, a full lap of the stage cycle per curve.
+      m_all_distances.clear();
+      m_all_distances.reserve((curves + 1) * m_stages.size());
+
       last.x += m_stages[0].x;
       last.y += m_stages[0].y;
       range = Coordinates::getRange(m_stages[0], zero);
@@ -49,7 +49,13 @@ namespace DUNE
     class DUNE_DLL_SYM RowsStages;
 
     //! Class to parse a rows maneuver and to
-    //! create and fire each stage
+    //! create and fire each stage.
+    //! Waypoints are generated lazily: only the fixed cycle of row
+    //! stages is kept and getNextPoint() derives each point on demand,
+    //! so state is constant regardless of the number of rows and the
+    //! horizontal step may change between points. The per-waypoint
+    //! distance list is only materialized by getDistance(), used for
+    //! plan time estimation.
     class RowsStages
     {
     public:
@@ -74,6 +80,17 @@ namespace DUNE
       //! @param[in] task pointer to task object (debug and inf)
       RowsStages(const IMC::Rows* maneuver, Tasks::Task* task);
 
+      //! Reconfigure the stages from another rows maneuver, reusing
+      //! the storage already allocated by this object.
+      //! @param[in] maneuver pointer to rows maneuver
+      void
+      reset(const IMC::Rows* maneuver);
+
+      //! Restart the iteration over the pattern, keeping the
+      //! computed stages.
+      void
+      restart(void);
+
       //! Get next point
       //! @param[out] lat latitude of current point
       //! @param[out] lon longitude of current point
@@ -89,7 +106,8 @@ namespace DUNE
       bool
       getFirstPoint(double* lat, double* lon);
 
-      //! Get total distance and last point coordinates
+      //! Get total distance and last point coordinates. Builds the
+      //! per-waypoint distance list, replacing any previous contents.
       //! @param[out] lat latitude of last point found
       //! @param[out] lon longitude of last point found
       //! @return total distance covered
@@ -41,7 +41,9 @@ namespace DUNE
 #include <DUNE/Math/Derivative.hpp>
 #include <DUNE/Math/General.hpp>
 #include <DUNE/Math/Matrix.hpp>
+#include <DUNE/Math/MatrixN.hpp>
 #include <DUNE/Math/Angles.hpp>
+#include <DUNE/Math/TrigApprox.hpp>
 #include <DUNE/Math/Random.hpp>
 #include <DUNE/Math/Optimization.hpp>
 #include <DUNE/Math/QPSolver.hpp>
@@ -152,7 +152,9 @@ namespace DUNE
       inline static fp64_t
       minSignedAngle(fp64_t source, fp64_t target)
       {
-        return std::atan2(std::sin(target - source), std::cos(target - source));
+        // Same result as atan2(sin(d), cos(d)) without the three
+        // transcendental calls.
+        return normalizeRadian(target - source);
       }
     };
   }
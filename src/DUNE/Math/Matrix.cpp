@@ -881,6 +881,323 @@ namespace DUNE
       return *this;
     }
 
+    Matrix&
+    Matrix::addScaled(double x, const Matrix& m)
+    {
+      if (m_nrows != m.m_nrows || m_ncols != m.m_ncols)
+        throw Error("Incompatible dimensions!");
+
+      split();
+
+      double* p1 = m_data;
+      double* p2 = m.m_data;
+
+      for (size_t i = 0; i < m_size; i++)
+        *(p1++) += x * *(p2++);
+
+      return *this;
+    }
+
+    void
+    Matrix::multiply(const Matrix& m1, const Matrix& m2, Matrix& d)
+    {
+      if (m1.isEmpty() || m2.isEmpty())
+        throw Matrix::Error("Trying to access an empty matrix!");
+
+      if (m1.m_ncols != m2.m_nrows)
+        throw Matrix::Error("Incompatible dimensions!");
+
+      if (d.m_data == m1.m_data || d.m_data == m2.m_data)
+        throw Matrix::Error("Destination must not alias an operand!");
+
+      if (d.m_nrows != m1.m_nrows || d.m_ncols != m2.m_ncols)
+        d.resize(m1.m_nrows, m2.m_ncols);
+
+      d.fill(0);
+
+      int n = m1.m_nrows;
+      int m = m1.m_ncols;
+      int r = m2.m_ncols;
+
+      double* m1_p = m1.m_data;
+
+      for (int i = 0; i < n; i++)
+      {
+        for (int k = 0; k < m; k++)
+        {
+          double v = *m1_p++;
+          double* m2_p = m2.m_data + k * r;
+          double* d_p = d.m_data + i * r;
+
+          for (int j = 0; j < r; j++)
+          {
+            *d_p += v * (*m2_p);
+            d_p++;
+            m2_p++;
+          }
+        }
+      }
+    }
+
+    void
+    Matrix::multiplyAdd(const Matrix& m1, const Matrix& m2, Matrix& d)
+    {
+      if (m1.isEmpty() || m2.isEmpty())
+        throw Matrix::Error("Trying to access an empty matrix!");
+
+      if (m1.m_ncols != m2.m_nrows)
+        throw Matrix::Error("Incompatible dimensions!");
+
+      if (d.m_nrows != m1.m_nrows || d.m_ncols != m2.m_ncols)
+        throw Matrix::Error("Incompatible dimensions!");
+
+      if (d.m_data == m1.m_data || d.m_data == m2.m_data)
+        throw Matrix::Error("Destination must not alias an operand!");
+
+      d.split();
+
+      int n = m1.m_nrows;
+      int m = m1.m_ncols;
+      int r = m2.m_ncols;
+
+      double* m1_p = m1.m_data;
+
+      for (int i = 0; i < n; i++)
+      {
+        for (int k = 0; k < m; k++)
+        {
+          double v = *m1_p++;
+          double* m2_p = m2.m_data + k * r;
+          double* d_p = d.m_data + i * r;
+
+          for (int j = 0; j < r; j++)
+          {
+            *d_p += v * (*m2_p);
+            d_p++;
+            m2_p++;
+          }
+        }
+      }
+    }
+
+    void
+    Matrix::multiplySub(const Matrix& m1, const Matrix& m2, Matrix& d)
+    {
+      if (m1.isEmpty() || m2.isEmpty())
+        throw Matrix::Error("Trying to access an empty matrix!");
+
+      if (m1.m_ncols != m2.m_nrows)
+        throw Matrix::Error("Incompatible dimensions!");
+
+      if (d.m_nrows != m1.m_nrows || d.m_ncols != m2.m_ncols)
+        throw Matrix::Error("Incompatible dimensions!");
+
+      if (d.m_data == m1.m_data || d.m_data == m2.m_data)
+        throw Matrix::Error("Destination must not alias an operand!");
+
+      d.split();
+
+      int n = m1.m_nrows;
+      int m = m1.m_ncols;
+      int r = m2.m_ncols;
+
+      double* m1_p = m1.m_data;
+
+      for (int i = 0; i < n; i++)
+      {
+        for (int k = 0; k < m; k++)
+        {
+          double v = *m1_p++;
+          double* m2_p = m2.m_data + k * r;
+          double* d_p = d.m_data + i * r;
+
+          for (int j = 0; j < r; j++)
+          {
+            *d_p -= v * (*m2_p);
+            d_p++;
+            m2_p++;
+          }
+        }
+      }
+    }
+
+    void
+    Matrix::multiplyByTranspose(const Matrix& m1, const Matrix& m2, Matrix& d)
+    {
+      if (m1.isEmpty() || m2.isEmpty())
+        throw Matrix::Error("Trying to access an empty matrix!");
+
+      if (m1.m_ncols != m2.m_ncols)
+        throw Matrix::Error("Incompatible dimensions!");
+
+      if (d.m_data == m1.m_data || d.m_data == m2.m_data)
+        throw Matrix::Error("Destination must not alias an operand!");
+
+      if (d.m_nrows != m1.m_nrows || d.m_ncols != m2.m_nrows)
+        d.resize(m1.m_nrows, m2.m_nrows);
+      else
+        d.split();
+
+      int n = m1.m_nrows;
+      int m = m1.m_ncols;
+      int r = m2.m_nrows;
+
+      for (int i = 0; i < n; i++)
+      {
+        double* d_p = d.m_data + i * r;
+
+        for (int j = 0; j < r; j++)
+        {
+          const double* m1_p = m1.m_data + i * m;
+          const double* m2_p = m2.m_data + j * m;
+          double sum = 0;
+
+          for (int k = 0; k < m; k++)
+            sum += m1_p[k] * m2_p[k]; // <-> d(i,j) += m1(i,k) * m2(j,k)
+
+          *d_p++ = sum;
+        }
+      }
+    }
+
+    //! Check if a block of a row-major array is entirely zero.
+    static bool
+    blockIsZero(const double* data, size_t stride, size_t rows, size_t cols)
+    {
+      for (size_t i = 0; i < rows; i++)
+      {
+        const double* p = data + i * stride;
+
+        for (size_t j = 0; j < cols; j++)
+        {
+          if (p[j] != 0.0)
+            return false;
+        }
+      }
+
+      return true;
+    }
+
+    //! Sum of a block partition, to validate it against a dimension.
+    static size_t
+    blockSum(const std::vector<size_t>& blocks)
+    {
+      size_t sum = 0;
+
+      for (size_t b = 0; b < blocks.size(); b++)
+        sum += blocks[b];
+
+      return sum;
+    }
+
+    void
+    Matrix::multiplyBlocks(const Matrix& m1, const Matrix& m2, Matrix& d,
+                           const std::vector<size_t>& blocks)
+    {
+      if (m1.isEmpty() || m2.isEmpty())
+        throw Matrix::Error("Trying to access an empty matrix!");
+
+      if (m1.m_nrows != m1.m_ncols || m1.m_ncols != m2.m_nrows)
+        throw Matrix::Error("Incompatible dimensions!");
+
+      if (blockSum(blocks) != m1.m_nrows)
+        throw Matrix::Error("Incompatible dimensions!");
+
+      if (d.m_data == m1.m_data || d.m_data == m2.m_data)
+        throw Matrix::Error("Destination must not alias an operand!");
+
+      if (d.m_nrows != m1.m_nrows || d.m_ncols != m2.m_ncols)
+        d.resize(m1.m_nrows, m2.m_ncols);
+      else
+        d.split();
+
+      d.fill(0);
+
+      size_t n = m1.m_nrows;
+      size_t r = m2.m_ncols;
+
+      size_t ro = 0;
+      for (size_t bi = 0; bi < blocks.size(); ro += blocks[bi], bi++)
+      {
+        size_t co = 0;
+        for (size_t bk = 0; bk < blocks.size(); co += blocks[bk], bk++)
+        {
+          if (blockIsZero(m1.m_data + ro * n + co, n, blocks[bi], blocks[bk]))
+            continue;
+
+          for (size_t i = ro; i < ro + blocks[bi]; i++)
+          {
+            const double* m1_p = m1.m_data + i * n + co;
+            double* d_p = d.m_data + i * r;
+
+            for (size_t k = co; k < co + blocks[bk]; k++)
+            {
+              double v = *m1_p++;
+              const double* m2_p = m2.m_data + k * r;
+
+              for (size_t j = 0; j < r; j++)
+                d_p[j] += v * m2_p[j];
+            }
+          }
+        }
+      }
+    }
+
+    void
+    Matrix::multiplyByTransposeBlocks(const Matrix& m1, const Matrix& m2, Matrix& d,
+                                      const std::vector<size_t>& blocks)
+    {
+      if (m1.isEmpty() || m2.isEmpty())
+        throw Matrix::Error("Trying to access an empty matrix!");
+
+      if (m2.m_nrows != m2.m_ncols || m1.m_ncols != m2.m_ncols)
+        throw Matrix::Error("Incompatible dimensions!");
+
+      if (blockSum(blocks) != m2.m_nrows)
+        throw Matrix::Error("Incompatible dimensions!");
+
+      if (d.m_data == m1.m_data || d.m_data == m2.m_data)
+        throw Matrix::Error("Destination must not alias an operand!");
+
+      if (d.m_nrows != m1.m_nrows || d.m_ncols != m2.m_nrows)
+        d.resize(m1.m_nrows, m2.m_nrows);
+      else
+        d.split();
+
+      d.fill(0);
+
+      size_t n = m1.m_nrows;
+      size_t m = m1.m_ncols;
+
+      size_t ro = 0;
+      for (size_t bj = 0; bj < blocks.size(); ro += blocks[bj], bj++)
+      {
+        size_t co = 0;
+        for (size_t bk = 0; bk < blocks.size(); co += blocks[bk], bk++)
+        {
+          if (blockIsZero(m2.m_data + ro * m + co, m, blocks[bj], blocks[bk]))
+            continue;
+
+          for (size_t i = 0; i < n; i++)
+          {
+            const double* m1_p = m1.m_data + i * m;
+            double* d_p = d.m_data + i * m2.m_nrows;
+
+            for (size_t j = ro; j < ro + blocks[bj]; j++)
+            {
+              const double* m2_p = m2.m_data + j * m;
+              double sum = 0;
+
+              for (size_t k = co; k < co + blocks[bk]; k++)
+                sum += m1_p[k] * m2_p[k]; // <-> d(i,j) += m1(i,k) * m2(j,k)
+
+              d_p[j] += sum;
+            }
+          }
+        }
+      }
+    }
+
     void
     Matrix::put(size_t i, size_t j, const Matrix& a)
     {
@@ -1480,6 +1797,7 @@ namespace DUNE
         throw Matrix::Error("Incompatible dimensions!");
 
       Matrix s(m1.m_nrows, m2.m_ncols);
+      s.fill(0);
 
       int n = m1.m_nrows;
       int m = m1.m_ncols;
@@ -1495,10 +1813,10 @@ namespace DUNE
           double* m2_p = m2.m_data + k * r;
           double* s_p = s.m_data + i * r;
 
+          // Branch-free inner loop over contiguous rows: the compiler
+          // can unroll and vectorize it.
           for (int j = 0; j < r; j++)
           {
-            if (!k)
-              *s_p = 0;
             *s_p += v * (*m2_p); // <-> s(i,j) += m1(i,k) * m2(k,j)
             s_p++;
             m2_p++;
@@ -2259,7 +2577,7 @@ namespace DUNE
         DUNE::Utils::String::split(clines[r], " ", rvalues);
 
         if (rvalues.size() != m_ncols)
-          throw Error(Utils::String::str("Invalid number of columns in configuration - row: %d", r));
+          throw Error(Utils::String::str("Invalid number of columns in configuration - row: %lu", (unsigned long)r));
 
         for (size_t c = 0; c < m_ncols; ++c)
           *p++ = rvalues[c];
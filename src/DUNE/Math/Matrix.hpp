@@ -441,6 +441,76 @@ namespace DUNE
       Matrix&
       operator/=(double x);
 
+      //! This method adds a scaled Matrix to this one (*this += x * m)
+      //! without creating a temporary.
+      //! @param[in] x scale factor
+      //! @param[in] m reference to matrix to be scaled and added
+      //! @return reference to resultant matrix
+      Matrix&
+      addScaled(double x, const Matrix& m);
+
+      //! This method stores the product of two matrices in a
+      //! destination Matrix (d = m1 * m2), reusing the destination's
+      //! storage when its dimensions already match and thus avoiding
+      //! the temporary of the product operator.
+      //! @param[in] m1 left operand
+      //! @param[in] m2 right operand
+      //! @param[out] d destination matrix
+      static void
+      multiply(const Matrix& m1, const Matrix& m2, Matrix& d);
+
+      //! This method accumulates the product of two matrices in a
+      //! destination Matrix (d += m1 * m2) without creating a
+      //! temporary.
+      //! @param[in] m1 left operand
+      //! @param[in] m2 right operand
+      //! @param[in,out] d destination matrix
+      static void
+      multiplyAdd(const Matrix& m1, const Matrix& m2, Matrix& d);
+
+      //! This method subtracts the product of two matrices from a
+      //! destination Matrix (d -= m1 * m2) without creating a
+      //! temporary.
+      //! @param[in] m1 left operand
+      //! @param[in] m2 right operand
+      //! @param[in,out] d destination matrix
+      static void
+      multiplySub(const Matrix& m1, const Matrix& m2, Matrix& d);
+
+      //! This method stores the product of a matrix by the transpose
+      //! of another in a destination Matrix (d = m1 * m2'), without
+      //! materializing the transpose. Both operands are walked with
+      //! unit stride, so the inner dot product vectorizes.
+      //! @param[in] m1 left operand
+      //! @param[in] m2 right operand (used transposed)
+      //! @param[out] d destination matrix
+      static void
+      multiplyByTranspose(const Matrix& m1, const Matrix& m2, Matrix& d);
+
+      //! This method stores the product of a square block partitioned
+      //! matrix by another in a destination Matrix (d = m1 * m2),
+      //! skipping blocks of m1 that are entirely zero. The partition
+      //! applies to both dimensions of m1 and must cover them.
+      //! @param[in] m1 left operand (square, partitioned)
+      //! @param[in] m2 right operand
+      //! @param[out] d destination matrix
+      //! @param[in] blocks size of each diagonal block of m1
+      static void
+      multiplyBlocks(const Matrix& m1, const Matrix& m2, Matrix& d,
+                     const std::vector<size_t>& blocks);
+
+      //! This method stores the product of a matrix by the transpose
+      //! of a square block partitioned matrix in a destination Matrix
+      //! (d = m1 * m2'), skipping blocks of m2 that are entirely
+      //! zero and without materializing the transpose.
+      //! @param[in] m1 left operand
+      //! @param[in] m2 right operand (square, partitioned, used transposed)
+      //! @param[out] d destination matrix
+      //! @param[in] blocks size of each diagonal block of m2
+      static void
+      multiplyByTransposeBlocks(const Matrix& m1, const Matrix& m2, Matrix& d,
+                                const std::vector<size_t>& blocks);
+
       //! This method fills a submatrix of a given Matrix.
       //! @param[in] i row index
       //! @param[in] j column index
@@ -0,0 +1,331 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+#ifndef DUNE_MATH_MATRIX_N_HPP_INCLUDED_
+#define DUNE_MATH_MATRIX_N_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <cmath>
+#include <cstring>
+
+// DUNE headers.
+#include <DUNE/Math/Matrix.hpp>
+
+namespace DUNE
+{
+  namespace Math
+  {
+    //! Dense matrix with compile-time dimensions and stack storage.
+    //!
+    //! Unlike Matrix, objects of this class perform no heap
+    //! allocation and no reference counting: all elements live inside
+    //! the object and every operation is a plain loop over fixed
+    //! bounds that the compiler can unroll and vectorize. It is
+    //! intended for the small matrices (tens of elements) found in
+    //! the inner loops of navigation filters, where the bookkeeping
+    //! of the dynamic Matrix dominates the arithmetic.
+    template <unsigned R, unsigned C>
+    class MatrixN
+    {
+    public:
+      //! Construct a zero-filled matrix.
+      MatrixN(void)
+      {
+        fill(0.0);
+      }
+
+      //! Construct from a dynamic matrix of matching dimensions.
+      //! @param[in] m source matrix.
+      explicit
+      MatrixN(const Matrix& m)
+      {
+        if ((unsigned)m.rows() != R || (unsigned)m.columns() != C)
+          throw Matrix::Error("incompatible dimensions");
+
+        for (unsigned i = 0; i < R; ++i)
+          for (unsigned j = 0; j < C; ++j)
+            m_data[i * C + j] = m.element(i, j);
+      }
+
+      //! Retrieve the number of rows.
+      //! @return number of rows.
+      static unsigned
+      rows(void)
+      {
+        return R;
+      }
+
+      //! Retrieve the number of columns.
+      //! @return number of columns.
+      static unsigned
+      columns(void)
+      {
+        return C;
+      }
+
+      //! Fill all elements with a given value.
+      //! @param[in] value fill value.
+      void
+      fill(double value)
+      {
+        for (unsigned i = 0; i < R * C; ++i)
+          m_data[i] = value;
+      }
+
+      //! Turn the matrix into an identity matrix (ones on the main
+      //! diagonal, zeros elsewhere).
+      void
+      identity(void)
+      {
+        fill(0.0);
+        for (unsigned i = 0; i < (R < C ? R : C); ++i)
+          m_data[i * C + i] = 1.0;
+      }
+
+      //! Element access (by row and column).
+      //! @param[in] i row index.
+      //! @param[in] j column index.
+      //! @return reference to element.
+      double&
+      operator()(unsigned i, unsigned j)
+      {
+        return m_data[i * C + j];
+      }
+
+      //! Element access (by row and column).
+      //! @param[in] i row index.
+      //! @param[in] j column index.
+      //! @return element value.
+      double
+      operator()(unsigned i, unsigned j) const
+      {
+        return m_data[i * C + j];
+      }
+
+      //! Linear element access (row-major order).
+      //! @param[in] i element index.
+      //! @return reference to element.
+      double&
+      operator()(unsigned i)
+      {
+        return m_data[i];
+      }
+
+      //! Linear element access (row-major order).
+      //! @param[in] i element index.
+      //! @return element value.
+      double
+      operator()(unsigned i) const
+      {
+        return m_data[i];
+      }
+
+      //! Add another matrix to this one, element by element.
+      //! @param[in] m matrix to add.
+      //! @return reference to this matrix.
+      MatrixN&
+      operator+=(const MatrixN& m)
+      {
+        for (unsigned i = 0; i < R * C; ++i)
+          m_data[i] += m.m_data[i];
+        return *this;
+      }
+
+      //! Subtract another matrix from this one, element by element.
+      //! @param[in] m matrix to subtract.
+      //! @return reference to this matrix.
+      MatrixN&
+      operator-=(const MatrixN& m)
+      {
+        for (unsigned i = 0; i < R * C; ++i)
+          m_data[i] -= m.m_data[i];
+        return *this;
+      }
+
+      //! Multiply all elements by a scalar.
+      //! @param[in] x scalar value.
+      //! @return reference to this matrix.
+      MatrixN&
+      operator*=(double x)
+      {
+        for (unsigned i = 0; i < R * C; ++i)
+          m_data[i] *= x;
+        return *this;
+      }
+
+      //! Convert to a dynamic matrix.
+      //! @return dynamic matrix with the same contents.
+      Matrix
+      toMatrix(void) const
+      {
+        Matrix m(R, C);
+        for (unsigned i = 0; i < R; ++i)
+          for (unsigned j = 0; j < C; ++j)
+            m(i, j) = m_data[i * C + j];
+        return m;
+      }
+
+    private:
+      //! Element storage (row-major order).
+      double m_data[R * C];
+    };
+
+    //! Sum of two fixed-size matrices.
+    //! @param[in] a left operand.
+    //! @param[in] b right operand.
+    //! @return a + b.
+    template <unsigned R, unsigned C>
+    inline MatrixN<R, C>
+    operator+(const MatrixN<R, C>& a, const MatrixN<R, C>& b)
+    {
+      MatrixN<R, C> s(a);
+      s += b;
+      return s;
+    }
+
+    //! Difference of two fixed-size matrices.
+    //! @param[in] a left operand.
+    //! @param[in] b right operand.
+    //! @return a - b.
+    template <unsigned R, unsigned C>
+    inline MatrixN<R, C>
+    operator-(const MatrixN<R, C>& a, const MatrixN<R, C>& b)
+    {
+      MatrixN<R, C> s(a);
+      s -= b;
+      return s;
+    }
+
+    //! Product of two fixed-size matrices. All loop bounds are known
+    //! at compile time, so the kernel unrolls and keeps the
+    //! accumulator in a register.
+    //! @param[in] a left operand.
+    //! @param[in] b right operand.
+    //! @return a * b.
+    template <unsigned R, unsigned K, unsigned C>
+    inline MatrixN<R, C>
+    operator*(const MatrixN<R, K>& a, const MatrixN<K, C>& b)
+    {
+      MatrixN<R, C> p;
+      for (unsigned i = 0; i < R; ++i)
+      {
+        for (unsigned j = 0; j < C; ++j)
+        {
+          double sum = 0.0;
+          for (unsigned k = 0; k < K; ++k)
+            sum += a(i, k) * b(k, j);
+          p(i, j) = sum;
+        }
+      }
+      return p;
+    }
+
+    //! Transpose of a fixed-size matrix.
+    //! @param[in] a matrix to transpose.
+    //! @return transposed matrix.
+    template <unsigned R, unsigned C>
+    inline MatrixN<C, R>
+    transpose(const MatrixN<R, C>& a)
+    {
+      MatrixN<C, R> t;
+      for (unsigned i = 0; i < R; ++i)
+        for (unsigned j = 0; j < C; ++j)
+          t(j, i) = a(i, j);
+      return t;
+    }
+
+    //! Inverse of a square fixed-size matrix, computed by
+    //! Gauss-Jordan elimination with partial pivoting.
+    //! @param[in] a matrix to invert.
+    //! @return inverted matrix.
+    template <unsigned N>
+    inline MatrixN<N, N>
+    inverse(const MatrixN<N, N>& a)
+    {
+      MatrixN<N, N> w(a);
+      MatrixN<N, N> inv;
+      inv.identity();
+
+      for (unsigned i = 0; i < N; ++i)
+      {
+        // Partial pivoting.
+        unsigned pivot = i;
+        for (unsigned k = i + 1; k < N; ++k)
+        {
+          if (std::fabs(w(k, i)) > std::fabs(w(pivot, i)))
+            pivot = k;
+        }
+
+        if (std::fabs(w(pivot, i)) < Matrix::get_precision())
+          throw Matrix::Error("inverting singular matrix");
+
+        if (pivot != i)
+        {
+          for (unsigned j = 0; j < N; ++j)
+          {
+            double tmp = w(i, j);
+            w(i, j) = w(pivot, j);
+            w(pivot, j) = tmp;
+
+            tmp = inv(i, j);
+            inv(i, j) = inv(pivot, j);
+            inv(pivot, j) = tmp;
+          }
+        }
+
+        double d = 1.0 / w(i, i);
+        for (unsigned j = 0; j < N; ++j)
+        {
+          w(i, j) *= d;
+          inv(i, j) *= d;
+        }
+
+        for (unsigned k = 0; k < N; ++k)
+        {
+          if (k == i)
+            continue;
+
+          double f = w(k, i);
+          if (f == 0.0)
+            continue;
+
+          for (unsigned j = 0; j < N; ++j)
+          {
+            w(k, j) -= f * w(i, j);
+            inv(k, j) -= f * inv(i, j);
+          }
+        }
+      }
+
+      return inv;
+    }
+  }
+}
+
+#endif
@@ -31,13 +31,23 @@
 #define DUNE_MATH_MOVING_AVERAGE_HPP_INCLUDED_
 
 // ISO C++ 98 headers.
+#include <deque>
+#include <utility>
 #include <vector>
 #include <cmath>
 
+// DUNE headers.
+#include <DUNE/Config.hpp>
+
 namespace DUNE
 {
   namespace Math
   {
+    //! Moving statistics over a fixed size sample window. Mean and
+    //! standard deviation are maintained incrementally with
+    //! Kahan-compensated running sums, and minimum and maximum with
+    //! monotonic deques, so every query is O(1) regardless of the
+    //! window size.
     template <typename T>
     class MovingAverage
     {
@@ -53,8 +63,14 @@ namespace DUNE
       clear(void)
       {
         m_accum = 0;
+        m_accum_c = 0;
+        m_accum2 = 0;
+        m_accum2_c = 0;
         m_oldest = 0;
+        m_count = 0;
         m_window.clear();
+        m_minq.clear();
+        m_maxq.clear();
       }
 
       //! Update sample with new value.
@@ -65,14 +81,38 @@ namespace DUNE
         if (sampleSize() < m_window_size)
         {
           m_window.push_back(value);
-          m_accum += value;
-          return m_accum / sampleSize();
+          kahanAdd(m_accum, m_accum_c, value);
+          kahanAdd(m_accum2, m_accum2_c, value * value);
+        }
+        else
+        {
+          T oldest = m_window[m_oldest];
+          kahanAdd(m_accum, m_accum_c, value - oldest);
+          kahanAdd(m_accum2, m_accum2_c, value * value - oldest * oldest);
+          m_window[m_oldest] = value;
+          m_oldest = (m_oldest + 1) % m_window_size;
         }
 
-        m_accum += value - m_window[m_oldest];
-        m_window[m_oldest] = value;
-        m_oldest = (m_oldest + 1) % m_window_size;
-        return m_accum / m_window_size;
+        // Values dominated by the new one can never be a window
+        // extreme again, so the deques stay sorted and their fronts
+        // are the current minimum and maximum.
+        while (!m_minq.empty() && m_minq.back().second >= value)
+          m_minq.pop_back();
+        m_minq.push_back(std::make_pair(m_count, value));
+
+        while (!m_maxq.empty() && m_maxq.back().second <= value)
+          m_maxq.pop_back();
+        m_maxq.push_back(std::make_pair(m_count, value));
+
+        while (m_minq.front().first + m_window_size <= m_count)
+          m_minq.pop_front();
+
+        while (m_maxq.front().first + m_window_size <= m_count)
+          m_maxq.pop_front();
+
+        ++m_count;
+
+        return m_accum / sampleSize();
       }
 
       //! Extract mean value of the sample.
@@ -96,13 +136,37 @@ namespace DUNE
         if (!size)
           return 0;
 
-        T sdev = 0;
-        T u = mean();
+        T u = m_accum / size;
+        T var = m_accum2 / size - u * u;
+
+        // The difference of the compensated sums can still go
+        // marginally negative for a constant signal.
+        if (var < 0)
+          var = 0;
+
+        return std::sqrt(var);
+      }
+
+      //! Extract minimum value of the sample.
+      //! @return minimum value.
+      T
+      min(void)
+      {
+        if (m_minq.empty())
+          return 0;
+
+        return m_minq.front().second;
+      }
 
-        for (unsigned i = 0; i < size; i++)
-          sdev += (m_window[i] - u) * (m_window[i] - u);
+      //! Extract maximum value of the sample.
+      //! @return maximum value.
+      T
+      max(void)
+      {
+        if (m_maxq.empty())
+          return 0;
 
-        return std::sqrt(sdev / size);
+        return m_maxq.front().second;
       }
 
       //! Know size of sample.
@@ -124,12 +188,37 @@ namespace DUNE
     private:
       //! Accumulator.
       T m_accum;
+      //! Accumulator compensation term.
+      T m_accum_c;
+      //! Accumulator of squared values.
+      T m_accum2;
+      //! Squared accumulator compensation term.
+      T m_accum2_c;
       //! Window size.
       unsigned m_window_size;
       //! Window.
       std::vector<T> m_window;
       //! Index of oldest value.
       unsigned m_oldest;
+      //! Number of samples inserted since the last clear.
+      uint64_t m_count;
+      //! Monotonic deque of window minimum candidates.
+      std::deque<std::pair<uint64_t, T> > m_minq;
+      //! Monotonic deque of window maximum candidates.
+      std::deque<std::pair<uint64_t, T> > m_maxq;
+
+      //! Add a value to a Kahan-compensated running sum.
+      //! @param[in,out] sum running sum.
+      //! @param[in,out] comp compensation term.
+      //! @param[in] value value to add.
+      static void
+      kahanAdd(T& sum, T& comp, const T& value)
+      {
+        T y = value - comp;
+        T t = sum + y;
+        comp = (t - sum) - y;
+        sum = t;
+      }
     };
   }
 }
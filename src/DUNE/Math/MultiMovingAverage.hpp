@@ -24,7 +24,7 @@
 // https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
 // http://ec.europa.eu/idabc/eupl.html.                                     *
 //***************************************************************************
-// Author: Pedro Calado                                                     *
+// Author: Ricardo Martins                                                  *
 //***************************************************************************
 
 #ifndef DUNE_MATH_MULTI_MOVING_AVERAGE_HPP_INCLUDED_
@@ -39,6 +39,12 @@ namespace DUNE
 {
   namespace Math
   {
+    //! Several moving averages of different window sizes over the
+    //! same signal. Samples live in a circular buffer and each
+    //! window keeps a Kahan-compensated running sum, so an update is
+    //! O(1) per window with no buffer shifting; the per-window loops
+    //! run over contiguous arrays so the compiler can vectorize
+    //! them.
     template <typename T>
     class MultiMovingAverage
     {
@@ -48,14 +54,14 @@ namespace DUNE
       MultiMovingAverage(const std::vector<unsigned>& window_sizes):
         m_wsizes(window_sizes)
       {
-        m_accum.resize(m_wsizes.size());
-
         m_max_size = 0;
 
         for (unsigned i = 0; i < m_wsizes.size(); ++i)
           if (m_wsizes[i] > m_max_size)
             m_max_size = m_wsizes[i];
 
+        m_window.resize(m_max_size);
+
         clear();
       }
 
@@ -64,18 +70,21 @@ namespace DUNE
       clear(void)
       {
         m_accum.assign(m_wsizes.size(), (T)0.0);
-        m_window.clear();
+        m_accum_c.assign(m_wsizes.size(), (T)0.0);
+        m_head = 0;
+        m_size = 0;
       }
 
-      //! Insert new sample
+      //! Insert new sample without updating the accumulators.
       //! @param[in] value new sample
       void
       insertSample(const T& value)
       {
-        if (m_window.size() >= m_max_size)
-          m_window.pop_back();
+        m_window[m_head] = value;
+        m_head = (m_head + 1) % m_max_size;
 
-        m_window.insert(m_window.begin(), value);
+        if (m_size < m_max_size)
+          ++m_size;
       }
 
       //! Update sample with new value.
@@ -85,15 +94,26 @@ namespace DUNE
       {
         for (unsigned j = 0; j < m_wsizes.size(); ++j)
         {
-          m_accum[j] += value;
+          kahanAdd(m_accum[j], m_accum_c[j], value);
 
-          if (m_wsizes[j] <= m_window.size())
-            m_accum[j] -= m_window[m_wsizes[j] - 1];
+          if (m_wsizes[j] <= m_size)
+            kahanAdd(m_accum[j], m_accum_c[j],
+                     -m_window[(m_head + m_max_size - m_wsizes[j]) % m_max_size]);
         }
 
         insertSample(value);
       }
 
+      //! Update sample with a batch of consecutive values.
+      //! @param[in] values array of new values.
+      //! @param[in] count number of values.
+      void
+      update(const T* values, unsigned count)
+      {
+        for (unsigned i = 0; i < count; ++i)
+          update(values[i]);
+      }
+
       //! Extract mean value of a moving average.
       //! @param[in] j index of the moving average to be used
       //! @return mean value.
@@ -101,13 +121,13 @@ namespace DUNE
       mean(unsigned j)
       {
         if (j >= m_wsizes.size())
-          std::runtime_error("multi moving average: invalid index");
+          throw std::runtime_error("multi moving average: invalid index");
 
-        if (!m_window.size())
+        if (!m_size)
           return 0.0;
 
-        if (m_wsizes[j] > m_window.size())
-          return m_accum[j] / m_window.size();
+        if (m_wsizes[j] > m_size)
+          return m_accum[j] / m_size;
         else
           return m_accum[j] / m_wsizes[j];
       }
@@ -115,12 +135,31 @@ namespace DUNE
     private:
       //! Accumulator for each moving average.
       std::vector<T> m_accum;
-      //! Window.
+      //! Accumulator compensation terms.
+      std::vector<T> m_accum_c;
+      //! Circular sample buffer.
       std::vector<T> m_window;
       //! Window sizes for each moving average
       std::vector<unsigned> m_wsizes;
       //! Maximum size of window
       unsigned m_max_size;
+      //! Position of the next write in the circular buffer.
+      unsigned m_head;
+      //! Number of valid samples in the circular buffer.
+      unsigned m_size;
+
+      //! Add a value to a Kahan-compensated running sum.
+      //! @param[in,out] sum running sum.
+      //! @param[in,out] comp compensation term.
+      //! @param[in] value value to add.
+      static void
+      kahanAdd(T& sum, T& comp, const T& value)
+      {
+        T y = value - comp;
+        T t = sum + y;
+        comp = (t - sum) - y;
+        sum = t;
+      }
     };
   }
 }
@@ -128,16 +128,16 @@ namespace DUNE
 #endif
 
     double
-    QPSolver::solve(const Matrix& H, const Matrix& f, const Matrix& A, const Matrix& b, Matrix& x)
+    QPSolver::solve(const Matrix& H, const Matrix& f, const Matrix& A, const Matrix& b, Matrix& x, unsigned max_iter)
     {
       // Zero-size matrix and vector
       Matrix Aeq;
       Matrix beq;
-      return solve(H, f, Aeq, beq, A, b, x);
+      return solve(H, f, Aeq, beq, A, b, x, max_iter);
     }
 
     double
-    QPSolver::solve(const Matrix& H, const Matrix& f, const Matrix& Aeq, const Matrix& beq, const Matrix& A, const Matrix& b, Matrix& x)
+    QPSolver::solve(const Matrix& H, const Matrix& f, const Matrix& Aeq, const Matrix& beq, const Matrix& A, const Matrix& b, Matrix& x, unsigned max_iter)
     {
       // Validate parameter dimensions
       // n: number of vars
@@ -289,6 +289,11 @@ namespace DUNE
         iai(i) = i;
 
 l1:  iter++;
+      /* The dual iterate is not primal feasible until convergence, so
+         exceeding the budget cannot return a best-feasible point: the
+         caller must fall back (e.g. to the previous control). */
+      if (max_iter > 0 && (unsigned)iter > max_iter)
+        throw Error("iteration limit exceeded");
     #ifdef __QPDBG__
       print_vector("x", x);
     #endif
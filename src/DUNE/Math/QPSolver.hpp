@@ -58,15 +58,25 @@ namespace DUNE
       //!   0.5 x' H x + f' x
       //! subject to:
       //!   A x <= b
+      //!
+      //! When 'max_iter' is non-zero the solver throws Error after
+      //! that many active-set changes instead of iterating until
+      //! convergence, bounding the worst-case solve time for use in
+      //! control loops.
       static double
-      solve(const Matrix& H, const Matrix& f, const Matrix& A, const Matrix& b, Matrix& x);
+      solve(const Matrix& H, const Matrix& f, const Matrix& A, const Matrix& b, Matrix& x, unsigned max_iter = 0);
 
       //! Minimize
       //!   0.5 x' H x + f' x
       //! subject to:
       //!   A x <= b  and Aeq x = beq
+      //!
+      //! When 'max_iter' is non-zero the solver throws Error after
+      //! that many active-set changes instead of iterating until
+      //! convergence, bounding the worst-case solve time for use in
+      //! control loops.
       static double
-      solve(const Matrix& H, const Matrix& f, const Matrix& Aeq, const Matrix& beq, const Matrix& A, const Matrix& b, Matrix& x);
+      solve(const Matrix& H, const Matrix& f, const Matrix& Aeq, const Matrix& beq, const Matrix& A, const Matrix& b, Matrix& x, unsigned max_iter = 0);
     };
   }
 }
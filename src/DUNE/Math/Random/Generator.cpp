@@ -95,6 +95,44 @@ namespace DUNE
         return y * std::sqrt(-2.0 * std::log(r2) / r2);
       }
 
+      void
+      Generator::uniformFill(double* bfr, size_t count)
+      {
+        for (size_t i = 0; i < count; ++i)
+          bfr[i] = uniform();
+      }
+
+      void
+      Generator::gaussianFill(double* bfr, size_t count)
+      {
+        size_t i = 0;
+        while (i < count)
+        {
+          double x, y, r2;
+          do
+          {
+            x = -1 + 2 * uniform();
+            y = -1 + 2 * uniform();
+            r2 = x * x + y * y;
+          }
+          while (r2 > 1.0 || r2 == 0);
+
+          double f = std::sqrt(-2.0 * std::log(r2) / r2);
+
+          bfr[i++] = y * f;
+          if (i < count)
+            bfr[i++] = x * f;
+        }
+      }
+
+      void
+      Generator::gaussianFill(double mu, double sigma, double* bfr, size_t count)
+      {
+        gaussianFill(bfr, count);
+        for (size_t i = 0; i < count; ++i)
+          bfr[i] = mu + sigma * bfr[i];
+      }
+
       void
       Generator::ballU(double radius, double* x, double* y)
       {
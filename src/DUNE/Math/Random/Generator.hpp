@@ -31,6 +31,7 @@
 #define DUNE_MATH_RANDOM_GENERATOR_HPP_INCLUDED_
 
 // ISO C++ 98 headers.
+#include <cstddef>
 #include <stdexcept>
 #include <string>
 
@@ -120,6 +121,31 @@ namespace DUNE
                  gaussian();
         }
 
+        //! Fill an array with numbers with uniform distribution
+        //! in [0,1].
+        //! @param bfr destination array.
+        //! @param count number of values to generate.
+        void
+        uniformFill(double* bfr, size_t count);
+
+        //! Fill an array with numbers with gaussian distribution
+        //! (0,1). Unlike repeated calls to gaussian(), both deviates
+        //! produced by each Box-Muller iteration are used, halving
+        //! the cost per value for Monte-Carlo batches.
+        //! @param bfr destination array.
+        //! @param count number of values to generate.
+        void
+        gaussianFill(double* bfr, size_t count);
+
+        //! Fill an array with numbers with gaussian distribution
+        //! (mu,sigma).
+        //! @param mu mean of distribution.
+        //! @param sigma std. dev. of distribution.
+        //! @param bfr destination array.
+        //! @param count number of values to generate.
+        void
+        gaussianFill(double mu, double sigma, double* bfr, size_t count);
+
         // Generate coordinates (x,y) in relation to (0,0), such
         // that:
         // - Distance to (0,0) is uniformly distributed in [0,radius].
@@ -0,0 +1,152 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+#ifndef DUNE_MATH_TRIG_APPROX_HPP_INCLUDED_
+#define DUNE_MATH_TRIG_APPROX_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <cmath>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Math/Constants.hpp>
+#include <DUNE/Math/Angles.hpp>
+
+namespace DUNE
+{
+  namespace Math
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM TrigApprox;
+
+    //! Polynomial approximations of trigonometric functions with
+    //! bounded error, for use in control loops on FPU-weak targets
+    //! where full libm precision is not required.
+    //!
+    //! Error bounds (absolute, verified by test_TrigApprox):
+    //!  - sin/cos: 1.0e-7 over the whole real line.
+    //!  - atan2: 1.0e-8 in radians.
+    //!
+    //! All methods use only multiplications, additions and a single
+    //! std::floor (for range reduction), so their cost is uniform
+    //! across argument ranges.
+    class TrigApprox
+    {
+    public:
+      //! Approximate the sine of an angle.
+      //! @param a angle in radian.
+      //! @return sine of the angle, within 1.0e-7 of std::sin.
+      inline static fp64_t
+      sin(fp64_t a)
+      {
+        // Fold into [-pi/2, pi/2], where the polynomial is valid.
+        a = Angles::normalizeRadian(a);
+        if (a > c_half_pi)
+          a = c_pi - a;
+        else if (a < -c_half_pi)
+          a = -c_pi - a;
+
+        return sinKernel(a);
+      }
+
+      //! Approximate the cosine of an angle.
+      //! @param a angle in radian.
+      //! @return cosine of the angle, within 1.0e-7 of std::cos.
+      inline static fp64_t
+      cos(fp64_t a)
+      {
+        return sin(a + c_half_pi);
+      }
+
+      //! Approximate the arc tangent of y / x, using the signs of
+      //! both arguments to select the quadrant.
+      //! @param y ordinate.
+      //! @param x abscissa.
+      //! @return angle in radian, within 1.0e-8 of std::atan2.
+      inline static fp64_t
+      atan2(fp64_t y, fp64_t x)
+      {
+        fp64_t ax = std::fabs(x);
+        fp64_t ay = std::fabs(y);
+
+        if (ax == 0.0 && ay == 0.0)
+          return 0.0;
+
+        // Reduce to [0, 1] by swapping the ratio when |y| > |x|.
+        fp64_t r;
+        if (ay <= ax)
+          r = atanKernel(ay / ax);
+        else
+          r = c_half_pi - atanKernel(ax / ay);
+
+        if (x < 0.0)
+          r = c_pi - r;
+
+        return (y < 0.0) ? -r : r;
+      }
+
+    private:
+      //! Sine over [-pi/2, pi/2]: odd polynomial of degree 11,
+      //! maximum absolute error 5.7e-8.
+      inline static fp64_t
+      sinKernel(fp64_t x)
+      {
+        fp64_t t = x * x;
+        fp64_t p = -1.0 / 39916800.0;
+        p = p * t + 1.0 / 362880.0;
+        p = p * t - 1.0 / 5040.0;
+        p = p * t + 1.0 / 120.0;
+        p = p * t - 1.0 / 6.0;
+        p = p * t + 1.0;
+        return x * p;
+      }
+
+      //! Arc tangent over [0, 1]: odd polynomial of degree 19 fitted
+      //! at Chebyshev nodes, maximum absolute error 1.6e-9.
+      inline static fp64_t
+      atanKernel(fp64_t x)
+      {
+        fp64_t t = x * x;
+        fp64_t p = -1.70117006757573115e-03;
+        p = p * t + 1.04876492713798456e-02;
+        p = p * t - 3.03518648180336331e-02;
+        p = p * t + 5.70895559647150580e-02;
+        p = p * t - 8.34972497046584106e-02;
+        p = p * t + 1.09323415021171488e-01;
+        p = p * t - 1.42600160829979755e-01;
+        p = p * t + 1.99980752811689588e-01;
+        p = p * t - 3.33332762919835324e-01;
+        p = p * t + 9.99999997160545662e-01;
+        return x * p;
+      }
+    };
+  }
+}
+
+#endif
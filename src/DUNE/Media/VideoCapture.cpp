@@ -78,6 +78,11 @@ namespace DUNE
   namespace Media
   {
 #if defined(DUNE_SYS_HAS_LIBV4L2_H)
+    //! Number of memory-mapped ring buffers. One buffer is held by
+    //! the consumer between captures, the driver fills the others, so
+    //! a slow consumer cycle does not immediately drop frames.
+    static const unsigned c_bfr_count = 4;
+
     static int
     testIoctl(int fh, unsigned request, void* arg)
     {
@@ -125,7 +130,7 @@ namespace DUNE
       // Initialize V4L2 request buffers.
       m_bfr_req = new v4l2_requestbuffers;
       std::memset(m_bfr_req, 0, sizeof(v4l2_requestbuffers));
-      m_bfr_req->count = 2;
+      m_bfr_req->count = c_bfr_count;
       m_bfr_req->type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
       m_bfr_req->memory = V4L2_MEMORY_MMAP;
       doIoctl(m_fd, VIDIOC_REQBUFS, m_bfr_req);
@@ -256,7 +261,7 @@ namespace DUNE
         tv.tv_usec = 0;
         rv = select(m_fd + 1, &fds, NULL, NULL, &tv);
       }
-      while ((rv == -1 && (errno = EINTR)));
+      while (rv == -1 && errno == EINTR);
 
       doIoctl(m_fd, VIDIOC_QBUF, m_bfr);
       std::memset(m_bfr, 0, sizeof(v4l2_buffer));
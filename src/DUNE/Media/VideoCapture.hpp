@@ -73,6 +73,9 @@ namespace DUNE
       void
       setStandard(Standard standard);
 
+      //! Return the held buffer to the driver and dequeue the next
+      //! frame. Pointers obtained with frameData() are invalidated.
+      //! @return true if a frame was captured.
       bool
       frameCapture(void);
 
@@ -82,6 +85,10 @@ namespace DUNE
       uint32_t
       frameHeight(void) const;
 
+      //! Retrieve a pointer into the memory-mapped buffer of the last
+      //! captured frame; no copy is made. The buffer stays checked out
+      //! to the caller until the next frameCapture() call.
+      //! @return frame data.
       uint8_t*
       frameData(void) const;
 
@@ -30,35 +30,15 @@
 #ifndef DUNE_MEMORY_HPP_INCLUDED_
 #define DUNE_MEMORY_HPP_INCLUDED_
 
-// ISO C++ 98 headers.
-#include <cstddef>
-
 namespace DUNE
 {
-  class Memory
-  {
-  public:
-    template <typename T>
-    static inline void
-    clear(T& var)
-    {
-      if (var != NULL)
-      {
-        delete var;
-        var = NULL;
-      }
-    }
-
-    template <typename T>
-    static inline void
-    replace(T& var, T rep)
-    {
-      if (var != NULL)
-        delete var;
-
-      var = rep;
-    }
-  };
+  //! Memory management routines and allocators.
+  namespace Memory
+  { }
 }
 
+#include <DUNE/Memory/Utils.hpp>
+#include <DUNE/Memory/Arena.hpp>
+#include <DUNE/Memory/BlockPool.hpp>
+
 #endif
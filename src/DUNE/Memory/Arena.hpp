@@ -0,0 +1,220 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+#ifndef DUNE_MEMORY_ARENA_HPP_INCLUDED_
+#define DUNE_MEMORY_ARENA_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <cstddef>
+#include <cstring>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+
+namespace DUNE
+{
+  namespace Memory
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM Arena;
+
+    //! Bump allocator over a chain of fixed-size blocks.
+    //!
+    //! Allocations advance a cursor and are never freed one by one:
+    //! the cursor is rewound to a previously taken mark (or to the
+    //! start), releasing everything allocated after it at once.
+    //! Blocks are kept across rewinds, so a warmed-up arena serves a
+    //! steady workload without touching the heap.
+    //!
+    //! Intended for per-cycle scratch storage of trivially
+    //! destructible data: rewinding runs no destructors.
+    //!
+    //! When DUNE_MEMORY_POISON is defined, rewound storage is filled
+    //! with 0xDE so use-after-rewind bugs surface as garbage data.
+    class Arena
+    {
+    public:
+      //! Cursor position, as returned by mark().
+      struct Mark
+      {
+        //! Index of the active block.
+        unsigned block;
+        //! Offset within the active block.
+        size_t offset;
+      };
+
+      //! Rewinds the arena on destruction to the position held when
+      //! the scope was created.
+      class Scope
+      {
+      public:
+        Scope(Arena& arena):
+          m_arena(arena),
+          m_mark(arena.mark())
+        { }
+
+        ~Scope(void)
+        {
+          m_arena.rewind(m_mark);
+        }
+
+      private:
+        //! Associated arena.
+        Arena& m_arena;
+        //! Position at scope creation.
+        Mark m_mark;
+
+        // Non-copyable.
+        Scope(const Scope&);
+        Scope& operator=(const Scope&);
+      };
+
+      //! Constructor.
+      //! @param[in] block_size size of each block in bytes.
+      Arena(size_t block_size = c_default_block_size):
+        m_block_size(block_size)
+      {
+        m_mark.block = 0;
+        m_mark.offset = 0;
+      }
+
+      //! Destructor.
+      ~Arena(void)
+      {
+        for (unsigned i = 0; i < m_blocks.size(); ++i)
+          delete [] m_blocks[i].data;
+      }
+
+      //! Allocate storage. Never returns NULL: a new block is
+      //! chained when the current one is exhausted.
+      //! @param[in] size requested size in bytes.
+      //! @return pointer to storage, aligned like a double.
+      void*
+      allocate(size_t size)
+      {
+        size = (size + c_align - 1) & ~(c_align - 1);
+
+        while (m_mark.block < m_blocks.size())
+        {
+          Block& blk = m_blocks[m_mark.block];
+          if (m_mark.offset + size <= blk.capacity)
+          {
+            void* ptr = blk.data + m_mark.offset;
+            m_mark.offset += size;
+            return ptr;
+          }
+
+          ++m_mark.block;
+          m_mark.offset = 0;
+        }
+
+        Block blk;
+        blk.capacity = (size > m_block_size) ? size : m_block_size;
+        blk.data = new uint8_t[blk.capacity];
+        m_blocks.push_back(blk);
+
+        m_mark.offset = size;
+        return blk.data;
+      }
+
+      //! Retrieve the current cursor position.
+      //! @return cursor position.
+      Mark
+      mark(void) const
+      {
+        return m_mark;
+      }
+
+      //! Release everything allocated after a mark.
+      //! @param[in] mrk position to rewind to.
+      void
+      rewind(const Mark& mrk)
+      {
+#if defined(DUNE_MEMORY_POISON)
+        for (unsigned i = mrk.block; i < m_blocks.size() && i <= m_mark.block; ++i)
+        {
+          size_t from = (i == mrk.block) ? mrk.offset : 0;
+          std::memset(m_blocks[i].data + from, 0xDE, m_blocks[i].capacity - from);
+        }
+#endif
+        m_mark = mrk;
+      }
+
+      //! Release all allocations, keeping the blocks for reuse.
+      void
+      clear(void)
+      {
+        Mark start;
+        start.block = 0;
+        start.offset = 0;
+        rewind(start);
+      }
+
+      //! Retrieve the total capacity of the chained blocks.
+      //! @return capacity in bytes.
+      size_t
+      getCapacity(void) const
+      {
+        size_t total = 0;
+        for (unsigned i = 0; i < m_blocks.size(); ++i)
+          total += m_blocks[i].capacity;
+        return total;
+      }
+
+    private:
+      //! Default block size in bytes.
+      static const size_t c_default_block_size = 16 * 1024;
+      //! Allocation alignment in bytes.
+      static const size_t c_align = sizeof(double);
+
+      //! One chained block.
+      struct Block
+      {
+        //! Storage.
+        uint8_t* data;
+        //! Storage size in bytes.
+        size_t capacity;
+      };
+
+      //! Chained blocks.
+      std::vector<Block> m_blocks;
+      //! Size of regular blocks in bytes.
+      size_t m_block_size;
+      //! Cursor position.
+      Mark m_mark;
+
+      // Non-copyable.
+      Arena(const Arena&);
+      Arena& operator=(const Arena&);
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,141 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstring>
+#include <new>
+
+// DUNE headers.
+#include <DUNE/Concurrency/ScopedMutex.hpp>
+#include <DUNE/Memory/BlockPool.hpp>
+
+namespace DUNE
+{
+  namespace Memory
+  {
+    //! Block header, prepended to every allocation. The union keeps
+    //! the user area as aligned as the global operator new would.
+    union BlockHeader
+    {
+      //! Size class of the block.
+      unsigned size_class;
+      //! Alignment enforcement.
+      double align_d;
+      //! Alignment enforcement.
+      void* align_p;
+    };
+
+    BlockPool::BlockPool(const size_t* sizes, unsigned count, unsigned max_cached):
+      m_sizes(sizes, sizes + count),
+      m_free_lists(count, (FreeBlock*)NULL),
+      m_free_count(count, 0),
+      m_max_cached(max_cached)
+    { }
+
+    BlockPool::~BlockPool(void)
+    {
+      clear();
+    }
+
+    void*
+    BlockPool::allocate(size_t size)
+    {
+      for (unsigned i = 0; i < m_sizes.size(); ++i)
+      {
+        if (size > m_sizes[i])
+          continue;
+
+        {
+          Concurrency::ScopedMutex l(m_lock);
+          FreeBlock* blk = m_free_lists[i];
+          if (blk != NULL)
+          {
+            m_free_lists[i] = blk->next;
+            --m_free_count[i];
+            return blk;
+          }
+        }
+
+        // Carve a fresh block for this size class.
+        BlockHeader* hdr = static_cast<BlockHeader*>(::operator new(sizeof(BlockHeader) + m_sizes[i]));
+        hdr->size_class = i;
+        return hdr + 1;
+      }
+
+      // Request is larger than the biggest size class.
+      BlockHeader* hdr = static_cast<BlockHeader*>(::operator new(sizeof(BlockHeader) + size));
+      hdr->size_class = c_class_heap;
+      return hdr + 1;
+    }
+
+    void
+    BlockPool::deallocate(void* ptr)
+    {
+      if (ptr == NULL)
+        return;
+
+      BlockHeader* hdr = static_cast<BlockHeader*>(ptr) - 1;
+      unsigned i = hdr->size_class;
+
+      if (i < m_sizes.size())
+      {
+#if defined(DUNE_MEMORY_POISON)
+        std::memset(ptr, 0xDE, m_sizes[i]);
+#endif
+        Concurrency::ScopedMutex l(m_lock);
+        if (m_free_count[i] < m_max_cached)
+        {
+          FreeBlock* blk = static_cast<FreeBlock*>(ptr);
+          blk->next = m_free_lists[i];
+          m_free_lists[i] = blk;
+          ++m_free_count[i];
+          return;
+        }
+      }
+
+      ::operator delete(hdr);
+    }
+
+    void
+    BlockPool::clear(void)
+    {
+      Concurrency::ScopedMutex l(m_lock);
+      for (unsigned i = 0; i < m_free_lists.size(); ++i)
+      {
+        while (m_free_lists[i] != NULL)
+        {
+          FreeBlock* blk = m_free_lists[i];
+          m_free_lists[i] = blk->next;
+          ::operator delete(static_cast<BlockHeader*>((void*)blk) - 1);
+        }
+        m_free_count[i] = 0;
+      }
+    }
+  }
+}
@@ -0,0 +1,115 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+#ifndef DUNE_MEMORY_BLOCK_POOL_HPP_INCLUDED_
+#define DUNE_MEMORY_BLOCK_POOL_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <cstddef>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Concurrency/Mutex.hpp>
+
+namespace DUNE
+{
+  namespace Memory
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM BlockPool;
+
+    //! Thread-safe pool of fixed-size memory blocks.
+    //!
+    //! Freed blocks are kept in size-segregated free lists and
+    //! recycled on subsequent allocations, bypassing the general
+    //! purpose heap. Requests larger than the biggest size class,
+    //! and blocks freed while their free list is full, fall back to
+    //! the global operator new/delete. A pool with a single size
+    //! class is a plain fixed-size object pool.
+    //!
+    //! When DUNE_MEMORY_POISON is defined, blocks are filled with
+    //! 0xDE when they enter a free list so use-after-free bugs
+    //! surface as garbage data.
+    class BlockPool
+    {
+    public:
+      //! Constructor.
+      //! @param[in] sizes size classes in bytes, ascending order.
+      //! @param[in] count number of size classes.
+      //! @param[in] max_cached maximum free blocks kept per class.
+      BlockPool(const size_t* sizes, unsigned count, unsigned max_cached);
+
+      //! Destructor: releases all cached blocks.
+      ~BlockPool(void);
+
+      //! Allocate a block with at least the requested size.
+      //! @param[in] size requested size in bytes.
+      //! @return pointer to usable memory.
+      void*
+      allocate(size_t size);
+
+      //! Return a block previously obtained with allocate().
+      //! @param[in] ptr pointer to memory (may be NULL).
+      void
+      deallocate(void* ptr);
+
+      //! Release all cached blocks to the heap.
+      void
+      clear(void);
+
+    private:
+      //! Size class marker of blocks served by the global heap.
+      static const unsigned c_class_heap = 0xffffffff;
+
+      //! Link node overlaid on the user area of cached blocks.
+      struct FreeBlock
+      {
+        FreeBlock* next;
+      };
+
+      //! Size classes in bytes.
+      std::vector<size_t> m_sizes;
+      //! Free lists, one per size class.
+      std::vector<FreeBlock*> m_free_lists;
+      //! Number of cached blocks per size class.
+      std::vector<unsigned> m_free_count;
+      //! Maximum free blocks kept per class.
+      unsigned m_max_cached;
+      //! Pool lock.
+      Concurrency::Mutex m_lock;
+
+      // Non-copyable.
+      BlockPool(const BlockPool&);
+      BlockPool& operator=(const BlockPool&);
+    };
+  }
+}
+
+#endif
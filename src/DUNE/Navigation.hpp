@@ -41,7 +41,10 @@ namespace DUNE
 #include <DUNE/Navigation/BeamFilter.hpp>
 #include <DUNE/Navigation/CompassCalibration.hpp>
 #include <DUNE/Navigation/KalmanFilter.hpp>
+#include <DUNE/Navigation/KalmanFilterN.hpp>
 #include <DUNE/Navigation/Ranging.hpp>
+#include <DUNE/Navigation/SoundSpeedProfile.hpp>
+#include <DUNE/Navigation/StateHistory.hpp>
 #include <DUNE/Navigation/StreamEstimator.hpp>
 #include <DUNE/Navigation/UsblTools.hpp>
 
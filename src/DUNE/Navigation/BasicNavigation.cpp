@@ -78,7 +78,7 @@ namespace DUNE
       param("GPS timeout", m_without_gps_timeout)
       .units(Units::Second)
       .defaultValue("3.0")
-      .minimumValue("2.0")
+      .minimumValue("1.0")
       .description("No GPS readings timeout");
 
       param("DVL timeout", m_without_dvl_timeout)
@@ -571,9 +571,9 @@ namespace DUNE
       // Not sure about altitude.
       double x = 0.0;
       double y = 0.0;
-      Coordinates::WGS84::displacement(m_origin->lat, m_origin->lon, m_origin->height,
-                                       msg->lat, msg->lon, msg->height,
-                                       &x, &y, &m_last_z);
+      m_ltp.displacement(m_origin->lat, m_origin->lon, m_origin->height,
+                         msg->lat, msg->lon, msg->height,
+                         &x, &y, &m_last_z);
 
       // Stream Estimator.
       IMC::EstimatedStreamVelocity stream;
@@ -758,9 +758,9 @@ namespace DUNE
 
       double x = 0.0;
       double y = 0.0;
-      Coordinates::WGS84::displacement(m_origin->lat, m_origin->lon, 0.0,
-                                       msg->lat, msg->lon, 0.0,
-                                       &x, &y);
+      m_ltp.displacement(m_origin->lat, m_origin->lon, 0.0,
+                         msg->lat, msg->lon, 0.0,
+                         &x, &y);
 
       runKalmanUSBL(x, y);
     }
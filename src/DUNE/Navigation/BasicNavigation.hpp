@@ -631,6 +631,8 @@ namespace DUNE
       IMC::WaterVelocity m_wvel_previous;
       //! Navigation Startup point.
       IMC::GpsFix* m_origin;
+      //! Local tangent plane cache for the LLH origin.
+      Coordinates::WGS84::CachedOrigin m_ltp;
       //! Displacement between LBL and GPS.
       float m_dist_lbl_gps;
       //! Always reject LblRanges.
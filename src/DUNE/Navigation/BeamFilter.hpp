@@ -31,10 +31,12 @@
 #define DUNE_NAVIGATION_BEAM_FILTER_HPP_INCLUDED_
 
 // ISO C++ 98 headers.
+#include <algorithm>
 #include <cmath>
 #include <vector>
 
 // DUNE headers.
+#include <DUNE/Math/General.hpp>
 #include <DUNE/Math/Matrix.hpp>
 #include <DUNE/IMC/Definitions.hpp>
 
@@ -52,6 +54,14 @@ namespace DUNE
     static const unsigned c_dvl_beams = 4;
     //! Minimum number of valid beams required.
     static const unsigned c_min_valid = 3;
+    //! Median absolute deviation consistency scale for normal data.
+    static const float c_mad_scale = 1.4826f;
+    //! Outlier rejection threshold in scaled MADs.
+    static const float c_mad_k = 3.0f;
+    //! Minimum absolute deviation threshold (m).
+    static const float c_dev_min = 0.25f;
+    //! Minimum history samples before rejecting outliers.
+    static const unsigned c_min_hist = 3;
 
     //! %BeamFilter is responsible to gather beam
     //! distance values from a DVL unit and compute
@@ -72,7 +82,10 @@ namespace DUNE
       //! @param[in] task pointer to parent task.
       BeamFilter(Tasks::Task* task):
         m_task(task),
-        m_info(false)
+        m_info(false),
+        m_window(0),
+        m_hist_next(0),
+        m_hist_count(0)
       {
         m_size = c_dvl_beams;
         clear();
@@ -83,7 +96,10 @@ namespace DUNE
       //! @param[in] size number of device beams.
       BeamFilter(Tasks::Task* task, size_t size):
         m_task(task),
-        m_info(false)
+        m_info(false),
+        m_window(0),
+        m_hist_next(0),
+        m_hist_count(0)
       {
         m_size = size;
         clear();
@@ -101,7 +117,10 @@ namespace DUNE
       BeamFilter(Tasks::Task* task, size_t size, float width, float offset, float off_ang,
                  std::vector<float>& pos, std::vector<float>& ang, Spacing type):
         m_task(task),
-        m_info(true)
+        m_info(true),
+        m_window(0),
+        m_hist_next(0),
+        m_hist_count(0)
       {
         m_size = size;
         m_width = width;
@@ -134,6 +153,23 @@ namespace DUNE
         m_list[index].value = value;
       }
 
+      //! Enable median/MAD outlier rejection of the fused distance
+      //! over a sliding window of past outputs. Replaces the simple
+      //! previous-value dropout heuristic and keeps constant-size
+      //! ring-buffer state.
+      //! @param[in] window number of past samples (0 disables).
+      void
+      setOutlierRejection(size_t window)
+      {
+        m_window = window;
+        m_hist.assign(m_window, 0.0f);
+        m_sorted.clear();
+        m_sorted.reserve(m_window);
+        m_dev.assign(m_window, 0.0f);
+        m_hist_next = 0;
+        m_hist_count = 0;
+      }
+
       //! Get distance using current beam data.
       //! @return distance.
       float
@@ -156,6 +192,9 @@ namespace DUNE
 
         dist /= valid;
 
+        if (m_window > 0)
+          return filterOutlier(dist);
+
         if (dist < c_max)
         {
           if (m_prev > c_min)
@@ -228,6 +267,54 @@ namespace DUNE
       }
 
     private:
+      //! Validate a fused distance against the median/MAD of the
+      //! history window and insert it when consistent.
+      //! @param[in] dist fused distance.
+      //! @return distance, or -1 if rejected as a glitch.
+      float
+      filterOutlier(float dist)
+      {
+        if (m_hist_count >= c_min_hist)
+        {
+          float med = Math::medianOrdered(&m_sorted[0], (uint16_t)m_hist_count);
+
+          for (unsigned i = 0; i < m_hist_count; ++i)
+            m_dev[i] = std::fabs(m_sorted[i] - med);
+
+          Math::insertionSort(&m_dev[0], (uint16_t)m_hist_count);
+          float mad = Math::medianOrdered(&m_dev[0], (uint16_t)m_hist_count);
+          float thresh = std::max(c_mad_k * c_mad_scale * mad, c_dev_min);
+
+          if (std::fabs(dist - med) > thresh)
+            return -1;
+        }
+
+        pushHistory(dist);
+        return dist;
+      }
+
+      //! Insert a fused distance into the ring buffer, keeping the
+      //! sorted view consistent.
+      //! @param[in] dist fused distance.
+      void
+      pushHistory(float dist)
+      {
+        if (m_hist_count == m_window)
+        {
+          std::vector<float>::iterator itr;
+          itr = std::lower_bound(m_sorted.begin(), m_sorted.end(), m_hist[m_hist_next]);
+          m_sorted.erase(itr);
+        }
+        else
+        {
+          ++m_hist_count;
+        }
+
+        m_hist[m_hist_next] = dist;
+        m_hist_next = (m_hist_next + 1) % m_window;
+        m_sorted.insert(std::upper_bound(m_sorted.begin(), m_sorted.end(), dist), dist);
+      }
+
       //! Clear data.
       void
       clear(void)
@@ -317,6 +404,18 @@ namespace DUNE
       float m_prev;
       //! Beam spacing disposition.
       Spacing m_type;
+      //! Outlier rejection window size (0 = disabled).
+      size_t m_window;
+      //! Ring buffer of past fused distances.
+      std::vector<float> m_hist;
+      //! Next ring buffer write position.
+      size_t m_hist_next;
+      //! Number of samples in the ring buffer.
+      size_t m_hist_count;
+      //! Sorted view of the ring buffer contents.
+      std::vector<float> m_sorted;
+      //! Deviation scratch buffer.
+      std::vector<float> m_dev;
     };
   }
 }
@@ -47,6 +47,12 @@ namespace DUNE
     //! to gather data from compass in order
     //! to compute hard-iron calibration parameters.
     //!
+    //! State is held in fixed-size arrays and the roll/pitch rotation
+    //! is cached when the attitude arrives, so ingesting a magnetic
+    //! field sample costs a handful of multiplications and no heap
+    //! allocations. This allows feeding the full rate AHRS stream
+    //! during the calibration maneuver.
+    //!
     //! @author José Braga
     class CompassCalibration
     {
@@ -61,9 +67,14 @@ namespace DUNE
       void
       clear(void)
       {
-        m_dcm.resizeAndFill(3, 1, 0.0);
-        m_max.resizeAndFill(1, 3, -std::numeric_limits<double>::max());
-        m_min.resizeAndFill(1, 3, std::numeric_limits<double>::max());
+        for (unsigned i = 0; i < 3; i++)
+        {
+          for (unsigned j = 0; j < 3; j++)
+            m_dcm[i][j] = (i == j) ? 1.0 : 0.0;
+
+          m_max[i] = -std::numeric_limits<double>::max();
+          m_min[i] = std::numeric_limits<double>::max();
+        }
       }
 
       //! Update Direct Cosine Matrix.
@@ -71,8 +82,21 @@ namespace DUNE
       void
       updateDCM(const IMC::EulerAngles& msg)
       {
-        m_dcm(0) = msg.phi;
-        m_dcm(1) = msg.theta;
+        double cr = std::cos(msg.phi);
+        double sr = std::sin(msg.phi);
+        double cp = std::cos(msg.theta);
+        double sp = std::sin(msg.theta);
+
+        // Roll/pitch DCM (yaw zero), laid out as in Matrix::toDCM.
+        m_dcm[0][0] = cp;
+        m_dcm[0][1] = sr * sp;
+        m_dcm[0][2] = cr * sp;
+        m_dcm[1][0] = 0.0;
+        m_dcm[1][1] = cr;
+        m_dcm[1][2] = -sr;
+        m_dcm[2][0] = -sp;
+        m_dcm[2][1] = sr * cp;
+        m_dcm[2][2] = cr * cp;
       }
 
       //! Get stabilized magnetic field.
@@ -80,22 +104,17 @@ namespace DUNE
       void
       updateField(const IMC::MagneticField& msg)
       {
-        // Insert magnetic field into row matrix.
-        Math::Matrix mf(1,3);
-        mf(0) = msg.x;
-        mf(1) = msg.y;
-        mf(2) = msg.z;
-
-        // Get stabilized magnetic field.
-        Math::Matrix mf_stab = mf * transpose(m_dcm.toDCM());
+        double mf[3] = {msg.x, msg.y, msg.z};
 
-        // Store maximum and minimum values.
+        // Store maximum and minimum values of the stabilized field.
         for (unsigned i = 0; i < 3; i++)
         {
-          if (mf_stab(i) > m_max(i))
-            m_max(i) = mf_stab(i);
-          if (mf_stab(i) < m_min(i))
-            m_min(i) = mf_stab(i);
+          double stab = m_dcm[i][0] * mf[0] + m_dcm[i][1] * mf[1] + m_dcm[i][2] * mf[2];
+
+          if (stab > m_max[i])
+            m_max[i] = stab;
+          if (stab < m_min[i])
+            m_min[i] = stab;
         }
       }
 
@@ -105,7 +124,9 @@ namespace DUNE
       getCalibrationParams(void)
       {
         // Compute calibration parameters.
-        Math::Matrix params = (m_max + m_min) / 2;
+        Math::Matrix params(1, 3);
+        for (unsigned i = 0; i < 3; i++)
+          params(i) = (m_max[i] + m_min[i]) / 2;
 
         // Clear all data and return.
         clear();
@@ -113,12 +134,12 @@ namespace DUNE
       }
 
     private:
-      //! Direct cosine matrix.
-      Math::Matrix m_dcm;
+      //! Roll/pitch direct cosine matrix.
+      double m_dcm[3][3];
       //! Maximum values of stabilized magnetic field.
-      Math::Matrix m_max;
+      double m_max[3];
       //! Minimum values of stabilized magnetic field.
-      Math::Matrix m_min;
+      double m_min[3];
     };
   }
 }
@@ -35,7 +35,10 @@ namespace DUNE
 {
   namespace Navigation
   {
-    KalmanFilter::KalmanFilter(void)
+    KalmanFilter::KalmanFilter(void):
+      m_sequential(false),
+      m_snaps_head(0),
+      m_snaps_size(0)
     {
       m_state_count = 1;
       Math::Matrix I(1);
@@ -43,7 +46,10 @@ namespace DUNE
       m_x = m_y = m_ax = m_ap = m_c = m_p = m_q = m_r = m_innov = I;
     }
 
-    KalmanFilter::KalmanFilter(Math::Matrix& A, Math::Matrix& C, Math::Matrix& P, Math::Matrix& Q)
+    KalmanFilter::KalmanFilter(Math::Matrix& A, Math::Matrix& C, Math::Matrix& P, Math::Matrix& Q):
+      m_sequential(false),
+      m_snaps_head(0),
+      m_snaps_size(0)
     {
       m_ax = A;
       m_ap = A;
@@ -70,6 +76,26 @@ namespace DUNE
 
       m_ax.identity();
       m_ap.identity();
+
+      // The block partition of the old state dimension is meaningless.
+      m_blocks.clear();
+
+      // Snapshots of the old state dimension are meaningless.
+      m_snaps_head = 0;
+      m_snaps_size = 0;
+    }
+
+    void
+    KalmanFilter::setBlockStructure(const std::vector<size_t>& blocks)
+    {
+      size_t sum = 0;
+      for (size_t b = 0; b < blocks.size(); ++b)
+        sum += blocks[b];
+
+      if (!blocks.empty() && sum != m_state_count)
+        throw std::runtime_error(DTR("invalid dimensions"));
+
+      m_blocks = blocks;
     }
 
     bool
@@ -114,14 +140,121 @@ namespace DUNE
         throw std::runtime_error(DTR("invalid dimensions"));
 
       m_x = m_ax * m_x + b * u;
-      m_p = m_ap * m_p * transpose(m_ap) + m_q;
+      propagateCovariance();
+
+      snapshot();
     }
 
     void
     KalmanFilter::predict(void)
     {
       m_x = m_ax * m_x;
-      m_p = m_ap * m_p * transpose(m_ap) + m_q;
+      propagateCovariance();
+
+      snapshot();
+    }
+
+    void
+    KalmanFilter::propagateCovariance(void)
+    {
+      if (m_blocks.empty())
+      {
+        m_p = m_ap * m_p * transpose(m_ap) + m_q;
+        return;
+      }
+
+      // Zero blocks of the covariance transition contribute nothing
+      // to A * P * A': skip them on both sides of the product.
+      Math::Matrix::multiplyBlocks(m_ap, m_p, m_ap_p, m_blocks);
+      Math::Matrix::multiplyByTransposeBlocks(m_ap_p, m_ap, m_p, m_blocks);
+      m_p += m_q;
+    }
+
+    void
+    KalmanFilter::setDelayedFusion(unsigned depth)
+    {
+      m_snaps.clear();
+      m_snaps.resize(depth);
+      m_snaps_head = 0;
+      m_snaps_size = 0;
+    }
+
+    void
+    KalmanFilter::snapshot(void)
+    {
+      if (m_snaps.empty())
+        return;
+
+      Snapshot& snap = m_snaps[m_snaps_head];
+      snap.x = m_x;
+      snap.p = m_p;
+      snap.ax = m_ax;
+      m_snaps_head = (m_snaps_head + 1) % m_snaps.size();
+
+      if (m_snaps_size < m_snaps.size())
+        ++m_snaps_size;
+    }
+
+    int
+    KalmanFilter::updateDelayed(const Math::Matrix& c, const Math::Matrix& z,
+                                const Math::Matrix& r, unsigned delay, float threshold)
+    {
+      if (delay >= m_snaps_size)
+        return -1;
+
+      if ((size_t)c.columns() != m_state_count || c.rows() != z.rows())
+        throw std::runtime_error(DTR("invalid dimensions"));
+
+      if (r.rows() != r.columns() || r.rows() != z.rows())
+        throw std::runtime_error(DTR("invalid dimensions"));
+
+      const Snapshot& snap = getSnapshot(delay);
+
+      // Innovation against the state at the measurement epoch.
+      Math::Matrix innov = z - c * snap.x;
+
+      // Measurement prediction covariance at the measurement epoch.
+      Math::Matrix S = (c * snap.p * transpose(c)) + r;
+      Math::Matrix S_1;
+
+      try
+      {
+        S_1 = inverse(S);
+      }
+      catch (...)
+      {
+        throw std::runtime_error(DTR("matrix inversion error"));
+      }
+
+      // Check if innovation is above a threshold value.
+      // Set threshold to 0 to accept everything.
+      if (threshold != 0)
+      {
+        double level = (transpose(innov) * S_1 * innov)(0);
+
+        if (level >= threshold)
+          return -1;
+      }
+
+      // Accumulated state transition from the measurement epoch to
+      // the present. Intermediate updates are neglected (Larsen's
+      // extrapolation), which slightly overweighs old measurements.
+      Math::Matrix T(m_state_count, m_state_count);
+      T.identity();
+      for (unsigned i = 0; i < delay; ++i)
+        T = T * getSnapshot(i).ax;
+
+      // Delayed Kalman gain.
+      Math::Matrix K = T * snap.p * transpose(c) * S_1;
+
+      // State update.
+      m_x = m_x + K * innov;
+
+      // State covariance update, in symmetric form to keep the
+      // matrix positive semi-definite.
+      m_p = m_p - K * S * transpose(K);
+
+      return 0;
     }
 
     int
@@ -139,6 +272,9 @@ namespace DUNE
       if (m_r.rows() != m_r.columns() || m_r.rows() != m_innov.rows())
         throw std::runtime_error(DTR("invalid dimensions"));
 
+      if (m_sequential)
+        return updateSequential(threshold);
+
       // Measurement prediction covariance.
       Math::Matrix S = (m_c * m_p * transpose(m_c)) + m_r;
       Math::Matrix S_1;
@@ -175,6 +311,57 @@ namespace DUNE
       return 0;
     }
 
+    int
+    KalmanFilter::updateSequential(float threshold)
+    {
+      // State at entry, to correct pending innovations as earlier
+      // measurements shift the estimate.
+      Math::Matrix x0 = m_x;
+      Math::Matrix row;
+      Math::Matrix cp;
+      Math::Matrix gain;
+      int applied = 0;
+
+      for (int j = 0; j < m_c.rows(); ++j)
+      {
+        row = m_c.get(j, j, 0, m_c.columns() - 1);
+
+        // Innovation corrected by the state change accumulated so far.
+        double innov = m_innov(j) - (row * (m_x - x0))(0);
+
+        // Scalar innovation covariance: row * P * row' + r(j, j).
+        Math::Matrix::multiplyByTranspose(m_p, row, cp);
+        double s = (row * cp)(0) + m_r(j, j);
+
+        if (s <= 0.0)
+          throw std::runtime_error(DTR("matrix inversion error"));
+
+        // Check if innovation is above a threshold value.
+        // Set threshold to 0 to accept everything.
+        if (threshold != 0)
+        {
+          if ((innov * innov) / s >= threshold)
+            continue;
+        }
+
+        // Scalar Kalman gain.
+        gain = cp * (1.0 / s);
+
+        // State update.
+        m_x.addScaled(innov, gain);
+
+        // State covariance update: P = P - gain * (P * row')'.
+        Math::Matrix::multiplySub(gain, transpose(cp), m_p);
+
+        ++applied;
+      }
+
+      if (m_c.rows() > 0 && applied == 0)
+        return -1;
+
+      return 0;
+    }
+
     void
     KalmanFilter::setState(short pos, double value)
     {
@@ -46,6 +46,7 @@
 #include <stdexcept>
 #include <string>
 #include <cmath>
+#include <vector>
 
 // DUNE headers.
 #include <DUNE/Config.hpp>
@@ -83,6 +84,18 @@ namespace DUNE
       void
       reset(short num_states, short num_outputs);
 
+      //! Declare the block partition of the state vector. During
+      //! prediction the covariance propagation then skips blocks of
+      //! the covariance transition matrix that are entirely zero,
+      //! which for block structured models (position and velocity
+      //! coupled, bias states weakly coupled) cuts most of the
+      //! A * P * A' work. The partition must cover all states:
+      //! declare it after reset() and pass an empty vector to return
+      //! to dense propagation.
+      //! @param blocks size of each state block.
+      void
+      setBlockStructure(const std::vector<size_t>& blocks);
+
       //! Resize number of state outputs.
       //! @param num_outputs number of filter output states.
       //! @return true if resized, false otherwise.
@@ -109,6 +122,43 @@ namespace DUNE
       int
       update(float threshold);
 
+      //! Enable fusion of delayed measurements. The filter keeps the
+      //! last snapshots of state and covariance, one per predict()
+      //! call, so measurements with known latency can be folded in
+      //! with updateDelayed(). Memory cost is bounded by depth state
+      //! and covariance copies.
+      //! @param depth number of prediction cycles to keep (0 disables).
+      void
+      setDelayedFusion(unsigned depth);
+
+      //! Fuse a measurement taken a number of prediction cycles in
+      //! the past (retrodiction). The innovation is computed against
+      //! the state at the measurement epoch and the correction is
+      //! propagated to the current state through the accumulated
+      //! state transitions, instead of pretending the measurement is
+      //! current or inflating its noise.
+      //! @param c observation model of the measurement.
+      //! @param z measurement vector.
+      //! @param r measurement noise covariance matrix.
+      //! @param delay age of the measurement in prediction cycles.
+      //! @param threshold threshold to reject large state innovations.
+      //! @return 0 if update is successful, -1 otherwise.
+      int
+      updateDelayed(const Math::Matrix& c, const Math::Matrix& z,
+                    const Math::Matrix& r, unsigned delay, float threshold);
+
+      //! Enable or disable sequential-scalar measurement updates.
+      //! When enabled, update() processes one measurement row at a
+      //! time with scalar gains, which removes the innovation
+      //! covariance inversion. Valid only when the measurement noise
+      //! covariance matrix is diagonal (uncorrelated measurements).
+      //! @param sequential true to process measurements sequentially.
+      inline void
+      setSequentialUpdate(bool sequential)
+      {
+        m_sequential = sequential;
+      }
+
       //! Get filter state value.
       //! @param pos matrix index.
       //! @return state matrix value.
@@ -341,8 +391,45 @@ namespace DUNE
       setMeasurementNoise(double value);
 
     private:
+      //! Snapshot of the filter at one prediction cycle.
+      struct Snapshot
+      {
+        //! State vector at the end of the cycle.
+        Math::Matrix x;
+        //! State covariance matrix at the end of the cycle.
+        Math::Matrix p;
+        //! State transition applied during the cycle.
+        Math::Matrix ax;
+      };
+
+      //! Process measurements one row at a time in update().
+      //! @param threshold threshold to reject large state innovations.
+      //! @return 0 if at least one measurement was applied, -1 otherwise.
+      int
+      updateSequential(float threshold);
+
+      //! Store a snapshot of the current cycle, called by predict().
+      void
+      snapshot(void);
+
+      //! Propagate the state covariance (P = A * P * A' + Q), using
+      //! the block kernels when a block partition was declared.
+      void
+      propagateCovariance(void);
+
+      //! Get snapshot by age in prediction cycles (0 is the current).
+      //! @param delay age in prediction cycles.
+      //! @return snapshot at the given age.
+      const Snapshot&
+      getSnapshot(unsigned delay) const
+      {
+        return m_snaps[(m_snaps_head + m_snaps.size() - 1 - delay) % m_snaps.size()];
+      }
+
       //! Kalman filter state count.
       size_t m_state_count;
+      //! True to process measurements sequentially in update().
+      bool m_sequential;
       //! State vector.
       Math::Matrix m_x;
       //! Output vector.
@@ -361,6 +448,17 @@ namespace DUNE
       Math::Matrix m_r;
       //! Innovation vector.
       Math::Matrix m_innov;
+      //! Block partition of the state vector, empty for dense
+      //! covariance propagation.
+      std::vector<size_t> m_blocks;
+      //! Scratch matrix of the blockwise covariance propagation.
+      Math::Matrix m_ap_p;
+      //! Ring of per-cycle snapshots for delayed fusion.
+      std::vector<Snapshot> m_snaps;
+      //! Index of the next snapshot slot to write.
+      size_t m_snaps_head;
+      //! Number of valid snapshots.
+      size_t m_snaps_size;
     };
   }
 }
@@ -0,0 +1,322 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+// Kalman filter over fixed-size matrices. Follows the same linear         *
+// time-invariant model as Navigation::KalmanFilter:                       *
+//   x(k+1) = A * x(k) + q(k)                                              *
+//   P = cov(x)                                                            *
+//   Q = cov(w)                                                            *
+// The state and output dimensions are template parameters, so the         *
+// predict/update loops run entirely on stack storage with no heap         *
+// traffic. Use this variant when the number of outputs is known at        *
+// compile time; filters that resize their output set at runtime must     *
+// keep using the dynamic KalmanFilter.                                    *
+//***************************************************************************
+
+#ifndef DUNE_NAVIGATION_KALMAN_FILTER_N_HPP_INCLUDED_
+#define DUNE_NAVIGATION_KALMAN_FILTER_N_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <stdexcept>
+#include <string>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Math/MatrixN.hpp>
+
+namespace DUNE
+{
+  namespace Navigation
+  {
+    //! Kalman filter with compile-time state and output dimensions.
+    //! @tparam S number of filter states.
+    //! @tparam O number of filter output states.
+    template <unsigned S, unsigned O>
+    class KalmanFilterN
+    {
+    public:
+      //! Constructor. All matrices start zero-filled and the
+      //! transition matrices start as identity.
+      KalmanFilterN(void)
+      {
+        m_ax.identity();
+        m_ap.identity();
+      }
+
+      //! Set initial conditions (state and covariance matrix).
+      //! @param x0 state.
+      //! @param P0 covariance.
+      void
+      initialize(const Math::MatrixN<S, 1>& x0, const Math::MatrixN<S, S>& P0)
+      {
+        m_x = x0;
+        m_p = P0;
+      }
+
+      //! Keep the state covariance matrix symmetric.
+      void
+      normalize(void)
+      {
+        Math::MatrixN<S, S> pt = transpose(m_p);
+        m_p += pt;
+        m_p *= 0.5;
+      }
+
+      //! Predict the state at the next timestep assuming no input.
+      void
+      predict(void)
+      {
+        m_x = m_ax * m_x;
+        m_p = m_ap * m_p * transpose(m_ap) + m_q;
+      }
+
+      //! Kalman Filter update function.
+      //! @param threshold threshold to reject large state innovations.
+      //! @return 0 if update is successful, -1 otherwise.
+      int
+      update(float threshold)
+      {
+        // Measurement prediction covariance.
+        Math::MatrixN<O, O> cov = (m_c * m_p * transpose(m_c)) + m_r;
+        Math::MatrixN<O, O> cov_1;
+
+        // Inverse of the measurement prediction covariance.
+        try
+        {
+          cov_1 = inverse(cov);
+        }
+        catch (...)
+        {
+          throw std::runtime_error(DTR("matrix inversion error"));
+        }
+
+        // Check if innovation is above a threshold value.
+        // Set threshold to 0 to accept everything.
+        if (threshold != 0)
+        {
+          double level = (transpose(m_innov) * cov_1 * m_innov)(0);
+
+          if (level >= threshold)
+            return -1;
+        }
+
+        // Kalman Gain.
+        Math::MatrixN<S, O> K = m_p * transpose(m_c) * cov_1;
+
+        // State update.
+        m_x += K * m_innov;
+
+        // State Covariance update.
+        m_p -= K * m_c * m_p;
+
+        return 0;
+      }
+
+      //! Get filter state value.
+      //! @param pos matrix index.
+      //! @return state matrix value.
+      double
+      getState(unsigned pos) const
+      {
+        if (pos >= S)
+          throw std::runtime_error(DTR("invalid index"));
+
+        return m_x(pos);
+      }
+
+      //! Set state matrix value.
+      //! @param pos matrix index.
+      //! @param value state matrix value.
+      void
+      setState(unsigned pos, double value)
+      {
+        if (pos >= S)
+          throw std::runtime_error(DTR("invalid index"));
+
+        m_x(pos) = value;
+      }
+
+      //! Reset state matrix.
+      void
+      resetState(void)
+      {
+        m_x.fill(0.0);
+      }
+
+      //! Set transition matrices.
+      //! @param a state transition matrix.
+      void
+      setTransitions(const Math::MatrixN<S, S>& a)
+      {
+        m_ax = a;
+        m_ap = a;
+      }
+
+      //! Set state transition matrix.
+      //! @param a state transition matrix.
+      void
+      setStateTransition(const Math::MatrixN<S, S>& a)
+      {
+        m_ax = a;
+      }
+
+      //! Set state covariance transition matrix.
+      //! @param a state covariance transition matrix.
+      void
+      setCovarianceTransition(const Math::MatrixN<S, S>& a)
+      {
+        m_ap = a;
+      }
+
+      //! Reset output matrices.
+      void
+      resetOutputs(void)
+      {
+        m_innov.fill(0.0);
+        m_c.fill(0.0);
+      }
+
+      //! Get innovation matrix value.
+      //! @param pos matrix index.
+      //! @return innovation matrix value.
+      double
+      getInnovation(unsigned pos) const
+      {
+        if (pos >= O)
+          throw std::runtime_error(DTR("invalid index"));
+
+        return m_innov(pos);
+      }
+
+      //! Set innovation matrix value.
+      //! @param pos matrix index.
+      //! @param value innovation matrix value.
+      void
+      setInnovation(unsigned pos, double value)
+      {
+        if (pos >= O)
+          throw std::runtime_error(DTR("invalid index"));
+
+        m_innov(pos) = value;
+      }
+
+      //! Set observation model matrix value.
+      //! @param ln row index.
+      //! @param cl column index.
+      //! @param value output transition matrix value.
+      void
+      setObservation(unsigned ln, unsigned cl, double value)
+      {
+        if (ln >= O || cl >= S)
+          throw std::runtime_error(DTR("invalid index"));
+
+        m_c(ln, cl) = value;
+      }
+
+      //! Get covariance matrix value.
+      //! @param in row and column index.
+      //! @return covariance matrix value.
+      double
+      getCovariance(unsigned in) const
+      {
+        if (in >= S)
+          throw std::runtime_error(DTR("invalid index"));
+
+        return m_p(in, in);
+      }
+
+      //! Set state covariance matrix value.
+      //! @param in row and column index.
+      //! @param value state covariance matrix value.
+      void
+      setCovariance(unsigned in, double value)
+      {
+        if (in >= S)
+          throw std::runtime_error(DTR("invalid index"));
+
+        m_p(in, in) = value;
+      }
+
+      //! Reset covariance values of a given state.
+      //! @param in row and column index.
+      void
+      resetCovariance(unsigned in)
+      {
+        for (unsigned i = 0; i < S; ++i)
+        {
+          m_p(i, in) = 0.0;
+          m_p(in, i) = 0.0;
+        }
+      }
+
+      //! Set process noise covariance matrix value.
+      //! @param in row and column index.
+      //! @param value process noise covariance matrix value.
+      void
+      setProcessNoise(unsigned in, double value)
+      {
+        if (in >= S)
+          throw std::runtime_error(DTR("invalid index"));
+
+        m_q(in, in) = value;
+      }
+
+      //! Set measurement noise covariance matrix value.
+      //! @param in row and column index.
+      //! @param value measurement noise covariance matrix value.
+      void
+      setMeasurementNoise(unsigned in, double value)
+      {
+        if (in >= O)
+          throw std::runtime_error(DTR("invalid index"));
+
+        m_r(in, in) = value;
+      }
+
+    private:
+      //! State vector.
+      Math::MatrixN<S, 1> m_x;
+      //! State transition matrix.
+      Math::MatrixN<S, S> m_ax;
+      //! State covariance transition matrix.
+      Math::MatrixN<S, S> m_ap;
+      //! Output transition matrix.
+      Math::MatrixN<O, S> m_c;
+      //! State covariance matrix.
+      Math::MatrixN<S, S> m_p;
+      //! Process noise covariance matrix.
+      Math::MatrixN<S, S> m_q;
+      //! Measurement noise covariance matrix.
+      Math::MatrixN<O, O> m_r;
+      //! Innovation vector.
+      Math::MatrixN<O, 1> m_innov;
+    };
+  }
+}
+
+#endif
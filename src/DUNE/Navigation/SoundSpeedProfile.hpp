@@ -0,0 +1,176 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+
+#ifndef DUNE_NAVIGATION_SOUND_SPEED_PROFILE_HPP_INCLUDED_
+#define DUNE_NAVIGATION_SOUND_SPEED_PROFILE_HPP_INCLUDED_
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Concurrency/RWLock.hpp>
+#include <DUNE/Concurrency/ScopedRWLock.hpp>
+
+namespace DUNE
+{
+  namespace Navigation
+  {
+    //! Smoothing factor of the per-bin exponential average.
+    static const double c_svp_alpha = 0.1;
+    //! Standard sound speed used while the profile is empty (m/s).
+    static const double c_svp_default = 1500.0;
+
+    //! Depth-binned sound velocity profile, shared by all tasks of a
+    //! context. Every SoundSpeed sample dispatched on the bus feeds
+    //! the bin of the depth it was measured at, so rangers and sonar
+    //! georeferencing read one consistently smoothed value instead of
+    //! each consumer filtering the raw samples on its own.
+    //!
+    //! Memory is fixed: the water column is divided into bins of
+    //! constant height and each bin keeps a single exponentially
+    //! smoothed value.
+    class SoundSpeedProfile
+    {
+    public:
+      SoundSpeedProfile(void)
+      {
+        for (unsigned i = 0; i < c_bins; ++i)
+          m_bins[i] = -1.0;
+      }
+
+      //! Feed one sound speed sample into the profile.
+      //! @param[in] depth depth the sample was measured at (m).
+      //! @param[in] value measured sound speed (m/s).
+      void
+      update(double depth, double value)
+      {
+        if (value <= 0.0)
+          return;
+
+        Concurrency::ScopedRWLock l(m_lock, true);
+
+        double& bin = m_bins[binOf(depth)];
+        if (bin < 0.0)
+          bin = value;
+        else
+          bin += c_svp_alpha * (value - bin);
+      }
+
+      //! Get the smoothed sound speed at a given depth. When the
+      //! depth's bin was never fed, the nearest fed bin is used; an
+      //! empty profile yields the standard 1500 m/s.
+      //! @param[in] depth depth of interest (m).
+      //! @return smoothed sound speed (m/s).
+      double
+      get(double depth) const
+      {
+        Concurrency::ScopedRWLock l(m_lock);
+
+        unsigned bin = binOf(depth);
+        if (m_bins[bin] >= 0.0)
+          return m_bins[bin];
+
+        for (unsigned off = 1; off < c_bins; ++off)
+        {
+          if (bin >= off && m_bins[bin - off] >= 0.0)
+            return m_bins[bin - off];
+          if (bin + off < c_bins && m_bins[bin + off] >= 0.0)
+            return m_bins[bin + off];
+        }
+
+        return c_svp_default;
+      }
+
+      //! Get the mean sound speed along a vertical path, as used by
+      //! slant range corrections. Unfed bins inherit the nearest fed
+      //! value through get().
+      //! @param[in] depth_a one end of the path (m).
+      //! @param[in] depth_b other end of the path (m).
+      //! @return mean sound speed along the path (m/s).
+      double
+      getMean(double depth_a, double depth_b) const
+      {
+        if (depth_b < depth_a)
+        {
+          double tmp = depth_a;
+          depth_a = depth_b;
+          depth_b = tmp;
+        }
+
+        unsigned first = binOf(depth_a);
+        unsigned last = binOf(depth_b);
+
+        double sum = 0.0;
+        for (unsigned i = first; i <= last; ++i)
+          sum += get((i + 0.5) * c_bin_height);
+
+        return sum / (last - first + 1);
+      }
+
+      //! Check if the profile was ever fed.
+      //! @return true if no sample was ever fed, false otherwise.
+      bool
+      isEmpty(void) const
+      {
+        Concurrency::ScopedRWLock l(m_lock);
+
+        for (unsigned i = 0; i < c_bins; ++i)
+        {
+          if (m_bins[i] >= 0.0)
+            return false;
+        }
+
+        return true;
+      }
+
+    private:
+      //! Number of depth bins.
+      static const unsigned c_bins = 128;
+      //! Height of one depth bin (m).
+      static const unsigned c_bin_height = 2;
+
+      //! Lock to serialize access to the bins.
+      mutable Concurrency::RWLock m_lock;
+      //! Smoothed sound speed per bin, negative when never fed.
+      double m_bins[c_bins];
+
+      //! Get the bin of a given depth, clamping depths beyond the
+      //! covered column to the deepest bin.
+      //! @param[in] depth depth (m).
+      //! @return bin index.
+      static unsigned
+      binOf(double depth)
+      {
+        if (depth <= 0.0)
+          return 0;
+
+        unsigned bin = (unsigned)(depth / c_bin_height);
+        return (bin >= c_bins) ? c_bins - 1 : bin;
+      }
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,215 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Pedro Calado                                                     *
+//***************************************************************************
+
+#ifndef DUNE_NAVIGATION_STATE_HISTORY_HPP_INCLUDED_
+#define DUNE_NAVIGATION_STATE_HISTORY_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <vector>
+#include <cstddef>
+
+// DUNE headers.
+#include <DUNE/IMC/Definitions.hpp>
+#include <DUNE/Math/Angles.hpp>
+
+namespace DUNE
+{
+  namespace Navigation
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM StateHistory;
+
+    //! Fixed-memory ring of timestamped EstimatedState snapshots.
+    //!
+    //! Measurements that arrive seconds late (USBL fixes, acoustic
+    //! ranges) must be folded in against the vehicle state at the
+    //! time of measurement, not at the time of arrival. This class
+    //! keeps the last snapshots in a preallocated ring with O(1)
+    //! insertion and retrieves the state at a given time with a
+    //! binary search plus linear interpolation between the two
+    //! bracketing snapshots.
+    //!
+    //! @author Pedro Calado.
+    class StateHistory
+    {
+    public:
+      //! Constructor.
+      //! @param[in] capacity maximum number of snapshots to keep.
+      StateHistory(size_t capacity):
+        m_head(0),
+        m_size(0)
+      {
+        m_states.resize(capacity);
+      }
+
+      //! Insert a snapshot. Snapshots must arrive in chronological
+      //! order; out of order snapshots are discarded. When the ring
+      //! is full the oldest snapshot is overwritten.
+      //! @param[in] state state snapshot to insert.
+      void
+      insert(const IMC::EstimatedState& state)
+      {
+        if (m_size > 0 && state.getTimeStamp() <= newest().getTimeStamp())
+          return;
+
+        m_states[m_head] = state;
+        m_head = (m_head + 1) % m_states.size();
+
+        if (m_size < m_states.size())
+          ++m_size;
+      }
+
+      //! Retrieve the state at a given time.
+      //! @param[in] time timestamp of interest.
+      //! @param[out] state interpolated state at the given time.
+      //! @return true if the time is covered by the history, false otherwise.
+      bool
+      get(double time, IMC::EstimatedState& state) const
+      {
+        if (m_size == 0)
+          return false;
+
+        if (time < at(0).getTimeStamp() || time > newest().getTimeStamp())
+          return false;
+
+        // Binary search for the first snapshot not earlier than time.
+        size_t low = 0;
+        size_t high = m_size - 1;
+
+        while (low < high)
+        {
+          size_t mid = (low + high) / 2;
+
+          if (at(mid).getTimeStamp() < time)
+            low = mid + 1;
+          else
+            high = mid;
+        }
+
+        const IMC::EstimatedState& next = at(low);
+
+        if (low == 0 || next.getTimeStamp() == time)
+        {
+          state = next;
+          return true;
+        }
+
+        const IMC::EstimatedState& prev = at(low - 1);
+
+        // Snapshots with different navigation origins cannot be
+        // interpolated in the local frame, use the nearest one.
+        if (prev.lat != next.lat || prev.lon != next.lon || prev.height != next.height)
+        {
+          if (time - prev.getTimeStamp() < next.getTimeStamp() - time)
+            state = prev;
+          else
+            state = next;
+          return true;
+        }
+
+        double frac = (time - prev.getTimeStamp())
+                      / (next.getTimeStamp() - prev.getTimeStamp());
+
+        state = prev;
+        state.setTimeStamp(time);
+        state.x += frac * (next.x - prev.x);
+        state.y += frac * (next.y - prev.y);
+        state.z += frac * (next.z - prev.z);
+        state.depth += frac * (next.depth - prev.depth);
+        state.alt += frac * (next.alt - prev.alt);
+        state.u += frac * (next.u - prev.u);
+        state.v += frac * (next.v - prev.v);
+        state.w += frac * (next.w - prev.w);
+        state.vx += frac * (next.vx - prev.vx);
+        state.vy += frac * (next.vy - prev.vy);
+        state.vz += frac * (next.vz - prev.vz);
+        state.phi = interpolateAngle(prev.phi, next.phi, frac);
+        state.theta = interpolateAngle(prev.theta, next.theta, frac);
+        state.psi = interpolateAngle(prev.psi, next.psi, frac);
+
+        return true;
+      }
+
+      //! Get the number of stored snapshots.
+      //! @return number of stored snapshots.
+      size_t
+      size(void) const
+      {
+        return m_size;
+      }
+
+      //! Remove all snapshots.
+      void
+      clear(void)
+      {
+        m_head = 0;
+        m_size = 0;
+      }
+
+    private:
+      //! Get snapshot by chronological index (0 is the oldest).
+      //! @param[in] index chronological index.
+      //! @return snapshot at the given index.
+      const IMC::EstimatedState&
+      at(size_t index) const
+      {
+        return m_states[(m_head + m_states.size() - m_size + index) % m_states.size()];
+      }
+
+      //! Get the most recent snapshot.
+      //! @return most recent snapshot.
+      const IMC::EstimatedState&
+      newest(void) const
+      {
+        return at(m_size - 1);
+      }
+
+      //! Interpolate between two angles along the shortest arc.
+      //! @param[in] prev previous angle.
+      //! @param[in] next next angle.
+      //! @param[in] frac interpolation fraction.
+      //! @return interpolated angle.
+      static double
+      interpolateAngle(double prev, double next, double frac)
+      {
+        double diff = Math::Angles::normalizeRadian(next - prev);
+        return Math::Angles::normalizeRadian(prev + frac * diff);
+      }
+
+      //! Preallocated ring of snapshots.
+      std::vector<IMC::EstimatedState> m_states;
+      //! Index of the next slot to write.
+      size_t m_head;
+      //! Number of valid snapshots.
+      size_t m_size;
+    };
+  }
+}
+
+#endif
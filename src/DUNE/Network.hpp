@@ -43,6 +43,7 @@ namespace DUNE
 #include <DUNE/Network/Exceptions.hpp>
 #include <DUNE/Network/UDPSocket.hpp>
 #include <DUNE/Network/TCPSocket.hpp>
+#include <DUNE/Network/TCPConnectionPool.hpp>
 #include <DUNE/Network/Interface.hpp>
 #include <DUNE/Network/TDMA.hpp>
 
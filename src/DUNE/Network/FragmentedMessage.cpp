@@ -59,8 +59,7 @@ namespace DUNE
       }
 
       // Check if this is a valid fragment
-      if (part->uid != m_uid || part->getSource() != m_src ||
-          part->frag_number >= m_num_frags)
+      if (part->uid != m_uid || part->getSource() != m_src)
       {
         if (m_parent == NULL)
           DUNE_ERR("FragmentedMessage", "Invalid fragment received and it won't be processed.");
@@ -70,28 +69,110 @@ namespace DUNE
         return NULL;
       }
 
-      m_fragments[part->frag_number] = *part;
+      // Fragments numbered past num_frags are parity fragments: the
+      // group size followed by the XOR of the group's payloads.
+      if (part->frag_number >= m_num_frags)
+      {
+        if (part->data.size() < 2 || part->data[0] == 0)
+        {
+          if (m_parent == NULL)
+            DUNE_ERR("FragmentedMessage", "Invalid fragment received and it won't be processed.");
+          else
+            m_parent->err(DTR("Invalid fragment received and it won't be processed."));
+
+          return NULL;
+        }
+
+        m_parity[part->frag_number - m_num_frags] = *part;
+      }
+      else
+      {
+        m_fragments[part->frag_number] = *part;
+      }
+
+      if (getFragmentsMissing() > 0)
+        recoverFromParity();
 
       // Message is complete. Let's reassemble and return it.
       if (getFragmentsMissing() == 0)
+        return reassemble();
+
+      return 0;
+    }
+
+    void
+    FragmentedMessage::recoverFromParity(void)
+    {
+      std::map<unsigned int, IMC::MessagePart>::iterator it = m_parity.begin();
+      for (; it != m_parity.end(); ++it)
       {
-        int i;
-        int total_length = 0;
-        // concatenate all parts into a single array
-        std::vector<char> data;
-        for (i = 0; i < m_num_frags; i++)
+        const IMC::MessagePart& parity = it->second;
+        unsigned group_size = (uint8_t)parity.data[0];
+        unsigned first = it->first * group_size;
+        unsigned last = std::min((unsigned)m_num_frags, first + group_size);
+
+        // Recovery is only possible with a single missing member.
+        int missing = -1;
+        for (unsigned i = first; i < last; ++i)
+        {
+          if (m_fragments.find(i) == m_fragments.end())
+          {
+            if (missing >= 0)
+            {
+              missing = -1;
+              break;
+            }
+
+            missing = i;
+          }
+        }
+
+        if (missing < 0)
+          continue;
+
+        // XOR the parity payload with the remaining members; shorter
+        // members behave as if zero padded. The last fragment may be
+        // recovered with trailing padding, which the IMC deserializer
+        // ignores.
+        std::vector<char> data(parity.data.begin() + 1, parity.data.end());
+        for (unsigned i = first; i < last; ++i)
         {
-          total_length += m_fragments[i].data.size();
-          data.insert(data.end(), m_fragments[i].data.begin(),
-                      m_fragments[i].data.end());
+          if ((int)i == missing)
+            continue;
+
+          const std::vector<char>& frag = m_fragments[i].data;
+          for (size_t b = 0; b < frag.size() && b < data.size(); ++b)
+            data[b] ^= frag[b];
         }
 
-        return IMC::Packet::deserialize((uint8_t*)&data[0], total_length);
+        IMC::MessagePart part;
+        part.uid = m_uid;
+        part.frag_number = missing;
+        part.num_frags = m_num_frags;
+        part.setSource(m_src);
+        part.data = data;
+        m_fragments[missing] = part;
+
+        if (m_parent != NULL)
+          m_parent->debug("recovered fragment %d from parity", missing);
       }
-      else
+    }
+
+    IMC::Message*
+    FragmentedMessage::reassemble(void)
+    {
+      int i;
+      int total_length = 0;
+      // concatenate all parts into a single array
+      std::vector<char> data;
+      for (i = 0; i < m_num_frags; i++)
       {
-        return 0;
+        total_length += m_fragments[i].data.size();
+        data.insert(data.end(), m_fragments[i].data.begin(),
+                    m_fragments[i].data.end());
       }
+
+      return IMC::Packet::deserialize((uint8_t*)&data[0], total_length);
     }
 
     double
@@ -65,6 +65,19 @@ namespace DUNE
       double m_creation_time;
       DUNE::Tasks::Task* m_parent;
       std::map<unsigned int, IMC::MessagePart> m_fragments;
+      //! Parity fragments, keyed by group index.
+      std::map<unsigned int, IMC::MessagePart> m_parity;
+
+      //! Rebuild data fragments from parity fragments: each group
+      //! with a single missing member is recovered by XORing the
+      //! parity payload with the remaining members.
+      void
+      recoverFromParity(void);
+
+      //! Reassemble the complete message from its fragments.
+      //! @return reassembled message.
+      IMC::Message*
+      reassemble(void);
     };
   }
 }
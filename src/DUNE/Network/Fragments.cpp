@@ -36,7 +36,7 @@ namespace DUNE
   {
     int Fragments::s_uid = 0;
 
-    Fragments::Fragments(IMC::Message* msg, int mtu)
+    Fragments::Fragments(IMC::Message* msg, int mtu, unsigned parity_group)
     {
       m_uid = s_uid++;
       m_num_frags = 0;
@@ -66,6 +66,46 @@ namespace DUNE
         pos += cur_size;
         m_fragments.push_back(mpart);
       }
+
+      if (parity_group == 0)
+        return;
+
+      // Parity fragments: one per group of parity_group data
+      // fragments, numbered past num_frags, carrying the group size
+      // followed by the XOR of the group's payloads (shorter payloads
+      // behave as if zero padded).
+      int groups = (int)std::ceil((float)m_num_frags / (float)parity_group);
+      if (parity_group > 255 || m_num_frags + groups > 255)
+      {
+        DUNE_WRN("Fragments", "too many fragments for parity, sending without it");
+        return;
+      }
+
+      for (int g = 0; g < groups; ++g)
+      {
+        unsigned first = g * parity_group;
+        unsigned last = std::min((unsigned)m_num_frags, first + parity_group);
+
+        size_t max_size = 0;
+        for (unsigned i = first; i < last; ++i)
+          max_size = std::max(max_size, m_fragments[i]->data.size());
+
+        IMC::MessagePart* mpart = new IMC::MessagePart();
+        mpart->frag_number = m_num_frags + g;
+        mpart->num_frags = m_num_frags;
+        mpart->uid = m_uid;
+        mpart->data.assign(1 + max_size, 0);
+        mpart->data[0] = (char)parity_group;
+
+        for (unsigned i = first; i < last; ++i)
+        {
+          const std::vector<char>& data = m_fragments[i]->data;
+          for (size_t b = 0; b < data.size(); ++b)
+            mpart->data[1 + b] ^= data[b];
+        }
+
+        m_fragments.push_back(mpart);
+      }
     }
 
     IMC::MessagePart*
@@ -77,7 +117,7 @@ namespace DUNE
     int
     Fragments::getNumberOfFragments(void)
     {
-      return m_num_frags;
+      return m_fragments.size();
     }
 
     Fragments::~Fragments(void)
@@ -41,11 +41,27 @@ namespace DUNE
     class Fragments
     {
     public:
-      Fragments(IMC::Message* message, int mtu);
+      //! Fragment a message, optionally appending parity fragments.
+      //!
+      //! When parity_group is k > 0, one parity fragment is emitted
+      //! for each group of k data fragments, carrying the group size
+      //! followed by the XOR of the group's payloads. A receiver can
+      //! rebuild any single lost fragment per group from the
+      //! remaining ones, avoiding a retransmission cycle. Parity
+      //! fragments are numbered past num_frags, so receivers that do
+      //! not understand them discard them as invalid.
+      //! @param[in] message message to fragment.
+      //! @param[in] mtu maximum size of each fragment.
+      //! @param[in] parity_group data fragments per parity fragment,
+      //! 0 to disable parity.
+      Fragments(IMC::Message* message, int mtu, unsigned parity_group = 0);
 
       IMC::MessagePart*
       getFragment(int frag_number);
 
+      //! Retrieve the number of fragments to transmit, including any
+      //! parity fragments.
+      //! @return number of fragments.
       int
       getNumberOfFragments(void);
 
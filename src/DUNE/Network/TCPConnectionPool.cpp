@@ -0,0 +1,132 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+// DUNE headers.
+#include <DUNE/Network/TCPConnectionPool.hpp>
+#include <DUNE/Network/Exceptions.hpp>
+#include <DUNE/Time/Clock.hpp>
+
+namespace DUNE
+{
+  namespace Network
+  {
+    TCPConnectionPool::TCPConnectionPool(double connect_timeout, double retry_delay):
+      m_connect_timeout(connect_timeout),
+      m_retry_delay(retry_delay)
+    { }
+
+    TCPConnectionPool::~TCPConnectionPool(void)
+    {
+      clear();
+    }
+
+    TCPSocket*
+    TCPConnectionPool::get(const Address& addr, uint16_t port)
+    {
+      Peer peer(addr.toInteger(), port);
+      EntryMap::iterator itr = m_entries.find(peer);
+
+      if (itr == m_entries.end())
+      {
+        Entry entry;
+        entry.socket = NULL;
+        entry.state = ST_IDLE;
+        entry.next_time = 0.0;
+        itr = m_entries.insert(std::make_pair(peer, entry)).first;
+      }
+
+      Entry& entry = itr->second;
+      double now = Time::Clock::get();
+
+      if (entry.state == ST_IDLE && now >= entry.next_time)
+      {
+        try
+        {
+          entry.socket = new TCPSocket;
+          entry.socket->beginConnect(addr, port);
+          entry.state = ST_CONNECTING;
+          entry.next_time = now + m_connect_timeout;
+        }
+        catch (std::runtime_error& e)
+        {
+          (void)e;
+          scheduleRetry(entry);
+        }
+      }
+
+      if (entry.state == ST_CONNECTING)
+      {
+        try
+        {
+          if (entry.socket->endConnect())
+            entry.state = ST_CONNECTED;
+          else if (now >= entry.next_time)
+            scheduleRetry(entry);
+        }
+        catch (std::runtime_error& e)
+        {
+          (void)e;
+          scheduleRetry(entry);
+        }
+      }
+
+      if (entry.state == ST_CONNECTED)
+        return entry.socket;
+
+      return NULL;
+    }
+
+    void
+    TCPConnectionPool::invalidate(const Address& addr, uint16_t port)
+    {
+      Peer peer(addr.toInteger(), port);
+      EntryMap::iterator itr = m_entries.find(peer);
+      if (itr != m_entries.end())
+        scheduleRetry(itr->second);
+    }
+
+    void
+    TCPConnectionPool::clear(void)
+    {
+      for (EntryMap::iterator itr = m_entries.begin(); itr != m_entries.end(); ++itr)
+        delete itr->second.socket;
+
+      m_entries.clear();
+    }
+
+    void
+    TCPConnectionPool::scheduleRetry(Entry& entry)
+    {
+      delete entry.socket;
+      entry.socket = NULL;
+      entry.state = ST_IDLE;
+      entry.next_time = Time::Clock::get() + m_retry_delay;
+    }
+  }
+}
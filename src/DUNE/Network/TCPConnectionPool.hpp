@@ -0,0 +1,139 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+#ifndef DUNE_NETWORK_TCP_CONNECTION_POOL_HPP_INCLUDED_
+#define DUNE_NETWORK_TCP_CONNECTION_POOL_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <map>
+#include <utility>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Network/Address.hpp>
+#include <DUNE/Network/TCPSocket.hpp>
+
+namespace DUNE
+{
+  namespace Network
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM TCPConnectionPool;
+
+    //! Pool of reconnecting TCP client connections.
+    //!
+    //! Connections are established with non-blocking connects advanced
+    //! on each call to get(), so callers on a data path never stall
+    //! inside connect() when a peer is down. Failed connections are
+    //! retried after a configurable delay.
+    class TCPConnectionPool
+    {
+    public:
+      //! Constructor.
+      //! @param[in] connect_timeout time to wait for a connection
+      //! attempt to complete, in seconds.
+      //! @param[in] retry_delay time to wait before retrying a failed
+      //! connection, in seconds.
+      TCPConnectionPool(double connect_timeout = 5.0, double retry_delay = 2.0);
+
+      //! Destructor.
+      ~TCPConnectionPool(void);
+
+      //! Retrieve the connection to a peer, starting or advancing a
+      //! non-blocking connection attempt if necessary. This function
+      //! never blocks.
+      //! @param[in] addr peer address.
+      //! @param[in] port peer port.
+      //! @return connected socket, owned by the pool, or NULL while
+      //! the connection is unavailable.
+      TCPSocket*
+      get(const Address& addr, uint16_t port);
+
+      //! Discard the connection to a peer. Call after a read or write
+      //! error; a reconnection attempt is scheduled after the retry
+      //! delay.
+      //! @param[in] addr peer address.
+      //! @param[in] port peer port.
+      void
+      invalidate(const Address& addr, uint16_t port);
+
+      //! Close all connections and discard pending attempts.
+      void
+      clear(void);
+
+    private:
+      //! Connection state.
+      enum State
+      {
+        //! Waiting for the next connection attempt.
+        ST_IDLE,
+        //! Non-blocking connect in progress.
+        ST_CONNECTING,
+        //! Connection established.
+        ST_CONNECTED
+      };
+
+      //! Pool entry.
+      struct Entry
+      {
+        //! Socket or NULL.
+        TCPSocket* socket;
+        //! Connection state.
+        State state;
+        //! Time of the next connection attempt (ST_IDLE) or attempt
+        //! deadline (ST_CONNECTING).
+        double next_time;
+      };
+
+      //! Peer key (address, port).
+      typedef std::pair<uint32_t, uint16_t> Peer;
+      //! Map of peers to pool entries.
+      typedef std::map<Peer, Entry> EntryMap;
+
+      //! Drop the socket of an entry and schedule a retry.
+      void
+      scheduleRetry(Entry& entry);
+
+      //! Connection attempt timeout.
+      double m_connect_timeout;
+      //! Delay between connection attempts.
+      double m_retry_delay;
+      //! Pool entries.
+      EntryMap m_entries;
+
+      // Non - copyable.
+      TCPConnectionPool(const TCPConnectionPool&);
+
+      // Non - assignable.
+      TCPConnectionPool& operator=(const TCPConnectionPool&);
+    };
+  }
+}
+
+#endif
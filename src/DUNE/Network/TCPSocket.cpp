@@ -39,6 +39,7 @@
 #include <DUNE/Utils/ByteCopy.hpp>
 #include <DUNE/Network/TCPSocket.hpp>
 #include <DUNE/Network/Exceptions.hpp>
+#include <DUNE/Time/Clock.hpp>
 #include <DUNE/Time/Utils.hpp>
 #include <DUNE/Concurrency/Scheduler.hpp>
 #include <DUNE/IO/Poll.hpp>
@@ -183,6 +184,92 @@ namespace DUNE
         throw NetworkError(DTR("unable to connect"), getLastErrorMessage());
     }
 
+    void
+    TCPSocket::connect(const Address& addr, uint16_t port, double timeout)
+    {
+      beginConnect(addr, port);
+
+      double deadline = Time::Clock::get() + timeout;
+      while (true)
+      {
+        double remaining = deadline - Time::Clock::get();
+        if (remaining < 0.0)
+          remaining = 0.0;
+
+        if (endConnect(remaining))
+          return;
+
+        if (Time::Clock::get() >= deadline)
+        {
+          setBlocking(true);
+          throw ConnectionTimeout();
+        }
+      }
+    }
+
+    void
+    TCPSocket::beginConnect(const Address& addr, uint16_t port)
+    {
+      sockaddr_in ad;
+      ad.sin_family = AF_INET;
+      ad.sin_port = Utils::ByteCopy::toBE(port);
+      ad.sin_addr.s_addr = addr.toInteger();
+
+      setBlocking(false);
+
+      if (::connect(m_handle, (struct sockaddr*)&ad, sizeof(ad)) == 0)
+        return;
+
+#if defined(DUNE_OS_WINDOWS)
+      if (WSAGetLastError() == WSAEWOULDBLOCK)
+        return;
+#else
+      if (errno == EINPROGRESS)
+        return;
+#endif
+
+      setBlocking(true);
+      throw NetworkError(DTR("unable to connect"), getLastErrorMessage());
+    }
+
+    bool
+    TCPSocket::endConnect(double timeout)
+    {
+      fd_set wfd;
+      FD_ZERO(&wfd);
+      FD_SET(m_handle, &wfd);
+      fd_set efd;
+      FD_ZERO(&efd);
+      FD_SET(m_handle, &efd);
+
+      timeval tv = DUNE_TIMEVAL_INIT_SEC_FP(timeout);
+      int rv = select(m_handle + 1, NULL, &wfd, &efd, &tv);
+
+      if (rv == 0)
+        return false;
+
+      if (rv < 0)
+      {
+#if !defined(DUNE_OS_WINDOWS)
+        //! Workaround for when we are interrupted by a signal.
+        if (errno == EINTR)
+          return false;
+#endif
+        throw NetworkError(DTR("unable to connect"), getLastErrorMessage());
+      }
+
+      int err = 0;
+      socklen_t size = sizeof(err);
+      getsockopt(m_handle, SOL_SOCKET, SO_ERROR, (char*)&err, &size);
+
+      setBlocking(true);
+
+      if (err != 0)
+        throw NetworkError(DTR("unable to connect"), System::Error::getMessage(err));
+
+      return true;
+    }
+
     void
     TCPSocket::listen(int backlog)
     {
@@ -252,6 +339,33 @@ namespace DUNE
       return static_cast<size_t>(rv);
     }
 
+    size_t
+    TCPSocket::tryWrite(const uint8_t* bfr, size_t size)
+    {
+      int flags = 0;
+
+#if defined(MSG_NOSIGNAL)
+      flags |= MSG_NOSIGNAL;
+#endif
+
+#if defined(MSG_DONTWAIT)
+      flags |= MSG_DONTWAIT;
+#endif
+
+      ssize_t rv = ::send(m_handle, (char*)bfr, size, flags);
+
+      if (rv < 0)
+      {
+        if (errno == EAGAIN || errno == EWOULDBLOCK)
+          return 0;
+        if (errno == EPIPE)
+          throw ConnectionClosed();
+        throw NetworkError(DTR("error sending data"), getLastErrorMessage());
+      }
+
+      return static_cast<size_t>(rv);
+    }
+
     void
     TCPSocket::doFlushInput(void)
     {
@@ -388,6 +502,21 @@ namespace DUNE
 #endif
     }
 
+    void
+    TCPSocket::setBlocking(bool enabled)
+    {
+#if defined(DUNE_OS_WINDOWS)
+      u_long mode = enabled ? 0 : 1;
+      ioctlsocket(m_handle, FIONBIO, &mode);
+#else
+      int flags = fcntl(m_handle, F_GETFL, 0);
+      if (enabled)
+        fcntl(m_handle, F_SETFL, flags & ~O_NONBLOCK);
+      else
+        fcntl(m_handle, F_SETFL, flags | O_NONBLOCK);
+#endif
+    }
+
     void
     TCPSocket::disableSIGPIPE(void)
     {
@@ -68,6 +68,29 @@ namespace DUNE
       void
       connect(const Address& add, uint16_t port);
 
+      //! Connect to a peer, waiting at most a given amount of time for
+      //! the connection to be established.
+      //! @param[in] add peer address.
+      //! @param[in] port peer port.
+      //! @param[in] timeout timeout in seconds.
+      void
+      connect(const Address& add, uint16_t port, double timeout);
+
+      //! Start a non-blocking connection attempt. The caller shall
+      //! test for completion with endConnect().
+      //! @param[in] add peer address.
+      //! @param[in] port peer port.
+      void
+      beginConnect(const Address& add, uint16_t port);
+
+      //! Test if a connection attempt started with beginConnect()
+      //! completed, waiting at most a given amount of time.
+      //! @param[in] timeout timeout in seconds.
+      //! @return true if the connection is established, false if the
+      //! attempt is still in progress.
+      bool
+      endConnect(double timeout = 0.0);
+
       void
       listen(int backlog);
 
@@ -77,6 +100,15 @@ namespace DUNE
       bool
       writeFile(const char* filename, int64_t off_end, int64_t off_beg = -1);
 
+      //! Write data without ever blocking on flow control: the kernel
+      //! accepts as many bytes as fit in the socket send buffer.
+      //! @param[in] bfr data to write.
+      //! @param[in] size number of bytes to write.
+      //! @return number of bytes accepted, possibly zero when the send
+      //! buffer is full.
+      size_t
+      tryWrite(const uint8_t* bfr, size_t size);
+
       //! Enable/disable keep-alive messages. When enabled connections
       //! are kept active by periodically transmitting messages.
       //! @param[in] enabled true to enable this feature, false to
@@ -141,6 +173,11 @@ namespace DUNE
       void
       disableSIGPIPE(void);
 
+      //! Enable/disable blocking mode.
+      //! @param[in] enabled true for blocking, false for non-blocking.
+      void
+      setBlocking(bool enabled);
+
       void
       createEventHandle(void);
     };
@@ -134,6 +134,112 @@ namespace DUNE
         setup();
       }
 
+      //! Reset TDMA slots weighting the air time by per-node demand.
+      //!
+      //! The frame keeps the same length (slot count times duration)
+      //! but its seconds are redistributed: every node keeps at least
+      //! one second as a micro-slot for acknowledgements, and the
+      //! remaining seconds are split proportionally to the demand
+      //! values using largest remainders. The allocation is a pure
+      //! function of the inputs, so nodes that advertise their queue
+      //! depths (e.g. in periodic reports) and feed the same demand
+      //! vector compute the same schedule without negotiation. A
+      //! demand vector of all zeros degenerates to equal slots.
+      //! @param[in] slot_count total number of slots (nodes).
+      //! @param[in] slot_number slots owned by this node.
+      //! @param[in] duration nominal slot duration in seconds.
+      //! @param[in] demand queued traffic of each node, any unit, one
+      //! entry per slot.
+      void
+      resetWeighted(unsigned slot_count, std::vector<unsigned>& slot_number,
+                    unsigned duration, const std::vector<unsigned>& demand)
+      {
+        setTotalSlots(slot_count);
+        setSlotNumber(slot_number);
+        setDuration(duration);
+
+        m_seconds.clear();
+
+        if (m_slot_count == 0 || m_slot_duration == 0)
+          return;
+
+        unsigned frame = m_slot_count * m_slot_duration;
+        if (frame <= m_slot_count)
+        {
+          // No seconds left after micro-slots; fall back to the
+          // static layout.
+          setup();
+          return;
+        }
+
+        // One micro-slot second per node, the rest split by demand.
+        std::vector<unsigned> alloc(m_slot_count, 1);
+        unsigned spare = frame - m_slot_count;
+
+        unsigned total = 0;
+        for (unsigned i = 0; i < m_slot_count; ++i)
+          total += (i < demand.size()) ? demand[i] : 0;
+
+        if (total == 0)
+        {
+          for (unsigned i = 0; i < m_slot_count; ++i)
+            alloc[i] += spare / m_slot_count;
+          alloc[0] += spare % m_slot_count;
+        }
+        else
+        {
+          // Largest remainder method: floors first, then leftover
+          // seconds to the biggest remainders (ties to lower slot
+          // numbers), keeping the result deterministic.
+          unsigned used = 0;
+          std::vector<unsigned> rem(m_slot_count, 0);
+          for (unsigned i = 0; i < m_slot_count; ++i)
+          {
+            unsigned d = (i < demand.size()) ? demand[i] : 0;
+            alloc[i] += (spare * d) / total;
+            used += (spare * d) / total;
+            rem[i] = (spare * d) % total;
+          }
+
+          for (unsigned left = spare - used; left > 0; --left)
+          {
+            unsigned best = 0;
+            for (unsigned i = 1; i < m_slot_count; ++i)
+            {
+              if (rem[i] > rem[best])
+                best = i;
+            }
+            ++alloc[best];
+            rem[best] = 0;
+          }
+        }
+
+        // Nodes transmit in slot order, each for its allocated run of
+        // seconds; repeat the frame over the minute.
+        std::vector<unsigned> offset(m_slot_count, 0);
+        for (unsigned i = 1; i < m_slot_count; ++i)
+          offset[i] = offset[i - 1] + alloc[i - 1];
+
+        for (unsigned i = 0; i * frame < 60; ++i)
+        {
+          for (unsigned j = 0; j < m_slot_number.size(); ++j)
+          {
+            unsigned slot = m_slot_number[j];
+            if (slot >= m_slot_count)
+              break;
+
+            for (unsigned s = 0; s < alloc[slot]; ++s)
+            {
+              unsigned value = i * frame + offset[slot] + s;
+              if (value >= 60)
+                break;
+
+              m_seconds.insert(value);
+            }
+          }
+        }
+      }
+
     private:
       //! Setup slots.
       void
@@ -207,6 +207,51 @@ namespace DUNE
       return rv;
     }
 
+    unsigned
+    UDPSocket::readMulti(uint8_t* arena, size_t dgram_size, unsigned max_dgrams, size_t* lens, Address* addrs)
+    {
+#if defined(DUNE_SYS_HAS_RECVMMSG)
+      enum { c_max_batch = 64 };
+
+      if (max_dgrams > c_max_batch)
+        max_dgrams = c_max_batch;
+
+      struct mmsghdr hdrs[c_max_batch];
+      struct iovec iovs[c_max_batch];
+      sockaddr_in hosts[c_max_batch];
+
+      std::memset(hdrs, 0, max_dgrams * sizeof(struct mmsghdr));
+
+      for (unsigned i = 0; i < max_dgrams; ++i)
+      {
+        iovs[i].iov_base = arena + i * dgram_size;
+        iovs[i].iov_len = dgram_size;
+        hdrs[i].msg_hdr.msg_iov = &iovs[i];
+        hdrs[i].msg_hdr.msg_iovlen = 1;
+        hdrs[i].msg_hdr.msg_name = &hosts[i];
+        hdrs[i].msg_hdr.msg_namelen = sizeof(hosts[i]);
+      }
+
+      int rv = recvmmsg(m_handle, hdrs, max_dgrams, MSG_DONTWAIT, NULL);
+
+      if (rv <= 0)
+        throw NetworkError(DTR("error receiving data"), DUNE_SOCKET_ERROR);
+
+      for (int i = 0; i < rv; ++i)
+      {
+        lens[i] = hdrs[i].msg_len;
+
+        if (addrs != NULL)
+          addrs[i] = (::sockaddr*)&hosts[i];
+      }
+
+      return rv;
+#else
+      lens[0] = read(arena, dgram_size, addrs);
+      return 1;
+#endif
+    }
+
     size_t
     UDPSocket::write(const uint8_t* buffer, size_t size, const Address& host, uint16_t port)
     {
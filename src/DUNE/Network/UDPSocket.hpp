@@ -97,6 +97,20 @@ namespace DUNE
       size_t
       read(uint8_t* buffer, size_t size, Address* addr = NULL, uint16_t* port = NULL);
 
+      //! Receive several UDP datagrams in a single system call when
+      //! the operating system supports it (recvmmsg), falling back
+      //! to a single datagram otherwise. Datagram i is stored at
+      //! arena + i * dgram_size.
+      //! @param arena destination buffer arena, holding max_dgrams
+      //! slots of dgram_size bytes.
+      //! @param dgram_size size of each arena slot.
+      //! @param max_dgrams maximum number of datagrams to receive.
+      //! @param lens length of each received datagram.
+      //! @param addrs source address of each received datagram.
+      //! @return number of datagrams received.
+      unsigned
+      readMulti(uint8_t* arena, size_t dgram_size, unsigned max_dgrams, size_t* lens, Address* addrs = NULL);
+
     private:
       //! Platform specific handle.
 #if defined(DUNE_OS_WINDOWS)
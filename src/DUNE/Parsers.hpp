@@ -38,8 +38,10 @@ namespace DUNE
 }
 
 #include <DUNE/Parsers/Config.hpp>
+#include <DUNE/Parsers/PD0.hpp>
 #include <DUNE/Parsers/PD4.hpp>
 #include <DUNE/Parsers/NMEAReader.hpp>
+#include <DUNE/Parsers/NMEASentence.hpp>
 #include <DUNE/Parsers/NMEAWriter.hpp>
 #include <DUNE/Parsers/AbstractStringReader.hpp>
 #include <DUNE/Parsers/BasicStringReader.hpp>
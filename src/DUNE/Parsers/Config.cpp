@@ -55,6 +55,55 @@ namespace DUNE
 
     //! Maximum buffer size.
     static const size_t c_max_bfr_size = 1024;
+    //! Binary configuration cache magic number.
+    static const uint32_t c_cache_magic = 0x444e4331;
+    //! Binary configuration cache format version.
+    static const uint16_t c_cache_version = 1;
+
+    //! Write a length-prefixed string to a cache file.
+    //! @param[in] fd file stream.
+    //! @param[in] str string.
+    //! @return true on success, false otherwise.
+    static bool
+    writeCacheString(std::FILE* fd, const std::string& str)
+    {
+      uint32_t len = (uint32_t)str.size();
+
+      if (std::fwrite(&len, sizeof(len), 1, fd) != 1)
+        return false;
+
+      if (len == 0)
+        return true;
+
+      return std::fwrite(str.c_str(), 1, len, fd) == len;
+    }
+
+    //! Read a length-prefixed string from a cache file.
+    //! @param[in] fd file stream.
+    //! @param[out] str string.
+    //! @param[in] file_size total size of the cache file.
+    //! @return true on success, false otherwise.
+    static bool
+    readCacheString(std::FILE* fd, std::string& str, long file_size)
+    {
+      uint32_t len = 0;
+
+      if (std::fread(&len, sizeof(len), 1, fd) != 1)
+        return false;
+
+      // Bound the length against what the file can still hold so a
+      // corrupted prefix cannot trigger a huge allocation.
+      long pos = std::ftell(fd);
+      if (pos < 0 || (long)len > file_size - pos)
+        return false;
+
+      str.resize(len);
+
+      if (len == 0)
+        return true;
+
+      return std::fread(&str[0], 1, len, fd) == len;
+    }
 
     //! Retrieve option and respective value from a line.
     //! @param[in] line line.
@@ -186,6 +235,165 @@ namespace DUNE
       os << *this;
     }
 
+    bool
+    Config::loadCache(const char* fname)
+    {
+      std::FILE* fd = std::fopen(fname, "rb");
+
+      if (fd == 0)
+        return false;
+
+      // Total size, used to bound every length prefix.
+      long file_size = -1;
+      if (std::fseek(fd, 0, SEEK_END) == 0)
+        file_size = std::ftell(fd);
+
+      if (file_size < 0 || std::fseek(fd, 0, SEEK_SET) != 0)
+      {
+        std::fclose(fd);
+        return false;
+      }
+
+      uint32_t magic = 0;
+      uint16_t version = 0;
+      uint32_t file_count = 0;
+      uint32_t section_count = 0;
+      std::vector<std::string> files;
+      Sections data;
+      bool valid = true;
+
+      // A corrupted cache must never take the boot down: any failure,
+      // including an allocation error, falls back to the text
+      // configuration.
+      try
+      {
+        valid = valid && (std::fread(&magic, sizeof(magic), 1, fd) == 1);
+        valid = valid && (magic == c_cache_magic);
+        valid = valid && (std::fread(&version, sizeof(version), 1, fd) == 1);
+        valid = valid && (version == c_cache_version);
+        valid = valid && (std::fread(&file_count, sizeof(file_count), 1, fd) == 1);
+        valid = valid && (file_count > 0);
+
+        // Reject the cache if any source file changed since it was
+        // written.
+        for (uint32_t i = 0; valid && i < file_count; ++i)
+        {
+          std::string file;
+          int64_t mtime = 0;
+          int64_t size = 0;
+
+          valid = valid && readCacheString(fd, file, file_size);
+          valid = valid && (std::fread(&mtime, sizeof(mtime), 1, fd) == 1);
+          valid = valid && (std::fread(&size, sizeof(size), 1, fd) == 1);
+
+          if (valid)
+          {
+            Path path(file);
+            valid = (mtime == (int64_t)path.getLastModifiedTime()) && (size == path.size());
+            files.push_back(file);
+          }
+        }
+
+        valid = valid && (std::fread(&section_count, sizeof(section_count), 1, fd) == 1);
+
+        for (uint32_t i = 0; valid && i < section_count; ++i)
+        {
+          std::string section;
+          uint32_t option_count = 0;
+
+          valid = valid && readCacheString(fd, section, file_size);
+          valid = valid && (std::fread(&option_count, sizeof(option_count), 1, fd) == 1);
+
+          Section& options = data[section];
+
+          for (uint32_t j = 0; valid && j < option_count; ++j)
+          {
+            std::string option;
+            std::string value;
+
+            valid = valid && readCacheString(fd, option, file_size);
+            valid = valid && readCacheString(fd, value, file_size);
+
+            if (valid)
+              options[option] = value;
+          }
+        }
+      }
+      catch (...)
+      {
+        valid = false;
+      }
+
+      std::fclose(fd);
+
+      if (!valid)
+        return false;
+
+      for (Sections::iterator itr = data.begin(); itr != data.end(); ++itr)
+        m_data[itr->first].insert(itr->second.begin(), itr->second.end());
+
+      m_files.insert(m_files.end(), files.begin(), files.end());
+      return true;
+    }
+
+    void
+    Config::saveCache(const char* fname)
+    {
+      // Write to a temporary file and rename: a crash mid-write must
+      // not leave a plausible-looking partial cache behind.
+      std::string tmp = std::string(fname) + ".tmp";
+      std::FILE* fd = std::fopen(tmp.c_str(), "wb");
+
+      if (fd == 0)
+        return;
+
+      uint32_t file_count = (uint32_t)m_files.size();
+      uint32_t section_count = (uint32_t)m_data.size();
+      bool valid = true;
+
+      valid = valid && (std::fwrite(&c_cache_magic, sizeof(c_cache_magic), 1, fd) == 1);
+      valid = valid && (std::fwrite(&c_cache_version, sizeof(c_cache_version), 1, fd) == 1);
+      valid = valid && (std::fwrite(&file_count, sizeof(file_count), 1, fd) == 1);
+
+      for (uint32_t i = 0; valid && i < file_count; ++i)
+      {
+        Path path(m_files[i]);
+        int64_t mtime = (int64_t)path.getLastModifiedTime();
+        int64_t size = path.size();
+
+        valid = valid && writeCacheString(fd, m_files[i]);
+        valid = valid && (std::fwrite(&mtime, sizeof(mtime), 1, fd) == 1);
+        valid = valid && (std::fwrite(&size, sizeof(size), 1, fd) == 1);
+      }
+
+      valid = valid && (std::fwrite(&section_count, sizeof(section_count), 1, fd) == 1);
+
+      Sections::iterator sitr = m_data.begin();
+      for (; valid && sitr != m_data.end(); ++sitr)
+      {
+        uint32_t option_count = (uint32_t)sitr->second.size();
+
+        valid = valid && writeCacheString(fd, sitr->first);
+        valid = valid && (std::fwrite(&option_count, sizeof(option_count), 1, fd) == 1);
+
+        Section::iterator oitr = sitr->second.begin();
+        for (; valid && oitr != sitr->second.end(); ++oitr)
+        {
+          valid = valid && writeCacheString(fd, oitr->first);
+          valid = valid && writeCacheString(fd, oitr->second);
+        }
+      }
+
+      valid = valid && (std::fflush(fd) == 0);
+      std::fclose(fd);
+
+      if (valid)
+        valid = (std::rename(tmp.c_str(), fname) == 0);
+
+      if (!valid)
+        std::remove(tmp.c_str());
+    }
+
     std::vector<std::string>
     Config::sections(void)
     {
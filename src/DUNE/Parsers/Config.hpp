@@ -122,15 +122,19 @@ namespace DUNE
       void
       get(const std::string& sec, const std::string& opt, const std::string& def, Type& var)
       {
-        if (m_data[sec].find(opt) != m_data[sec].end())
+        // Resolve the section and option once: every additional
+        // operator[] repeats the full string keyed tree descent.
+        Section& s = m_data[sec];
+        Section::const_iterator itr = s.find(opt);
+        if (itr != s.end())
         {
-          if (castLexical(m_data[sec][opt], var))
+          if (castLexical(itr->second, var))
             return;
         }
 
         if (castLexical(def, var))
         {
-          m_data[sec][opt] = def;
+          s[opt] = def;
           return;
         }
 
@@ -168,6 +172,25 @@ namespace DUNE
       void
       writeToFile(const char* file);
 
+      //! Load a binary configuration cache previously written by
+      //! saveCache(). The cache records the modification time and
+      //! size of every source file that produced it and is rejected
+      //! when any of them changed, so loading is equivalent to
+      //! re-parsing the sources, minus the INI parsing, include
+      //! resolution and reference expansion work.
+      //! @param fname name of the cache file.
+      //! @return true if the cache was valid and loaded, false if it
+      //! is missing, stale or corrupt.
+      bool
+      loadCache(const char* fname);
+
+      //! Write the current configuration to a binary cache file. The
+      //! cache is only meaningful on the machine that wrote it.
+      //! Failures (e.g. read-only media) are silently ignored.
+      //! @param fname name of the cache file.
+      void
+      saveCache(const char* fname);
+
       //! Retrieve the file option of the parsed configuration file.
       //! @return parsed file option.
       std::vector<std::string>
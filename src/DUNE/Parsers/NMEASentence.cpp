@@ -0,0 +1,229 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstdlib>
+#include <cstring>
+
+// DUNE headers.
+#include <DUNE/Parsers/NMEASentence.hpp>
+
+namespace DUNE
+{
+  namespace Parsers
+  {
+    //! Convert one hexadecimal digit.
+    //! @param[in] byte ASCII digit.
+    //! @return digit value or -1 if 'byte' is not a hexadecimal digit.
+    static int
+    hexDigit(char byte)
+    {
+      if (byte >= '0' && byte <= '9')
+        return byte - '0';
+
+      if (byte >= 'a' && byte <= 'f')
+        return byte - 'a' + 10;
+
+      if (byte >= 'A' && byte <= 'F')
+        return byte - 'A' + 10;
+
+      return -1;
+    }
+
+    NMEASentence::NMEASentence(void):
+      m_field_count(0)
+    {
+      m_bfr[0] = '\0';
+      m_fields[0] = 0;
+    }
+
+    bool
+    NMEASentence::parse(const char* sentence, size_t length)
+    {
+      m_field_count = 0;
+      m_bfr[0] = '\0';
+      m_fields[0] = 0;
+
+      // Trim leading and trailing blanks.
+      while (length > 0 && std::strchr(" \t\r\n", *sentence) != 0)
+      {
+        ++sentence;
+        --length;
+      }
+
+      while (length > 0 && std::strchr(" \t\r\n", sentence[length - 1]) != 0)
+        --length;
+
+      if (length < 2 || length >= c_max_length)
+        return false;
+
+      if (*sentence != '$')
+        return false;
+
+      ++sentence;
+      --length;
+
+      // Copy, compute the checksum and split the fields in one pass.
+      uint8_t ccsum = 0;
+      size_t csum_idx = length;
+      unsigned count = 1;
+      m_fields[0] = 0;
+
+      for (size_t i = 0; i < length; ++i)
+      {
+        char byte = sentence[i];
+        m_bfr[i] = byte;
+
+        if (byte == '*')
+        {
+          csum_idx = i;
+          break;
+        }
+
+        ccsum ^= (uint8_t)byte;
+
+        if (byte == ',')
+        {
+          if (count == c_max_fields)
+            return false;
+
+          m_bfr[i] = '\0';
+          m_fields[count++] = (uint16_t)(i + 1);
+        }
+      }
+
+      if (csum_idx < length)
+      {
+        // Validate the checksum.
+        if (csum_idx + 3 != length)
+          return false;
+
+        int high = hexDigit(sentence[csum_idx + 1]);
+        int low = hexDigit(sentence[csum_idx + 2]);
+
+        if (high < 0 || low < 0)
+          return false;
+
+        if (ccsum != (uint8_t)((high << 4) | low))
+          return false;
+
+        m_bfr[csum_idx] = '\0';
+      }
+      else
+      {
+        m_bfr[length] = '\0';
+      }
+
+      // Reject an empty code.
+      if (m_bfr[0] == '\0')
+        return false;
+
+      m_field_count = count;
+      return true;
+    }
+
+    bool
+    NMEASentence::get(unsigned field, int& value) const
+    {
+      const char* str = getField(field);
+
+      if (*str == '\0')
+        return false;
+
+      char* end = 0;
+      long rv = std::strtol(str, &end, 10);
+
+      if (*end != '\0')
+        return false;
+
+      value = (int)rv;
+      return true;
+    }
+
+    bool
+    NMEASentence::get(unsigned field, unsigned& value) const
+    {
+      const char* str = getField(field);
+
+      if (*str == '\0' || *str == '-')
+        return false;
+
+      char* end = 0;
+      unsigned long rv = std::strtoul(str, &end, 10);
+
+      if (*end != '\0')
+        return false;
+
+      value = (unsigned)rv;
+      return true;
+    }
+
+    bool
+    NMEASentence::get(unsigned field, float& value) const
+    {
+      double tmp = 0;
+
+      if (!get(field, tmp))
+        return false;
+
+      value = (float)tmp;
+      return true;
+    }
+
+    bool
+    NMEASentence::get(unsigned field, double& value) const
+    {
+      const char* str = getField(field);
+
+      if (*str == '\0')
+        return false;
+
+      char* end = 0;
+      double rv = std::strtod(str, &end);
+
+      if (*end != '\0')
+        return false;
+
+      value = rv;
+      return true;
+    }
+
+    bool
+    NMEASentence::get(unsigned field, std::string& value) const
+    {
+      const char* str = getField(field);
+
+      if (*str == '\0')
+        return false;
+
+      value.assign(str);
+      return true;
+    }
+  }
+}
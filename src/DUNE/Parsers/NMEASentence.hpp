@@ -0,0 +1,174 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+#ifndef DUNE_PARSERS_NMEA_SENTENCE_HPP_INCLUDED_
+#define DUNE_PARSERS_NMEA_SENTENCE_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <string>
+#include <cstddef>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+
+namespace DUNE
+{
+  namespace Parsers
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM NMEASentence;
+
+    //! Reusable allocation-free NMEA sentence parser.
+    //!
+    //! Unlike NMEAReader, which extracts fields through a string
+    //! stream and allocates per sentence, this parser copies the
+    //! sentence once into a fixed internal buffer, validates the
+    //! checksum and splits the fields in the same pass, and hands out
+    //! pointers into that buffer. One instance can be reused for an
+    //! entire stream, making it suitable for high-rate sources such
+    //! as AIS receivers.
+    //!
+    //! Malformed sentences are reported by the return value of
+    //! parse() instead of exceptions, so discarding bad traffic is
+    //! cheap. Field pointers are valid until the next call to
+    //! parse().
+    class NMEASentence
+    {
+    public:
+      //! Maximum sentence length in bytes, including the dollar sign
+      //! and checksum. The NMEA standard caps sentences at 82 bytes;
+      //! the extra room accommodates common out-of-spec talkers.
+      static const size_t c_max_length = 128;
+      //! Maximum number of fields, including the sentence code.
+      static const size_t c_max_fields = 64;
+
+      //! Constructor.
+      NMEASentence(void);
+
+      //! Parse one sentence, replacing any previously parsed one.
+      //! @param[in] sentence sentence bytes, leading and trailing
+      //! blanks are ignored.
+      //! @param[in] length number of bytes in 'sentence'.
+      //! @return true if the sentence is well formed and its
+      //! checksum, when present, matches.
+      bool
+      parse(const char* sentence, size_t length);
+
+      //! Parse one sentence, replacing any previously parsed one.
+      //! @param[in] sentence sentence string.
+      //! @return true if the sentence is well formed and its
+      //! checksum, when present, matches.
+      bool
+      parse(const std::string& sentence)
+      {
+        return parse(sentence.c_str(), sentence.size());
+      }
+
+      //! Retrieve the sentence code (first field, without the dollar
+      //! sign).
+      //! @return sentence code.
+      const char*
+      code(void) const
+      {
+        return m_bfr + m_fields[0];
+      }
+
+      //! Retrieve the number of fields, excluding the sentence code.
+      //! @return number of fields.
+      unsigned
+      getFieldCount(void) const
+      {
+        return m_field_count - 1;
+      }
+
+      //! Retrieve a field as a NUL-terminated string. Field numbers
+      //! start at zero, after the sentence code.
+      //! @param[in] field field number.
+      //! @return field contents, empty string when out of range.
+      const char*
+      getField(unsigned field) const
+      {
+        if (field + 1 >= m_field_count)
+          return "";
+
+        return m_bfr + m_fields[field + 1];
+      }
+
+      //! Convert a field to a signed integer.
+      //! @param[in] field field number.
+      //! @param[out] value converted value.
+      //! @return true on success, false if the field is empty, out
+      //! of range or not a number.
+      bool
+      get(unsigned field, int& value) const;
+
+      //! Convert a field to an unsigned integer.
+      //! @param[in] field field number.
+      //! @param[out] value converted value.
+      //! @return true on success, false if the field is empty, out
+      //! of range or not a number.
+      bool
+      get(unsigned field, unsigned& value) const;
+
+      //! Convert a field to a single precision floating point.
+      //! @param[in] field field number.
+      //! @param[out] value converted value.
+      //! @return true on success, false if the field is empty, out
+      //! of range or not a number.
+      bool
+      get(unsigned field, float& value) const;
+
+      //! Convert a field to a double precision floating point.
+      //! @param[in] field field number.
+      //! @param[out] value converted value.
+      //! @return true on success, false if the field is empty, out
+      //! of range or not a number.
+      bool
+      get(unsigned field, double& value) const;
+
+      //! Copy a field to a string.
+      //! @param[in] field field number.
+      //! @param[out] value field contents.
+      //! @return true on success, false if the field is empty or out
+      //! of range.
+      bool
+      get(unsigned field, std::string& value) const;
+
+    private:
+      //! Sentence buffer, fields are NUL-terminated in place.
+      char m_bfr[c_max_length];
+      //! Offset of each field in the buffer.
+      uint16_t m_fields[c_max_fields];
+      //! Number of fields, including the sentence code.
+      unsigned m_field_count;
+    };
+  }
+}
+
+#endif
@@ -27,80 +27,110 @@
 // Author: Ricardo Martins                                                  *
 //***************************************************************************
 
-// ISO C++ 98 headers.
-#include <iomanip>
-
 // DUNE headers.
 #include <DUNE/Parsers/NMEAWriter.hpp>
+#include <DUNE/Utils/String.hpp>
 
 namespace DUNE
 {
   namespace Parsers
   {
+    //! Scratch buffer size, large enough for any formatted field.
+    static const size_t c_field_size = 32;
+
     NMEAWriter::NMEAWriter(const std::string& code)
     {
-      m_stream << '$' << code;
+      m_sentence.reserve(80);
+      m_sentence += '$';
+      m_sentence += code;
+      m_prefix_size = m_sentence.size();
+    }
+
+    void
+    NMEAWriter::clear(void)
+    {
+      m_sentence.resize(m_prefix_size);
     }
 
     NMEAWriter&
     NMEAWriter::operator<<(const bool& value)
     {
-      m_stream << ',' << value;
+      m_sentence += value ? ",1" : ",0";
       return *this;
     }
 
     NMEAWriter&
     NMEAWriter::operator<<(const int& value)
     {
-      m_stream << ',' << value;
+      char bfr[c_field_size];
+      Utils::String::format(bfr, sizeof(bfr), ",%d", value);
+      m_sentence += bfr;
       return *this;
     }
 
     NMEAWriter&
     NMEAWriter::operator<<(const unsigned& value)
     {
-      m_stream << ',' << value;
+      char bfr[c_field_size];
+      Utils::String::format(bfr, sizeof(bfr), ",%u", value);
+      m_sentence += bfr;
       return *this;
     }
 
     NMEAWriter&
     NMEAWriter::operator<<(const double& value)
     {
-      m_stream << ',' << value;
+      char bfr[c_field_size];
+      Utils::String::format(bfr, sizeof(bfr), ",%g", value);
+      m_sentence += bfr;
       return *this;
     }
 
     NMEAWriter&
     NMEAWriter::operator<<(const char* value)
     {
-      m_stream << ',' << value;
+      m_sentence += ',';
+      m_sentence += value;
       return *this;
     }
 
     NMEAWriter&
     NMEAWriter::operator<<(const std::string& value)
     {
-      m_stream << ',' << value;
+      m_sentence += ',';
+      m_sentence += value;
       return *this;
     }
 
     std::string
     NMEAWriter::sentence(void)
     {
-      const std::string& stn = m_stream.str();
+      unsigned char csum = 0;
+      for (unsigned i = 1; i < m_sentence.size(); ++i)
+        csum ^= m_sentence[i];
+
+      char bfr[c_field_size];
+      Utils::String::format(bfr, sizeof(bfr), "*%02X\r\n", (unsigned)csum);
+      return m_sentence + bfr;
+    }
 
+    size_t
+    NMEAWriter::sentence(char* bfr, size_t size)
+    {
       unsigned char csum = 0;
-      for (unsigned i = 1; i < stn.size(); ++i)
-        csum ^= stn[i];
+      for (unsigned i = 1; i < m_sentence.size(); ++i)
+        csum ^= m_sentence[i];
+
+      int rv = Utils::String::format(bfr, size, "%s*%02X\r\n",
+                                     m_sentence.c_str(), (unsigned)csum);
+      if (rv < 0)
+        return 0;
 
-      m_stream << '*'
-      << std::setw(2)
-      << std::setfill('0')
-      << std::uppercase
-      << std::hex
-      << (unsigned)csum << "\r\n";
+      // vsnprintf reports the untruncated length.
+      if ((size_t)rv >= size)
+        return size - 1;
 
-      return m_stream.str();
+      return (size_t)rv;
     }
   }
 }
@@ -32,8 +32,6 @@
 
 // ISO C++ 98 headers.
 #include <string>
-#include <sstream>
-#include <iomanip>
 
 // DUNE headers.
 #include <DUNE/Config.hpp>
@@ -53,6 +51,13 @@ namespace DUNE
       //! @param code sentence type (without the $, eg. GPGGA)
       NMEAWriter(const std::string& code);
 
+      //! Discard all appended fields, keeping the sentence type
+      //! prefix and the buffer capacity. One writer can thus be
+      //! reused for repeated emissions of the same sentence shape
+      //! without composing the prefix or allocating again.
+      void
+      clear(void);
+
       //! Append a boolean to the current sentence.
       //! @param value boolean to be appended.
       //! @return *this.
@@ -95,9 +100,21 @@ namespace DUNE
       std::string
       sentence(void);
 
+      //! Write the NMEA compliant sentence with checksum and line
+      //! termination into a caller supplied buffer, avoiding the
+      //! string allocation of sentence().
+      //! @param bfr destination buffer.
+      //! @param size destination buffer capacity.
+      //! @return number of bytes written, excluding the null
+      //! terminator.
+      size_t
+      sentence(char* bfr, size_t size);
+
     private:
-      //! Internal string stream.
-      std::ostringstream m_stream;
+      //! Sentence under construction.
+      std::string m_sentence;
+      //! Size of the invariant sentence type prefix.
+      size_t m_prefix_size;
     };
   }
 }
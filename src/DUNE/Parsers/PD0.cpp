@@ -0,0 +1,248 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstring>
+
+// DUNE headers.
+#include <DUNE/Parsers/PD0.hpp>
+#include <DUNE/Math/Angles.hpp>
+
+namespace DUNE
+{
+  namespace Parsers
+  {
+    //! Header identification byte.
+    static const uint8_t c_hdr_id = 0x7f;
+    //! Data source identification byte.
+    static const uint8_t c_hdr_src = 0x7f;
+    //! Fixed leader identification word.
+    static const uint16_t c_id_fixed = 0x0000;
+    //! Variable leader identification word.
+    static const uint16_t c_id_variable = 0x0080;
+    //! Velocity data identification word.
+    static const uint16_t c_id_velocity = 0x0100;
+    //! Value of invalid velocity.
+    static const int16_t c_invalid_vel = -32768;
+
+    PD0::PD0(bool use_checksum):
+      m_use_checksum(use_checksum)
+    {
+      clear();
+    }
+
+    void
+    PD0::clear(void)
+    {
+      m_state = ST_NONE;
+      m_idx = 0;
+      m_rcsum = 0;
+      m_ccsum = 0;
+      m_size = 0;
+    }
+
+    bool
+    PD0::parse(uint8_t byte)
+    {
+      switch (m_state)
+      {
+        case ST_NONE:
+          if (byte == c_hdr_id)
+          {
+            clear();
+            m_raw[m_idx++] = byte;
+            m_ccsum = byte;
+            m_state = ST_SOURCE;
+          }
+          break;
+
+        case ST_SOURCE:
+          if (byte == c_hdr_src)
+          {
+            m_raw[m_idx++] = byte;
+            m_ccsum += byte;
+            m_state = ST_SIZE0;
+          }
+          else
+          {
+            m_state = ST_NONE;
+          }
+          break;
+
+        case ST_SIZE0:
+          m_raw[m_idx++] = byte;
+          m_ccsum += byte;
+          m_size = byte;
+          m_state = ST_SIZE1;
+          break;
+
+        case ST_SIZE1:
+          m_raw[m_idx++] = byte;
+          m_ccsum += byte;
+          m_size |= byte << 8;
+
+          // The announced size excludes the two checksum bytes.
+          if (m_size <= m_idx || m_size > sizeof(m_raw))
+            m_state = ST_NONE;
+          else
+            m_state = ST_DATA;
+          break;
+
+        case ST_DATA:
+          m_raw[m_idx++] = byte;
+          m_ccsum += byte;
+          if (m_idx == m_size)
+            m_state = ST_CSUM0;
+          break;
+
+        case ST_CSUM0:
+          m_rcsum = byte;
+          m_state = ST_CSUM1;
+          break;
+
+        case ST_CSUM1:
+          m_rcsum |= byte << 8;
+          m_state = ST_NONE;
+
+          if (!m_use_checksum || m_rcsum == m_ccsum)
+            return decode();
+          break;
+      }
+
+      return false;
+    }
+
+    bool
+    PD0::decode(void)
+    {
+      unsigned types = m_raw[5];
+      if (types == 0 || 6 + 2 * types > m_size)
+        return false;
+
+      std::memset(&m_data, 0, sizeof(m_data));
+
+      // Data types appear in ascending offset order, so the fixed
+      // leader is decoded before the velocity profile that needs its
+      // cell and beam counts.
+      bool has_fixed = false;
+      bool has_velocity = false;
+
+      for (unsigned i = 0; i < types; ++i)
+      {
+        unsigned off = getU16(6 + 2 * i);
+        if (off + 2 > m_size)
+          return false;
+
+        switch (getU16(off))
+        {
+          case c_id_fixed:
+            if (off + 34 > m_size)
+              return false;
+            decodeFixedLeader(off);
+            has_fixed = true;
+            break;
+
+          case c_id_variable:
+            if (off + 28 > m_size)
+              return false;
+            decodeVariableLeader(off);
+            break;
+
+          case c_id_velocity:
+            if (!has_fixed || !decodeVelocity(off))
+              return false;
+            has_velocity = true;
+            break;
+
+          default:
+            // Correlation, echo intensity, percent good and other
+            // data types are not decoded.
+            break;
+        }
+      }
+
+      return has_fixed && has_velocity;
+    }
+
+    void
+    PD0::decodeFixedLeader(unsigned off)
+    {
+      m_data.n_beams = m_raw[off + 8];
+      if (m_data.n_beams > c_max_beams)
+        m_data.n_beams = c_max_beams;
+
+      m_data.n_cells = m_raw[off + 9];
+      if (m_data.n_cells > c_max_cells)
+        m_data.n_cells = c_max_cells;
+
+      m_data.cell_length = getU16(off + 12) * 0.01;
+      m_data.bin1_dist = getU16(off + 32) * 0.01;
+    }
+
+    void
+    PD0::decodeVariableLeader(unsigned off)
+    {
+      m_data.ensemble = getU16(off + 2);
+      m_data.sound_speed = getU16(off + 14);
+      m_data.depth = getU16(off + 16) * 0.1;
+      m_data.heading = Math::Angles::radians(getU16(off + 18) * 0.01);
+      m_data.pitch = Math::Angles::radians(getS16(off + 20) * 0.01);
+      m_data.roll = Math::Angles::radians(getS16(off + 22) * 0.01);
+      m_data.salinity = getU16(off + 24);
+      m_data.temperature = getS16(off + 26) * 0.01;
+    }
+
+    bool
+    PD0::decodeVelocity(unsigned off)
+    {
+      unsigned cells = m_data.n_cells;
+      unsigned beams = m_data.n_beams;
+
+      if (off + 2 + 2 * cells * beams > m_size)
+        return false;
+
+      unsigned idx = off + 2;
+      for (unsigned cell = 0; cell < cells; ++cell)
+      {
+        m_data.vel_validity[cell] = 0;
+        for (unsigned beam = 0; beam < beams; ++beam, idx += 2)
+        {
+          int16_t vel = getS16(idx);
+          if (vel != c_invalid_vel)
+          {
+            m_data.vel[cell][beam] = vel * 0.001;
+            m_data.vel_validity[cell] |= 1 << beam;
+          }
+        }
+      }
+
+      return true;
+    }
+  }
+}
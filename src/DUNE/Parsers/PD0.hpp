@@ -0,0 +1,181 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+#ifndef DUNE_PARSERS_PD0_HPP_INCLUDED_
+#define DUNE_PARSERS_PD0_HPP_INCLUDED_
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+
+namespace DUNE
+{
+  namespace Parsers
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM PD0;
+
+    //! Parser for the Teledyne RDI PD0 ensemble format, used for
+    //! water-profiling mode. Ensembles are validated (header, size
+    //! and checksum) while being collected byte by byte and decoded
+    //! in a single pass into a plain data structure. Bottom-track
+    //! only deployments should use the smaller PD4 format.
+    class PD0
+    {
+    public:
+      //! Maximum number of depth cells decoded per ensemble.
+      static const unsigned c_max_cells = 128;
+      //! Maximum number of beams decoded per cell.
+      static const unsigned c_max_beams = 4;
+
+      struct Data
+      {
+        //! Ensemble number.
+        unsigned ensemble;
+        //! Number of beams.
+        uint8_t n_beams;
+        //! Number of depth cells.
+        uint8_t n_cells;
+        //! Depth cell length in m.
+        float cell_length;
+        //! Distance to the middle of the first cell in m.
+        float bin1_dist;
+        //! Speed of sound in m/s.
+        float sound_speed;
+        //! Transducer depth in m.
+        float depth;
+        //! Heading in radians.
+        float heading;
+        //! Pitch in radians.
+        float pitch;
+        //! Roll in radians.
+        float roll;
+        //! Salinity in ppt.
+        float salinity;
+        //! Temperature in Celsius degrees.
+        float temperature;
+        //! Cell velocities in m/s (beam or earth frame as configured).
+        double vel[c_max_cells][c_max_beams];
+        //! Validity of cell velocities (one bit per beam).
+        uint8_t vel_validity[c_max_cells];
+      };
+
+      //! Default constructor.
+      PD0(bool use_checksum = true);
+
+      //! Parse one byte of data.
+      //! @param byte byte to parse.
+      //! @return true if data is available, false otherwise.
+      bool
+      parse(uint8_t byte);
+
+      //! Retrieve data. This function should be called when parse()
+      //! returns true.
+      //! @return data.
+      const Data*
+      data(void)
+      {
+        return &m_data;
+      }
+
+    private:
+      enum States
+      {
+        ST_NONE,
+        ST_SOURCE,
+        ST_SIZE0,
+        ST_SIZE1,
+        ST_DATA,
+        ST_CSUM0,
+        ST_CSUM1
+      };
+
+      //! Decode a collected ensemble.
+      //! @return true if the ensemble is valid, false otherwise.
+      bool
+      decode(void);
+
+      //! Decode the fixed leader.
+      //! @param off offset of the fixed leader.
+      void
+      decodeFixedLeader(unsigned off);
+
+      //! Decode the variable leader.
+      //! @param off offset of the variable leader.
+      void
+      decodeVariableLeader(unsigned off);
+
+      //! Decode the velocity profile.
+      //! @param off offset of the velocity data.
+      //! @return true if the block fits the ensemble, false otherwise.
+      bool
+      decodeVelocity(unsigned off);
+
+      //! Read a little-endian unsigned 16 bit integer.
+      //! @param off offset of the value.
+      //! @return value.
+      uint16_t
+      getU16(unsigned off) const
+      {
+        return (uint16_t)(m_raw[off] | (m_raw[off + 1] << 8));
+      }
+
+      //! Read a little-endian signed 16 bit integer.
+      //! @param off offset of the value.
+      //! @return value.
+      int16_t
+      getS16(unsigned off) const
+      {
+        return (int16_t)getU16(off);
+      }
+
+      //! Clear current state.
+      void
+      clear(void);
+
+      //! Raw ensemble (header included, checksum excluded).
+      uint8_t m_raw[2048];
+      //! Raw data index.
+      unsigned m_idx;
+      //! Received checksum.
+      uint16_t m_rcsum;
+      //! Computed checksum.
+      uint16_t m_ccsum;
+      //! Number of bytes in the ensemble (checksum excluded).
+      unsigned m_size;
+      //! Current parser state.
+      States m_state;
+      //! Parsed data.
+      Data m_data;
+      //! Use checksum.
+      bool m_use_checksum;
+    };
+  }
+}
+
+#endif
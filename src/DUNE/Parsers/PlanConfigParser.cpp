@@ -40,13 +40,13 @@ namespace DUNE
   namespace Parsers
   {
     void
-    PlanConfigParser::parse(Parsers::Config& cfg, std::string id, IMC::IdleManeuver& man)
+    PlanConfigParser::parse(Parsers::Config& cfg, const std::string& id, IMC::IdleManeuver& man)
     {
       parseDuration(cfg, id, man);
     }
 
     void
-    PlanConfigParser::parse(Parsers::Config& cfg, std::string id, IMC::PopUp& man)
+    PlanConfigParser::parse(Parsers::Config& cfg, const std::string& id, IMC::PopUp& man)
     {
       parseCoordinate(cfg, id, man);
       parseSpeed(cfg, id, man);
@@ -59,7 +59,7 @@ namespace DUNE
     }
 
     void
-    PlanConfigParser::parse(Parsers::Config& cfg, std::string id, IMC::Goto& man)
+    PlanConfigParser::parse(Parsers::Config& cfg, const std::string& id, IMC::Goto& man)
     {
       // Get configurable parameters
       parseCoordinate(cfg, id, man);
@@ -70,7 +70,7 @@ namespace DUNE
     }
 
     void
-    PlanConfigParser::parse(Parsers::Config& cfg, std::string id, IMC::StationKeeping& man)
+    PlanConfigParser::parse(Parsers::Config& cfg, const std::string& id, IMC::StationKeeping& man)
     {
       // Get configurable parameters
       parseCoordinate(cfg, id, man);
@@ -82,7 +82,7 @@ namespace DUNE
     }
 
     void
-    PlanConfigParser::parse(Parsers::Config& cfg, std::string id, IMC::Loiter& man)
+    PlanConfigParser::parse(Parsers::Config& cfg, const std::string& id, IMC::Loiter& man)
     {
       // Get configurable parameters
       parseCoordinate(cfg, id, man);
@@ -122,7 +122,7 @@ namespace DUNE
     }
 
     void
-    PlanConfigParser::parse(Parsers::Config& cfg, std::string id, IMC::FollowPath& man)
+    PlanConfigParser::parse(Parsers::Config& cfg, const std::string& id, IMC::FollowPath& man)
     {
       // Get configurable parameters
       parseCoordinate(cfg, id, man);
@@ -143,17 +143,17 @@ namespace DUNE
 
       for (int i = 0; i < W.rows(); ++i)
       {
-        IMC::PathPoint* p = new IMC::PathPoint;
-        p->x = W(i, 0);
-        p->y = W(i, 1);
-        p->z = W(i, 2);
+        IMC::PathPoint p;
+        p.x = W(i, 0);
+        p.y = W(i, 1);
+        p.z = W(i, 2);
 
-        list->push_back(*p);
+        list->push_back(p);
       }
     }
 
     void
-    PlanConfigParser::parse(Parsers::Config& cfg, std::string id, IMC::Rows& man)
+    PlanConfigParser::parse(Parsers::Config& cfg, const std::string& id, IMC::Rows& man)
     {
       // Get configurable parameters
       parseCoordinate(cfg, id, man);
@@ -171,13 +171,13 @@ namespace DUNE
     }
 
     void
-    PlanConfigParser::parse(Parsers::Config& cfg, std::string id, IMC::Teleoperation& man)
+    PlanConfigParser::parse(Parsers::Config& cfg, const std::string& id, IMC::Teleoperation& man)
     {
       cfg.get(id, "Custom Settings", "", man.custom);
     }
 
     void
-    PlanConfigParser::parse(Parsers::Config& cfg, std::string section, IMC::YoYo& man)
+    PlanConfigParser::parse(Parsers::Config& cfg, const std::string& section, IMC::YoYo& man)
     {
       parseCoordinate(cfg, section, man);
       parseZ(cfg, section, man);
@@ -188,7 +188,7 @@ namespace DUNE
     }
 
     void
-    PlanConfigParser::parse(Parsers::Config& cfg, std::string section, IMC::Elevator& man)
+    PlanConfigParser::parse(Parsers::Config& cfg, const std::string& section, IMC::Elevator& man)
     {
       parseSpeed(cfg, section, man);
       parseCoordinate(cfg, section, man);
@@ -201,7 +201,7 @@ namespace DUNE
     }
 
     void
-    PlanConfigParser::parse(Parsers::Config& cfg, std::string id, IMC::CompassCalibration& man)
+    PlanConfigParser::parse(Parsers::Config& cfg, const std::string& id, IMC::CompassCalibration& man)
     {
       // Get configurable parameters
       parseCoordinate(cfg, id, man);
@@ -244,7 +244,7 @@ namespace DUNE
 
       for (unsigned i = 0; i < ids.size(); i++)
       {
-        std::string id = ids[i];
+        const std::string& id = ids[i];
 
         IMC::PlanManeuver pman;
         pman.maneuver_id = id;
@@ -294,7 +294,6 @@ namespace DUNE
           IMC::Rows r;
           parse(cfg, id, r);
           pman.data.set(r);
-          r.toText(std::cerr);
         }
         else if (type == "YoYo")
         {
@@ -307,7 +306,6 @@ namespace DUNE
           IMC::Elevator elev;
           parse(cfg, id, elev);
           pman.data.set(elev);
-          elev.toText(std::cerr);
         }
         else if (type == "CompassCalibration")
         {
@@ -55,7 +55,7 @@ namespace DUNE
       //! @param[in] section section that contains the maneuver specification.
       //! @param[out] maneuver output maneuver specification.
       static void
-      parse(Parsers::Config& parser, std::string section, IMC::Goto& maneuver);
+      parse(Parsers::Config& parser, const std::string& section, IMC::Goto& maneuver);
 #endif
 #ifdef DUNE_IMC_STATIONKEEPING
       //! Parse a StationKeeping maneuver specification from plan definition file.
@@ -63,7 +63,7 @@ namespace DUNE
       //! @param[in] section section that contains the maneuver specification.
       //! @param[out] maneuver output maneuver specification.
       static void
-      parse(Parsers::Config& parser, std::string section, IMC::StationKeeping& maneuver);
+      parse(Parsers::Config& parser, const std::string& section, IMC::StationKeeping& maneuver);
 #endif
 #ifdef DUNE_IMC_LOITER
       //! Parse a Loiter maneuver specification from plan definition file.
@@ -71,7 +71,7 @@ namespace DUNE
       //! @param[in] section section that contains the maneuver specification.
       //! @param[out] maneuver output maneuver specification.
       static void
-      parse(Parsers::Config& parser, std::string section, IMC::Loiter& maneuver);
+      parse(Parsers::Config& parser, const std::string& section, IMC::Loiter& maneuver);
 #endif
 #ifdef DUNE_IMC_POPUP
       //! Parse a Popup maneuver specification from plan definition file.
@@ -79,7 +79,7 @@ namespace DUNE
       //! @param[in] section section that contains the maneuver specification.
       //! @param[out] maneuver output maneuver specification.
       static void
-      parse(Parsers::Config& parser, std::string section, IMC::PopUp& maneuver);
+      parse(Parsers::Config& parser, const std::string& section, IMC::PopUp& maneuver);
 #endif
 #ifdef DUNE_IMC_TELEOPERATION
       //! Parse a Teleoperation maneuver specification from plan
@@ -88,7 +88,7 @@ namespace DUNE
       //! @param[in] section section that contains the maneuver specification.
       //! @param[out] maneuver output maneuver specification.
       static void
-      parse(Parsers::Config& parser, std::string section, IMC::Teleoperation& maneuver);
+      parse(Parsers::Config& parser, const std::string& section, IMC::Teleoperation& maneuver);
 #endif
 #ifdef DUNE_IMC_IDLEMANEUVER
       //! Parse an Idle Maneuver specification.
@@ -96,7 +96,7 @@ namespace DUNE
       //! @param[in] section  section that contains the maneuver specification.
       //! @param[out] maneuver output maneuver.
       static void
-      parse(Parsers::Config& parser, std::string section, IMC::IdleManeuver& maneuver);
+      parse(Parsers::Config& parser, const std::string& section, IMC::IdleManeuver& maneuver);
 #endif
 #ifdef DUNE_IMC_FOLLOWPATH
       //! Parse a FollowPath specification.
@@ -104,7 +104,7 @@ namespace DUNE
       //! @param[in] section  section that contains the maneuver specification.
       //! @param[out] maneuver output maneuver.
       static void
-      parse(Parsers::Config& parser, std::string section, IMC::FollowPath& maneuver);
+      parse(Parsers::Config& parser, const std::string& section, IMC::FollowPath& maneuver);
 #endif
 
 #ifdef DUNE_IMC_ROWS
@@ -113,7 +113,7 @@ namespace DUNE
       //! @param[in] section  section that contains the maneuver specification.
       //! @param[out] maneuver output maneuver.
       static void
-      parse(Parsers::Config& parser, std::string section, IMC::Rows& maneuver);
+      parse(Parsers::Config& parser, const std::string& section, IMC::Rows& maneuver);
 #endif
 
 #ifdef DUNE_IMC_LBLBEACONSETUP
@@ -122,7 +122,7 @@ namespace DUNE
       //! @param[in] section section that contains the beacon setup.
       //! @param[out] lbl_bs output LBL beacon setup.
       static void
-      parse(Parsers::Config& parser, std::string section, IMC::LblBeaconSetup& lbl_bs);
+      parse(Parsers::Config& parser, const std::string& section, IMC::LblBeaconSetup& lbl_bs);
 #endif
 
 #ifdef DUNE_IMC_YOYO
@@ -131,7 +131,7 @@ namespace DUNE
       //! @param[in] section section that contais the maneuver specification
       //! @param[out] maneuver output maneuver.
       static void
-      parse(Parsers::Config& parser, std::string section, IMC::YoYo& maneuver);
+      parse(Parsers::Config& parser, const std::string& section, IMC::YoYo& maneuver);
 #endif
 
 #ifdef DUNE_IMC_ELEVATOR
@@ -140,7 +140,7 @@ namespace DUNE
       //! @param[in] section section that contains the maneuver specification.
       //! @param[out] maneuver output maneuver.
       static void
-      parse(Parsers::Config& parser, std::string section, IMC::Elevator& maneuver);
+      parse(Parsers::Config& parser, const std::string& section, IMC::Elevator& maneuver);
 #endif
 
 #ifdef DUNE_IMC_DUBIN
@@ -149,7 +149,7 @@ namespace DUNE
       //! @param[in] section section that contains the maneuver specification.
       //! @param[out] maneuver output maneuver specification.
       static void
-      parse(Parsers::Config& parser, std::string section, IMC::Dubin& maneuver);
+      parse(Parsers::Config& parser, const std::string& section, IMC::Dubin& maneuver);
 #endif
 
 #ifdef DUNE_IMC_COMPASSCALIBRATION
@@ -158,7 +158,7 @@ namespace DUNE
       //! @param[in] section section that contains the maneuver specification.
       //! @param[out] maneuver output maneuver specification.
       static void
-      parse(Parsers::Config& parser, std::string section, IMC::CompassCalibration& maneuver);
+      parse(Parsers::Config& parser, const std::string& section, IMC::CompassCalibration& maneuver);
 #endif
 
       //! Parse plan parameters (utility text format).
@@ -181,7 +181,7 @@ namespace DUNE
       //! @param[out] man destination maneuver.
       template <typename T>
       static void
-      parseSpeed(Parsers::Config& parser, std::string section, T& man)
+      parseSpeed(Parsers::Config& parser, const std::string& section, T& man)
       {
         std::string u;
         parser.get(section, "Speed", "100.0", man.speed);
@@ -200,7 +200,7 @@ namespace DUNE
       //! @param[out] msg destination message.
       template <typename T>
       inline static void
-      parseCoordinate(Parsers::Config& parser, std::string section, T& msg)
+      parseCoordinate(Parsers::Config& parser, const std::string& section, T& msg)
       {
         std::string ref;
 
@@ -225,7 +225,7 @@ namespace DUNE
       //! @param[in] dfl default value.
       template <typename T>
       inline static void
-      parseAngle(Parsers::Config& parser, std::string section, std::string key, T& value, T dfl)
+      parseAngle(Parsers::Config& parser, const std::string& section, const std::string& key, T& value, T dfl)
       {
         parser.get(section, key, DUNE::uncastLexical(dfl), value);
         value = Math::Angles::radians(value);
@@ -237,7 +237,7 @@ namespace DUNE
       //! @param[out] man destination maneuver.
       template <typename T>
       inline static void
-      parseTimeout(Parsers::Config& parser, std::string section, T& man)
+      parseTimeout(Parsers::Config& parser, const std::string& section, T& man)
       {
         parser.get(section, "Timeout (seconds)", "0", man.timeout);
       }
@@ -248,7 +248,7 @@ namespace DUNE
       //! @param[out] man destination maneuver.
       template <typename T>
       inline static void
-      parseDuration(Parsers::Config& parser, std::string section, T& man)
+      parseDuration(Parsers::Config& parser, const std::string& section, T& man)
       {
         parser.get(section, "Duration (seconds)", "0", man.duration);
       }
@@ -259,7 +259,7 @@ namespace DUNE
       //! @param[out] man destination maneuver.
       template <typename T>
       inline static void
-      parseZ(Parsers::Config& parser, std::string section, T& man)
+      parseZ(Parsers::Config& parser, const std::string& section, T& man)
       {
         parser.get(section, "Z (meters)", "1.0", man.z);
       }
@@ -270,7 +270,7 @@ namespace DUNE
       //! @param[out] zunits destination variable.
       //! @param[in] label label.
       inline static void
-      parseZUnits(Parsers::Config& parser, std::string section, uint8_t& zunits, std::string label = "Z Units")
+      parseZUnits(Parsers::Config& parser, const std::string& section, uint8_t& zunits, const std::string& label = "Z Units")
       {
         std::string z_str;
         parser.get(section, label, "DEPTH", z_str);
@@ -294,7 +294,7 @@ namespace DUNE
       //! @param[in] label label.
       template <typename Type>
       inline static void
-      parseZUnits(Parsers::Config& parser, std::string section, Type& man, std::string label = "Z Units")
+      parseZUnits(Parsers::Config& parser, const std::string& section, Type& man, const std::string& label = "Z Units")
       {
         parseZUnits(parser, section, man.z_units, label);
       }
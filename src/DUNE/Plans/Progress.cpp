@@ -27,6 +27,9 @@
 // Author: Pedro Calado                                                     *
 //***************************************************************************
 
+// ISO C++ 98 headers.
+#include <cctype>
+
 // DUNE headers.
 #include <DUNE/Plans/Progress.hpp>
 
@@ -39,27 +42,49 @@ namespace DUNE
     bool
     Progress::getPoint(const IMC::ManeuverControlState* mcs, unsigned& number)
     {
-      std::vector<std::vector<std::string> > lstElems;
-      Utils::String::splitMulti(mcs->info, ";", "=", lstElems);
-
-      if (!lstElems.size())
-        return false;
+      // Scan the "key=value;" pairs in place: this function runs once
+      // per second for the whole duration of a plan, so avoid the
+      // allocations of a full string split.
+      const std::string& info = mcs->info;
+      size_t tok = 0;
 
-      std::vector<std::vector<std::string> >::iterator itr = lstElems.begin();
-      for (; itr != lstElems.end(); ++itr)
+      while (tok < info.size())
       {
-        if (!itr->size() || itr->size() < 2 || itr->front() == "" || itr->back() == "")
-          continue;
+        size_t end = info.find(';', tok);
+        if (end == std::string::npos)
+          end = info.size();
 
-        std::string name = itr->front().c_str();
-        name = Utils::String::trim(name);
-        Utils::String::toLowerCase(name);
-
-        if (c_waypoint_str == name)
+        size_t eq = info.find('=', tok);
+        if (eq != std::string::npos && eq < end)
         {
-          number = std::atoi(itr->back().c_str());
-          return true;
+          size_t key_beg = tok;
+          while (key_beg < eq && std::isspace(info[key_beg]))
+            ++key_beg;
+
+          size_t key_end = eq;
+          while (key_end > key_beg && std::isspace(info[key_end - 1]))
+            --key_end;
+
+          size_t val_beg = eq + 1;
+          while (val_beg < end && std::isspace(info[val_beg]))
+            ++val_beg;
+
+          if (key_end - key_beg == c_waypoint_str.size() && val_beg < end)
+          {
+            size_t i = 0;
+            for (; i < c_waypoint_str.size(); ++i)
+              if (std::tolower(info[key_beg + i]) != c_waypoint_str[i])
+                break;
+
+            if (i == c_waypoint_str.size())
+            {
+              number = std::atoi(info.c_str() + val_beg);
+              return true;
+            }
+          }
         }
+
+        tok = end + 1;
       }
 
       return false;
@@ -74,7 +99,7 @@ namespace DUNE
       if (!getPoint(mcs, curr))
         return -1.0;
 
-      if (curr > durations.size())
+      if (curr >= durations.size())
         return -1.0;
 
       return total_duration - durations[curr] + (float)mcs->eta;
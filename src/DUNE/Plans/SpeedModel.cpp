@@ -51,6 +51,8 @@ namespace DUNE
 
       config->get(sec, "Maximum Absolute Speed",
                   "1.6", m_max_speed);
+
+      compile();
     }
 
     SpeedModel::SpeedModel(const std::vector<float>& act,
@@ -60,10 +62,49 @@ namespace DUNE
                            float max_speed)
     {
       m_models[IMC::SUNITS_PERCENTAGE] = act;
-      m_models[IMC::SUNITS_METERS_PS] = rpm;
-      m_models[IMC::SUNITS_RPM] = mps;
+      m_models[IMC::SUNITS_RPM] = rpm;
+      m_models[IMC::SUNITS_METERS_PS] = mps;
       m_time_factor = time_factor;
       m_max_speed = max_speed;
+
+      compile();
+    }
+
+    void
+    SpeedModel::compile(void)
+    {
+      m_compiled = false;
+
+      size_t size = m_models[0].size();
+      if (size < 2 || m_models[1].size() != size || m_models[2].size() != size)
+        return;
+
+      for (unsigned from = 0; from < 3; ++from)
+      {
+        // Model vectors are in ascending order (see piecewiseLI).
+        const std::vector<float>& dom = m_models[from];
+        float min = dom.front();
+        float step = (dom.back() - min) / c_lut_size;
+
+        if (step <= 0.0f)
+          return;
+
+        for (unsigned to = 0; to < 3; ++to)
+        {
+          if (from == to)
+            continue;
+
+          Table& tab = m_lut[from][to];
+          tab.min = min;
+          tab.inv_step = 1.0f / step;
+          tab.samples.resize(c_lut_size + 1);
+
+          for (unsigned i = 0; i <= c_lut_size; ++i)
+            tab.samples[i] = Math::piecewiseLI(m_models[to], dom, min + i * step);
+        }
+      }
+
+      m_compiled = true;
     }
 
     float
@@ -121,7 +162,23 @@ namespace DUNE
             if (from == to)
               return value;
 
-            return Math::piecewiseLI(m_models[to] , m_models[from], value);
+            if (!m_compiled)
+              return Math::piecewiseLI(m_models[to], m_models[from], value);
+
+            // Constant-time table lookup. Out of range values are
+            // extrapolated with the slope of the boundary cell, as
+            // piecewiseLI does with the boundary segment.
+            const Table& tab = m_lut[from][to];
+            float pos = (value - tab.min) * tab.inv_step;
+            int cell = (int)std::floor(pos);
+
+            if (cell < 0)
+              cell = 0;
+            else if (cell >= (int)c_lut_size)
+              cell = c_lut_size - 1;
+
+            float frac = pos - cell;
+            return tab.samples[cell] + frac * (tab.samples[cell + 1] - tab.samples[cell]);
           }
         default:
           return -1.0;
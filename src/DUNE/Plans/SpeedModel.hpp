@@ -100,6 +100,20 @@ namespace DUNE
       }
 
     private:
+      //! Number of cells in each compiled lookup table.
+      static const unsigned c_lut_size = 128;
+
+      //! Compiled conversion table between two units.
+      struct Table
+      {
+        //! Lower bound of the source domain.
+        float min;
+        //! Inverse of the cell width.
+        float inv_step;
+        //! Sampled conversion values (c_lut_size + 1 entries).
+        std::vector<float> samples;
+      };
+
       //! Convert from any unit to any other unit
       //! @param[in] value speed value from which to convert
       //! @param[in] from speed units of the given value
@@ -107,8 +121,19 @@ namespace DUNE
       float
       convert(float value, uint8_t from, uint8_t to) const;
 
+      //! Compile the configured model vectors into dense lookup
+      //! tables so conversions are constant-time at run time. If the
+      //! model is invalid nothing is compiled and conversions fall
+      //! back to interpolation over the raw vectors.
+      void
+      compile(void);
+
       //! Vector of values for each axis.
       std::vector<float> m_models[3];
+      //! Compiled lookup tables, indexed by source and target unit.
+      Table m_lut[3][3];
+      //! True if the lookup tables are compiled.
+      bool m_compiled;
       //! Time of arrival factor.
       float m_time_factor;
       //! Maximum vehicle speed.
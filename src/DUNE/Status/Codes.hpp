@@ -107,7 +107,9 @@ namespace DUNE
       //! Connecting.
       CODE_CONNECTING = 31,
       //! Connected.
-      CODE_CONNECTED = 32
+      CODE_CONNECTED = 32,
+      //! Memory usage is too high.
+      CODE_MEM_TOO_HIGH = 33
     };
   }
 }
@@ -29,6 +29,9 @@
 // Automatically generated.                                                 *
 //***************************************************************************
 
+// ISO C++ 98 headers.
+#include <string>
+
 // DUNE headers.
 #include <DUNE/Config.hpp>
 #include <DUNE/Status/Messages.hpp>
@@ -37,7 +40,7 @@ namespace DUNE
 {
   namespace Status
   {
-    static const char* c_status_messages[33] =
+    static const char* c_status_messages[34] =
     {
       DTR_RT("initializing"),
       DTR_RT("idle"),
@@ -71,13 +74,34 @@ namespace DUNE
       DTR_RT("active (no medium data: need user input)"),
       DTR_RT("idle (no medium data: need user input)"),
       DTR_RT("connecting"),
-      DTR_RT("connected")
+      DTR_RT("connected"),
+      DTR_RT("memory usage is too high")
     };
 
+    // Translated messages, interned on first use.
+    static std::string c_translated_messages[34];
+    static bool c_translated_ready = false;
+
     const char*
     getString(Code code)
     {
       return c_status_messages[code];
     }
+
+    const std::string&
+    getTranslatedString(Code code)
+    {
+      if (!c_translated_ready)
+      {
+        for (unsigned i = 0; i < 34; ++i)
+        {
+          c_translated_messages[i] = DTR(c_status_messages[i]);
+        }
+
+        c_translated_ready = true;
+      }
+
+      return c_translated_messages[code];
+    }
   }
 }
@@ -30,6 +30,9 @@
 #ifndef DUNE_STATUS_MESSAGES_HPP_INCLUDED_
 #define DUNE_STATUS_MESSAGES_HPP_INCLUDED_
 
+// ISO C++ 98 headers.
+#include <string>
+
 // DUNE headers.
 #include <DUNE/Status/Codes.hpp>
 
@@ -39,6 +42,15 @@ namespace DUNE
   {
     const char*
     getString(Code code);
+
+    //! Retrieve the translated message of a status code. The
+    //! translations of all codes are resolved once and interned on
+    //! the first call, so later calls perform no locale lookup and
+    //! are cheap enough for high-rate state emission paths.
+    //! @param[in] code status code.
+    //! @return translated message.
+    const std::string&
+    getTranslatedString(Code code);
   }
 }
 
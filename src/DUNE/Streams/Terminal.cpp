@@ -35,6 +35,8 @@
 // DUNE headers.
 #include <DUNE/Streams/Terminal.hpp>
 #include <DUNE/Concurrency/ScopedMutex.hpp>
+#include <DUNE/Concurrency/Thread.hpp>
+#include <DUNE/Concurrency/TSQueue.hpp>
 
 namespace DUNE
 {
@@ -43,6 +45,62 @@ namespace DUNE
     Terminal dune_term;
     Terminal::Flusher dune_term_flush;
 
+    //! Background writer of complete messages. The queue decouples
+    //! callers from the latency of the output streams.
+    class Terminal::Writer: public Concurrency::Thread
+    {
+    public:
+      Writer(Terminal& term):
+        m_term(term)
+      { }
+
+      ~Writer(void)
+      {
+        drain();
+      }
+
+      //! Queue one complete message for writing, ownership is
+      //! transferred.
+      //! @param[in] line message to write.
+      void
+      enqueue(std::string* line)
+      {
+        m_queue.push(line);
+      }
+
+    private:
+      //! Terminal.
+      Terminal& m_term;
+      //! Queue of pending messages.
+      Concurrency::TSQueue<std::string*> m_queue;
+
+      void
+      drain(void)
+      {
+        while (!m_queue.empty())
+        {
+          std::string* line = m_queue.pop();
+          if (line == NULL)
+            continue;
+
+          m_term.writeLine(*line);
+          delete line;
+        }
+      }
+
+      void
+      run(void)
+      {
+        while (!isStopping())
+        {
+          if (m_queue.waitForItems(1.0))
+            drain();
+        }
+
+        drain();
+      }
+    };
+
     void
     Terminal::open(const std::string& fname)
     {
@@ -62,6 +120,23 @@ namespace DUNE
     void
     Terminal::close(void)
     {
+      Writer* writer = NULL;
+
+      {
+        Concurrency::ScopedMutex l(m_mutex);
+        m_async = false;
+        writer = m_writer;
+        m_writer = NULL;
+      }
+
+      // Stop the writer outside the lock: its final drain locks the
+      // mutex to write pending messages.
+      if (writer != NULL)
+      {
+        writer->stopAndJoin();
+        delete writer;
+      }
+
       Concurrency::ScopedMutex l(m_mutex);
       if (m_out != NULL)
       {
@@ -71,11 +146,28 @@ namespace DUNE
       }
     }
 
+    void
+    Terminal::setAsynchronous(bool enable)
+    {
+      Concurrency::ScopedMutex l(m_mutex);
+
+      if (enable && m_writer == NULL)
+      {
+        m_writer = new Writer(*this);
+        m_writer->start();
+      }
+
+      m_async = enable;
+    }
+
     Terminal&
     Terminal::lock(const char* str)
     {
       m_mutex.lock();
 
+      if (m_async)
+        return *this;
+
 #if defined(DUNE_OS_POSIX)
       std::cerr << str;
 #else
@@ -84,5 +176,42 @@ namespace DUNE
 
       return *this;
     }
+
+    Terminal&
+    Terminal::operator<<(Flusher& f)
+    {
+      (void)f;
+
+      if (m_async)
+      {
+        m_writer->enqueue(new std::string(m_line.str()));
+        m_line.str("");
+        m_mutex.unlock();
+        return *this;
+      }
+
+      if (m_out)
+        m_out->flush();
+
+#if defined(DUNE_OS_POSIX)
+      std::cerr << "\033[0m";
+#endif
+
+      m_mutex.unlock();
+      return *this;
+    }
+
+    void
+    Terminal::writeLine(const std::string& line)
+    {
+      Concurrency::ScopedMutex l(m_mutex);
+      std::cerr << line;
+
+      if (m_out != NULL)
+      {
+        *m_out << line;
+        m_out->flush();
+      }
+    }
   }
 }
@@ -35,6 +35,7 @@
 #include <ostream>
 #include <fstream>
 #include <iostream>
+#include <sstream>
 #include <cstddef>
 #include <cctype>
 
@@ -99,7 +100,9 @@ namespace DUNE
       { };
 
       Terminal(void):
-        m_out(NULL)
+        m_out(NULL),
+        m_async(false),
+        m_writer(NULL)
       { }
 
       ~Terminal(void)
@@ -113,6 +116,15 @@ namespace DUNE
       void
       close(void);
 
+      //! Enable or disable asynchronous output. When enabled the
+      //! caller only assembles the message in memory and a background
+      //! thread performs the writes, keeping I/O stalls out of task
+      //! loops. ANSI colors are dropped in this mode, which is meant
+      //! for unattended operation.
+      //! @param[in] enable true to enable asynchronous output.
+      void
+      setAsynchronous(bool enable);
+
       Terminal&
       lock(const char* str = "");
 
@@ -120,6 +132,12 @@ namespace DUNE
       inline Terminal&
       operator<<(T o)
       {
+        if (m_async)
+        {
+          m_line << o;
+          return *this;
+        }
+
         std::cerr << o;
         if (m_out)
           *m_out << o;
@@ -127,23 +145,27 @@ namespace DUNE
       }
 
       Terminal&
-      operator<<(Flusher& f)
-      {
-        (void)f;
-        if (m_out)
-          m_out->flush();
-
-#if defined(DUNE_OS_POSIX)
-        std::cerr << "\033[0m";
-#endif
-
-        m_mutex.unlock();
-        return *this;
-      }
+      operator<<(Flusher& f);
 
     private:
+      // Forward declaration.
+      class Writer;
+      friend class Writer;
+
       std::ofstream* m_out;
       Concurrency::Mutex m_mutex;
+      //! True if output is asynchronous.
+      bool m_async;
+      //! Message under assembly (asynchronous mode only).
+      std::ostringstream m_line;
+      //! Background writer (asynchronous mode only).
+      Writer* m_writer;
+
+      //! Write one complete message to the output streams, called
+      //! from the background writer.
+      //! @param[in] line message to write.
+      void
+      writeLine(const std::string& line);
     };
 
     DUNE_DLL_SYM extern Terminal dune_term;
@@ -180,6 +180,35 @@ namespace DUNE
       return proc_delta * 100 / global_delta;
     }
 
+    int64_t
+    Resources::getResidentMemory(void)
+    {
+      // Linux v2.6 implementation.
+#if defined(DUNE_OS_LINUX)
+      uint64_t size = 0;
+      uint64_t resident = 0;
+
+      std::ifstream ifs("/proc/self/statm");
+      ifs >> size >> resident;
+      if (!ifs)
+        return -1;
+
+      return (int64_t)resident * sysconf(_SC_PAGESIZE);
+
+      // POSIX implementation.
+#elif defined(DUNE_OS_POSIX)
+      struct rusage ru;
+      if (getrusage(RUSAGE_SELF, &ru) != 0)
+        return -1;
+
+      // ru_maxrss is the peak resident set size in KiB.
+      return (int64_t)ru.ru_maxrss * 1024;
+
+#else
+      return -1;
+#endif
+    }
+
     void
     Resources::lockMemory(void)
     {
@@ -57,6 +57,13 @@ namespace DUNE
       int
       getProcessorUsage(void);
 
+      //! Retrieve the amount of resident memory used by the calling
+      //! process.
+      //! @return resident memory in bytes or -1 if not implemented
+      //! in the current platform.
+      static int64_t
+      getResidentMemory(void);
+
       //! Make all memory pages mapped by the address space of the
       //! current process to be memory-resident until unlocked or until
       //! the process exits.
@@ -46,7 +46,12 @@ namespace DUNE
 #include <DUNE/Tasks/Context.hpp>
 #include <DUNE/Tasks/Manager.hpp>
 #include <DUNE/Tasks/AbstractConsumer.hpp>
+#include <DUNE/Tasks/AbstractBatchConsumer.hpp>
+#include <DUNE/Tasks/BatchConsumer.hpp>
 #include <DUNE/Tasks/Recipient.hpp>
+#include <DUNE/Tasks/QueueStats.hpp>
+#include <DUNE/Tasks/StateSnapshot.hpp>
+#include <DUNE/Tasks/RealTimeGuard.hpp>
 #include <DUNE/Tasks/AbstractCreator.hpp>
 #include <DUNE/Tasks/ParameterTable.hpp>
 #include <DUNE/Tasks/SimpleTransport.hpp>
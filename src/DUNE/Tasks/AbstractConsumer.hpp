@@ -30,6 +30,9 @@
 #ifndef DUNE_TASKS_ABSTRACT_CONSUMER_HPP_INCLUDED_
 #define DUNE_TASKS_ABSTRACT_CONSUMER_HPP_INCLUDED_
 
+// ISO C++ 98 headers.
+#include <cstddef>
+
 // DUNE headers.
 #include <DUNE/IMC/Message.hpp>
 
@@ -43,15 +46,36 @@ namespace DUNE
     class AbstractConsumer
     {
     public:
-      AbstractConsumer(void)
+      //! Non-virtual dispatch trampoline, bound by concrete consumers
+      //! at construction.
+      typedef void (*DispatchFn)(AbstractConsumer*, const IMC::Message*);
+
+      AbstractConsumer(void):
+        m_dispatch(NULL)
       { }
 
       virtual void
       consume(const IMC::Message*) = 0;
 
+      //! Deliver a message through the trampoline bound at
+      //! construction, saving the virtual call on the hot path.
+      //! @param[in] msg message to deliver.
+      inline void
+      deliver(const IMC::Message* msg)
+      {
+        if (m_dispatch != NULL)
+          m_dispatch(this, msg);
+        else
+          consume(msg);
+      }
+
       virtual
       ~AbstractConsumer(void)
       { }
+
+    protected:
+      //! Dispatch trampoline of the concrete consumer.
+      DispatchFn m_dispatch;
     };
   }
 }
@@ -98,14 +98,14 @@ namespace DUNE
       minimumValue(const std::string& value)
       {
         castLexical(value, m_min);
-        m_min_set = false;
+        m_min_set = true;
       }
 
       void
       maximumValue(const std::string& value)
       {
         castLexical(value, m_max);
-        m_max_set = false;
+        m_max_set = true;
       }
 
       void
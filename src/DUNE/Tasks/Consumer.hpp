@@ -47,7 +47,9 @@ namespace DUNE
       Consumer(T& o, Routine f):
         m_obj(o),
         m_fun(f)
-      { }
+      {
+        m_dispatch = dispatchTrampoline;
+      }
 
       void
       consume(const IMC::Message* msg)
@@ -61,6 +63,15 @@ namespace DUNE
     private:
       T& m_obj;
       Routine m_fun;
+
+      //! Statically typed dispatch, called through the base class
+      //! trampoline without a virtual call.
+      static void
+      dispatchTrampoline(AbstractConsumer* self, const IMC::Message* msg)
+      {
+        Consumer* c = static_cast<Consumer*>(self);
+        ((c->m_obj).*(c->m_fun))(reinterpret_cast<const M*>(msg));
+      }
     };
   }
 }
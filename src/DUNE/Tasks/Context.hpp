@@ -35,13 +35,21 @@
 #include <string>
 
 // DUNE headers.
+#include <DUNE/Concurrency/Heartbeat.hpp>
 #include <DUNE/Parsers/Config.hpp>
 #include <DUNE/FileSystem/Path.hpp>
 #include <DUNE/Entities/EntityDataBase.hpp>
 #include <DUNE/Utils/ByteBuffer.hpp>
 #include <DUNE/Tasks/Profiles.hpp>
+#include <DUNE/Tasks/PeriodicExecutor.hpp>
+#include <DUNE/Tasks/QueueStats.hpp>
+#include <DUNE/Tasks/StateSnapshot.hpp>
 #include <DUNE/IMC/Bus.hpp>
 #include <DUNE/IMC/AddressResolver.hpp>
+#include <DUNE/IMC/TelemetryStore.hpp>
+#include <DUNE/IMC/LogSink.hpp>
+#include <DUNE/IO/Multiplexer.hpp>
+#include <DUNE/Navigation/SoundSpeedProfile.hpp>
 
 namespace DUNE
 {
@@ -66,6 +74,22 @@ namespace DUNE
       Entities::EntityDataBase entities;
       //! Execution profiles.
       Profiles profiles;
+      //! Shared periodic executor.
+      PeriodicExecutor pexec;
+      //! Message queue counters of all tasks.
+      QueueStatsRegistry qstats;
+      //! Liveness slots of the message loops of all tasks.
+      Concurrency::HeartbeatRegistry heartbeats;
+      //! Bounded history of high-rate numeric telemetry.
+      IMC::TelemetryStore tstore;
+      //! Direct sink for bulk messages dispatched with DF_BULK.
+      IMC::LogSinkRegistry lsink;
+      //! Latest navigation state of the system.
+      StateSnapshot sstate;
+      //! Shared input thread for transport I/O handles.
+      IO::Multiplexer iomux;
+      //! Shared depth-binned sound velocity profile.
+      Navigation::SoundSpeedProfile svp;
       //! DUNE's directory.
       FileSystem::Path dir_app;
       //! Path to configuration directory.
@@ -28,7 +28,9 @@
 //***************************************************************************
 
 // ISO C++ 98 headers.
+#include <algorithm>
 #include <map>
+#include <vector>
 #include <cstring>
 
 // DUNE headers.
@@ -43,14 +45,54 @@ namespace DUNE
   namespace Tasks
   {
     static Factory::Table c_table;
+    //! Statically linked task table, sorted by name at registration.
+    static std::vector<const Factory::StaticTask*> c_static_index;
+
+    static bool
+    compareStaticTasks(const Factory::StaticTask* a, const Factory::StaticTask* b)
+    {
+      return std::strcmp(a->name, b->name) < 0;
+    }
+
+    //! Find a statically linked task by name using binary search.
+    //! @param[in] name task name.
+    //! @return table entry or NULL if the name is unknown.
+    static const Factory::StaticTask*
+    findStaticTask(const std::string& name)
+    {
+      const char* str = name.c_str();
+      int low = 0;
+      int high = (int)c_static_index.size() - 1;
+
+      while (low <= high)
+      {
+        int mid = (low + high) / 2;
+        int rv = std::strcmp(str, c_static_index[mid]->name);
+
+        if (rv == 0)
+          return c_static_index[mid];
+
+        if (rv < 0)
+          high = mid - 1;
+        else
+          low = mid + 1;
+      }
+
+      return 0;
+    }
 
     DUNE::Tasks::Task*
     Factory::produce(const std::string& name, const std::string& label, Context& ctx)
     {
-      if (!exists(name))
+      const StaticTask* entry = findStaticTask(name);
+      if (entry != 0)
+        return entry->creator(label, ctx);
+
+      Table::iterator itr = c_table.find(name);
+      if (itr == c_table.end())
         return 0;
 
-      task_creator_t creator = c_table[name].getCreatorPointer();
+      task_creator_t creator = itr->second.getCreatorPointer();
 
       if (creator == NULL)
         return 0;
@@ -61,6 +103,9 @@ namespace DUNE
     bool
     Factory::exists(const std::string& name)
     {
+      if (findStaticTask(name) != 0)
+        return true;
+
       return c_table.find(name) != c_table.end();
     }
 
@@ -70,6 +115,16 @@ namespace DUNE
       c_table[name] = Creator(creator);
     }
 
+    void
+    Factory::registerStaticTasks(const StaticTask* table, int count)
+    {
+      c_static_index.reserve(c_static_index.size() + count);
+      for (int i = 0; i < count; ++i)
+        c_static_index.push_back(table + i);
+
+      std::sort(c_static_index.begin(), c_static_index.end(), compareStaticTasks);
+    }
+
     void
     Factory::registerDynamicTask(const char* file)
     {
@@ -107,7 +162,17 @@ namespace DUNE
     int
     Factory::getRegisteredCount(void)
     {
-      return c_table.size();
+      int count = (int)c_static_index.size();
+
+      // Dynamically loaded tasks shadowed by a statically linked one
+      // are not reachable, so they are not counted.
+      for (Table::iterator itr = c_table.begin(); itr != c_table.end(); ++itr)
+      {
+        if (findStaticTask(itr->first) == 0)
+          ++count;
+      }
+
+      return count;
     }
 
     Factory::Table&
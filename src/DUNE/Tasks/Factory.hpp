@@ -53,6 +53,17 @@ namespace DUNE
       //! Low-level task table.
       typedef std::map<std::string, Creator> Table;
 
+      //! Entry of the statically linked task table. The table is laid
+      //! out at build time, so registration adds no per-task string or
+      //! map node allocations.
+      struct StaticTask
+      {
+        //! Task name.
+        const char* name;
+        //! Task creator function.
+        task_creator_t creator;
+      };
+
       static DUNE::Tasks::Task*
       produce(const std::string& name, const std::string& label, Context& ctx);
 
@@ -62,6 +73,9 @@ namespace DUNE
       static void
       registerStaticTask(const std::string& name, task_creator_t creator);
 
+      static void
+      registerStaticTasks(const StaticTask* table, int count);
+
       static void
       registerDynamicTask(const char* file);
 
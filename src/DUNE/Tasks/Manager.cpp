@@ -35,18 +35,24 @@
 #include <cstddef>
 
 // DUNE headers.
+#include <DUNE/Time/Clock.hpp>
 #include <DUNE/Time/Delay.hpp>
 #include <DUNE/Tasks/Task.hpp>
 #include <DUNE/Tasks/Context.hpp>
 #include <DUNE/Tasks/Factory.hpp>
 #include <DUNE/Tasks/Exceptions.hpp>
 #include <DUNE/Tasks/Manager.hpp>
+#include <DUNE/Utils/String.hpp>
 
 namespace DUNE
 {
   namespace Tasks
   {
     static const int c_high_task_cpu_usage = 10;
+    //! Maximum time to wait for a dependency to become ready (s).
+    static const double c_dependency_tout = 10.0;
+    //! Polling period while waiting for a dependency (s).
+    static const double c_dependency_poll = 0.05;
 
     struct TaskCpuUsage
     {
@@ -63,7 +69,9 @@ namespace DUNE
     };
 
     Manager::Manager(Context& ctx):
-      m_ctx(ctx)
+      m_ctx(ctx),
+      m_boot_start(-1.0),
+      m_boot_done(false)
     {
       // Get all sections.
       std::vector<std::string> vec = m_ctx.config.sections();
@@ -102,6 +110,17 @@ namespace DUNE
         task->reserveEntities();
         m_tasks[section] = task;
         m_list.push_back(section);
+
+        StartupInfo info;
+        std::string depends;
+        m_ctx.config.get(section, "Requires", "", depends);
+        if (!depends.empty())
+          DUNE::Utils::String::split(depends, ",", info.depends);
+        m_ctx.config.get(section, "Activation Deadline", "0.0", info.deadline);
+        info.start_time = -1.0;
+        info.started = false;
+        info.warned = false;
+        m_startup[section] = info;
       }
       catch (std::exception& e)
       {
@@ -161,10 +180,109 @@ namespace DUNE
     void
     Manager::start(void)
     {
+      m_boot_start = Time::Clock::get();
+
       std::map<std::string, Task*>::iterator itr;
+      std::set<std::string> visiting;
 
       for (itr = m_tasks.begin(); itr != m_tasks.end(); ++itr)
-        start(itr->first);
+        startAfterDependencies(itr->first, visiting);
+    }
+
+    void
+    Manager::startAfterDependencies(const std::string& section,
+                                    std::set<std::string>& visiting)
+    {
+      StartupInfo& info = m_startup[section];
+      if (info.started)
+        return;
+
+      if (!visiting.insert(section).second)
+      {
+        // Cycle: proceed without waiting, otherwise start() would
+        // deadlock. The chain still starts, only unordered.
+        m_tasks[section]->war(DTR("circular start-up dependency, starting in"
+                                  " configuration order"));
+        return;
+      }
+
+      for (unsigned i = 0; i < info.depends.size(); ++i)
+      {
+        const std::string& dep = info.depends[i];
+        if (m_tasks.find(dep) == m_tasks.end())
+        {
+          m_tasks[section]->war(DTR("unknown start-up dependency '%s'"),
+                                dep.c_str());
+          continue;
+        }
+
+        startAfterDependencies(dep, visiting);
+        waitUntilReady(dep);
+      }
+
+      start(section);
+      visiting.erase(section);
+    }
+
+    void
+    Manager::waitUntilReady(const std::string& section)
+    {
+      Task* task = m_tasks[section];
+      double deadline = Time::Clock::get() + c_dependency_tout;
+
+      while (task->isBooting())
+      {
+        if (Time::Clock::get() >= deadline)
+        {
+          task->war(DTR("not ready after %0.1f s, starting dependent tasks"
+                        " anyway"), c_dependency_tout);
+          return;
+        }
+
+        Time::Delay::wait(c_dependency_poll);
+      }
+    }
+
+    double
+    Manager::checkActivationDeadlines(void)
+    {
+      if (m_boot_done || m_boot_start < 0.0)
+        return -1.0;
+
+      double now = Time::Clock::get();
+      bool all_ready = true;
+
+      for (unsigned i = 0; i < m_list.size(); ++i)
+      {
+        Task* task = m_tasks[m_list[i]];
+        if (task == NULL)
+          continue;
+
+        StartupInfo& info = m_startup[m_list[i]];
+        if (!info.started)
+          continue;
+
+        if (!task->isBooting())
+          continue;
+
+        all_ready = false;
+
+        if (info.warned || info.deadline <= 0.0)
+          continue;
+
+        if ((now - info.start_time) > info.deadline)
+        {
+          info.warned = true;
+          task->war(DTR("not ready %0.1f s after start (deadline is %0.1f s)"),
+                    now - info.start_time, info.deadline);
+        }
+      }
+
+      if (!all_ready)
+        return -1.0;
+
+      m_boot_done = true;
+      return now - m_boot_start;
     }
 
     void
@@ -180,6 +298,10 @@ namespace DUNE
       {
         task->inf(DTR("starting"));
         task->start();
+
+        StartupInfo& info = m_startup[section];
+        info.started = true;
+        info.start_time = Time::Clock::get();
       }
       catch (std::exception& e)
       {
@@ -208,11 +330,29 @@ namespace DUNE
         itr->second->writeParamsXML(os);
     }
 
+    void
+    Manager::saveState(std::vector<IMC::Message*>& msgs)
+    {
+      std::map<std::string, Task*>::iterator itr = m_tasks.begin();
+      for (; itr != m_tasks.end(); ++itr)
+        itr->second->saveState(msgs);
+    }
+
+    void
+    Manager::restoreState(const IMC::Message* msg)
+    {
+      std::map<std::string, Task*>::iterator itr = m_tasks.begin();
+      for (; itr != m_tasks.end(); ++itr)
+        itr->second->restoreState(msg);
+    }
+
     void
     Manager::measureCpuUsage(void)
     {
       std::map<std::string, Task*>::const_iterator itr = m_tasks.begin();
 
+      m_last_cpu_usage.clear();
+
       for ( ; itr != m_tasks.end(); ++itr)
       {
         Task* task = itr->second;
@@ -220,6 +360,8 @@ namespace DUNE
         if (value < 0 || value > 100)
           continue;
 
+        m_last_cpu_usage.push_back(std::make_pair(value, itr->first));
+
         m_task_cpu_usage.setSourceEntity(task->getEntityId());
         m_task_cpu_usage.value = value;
         task->dispatch(m_task_cpu_usage);
@@ -234,6 +376,26 @@ namespace DUNE
       }
     }
 
+    std::string
+    Manager::getCpuUsageProfile(unsigned max_entries) const
+    {
+      std::vector<std::pair<int, std::string> > usage(m_last_cpu_usage);
+      std::sort(usage.begin(), usage.end());
+
+      std::string profile;
+      unsigned count = 0;
+      for (size_t i = usage.size(); i > 0 && count < max_entries; --i, ++count)
+      {
+        if (!profile.empty())
+          profile += "; ";
+
+        profile += Utils::String::str("%s: %d%%", usage[i - 1].second.c_str(),
+                                      usage[i - 1].first);
+      }
+
+      return profile;
+    }
+
     void
     Manager::adjustPriorities(void)
     {
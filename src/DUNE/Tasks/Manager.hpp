@@ -33,6 +33,7 @@
 // ISO C++ 98 headers.
 #include <vector>
 #include <map>
+#include <set>
 #include <string>
 
 // DUNE headers.
@@ -59,7 +60,10 @@ namespace DUNE
       //! Destructor.
       ~Manager(void);
 
-      //! Start all tasks.
+      //! Start all tasks. Tasks with a 'Requires' option are started
+      //! after the sections they depend on are ready (or a bounded
+      //! wait expires); independent tasks start immediately and
+      //! initialize on their own threads in parallel.
       void
       start(void);
 
@@ -104,9 +108,34 @@ namespace DUNE
         return m_tasks[name];
       }
 
+      //! Check the activation deadline of every started task, warning
+      //! once for each task that is still booting past its deadline.
+      //! @return seconds from start() to all tasks being ready, the
+      //! first time that happens; negative otherwise.
+      double
+      checkActivationDeadlines(void);
+
+      //! Collect warm restart state from all tasks.
+      //! @param[out] msgs collected messages, owned by the caller.
+      void
+      saveState(std::vector<IMC::Message*>& msgs);
+
+      //! Deliver a message recovered from a warm restart snapshot to
+      //! all tasks.
+      //! @param[in] msg recovered message.
+      void
+      restoreState(const IMC::Message* msg);
+
       void
       measureCpuUsage(void);
 
+      //! Describe the per-task CPU usage measured by the last call to
+      //! measureCpuUsage(), ordered by descending usage.
+      //! @param[in] max_entries maximum number of tasks to describe.
+      //! @return formatted profile, one 'task: usage%' pair per entry.
+      std::string
+      getCpuUsageProfile(unsigned max_entries) const;
+
       void
       adjustPriorities(void);
 
@@ -125,6 +154,21 @@ namespace DUNE
         }
       };
 
+      //! Start-up bookkeeping of one task.
+      struct StartupInfo
+      {
+        //! Sections that must be ready before this task starts.
+        std::vector<std::string> depends;
+        //! Activation deadline in seconds, 0 to disable.
+        double deadline;
+        //! Time the task was started.
+        double start_time;
+        //! True once the task was started.
+        bool started;
+        //! True once the deadline warning was issued.
+        bool warned;
+      };
+
       //! Task list.
       std::vector<std::string> m_list;
       //! Running tasks.
@@ -135,10 +179,34 @@ namespace DUNE
       std::priority_queue<TaskCpuUsage> m_cpu_usage_hogs;
       //! Buffer message to dispatch CPU usage of tasks.
       IMC::CpuUsage m_task_cpu_usage;
+      //! Per-task CPU usage measured in the last period.
+      std::vector<std::pair<int, std::string> > m_last_cpu_usage;
+
+      //! Start-up bookkeeping, indexed by section.
+      std::map<std::string, StartupInfo> m_startup;
+      //! Time start() was called.
+      double m_boot_start;
+      //! True once every task was seen ready.
+      bool m_boot_done;
 
       void
       createTask(const std::string& section);
 
+      //! Start a task after its declared dependencies, detecting
+      //! dependency cycles.
+      //! @param[in] section task section.
+      //! @param[in,out] visiting sections on the current dependency
+      //! chain.
+      void
+      startAfterDependencies(const std::string& section,
+                             std::set<std::string>& visiting);
+
+      //! Wait until a task leaves the boot state or a bounded wait
+      //! expires.
+      //! @param[in] section task section.
+      void
+      waitUntilReady(const std::string& section);
+
       void
       lowerHogPriority(Task* task, int cpu_usage);
     };
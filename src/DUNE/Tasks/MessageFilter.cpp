@@ -40,7 +40,9 @@ namespace DUNE
 {
   namespace Tasks
   {
-    MessageFilter::MessageFilter(void)
+    MessageFilter::MessageFilter(void):
+      m_decim_threshold(0),
+      m_loaded(false)
     { }
 
     MessageFilter::~MessageFilter(void)
@@ -87,6 +89,43 @@ namespace DUNE
         stime = now;
       }
 
+      // Shape message by byte rate.
+      ByteRateMap::iterator bbitr = m_byte_rates.find(mid);
+
+      if (bbitr != m_byte_rates.end())
+      {
+        ByteBudget& budget = bbitr->second;
+        double now = Time::Clock::get();
+
+        budget.level += (now - budget.last) * budget.rate;
+        budget.last = now;
+
+        // Allow at most one second of burst.
+        if (budget.level > budget.rate)
+          budget.level = budget.rate;
+
+        double size = msg->getSerializationSize();
+
+        if (budget.level < size)
+          return true;
+
+        budget.level -= size;
+      }
+
+      // Decimate message under load.
+      if (m_loaded)
+      {
+        DecimMap::iterator dmitr = m_decim.find(mid);
+
+        if (dmitr != m_decim.end())
+        {
+          unsigned& count = m_dcounts[MsgKey(mid, msg->getSourceEntity())];
+
+          if ((count++ % dmitr->second) != 0)
+            return true;
+        }
+      }
+
       return false;
     }
 
@@ -117,6 +156,91 @@ namespace DUNE
       }
     }
 
+    //! Setup byte rate shapers. Each listed message type gets a byte
+    //! budget replenished at the given rate, with at most one second
+    //! of burst; messages that would exceed the budget are dropped.
+    //! Unlisted messages always pass untouched.
+    //! @param[in] spec list of <Message>:<BytesPerSecond> entries.
+    void
+    MessageFilter::setupByteRates(const std::vector<std::string>& spec)
+    {
+      m_byte_rates.clear();
+
+      for (unsigned int i = 0; i < spec.size(); ++i)
+      {
+        std::vector<std::string> parts;
+        Utils::String::split(spec[i], ":", parts);
+
+        if (parts.size() == 2)
+        {
+          uint32_t id = IMC::Factory::getIdFromAbbrev(parts[0]);
+          double rate = 0;
+          if (std::sscanf(parts[1].c_str(), "%lf", &rate) && rate > 0)
+          {
+            ByteBudget budget;
+            budget.rate = rate;
+            budget.level = rate;
+            budget.last = Time::Clock::get();
+            m_byte_rates[id] = budget;
+            continue;
+          }
+        }
+        throw std::runtime_error(Utils::String::str(DTR("invalid filter: %s"), spec[i].c_str()));
+      }
+    }
+
+    //! Setup load-adaptive decimation. Listed messages are decimated,
+    //! each entity stream keeping one message in every 'factor', while
+    //! the consumer's queue depth stays at or above the threshold.
+    //! Unlisted messages always pass untouched.
+    //! @param[in] spec list of <Message>:<Factor> entries.
+    //! @param[in] threshold queue depth that engages decimation, zero
+    //! disables it.
+    void
+    MessageFilter::setupDecimation(const std::vector<std::string>& spec, unsigned threshold)
+    {
+      m_decim.clear();
+      m_dcounts.clear();
+      m_decim_threshold = threshold;
+      m_loaded = false;
+
+      for (unsigned int i = 0; i < spec.size(); ++i)
+      {
+        std::vector<std::string> parts;
+        Utils::String::split(spec[i], ":", parts);
+
+        if (parts.size() == 2)
+        {
+          uint32_t id = IMC::Factory::getIdFromAbbrev(parts[0]);
+          unsigned factor = 0;
+          if (std::sscanf(parts[1].c_str(), "%u", &factor) && factor > 1)
+          {
+            m_decim[id] = factor;
+            continue;
+          }
+        }
+        throw std::runtime_error(Utils::String::str(DTR("invalid filter: %s"), spec[i].c_str()));
+      }
+    }
+
+    //! Report the consumer's current queue depth, engaging or
+    //! disengaging decimation. Counters are reset on engagement so
+    //! each burst starts by passing the next message of every stream.
+    //! @param[in] depth queue depth.
+    void
+    MessageFilter::setQueueDepth(unsigned depth)
+    {
+      if (m_decim_threshold == 0 || m_decim.empty())
+        return;
+
+      bool loaded = (depth >= m_decim_threshold);
+
+      if (loaded && !m_loaded)
+        m_dcounts.clear();
+
+      m_loaded = loaded;
+    }
+
     //! Setup entities filter.
     //! @param[in] spec String specification.
     //! @param[in] task Pointer to Task object.
@@ -52,9 +52,18 @@ namespace DUNE
       void
       setupRates(const std::vector<std::string>& spec);
 
+      void
+      setupByteRates(const std::vector<std::string>& spec);
+
       void
       setupEntities(const std::vector<std::string>& spec, Tasks::Task* task);
 
+      void
+      setupDecimation(const std::vector<std::string>& spec, unsigned threshold);
+
+      void
+      setQueueDepth(unsigned depth);
+
       bool
       filter(const IMC::Message* msg);
 
@@ -68,9 +77,38 @@ namespace DUNE
       typedef std::map<MsgKey, double> STimesMap;
       STimesMap m_stimes;
 
+      // Byte budget of one shaped message type.
+      struct ByteBudget
+      {
+        // Capacity in bytes per second.
+        double rate;
+        // Available bytes.
+        double level;
+        // Time of the last refill.
+        double last;
+      };
+
+      // Byte rate limiters.
+      typedef std::map<uint32_t, ByteBudget> ByteRateMap;
+      ByteRateMap m_byte_rates;
+
       // List of entities to be passed by given message
       typedef std::vector<uint32_t> Entities;
       std::map<uint32_t, Entities> m_filtered;
+
+      // Decimation factors of messages that may be dropped under load.
+      typedef std::map<uint32_t, unsigned> DecimMap;
+      DecimMap m_decim;
+
+      // Decimation counters.
+      typedef std::map<MsgKey, unsigned> DecimCountMap;
+      DecimCountMap m_dcounts;
+
+      // Queue depth above which decimation engages (0 disables it).
+      unsigned m_decim_threshold;
+
+      // True when decimation is engaged.
+      bool m_loaded;
     };
   }
 }
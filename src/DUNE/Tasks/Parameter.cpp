@@ -105,6 +105,7 @@ namespace DUNE
       m_max_size(UINT_MAX),
       m_reader(NULL),
       m_changed(true),
+      m_parsed(false),
       m_visibility(VISIBILITY_DEVELOPER),
       m_scope(SCOPE_GLOBAL)
     { }
@@ -146,6 +147,7 @@ namespace DUNE
       {
         m_reader->validate();
         m_value = val;
+        m_parsed = true;
       }
       catch (std::exception& e)
       {
@@ -124,6 +124,14 @@ namespace DUNE
         return m_value;
       }
 
+      //! Test if the parameter was successfully read at least once.
+      //! @return true if the parameter holds a parsed value.
+      bool
+      parsed(void) const
+      {
+        return m_parsed;
+      }
+
       std::string
       defaultValue(void) const
       {
@@ -306,6 +314,8 @@ namespace DUNE
       AbstractParameterParser* m_reader;
       //! True if the value of this parameter changed.
       bool m_changed;
+      //! True after the first successful read.
+      bool m_parsed;
       //! Parameter visibility.
       Visibility m_visibility;
       //! Parameter scope.
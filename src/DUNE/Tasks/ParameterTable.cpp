@@ -34,7 +34,7 @@ namespace DUNE
 {
   namespace Tasks
   {
-    void
+    bool
     ParameterTable::set(const std::string& name, const std::string& value)
     {
       std::map<std::string, Parameter*>::const_iterator itr = m_names.find(name);
@@ -43,13 +43,22 @@ namespace DUNE
         throw std::runtime_error(DTR("invalid parameter"));
 
       Parameter* parameter = itr->second;
-      if (!value.empty())
-        parameter->read(value);
-      else
-        parameter->read(parameter->defaultValue());
+      const std::string& wanted = value.empty() ? parameter->defaultValue() : value;
 
-      if (parameter->commit())
-        parameter->setChanged();
+      // Same string as the last successful read: parsing and
+      // validation are deterministic, so neither can produce a new
+      // outcome and both are skipped.
+      if (parameter->parsed() && wanted == parameter->value())
+        return false;
+
+      parameter->read(wanted);
+
+      if (!parameter->commit())
+        return false;
+
+      parameter->setChanged();
+      ++m_generation;
+      return true;
     }
 
     ParameterTable::~ParameterTable(void)
@@ -48,7 +48,8 @@ namespace DUNE
     class ParameterTable
     {
     public:
-      ParameterTable(void)
+      ParameterTable(void):
+        m_generation(1)
       { }
 
       ~ParameterTable(void);
@@ -64,9 +65,25 @@ namespace DUNE
         return *p;
       }
 
-      void
+      //! Set the value of a parameter.
+      //! @param[in] name parameter name.
+      //! @param[in] value parameter value, empty selects the default.
+      //! @return true if the committed value differs from the
+      //! previous one, false otherwise.
+      bool
       set(const std::string& name, const std::string& value);
 
+      //! Retrieve the generation of the table. The generation starts
+      //! at one and is incremented whenever a parameter commits a new
+      //! value, so a client holding the generation of its last full
+      //! read can tell whether the table changed since.
+      //! @return table generation.
+      unsigned
+      getGeneration(void) const
+      {
+        return m_generation;
+      }
+
       void
       writeXML(std::ostream& os) const
       {
@@ -125,6 +142,8 @@ namespace DUNE
       std::vector<Parameter*> m_params;
       std::map<void*, Parameter*> m_pointers;
       std::map<std::string, Parameter*> m_names;
+      //! Generation counter, incremented on every committed change.
+      unsigned m_generation;
     };
   }
 }
@@ -36,6 +36,7 @@
 #include <DUNE/Tasks/Context.hpp>
 #include <DUNE/Tasks/Periodic.hpp>
 #include <DUNE/Time/Clock.hpp>
+#include <DUNE/Time/CycleClock.hpp>
 #include <DUNE/Time/Delay.hpp>
 
 namespace DUNE
@@ -51,11 +52,61 @@ namespace DUNE
       .units(Units::Hertz)
       .defaultValue("1.0")
       .description(DTR("Frequency at which task is executed"));
+
+      param(DTR_RT("Shared Executor"), m_shared_executor)
+      .defaultValue("false")
+      .description(DTR("Execute cycles on the daemon's shared periodic executor pool instead of a dedicated timing loop"));
+
+      param(DTR_RT("Catch-up Policy"), m_catch_up)
+      .values("burst, skip, slew")
+      .defaultValue("burst")
+      .description(DTR("Handling of cycles missed under load: run them"
+                       " back to back (burst), drop them keeping the"
+                       " original phase (skip) or reschedule from the"
+                       " current time (slew)"));
+    }
+
+    Periodic::CatchUpPolicy
+    Periodic::getCatchUpPolicy(void) const
+    {
+      if (m_catch_up == "skip")
+        return CUP_SKIP;
+
+      if (m_catch_up == "slew")
+        return CUP_SLEW;
+
+      return CUP_BURST;
+    }
+
+    void
+    Periodic::executeCycle(void)
+    {
+      m_run_time = Time::Clock::get();
+      Time::CycleClock::set(m_run_time);
+
+      // Perform job.
+      consumeMessages();
+      if (!stopping())
+      {
+        task();
+        ++m_run_count;
+      }
     }
 
     void
     Periodic::onMain(void)
     {
+      if (m_shared_executor)
+      {
+        // Cycles run on the shared executor pool; this thread only
+        // waits for termination.
+        m_ctx.pexec.add(this);
+        while (!stopping())
+          Time::Delay::wait(0.5);
+        m_ctx.pexec.remove(this);
+        return;
+      }
+
       double now = Time::Clock::get();
       double delay = (1 / m_frequency);
       double next_inv = now + delay;
@@ -69,18 +120,33 @@ namespace DUNE
           Time::Delay::wait(next_inv - now);
 
         next_inv += delay;
+
+        executeCycle();
+
         now = Time::Clock::get();
-        m_run_time = now;
 
-        // Perform job.
-        consumeMessages();
-        if (!stopping())
+        // Deadlines are absolute, so a loaded cycle does not shift
+        // the following ones; what happens to cycles already missed
+        // is governed by the catch-up policy.
+        if (next_inv < now)
         {
-          task();
-          ++m_run_count;
-        }
+          switch (getCatchUpPolicy())
+          {
+            case CUP_SKIP:
+              while (next_inv <= now)
+                next_inv += delay;
+              break;
 
-        now = Time::Clock::get();
+            case CUP_SLEW:
+              if (now - next_inv > delay)
+                next_inv = now;
+              break;
+
+            case CUP_BURST:
+            default:
+              break;
+          }
+        }
       }
     }
   }
@@ -95,10 +95,27 @@ namespace DUNE
         return m_run_count;
       }
 
+      //! Policy for catching up after missed deadlines.
+      enum CatchUpPolicy
+      {
+        //! Run missed cycles back to back.
+        CUP_BURST,
+        //! Skip missed cycles, keeping the original phase.
+        CUP_SKIP,
+        //! Reschedule from the current time, losing phase.
+        CUP_SLEW
+      };
+
       //! The task to be executed on each cycle.
       virtual void
       task(void) = 0;
 
+      //! Execute a single cycle: consume queued messages, run the
+      //! periodic job and update run statistics. Called from the
+      //! task's own loop or from a shared executor worker.
+      void
+      executeCycle(void);
+
     private:
       //! Number of executions thus far.
       unsigned m_run_count;
@@ -106,6 +123,14 @@ namespace DUNE
       double m_run_time;
       //! Task frequency (Hz).
       double m_frequency;
+      //! True to execute cycles on the shared executor.
+      bool m_shared_executor;
+      //! Catch-up policy name.
+      std::string m_catch_up;
+
+      //! Parse the catch-up policy parameter.
+      CatchUpPolicy
+      getCatchUpPolicy(void) const;
 
       //! Task entry point.
       void
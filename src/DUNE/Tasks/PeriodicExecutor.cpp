@@ -0,0 +1,227 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <algorithm>
+#include <cstring>
+
+// DUNE headers.
+#include <DUNE/Concurrency/Thread.hpp>
+#include <DUNE/Concurrency/ScopedCondition.hpp>
+#include <DUNE/Tasks/Periodic.hpp>
+#include <DUNE/Tasks/PeriodicExecutor.hpp>
+#include <DUNE/Time/Clock.hpp>
+
+namespace DUNE
+{
+  namespace Tasks
+  {
+    //! Number of worker threads.
+    static const unsigned c_workers = 2;
+
+    //! Min-heap ordering: the entry with the earliest deadline sits
+    //! at the top. Ties are broken by task name so the schedule is
+    //! reproducible across runs.
+    static bool
+    entryLater(const PeriodicExecutor::Entry& a, const PeriodicExecutor::Entry& b)
+    {
+      if (a.deadline != b.deadline)
+        return a.deadline > b.deadline;
+
+      return std::strcmp(a.task->getName(), b.task->getName()) > 0;
+    }
+
+    class PeriodicExecutor::Worker: public Concurrency::Thread
+    {
+    public:
+      Worker(PeriodicExecutor& exec):
+        m_exec(exec)
+      { }
+
+    private:
+      //! Executor.
+      PeriodicExecutor& m_exec;
+
+      void
+      run(void)
+      {
+        m_exec.runWorker();
+      }
+    };
+
+    PeriodicExecutor::PeriodicExecutor(void):
+      m_stop(false),
+      m_lockstep(false),
+      m_vtime(0)
+    { }
+
+    PeriodicExecutor::~PeriodicExecutor(void)
+    {
+      {
+        Concurrency::ScopedCondition l(m_cond);
+        m_stop = true;
+        m_cond.broadcast();
+      }
+
+      for (unsigned i = 0; i < m_workers.size(); ++i)
+      {
+        m_workers[i]->stopAndJoin();
+        delete m_workers[i];
+      }
+    }
+
+    void
+    PeriodicExecutor::add(Periodic* task)
+    {
+      Concurrency::ScopedCondition l(m_cond);
+
+      if (m_workers.empty())
+      {
+        for (unsigned i = 0; i < c_workers; ++i)
+        {
+          Worker* worker = new Worker(*this);
+          worker->start();
+          m_workers.push_back(worker);
+        }
+      }
+
+      if (m_tasks.find(task) != m_tasks.end())
+        return;
+
+      m_tasks.insert(task);
+
+      Entry entry;
+      entry.deadline = m_lockstep ? m_vtime : Time::Clock::get();
+      entry.task = task;
+      m_heap.push_back(entry);
+      std::push_heap(m_heap.begin(), m_heap.end(), entryLater);
+      m_cond.broadcast();
+    }
+
+    void
+    PeriodicExecutor::remove(Periodic* task)
+    {
+      Concurrency::ScopedCondition l(m_cond);
+      m_tasks.erase(task);
+
+      // Wait for any in-flight cycle of this task to finish before
+      // returning, the caller may destroy the task afterwards.
+      while (m_running.find(task) != m_running.end())
+        m_cond.wait(0.1);
+    }
+
+    void
+    PeriodicExecutor::setLockstep(bool enable)
+    {
+      Concurrency::ScopedCondition l(m_cond);
+      m_lockstep = enable;
+      if (enable)
+        m_vtime = Time::Clock::get();
+      m_cond.broadcast();
+    }
+
+    void
+    PeriodicExecutor::runWorker(void)
+    {
+      Concurrency::ScopedCondition l(m_cond);
+
+      while (!m_stop)
+      {
+        if (m_heap.empty())
+        {
+          m_cond.wait(1.0);
+          continue;
+        }
+
+        // Discard entries of unregistered tasks.
+        if (m_tasks.find(m_heap.front().task) == m_tasks.end())
+        {
+          std::pop_heap(m_heap.begin(), m_heap.end(), entryLater);
+          m_heap.pop_back();
+          continue;
+        }
+
+        if (m_lockstep)
+        {
+          // Serialize cycle execution for a reproducible interleaving
+          // and advance virtual time to the next due cycle instead of
+          // waiting on the wall clock.
+          if (!m_running.empty())
+          {
+            m_cond.wait(0.1);
+            continue;
+          }
+
+          if (m_heap.front().deadline > m_vtime)
+            m_vtime = m_heap.front().deadline;
+        }
+        else
+        {
+          double now = Time::Clock::get();
+          if (m_heap.front().deadline > now)
+          {
+            m_cond.wait(m_heap.front().deadline - now);
+            continue;
+          }
+        }
+
+        Entry entry = m_heap.front();
+        std::pop_heap(m_heap.begin(), m_heap.end(), entryLater);
+        m_heap.pop_back();
+        m_running.insert(entry.task);
+
+        m_cond.unlock();
+        entry.task->executeCycle();
+        m_cond.lock();
+
+        m_running.erase(entry.task);
+
+        if (m_tasks.find(entry.task) != m_tasks.end())
+        {
+          // Schedule the next cycle, clamping to the current time if
+          // cycles were missed (virtual time never misses cycles).
+          double freq = entry.task->getFrequency();
+          entry.deadline += 1.0 / (freq > 0.0 ? freq : 1.0);
+
+          if (!m_lockstep)
+          {
+            double now = Time::Clock::get();
+            if (entry.deadline < now)
+              entry.deadline = now;
+          }
+
+          m_heap.push_back(entry);
+          std::push_heap(m_heap.begin(), m_heap.end(), entryLater);
+        }
+
+        m_cond.broadcast();
+      }
+    }
+  }
+}
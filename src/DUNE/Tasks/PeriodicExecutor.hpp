@@ -0,0 +1,134 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+#ifndef DUNE_TASKS_PERIODIC_EXECUTOR_HPP_INCLUDED_
+#define DUNE_TASKS_PERIODIC_EXECUTOR_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <set>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Concurrency/Condition.hpp>
+
+namespace DUNE
+{
+  namespace Tasks
+  {
+    // Forward declarations.
+    class Periodic;
+
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM PeriodicExecutor;
+
+    //! Shared executor for periodic task cycles.
+    //!
+    //! Periodic tasks that opt in have their cycles multiplexed over
+    //! a small pool of worker threads instead of each occupying a
+    //! dedicated timing loop. Registered tasks sit in a deadline
+    //! ordered heap; workers pick whichever task is due next, execute
+    //! one cycle and reinsert it with its next deadline. A task is
+    //! never executed by two workers at once.
+    class PeriodicExecutor
+    {
+    public:
+      //! Constructor.
+      PeriodicExecutor(void);
+
+      //! Destructor, stops and joins all workers.
+      ~PeriodicExecutor(void);
+
+      //! Register a periodic task with the executor. Worker threads
+      //! are started lazily on first registration.
+      //! @param task task object.
+      void
+      add(Periodic* task);
+
+      //! Unregister a periodic task, waiting for any cycle of the
+      //! task currently in execution to finish.
+      //! @param task task object.
+      void
+      remove(Periodic* task);
+
+      //! Enable or disable lockstep mode. In lockstep, cycles are
+      //! executed serially in virtual time, ordered by deadline with
+      //! a name tie-break, as fast as the CPU allows. Intended for
+      //! simulation and CI runs where a reproducible cycle
+      //! interleaving matters more than wall-clock pacing. Should be
+      //! set before tasks register.
+      //! @param enable true to enable lockstep mode.
+      void
+      setLockstep(bool enable);
+
+      //! Scheduled task entry.
+      struct Entry
+      {
+        //! Time of next cycle.
+        double deadline;
+        //! Task object.
+        Periodic* task;
+      };
+
+    private:
+      // Worker thread.
+      class Worker;
+      friend class Worker;
+
+      //! Worker pool.
+      std::vector<Worker*> m_workers;
+      //! Deadline heap of registered tasks.
+      std::vector<Entry> m_heap;
+      //! Registered tasks.
+      std::set<Periodic*> m_tasks;
+      //! Tasks with a cycle currently in execution.
+      std::set<Periodic*> m_running;
+      //! True when workers should terminate.
+      bool m_stop;
+      //! True when stepping in lockstep mode.
+      bool m_lockstep;
+      //! Virtual time of the lockstep schedule.
+      double m_vtime;
+      //! Heap condition, also guards all executor state.
+      Concurrency::Condition m_cond;
+
+      //! Worker entry point: execute due cycles until stopped.
+      void
+      runWorker(void);
+
+      //! Non - copyable.
+      PeriodicExecutor(const PeriodicExecutor&);
+
+      //! Non - assignable.
+      PeriodicExecutor&
+      operator=(const PeriodicExecutor&);
+    };
+  }
+}
+
+#endif
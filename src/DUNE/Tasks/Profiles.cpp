@@ -42,15 +42,28 @@ namespace DUNE
     struct Profiles::Details
     {
       std::string description;
+      uint32_t mask;
     };
 
     void
     Profiles::add(const std::string& name, const std::string& description)
     {
+      Concurrency::ScopedMutex l(m_mutex);
+
+      std::map<std::string, Profiles::Details*>::iterator itr = m_profiles.find(name);
+      if (itr != m_profiles.end())
+      {
+        itr->second->description = description;
+        return;
+      }
+
+      // Bit 0 is reserved for 'Always'.
+      if (m_profiles.size() >= 31)
+        throw std::runtime_error(DTR("too many execution profiles"));
+
       Profiles::Details* pro = new Profiles::Details;
       pro->description = description;
-
-      Concurrency::ScopedMutex l(m_mutex);
+      pro->mask = 2u << m_profiles.size();
       m_profiles[name] = pro;
     }
 
@@ -63,6 +76,8 @@ namespace DUNE
         delete itr->second;
 
       m_profiles.clear();
+      m_selected.clear();
+      m_selected_mask = c_always_mask;
     }
 
     void
@@ -79,6 +94,8 @@ namespace DUNE
 
         m_selected.insert(names[i]);
       }
+
+      updateMask();
     }
 
     void
@@ -95,6 +112,8 @@ namespace DUNE
 
         m_selected.erase(names[i]);
       }
+
+      updateMask();
     }
 
     bool
@@ -116,6 +135,43 @@ namespace DUNE
       return false;
     }
 
+    uint32_t
+    Profiles::compile(const std::string& name)
+    {
+      std::vector<std::string> names;
+      Utils::String::split(name, ",", names);
+
+      uint32_t mask = 0;
+
+      Concurrency::ScopedMutex l(m_mutex);
+      for (unsigned i = 0; i < names.size(); ++i)
+      {
+        if (names[i] == "Always")
+        {
+          mask |= c_always_mask;
+          continue;
+        }
+
+        std::map<std::string, Profiles::Details*>::iterator itr = m_profiles.find(names[i]);
+        if (itr != m_profiles.end())
+          mask |= itr->second->mask;
+      }
+
+      return mask;
+    }
+
+    void
+    Profiles::updateMask(void)
+    {
+      uint32_t mask = c_always_mask;
+
+      std::set<std::string>::iterator itr = m_selected.begin();
+      for (; itr != m_selected.end(); ++itr)
+        mask |= m_profiles[*itr]->mask;
+
+      m_selected_mask = mask;
+    }
+
     std::string
     Profiles::getSelected(void)
     {
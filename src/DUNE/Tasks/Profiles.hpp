@@ -49,6 +49,14 @@ namespace DUNE
     class Profiles
     {
     public:
+      //! Bit representing the pseudo-profile 'Always'.
+      static const uint32_t c_always_mask = 1;
+
+      //! Constructor.
+      Profiles(void):
+        m_selected_mask(c_always_mask)
+      { }
+
       //! Destructor.
       ~Profiles(void)
       {
@@ -80,6 +88,24 @@ namespace DUNE
       bool
       isSelected(const std::string& name);
 
+      //! Compile a profile name or comma separated list of profile
+      //! names into a bitmask for use with isSelected(uint32_t).
+      //! Unknown names contribute no bits.
+      //! @param name profile name or comma separated list of profile names.
+      //! @return bitmask of the listed profiles.
+      uint32_t
+      compile(const std::string& name);
+
+      //! Test a compiled profile mask against the current selection.
+      //! Does not lock: suitable for hot paths.
+      //! @param mask mask returned by compile().
+      //! @return true if any profile in the mask is selected.
+      bool
+      isSelected(uint32_t mask) const
+      {
+        return (mask & m_selected_mask) != 0;
+      }
+
       //! Retrieve the comma separated list of currently selected
       //! profiles.
       //! @return comma separated list of currently selected profiles.
@@ -93,8 +119,14 @@ namespace DUNE
       std::map<std::string, Details*> m_profiles;
       //! Set of selected profiles.
       std::set<std::string> m_selected;
+      //! Bitmask of selected profiles, including the 'Always' bit.
+      volatile uint32_t m_selected_mask;
       //! Concurrency mutex.
       Concurrency::Mutex m_mutex;
+
+      //! Recompute the selection bitmask (caller holds m_mutex).
+      void
+      updateMask(void);
     };
   }
 }
@@ -0,0 +1,67 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <algorithm>
+
+// DUNE headers.
+#include <DUNE/Tasks/QueueStats.hpp>
+#include <DUNE/Tasks/Recipient.hpp>
+#include <DUNE/Concurrency/ScopedMutex.hpp>
+
+namespace DUNE
+{
+  namespace Tasks
+  {
+    void
+    QueueStatsRegistry::add(Recipient* rec)
+    {
+      Concurrency::ScopedMutex l(m_lock);
+      m_recs.push_back(rec);
+    }
+
+    void
+    QueueStatsRegistry::remove(Recipient* rec)
+    {
+      Concurrency::ScopedMutex l(m_lock);
+      std::vector<Recipient*>::iterator itr = std::find(m_recs.begin(), m_recs.end(), rec);
+      if (itr != m_recs.end())
+        m_recs.erase(itr);
+    }
+
+    void
+    QueueStatsRegistry::query(std::vector<QueueStats>& list)
+    {
+      Concurrency::ScopedMutex l(m_lock);
+      list.resize(m_recs.size());
+      for (size_t i = 0; i < m_recs.size(); ++i)
+        m_recs[i]->getStats(list[i]);
+    }
+  }
+}
@@ -0,0 +1,121 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+#ifndef DUNE_TASKS_QUEUE_STATS_HPP_INCLUDED_
+#define DUNE_TASKS_QUEUE_STATS_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Concurrency/Mutex.hpp>
+
+namespace DUNE
+{
+  namespace Tasks
+  {
+    // Forward declarations.
+    class Recipient;
+
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM QueueStatsRegistry;
+
+    //! Number of delivery latency histogram buckets; the last bucket
+    //! is unbounded.
+    static const unsigned c_queue_lat_buckets = 8;
+
+    //! Delivery latency histogram bucket upper bounds (s). Resolution
+    //! is finest in the 1-100 ms band where control-loop delivery
+    //! deadlines live.
+    static const double c_queue_lat_bounds[c_queue_lat_buckets - 1] =
+    {0.001, 0.005, 0.01, 0.02, 0.05, 0.1, 1.0};
+
+    //! Per message type consumer counters of one task.
+    struct ConsumerStats
+    {
+      //! Message identification number.
+      uint32_t id;
+      //! Number of messages consumed.
+      uint64_t count;
+      //! Cumulative time spent inside the consumers (nanoseconds).
+      uint64_t time_nsec;
+    };
+
+    //! Snapshot of one task's message queue counters.
+    struct QueueStats
+    {
+      //! Task name.
+      std::string name;
+      //! Current queue depth.
+      unsigned depth;
+      //! Highest queue depth observed when draining.
+      unsigned depth_hwm;
+      //! Total number of messages consumed.
+      uint64_t consumed;
+      //! Delivery latency histogram (dispatch to consume).
+      uint64_t latency[c_queue_lat_buckets];
+      //! Consumer counters by message type.
+      std::vector<ConsumerStats> consumers;
+    };
+
+    //! Registry of the message queues of all tasks of a context.
+    //! Recipients register themselves on construction, so diagnostic
+    //! surfaces (HTTP, console) can take a snapshot of every inbox
+    //! without knowing the tasks.
+    class QueueStatsRegistry
+    {
+    public:
+      //! Register a task's recipient.
+      //! @param[in] rec recipient object.
+      void
+      add(Recipient* rec);
+
+      //! Unregister a task's recipient.
+      //! @param[in] rec recipient object.
+      void
+      remove(Recipient* rec);
+
+      //! Take a snapshot of the queue counters of all registered
+      //! recipients.
+      //! @param[out] list queue counter snapshots.
+      void
+      query(std::vector<QueueStats>& list);
+
+    private:
+      //! Registered recipients.
+      std::vector<Recipient*> m_recs;
+      //! Lock to serialize access to m_recs.
+      Concurrency::Mutex m_lock;
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,133 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstdlib>
+
+// DUNE headers.
+#include <DUNE/Tasks/RealTimeGuard.hpp>
+#include <DUNE/Time/Clock.hpp>
+#include <DUNE/Streams/Terminal.hpp>
+
+// Platform headers.
+#if defined(DUNE_SYS_HAS_SYS_TIME_H)
+#  include <sys/time.h>
+#endif
+
+#if defined(DUNE_SYS_HAS_SYS_RESOURCE_H)
+#  include <sys/resource.h>
+#endif
+
+namespace DUNE
+{
+  namespace Tasks
+  {
+    //! Checker state: -1 unknown, 0 disabled, 1 enabled.
+    static int s_enabled = -1;
+
+    bool
+    RealTimeGuard::enabled(void)
+    {
+      if (s_enabled < 0)
+        s_enabled = (std::getenv("DUNE_RT_CHECK") == NULL) ? 0 : 1;
+
+      return s_enabled == 1;
+    }
+
+    bool
+    RealTimeGuard::sample(Sample& sample)
+    {
+#if defined(DUNE_OS_POSIX)
+      struct rusage ru;
+
+      // Per-thread accounting when available, falling back to the
+      // whole process (noisier, but still catches violations in
+      // single threaded sections).
+#  if defined(RUSAGE_THREAD)
+      if (getrusage(RUSAGE_THREAD, &ru) != 0)
+        return false;
+#  else
+      if (getrusage(RUSAGE_SELF, &ru) != 0)
+        return false;
+#  endif
+
+      sample.faults = (uint64_t)ru.ru_minflt + (uint64_t)ru.ru_majflt;
+      sample.switches = (uint64_t)ru.ru_nvcsw;
+      return true;
+#else
+      (void)sample;
+      return false;
+#endif
+    }
+
+    RealTimeGuard::RealTimeGuard(const char* name, double budget):
+      m_name(name),
+      m_budget(budget),
+      m_entry(0),
+      m_active(false)
+    {
+      if (!enabled())
+        return;
+
+      m_entry = Time::Clock::get();
+      m_active = sample(m_start);
+    }
+
+    RealTimeGuard::~RealTimeGuard(void)
+    {
+      if (!enabled())
+        return;
+
+      double elapsed = Time::Clock::get() - m_entry;
+
+      if (m_active)
+      {
+        Sample end;
+        if (sample(end))
+        {
+          if (end.faults > m_start.faults)
+            DUNE_WRN(m_name, DTR("real-time violation: ")
+                     << end.faults - m_start.faults
+                     << DTR(" page fault(s), possible allocation"));
+
+          if (end.switches > m_start.switches)
+            DUNE_WRN(m_name, DTR("real-time violation: ")
+                     << end.switches - m_start.switches
+                     << DTR(" voluntary context switch(es), possible"
+                            " blocking call"));
+        }
+      }
+
+      if (m_budget > 0 && elapsed > m_budget)
+        DUNE_WRN(m_name, DTR("real-time violation: ran for ")
+                 << elapsed << DTR(" s of a ") << m_budget
+                 << DTR(" s budget"));
+    }
+  }
+}
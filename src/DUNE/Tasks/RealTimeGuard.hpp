@@ -0,0 +1,105 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+#ifndef DUNE_TASKS_REAL_TIME_GUARD_HPP_INCLUDED_
+#define DUNE_TASKS_REAL_TIME_GUARD_HPP_INCLUDED_
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+
+namespace DUNE
+{
+  namespace Tasks
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM RealTimeGuard;
+
+    //! Scope guard for real-time critical code paths.
+    //!
+    //! Instantiate at the top of a callback that must not allocate,
+    //! block or overrun its period (e.g. path control consumers or
+    //! actuator paths). While the guarded scope runs, the guard
+    //! watches the calling thread for page faults (the footprint of
+    //! heap growth), voluntary context switches (the footprint of
+    //! blocking locks and slow syscalls) and elapsed time, and
+    //! reports violations with the section name on exit.
+    //!
+    //! The checker is disabled by default and the disabled guard
+    //! reduces to a pair of branches, so guards may be left in
+    //! release builds. Define the environment variable DUNE_RT_CHECK
+    //! to enable it.
+    class RealTimeGuard
+    {
+    public:
+      //! Guard the enclosing scope.
+      //! @param[in] name section name used in violation reports;
+      //! must outlive the guard (string literals are typical).
+      //! @param[in] budget maximum tolerated execution time in
+      //! seconds, 0 to check only for allocation and blocking.
+      RealTimeGuard(const char* name, double budget = 0.0);
+
+      //! Check the section and report violations.
+      ~RealTimeGuard(void);
+
+      //! Test if the runtime checker is enabled.
+      //! @return true if enabled, false otherwise.
+      static bool
+      enabled(void);
+
+    private:
+      //! Thread accounting sample.
+      struct Sample
+      {
+        //! Minor and major page faults.
+        uint64_t faults;
+        //! Voluntary context switches.
+        uint64_t switches;
+      };
+
+      //! Section name.
+      const char* m_name;
+      //! Execution time budget (s).
+      double m_budget;
+      //! Entry time stamp (s).
+      double m_entry;
+      //! Entry accounting sample.
+      Sample m_start;
+      //! True if the entry sample is valid.
+      bool m_active;
+
+      //! Sample the calling thread's accounting counters.
+      //! @param[out] sample destination sample.
+      //! @return true on success, false if unsupported.
+      static bool
+      sample(Sample& sample);
+    };
+  }
+}
+
+#endif
@@ -28,11 +28,16 @@
 //***************************************************************************
 
 // ISO C++ 98 headers.
+#include <algorithm>
 #include <cstddef>
+#include <cstring>
 
 // DUNE headers.
 #include <DUNE/IMC/Bus.hpp>
 #include <DUNE/IMC/Factory.hpp>
+#include <DUNE/Concurrency/ScopedMutex.hpp>
+#include <DUNE/Time/Clock.hpp>
+#include <DUNE/Time/CycleClock.hpp>
 #include <DUNE/Tasks/Context.hpp>
 #include <DUNE/Tasks/Recipient.hpp>
 
@@ -40,20 +45,36 @@ namespace DUNE
 {
   namespace Tasks
   {
+    bool
+    Recipient::dispatchEntryLess(const DispatchEntry& a,
+                                 const DispatchEntry& b)
+    {
+      return a.id < b.id;
+    }
+
     Recipient::Recipient(AbstractTask* task, Context& ctx):
       m_task(task),
-      m_ctx(ctx)
-    { }
+      m_ctx(ctx),
+      m_depth_hwm(0),
+      m_consumed(0)
+    {
+      std::memset(m_latency, 0, sizeof(m_latency));
+      m_ctx.qstats.add(this);
+      m_hb = m_ctx.heartbeats.acquire(task->getName());
+    }
 
     Recipient::~Recipient(void)
     {
+      m_ctx.heartbeats.release(m_hb);
+      m_ctx.qstats.remove(this);
+
       unbindAll();
 
       while (!m_mqueue.empty())
       {
-        IMC::Message* msg = m_mqueue.pop();
+        IMC::SharedMessage* msg = m_mqueue.pop();
         if (msg)
-          delete msg;
+          msg->release();
       }
     }
 
@@ -71,21 +92,97 @@ namespace DUNE
 
         itr->second.clear();
       }
+
+      std::map<uint32_t, std::vector<AbstractBatchConsumer*> >::iterator bitr = m_batch_cbacks.begin();
+
+      for (; bitr != m_batch_cbacks.end(); ++bitr)
+      {
+        if (m_cbacks.find(bitr->first) == m_cbacks.end())
+          m_ctx.mbus.unregisterRecipient(m_task, bitr->first);
+
+        for (size_t i = 0; i < bitr->second.size(); ++i)
+          delete bitr->second[i];
+
+        bitr->second.clear();
+      }
+
+      m_dispatch.clear();
+    }
+
+    void
+    Recipient::rebuildDispatchTable(void)
+    {
+      m_dispatch.clear();
+
+      std::map<uint32_t, std::vector<AbstractConsumer*> >::iterator itr = m_cbacks.begin();
+      for (; itr != m_cbacks.end(); ++itr)
+      {
+        DispatchEntry entry;
+        entry.id = itr->first;
+        entry.cbacks = &itr->second;
+        entry.single = (itr->second.size() == 1) ? itr->second[0] : NULL;
+        entry.batch = m_batch_cbacks.find(itr->first) != m_batch_cbacks.end();
+        m_dispatch.push_back(entry);
+      }
+
+      std::map<uint32_t, std::vector<AbstractBatchConsumer*> >::iterator bitr = m_batch_cbacks.begin();
+      for (; bitr != m_batch_cbacks.end(); ++bitr)
+      {
+        if (m_cbacks.find(bitr->first) != m_cbacks.end())
+          continue;
+
+        DispatchEntry entry;
+        entry.id = bitr->first;
+        entry.cbacks = NULL;
+        entry.single = NULL;
+        entry.batch = true;
+        m_dispatch.push_back(entry);
+      }
+
+      std::sort(m_dispatch.begin(), m_dispatch.end(), dispatchEntryLess);
+    }
+
+    Recipient::DispatchEntry*
+    Recipient::findDispatch(uint32_t id)
+    {
+      DispatchEntry key;
+      key.id = id;
+
+      std::vector<DispatchEntry>::iterator itr
+        = std::lower_bound(m_dispatch.begin(), m_dispatch.end(), key,
+                           dispatchEntryLess);
+      if (itr == m_dispatch.end() || itr->id != id)
+        return NULL;
+
+      return &(*itr);
     }
 
     void
-    Recipient::bind(uint32_t id, AbstractConsumer* consumer)
+    Recipient::bind(uint32_t id, AbstractConsumer* consumer, double max_rate)
     {
-      std::map<uint32_t, std::vector<AbstractConsumer*> >::iterator itr = m_cbacks.find(id);
-      if (itr == m_cbacks.end())
-        m_ctx.mbus.registerRecipient(m_task, id);
+      // The bus deduplicates repeated registrations and keeps the
+      // least restrictive declared rate.
+      m_ctx.mbus.registerRecipient(m_task, id, max_rate);
 
       m_cbacks[id].push_back(consumer);
+      rebuildDispatchTable();
+    }
+
+    void
+    Recipient::bindBatch(uint32_t id, AbstractBatchConsumer* consumer)
+    {
+      m_ctx.mbus.registerRecipient(m_task, id);
+
+      m_batch_cbacks[id].push_back(consumer);
+      rebuildDispatchTable();
     }
 
     void
     Recipient::waitForMessages(double timeout)
     {
+      if (m_hb != NULL)
+        m_hb->touch();
+
       if (m_mqueue.waitForItems(timeout))
         runCallBacks();
     }
@@ -93,24 +190,161 @@ namespace DUNE
     void
     Recipient::put(const IMC::Message* msg)
     {
-      m_mqueue.push(msg->clone());
+      m_mqueue.push(IMC::SharedMessage::create(msg));
+    }
+
+    void
+    Recipient::put(IMC::SharedMessage* msg)
+    {
+      m_mqueue.push(msg->addRef());
     }
 
     void
     Recipient::runCallBacks(void)
     {
       unsigned int size = m_mqueue.size();
+      double now = Time::Clock::get();
+
+      if (m_hb != NULL)
+        m_hb->touch();
+
+      // Publish the batch time: deltas computed by the consumers of
+      // this batch all see the same 'now' without reading the clock.
+      Time::CycleClock::set(now);
+
+      {
+        Concurrency::ScopedMutex l(m_stats_lock);
+        if (size > m_depth_hwm)
+          m_depth_hwm = size;
+      }
 
       for (unsigned int i = 0; i < size; ++i)
       {
-        const IMC::Message* msg = m_mqueue.pop();
-        if (msg)
+        IMC::SharedMessage* env = m_mqueue.pop();
+        if (env)
         {
+          accountDelivery(env, now);
+
+          const IMC::Message* msg = env->get();
           uint32_t id = msg->getId();
-          for (size_t j = 0; j < m_cbacks[id].size(); ++j)
-            m_cbacks[id][j]->consume(msg);
-          delete msg;
+
+          if (m_hb != NULL)
+            m_hb->context = id;
+
+          // Single binary search in the flattened table instead of
+          // one map lookup per callback map.
+          DispatchEntry* entry = findDispatch(id);
+          if (entry != NULL && entry->cbacks != NULL)
+          {
+            uint64_t enter = Time::Clock::getNsec();
+            if (entry->single != NULL)
+            {
+              entry->single->deliver(msg);
+            }
+            else
+            {
+              std::vector<AbstractConsumer*>& cbacks = *entry->cbacks;
+              for (size_t j = 0; j < cbacks.size(); ++j)
+                cbacks[j]->deliver(msg);
+            }
+            accountConsume(id, 1, Time::Clock::getNsec() - enter);
+          }
+
+          // Messages with batch consumers are accumulated and
+          // delivered together once the queue is drained.
+          if (entry != NULL && entry->batch)
+            m_batches[id].push_back(env);
+          else
+            env->release();
+
+          if (m_hb != NULL)
+          {
+            m_hb->context = Concurrency::c_heartbeat_no_context;
+            m_hb->touch();
+          }
+        }
+      }
+
+      if (m_batch_cbacks.empty())
+        return;
+
+      std::map<uint32_t, std::vector<IMC::SharedMessage*> >::iterator itr = m_batches.begin();
+      for (; itr != m_batches.end(); ++itr)
+      {
+        std::vector<IMC::SharedMessage*>& envs = itr->second;
+        if (envs.empty())
+          continue;
+
+        std::vector<const IMC::Message*> msgs(envs.size());
+        for (size_t i = 0; i < envs.size(); ++i)
+          msgs[i] = envs[i]->get();
+
+        if (m_hb != NULL)
+          m_hb->context = itr->first;
+
+        std::vector<AbstractBatchConsumer*>& cbacks = m_batch_cbacks[itr->first];
+        uint64_t enter = Time::Clock::getNsec();
+        for (size_t i = 0; i < cbacks.size(); ++i)
+          cbacks[i]->consume(msgs);
+        accountConsume(itr->first, msgs.size(), Time::Clock::getNsec() - enter);
+
+        if (m_hb != NULL)
+        {
+          m_hb->context = Concurrency::c_heartbeat_no_context;
+          m_hb->touch();
         }
+
+        for (size_t i = 0; i < envs.size(); ++i)
+          envs[i]->release();
+
+        envs.clear();
+      }
+    }
+
+    void
+    Recipient::accountDelivery(const IMC::SharedMessage* env, double now)
+    {
+      double delta = now - env->getCreationTime();
+
+      unsigned bucket = 0;
+      while (bucket < c_queue_lat_buckets - 1 && delta >= c_queue_lat_bounds[bucket])
+        ++bucket;
+
+      Concurrency::ScopedMutex l(m_stats_lock);
+      ++m_consumed;
+      ++m_latency[bucket];
+    }
+
+    void
+    Recipient::accountConsume(uint32_t id, uint64_t count, uint64_t time_nsec)
+    {
+      Concurrency::ScopedMutex l(m_stats_lock);
+      std::pair<uint64_t, uint64_t>& entry = m_consume_stats[id];
+      entry.first += count;
+      entry.second += time_nsec;
+    }
+
+    void
+    Recipient::getStats(QueueStats& stats)
+    {
+      stats.name = m_task->getName();
+      stats.depth = m_mqueue.size();
+
+      Concurrency::ScopedMutex l(m_stats_lock);
+      stats.depth_hwm = m_depth_hwm;
+      stats.consumed = m_consumed;
+      std::memcpy(stats.latency, m_latency, sizeof(m_latency));
+
+      stats.consumers.clear();
+      stats.consumers.reserve(m_consume_stats.size());
+      std::map<uint32_t, std::pair<uint64_t, uint64_t> >::const_iterator itr = m_consume_stats.begin();
+      for (; itr != m_consume_stats.end(); ++itr)
+      {
+        ConsumerStats cs;
+        cs.id = itr->first;
+        cs.count = itr->second.first;
+        cs.time_nsec = itr->second.second;
+        stats.consumers.push_back(cs);
       }
     }
   }
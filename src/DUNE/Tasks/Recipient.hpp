@@ -36,8 +36,13 @@
 
 // DUNE headers.
 #include <DUNE/Concurrency/TSQueue.hpp>
+#include <DUNE/Concurrency/Mutex.hpp>
+#include <DUNE/Concurrency/Heartbeat.hpp>
+#include <DUNE/IMC/SharedMessage.hpp>
 #include <DUNE/Tasks/Consumer.hpp>
+#include <DUNE/Tasks/BatchConsumer.hpp>
 #include <DUNE/Tasks/AbstractTask.hpp>
+#include <DUNE/Tasks/QueueStats.hpp>
 
 namespace DUNE
 {
@@ -65,7 +70,21 @@ namespace DUNE
       put(const IMC::Message*);
 
       void
-      bind(uint32_t id, AbstractConsumer* c);
+      put(IMC::SharedMessage*);
+
+      //! Register a consumer of a message identifier, optionally
+      //! declaring the maximum delivery rate. Decimation is applied
+      //! bus-side per task: when several consumers bind the same
+      //! identifier the least restrictive rate wins.
+      //! @param[in] id message identifier.
+      //! @param[in] c consumer object.
+      //! @param[in] max_rate maximum delivery rate in Hertz (0
+      //! delivers every message).
+      void
+      bind(uint32_t id, AbstractConsumer* c, double max_rate = 0.0);
+
+      void
+      bindBatch(uint32_t id, AbstractBatchConsumer* c);
 
       void
       waitForMessages(double timeout);
@@ -73,15 +92,91 @@ namespace DUNE
       void
       runCallBacks(void);
 
+      //! Retrieve the number of messages waiting in the queue.
+      //! @return queue depth.
+      unsigned
+      getQueueDepth(void)
+      {
+        return m_mqueue.size();
+      }
+
+      //! Retrieve a snapshot of the queue counters.
+      //! @param[out] stats queue counters.
+      void
+      getStats(QueueStats& stats);
+
     private:
+      //! Flattened dispatch table entry of one message identifier.
+      struct DispatchEntry
+      {
+        //! Message identification number.
+        uint32_t id;
+        //! Consumers, NULL when the identifier only has batch
+        //! consumers.
+        std::vector<AbstractConsumer*>* cbacks;
+        //! Sole consumer, NULL when there are zero or several.
+        AbstractConsumer* single;
+        //! True when the identifier has batch consumers.
+        bool batch;
+      };
+
       //! Task.
       AbstractTask* m_task;
       //! Context.
       Context& m_ctx;
       //! Callbacks.
       std::map<uint32_t, std::vector<AbstractConsumer*> > m_cbacks;
+      //! Dispatch table flattened from the callback maps, sorted by
+      //! identifier.
+      std::vector<DispatchEntry> m_dispatch;
+      //! Batch callbacks.
+      std::map<uint32_t, std::vector<AbstractBatchConsumer*> > m_batch_cbacks;
+      //! Messages pending batch delivery, grouped by identifier.
+      std::map<uint32_t, std::vector<IMC::SharedMessage*> > m_batches;
       //! Message queue.
-      Concurrency::TSQueue<IMC::Message*> m_mqueue;
+      Concurrency::TSQueue<IMC::SharedMessage*> m_mqueue;
+      //! Highest queue depth observed when draining.
+      unsigned m_depth_hwm;
+      //! Total number of messages consumed.
+      uint64_t m_consumed;
+      //! Delivery latency histogram (dispatch to consume).
+      uint64_t m_latency[c_queue_lat_buckets];
+      //! Consumed count and cumulative consumer time by message type.
+      std::map<uint32_t, std::pair<uint64_t, uint64_t> > m_consume_stats;
+      //! Lock to serialize counter snapshots against updates.
+      Concurrency::Mutex m_stats_lock;
+      //! Liveness slot of the task's message loop, NULL when the
+      //! registry is full.
+      Concurrency::HeartbeatSlot* m_hb;
+
+      //! Order dispatch table entries by message identifier.
+      static bool
+      dispatchEntryLess(const DispatchEntry& a, const DispatchEntry& b);
+
+      //! Rebuild the flattened dispatch table from the callback
+      //! maps. Called whenever a consumer is bound.
+      void
+      rebuildDispatchTable(void);
+
+      //! Locate the dispatch table entry of a message identifier.
+      //! @param[in] id message identification number.
+      //! @return dispatch entry, NULL if the identifier is unbound.
+      DispatchEntry*
+      findDispatch(uint32_t id);
+
+      //! Account for one consumed message.
+      //! @param[in] env message envelope.
+      //! @param[in] now current time.
+      void
+      accountDelivery(const IMC::SharedMessage* env, double now);
+
+      //! Account for time spent inside the consumers of a message
+      //! type.
+      //! @param[in] id message identification number.
+      //! @param[in] count number of messages consumed.
+      //! @param[in] time_nsec time spent in the consumers.
+      void
+      accountConsume(uint32_t id, uint64_t count, uint64_t time_nsec);
     };
   }
 }
@@ -29,6 +29,9 @@
 
 // DUNE headers.
 #include <DUNE/Tasks/SimpleTransport.hpp>
+#include <DUNE/Tasks/Context.hpp>
+#include <DUNE/Tasks/Exceptions.hpp>
+#include <DUNE/IMC/Factory.hpp>
 #include <DUNE/Time/Clock.hpp>
 #include <DUNE/Utils/String.hpp>
 
@@ -36,9 +39,15 @@ namespace DUNE
 {
   namespace Tasks
   {
+    //! Queue wait timeout of the main loop when reception runs on
+    //! the shared input thread.
+    static const double c_mux_wait = 0.1;
+
     SimpleTransport::SimpleTransport(const std::string& name, Tasks::Context& ctx):
       Tasks::Task(name, ctx),
-      m_buf(2048)
+      m_buf(2048),
+      m_mux_listener(*this),
+      m_flt_drops(0)
     {
       param("Transports", m_gargs.transports)
       .defaultValue("")
@@ -48,6 +57,30 @@ namespace DUNE
       .defaultValue("")
       .description("List of <Message>:<Frequency>");
 
+      param("Decimation Filters", m_gargs.decim)
+      .defaultValue("")
+      .description("List of <Message>:<Factor> that define the messages decimated,"
+                   " keeping one in every <Factor>, while the receiving queue is"
+                   " above the decimation threshold");
+
+      param("Decimation Threshold", m_gargs.decim_threshold)
+      .defaultValue("0")
+      .description("Receiving queue depth above which decimation engages, zero"
+                   " disables decimation");
+
+      param("Bandwidth Limiters", m_gargs.brates)
+      .defaultValue("")
+      .description("List of <Message>:<BytesPerSecond> byte budgets; messages"
+                   " of a listed type that would exceed their budget are"
+                   " dropped");
+
+      param("Bandwidth Report Period", m_gargs.bw_period)
+      .defaultValue("10.0")
+      .minimumValue("1.0")
+      .units(Units::Second)
+      .description("Period between bandwidth accounting reports, output at"
+                   " debug level");
+
       param("Filtered Entities", m_gargs.entities_flt)
       .description("List of <Message>:<Entity>+<Entity> that define the source entities allowed to pass message of a specific message type.");
 
@@ -58,6 +91,12 @@ namespace DUNE
       param("Trace - Outgoing Messages", m_gargs.trace_out)
       .defaultValue("false")
       .description("Enable verbose output regarding outgoing messages");
+
+      param("Shared Input Thread", m_gargs.shared_input)
+      .defaultValue("false")
+      .description("Service reception on the shared input thread instead of"
+                   " polling on a dedicated one, when the transport supports"
+                   " it");
     }
 
     SimpleTransport::~SimpleTransport(void)
@@ -67,7 +106,10 @@ namespace DUNE
     SimpleTransport::consume(const IMC::Message* msg)
     {
       if (m_rl.filter(msg))
+      {
+        ++m_flt_drops;
         return;
+      }
 
       unsigned int n = msg->getSerializationSize();
 
@@ -80,6 +122,8 @@ namespace DUNE
       if (m_gargs.trace_out)
         inf(DTR("outgoing: %s"), msg->getName());
 
+      m_tx_bytes[msg->getId()] += n;
+
       onDataTransmission(p, n);
     }
 
@@ -87,15 +131,68 @@ namespace DUNE
     SimpleTransport::onMain(void)
     {
       m_rl.setupRates(m_gargs.rlim);
+      m_rl.setupByteRates(m_gargs.brates);
       m_rl.setupEntities(m_gargs.entities_flt, this);
+      m_rl.setupDecimation(m_gargs.decim, m_gargs.decim_threshold);
+      m_bw_timer.setTop(m_gargs.bw_period);
       bind(this, m_gargs.transports);
 
-      while (!stopping())
+      IO::Handle* handle = NULL;
+      if (m_gargs.shared_input)
       {
-        consumeMessages();
+        {
+          // Discard errors from a previous run.
+          Concurrency::ScopedMutex l(m_mux_lock);
+          m_mux_error.clear();
+        }
 
-        onDataReception(m_buf.getBuffer(), m_buf.getCapacity(), 0.005);
+        handle = getIOHandle();
+        if (handle == NULL)
+          war(DTR("shared input thread not supported, polling on a dedicated one"));
+        else
+          m_ctx.iomux.add(handle, &m_mux_listener);
+      }
+
+      try
+      {
+        while (!stopping())
+        {
+          m_rl.setQueueDepth(getQueueDepth());
+
+          if (handle != NULL)
+          {
+            // Reception runs on the shared input thread; this thread
+            // blocks on the message queue and only wakes for
+            // outgoing traffic.
+            waitForMessages(c_mux_wait);
+            onFlush();
+
+            {
+              Concurrency::ScopedMutex l(m_mux_lock);
+              if (!m_mux_error.empty())
+                throw RestartNeeded(m_mux_error, 5);
+            }
+          }
+          else
+          {
+            consumeMessages();
+            onDataReception(m_buf.getBuffer(), m_buf.getCapacity(), 0.005);
+          }
+
+          reportBandwidth();
+        }
       }
+      catch (...)
+      {
+        // The handle is about to be released by the restart
+        // machinery and must not be polled again.
+        if (handle != NULL)
+          m_ctx.iomux.remove(handle);
+        throw;
+      }
+
+      if (handle != NULL)
+        m_ctx.iomux.remove(handle);
     }
 
     void
@@ -112,9 +209,56 @@ namespace DUNE
           if (m_gargs.trace_in)
             inf(DTR("incoming: %s"), m->getName());
 
+          {
+            Concurrency::ScopedMutex l(m_bw_lock);
+            m_rx_bytes[m->getId()] += m->getSerializationSize();
+          }
+
           delete m;
         }
       }
     }
+
+    void
+    SimpleTransport::reportBandwidth(void)
+    {
+      if (!m_bw_timer.overflow())
+        return;
+
+      double period = m_bw_timer.getTop();
+      m_bw_timer.reset();
+
+      std::map<uint32_t, uint64_t> rx;
+      {
+        Concurrency::ScopedMutex l(m_bw_lock);
+        rx.swap(m_rx_bytes);
+      }
+
+      uint64_t tx_total = 0;
+      uint64_t rx_total = 0;
+
+      std::map<uint32_t, uint64_t>::iterator itr = m_tx_bytes.begin();
+      for (; itr != m_tx_bytes.end(); ++itr)
+      {
+        tx_total += itr->second;
+        trace("tx %s: %0.1f B/s",
+              IMC::Factory::getAbbrevFromId(itr->first).c_str(),
+              itr->second / period);
+      }
+
+      for (itr = rx.begin(); itr != rx.end(); ++itr)
+      {
+        rx_total += itr->second;
+        trace("rx %s: %0.1f B/s",
+              IMC::Factory::getAbbrevFromId(itr->first).c_str(),
+              itr->second / period);
+      }
+
+      debug("bandwidth: tx %0.1f B/s, rx %0.1f B/s, %u dropped by filters",
+            tx_total / period, rx_total / period, (unsigned)m_flt_drops);
+
+      m_tx_bytes.clear();
+      m_flt_drops = 0;
+    }
   }
 }
@@ -31,14 +31,20 @@
 #define DUNE_TASKS_SIMPLE_TRANSPORT_HPP_INCLUDED_
 
 // ISO C++ 98 headers.
+#include <map>
 #include <vector>
 
 // DUNE headers.
 #include <DUNE/Config.hpp>
 #include <DUNE/Utils/ByteBuffer.hpp>
 #include <DUNE/IMC/Parser.hpp>
+#include <DUNE/IO/Handle.hpp>
+#include <DUNE/IO/Multiplexer.hpp>
+#include <DUNE/Concurrency/Mutex.hpp>
+#include <DUNE/Concurrency/ScopedMutex.hpp>
 #include <DUNE/Tasks/Task.hpp>
 #include <DUNE/Tasks/MessageFilter.hpp>
+#include <DUNE/Time/Counter.hpp>
 
 namespace DUNE
 {
@@ -67,26 +73,110 @@ namespace DUNE
       virtual void
       onDataReception(uint8_t* p, unsigned int n, double timeout) = 0;
 
+      //! Retrieve the I/O handle to register with the shared input
+      //! thread. Transports that can have their reception serviced
+      //! by the context's multiplexer override this; the handle must
+      //! remain valid for the lifetime of the main loop. The default
+      //! keeps the dedicated polling loop.
+      //! @return I/O handle or NULL.
+      virtual IO::Handle*
+      getIOHandle(void)
+      {
+        return NULL;
+      }
+
+      //! Called once per main loop cycle when reception runs on the
+      //! shared input thread, for housekeeping that the dedicated
+      //! polling loop would otherwise perform (e.g. flushing
+      //! coalesced output).
+      virtual void
+      onFlush(void)
+      { }
+
       void
       handleData(IMC::Parser& parser, const uint8_t* p, unsigned int n);
 
     private:
+      //! Adapter delivering multiplexer callbacks to the transport.
+      //! Callbacks run on the shared input thread.
+      class MuxListener: public IO::Multiplexer::Listener
+      {
+      public:
+        MuxListener(SimpleTransport& parent):
+          m_parent(parent)
+        { }
+
+        void
+        onDataReception(IO::Handle* handle, const uint8_t* bfr, size_t size)
+        {
+          (void)handle;
+          m_parent.handleData(m_parent.m_mux_parser, bfr, size);
+        }
+
+        void
+        onReceptionError(IO::Handle* handle, const std::string& error)
+        {
+          (void)handle;
+          Concurrency::ScopedMutex l(m_parent.m_mux_lock);
+          m_parent.m_mux_error = error;
+        }
+
+      private:
+        //! Transport serviced by this listener.
+        SimpleTransport& m_parent;
+      };
+
       struct GArguments
       {
         // List of messages to publish.
         std::vector<std::string> transports;
         // Rate limits.
         std::vector<std::string> rlim;
+        // Decimation filters.
+        std::vector<std::string> decim;
+        // Decimation queue threshold.
+        unsigned decim_threshold;
         // Filtered entities.
         std::vector<std::string> entities_flt;
         // Trace incoming messages.
         bool trace_in;
         // Trace outgoing messages.
         bool trace_out;
+        // Service reception on the shared input thread.
+        bool shared_input;
+        // Byte rate limiters.
+        std::vector<std::string> brates;
+        // Bandwidth report period.
+        double bw_period;
       };
       GArguments m_gargs;
       Utils::ByteBuffer m_buf;
       MessageFilter m_rl;
+      //! Multiplexer callback adapter.
+      MuxListener m_mux_listener;
+      //! Parser used on the shared input thread.
+      IMC::Parser m_mux_parser;
+      //! Reception error raised on the shared input thread, handled
+      //! on the task thread.
+      std::string m_mux_error;
+      //! Lock to serialize access to m_mux_error.
+      Concurrency::Mutex m_mux_lock;
+      //! Transmitted bytes by message type since the last report.
+      std::map<uint32_t, uint64_t> m_tx_bytes;
+      //! Received bytes by message type since the last report.
+      std::map<uint32_t, uint64_t> m_rx_bytes;
+      //! Messages dropped by the filters since the last report.
+      uint64_t m_flt_drops;
+      //! Bandwidth report timer.
+      Time::Counter<double> m_bw_timer;
+      //! Lock guarding the reception counters, which are updated on
+      //! the shared input thread.
+      Concurrency::Mutex m_bw_lock;
+
+      //! Output the per message type bandwidth counters accumulated
+      //! over the last report period and reset them.
+      void
+      reportBandwidth(void);
     };
   }
 }
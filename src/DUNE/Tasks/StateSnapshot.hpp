@@ -0,0 +1,110 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+#ifndef DUNE_TASKS_STATE_SNAPSHOT_HPP_INCLUDED_
+#define DUNE_TASKS_STATE_SNAPSHOT_HPP_INCLUDED_
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+#include <DUNE/Concurrency/RWLock.hpp>
+#include <DUNE/Concurrency/ScopedRWLock.hpp>
+#include <DUNE/IMC/Definitions.hpp>
+
+namespace DUNE
+{
+  namespace Tasks
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM StateSnapshot;
+
+    //! Latest navigation state of the system, shared by all tasks of
+    //! a context. The dispatch path keeps it current, so tasks that
+    //! only need the most recent pose can poll it at their own rate
+    //! instead of subscribing to every EstimatedState sample.
+    class StateSnapshot
+    {
+    public:
+      StateSnapshot(void):
+        m_seq(0)
+      { }
+
+      //! Publish a new state, replacing the previous one.
+      //! @param[in] state state to publish.
+      void
+      update(const IMC::EstimatedState& state)
+      {
+        Concurrency::ScopedRWLock l(m_lock, true);
+        m_state = state;
+        ++m_seq;
+      }
+
+      //! Read the latest state.
+      //! @param[out] state copy of the latest state.
+      //! @return true if a state was ever published, false otherwise.
+      bool
+      read(IMC::EstimatedState& state) const
+      {
+        Concurrency::ScopedRWLock l(m_lock);
+        if (m_seq == 0)
+          return false;
+
+        state = m_state;
+        return true;
+      }
+
+      //! Read the latest state if it is newer than the one the caller
+      //! last saw.
+      //! @param[out] state copy of the latest state.
+      //! @param[in,out] seq sequence number of the caller's last
+      //! copy, initially 0; updated on a successful read.
+      //! @return true if a newer state was copied, false otherwise.
+      bool
+      read(IMC::EstimatedState& state, unsigned& seq) const
+      {
+        Concurrency::ScopedRWLock l(m_lock);
+        if (m_seq == 0 || m_seq == seq)
+          return false;
+
+        state = m_state;
+        seq = m_seq;
+        return true;
+      }
+
+    private:
+      //! Lock to serialize access to the state.
+      mutable Concurrency::RWLock m_lock;
+      //! Latest published state.
+      IMC::EstimatedState m_state;
+      //! Number of states published so far.
+      unsigned m_seq;
+    };
+  }
+}
+
+#endif
@@ -31,6 +31,7 @@
 // ISO C++ 98 headers.
 #include <sstream>
 #include <cstddef>
+#include <cstdio>
 
 // DUNE headers.
 #include <DUNE/IMC/Constants.hpp>
@@ -42,6 +43,7 @@
 #include <DUNE/Tasks/Context.hpp>
 #include <DUNE/Tasks/Exceptions.hpp>
 #include <DUNE/Tasks/Task.hpp>
+#include <DUNE/Utils/String.hpp>
 #include <DUNE/Utils/XML.hpp>
 
 #if defined(DUNE_OS_LINUX)
@@ -76,6 +78,11 @@ namespace DUNE
       .defaultValue("10")
       .description(DTR("Execution priority"));
 
+      param(DTR_RT("CPU Affinity"), m_args.affinity)
+      .defaultValue("")
+      .description(DTR("Comma separated list of CPUs the task may execute"
+                       " on, empty to run on any CPU"));
+
       param(DTR_RT("Activation Time"), m_args.act_time)
       .defaultValue("0");
 
@@ -346,11 +353,23 @@ namespace DUNE
 
       try
       {
-        setPriority(m_args.priority);
+        Concurrency::Runnable::setPriority(Concurrency::Scheduler::get(), m_args.priority);
       }
       catch (...)
       { }
 
+      if (!m_args.affinity.empty())
+      {
+        try
+        {
+          setAffinity(m_args.affinity);
+        }
+        catch (std::exception& e)
+        {
+          war(DTR("unable to set CPU affinity: %s"), e.what());
+        }
+      }
+
       while (!stopping())
       {
         try
@@ -418,7 +437,12 @@ namespace DUNE
         msg->setSource(getSystemId());
 
       if ((flags & DF_KEEP_TIME) == 0)
-        msg->setTimeStamp();
+      {
+        if ((flags & DF_COARSE_TIME) != 0)
+          msg->setTimeStamp(Time::Clock::getSinceEpochCoarse());
+        else
+          msg->setTimeStamp();
+      }
 
       if ((flags & DF_KEEP_SRC_EID) == 0)
       {
@@ -426,12 +450,72 @@ namespace DUNE
           msg->setSourceEntity(getEntityId());
       }
 
+      if (msg->getId() == IMC::EstimatedState::getIdStatic())
+        m_ctx.sstate.update(*static_cast<const IMC::EstimatedState*>(msg));
+
+      if (msg->getId() == IMC::SoundSpeed::getIdStatic())
+      {
+        // Feed the shared profile at the depth the sample was
+        // measured, taken from the latest navigation state.
+        const IMC::SoundSpeed* ss = static_cast<const IMC::SoundSpeed*>(msg);
+        if (ss->value > 0)
+        {
+          IMC::EstimatedState state;
+          double depth = m_ctx.sstate.read(state) ? state.depth : 0.0;
+          m_ctx.svp.update(depth, ss->value);
+        }
+      }
+
+      if ((flags & DF_BULK) != 0)
+      {
+        // Declared handoff to the logger: when accepted, the
+        // message reaches the log without touching the bus.
+        if (m_ctx.lsink.log(*msg))
+          return;
+      }
+
       if ((flags & DF_LOOP_BACK) == 0)
         m_ctx.mbus.dispatch(msg, this);
       else
         m_ctx.mbus.dispatch(msg);
     }
 
+    void
+    Task::dispatch(IMC::SharedMessage* env, unsigned int flags)
+    {
+      // The caller holds the only reference, so patching the
+      // enclosed message in place is safe.
+      IMC::Message* msg = const_cast<IMC::Message*>(env->get());
+
+      if (!IMC::AddressResolver::isValid(msg->getSource()))
+        msg->setSource(getSystemId());
+
+      if ((flags & DF_KEEP_TIME) == 0)
+      {
+        if ((flags & DF_COARSE_TIME) != 0)
+          msg->setTimeStamp(Time::Clock::getSinceEpochCoarse());
+        else
+          msg->setTimeStamp();
+      }
+
+      if ((flags & DF_KEEP_SRC_EID) == 0)
+      {
+        if (msg->getSourceEntity() == DUNE_IMC_CONST_UNK_EID)
+          msg->setSourceEntity(getEntityId());
+      }
+
+      if ((flags & DF_BULK) != 0)
+      {
+        if (m_ctx.lsink.log(*msg))
+          return;
+      }
+
+      if ((flags & DF_LOOP_BACK) == 0)
+        m_ctx.mbus.dispatch(env, this);
+      else
+        m_ctx.mbus.dispatch(env);
+    }
+
     void
     Task::onQueryEntityParameters(const IMC::QueryEntityParameters* msg)
     {
@@ -441,6 +525,24 @@ namespace DUNE
       IMC::EntityParameters params;
       params.name = getEntityLabel();
 
+      // The reply always carries the table generation as a synthetic
+      // first parameter. A client that sends the generation of its
+      // last full read back in the scope field ("generation=N") gets
+      // only this parameter when the table did not change, instead of
+      // the full description tree.
+      IMC::EntityParameter gen;
+      gen.name = ".generation";
+      gen.value = Utils::String::str("%u", m_params.getGeneration());
+      params.params.push_back(gen);
+
+      unsigned known_gen = 0;
+      if (std::sscanf(msg->scope.c_str(), "generation=%u", &known_gen) == 1
+          && known_gen == m_params.getGeneration())
+      {
+        dispatchReply(*msg, params);
+        return;
+      }
+
       std::map<std::string, Parameter*>::const_iterator itr = m_params.begin();
       for (; itr != m_params.end(); ++itr)
       {
@@ -465,12 +567,20 @@ namespace DUNE
       if (msg->name != getEntityLabel())
         return;
 
+      bool changed = false;
+
       IMC::MessageList<IMC::EntityParameter>::const_iterator itr = msg->params.begin();
       for (; itr != msg->params.end(); ++itr)
       {
+        // Synthetic parameters (".generation") may be echoed back by
+        // clients and are not part of the table.
+        if (!(*itr)->name.empty() && (*itr)->name[0] == '.')
+          continue;
+
         try
         {
-          m_params.set((*itr)->name, (*itr)->value);
+          if (m_params.set((*itr)->name, (*itr)->value))
+            changed = true;
         }
         catch (std::runtime_error& e)
         {
@@ -479,7 +589,20 @@ namespace DUNE
         }
       }
 
-      updateParameters();
+      // Only run the update path when a value actually changed:
+      // tasks that cycle devices on any update are left undisturbed
+      // by requests that repeat the current configuration.
+      if (changed)
+      {
+        updateParameters();
+      }
+      else if (m_honours_active)
+      {
+        // Schedulers treat the activation state as the reply to an
+        // activation request, so a request that repeats the current
+        // configuration still gets the echo.
+        m_entity->reportActivationState();
+      }
     }
 
     void
@@ -520,13 +643,21 @@ namespace DUNE
       if (m_params_stack.empty())
         return;
 
+      bool changed = false;
+
       std::map<std::string, std::string>& map = m_params_stack.top();
       std::map<std::string, std::string>::const_iterator itr = map.begin();
       for (; itr != map.end(); ++itr)
-        m_params.set(itr->first, itr->second);
+      {
+        if (m_params.set(itr->first, itr->second))
+          changed = true;
+      }
       m_params_stack.pop();
 
-      updateParameters();
+      if (changed)
+        updateParameters();
+      else if (m_honours_active)
+        m_entity->reportActivationState();
     }
 
     void
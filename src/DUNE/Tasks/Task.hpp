@@ -43,6 +43,7 @@
 #include <DUNE/Concurrency/TSQueue.hpp>
 #include <DUNE/Tasks/Recipient.hpp>
 #include <DUNE/Tasks/Consumer.hpp>
+#include <DUNE/Tasks/BatchConsumer.hpp>
 #include <DUNE/IMC/Constants.hpp>
 #include <DUNE/IMC/Definitions.hpp>
 #include <DUNE/IMC/Factory.hpp>
@@ -103,7 +104,16 @@ namespace DUNE
       DF_KEEP_SRC_EID = (1 << 1),
       //! Allow message to be delivered to the task that is
       //! dispatching it.
-      DF_LOOP_BACK = (1 << 2)
+      DF_LOOP_BACK = (1 << 2),
+      //! Stamp with the coarse clock (kernel tick resolution). Use
+      //! for high rate messages whose consumers do not need precise
+      //! timestamps.
+      DF_COARSE_TIME = (1 << 3),
+      //! Offer the message to the registered log sink and skip bus
+      //! dispatch if it is accepted. Use for declared bulk messages
+      //! whose only consumer is the logger; when no sink accepts the
+      //! message it is dispatched normally.
+      DF_BULK = (1 << 4)
     };
 
     //! Task.
@@ -160,6 +170,14 @@ namespace DUNE
         return m_entity->getId();
       }
 
+      //! Check if the task's main entity is still in the boot state.
+      //! @return true while booting, false once ready.
+      bool
+      isBooting(void) const
+      {
+        return m_entity->getState() == IMC::EntityState::ESTA_BOOT;
+      }
+
       //! Retrieve the entity id of a given entity label.
       //! @param[in] label entity label.
       //! @throw NonexistentLabel if the label doesn't have an
@@ -315,6 +333,15 @@ namespace DUNE
         dispatch(&msg, flags);
       }
 
+      //! Dispatch an already enveloped message to the message bus
+      //! without copying it. The caller must hold the only reference
+      //! to the envelope, as the enclosed message is patched in
+      //! place, and retains that reference after dispatch.
+      //! @param[in] env message envelope.
+      //! @param[in] flags bitfield with flags (see DispatchFlags).
+      void
+      dispatch(IMC::SharedMessage* env, unsigned int flags = 0);
+
       //! Dispatch message to the message bus in reply to another
       //! message.
       //! @param[in] original original message.
@@ -336,6 +363,14 @@ namespace DUNE
         m_recipient->put(msg);
       }
 
+      //! Queue a shared message envelope for later consumption.
+      //! @param msg message envelope.
+      void
+      receive(IMC::SharedMessage* msg)
+      {
+        m_recipient->put(msg);
+      }
+
       //! Instruct task to reserve all entity identifiers that it
       //! needs for normal execution.
       void
@@ -360,6 +395,24 @@ namespace DUNE
       void
       initializeResources(void);
 
+      //! Collect volatile state worth keeping across a warm restart.
+      //! See onSaveState().
+      //! @param[out] msgs collected messages, owned by the caller.
+      void
+      saveState(std::vector<IMC::Message*>& msgs)
+      {
+        onSaveState(msgs);
+      }
+
+      //! Deliver a message recovered from a warm restart snapshot.
+      //! See onRestoreState().
+      //! @param[in] msg recovered message.
+      void
+      restoreState(const IMC::Message* msg)
+      {
+        onRestoreState(msg);
+      }
+
       //! Instruct task to update its run-time parameters.
       //! @param[in] act_deact if true this function will request
       //! activation/deactivation if the 'Active' parameter changed.
@@ -497,6 +550,15 @@ namespace DUNE
         m_recipient->runCallBacks();
       }
 
+      //! Retrieve the number of messages waiting in the receiving
+      //! queue.
+      //! @return queue depth.
+      unsigned
+      getQueueDepth(void)
+      {
+        return m_recipient->getQueueDepth();
+      }
+
       //! Declare a configuration parameter that can be parsed using
       //! the basic parameter parser.
       //! @tparam T type of the destination variable.
@@ -556,11 +618,41 @@ namespace DUNE
       //! Bind a message to a consumer method.
       //! @param task_obj consumer task.
       //! @param consumer consumer method.
+      //! @param max_rate maximum consumption rate in Hertz (0
+      //! consumes every message). Messages above this rate are
+      //! decimated bus-side, before being queued to this task.
       template <typename M, typename T>
       void
-      bind(T* task_obj, void (T::* consumer)(const M*) = &T::consume)
+      bind(T* task_obj, void (T::* consumer)(const M*) = &T::consume,
+           double max_rate = 0.0)
       {
-        bind(M::getIdStatic(), new Consumer<T, M>(*task_obj, consumer));
+        bind(M::getIdStatic(), new Consumer<T, M>(*task_obj, consumer), max_rate);
+      }
+
+      //! Bind a message to the default consumer method with a
+      //! maximum consumption rate.
+      //! @param task_obj consumer task.
+      //! @param max_rate maximum consumption rate in Hertz (0
+      //! consumes every message).
+      template <typename M, typename T>
+      void
+      bind(T* task_obj, double max_rate)
+      {
+        bind(M::getIdStatic(), new Consumer<T, M>(*task_obj, &T::consume), max_rate);
+      }
+
+      //! Bind a message to a batch consumer method. All messages of
+      //! this type queued between two consecutive calls to
+      //! consumeMessages() are delivered in a single callback,
+      //! amortizing per-message dispatch overhead for high-rate
+      //! streams.
+      //! @param task_obj consumer task.
+      //! @param consumer batch consumer method.
+      template <typename M, typename T>
+      void
+      bind(T* task_obj, void (T::* consumer)(const std::vector<const M*>&))
+      {
+        m_recipient->bindBatch(M::getIdStatic(), new BatchConsumer<T, M>(*task_obj, consumer));
       }
 
       //! Bind multiple messages to a default consumer method.
@@ -639,6 +731,28 @@ namespace DUNE
         return false;
       }
 
+      //! Called periodically, from the daemon thread, to collect
+      //! volatile state worth keeping across a warm restart.
+      //! Implementations push newly allocated messages whose ownership
+      //! passes to the caller; as the call comes from another thread,
+      //! state shared with the task's own thread must be guarded.
+      //! @param[out] msgs collected messages.
+      virtual void
+      onSaveState(std::vector<IMC::Message*>& msgs)
+      {
+        (void)msgs;
+      }
+
+      //! Called before the task starts, once for each message
+      //! recovered from a warm restart snapshot. Implementations
+      //! should ignore messages they did not save.
+      //! @param[in] msg recovered message.
+      virtual void
+      onRestoreState(const IMC::Message* msg)
+      {
+        (void)msg;
+      }
+
       //! Called when the task is instructed to reserve all the entity
       //! identifiers it needs for normal execution. See
       //! reserveEntity(). Derived classes that need to reserve entity
@@ -761,6 +875,8 @@ namespace DUNE
         uint16_t deact_time;
         //! Scheduling priority.
         unsigned int priority;
+        //! CPUs the task's thread may execute on.
+        std::vector<unsigned> affinity;
         //! True if task is active.
         bool active;
         //! Scope of 'Active' parameter.
@@ -805,12 +921,15 @@ namespace DUNE
       //! Register a consumer for a given message identifier.
       //! @param[in] message_id message identifier.
       //! @param[in] consumer consumer object.
+      //! @param[in] max_rate maximum consumption rate in Hertz (0
+      //! consumes every message).
       void
-      bind(unsigned int message_id, AbstractConsumer* consumer)
+      bind(unsigned int message_id, AbstractConsumer* consumer,
+           double max_rate = 0.0)
       {
         spew("registering consumer for '%s'",
              IMC::Factory::getAbbrevFromId(message_id).c_str());
-        m_recipient->bind(message_id, consumer);
+        m_recipient->bind(message_id, consumer, max_rate);
       }
 
       //! Consume QueryEntityState messages and reply accordingly.
@@ -42,8 +42,11 @@ namespace DUNE
 #include <DUNE/Time/BrokenDown.hpp>
 #include <DUNE/Time/Delay.hpp>
 #include <DUNE/Time/Clock.hpp>
+#include <DUNE/Time/CycleClock.hpp>
 #include <DUNE/Time/Utils.hpp>
 #include <DUNE/Time/Delta.hpp>
 #include <DUNE/Time/Counter.hpp>
+#include <DUNE/Time/TimerWheel.hpp>
+#include <DUNE/Time/TokenBucket.hpp>
 
 #endif
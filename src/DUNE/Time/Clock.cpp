@@ -111,6 +111,20 @@ namespace DUNE
 #else
 #  error Clock::getSinceEpochNsec() is not yet implemented in this system.
 
+#endif
+    }
+
+    uint64_t
+    Clock::getSinceEpochCoarseNsec(void)
+    {
+      // The coarse clock is maintained by the kernel tick and read
+      // without scaling the hardware counter.
+#if defined(DUNE_SYS_HAS_CLOCK_GETTIME) && defined(CLOCK_REALTIME_COARSE)
+      timespec ts;
+      clock_gettime(CLOCK_REALTIME_COARSE, &ts);
+      return (uint64_t)ts.tv_sec * c_nsec_per_sec + (uint64_t)ts.tv_nsec;
+#else
+      return getSinceEpochNsec();
 #endif
     }
 
@@ -125,6 +139,20 @@ namespace DUNE
         throw System::Error(errno, DTR("failed to set time"));
 #else
       (void)value;
+#endif
+    }
+
+    void
+    Clock::slew(double value)
+    {
+#if defined(DUNE_SYS_HAS_SETTIMEOFDAY)
+      timeval tv;
+      tv.tv_sec = static_cast<time_t>(value);
+      tv.tv_usec = static_cast<suseconds_t>((value - tv.tv_sec) * 1000000.0);
+      if (adjtime(&tv, 0) != 0)
+        throw System::Error(errno, DTR("failed to slew time"));
+#else
+      (void)value;
 #endif
     }
   }
@@ -115,11 +115,37 @@ namespace DUNE
         return getSinceEpochNsec() / c_nsec_per_sec_fp;
       }
 
+      //! Get the amount of time (in nanoseconds) elapsed since the
+      //! UNIX Epoch with kernel tick resolution (typically 1 ms to
+      //! 4 ms). Considerably cheaper to read than getSinceEpochNsec()
+      //! and adequate for stamping high rate messages.
+      //! @return time in nanoseconds.
+      static uint64_t
+      getSinceEpochCoarseNsec(void);
+
+      //! Get the amount of time (in seconds) elapsed since the UNIX
+      //! Epoch with kernel tick resolution (typically 1 ms to 4 ms).
+      //! @return time in seconds.
+      static double
+      getSinceEpochCoarse(void)
+      {
+        return getSinceEpochCoarseNsec() / c_nsec_per_sec_fp;
+      }
+
       //! Set current time in the form of seconds elapsed since the
       //! UNIX Epoch (Midnight UTC of January 1, 1970).
       //! @param value time in seconds.
       static void
       set(double value);
+
+      //! Gradually adjust the current time by a given amount. Unlike
+      //! set(), the clock keeps advancing monotonically while the
+      //! kernel slews it towards the corrected value, so timestamps
+      //! taken during the adjustment never jump. A new call replaces
+      //! any outstanding correction.
+      //! @param value adjustment in seconds.
+      static void
+      slew(double value);
     };
   }
 }
@@ -0,0 +1,70 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+// DUNE headers.
+#include <DUNE/Time/CycleClock.hpp>
+#include <DUNE/Time/Clock.hpp>
+
+//! Compiler supported thread-local storage; when unavailable the
+//! cycle clock degrades to plain clock reads.
+#if defined(__GNUC__)
+#  define DUNE_TIME_CYCLE_CLOCK_TLS
+#endif
+
+namespace DUNE
+{
+  namespace Time
+  {
+#if defined(DUNE_TIME_CYCLE_CLOCK_TLS)
+    //! Cycle time of the current thread, negative if never set.
+    static __thread double s_cycle_time = -1.0;
+#endif
+
+    void
+    CycleClock::set(double now)
+    {
+#if defined(DUNE_TIME_CYCLE_CLOCK_TLS)
+      s_cycle_time = now;
+#else
+      (void)now;
+#endif
+    }
+
+    double
+    CycleClock::get(void)
+    {
+#if defined(DUNE_TIME_CYCLE_CLOCK_TLS)
+      if (s_cycle_time >= 0)
+        return s_cycle_time;
+#endif
+
+      return Clock::get();
+    }
+  }
+}
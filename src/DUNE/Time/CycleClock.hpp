@@ -0,0 +1,72 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+#ifndef DUNE_TIME_CYCLE_CLOCK_HPP_INCLUDED_
+#define DUNE_TIME_CYCLE_CLOCK_HPP_INCLUDED_
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+
+namespace DUNE
+{
+  namespace Time
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM CycleClock;
+
+    //! Per-thread cycle time.
+    //!
+    //! The task machinery publishes one monotonic clock reading at
+    //! the start of each task iteration (message batch or periodic
+    //! cycle). Code running inside the iteration reads it through
+    //! get() instead of the clock, so a cycle that computes dozens
+    //! of time deltas costs a single clock read and every delta in
+    //! it sees the same 'now'.
+    //!
+    //! On threads where no cycle time was ever published — or when
+    //! thread-local storage is unavailable — get() falls back to
+    //! reading the clock.
+    class CycleClock
+    {
+    public:
+      //! Publish the cycle time of the calling thread.
+      //! @param[in] now current monotonic time.
+      static void
+      set(double now);
+
+      //! Retrieve the cycle time of the calling thread, or a fresh
+      //! clock reading if none was published.
+      //! @return cycle time.
+      static double
+      get(void);
+    };
+  }
+}
+
+#endif
@@ -31,13 +31,17 @@
 #define DUNE_TIME_DELTA_HPP_INCLUDED_
 
 // DUNE headers.
-#include <DUNE/Time/Clock.hpp>
+#include <DUNE/Time/CycleClock.hpp>
 
 namespace DUNE
 {
   namespace Time
   {
     //! Time delta calculations.
+    //!
+    //! Time is read through the cycle clock, so all deltas computed
+    //! within one task iteration share the same 'now' and cost no
+    //! extra clock reads.
     class Delta
     {
     public:
@@ -56,7 +60,7 @@ namespace DUNE
       inline void
       reset(void)
       {
-        m_last = Time::Clock::get();
+        m_last = Time::CycleClock::get();
       }
 
       //! Get current delta and reset clock.
@@ -70,7 +74,7 @@ namespace DUNE
           return -1.0;
         }
 
-        double now = Time::Clock::get();
+        double now = Time::CycleClock::get();
         double delta = now - m_last;
         m_last = now;
 
@@ -88,7 +92,7 @@ namespace DUNE
           return -1.0;
         }
 
-        return Time::Clock::get() - m_last;
+        return Time::CycleClock::get() - m_last;
       }
 
       //! Check if delta is invalid.
@@ -0,0 +1,242 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstddef>
+
+// DUNE headers.
+#include <DUNE/Time/TimerWheel.hpp>
+#include <DUNE/Time/Clock.hpp>
+
+namespace DUNE
+{
+  namespace Time
+  {
+    TimerWheel::TimerWheel(double resolution):
+      m_resolution(resolution),
+      m_tick(0),
+      m_next_id(c_invalid_timer + 1)
+    {
+      m_epoch = Clock::get();
+
+      for (unsigned i = 0; i < c_levels; ++i)
+        for (unsigned j = 0; j < c_slots; ++j)
+          m_slots[i][j] = NULL;
+    }
+
+    TimerWheel::~TimerWheel(void)
+    {
+      for (TimerMap::iterator itr = m_timers.begin(); itr != m_timers.end(); ++itr)
+        delete itr->second;
+    }
+
+    TimerWheel::TimerId
+    TimerWheel::add(double delay, Listener* listener, void* data)
+    {
+      if (delay < 0.0)
+        delay = 0.0;
+
+      Timer* timer = new Timer;
+      timer->id = m_next_id++;
+      if (m_next_id == c_invalid_timer)
+        ++m_next_id;
+      // Round up so timers never fire before their deadline.
+      timer->tick = (uint64_t)((Clock::get() + delay - m_epoch) / m_resolution) + 1;
+      timer->listener = listener;
+      timer->data = data;
+
+      place(timer);
+      m_timers[timer->id] = timer;
+
+      return timer->id;
+    }
+
+    bool
+    TimerWheel::cancel(TimerId id)
+    {
+      TimerMap::iterator itr = m_timers.find(id);
+      if (itr == m_timers.end())
+        return false;
+
+      unlink(itr->second);
+      delete itr->second;
+      m_timers.erase(itr);
+      return true;
+    }
+
+    unsigned
+    TimerWheel::advance(void)
+    {
+      uint64_t now_tick = (uint64_t)((Clock::get() - m_epoch) / m_resolution);
+      Timer* due = NULL;
+
+      while (m_tick <= now_tick)
+      {
+        unsigned slot = (unsigned)(m_tick & (c_slots - 1));
+
+        // On wrap around, refill this level from the level above.
+        if (slot == 0 && m_tick != 0)
+        {
+          for (unsigned level = 1; level < c_levels; ++level)
+          {
+            unsigned upper = (unsigned)((m_tick >> (8 * level)) & (c_slots - 1));
+            cascade(level, upper);
+            if (upper != 0)
+              break;
+          }
+        }
+
+        // Collect the timers of the current slot.
+        while (m_slots[0][slot] != NULL)
+        {
+          Timer* timer = m_slots[0][slot];
+          unlink(timer);
+          timer->next = due;
+          due = timer;
+        }
+
+        if (m_tick == now_tick)
+          break;
+
+        ++m_tick;
+      }
+
+      // Fire after the wheel state is consistent, so listeners may
+      // rearm timers from inside the callback.
+      unsigned count = 0;
+      while (due != NULL)
+      {
+        Timer* timer = due;
+        due = due->next;
+
+        m_timers.erase(timer->id);
+        ++count;
+
+        if (timer->listener != NULL)
+          timer->listener->onTimerExpired(timer->id, timer->data);
+
+        delete timer;
+      }
+
+      return count;
+    }
+
+    double
+    TimerWheel::getEta(void) const
+    {
+      if (m_timers.empty())
+        return -1.0;
+
+      uint64_t min_tick = 0;
+      bool first = true;
+      for (TimerMap::const_iterator itr = m_timers.begin(); itr != m_timers.end(); ++itr)
+      {
+        if (first || itr->second->tick < min_tick)
+        {
+          min_tick = itr->second->tick;
+          first = false;
+        }
+      }
+
+      double eta = m_epoch + (double)min_tick * m_resolution - Clock::get();
+      return (eta > 0.0) ? eta : 0.0;
+    }
+
+    unsigned
+    TimerWheel::size(void) const
+    {
+      return (unsigned)m_timers.size();
+    }
+
+    void
+    TimerWheel::place(Timer* timer)
+    {
+      uint64_t tick = timer->tick;
+      if (tick < m_tick)
+        tick = m_tick;
+
+      // Find the level whose span covers the time to expiry.
+      uint64_t delta = tick - m_tick;
+      unsigned level = 0;
+      while (level < c_levels - 1 && delta >= ((uint64_t)1 << (8 * (level + 1))))
+        ++level;
+
+      unsigned slot = (unsigned)((tick >> (8 * level)) & (c_slots - 1));
+
+      timer->prev = NULL;
+      timer->next = m_slots[level][slot];
+      if (timer->next != NULL)
+        timer->next->prev = timer;
+      m_slots[level][slot] = timer;
+    }
+
+    void
+    TimerWheel::unlink(Timer* timer)
+    {
+      if (timer->prev != NULL)
+      {
+        timer->prev->next = timer->next;
+        if (timer->next != NULL)
+          timer->next->prev = timer->prev;
+      }
+      else
+      {
+        // Head of one of the slots: find which by expiry placement.
+        for (unsigned level = 0; level < c_levels; ++level)
+        {
+          unsigned slot = (unsigned)((timer->tick >> (8 * level)) & (c_slots - 1));
+          if (m_slots[level][slot] == timer)
+          {
+            m_slots[level][slot] = timer->next;
+            if (timer->next != NULL)
+              timer->next->prev = NULL;
+            break;
+          }
+        }
+      }
+
+      timer->next = NULL;
+      timer->prev = NULL;
+    }
+
+    void
+    TimerWheel::cascade(unsigned level, unsigned slot)
+    {
+      Timer* list = m_slots[level][slot];
+      m_slots[level][slot] = NULL;
+
+      while (list != NULL)
+      {
+        Timer* timer = list;
+        list = list->next;
+        place(timer);
+      }
+    }
+  }
+}
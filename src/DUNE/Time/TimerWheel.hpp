@@ -0,0 +1,179 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+#ifndef DUNE_TIME_TIMER_WHEEL_HPP_INCLUDED_
+#define DUNE_TIME_TIMER_WHEEL_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <map>
+
+// DUNE headers.
+#include <DUNE/Config.hpp>
+
+namespace DUNE
+{
+  namespace Time
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM TimerWheel;
+
+    //! Hierarchical timer wheel.
+    //!
+    //! Keeps an arbitrary number of one-shot deadlines with O(1)
+    //! insertion, cancellation and expiry, replacing per-deadline
+    //! Counter polling. A task owning many timeouts registers them
+    //! here, uses getEta() as its queue wait timeout so it blocks
+    //! exactly until the next deadline, and calls advance() once per
+    //! wakeup to fire whatever became due.
+    //!
+    //! This class is not thread-safe: each instance belongs to the
+    //! thread that drives it.
+    class TimerWheel
+    {
+    public:
+      //! Timer identifier.
+      typedef uint32_t TimerId;
+
+      //! Invalid timer identifier.
+      static const TimerId c_invalid_timer = 0;
+
+      //! Timer expiry listener.
+      class Listener
+      {
+      public:
+        //! Called when a timer expires. Timers are one-shot: rearming
+        //! with add() from inside this callback is safe.
+        //! @param[in] id expired timer.
+        //! @param[in] data opaque argument given to add().
+        virtual void
+        onTimerExpired(TimerId id, void* data) = 0;
+
+        virtual
+        ~Listener(void)
+        { }
+      };
+
+      //! Constructor.
+      //! @param[in] resolution tick resolution in seconds.
+      TimerWheel(double resolution = 0.05);
+
+      //! Destructor.
+      ~TimerWheel(void);
+
+      //! Register a one-shot timer.
+      //! @param[in] delay time until expiry in seconds.
+      //! @param[in] listener expiry listener.
+      //! @param[in] data opaque argument passed to the listener.
+      //! @return timer identifier.
+      TimerId
+      add(double delay, Listener* listener, void* data = 0);
+
+      //! Cancel a pending timer.
+      //! @param[in] id timer identifier.
+      //! @return true if the timer was pending, false otherwise.
+      bool
+      cancel(TimerId id);
+
+      //! Fire all timers whose deadline has passed.
+      //! @return number of timers fired.
+      unsigned
+      advance(void);
+
+      //! Time remaining until the earliest pending deadline.
+      //! @return time in seconds, 0 if a timer is already due, or a
+      //! negative value if no timers are pending.
+      double
+      getEta(void) const;
+
+      //! Number of pending timers.
+      //! @return pending timer count.
+      unsigned
+      size(void) const;
+
+    private:
+      //! Slots per wheel level.
+      static const unsigned c_slots = 256;
+      //! Number of wheel levels.
+      static const unsigned c_levels = 4;
+
+      //! Pending timer.
+      struct Timer
+      {
+        //! Timer identifier.
+        TimerId id;
+        //! Absolute expiry tick.
+        uint64_t tick;
+        //! Expiry listener.
+        Listener* listener;
+        //! Opaque listener argument.
+        void* data;
+        //! Next timer in the slot.
+        Timer* next;
+        //! Previous timer in the slot.
+        Timer* prev;
+      };
+
+      //! Map of pending timers by identifier.
+      typedef std::map<TimerId, Timer*> TimerMap;
+
+      //! Insert a timer in the slot matching its expiry tick.
+      void
+      place(Timer* timer);
+
+      //! Unlink a timer from its slot.
+      void
+      unlink(Timer* timer);
+
+      //! Move the timers of a higher level slot down one level.
+      void
+      cascade(unsigned level, unsigned slot);
+
+      //! Tick resolution in seconds.
+      double m_resolution;
+      //! Time of tick zero.
+      double m_epoch;
+      //! Current tick.
+      uint64_t m_tick;
+      //! Next timer identifier.
+      TimerId m_next_id;
+      //! Wheel slots.
+      Timer* m_slots[c_levels][c_slots];
+      //! Pending timers by identifier.
+      TimerMap m_timers;
+
+      // Non - copyable.
+      TimerWheel(const TimerWheel&);
+
+      // Non - assignable.
+      TimerWheel& operator=(const TimerWheel&);
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,144 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+#ifndef DUNE_TIME_TOKEN_BUCKET_HPP_INCLUDED_
+#define DUNE_TIME_TOKEN_BUCKET_HPP_INCLUDED_
+
+// DUNE headers.
+#include <DUNE/Time/Clock.hpp>
+
+namespace DUNE
+{
+  namespace Time
+  {
+    //! Token bucket rate limiter.
+    //!
+    //! Tokens accumulate at a fixed rate up to a burst capacity; work
+    //! proceeds by consuming tokens, so sustained throughput is bound
+    //! by the rate while short bursts up to the capacity pass without
+    //! delay. Suitable for transports with a link budget (acoustic,
+    //! satellite), with tokens measured in messages or bytes.
+    class TokenBucket
+    {
+    public:
+      //! Constructor.
+      //! @param rate token refill rate, per second.
+      //! @param capacity maximum token accumulation (burst size).
+      TokenBucket(double rate = 1.0, double capacity = 1.0):
+        m_rate(rate),
+        m_capacity(capacity),
+        m_tokens(capacity)
+      {
+        m_last = Clock::get();
+      }
+
+      //! Set the token refill rate.
+      //! @param rate token refill rate, per second.
+      inline void
+      setRate(double rate)
+      {
+        refill();
+        m_rate = rate;
+      }
+
+      //! Set the burst capacity.
+      //! @param capacity maximum token accumulation.
+      inline void
+      setCapacity(double capacity)
+      {
+        m_capacity = capacity;
+        if (m_tokens > m_capacity)
+          m_tokens = m_capacity;
+      }
+
+      //! Try to consume tokens.
+      //! @param tokens amount to consume.
+      //! @return true if the tokens were available and consumed,
+      //! false otherwise.
+      inline bool
+      consume(double tokens = 1.0)
+      {
+        refill();
+
+        if (m_tokens < tokens)
+          return false;
+
+        m_tokens -= tokens;
+        return true;
+      }
+
+      //! Get the time to wait until the requested amount of tokens
+      //! becomes available.
+      //! @param tokens desired amount.
+      //! @return wait time in seconds, 0 if already available.
+      inline double
+      getDelay(double tokens = 1.0)
+      {
+        refill();
+
+        if (m_tokens >= tokens)
+          return 0.0;
+
+        return (tokens - m_tokens) / m_rate;
+      }
+
+      //! Get the currently available tokens.
+      //! @return available tokens.
+      inline double
+      getLevel(void)
+      {
+        refill();
+        return m_tokens;
+      }
+
+    private:
+      //! Refill rate (tokens per second).
+      double m_rate;
+      //! Burst capacity (tokens).
+      double m_capacity;
+      //! Available tokens.
+      double m_tokens;
+      //! Time of last refill.
+      double m_last;
+
+      //! Accumulate tokens for the time elapsed since the last refill.
+      inline void
+      refill(void)
+      {
+        double now = Clock::get();
+        m_tokens += (now - m_last) * m_rate;
+        if (m_tokens > m_capacity)
+          m_tokens = m_capacity;
+        m_last = now;
+      }
+    };
+  }
+}
+
+#endif
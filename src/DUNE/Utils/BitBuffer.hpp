@@ -78,13 +78,20 @@ namespace DUNE
       inline void
       appendOnes(const uint64_t nrofbits)
       {
-        for (uint64_t i = m_lastbit; i < m_lastbit + nrofbits; i++)
+        uint64_t left = nrofbits;
+
+        while (left > 0)
         {
-          m_buffer[i / m_bitpacketsize] |= (1 << i % m_bitpacketsize);
+          unsigned off = m_lastbit % m_bitpacketsize;
+          uint64_t n = m_bitpacketsize - off;
+          if (n > left)
+            n = left;
+
+          m_buffer[m_lastbit / m_bitpacketsize] |= (uint8_t)(((1u << n) - 1) << off);
+          m_lastbit += n;
+          left -= n;
         }
 
-        m_lastbit += nrofbits;
-
         m_size = m_lastbit / m_bitpacketsize;
       }
 
@@ -124,39 +131,56 @@ namespace DUNE
         }
       }
 
-      inline uint8_t
+      /*
+       * Read up to 32 bits starting at a bit index, least significant
+       * bit first. Works a byte at a time instead of bit by bit.
+       */
+      inline uint32_t
       getData(uint64_t index, uint8_t nbits)
       {
-        uint8_t data = 0;
+        uint32_t data = 0;
+        unsigned got = 0;
 
-        for (uint64_t i = 0; i < nbits; i++)
+        while (got < nbits)
         {
-          if (getBit(index + i))
-          {
-            data |= (1 << i);
-          }
-          else
-          { }
+          unsigned off = (index + got) % m_bitpacketsize;
+          unsigned n = m_bitpacketsize - off;
+          if (n > (unsigned)(nbits - got))
+            n = nbits - got;
+
+          uint32_t bits = (m_buffer[(index + got) / m_bitpacketsize] >> off) & ((1u << n) - 1);
+          data |= bits << got;
+          got += n;
         }
 
         return data;
       }
 
+      /*
+       * Append up to 32 bits, least significant bit first. Works a
+       * byte at a time instead of bit by bit.
+       */
       inline void
-      appendData(uint8_t bits, uint8_t sbits)
+      appendData(uint32_t bits, uint8_t sbits)
       {
-        for (uint64_t i = 0; i < sbits; i++)
+        if (sbits < 32)
+          bits &= (1ul << sbits) - 1;
+
+        unsigned left = sbits;
+
+        while (left > 0)
         {
-          if ((bits & (1 << i)) == (1 << i))
-          {
-            m_buffer[m_lastbit / m_bitpacketsize] |= (1 << m_lastbit % m_bitpacketsize);
-            m_lastbit++;
-          }
-          else
-          {
-            m_lastbit++;
-          }
+          unsigned off = m_lastbit % m_bitpacketsize;
+          unsigned n = m_bitpacketsize - off;
+          if (n > left)
+            n = left;
+
+          m_buffer[m_lastbit / m_bitpacketsize] |= (uint8_t)(bits << off);
+          bits >>= n;
+          m_lastbit += n;
+          left -= n;
         }
+
         m_size = m_lastbit / m_bitpacketsize;
       }
 
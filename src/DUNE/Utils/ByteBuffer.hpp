@@ -31,12 +31,12 @@
 #define DUNE_UTILS_BYTE_BUFFER_HPP_INCLUDED_
 
 // ISO C++ 98 headers.
-#include <cstdlib>
 #include <ostream>
 #include <cstring>
 
 // DUNE headers.
 #include <DUNE/Math/General.hpp>
+#include <DUNE/Memory/BlockPool.hpp>
 
 namespace DUNE
 {
@@ -49,17 +49,69 @@ namespace DUNE
 
     public:
       ByteBuffer(uint32_t capacity = 128):
-        m_buffer(NULL),
-        m_capacity(Math::computeNextPowerOfTwo(capacity)),
+        m_buffer(m_inline),
+        m_capacity(c_inline_size),
         m_size(0)
       {
-        m_buffer = (uint8_t*)std::malloc(m_capacity);
+        if (capacity > c_inline_size)
+        {
+          m_capacity = Math::computeNextPowerOfTwo(capacity);
+          m_buffer = (uint8_t*)getPool().allocate(m_capacity);
+        }
+      }
+
+      //! Copy constructor: deep copies the contents, keeping short
+      //! buffers in the inline storage.
+      //! @param[in] other buffer to copy.
+      ByteBuffer(const ByteBuffer& other):
+        m_buffer(m_inline),
+        m_capacity(c_inline_size),
+        m_size(0)
+      {
+        write(other.m_buffer, other.m_size);
       }
 
       inline
       ~ByteBuffer(void)
       {
-        std::free(m_buffer);
+        if (m_buffer != m_inline)
+          getPool().deallocate(m_buffer);
+      }
+
+      ByteBuffer&
+      operator=(const ByteBuffer& other)
+      {
+        if (this != &other)
+          write(other.m_buffer, other.m_size);
+        return *this;
+      }
+
+      //! Exchange contents with another buffer without copying heap
+      //! storage. Inline contents are copied, as they cannot outlive
+      //! their owner.
+      //! @param[in,out] other buffer to exchange contents with.
+      void
+      swap(ByteBuffer& other)
+      {
+        if (m_buffer != m_inline && other.m_buffer != other.m_inline)
+        {
+          uint8_t* buffer = m_buffer;
+          m_buffer = other.m_buffer;
+          other.m_buffer = buffer;
+
+          uint32_t capacity = m_capacity;
+          m_capacity = other.m_capacity;
+          other.m_capacity = capacity;
+
+          uint32_t size = m_size;
+          m_size = other.m_size;
+          other.m_size = size;
+          return;
+        }
+
+        ByteBuffer tmp(*this);
+        *this = other;
+        other = tmp;
       }
 
       inline void
@@ -67,8 +119,14 @@ namespace DUNE
       {
         if (size > m_capacity)
         {
+          uint32_t old_capacity = m_capacity;
           m_capacity = Math::computeNextPowerOfTwo(size);
-          m_buffer = (uint8_t*)std::realloc(m_buffer, m_capacity);
+
+          uint8_t* buffer = (uint8_t*)getPool().allocate(m_capacity);
+          std::memcpy(buffer, m_buffer, old_capacity);
+          if (m_buffer != m_inline)
+            getPool().deallocate(m_buffer);
+          m_buffer = buffer;
         }
       }
 
@@ -101,6 +159,17 @@ namespace DUNE
         append((uint8_t*)data, size);
       }
 
+      //! Append without growing the buffer. The caller must have
+      //! reserved enough capacity with grow() beforehand.
+      //! @param[in] data bytes to append.
+      //! @param[in] size number of bytes to append.
+      inline void
+      appendUnchecked(const uint8_t* data, uint32_t size)
+      {
+        std::memcpy(m_buffer + m_size, data, size);
+        m_size += size;
+      }
+
       void
       setSize(uint32_t size)
       {
@@ -139,12 +208,23 @@ namespace DUNE
       }
 
     private:
+      //! Size of the inline storage: most IMC frames fit and never
+      //! touch the heap.
+      static const uint32_t c_inline_size = 256;
+
+      //! Retrieve the pool backing heap-sized buffers, shared by all
+      //! instances.
+      //! @return block pool.
+      static Memory::BlockPool&
+      getPool(void);
       //! Internal buffer.
       uint8_t* m_buffer;
       //! Internal buffer's capacity.
       uint32_t m_capacity;
       //! Internal buffer's used space.
       uint32_t m_size;
+      //! Inline storage for short contents.
+      uint8_t m_inline[c_inline_size];
     };
 
     inline std::ostream&
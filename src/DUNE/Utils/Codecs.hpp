@@ -31,6 +31,8 @@
 #define DUNE_UTILS_CODECS_HPP_INCLUDED_
 
 #include <DUNE/Utils/Codecs/CodedEstimatedState.hpp>
+#include <DUNE/Utils/Codecs/CodedEstimatedStateDelta.hpp>
+#include <DUNE/Utils/Codecs/CodedPlanProgress.hpp>
 #include <DUNE/Utils/Codecs/CodedReference.hpp>
 
 #endif
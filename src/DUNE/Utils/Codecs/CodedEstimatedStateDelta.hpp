@@ -0,0 +1,332 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+#ifndef DUNE_UTILS_CODECS_CODED_ESTIMATED_STATE_DELTA_HPP_INCLUDED_
+#define DUNE_UTILS_CODECS_CODED_ESTIMATED_STATE_DELTA_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <stdexcept>
+
+// DUNE headers.
+#include <DUNE/IMC/Definitions.hpp>
+#include <DUNE/Coordinates/General.hpp>
+#include <DUNE/Coordinates/WGS84.hpp>
+#include <DUNE/Math/Angles.hpp>
+#include <DUNE/Math/General.hpp>
+
+namespace DUNE
+{
+  namespace Utils
+  {
+    namespace Codecs
+    {
+      //! Stateful codec that encodes an EstimatedState as a
+      //! quantized delta against the previously encoded state, with
+      //! periodic absolute keyframes.
+      //!
+      //! Both sides apply the quantized deltas to the same reference,
+      //! so the reconstruction error never exceeds the declared
+      //! bounds regardless of how many deltas follow a keyframe. The
+      //! acoustic channel provides no acknowledgements: after a lost
+      //! frame the decoder discards deltas until the next keyframe
+      //! resynchronizes it, which bounds the outage to the keyframe
+      //! interval.
+      //!
+      //! A keyframe occupies 19 bytes, a delta 9, and keyframes are
+      //! also emitted whenever the movement since the last frame
+      //! does not fit the delta ranges.
+      class CodedEstimatedStateDelta
+      {
+      public:
+        //! Code to identify an absolute keyframe.
+        static const uint8_t c_id_key = 0xdb;
+        //! Code to identify a delta frame.
+        static const uint8_t c_id_delta = 0xdc;
+
+        //! Horizontal position error bound in meter: half the 0.1 m
+        //! quantization step of the displacement fields.
+        static double
+        getPositionErrorBound(void)
+        {
+          return 0.05;
+        }
+
+        //! Depth and altitude error bound in meter: half the 0.01 m
+        //! quantization step.
+        static double
+        getZErrorBound(void)
+        {
+          return 0.005;
+        }
+
+        //! Heading error bound in radian: half the 0.01 rad
+        //! quantization step.
+        static double
+        getYawErrorBound(void)
+        {
+          return 0.005;
+        }
+
+        //! Constructor.
+        //! @param[in] key_interval number of frames after which an
+        //! absolute keyframe is forced.
+        CodedEstimatedStateDelta(unsigned key_interval = 10):
+          m_key_interval(key_interval),
+          m_has_ref(false),
+          m_count(0)
+        { }
+
+        //! Reset the codec state, forcing the next encoded frame to
+        //! be a keyframe and discarding the decoder reference.
+        void
+        clear(void)
+        {
+          m_has_ref = false;
+          m_count = 0;
+        }
+
+        //! Encode an EstimatedState message to a UamTxFrame message
+        //! pointer, as a delta when possible.
+        //! @param[in] msg EstimatedState pointer.
+        //! @param[out] frame UamTxFrame pointer.
+        void
+        encode(const IMC::EstimatedState* msg, IMC::UamTxFrame* frame)
+        {
+          double lat;
+          double lon;
+          Coordinates::toWGS84(*msg, lat, lon);
+
+          int16_t alt = quantize(msg->alt, 100.0);
+          int16_t depth = quantize(msg->depth, 100.0);
+          int16_t yaw = quantize(msg->psi, 100.0);
+
+          if (m_has_ref && m_count < m_key_interval)
+          {
+            double n;
+            double e;
+            Coordinates::WGS84::displacement(m_lat, m_lon, 0.0,
+                                             lat, lon, 0.0, &n, &e);
+
+            double qn = Math::round(n * 10.0);
+            double qe = Math::round(e * 10.0);
+            int32_t dalt = (int32_t)alt - (int32_t)m_alt;
+            int32_t ddepth = (int32_t)depth - (int32_t)m_depth;
+            int32_t dyaw = quantize(Math::Angles::normalizeRadian(msg->psi - m_yaw / 100.0), 100.0);
+
+            if (fitsDelta(qn) && fitsDelta(qe) &&
+                fitsByte(dalt) && fitsByte(ddepth))
+            {
+              frame->data.resize(getDeltaSize());
+              uint8_t* ptr = (uint8_t*)&frame->data[0];
+
+              ptr += IMC::serialize(c_id_delta, ptr);
+              ptr += IMC::serialize((int16_t)qn, ptr);
+              ptr += IMC::serialize((int16_t)qe, ptr);
+              ptr += IMC::serialize((int8_t)dalt, ptr);
+              ptr += IMC::serialize((int8_t)ddepth, ptr);
+              ptr += IMC::serialize((int16_t)dyaw, ptr);
+
+              applyDelta((int16_t)qn, (int16_t)qe, (int8_t)dalt,
+                         (int8_t)ddepth, (int16_t)dyaw);
+              ++m_count;
+              return;
+            }
+          }
+
+          frame->data.resize(getKeySize());
+          uint8_t* ptr = (uint8_t*)&frame->data[0];
+
+          ptr += IMC::serialize(c_id_key, ptr);
+          ptr += IMC::serialize(lat, ptr);
+          ptr += IMC::serialize(lon, ptr);
+          ptr += IMC::serialize(alt, ptr);
+          ptr += IMC::serialize(depth, ptr);
+          ptr += IMC::serialize(yaw, ptr);
+
+          setReference(lat, lon, alt, depth, yaw);
+          m_count = 1;
+        }
+
+        //! Decode an UamRxFrame to retrieve an EstimatedState
+        //! message. Delta frames received before a keyframe are
+        //! rejected, as there is no reference to apply them to.
+        //! @param[in] frame UamRxFrame pointer.
+        //! @return IMC message.
+        IMC::Message*
+        decode(const IMC::UamRxFrame* frame)
+        {
+          if (frame->data.size() < 1)
+            throw std::runtime_error("invalid size");
+
+          uint8_t* ptr = (uint8_t*)&frame->data[1];
+          uint16_t length = (uint16_t)frame->data.size() - 1;
+
+          if ((uint8_t)frame->data[0] == c_id_key)
+          {
+            if (frame->data.size() < getKeySize())
+              throw std::runtime_error("invalid size");
+
+            double lat;
+            double lon;
+            int16_t alt;
+            int16_t depth;
+            int16_t yaw;
+
+            ptr += IMC::deserialize(lat, ptr, length);
+            ptr += IMC::deserialize(lon, ptr, length);
+            ptr += IMC::deserialize(alt, ptr, length);
+            ptr += IMC::deserialize(depth, ptr, length);
+            ptr += IMC::deserialize(yaw, ptr, length);
+
+            setReference(lat, lon, alt, depth, yaw);
+          }
+          else if ((uint8_t)frame->data[0] == c_id_delta)
+          {
+            if (frame->data.size() < getDeltaSize())
+              throw std::runtime_error("invalid size");
+
+            if (!m_has_ref)
+              throw std::runtime_error("delta without keyframe");
+
+            int16_t qn;
+            int16_t qe;
+            int8_t dalt;
+            int8_t ddepth;
+            int16_t dyaw;
+
+            ptr += IMC::deserialize(qn, ptr, length);
+            ptr += IMC::deserialize(qe, ptr, length);
+            ptr += IMC::deserialize(dalt, ptr, length);
+            ptr += IMC::deserialize(ddepth, ptr, length);
+            ptr += IMC::deserialize(dyaw, ptr, length);
+
+            applyDelta(qn, qe, dalt, ddepth, dyaw);
+          }
+          else
+          {
+            throw std::runtime_error("unknown frame code");
+          }
+
+          IMC::EstimatedState* estate = new IMC::EstimatedState;
+          estate->lat = m_lat;
+          estate->lon = m_lon;
+          estate->alt = (fp32_t)(m_alt / 100.0);
+          estate->depth = (fp32_t)(m_depth / 100.0);
+          estate->psi = (fp32_t)(m_yaw / 100.0);
+
+          return estate;
+        }
+
+        //! Get the size of an absolute keyframe.
+        //! @return size in bytes.
+        static size_t
+        getKeySize(void)
+        {
+          return sizeof(uint8_t) + 2 * sizeof(fp64_t) + 3 * sizeof(int16_t);
+        }
+
+        //! Get the size of a delta frame.
+        //! @return size in bytes.
+        static size_t
+        getDeltaSize(void)
+        {
+          return sizeof(uint8_t) + 2 * sizeof(int16_t)
+                 + 2 * sizeof(int8_t) + sizeof(int16_t);
+        }
+
+      private:
+        //! Number of frames after which a keyframe is forced.
+        unsigned m_key_interval;
+        //! True when a reference state is set.
+        bool m_has_ref;
+        //! Frames encoded since the last keyframe.
+        unsigned m_count;
+        //! Reference WGS84 latitude.
+        fp64_t m_lat;
+        //! Reference WGS84 longitude.
+        fp64_t m_lon;
+        //! Reference quantized altitude.
+        int16_t m_alt;
+        //! Reference quantized depth.
+        int16_t m_depth;
+        //! Reference quantized heading.
+        int16_t m_yaw;
+
+        //! Quantize a value to a signed 16-bit integer.
+        static int16_t
+        quantize(double value, double scale)
+        {
+          return (int16_t)Math::round(value * scale);
+        }
+
+        //! Test if a quantized displacement fits the delta range.
+        static bool
+        fitsDelta(double value)
+        {
+          return value >= -32768.0 && value <= 32767.0;
+        }
+
+        //! Test if a quantized difference fits one byte.
+        static bool
+        fitsByte(int32_t value)
+        {
+          return value >= -128 && value <= 127;
+        }
+
+        //! Set the reference state.
+        void
+        setReference(fp64_t lat, fp64_t lon, int16_t alt, int16_t depth,
+                     int16_t yaw)
+        {
+          m_lat = lat;
+          m_lon = lon;
+          m_alt = alt;
+          m_depth = depth;
+          m_yaw = yaw;
+          m_has_ref = true;
+        }
+
+        //! Apply one quantized delta to the reference state. Encoder
+        //! and decoder run this same step, so they stay in lockstep
+        //! and the quantization error does not accumulate.
+        void
+        applyDelta(int16_t qn, int16_t qe, int8_t dalt, int8_t ddepth,
+                   int16_t dyaw)
+        {
+          Coordinates::WGS84::displace(qn / 10.0, qe / 10.0, &m_lat, &m_lon);
+          m_alt = (int16_t)(m_alt + dalt);
+          m_depth = (int16_t)(m_depth + ddepth);
+          m_yaw = quantize(Math::Angles::normalizeRadian((m_yaw + dyaw) / 100.0), 100.0);
+        }
+      };
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,170 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+#ifndef DUNE_UTILS_CODECS_CODED_PLAN_PROGRESS_HPP_INCLUDED_
+#define DUNE_UTILS_CODECS_CODED_PLAN_PROGRESS_HPP_INCLUDED_
+
+// DUNE headers.
+#include <DUNE/IMC/Definitions.hpp>
+#include <DUNE/Algorithms/CRC16.hpp>
+#include <DUNE/Utils/String.hpp>
+
+namespace DUNE
+{
+  namespace Utils
+  {
+    namespace Codecs
+    {
+      //! This struct has methods to encode a PlanControlState
+      //! IMC message into an UamTxFrame and to decode a
+      //! PlanControlState from an UamRxFrame.
+      //!
+      //! The plan identifier travels as a 16-bit checksum of the
+      //! name instead of the full string, and progress and ETAs are
+      //! packed integers, so the frame is a fixed 10 bytes
+      //! regardless of plan and maneuver name lengths. The decoded
+      //! plan_id is the checksum rendered in hexadecimal: consoles
+      //! that know the plan list can match it against their own
+      //! checksums.
+      struct CodedPlanProgress
+      {
+        //! Code to identify PlanControlState.
+        static const uint8_t c_id = 0xdc;
+
+        //! Value signalling an unknown or negative ETA.
+        static const uint16_t c_invalid_eta = 0xffff;
+
+        //! Encode a PlanControlState message to a UamTxFrame message
+        //! pointer.
+        //! @param[in] msg PlanControlState pointer.
+        //! @param[out] frame UamTxFrame pointer.
+        static void
+        encode(const IMC::PlanControlState* msg, IMC::UamTxFrame* frame)
+        {
+          CodedPlanProgress coded;
+          if (frame->data.size() < coded.getSize())
+            frame->data.resize(coded.getSize());
+
+          uint8_t* ptr = (uint8_t*)&frame->data[0];
+
+          coded.plan_chk = Algorithms::CRC16::compute((const uint8_t*)msg->plan_id.data(),
+                                                      (uint16_t)msg->plan_id.size());
+          coded.state = msg->state;
+          coded.progress = static_cast<int16_t>(msg->plan_progress * 100.0);
+          coded.plan_eta = packETA(msg->plan_eta);
+          coded.man_eta = packETA(msg->man_eta);
+
+          ptr += IMC::serialize(coded.c_id, ptr);
+          ptr += IMC::serialize(coded.plan_chk, ptr);
+          ptr += IMC::serialize(coded.state, ptr);
+          ptr += IMC::serialize(coded.progress, ptr);
+          ptr += IMC::serialize(coded.plan_eta, ptr);
+          ptr += IMC::serialize(coded.man_eta, ptr);
+        }
+
+        //! Decode an UamRxFrame to retrieve a PlanControlState
+        //! message.
+        //! @param[in] frame UamRxFrame pointer.
+        //! @return IMC message.
+        static IMC::Message*
+        decode(const IMC::UamRxFrame* frame)
+        {
+          IMC::PlanControlState* pcs = new IMC::PlanControlState;
+          CodedPlanProgress coded;
+          if (frame->data.size() < coded.getSize())
+            throw std::runtime_error("invalid size");
+
+          uint8_t* ptr = (uint8_t*)&frame->data[1];
+
+          uint16_t length = (uint16_t)frame->data.size() - 1;
+          ptr += IMC::deserialize(coded.plan_chk, ptr, length);
+          ptr += IMC::deserialize(coded.state, ptr, length);
+          ptr += IMC::deserialize(coded.progress, ptr, length);
+          ptr += IMC::deserialize(coded.plan_eta, ptr, length);
+          ptr += IMC::deserialize(coded.man_eta, ptr, length);
+
+          pcs->plan_id = String::str("%04X", coded.plan_chk);
+          pcs->state = coded.state;
+          pcs->plan_progress = (fp32_t)(coded.progress / 100.0);
+          pcs->plan_eta = unpackETA(coded.plan_eta);
+          pcs->man_eta = unpackETA(coded.man_eta);
+
+          return pcs;
+        }
+
+        //! Get payload size.
+        //! @return size of payload.
+        static size_t
+        getSize(void)
+        {
+          // Size of plan checksum, state, progress and both ETAs.
+          return sizeof(c_id) + sizeof(uint16_t) + sizeof(uint8_t)
+          + sizeof(int16_t) + 2 * sizeof(uint16_t);
+        }
+
+      private:
+        //! Checksum of the plan identifier.
+        uint16_t plan_chk;
+        //! State of the plan.
+        uint8_t state;
+        //! Plan progress in hundredths of percent.
+        int16_t progress;
+        //! Plan ETA in seconds, c_invalid_eta if unknown.
+        uint16_t plan_eta;
+        //! Maneuver ETA in seconds, c_invalid_eta if unknown.
+        uint16_t man_eta;
+
+        //! Pack an ETA, saturating and mapping negative (unknown)
+        //! values to c_invalid_eta.
+        //! @param[in] eta ETA in seconds.
+        //! @return packed ETA.
+        static uint16_t
+        packETA(int32_t eta)
+        {
+          if (eta < 0 || eta >= (int32_t)c_invalid_eta)
+            return c_invalid_eta;
+          return (uint16_t)eta;
+        }
+
+        //! Unpack an ETA.
+        //! @param[in] eta packed ETA.
+        //! @return ETA in seconds, -1 if unknown.
+        static int32_t
+        unpackETA(uint16_t eta)
+        {
+          if (eta == c_invalid_eta)
+            return -1;
+          return (int32_t)eta;
+        }
+      };
+    }
+  }
+}
+
+#endif
@@ -220,6 +220,20 @@ namespace DUNE
       return ss.str();
     }
 
+    //! Value of one hexadecimal digit; invalid characters map to
+    //! zero.
+    static inline uint8_t
+    hexNibble(char c)
+    {
+      if (c >= '0' && c <= '9')
+        return c - '0';
+      if (c >= 'a' && c <= 'f')
+        return c - 'a' + 10;
+      if (c >= 'A' && c <= 'F')
+        return c - 'A' + 10;
+      return 0;
+    }
+
     std::string
     String::fromHex(const std::string& str)
     {
@@ -229,12 +243,10 @@ namespace DUNE
       if ((str.size() % 2) != 0)
         return result;
 
+      result.reserve(str.size() / 2);
+
       for (unsigned i = 0; i < str.size(); i += 2)
-      {
-        unsigned c;
-        std::sscanf(str.c_str() + i, "%02X", &c);
-        result.push_back(c);
-      }
+        result.push_back((char)((hexNibble(str[i]) << 4) | hexNibble(str[i + 1])));
 
       return result;
     }
@@ -193,6 +193,7 @@ namespace DUNE
         return ss.str();
       }
 
+      DUNE_PRINTF_FORMAT(1, 2)
       static std::string
       str(const char* format, ...)
       {
@@ -212,6 +213,7 @@ namespace DUNE
         return bfr;
       }
 
+      DUNE_PRINTF_FORMAT(3, 4)
       static int
       format(char* str, size_t size, const char* format, ...)
       {
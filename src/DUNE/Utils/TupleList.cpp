@@ -38,32 +38,52 @@ namespace DUNE
     TupleList&
     TupleList::operator<<(const std::string str)
     {
-      std::vector<std::string> vec;
-      String::split(str, m_tuple_sep, vec);
+      // Scan the string in place instead of materializing a vector of
+      // tuple copies.
+      std::string::size_type pos = 0;
 
-      for (unsigned int i = 0; i < vec.size(); ++i)
+      while (pos < str.size())
       {
-        std::string::size_type idx = vec[i].find(m_sep, 0);
-
-        if (idx == std::string::npos)
-          continue;
-
-        std::string label = String::trim(vec[i].substr(0, idx));
-        std::string value = String::trim(vec[i].substr(idx + 1, std::string::npos));
-
-        if (m_ignore_case)
-          String::toLowerCase(label);
-
-        m_data[label] = value;
+        std::string::size_type end = str.find(m_tuple_sep, pos);
+        if (end == std::string::npos)
+          end = str.size();
+
+        std::string::size_type idx = str.find(m_sep, pos);
+
+        if (idx != std::string::npos && idx < end)
+        {
+          std::string label = String::trim(str.substr(pos, idx - pos));
+          std::string value = String::trim(str.substr(idx + m_sep.size(), end - idx - m_sep.size()));
+
+          if (m_ignore_case)
+            String::toLowerCase(label);
+
+          std::map<std::string, std::string>::iterator itr = m_data.find(label);
+          if (itr == m_data.end())
+          {
+            m_data.insert(std::pair<std::string, std::string>(label, value));
+            m_order.push_back(label);
+          }
+          else
+          {
+            itr->second = value;
+          }
+        }
+
+        pos = end + m_tuple_sep.size();
       }
+
       return *this;
     }
 
     std::ostream&
     operator<<(std::ostream& os, const TupleList& tl)
     {
-      for (std::map<std::string, std::string>::const_iterator itr = tl.m_data.begin(); itr != tl.m_data.end(); ++itr)
+      for (unsigned i = 0; i < tl.m_order.size(); ++i)
+      {
+        std::map<std::string, std::string>::const_iterator itr = tl.m_data.find(tl.m_order[i]);
         os << itr->first << tl.m_sep << itr->second << tl.m_tuple_sep;
+      }
 
       return os;
     }
@@ -71,8 +91,11 @@ namespace DUNE
     std::string&
     operator<<(std::string& os, const TupleList& tl)
     {
-      for (std::map<std::string, std::string>::const_iterator itr = tl.m_data.begin(); itr != tl.m_data.end(); ++itr)
+      for (unsigned i = 0; i < tl.m_order.size(); ++i)
+      {
+        std::map<std::string, std::string>::const_iterator itr = tl.m_data.find(tl.m_order[i]);
         os += itr->first + tl.m_sep + itr->second + tl.m_tuple_sep;
+      }
 
       return os;
     }
@@ -62,6 +62,7 @@ namespace DUNE
       clear(void)
       {
         m_data.clear();
+        m_order.clear();
       }
 
       std::string
@@ -70,7 +71,11 @@ namespace DUNE
         if (m_ignore_case)
           String::toLowerCase(label);
 
-        return m_data[label];
+        std::map<std::string, std::string>::const_iterator itr = m_data.find(label);
+        if (itr == m_data.end())
+          return std::string();
+
+        return itr->second;
       }
 
       template <typename Type>
@@ -80,8 +85,12 @@ namespace DUNE
         if (m_ignore_case)
           String::toLowerCase(label);
 
+        std::map<std::string, std::string>::const_iterator itr = m_data.find(label);
+        if (itr == m_data.end())
+          return dflt;
+
         Type t;
-        std::stringstream sin(m_data[label]);
+        std::stringstream sin(itr->second);
 
         sin >> t;
 
@@ -113,6 +122,8 @@ namespace DUNE
       std::string m_tuple_sep;
       bool m_ignore_case;
       std::map<std::string, std::string> m_data;
+      //! Labels in first-insertion order, for stable iteration.
+      std::vector<std::string> m_order;
     };
   }
 }
@@ -0,0 +1,166 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstring>
+
+// DUNE headers.
+#include <DUNE/Utils/XMLWriter.hpp>
+
+namespace DUNE
+{
+  namespace Utils
+  {
+    XMLWriter::XMLWriter(ByteBuffer& buf):
+      m_buf(buf),
+      m_in_start(false)
+    {
+      m_buf.setSize(0);
+    }
+
+    void
+    XMLWriter::declaration(void)
+    {
+      static const char dcl[] = "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
+      put(dcl, sizeof(dcl) - 1);
+    }
+
+    void
+    XMLWriter::startTag(const std::string& name)
+    {
+      closeStartTag();
+      put("<", 1);
+      put(name.c_str(), name.size());
+      m_open.push_back(name);
+      m_in_start = true;
+    }
+
+    void
+    XMLWriter::attribute(const std::string& name, const std::string& value)
+    {
+      put(" ", 1);
+      put(name.c_str(), name.size());
+      put("=\"", 2);
+      putEscaped(value);
+      put("\"", 1);
+    }
+
+    void
+    XMLWriter::content(const std::string& text)
+    {
+      closeStartTag();
+      putEscaped(text);
+    }
+
+    void
+    XMLWriter::endTag(void)
+    {
+      const std::string& name = m_open.back();
+
+      if (m_in_start)
+      {
+        put("/>", 2);
+        m_in_start = false;
+      }
+      else
+      {
+        put("</", 2);
+        put(name.c_str(), name.size());
+        put(">", 1);
+      }
+
+      m_open.pop_back();
+    }
+
+    void
+    XMLWriter::tag(const std::string& name, const std::string& value)
+    {
+      startTag(name);
+      content(value);
+      endTag();
+    }
+
+    void
+    XMLWriter::put(const char* str, size_t size)
+    {
+      m_buf.appendSigned(str, (uint32_t)size);
+    }
+
+    void
+    XMLWriter::putEscaped(const std::string& str)
+    {
+      size_t start = 0;
+
+      for (size_t i = 0; i < str.size(); ++i)
+      {
+        const char* entity = NULL;
+
+        switch (str[i])
+        {
+          case '"':
+            entity = "&quot;";
+            break;
+          case '&':
+            entity = "&amp;";
+            break;
+          case '\'':
+            entity = "&apos;";
+            break;
+          case '<':
+            entity = "&lt;";
+            break;
+          case '>':
+            entity = "&gt;";
+            break;
+          default:
+            continue;
+        }
+
+        if (i > start)
+          put(str.c_str() + start, i - start);
+
+        put(entity, std::strlen(entity));
+        start = i + 1;
+      }
+
+      if (str.size() > start)
+        put(str.c_str() + start, str.size() - start);
+    }
+
+    void
+    XMLWriter::closeStartTag(void)
+    {
+      if (m_in_start)
+      {
+        put(">", 1);
+        m_in_start = false;
+      }
+    }
+  }
+}
@@ -0,0 +1,120 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+#ifndef DUNE_UTILS_XML_WRITER_HPP_INCLUDED_
+#define DUNE_UTILS_XML_WRITER_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/Utils/ByteBuffer.hpp>
+
+namespace DUNE
+{
+  namespace Utils
+  {
+    // Export DLL Symbol.
+    class DUNE_DLL_SYM XMLWriter;
+
+    //! Streaming XML writer. Elements, attributes and text are
+    //! serialized directly into a caller supplied ByteBuffer with
+    //! predefined entities escaped on write, so repeatedly generated
+    //! documents reuse one allocation instead of building
+    //! intermediate strings.
+    class XMLWriter
+    {
+    public:
+      //! Constructor. The buffer is rewound, not cleared: its
+      //! capacity is kept across documents.
+      //! @param[in] buf destination buffer.
+      XMLWriter(ByteBuffer& buf);
+
+      //! Write the XML declaration.
+      void
+      declaration(void);
+
+      //! Open an element. The start tag is left open so attributes
+      //! can be appended; it is closed by the first content, child
+      //! element or endTag().
+      //! @param[in] name element name.
+      void
+      startTag(const std::string& name);
+
+      //! Write an attribute of the element whose start tag is open.
+      //! @param[in] name attribute name.
+      //! @param[in] value attribute value, escaped on write.
+      void
+      attribute(const std::string& name, const std::string& value);
+
+      //! Write character data inside the current element.
+      //! @param[in] text character data, escaped on write.
+      void
+      content(const std::string& text);
+
+      //! Close the innermost open element, using the short form if it
+      //! has no content.
+      void
+      endTag(void);
+
+      //! Convenience: write an element with character data content
+      //! and no attributes.
+      //! @param[in] name element name.
+      //! @param[in] value character data, escaped on write.
+      void
+      tag(const std::string& name, const std::string& value);
+
+    private:
+      //! Destination buffer.
+      ByteBuffer& m_buf;
+      //! Names of the open elements, innermost last.
+      std::vector<std::string> m_open;
+      //! True if the innermost start tag has not been closed yet.
+      bool m_in_start;
+
+      //! Append raw bytes to the buffer.
+      //! @param[in] str characters to append.
+      //! @param[in] size number of characters.
+      void
+      put(const char* str, size_t size);
+
+      //! Append a string escaping the predefined XML entities.
+      //! @param[in] str string to append.
+      void
+      putEscaped(const std::string& str);
+
+      //! Close the open start tag, if any.
+      void
+      closeStartTag(void);
+    };
+  }
+}
+
+#endif
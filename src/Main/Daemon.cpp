@@ -259,7 +259,12 @@ main(int argc, char** argv)
   Path cfg_file = context.dir_cfg / options.value("--config-file") + ".ini";
   try
   {
-    context.config.parseFile(cfg_file.c_str());
+    Path cache_file = cfg_file + ".cache";
+    if (!context.config.loadCache(cache_file.c_str()))
+    {
+      context.config.parseFile(cfg_file.c_str());
+      context.config.saveCache(cache_file.c_str());
+    }
   }
   catch (std::runtime_error& e)
   {
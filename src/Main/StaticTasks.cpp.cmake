@@ -29,17 +29,20 @@
 // Automatically generated                                                  *
 //***************************************************************************
 
-// ISO C++ 98 headers.
-#include <map>
-#include <cstring>
-
 // DUNE headers.
 #include <DUNE/Tasks/Factory.hpp>
 
 @STATIC_TASKS_SIGNATURES@
 
+//! Table of statically linked tasks, laid out at compile time.
+static const DUNE::Tasks::Factory::StaticTask c_static_tasks[] =
+{
+@STATIC_TASKS_CREATORS@
+  {0, 0}
+};
+
 void
 registerStaticTasks(void)
 {
-@STATIC_TASKS_CREATORS@
+  DUNE::Tasks::Factory::registerStaticTasks(c_static_tasks, (sizeof(c_static_tasks) / sizeof(c_static_tasks[0])) - 1);
 }
@@ -64,14 +64,24 @@ namespace Maneuver
       void
       onStart(const IMC::Rows* maneuver)
       {
-        Memory::clear(m_parser);
-
         try
         {
-          m_parser = new Maneuvers::RowsStages(maneuver, m_task);
+          // Plans repeat rows patterns heavily: a maneuver equal to
+          // the previous one only restarts the iteration over the
+          // stages already computed, and a different one
+          // reconfigures the parser in place, reusing its storage.
+          if (m_parser == NULL)
+            m_parser = new Maneuvers::RowsStages(maneuver, m_task);
+          else if (m_last.fieldsEqual(*maneuver))
+            m_parser->restart();
+          else
+            m_parser->reset(maneuver);
+
+          m_last = *maneuver;
         }
         catch (std::runtime_error& e)
         {
+          Memory::clear(m_parser);
           m_task->signalError(e.what());
           return;
         }
@@ -136,6 +146,8 @@ namespace Maneuver
     private:
       //! Rows stages parser
       Maneuvers::RowsStages* m_parser;
+      //! Maneuver the parser was configured with.
+      IMC::Rows m_last;
       //! Desired path message
       IMC::DesiredPath m_path;
     };
@@ -132,7 +132,8 @@ namespace Maneuver
       Arguments m_args;
 
       Task(const std::string& name, Tasks::Context& ctx):
-        DUNE::Maneuvers::Maneuver(name, ctx)
+        DUNE::Maneuvers::Maneuver(name, ctx),
+        m_type(TYPE_IDLE)
       {
         for (unsigned i = 0; i < TYPE_TOTAL; i++)
         {
@@ -386,15 +387,17 @@ namespace Maneuver
           return;
         }
 
-        m_type = (ManeuverType)itr->second;
-        changeEntity();
-
-        if (m_type >= TYPE_TOTAL)
+        if (itr->second >= TYPE_TOTAL)
         {
           signalError(DTR("wrong maneuver type"));
           return;
         }
 
+        // All handlers are preallocated at resource acquisition:
+        // switching maneuvers is an index swap plus handler start.
+        m_type = (ManeuverType)itr->second;
+        changeEntity();
+
         m_maneuvers[m_type]->start(maneuver);
       }
 
@@ -69,6 +69,10 @@ namespace Monitors
       double max_clock_offs;
       std::string hw_sync_cmd;
       bool change_log;
+      //! 1PPS GPIO number, negative to disable.
+      int pps_gpio;
+      //! Maximum offset corrected by slewing.
+      double pps_max_slew;
     };
 
     struct Task: public DUNE::Tasks::Task
@@ -87,13 +91,21 @@ namespace Monitors
       IMC::ClockControl m_cc;
       //! True if clock is synchronized.
       bool m_clock_synched;
+      //! 1PPS GPIO.
+      Hardware::GPIO* m_pps;
+      //! 1PPS polling pool.
+      IO::Poll m_poll;
+      //! Moving average of 1PPS offset.
+      MovingAverage<double> m_pps_offs;
 
       Task(const std::string& name, Tasks::Context& ctx):
         Tasks::Task(name, ctx),
         m_offs(5),
         m_gps_fixes(0),
         m_last_gps_fix_time(0),
-        m_clock_synched(false)
+        m_clock_synched(false),
+        m_pps(NULL),
+        m_pps_offs(5)
       {
         param("Minimum GPS Fixes", m_args.min_gps_fixes)
         .defaultValue("10")
@@ -119,6 +131,17 @@ namespace Monitors
         .defaultValue("false")
         .description("Change log file after synchronization");
 
+        param("PPS - GPIO", m_args.pps_gpio)
+        .defaultValue("-1")
+        .description("GPIO receiving the GPS 1PPS signal, negative to disable");
+
+        param("PPS - Maximum Slew", m_args.pps_max_slew)
+        .units(Units::Second)
+        .defaultValue("0.1")
+        .minimumValue("0.0")
+        .description("Maximum offset corrected by slewing, pulses further"
+                     " from the top of second are discarded as outliers");
+
         // Initialize entity states.
         setEntityState(IMC::EntityState::ESTA_BOOT, Status::CODE_SYNCING);
 
@@ -126,12 +149,78 @@ namespace Monitors
         bind<IMC::GpsFix>(this);
       }
 
+      void
+      onResourceAcquisition(void)
+      {
+        if (m_args.pps_gpio < 0)
+          return;
+
+        try
+        {
+          m_pps = new Hardware::GPIO(m_args.pps_gpio);
+          m_pps->setDirection(Hardware::GPIO::GPIO_DIR_INPUT);
+          m_pps->setEdge(Hardware::GPIO::GPIO_EDGE_RISING);
+          m_poll.add(m_pps->getNative());
+        }
+        catch (std::exception& e)
+        {
+          Memory::clear(m_pps);
+          war(DTR("unable to setup 1PPS input: %s"), e.what());
+        }
+      }
+
+      void
+      onResourceRelease(void)
+      {
+        if (m_pps != NULL)
+        {
+          m_poll.remove(m_pps->getNative());
+          Memory::clear(m_pps);
+        }
+      }
+
       void
       onResourceInitialization(void)
       {
         m_sync_deadline.setTop(m_args.max_boot_tout);
       }
 
+      //! Discipline the clock with one 1PPS pulse: the pulse marks
+      //! the top of a GPS second, so the fractional part of the
+      //! timestamp taken at the edge is the clock offset. Small
+      //! offsets are averaged and slewed out, keeping timestamps
+      //! monotonic; pulses far from the top of second are discarded.
+      void
+      handlePulse(void)
+      {
+        double ts = Time::Clock::getSinceEpoch();
+        m_pps->clearEdge();
+
+        // Coarse errors are left to the GPS time synchronization.
+        if (!m_clock_synched)
+          return;
+
+        double offs = ts - Math::round(ts);
+        if (std::fabs(offs) > m_args.pps_max_slew)
+        {
+          trace("discarding 1PPS pulse %0.4f s from top of second", offs);
+          return;
+        }
+
+        double avg = m_pps_offs.update(offs);
+
+        try
+        {
+          Time::Clock::slew(-avg);
+        }
+        catch (std::runtime_error& e)
+        {
+          war(DTR("unable to slew clock: %s"), e.what());
+        }
+
+        spew("1PPS offset %0.6f s, average %0.6f s", offs, avg);
+      }
+
       void
       consume(const IMC::GpsFix* msg)
       {
@@ -225,7 +314,18 @@ namespace Monitors
       {
         while (!stopping())
         {
-          waitForMessages(1.0);
+          if (m_pps != NULL)
+          {
+            // The edge must be timestamped as soon as the poller
+            // wakes, so messages are consumed without blocking.
+            if (m_poll.poll(1.0))
+              handlePulse();
+            consumeMessages();
+          }
+          else
+          {
+            waitForMessages(1.0);
+          }
 
           if (m_sync_deadline.overflow() && getEntityState() == IMC::EntityState::ESTA_BOOT)
             setEntityState(IMC::EntityState::ESTA_NORMAL, Status::CODE_NOT_SYNCHED);
@@ -97,11 +97,18 @@ namespace Monitors
       EIdSet m_current;
       //! Ids of monitored entities for default settings.
       EIdSet m_defaults;
+      //! Ids of monitored entities still booting.
+      EIdSet m_boot;
+      //! Ids of monitored entities in fault, error or failure.
+      EIdSet m_critical;
+      //! True when the cached report must be rebuilt.
+      bool m_report_dirty;
       //! Task arguments.
       Arguments m_args;
 
       Task(const std::string& name, Tasks::Context& ctx):
-        DUNE::Tasks::Task(name, ctx)
+        DUNE::Tasks::Task(name, ctx),
+        m_report_dirty(true)
       {
         param("Report Timeout", m_args.report_timeout)
         .units(Units::Second)
@@ -232,6 +239,10 @@ namespace Monitors
         }
 
         r.time = Clock::get();
+
+        if (noteworthy)
+          moveBucket(msg->getSourceEntity(), r.state, msg->state);
+
         r.state = msg->state;
 
         if (noteworthy)
@@ -294,6 +305,56 @@ namespace Monitors
           enable(*it, startup);
       }
 
+      //! Test if a state belongs to the critical severity bucket.
+      //! @param[in] state entity state.
+      //! @return true if the state is fault, error or failure.
+      static bool
+      isCritical(uint8_t state)
+      {
+        return (state == IMC::EntityState::ESTA_FAULT ||
+                state == IMC::EntityState::ESTA_ERROR ||
+                state == IMC::EntityState::ESTA_FAILURE);
+      }
+
+      //! Insert a monitored entity into the bucket of its state.
+      //! @param[in] eid entity ID.
+      //! @param[in] state entity state.
+      void
+      bucketInsert(uint8_t eid, uint8_t state)
+      {
+        if (state == IMC::EntityState::ESTA_BOOT)
+          m_boot.insert(eid);
+        else if (isCritical(state))
+          m_critical.insert(eid);
+
+        m_report_dirty = true;
+      }
+
+      //! Remove a monitored entity from the bucket of its state.
+      //! @param[in] eid entity ID.
+      //! @param[in] state entity state.
+      void
+      bucketErase(uint8_t eid, uint8_t state)
+      {
+        if (state == IMC::EntityState::ESTA_BOOT)
+          m_boot.erase(eid);
+        else if (isCritical(state))
+          m_critical.erase(eid);
+
+        m_report_dirty = true;
+      }
+
+      //! Move a monitored entity between severity buckets.
+      //! @param[in] eid entity ID.
+      //! @param[in] from previous entity state.
+      //! @param[in] to new entity state.
+      void
+      moveBucket(uint8_t eid, uint8_t from, uint8_t to)
+      {
+        bucketErase(eid, from);
+        bucketInsert(eid, to);
+      }
+
       //! Enable monitoring for an entity
       //! @param[in] eid entity ID
       //! @param[in] startup true if task is just starting
@@ -307,6 +368,7 @@ namespace Monitors
           inf(DTR("%s - monitoring enabled"), DTR(r.label.c_str()));
 
           m_current.insert(eid);
+          bucketInsert(eid, r.state);
           r.monitor = true;
 
           if (r.state != IMC::EntityState::ESTA_NORMAL && !startup)
@@ -330,6 +392,7 @@ namespace Monitors
           inf(DTR("%s - monitoring disabled"), DTR(r.label.c_str()));
 
           m_current.erase(eid);
+          bucketErase(eid, r.state);
           r.monitor = false;
         }
         else
@@ -381,40 +444,39 @@ namespace Monitors
         }
       }
 
-      //! Dispatch Entity Monitoring State
+      //! Join the labels of a set of entities.
+      //! @param[in] eset set of entity IDs.
+      //! @param[out] names comma separated list of labels.
       void
-      reportState(void)
+      joinLabels(const EIdSet& eset, std::string& names)
       {
-        m_ems.mcount = m_ems.ecount = m_ems.ccount = 0;
-        m_ems.mnames = m_ems.enames = m_ems.cnames = "";
+        names.clear();
 
-        for (EIdSet::iterator itr = m_current.begin(); itr != m_current.end(); ++itr)
+        for (EIdSet::const_iterator itr = eset.begin(); itr != eset.end(); ++itr)
         {
-          ESRecord& r = m_record[*itr];
+          if (!names.empty())
+            names += ',';
 
-          if (m_ems.mcount++ > 0)
-            m_ems.mnames += ',';
-
-          m_ems.mnames += r.label;
+          names += m_record[*itr].label;
+        }
+      }
 
-          switch ((IMC::EntityState::StateEnum)r.state)
-          {
-            case IMC::EntityState::ESTA_NORMAL:
-              break;
-            case IMC::EntityState::ESTA_FAULT:
-            case IMC::EntityState::ESTA_ERROR:
-            case IMC::EntityState::ESTA_FAILURE:
-              if (m_ems.ccount++ > 0)
-                m_ems.cnames += ',';
-              m_ems.cnames += r.label;
-              break;
-            case IMC::EntityState::ESTA_BOOT:
-              if (m_ems.ecount++ > 0)
-                m_ems.enames += ',';
-              m_ems.enames += r.label;
-              break;
-          }
+      //! Dispatch Entity Monitoring State. The report is cached and
+      //! only rebuilt after monitoring or severity bucket changes.
+      void
+      reportState(void)
+      {
+        if (m_report_dirty)
+        {
+          m_ems.mcount = m_current.size();
+          m_ems.ecount = m_boot.size();
+          m_ems.ccount = m_critical.size();
+          joinLabels(m_current, m_ems.mnames);
+          joinLabels(m_boot, m_ems.enames);
+          joinLabels(m_critical, m_ems.cnames);
+          m_report_dirty = false;
         }
+
         dispatch(m_ems);
       }
 
@@ -439,6 +501,9 @@ namespace Monitors
                                        DTR(r.label.c_str())));
             }
 
+            if (r.monitor)
+              moveBucket(i, r.state, IMC::EntityState::ESTA_FAILURE);
+
             r.time = now;
             r.state = IMC::EntityState::ESTA_FAILURE;
           }
@@ -33,7 +33,6 @@
 // ISO C++ 98 headers.
 #include <cstring>
 #include <vector>
-#include <sstream>
 
 // DUNE headers.
 #include <DUNE/Memory.hpp>
@@ -151,6 +150,11 @@ namespace Monitors
       {
         m_bdata = new BatteryData(m_args->avg_win);
         m_bdata->setEntities(eids);
+
+        // Reserve the interpolation scratch vectors once so confidence
+        // computation does not allocate on every call.
+        m_conf_energs.reserve(5);
+        m_conf_confs.reserve(5);
       }
 
       ~FuelFilter(void)
@@ -366,20 +370,20 @@ namespace Monitors
         fl.value = std::min(100.0f, fl.value);
         fl.confidence = computeConfidence();
 
-        std::stringstream ss;
-
         fl.opmodes.clear();
 
+        char bfr[64];
         for (unsigned i = 0; i < labels.size(); ++i)
         {
-          ss << labels[i] << "="
-             << (m_initial_estimate - m_energy_consumed) / values[i]
-             << ";";
+          String::format(bfr, sizeof(bfr), "=%g;",
+                         (m_initial_estimate - m_energy_consumed) / values[i]);
+          fl.opmodes += labels[i];
+          fl.opmodes += bfr;
         }
 
-        fl.opmodes = ss.str();
-
-        if (m_task != NULL)
+        // Model deviations are expensive to evaluate (several nested
+        // interpolations), only compute them if they will be printed.
+        if (m_task != NULL && m_task->getDebugLevel() >= Tasks::DEBUG_LEVEL_TRACE)
         {
           m_task->trace("Energy Left %.2f Wh", m_initial_estimate - m_energy_consumed);
 
@@ -630,38 +634,36 @@ namespace Monitors
         goodBadConfidence(good_conf, bad_conf, interval,
                           good_est, bad_est, merged_est);
 
-        std::vector<float> vec_energs, vec_confs;
-
         if (merged_est >= bad_est && merged_est <= good_est)
         {
           float energs[] = {0.0f, bad_est, merged_est, good_est, m_args->full_capacity};
           float confs[] = {0.0f, bad_conf, c_top_conf, good_conf, 0.0f};
 
-          vec_energs.assign(energs, energs + sizeof(energs) / sizeof(float));
-          vec_confs.assign(confs, confs + sizeof(confs) / sizeof(float));
+          m_conf_energs.assign(energs, energs + sizeof(energs) / sizeof(float));
+          m_conf_confs.assign(confs, confs + sizeof(confs) / sizeof(float));
         }
         else if (merged_est < bad_est)
         {
           float energs[] = {0.0f, merged_est, bad_est, good_est, m_args->full_capacity};
           float confs[] = {0.0f, c_top_conf, bad_conf, good_conf, 0.0f};
 
-          vec_energs.assign(energs, energs + sizeof(energs) / sizeof(float));
-          vec_confs.assign(confs, confs + sizeof(confs) / sizeof(float));
+          m_conf_energs.assign(energs, energs + sizeof(energs) / sizeof(float));
+          m_conf_confs.assign(confs, confs + sizeof(confs) / sizeof(float));
         }
         else if (merged_est > good_est)
         {
           float energs[] = {0.0f, bad_est, good_est, merged_est, m_args->full_capacity};
           float confs[] = {0.0f, bad_conf, good_conf, c_top_conf, 0.0f};
 
-          vec_energs.assign(energs, energs + sizeof(energs) / sizeof(float));
-          vec_confs.assign(confs, confs + sizeof(confs) / sizeof(float));
+          m_conf_energs.assign(energs, energs + sizeof(energs) / sizeof(float));
+          m_conf_confs.assign(confs, confs + sizeof(confs) / sizeof(float));
         }
         else
         {
           return -1.0;
         }
 
-        conf = piecewiseLI(vec_confs, vec_energs, energy);
+        conf = piecewiseLI(m_conf_confs, m_conf_energs, energy);
 
         return std::max(conf, 0.0f);
       }
@@ -764,6 +766,9 @@ namespace Monitors
       float m_est_rate;
       //! Pointer to typename T (which could be class Task)
       Tasks::Task* m_task;
+      //! Interpolation scratch vectors for confidence computation.
+      std::vector<float> m_conf_energs;
+      std::vector<float> m_conf_confs;
     };
   }
 }
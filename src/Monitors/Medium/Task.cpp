@@ -78,12 +78,16 @@ namespace Monitors
     {
       //! Vehicle Medium.
       IMC::VehicleMedium m_vm;
-      //! Timer to check status of water measurements.
-      Time::Counter<float> m_in_water;
-      //! Timer to check if we're capable of detecting water.
-      Time::Counter<float> m_wet_devs;
-      //! Timer to check presence of GPS fixes.
-      Time::Counter<float> m_gps_status;
+      //! Time of the last valid wet measurement.
+      double m_water_time;
+      //! Time of the last message from a wet measurement sensor.
+      double m_wet_time;
+      //! Time of the last valid GPS fix.
+      double m_gps_time;
+      //! Earliest pending freshness deadline, negative for none.
+      double m_next_eval;
+      //! True when stored inputs changed since the last evaluation.
+      bool m_eval;
       //! Initialization timer.
       Time::Counter<float> m_init;
       //! GPS validation bits.
@@ -103,6 +107,11 @@ namespace Monitors
 
       Task(const std::string& name, Tasks::Context& ctx):
         Tasks::Periodic(name, ctx),
+        m_water_time(-1.0),
+        m_wet_time(-1.0),
+        m_gps_time(-1.0),
+        m_next_eval(-1.0),
+        m_eval(true),
         m_depth(0),
         m_airspeed(0),
         m_gndspeed(0),
@@ -175,8 +184,6 @@ namespace Monitors
                           IMC::GpsFix::GFV_VALID_HDOP | IMC::GpsFix::GFV_VALID_VDOP |
                           IMC::GpsFix::GFV_VALID_POS);
 
-        m_wet_devs.setTop(c_water_presence);
-
         // Register consumers.
         bind<IMC::EntityState>(this);
         bind<IMC::EstimatedState>(this);
@@ -203,8 +210,11 @@ namespace Monitors
       onResourceInitialization(void)
       {
         m_init.setTop(m_args.init_time);
-        m_in_water.setTop(m_args.water_timeout);
-        m_gps_status.setTop(m_args.gps_timeout);
+
+        double now = Clock::getSinceEpoch();
+        m_water_time = now;
+        m_wet_time = now;
+        m_gps_time = now;
       }
 
       void
@@ -216,10 +226,12 @@ namespace Monitors
         if (msg->getSourceEntity() != m_medium_eid)
           return;
 
-        m_wet_devs.reset();
+        m_wet_time = msg->getTimeStamp();
 
         if (msg->description == DTR("water"))
-          m_in_water.reset();
+          m_water_time = msg->getTimeStamp();
+
+        m_eval = true;
       }
 
       void
@@ -231,6 +243,7 @@ namespace Monitors
         m_depth = msg->depth;
         // For UAVs: Height is positive upwards, z is positive downwards.
         m_altitude = msg->alt;
+        m_eval = true;
       }
 
       void
@@ -240,15 +253,17 @@ namespace Monitors
           return;
 
         m_airspeed = msg->value;
+        m_eval = true;
       }
 
       void
       consume(const IMC::GpsFix* msg)
       {
         if ((msg->validity & m_gps_val_bits) == m_gps_val_bits)
-          m_gps_status.reset();
+          m_gps_time = msg->getTimeStamp();
 
         m_gndspeed = msg->sog;
+        m_eval = true;
       }
 
       void
@@ -257,10 +272,12 @@ namespace Monitors
         if (isUAV())
           return;
 
-        m_wet_devs.reset();
+        m_wet_time = msg->getTimeStamp();
 
         if (msg->value >= m_args.water_lm)
-          m_in_water.reset();
+          m_water_time = msg->getTimeStamp();
+
+        m_eval = true;
       }
 
       void
@@ -269,57 +286,72 @@ namespace Monitors
         if (isUAV())
           return;
 
-        m_wet_devs.reset();
+        m_wet_time = msg->getTimeStamp();
 
         if (msg->value >= m_args.water_lm)
-          m_in_water.reset();
+          m_water_time = msg->getTimeStamp();
+
+        m_eval = true;
       }
 
       //! Routine to check if we have recent wet sensor measurements.
+      //! @param[in] now current time.
       //! @return true if we have recent measurements, false otherwise.
       bool
-      inWater(void)
+      inWater(double now) const
       {
-        return (!m_in_water.overflow());
+        return (now - m_water_time) < m_args.water_timeout;
       }
 
       //! Routine to check if we have recent valid GPS measurements.
+      //! @param[in] now current time.
       //! @return true if we have recent fixes, false otherwise.
       bool
-      isGpsAvailable(void)
+      isGpsAvailable(double now) const
+      {
+        return (now - m_gps_time) < m_args.gps_timeout;
+      }
+
+      //! Routine to check if wet measurement sensors are present.
+      //! @param[in] now current time.
+      //! @return true if wet sensors produced data recently.
+      bool
+      hasWetSensors(double now) const
       {
-        return (!m_gps_status.overflow());
+        return (now - m_wet_time) < c_water_presence;
       }
 
       //! Check presence of water sensors.
+      //! @param[in] now current time.
       void
-      checkWater(void)
+      checkWater(double now)
       {
-        if (m_wet_devs.overflow())
+        if (!hasWetSensors(now))
         {
           m_vm.medium = IMC::VehicleMedium::VM_UNKNOWN;
           return;
         }
 
-        if (inWater())
+        if (inWater(now))
           m_vm.medium = IMC::VehicleMedium::VM_WATER;
         else
           m_vm.medium = IMC::VehicleMedium::VM_GROUND;
       }
 
       //! Check data input. Only for water going vehicles.
+      //! @param[in] now current time.
       void
-      checkUUV(void)
+      checkUUV(double now)
       {
         if (isUAV())
           return;
 
-        if (!waterMediumCheck())
+        if (!waterMediumCheck(now))
           return;
 
-        checkWater();
+        checkWater(now);
 
-        if ((m_depth > m_args.depth_lm) && !isGpsAvailable())
+        if ((m_depth > m_args.depth_lm) && !isGpsAvailable(now))
           m_vm.medium = IMC::VehicleMedium::VM_UNDERWATER;
       }
 
@@ -370,15 +402,16 @@ namespace Monitors
       }
 
       //! Check water medium presence.
+      //! @param[in] now current time.
       //! @return true if water medium can be detected or if it can be ignored.
       bool
-      waterMediumCheck(void)
+      waterMediumCheck(double now)
       {
         if (isUAV())
           return true;
 
         // No way to detect medium properly.
-        if (isActive() && m_wet_devs.overflow())
+        if (isActive() && !hasWetSensors(now))
         {
           m_vm.medium = IMC::VehicleMedium::VM_UNKNOWN;
           dispatch(m_vm);
@@ -390,8 +423,9 @@ namespace Monitors
       }
 
       //! Update state machine.
+      //! @param[in] now current time.
       void
-      updateStateMachine(void)
+      updateStateMachine(double now)
       {
         // Task state machine.
         switch (m_vm.medium)
@@ -401,33 +435,47 @@ namespace Monitors
             break;
 
           case (IMC::VehicleMedium::VM_GROUND):
-            checkUUV();
+            checkUUV(now);
             checkUAV();
             break;
 
           case (IMC::VehicleMedium::VM_WATER):
-            checkUUV();
+            checkUUV(now);
             break;
 
           case (IMC::VehicleMedium::VM_UNDERWATER):
-            if ((m_depth < m_args.depth_lm - c_depth_hyst) && isGpsAvailable())
+            if ((m_depth < m_args.depth_lm - c_depth_hyst) && isGpsAvailable(now))
               m_vm.medium = IMC::VehicleMedium::VM_WATER;
             break;
 
           case (IMC::VehicleMedium::VM_UNKNOWN):
-            checkUUV();
+            checkUUV(now);
             break;
         }
+      }
 
-        if (isActive())
+      //! Compute the earliest future instant at which a freshness
+      //! window expires and the medium can change without new data.
+      //! @param[in] now current time.
+      //! @return deadline in seconds since epoch, negative if none.
+      double
+      nextDeadline(double now) const
+      {
+        double windows[3] =
         {
-          setEntityState(IMC::EntityState::ESTA_NORMAL, Status::CODE_ACTIVE);
-          dispatch(m_vm);
-        }
-        else
+          m_water_time + m_args.water_timeout,
+          m_gps_time + m_args.gps_timeout,
+          m_wet_time + c_water_presence
+        };
+
+        double deadline = -1.0;
+        for (unsigned i = 0; i < 3; ++i)
         {
-          setEntityState(IMC::EntityState::ESTA_NORMAL, Status::CODE_IDLE);
+          if (windows[i] > now && (deadline < 0.0 || windows[i] < deadline))
+            deadline = windows[i];
         }
+
+        return deadline;
       }
 
       void
@@ -437,7 +485,27 @@ namespace Monitors
         if (!m_init.overflow())
           return;
 
-        updateStateMachine();
+        double now = Clock::getSinceEpoch();
+
+        // Consumers only store data, so the medium can only change
+        // when new data arrived or a freshness window expired:
+        // coalesce state machine evaluations to those instants.
+        if (m_eval || (m_next_eval >= 0.0 && now >= m_next_eval))
+        {
+          m_eval = false;
+          updateStateMachine(now);
+          m_next_eval = nextDeadline(now);
+        }
+
+        if (isActive())
+        {
+          setEntityState(IMC::EntityState::ESTA_NORMAL, Status::CODE_ACTIVE);
+          dispatch(m_vm);
+        }
+        else
+        {
+          setEntityState(IMC::EntityState::ESTA_NORMAL, Status::CODE_IDLE);
+        }
       }
     };
   }
@@ -33,6 +33,7 @@
 #include <cstring>
 #include <map>
 #include <iostream>
+#include <iomanip>
 #include <sstream>
 
 // DUNE headers.
@@ -92,6 +92,49 @@ namespace Monitors
       double error_time;
       //! Failure error counter.
       unsigned error_count;
+      //! Time constant of the rolling statistics.
+      double stats_tau;
+      //! Number of samples kept for burst capture.
+      unsigned burst_samples;
+    };
+
+    //! One diagnostic sample kept in the burst capture ring.
+    struct Sample
+    {
+      //! Time of the sample.
+      double time;
+      //! Measured position.
+      float position;
+      //! Commanded position.
+      float command;
+      //! Electric current.
+      float current;
+    };
+
+    //! Constant-memory rolling statistics of one servo, decayed
+    //! exponentially with the configured time constant.
+    struct Stats
+    {
+      //! Windowed mean of the electric current.
+      double mean_curr;
+      //! Decayed maximum of the electric current.
+      double max_curr;
+      //! Decayed integral of the absolute position error.
+      double err_integral;
+      //! Time of the last current sample.
+      double last_curr_time;
+      //! Time of the last position sample.
+      double last_pos_time;
+
+      void
+      clear(void)
+      {
+        mean_curr = 0;
+        max_curr = 0;
+        err_integral = 0;
+        last_curr_time = -1;
+        last_pos_time = -1;
+      }
     };
 
     struct Task: public Tasks::Task
@@ -118,6 +161,16 @@ namespace Monitors
       std::queue<double> m_queue[c_servo_count];
       //! Major failure in one of the servos.
       bool m_servo_fail;
+      //! Rolling statistics.
+      Stats m_stats[c_servo_count];
+      //! Burst capture rings, preallocated.
+      std::vector<Sample> m_ring[c_servo_count];
+      //! Next slot of each burst capture ring.
+      unsigned m_ring_head[c_servo_count];
+      //! Number of valid samples in each burst capture ring.
+      unsigned m_ring_fill[c_servo_count];
+      //! Last electric current reading of each servo.
+      float m_last_curr[c_servo_count];
 
       Task(const std::string& name, Tasks::Context& ctx):
         Tasks::Task(name, ctx),
@@ -203,6 +256,19 @@ namespace Monitors
         .minimumValue("3")
         .description("Maximum number of errors allowed in a period of time that issue a failure");
 
+        param("Statistics Time Constant", m_args.stats_tau)
+        .units(Units::Second)
+        .defaultValue("10.0")
+        .minimumValue("1.0")
+        .description("Time constant of the exponentially decayed rolling"
+                     " statistics (mean and maximum current, position error"
+                     " integral)");
+
+        param("Burst Capture Samples", m_args.burst_samples)
+        .defaultValue("32")
+        .description("Number of samples kept per servo and dumped to the log"
+                     " when a fault triggers, zero disables burst capture");
+
         for (unsigned i = 0; i < c_servo_count; ++i)
         {
           std::string option = String::str("Entity Label - Current %d", i);
@@ -285,8 +351,16 @@ namespace Monitors
         for (unsigned i = 0; i < c_servo_count; ++i)
         {
           m_set_servo[i] = 0.0;
+          m_servo_pos[i] = 0.0;
           m_on_fault[i] = FT_NONE;
           m_timer.setTop(c_error_timeout);
+
+          m_last_curr[i] = 0.0;
+          m_stats[i].clear();
+          m_ring[i].clear();
+          m_ring[i].resize(m_args.burst_samples);
+          m_ring_head[i] = 0;
+          m_ring_fill[i] = 0;
         }
 
         if (m_args.pos_fault_detect || m_args.curr_fault_detect)
@@ -335,6 +409,52 @@ namespace Monitors
         }
       }
 
+      //! Record one diagnostic sample in the burst capture ring.
+      //! @param[in] i number of the servo.
+      void
+      record(unsigned i)
+      {
+        if (m_ring[i].empty())
+          return;
+
+        Sample& s = m_ring[i][m_ring_head[i]];
+        s.time = Clock::get();
+        s.position = m_servo_pos[i];
+        s.command = m_set_servo[i];
+        s.current = m_last_curr[i];
+
+        m_ring_head[i] = (m_ring_head[i] + 1) % m_ring[i].size();
+        if (m_ring_fill[i] < m_ring[i].size())
+          ++m_ring_fill[i];
+      }
+
+      //! Dump the rolling statistics and the burst capture ring of
+      //! one servo to the log, oldest sample first.
+      //! @param[in] i number of the servo.
+      void
+      dumpBurst(unsigned i)
+      {
+        inf(DTR("servo #%d: mean current %0.3f A, peak current %0.3f A,"
+                " position error integral %0.3f rad.s"),
+            i, m_stats[i].mean_curr, m_stats[i].max_curr,
+            m_stats[i].err_integral);
+
+        if (m_ring_fill[i] == 0)
+          return;
+
+        unsigned size = m_ring[i].size();
+        unsigned first = (m_ring_head[i] + size - m_ring_fill[i]) % size;
+        double ref = m_ring[i][(m_ring_head[i] + size - 1) % size].time;
+
+        for (unsigned k = 0; k < m_ring_fill[i]; ++k)
+        {
+          const Sample& s = m_ring[i][(first + k) % size];
+          inf("servo #%d burst: %+0.3f s | position %0.4f | command %0.4f"
+              " | current %0.3f", i, s.time - ref, s.position, s.command,
+              s.current);
+        }
+      }
+
       //! Test for fault in servo positioning
       //! @param[in] msg pointer to ServoPosition message
       void
@@ -342,6 +462,20 @@ namespace Monitors
       {
         unsigned i = msg->id;
 
+        m_servo_pos[i] = msg->value;
+
+        // Decayed position error integral.
+        double now = Clock::get();
+        if (m_stats[i].last_pos_time >= 0)
+        {
+          double dt = now - m_stats[i].last_pos_time;
+          m_stats[i].err_integral *= std::exp(-dt / m_args.stats_tau);
+          m_stats[i].err_integral += std::fabs(msg->value - m_set_servo[i]) * dt;
+        }
+        m_stats[i].last_pos_time = now;
+
+        record(i);
+
         if (m_pos_monitor[i] == NULL)
         {
           m_pos_monitor[i] = new ServoPositionMonitor<float>(m_args.pos_error_threshold,
@@ -387,6 +521,27 @@ namespace Monitors
       {
         uint8_t was_on_fault = m_on_fault[i];
 
+        // Rolling current statistics: windowed mean and decayed peak.
+        m_last_curr[i] = value;
+        double now = Clock::get();
+        if (m_stats[i].last_curr_time < 0)
+        {
+          m_stats[i].mean_curr = value;
+          m_stats[i].max_curr = value;
+        }
+        else
+        {
+          double dt = now - m_stats[i].last_curr_time;
+          double alpha = dt / (m_args.stats_tau + dt);
+          m_stats[i].mean_curr += alpha * (value - m_stats[i].mean_curr);
+          m_stats[i].max_curr *= std::exp(-dt / m_args.stats_tau);
+          if (value > m_stats[i].max_curr)
+            m_stats[i].max_curr = value;
+        }
+        m_stats[i].last_curr_time = now;
+
+        record(i);
+
         // test for fault occurrence
         float curr = m_curr_monitor[i]->updateAndTest(value);
 
@@ -426,6 +581,10 @@ namespace Monitors
         }
         else
         {
+          // Dump the rolling statistics and the last samples for
+          // post-mortem diagnosis of the fault.
+          dumpBurst(id);
+
           m_queue[id].push(Time::Clock::get());
           if (m_queue[id].size() > m_args.error_count)
           {
@@ -124,7 +124,7 @@ namespace Navigation
           param("GPS timeout", m_args.gps_timeout)
           .units(Units::Second)
           .defaultValue("3.0")
-          .minimumValue("2.0")
+          .minimumValue("1.0")
           .description("No GPS readings timeout");
 
           param("GPS Maximum HACC", m_args.max_hacc)
@@ -81,6 +81,10 @@ namespace Plan
     {
       //! Path to DB file
       std::string db_path;
+      //! SQLite journal mode
+      std::string journal_mode;
+      //! SQLite synchronous level
+      std::string sync_level;
     };
 
     struct Task: public DUNE::Tasks::Task
@@ -114,6 +118,14 @@ namespace Plan
         .defaultValue("")
         .description("Path to DB file");
 
+        param("Journal Mode", m_args.journal_mode)
+        .defaultValue("WAL")
+        .description("SQLite journal mode (DELETE, TRUNCATE, WAL)");
+
+        param("Synchronous Mode", m_args.sync_level)
+        .defaultValue("NORMAL")
+        .description("SQLite synchronous level (OFF, NORMAL, FULL)");
+
         bind<IMC::PlanControl>(this);
         bind<IMC::PlanDB>(this);
         bind<IMC::PowerOperation>(this);
@@ -142,19 +154,33 @@ namespace Plan
 
         m_db = new Database::Connection(db_file.c_str(), Database::Connection::CF_CREATE);
 
+        // WAL keeps fsync off the critical path of plan writes.
+        try
+        {
+          if (!m_args.journal_mode.empty())
+            m_db->setJournalMode(m_args.journal_mode.c_str());
+
+          if (!m_args.sync_level.empty())
+            m_db->setSynchronous(m_args.sync_level.c_str());
+        }
+        catch (std::runtime_error& e)
+        {
+          war(DTR("unable to configure journaling: %s"), e.what());
+        }
+
         // Create Plan table and initialize associated statements
         m_db->execute(c_plan_table_stmt);
-        m_insert_plan_stmt = new Database::Statement(c_insert_plan_stmt, *m_db);
-        m_delete_plan_stmt = new Database::Statement(c_delete_plan_stmt, *m_db);
-        m_plan_iterator_stmt = new Database::Statement(c_plan_iterator_stmt, *m_db);
-        m_query_plan_stmt = new Database::Statement(c_query_plan_stmt, *m_db);
-        m_get_plan_stmt = new Database::Statement(c_get_plan_stmt, *m_db);
-        m_delete_all_plans_stmt = new Database::Statement(c_delete_all_plans_stmt, *m_db);
+        m_insert_plan_stmt = m_db->prepared(c_insert_plan_stmt);
+        m_delete_plan_stmt = m_db->prepared(c_delete_plan_stmt);
+        m_plan_iterator_stmt = m_db->prepared(c_plan_iterator_stmt);
+        m_query_plan_stmt = m_db->prepared(c_query_plan_stmt);
+        m_get_plan_stmt = m_db->prepared(c_get_plan_stmt);
+        m_delete_all_plans_stmt = m_db->prepared(c_delete_all_plans_stmt);
 
         // Create Plan table and initialize associated statements
         m_db->execute(c_lastchange_table_stmt);
-        m_lastchange_update_stmt = new Database::Statement(c_lastchange_update_stmt, *m_db);
-        m_lastchange_query_stmt = new Database::Statement(c_lastchange_query_stmt, *m_db);
+        m_lastchange_update_stmt = m_db->prepared(c_lastchange_update_stmt);
+        m_lastchange_query_stmt = m_db->prepared(c_lastchange_query_stmt);
 
         if (!m_lastchange_query_stmt->execute())
         {
@@ -177,14 +203,7 @@ namespace Plan
         if (m_db == NULL)
           return;
 
-        delete m_insert_plan_stmt;
-        delete m_delete_plan_stmt;
-        delete m_plan_iterator_stmt;
-        delete m_query_plan_stmt;
-        delete m_get_plan_stmt;
-        delete m_delete_all_plans_stmt;
-        delete m_lastchange_update_stmt;
-        delete m_lastchange_query_stmt;
+        // Statements are owned by the connection's cache.
         delete m_db;
 
         m_db = NULL;
@@ -457,9 +476,21 @@ namespace Plan
           Database::Blob data;
           *m_get_plan_stmt >> data;
 
-          IMC::PlanSpecification spec;
-          spec.deserializeFields((const uint8_t*)&data[0], data.size());
-          m_reply.arg.set(&spec);
+          // Hand the deserialized specification to the reply instead
+          // of cloning it: large plans hold hundreds of maneuvers.
+          IMC::PlanSpecification* spec = new IMC::PlanSpecification;
+
+          try
+          {
+            spec->deserializeFields((const uint8_t*)&data[0], data.size());
+          }
+          catch (...)
+          {
+            delete spec;
+            throw;
+          }
+
+          m_reply.arg.take(spec);
 
           onSuccess();
         }
@@ -27,8 +27,13 @@
 // Author: Pedro Calado                                                     *
 //***************************************************************************
 
+// ISO C++ 98 headers.
+#include <cstring>
+
 // DUNE headers.
 #include <DUNE/I18N.hpp>
+#include <DUNE/Algorithms/MD5.hpp>
+#include <DUNE/Utils/ByteBuffer.hpp>
 
 // Local headers.
 #include "Plan.hpp"
@@ -46,6 +51,8 @@ namespace Plan
       m_max_depth(max_depth),
       m_predict_fuel(fpredict),
       m_progress(0.0),
+      m_exec_duration(-1.0),
+      m_prof_man(NULL),
       m_est_cal_time(0),
       m_profiles(NULL),
       m_beyond_dur(false),
@@ -56,7 +63,10 @@ namespace Plan
       m_config(cfg),
       m_fpred(NULL),
       m_task(task),
-      m_properties(0)
+      m_properties(0),
+      m_cache_valid(false),
+      m_cache_imu(false),
+      m_cache_has_tline(false)
     {
       try
       {
@@ -105,6 +115,9 @@ namespace Plan
       m_curr_node = NULL;
       m_seq_nodes.clear();
       m_progress = -1.0;
+      m_exec_duration = -1.0;
+      m_prof_id.clear();
+      m_prof_man = NULL;
       m_beyond_dur = false;
       m_started_maneuver = false;
       m_est_cal_time = m_min_cal_time;
@@ -117,6 +130,7 @@ namespace Plan
 
       m_cat.clear();
       m_properties = 0;
+      m_cache_valid = false;
     }
 
     void
@@ -125,6 +139,22 @@ namespace Plan
                 IMC::PlanStatistics& ps, bool imu_enabled,
                 const IMC::EstimatedState* state)
     {
+      uint8_t digest[c_digest_size];
+      computeSpecDigest(digest);
+
+      // Re-running the specification that was compiled last: reuse
+      // the graph, profiles and statistics instead of re-validating
+      // the whole plan.
+      if (m_cache_valid && m_cache_imu == imu_enabled &&
+          std::memcmp(digest, m_cache_md5, c_digest_size) == 0)
+      {
+        reuseCompiled(cinfo, ps);
+        m_last_id = m_spec->start_man_id;
+        return;
+      }
+
+      m_cache_valid = false;
+
       clear();
 
       // Build Graph of maneuvers and transitions, if this fails, parse fails
@@ -134,9 +164,54 @@ namespace Plan
 
       m_last_id = m_spec->start_man_id;
 
+      std::memcpy(m_cache_md5, digest, c_digest_size);
+      m_cache_imu = imu_enabled;
+      m_cache_ps = ps;
+      m_cache_valid = true;
+
       return;
     }
 
+    void
+    Plan::computeSpecDigest(uint8_t* digest)
+    {
+      unsigned size = m_spec->getPayloadSerializationSize();
+      Utils::ByteBuffer bfr(size);
+      m_spec->serializeFields(bfr.getBuffer());
+      Algorithms::MD5::compute(bfr.getBuffer(), size, digest);
+    }
+
+    void
+    Plan::reuseCompiled(const std::map<std::string, IMC::EntityInfo>& cinfo,
+                        IMC::PlanStatistics& ps)
+    {
+      // Reset run-time state only; the compiled structures (graph,
+      // sequenced nodes, time profiles, durations) are still valid.
+      m_curr_node = NULL;
+      m_progress = -1.0;
+      m_prof_id.clear();
+      m_prof_man = NULL;
+      m_beyond_dur = false;
+      m_started_maneuver = false;
+
+      if (m_calib != NULL)
+        m_calib->clear();
+
+      // The action schedule is consumed while a plan runs, so it is
+      // rebuilt from the cached timeline.
+      if (m_sched != NULL)
+      {
+        Memory::clear(m_sched);
+        if (m_cache_has_tline)
+          m_sched = new ActionSchedule(m_task, m_spec, m_seq_nodes,
+                                       m_cache_tline, cinfo);
+        else
+          m_sched = new ActionSchedule(m_task, m_spec, m_seq_nodes, cinfo);
+      }
+
+      ps = m_cache_ps;
+    }
+
     void
     Plan::planStarted(void)
     {
@@ -331,7 +406,7 @@ namespace Plan
     // Private
 
     float
-    Plan::getExecutionDuration(void) const
+    Plan::computeExecutionDuration(void) const
     {
       if (!isLinear() || !m_profiles->size())
         return -1.0;
@@ -378,6 +453,37 @@ namespace Plan
       return false;
     }
 
+    void
+    Plan::validateManeuver(const std::set<uint16_t>* supported_maneuvers,
+                           const IMC::PlanManeuver* pman)
+    {
+      if (pman->data.isNull())
+        throw ParseError(pman->maneuver_id + DTR(": actual maneuver not specified"));
+
+      // A maneuver whose payload digest was already found feasible
+      // needs no re-checking: when the operator edits one maneuver of
+      // a large plan, only that maneuver is validated again.
+      unsigned size = pman->getPayloadSerializationSize();
+      Utils::ByteBuffer bfr(size);
+      pman->serializeFields(bfr.getBuffer());
+      uint8_t digest[c_digest_size];
+      Algorithms::MD5::compute(bfr.getBuffer(), size, digest);
+      std::string key((const char*)digest, c_digest_size);
+
+      if (m_man_feasible.find(key) != m_man_feasible.end())
+        return;
+
+      const IMC::Message* m = pman->data.get();
+
+      if (supported_maneuvers->find(m->getId()) == supported_maneuvers->end())
+        throw ParseError(pman->maneuver_id + DTR(": maneuver is not supported"));
+
+      if (!isDepthSafe(m))
+        throw ParseError(pman->maneuver_id + DTR(": maneuver depth beyond limits"));
+
+      m_man_feasible.insert(key);
+    }
+
     void
     Plan::buildGraph(const std::set<uint16_t>* supported_maneuvers)
     {
@@ -386,64 +492,60 @@ namespace Plan
       if (!m_spec->maneuvers.size())
         throw ParseError(m_spec->plan_id + DTR(": no maneuvers"));
 
-      IMC::MessageList<IMC::PlanManeuver>::const_iterator mitr;
-      mitr = m_spec->maneuvers.begin();
+      // Feasibility results are only valid against the same set of
+      // supported maneuvers.
+      if (m_man_feasible_set != *supported_maneuvers)
+      {
+        m_man_feasible.clear();
+        m_man_feasible_set = *supported_maneuvers;
+      }
 
-      // parse maneuvers and transitions
-      do
+      // First pass: check maneuvers and create the graph nodes.
+      IMC::MessageList<IMC::PlanManeuver>::const_iterator mitr;
+      for (mitr = m_spec->maneuvers.begin(); mitr != m_spec->maneuvers.end(); ++mitr)
       {
         if (*mitr == NULL)
-        {
-          ++mitr;
           continue;
-        }
-
-        if ((*mitr)->data.isNull())
-          throw ParseError((*mitr)->maneuver_id + DTR(": actual maneuver not specified"));
-
-        const IMC::Message* m = (*mitr)->data.get();
 
-        if (supported_maneuvers->find(m->getId()) == supported_maneuvers->end())
-          throw ParseError((*mitr)->maneuver_id + DTR(": maneuver is not supported"));
-
-        if (!isDepthSafe(m))
-          throw ParseError((*mitr)->maneuver_id + DTR(": maneuver depth beyond limits"));
+        validateManeuver(supported_maneuvers, *mitr);
 
         if ((*mitr)->maneuver_id == m_spec->start_man_id)
           start_maneuver_ok = true;
 
         Node node;
-        bool matched = false;
-
         node.pman = (*mitr);
+        m_graph[(*mitr)->maneuver_id] = node;
+      }
 
-        IMC::MessageList<IMC::PlanTransition>::const_iterator tritr;
-        tritr = m_spec->transitions.begin();
+      // Single pass over the transitions fills the outgoing lists and
+      // marks the maneuvers that have an incoming transition.
+      std::set<std::string> has_incoming;
+      IMC::MessageList<IMC::PlanTransition>::const_iterator tritr;
+      for (tritr = m_spec->transitions.begin(); tritr != m_spec->transitions.end(); ++tritr)
+      {
+        if (*tritr == NULL)
+          continue;
 
-        for (; tritr != m_spec->transitions.end(); ++tritr)
-        {
-          if (*tritr == NULL)
-            continue;
+        has_incoming.insert((*tritr)->dest_man);
 
-          if ((*tritr)->dest_man == (*mitr)->maneuver_id)
-            matched = true;
+        PlanMap::iterator node = m_graph.find((*tritr)->source_man);
+        if (node != m_graph.end())
+          node->second.trans.push_back(*tritr);
+      }
 
-          if ((*tritr)->source_man == (*mitr)->maneuver_id)
-            node.trans.push_back((*tritr));
-        }
+      PlanMap::const_iterator nitr = m_graph.begin();
+      for (; nitr != m_graph.end(); ++nitr)
+      {
+        if (nitr->first == m_spec->start_man_id)
+          continue;
 
-        // if a match was not found and this is not the start maneuver
-        if (!matched && ((*mitr)->maneuver_id != m_spec->start_man_id))
+        if (has_incoming.find(nitr->first) == has_incoming.end())
         {
           std::string str = DTR(": maneuver has no incoming transition"
                                 " and it's not the initial maneuver");
-          throw ParseError((*mitr)->maneuver_id + str);
+          throw ParseError(nitr->first + str);
         }
-
-        m_graph[(*mitr)->maneuver_id] = node;
-        ++mitr;
       }
-      while (mitr != m_spec->maneuvers.end());
 
       if (!start_maneuver_ok)
         throw ParseError(m_spec->start_man_id + DTR(": invalid start maneuver"));
@@ -458,6 +560,8 @@ namespace Plan
       ps.plan_id = m_spec->plan_id;
       PreStatistics pre_stat(&ps);
 
+      m_cache_has_tline = false;
+
       if (m_compute_progress)
       {
         sequenceNodes();
@@ -466,9 +570,18 @@ namespace Plan
         {
           m_profiles->parse(m_seq_nodes, state);
 
+          // Profiles are fixed from here on, so the execution duration
+          // can be computed once instead of on every progress update.
+          m_exec_duration = computeExecutionDuration();
+
           Timeline tline;
           fillTimeline(tline);
 
+          // Keep the timeline so the schedule can be rebuilt without
+          // re-parsing when the same plan runs again.
+          m_cache_tline = tline;
+          m_cache_has_tline = true;
+
           Memory::clear(m_sched);
           m_sched = new ActionSchedule(m_task, m_spec, m_seq_nodes,
                                        tline, cinfo);
@@ -591,8 +704,20 @@ namespace Plan
           mcs->eta == 0)
         return m_progress;
 
-      TimeProfile::const_iterator itr;
-      itr = m_profiles->find(getCurrentId());
+      // Profile and graph lookups are stable while the same maneuver
+      // is executing, so reuse them between updates.
+      if (m_prof_id != getCurrentId())
+      {
+        m_prof_id = getCurrentId();
+        m_prof_itr = m_profiles->find(m_prof_id);
+        m_prof_man = NULL;
+
+        PlanMap::const_iterator gitr = m_graph.find(m_prof_id);
+        if (gitr != m_graph.end())
+          m_prof_man = gitr->second.pman->data.get();
+      }
+
+      TimeProfile::const_iterator itr = m_prof_itr;
 
       // If not found
       if (itr == m_profiles->end())
@@ -613,7 +738,7 @@ namespace Plan
       if (!itr->second.durations.size())
         return m_progress;
 
-      IMC::Message* man = m_graph.find(getCurrentId())->second.pman->data.get();
+      IMC::Message* man = m_prof_man;
 
       // Get execution progress
       float exec_prog = Progress::compute(man, mcs, itr->second.durations, exec_duration);
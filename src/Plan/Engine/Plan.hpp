@@ -32,6 +32,7 @@
 
 // ISO C++ 98 headers.
 #include <map>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -208,8 +209,17 @@ namespace Plan
       //! Get duration of the execution phase of the plan
       //! (total of maneuver accumulated duration)
       //! @return duration of the execution phase of the plan
+      inline float
+      getExecutionDuration(void) const
+      {
+        return m_exec_duration;
+      }
+
+      //! Compute duration of the execution phase of the plan
+      //! (the result is cached, as it cannot change after parsing)
+      //! @return duration of the execution phase of the plan
       float
-      getExecutionDuration(void) const;
+      computeExecutionDuration(void) const;
 
       //! Get total duration of the plan
       //! @return total duration of the plan
@@ -249,6 +259,15 @@ namespace Plan
       void
       buildGraph(const std::set<uint16_t>* supported_maneuvers);
 
+      //! Check the feasibility of one maneuver, skipping the checks
+      //! when its payload digest was already found feasible in a
+      //! previous parse
+      //! @param[in] supported_maneuvers list of supported maneuvers
+      //! @param[in] pman plan maneuver to check
+      void
+      validateManeuver(const std::set<uint16_t>* supported_maneuvers,
+                       const IMC::PlanManeuver* pman);
+
       //! Perform secondary parsing procedures
       //! That involve action scheduling, statistics, etc
       //! Presumes buildGraph() did not fail
@@ -261,6 +280,19 @@ namespace Plan
                      IMC::PlanStatistics& ps, bool imu_enabled,
                      const IMC::EstimatedState* state);
 
+      //! Compute the digest of the current specification
+      //! @param[out] digest computed digest, c_digest_size bytes long
+      void
+      computeSpecDigest(uint8_t* digest);
+
+      //! Reuse the compiled structures of the previous parse,
+      //! resetting run-time state only
+      //! @param[in] cinfo map of components info
+      //! @param[out] ps reference to PlanStatistics message
+      void
+      reuseCompiled(const std::map<std::string, IMC::EntityInfo>& cinfo,
+                    IMC::PlanStatistics& ps);
+
       //! Sequence plan nodes if possible
       void
       sequenceNodes(void);
@@ -330,6 +362,14 @@ namespace Plan
       bool m_predict_fuel;
       //! Current progress if any
       float m_progress;
+      //! Cached duration of the execution phase
+      float m_exec_duration;
+      //! Maneuver id of the cached progress lookups
+      std::string m_prof_id;
+      //! Cached time profile of the current maneuver
+      Plans::TimeProfile::const_iterator m_prof_itr;
+      //! Cached maneuver message of the current maneuver
+      IMC::Message* m_prof_man;
       //! Estimated required calibration time
       uint16_t m_est_cal_time;
       //! Vector of message pointers to cycle through (sequential) plan
@@ -366,6 +406,24 @@ namespace Plan
       IMC::PlanStatistics m_post_stat;
       //! Pointer to Run Time Statistics
       RunTimeStatistics* m_rt_stat;
+      //! Size of the specification digest
+      static const unsigned c_digest_size = 16;
+      //! Digest of the last successfully compiled specification
+      uint8_t m_cache_md5[c_digest_size];
+      //! True if the compiled structures match m_cache_md5
+      bool m_cache_valid;
+      //! IMU flag the cache was compiled with
+      bool m_cache_imu;
+      //! True if the cached timeline is valid (linear plans)
+      bool m_cache_has_tline;
+      //! Timeline computed when the cache was compiled
+      Timeline m_cache_tline;
+      //! Statistics computed when the cache was compiled
+      IMC::PlanStatistics m_cache_ps;
+      //! Payload digests of maneuvers already found feasible
+      std::set<std::string> m_man_feasible;
+      //! Supported maneuvers the feasibility results were checked against
+      std::set<uint16_t> m_man_feasible_set;
     };
   }
 }
@@ -33,6 +33,7 @@
 // ISO C++ 98 headers.
 #include <map>
 #include <cstring>
+#include <iomanip>
 #include <sstream>
 
 // DUNE headers
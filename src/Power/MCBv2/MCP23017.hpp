@@ -52,8 +52,11 @@ namespace Power
         m_i2c = new DUNE::Hardware::I2C(dev);
         m_i2c->connect(adr);
 
-        m_gpios = getPortValue(0);
-        m_gpios |= getPortValue(1) << 8;
+        // Both ports are sequential registers: read them in one bus
+        // transaction.
+        uint8_t ports[2] = {0, 0};
+        m_i2c->transfer(m_adr, c_mcp23017_r_gpioa, 0, 0, ports, 2, 0);
+        m_gpios = ports[0] | (ports[1] << 8);
       }
 
       ~MCP23017(void)
@@ -71,8 +74,10 @@ namespace Power
       void
       setGPIOs(uint16_t gpios)
       {
-        setPortValue(0, (uint8_t)gpios);
-        setPortValue(1, (uint8_t)(gpios >> 8));
+        // Sequential register write covers both ports in one bus
+        // transaction.
+        uint8_t cmd[] = {c_mcp23017_r_gpioa, (uint8_t)gpios, (uint8_t)(gpios >> 8)};
+        m_i2c->write(cmd, sizeof(cmd));
         m_gpios = gpios;
       }
 
@@ -80,21 +85,6 @@ namespace Power
       DUNE::Hardware::I2C* m_i2c;
       uint8_t m_adr;
       uint16_t m_gpios;
-
-      uint8_t
-      getPortValue(uint8_t port)
-      {
-        uint8_t value = 0;
-        m_i2c->transfer(m_adr, c_mcp23017_r_gpioa + port, 0, 0, &value, 1, 0);
-        return value;
-      }
-
-      void
-      setPortValue(uint8_t port, uint8_t value)
-      {
-        uint8_t cmd[] = {(uint8_t)(c_mcp23017_r_gpioa + port), value};
-        m_i2c->write(cmd, sizeof(cmd));
-      }
     };
   }
 }
@@ -129,6 +129,10 @@ namespace Power
       unsigned pwr_states[c_pwrs_count];
       //! True to drived LCD from MCB.
       bool lcd;
+      //! Telemetry delta threshold, zero dispatches every sample.
+      double tlm_delta;
+      //! Telemetry refresh period.
+      double tlm_refresh;
     };
 
     struct Task: public Tasks::Task
@@ -151,6 +155,12 @@ namespace Power
       bool m_halt;
       //! ADC messages.
       IMC::Message* m_adcs[c_adcs_count];
+      //! Last dispatched ADC values.
+      fp32_t m_adc_last[c_adcs_count];
+      //! True once every ADC channel was dispatched.
+      bool m_adc_valid;
+      //! Telemetry refresh timer.
+      Time::Counter<double> m_tlm_timer;
       //! Power channels by name.
       PowerChannelMap m_pwr_chs;
 
@@ -158,7 +168,8 @@ namespace Power
         Tasks::Task(name, ctx),
         m_pwr_down(false),
         m_gpios(NULL),
-        m_halt(false)
+        m_halt(false),
+        m_adc_valid(false)
       {
         std::memset(m_adcs, 0, sizeof(m_adcs));
 
@@ -180,6 +191,19 @@ namespace Power
         .units(Units::Ampere)
         .description("Charged current");
 
+        param("Telemetry Delta Threshold", m_args.tlm_delta)
+        .defaultValue("0.0")
+        .minimumValue("0.0")
+        .description("Minimum change, in channel units, for an ADC sample"
+                     " to be dispatched; zero dispatches every sample");
+
+        param("Telemetry Refresh Period", m_args.tlm_refresh)
+        .defaultValue("10.0")
+        .minimumValue("1.0")
+        .units(Units::Second)
+        .description("Maximum time between dispatches of an unchanged"
+                     " ADC channel");
+
         for (unsigned i = 0; i < c_adcs_count; ++i)
         {
           std::string option = String::str("ADC Channel %u - Message", i);
@@ -261,6 +285,9 @@ namespace Power
 
           m_pwr_chs[m_args.pwr_names[i]] = pc;
         }
+
+        m_tlm_timer.setTop(m_args.tlm_refresh);
+        m_adc_valid = false;
       }
 
       void
@@ -546,6 +573,11 @@ namespace Power
       void
       sendMessages(const uint16_t* unpack)
       {
+        bool refresh = !m_adc_valid || (m_args.tlm_delta <= 0.0)
+                       || m_tlm_timer.overflow();
+        if (refresh)
+          m_tlm_timer.reset();
+
         // Dispatch ADCs
         for (unsigned i = 0; i < c_adcs_count; ++i)
         {
@@ -553,9 +585,15 @@ namespace Power
             continue;
 
           fp32_t tmp = m_args.adc_factors[i][0] * ((unpack[i] / 1024.0) * m_args.adc_ref) + m_args.adc_factors[i][1];
+          if (!refresh && std::fabs(tmp - m_adc_last[i]) < m_args.tlm_delta)
+            continue;
+
+          m_adc_last[i] = tmp;
           m_adcs[i]->setValueFP(tmp);
           dispatch(m_adcs[i]);
         }
+
+        m_adc_valid = true;
       }
 
       //! Wait for command.
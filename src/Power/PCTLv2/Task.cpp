@@ -137,6 +137,10 @@ namespace Power
       double vol_wup;
       //! LED names.
       std::vector<std::string> leds;
+      //! Telemetry delta threshold, zero dispatches every sample.
+      double tlm_delta;
+      //! Telemetry refresh period.
+      double tlm_refresh;
     };
 
     struct Task: public Tasks::Task
@@ -145,6 +149,18 @@ namespace Power
       Hardware::LUCL::Protocol m_proto;
       //! ADC messages.
       IMC::Message* m_adcs[c_adcs_count];
+      //! Last dispatched ADC values.
+      fp32_t m_adc_last[c_adcs_count];
+      //! True once every ADC channel was dispatched.
+      bool m_adc_valid;
+      //! Last dispatched temperature.
+      fp32_t m_temp_last;
+      //! True once the temperature was dispatched.
+      bool m_temp_valid;
+      //! Telemetry refresh timer.
+      Time::Counter<double> m_tlm_timer;
+      //! Temperature refresh timer.
+      Time::Counter<double> m_temp_timer;
       //! Leak detection.
       IMC::EntityState m_leaks[c_leak_count];
       //! Power channels.
@@ -168,6 +184,8 @@ namespace Power
 
       Task(const std::string& name, Tasks::Context& ctx):
         Tasks::Task(name, ctx),
+        m_adc_valid(false),
+        m_temp_valid(false),
         m_pwr_down(false)
       {
         std::memset(m_adcs, 0, sizeof(m_adcs));
@@ -181,6 +199,19 @@ namespace Power
         .units(Units::Volt)
         .description("ADC Reference Voltage");
 
+        param("Telemetry Delta Threshold", m_args.tlm_delta)
+        .defaultValue("0.0")
+        .minimumValue("0.0")
+        .description("Minimum change, in channel units, for a telemetry"
+                     " sample to be dispatched; zero dispatches every sample");
+
+        param("Telemetry Refresh Period", m_args.tlm_refresh)
+        .defaultValue("10.0")
+        .minimumValue("1.0")
+        .units(Units::Second)
+        .description("Maximum time between dispatches of an unchanged"
+                     " telemetry channel");
+
         param("Channel States - Emergency", m_args.chn_eme_state)
         .size(3)
         .defaultValue("0x01, 0x00, 0x00");
@@ -303,6 +334,11 @@ namespace Power
             channel->state.state = IMC::PowerChannelState::PCS_OFF;
           m_channels.add(i, channel);
         }
+
+        m_tlm_timer.setTop(m_args.tlm_refresh);
+        m_temp_timer.setTop(m_args.tlm_refresh);
+        m_adc_valid = false;
+        m_temp_valid = false;
       }
 
       //! Reserve entities.
@@ -434,12 +470,23 @@ namespace Power
           (uint16_t)(data[6] | (data[7] & 0x3 << 2) << 6)
         };
 
+        bool refresh = !m_adc_valid || (m_args.tlm_delta <= 0.0)
+                       || m_tlm_timer.overflow();
+        if (refresh)
+          m_tlm_timer.reset();
+
         for (unsigned i = 0; i < c_adcs_count; ++i)
         {
           fp32_t tmp = m_args.adc_factors[i][0] * ((unpack[i] / 1024.0) * m_args.adc_ref) + m_args.adc_factors[i][1];
+          if (!refresh && std::fabs(tmp - m_adc_last[i]) < m_args.tlm_delta)
+            continue;
+
+          m_adc_last[i] = tmp;
           m_adcs[i]->setValueFP(tmp);
           dispatch(m_adcs[i]);
         }
+
+        m_adc_valid = true;
       }
 
       //! Process data from leak sensors.
@@ -512,6 +559,14 @@ namespace Power
           int16_t temp = 0;
           std::memcpy(&temp, &temp_code, 2);
           m_temp.value = temp * 0.0625;
+
+          if (m_temp_valid && m_args.tlm_delta > 0.0 && !m_temp_timer.overflow()
+              && std::fabs(m_temp.value - m_temp_last) < m_args.tlm_delta)
+            return;
+
+          m_temp_timer.reset();
+          m_temp_last = m_temp.value;
+          m_temp_valid = true;
           dispatch(m_temp);
         }
 
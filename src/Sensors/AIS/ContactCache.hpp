@@ -0,0 +1,167 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+#ifndef SENSORS_AIS_CONTACT_CACHE_HPP_INCLUDED_
+#define SENSORS_AIS_CONTACT_CACHE_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <list>
+#include <map>
+#include <string>
+
+namespace Sensors
+{
+  namespace AIS
+  {
+    //! Bounded cache of AIS contacts keyed by MMSI.
+    //!
+    //! The cache holds the static data learned for each contact
+    //! (ship type) together with the time of its last published
+    //! position report, so reports can be decimated per contact.
+    //! When the capacity is exceeded the least recently heard
+    //! contact is evicted, bounding memory in dense traffic.
+    class ContactCache
+    {
+    public:
+      //! Constructor.
+      //! @param[in] capacity maximum number of contacts.
+      ContactCache(size_t capacity):
+        m_capacity(capacity)
+      { }
+
+      //! Set the maximum number of contacts, evicting the least
+      //! recently heard ones if over the new capacity.
+      //! @param[in] capacity maximum number of contacts.
+      void
+      setCapacity(size_t capacity)
+      {
+        m_capacity = capacity;
+        evict(m_capacity);
+      }
+
+      //! Record the ship type of a contact.
+      //! @param[in] mmsi contact MMSI.
+      //! @param[in] type human-readable ship type.
+      void
+      setType(int mmsi, const std::string& type)
+      {
+        touch(mmsi).type = type;
+      }
+
+      //! Register a position report and decide if it should be
+      //! published.
+      //! @param[in] mmsi contact MMSI.
+      //! @param[in] now current time.
+      //! @param[in] min_sep minimum separation between published
+      //! reports of one contact, 0 to publish every report.
+      //! @param[out] type ship type of the contact, empty if unknown.
+      //! @return true if the report should be published.
+      bool
+      report(int mmsi, double now, double min_sep, std::string& type)
+      {
+        Contact& contact = touch(mmsi);
+        type = contact.type;
+
+        if (min_sep > 0 && contact.last_report >= 0
+            && (now - contact.last_report) < min_sep)
+          return false;
+
+        contact.last_report = now;
+        return true;
+      }
+
+      //! Retrieve the number of cached contacts.
+      //! @return number of contacts.
+      size_t
+      size(void) const
+      {
+        return m_contacts.size();
+      }
+
+    private:
+      //! Cached contact state.
+      struct Contact
+      {
+        //! Human-readable ship type, empty if unknown.
+        std::string type;
+        //! Time of the last published position report, negative if
+        //! none.
+        double last_report;
+        //! Position in the recency list.
+        std::list<int>::iterator lru;
+      };
+
+      typedef std::map<int, Contact> Map;
+
+      //! Contacts by MMSI.
+      Map m_contacts;
+      //! MMSIs from most to least recently heard.
+      std::list<int> m_lru;
+      //! Maximum number of contacts.
+      size_t m_capacity;
+
+      //! Find or create a contact, marking it most recently heard.
+      //! @param[in] mmsi contact MMSI.
+      //! @return contact state.
+      Contact&
+      touch(int mmsi)
+      {
+        Map::iterator itr = m_contacts.find(mmsi);
+        if (itr != m_contacts.end())
+        {
+          m_lru.splice(m_lru.begin(), m_lru, itr->second.lru);
+          return itr->second;
+        }
+
+        if (m_capacity > 0)
+          evict(m_capacity - 1);
+
+        m_lru.push_front(mmsi);
+        Contact& contact = m_contacts[mmsi];
+        contact.last_report = -1.0;
+        contact.lru = m_lru.begin();
+        return contact;
+      }
+
+      //! Evict least recently heard contacts down to a given size.
+      //! @param[in] size maximum number of contacts to keep.
+      void
+      evict(size_t size)
+      {
+        while (m_contacts.size() > size && !m_lru.empty())
+        {
+          m_contacts.erase(m_lru.back());
+          m_lru.pop_back();
+        }
+      }
+    };
+  }
+}
+
+#endif
@@ -28,10 +28,9 @@
 //***************************************************************************
 
 // ISO C++ 98 headers.
+#include <cctype>
 #include <cstring>
-#include <algorithm>
 #include <cstddef>
-#include <sstream>
 #include <string>
 #include <vector>
 
@@ -43,6 +42,7 @@
 
 // Local headers.
 #include "ShipTypeCode.hpp"
+#include "ContactCache.hpp"
 
 namespace Sensors
 {
@@ -53,12 +53,12 @@ namespace Sensors
 
     //! Read buffer size.
     static const size_t c_read_buffer_size = 82;
-    //! NMEA 5 body index.
-    static const size_t c_nmea5_body_index = 15;
-    //! NMEA 5 trailing chunk in first fragment.
-    static const size_t c_nmea5_trail = 5;
     //! Line termination character.
     static const char c_line_term = '\n';
+    //! Number of fragment reassembly slots.
+    static const size_t c_frag_slots = 4;
+    //! Lifetime of an incomplete reassembly slot (s).
+    static const double c_frag_ttl = 10.0;
 
     //! %Task arguments.
     struct Arguments
@@ -67,6 +67,48 @@ namespace Sensors
       std::string uart_dev;
       //! Serial port baud rate.
       unsigned uart_baud;
+      //! Maximum number of cached contacts.
+      unsigned cache_size;
+      //! Minimum separation between contact updates.
+      double update_period;
+    };
+
+    //! Reassembly slot for one multi-fragment message. Slots are
+    //! reused, so the payload string keeps its capacity and steady
+    //! state reassembly does not allocate.
+    struct FragmentSlot
+    {
+      //! True if the slot holds an incomplete message.
+      bool active;
+      //! Radio channel of the fragments.
+      char channel;
+      //! Sequential message identifier of the fragments.
+      char seq;
+      //! Total number of fragments.
+      unsigned total;
+      //! Next expected fragment number.
+      unsigned next;
+      //! Time of the last accepted fragment.
+      double tstamp;
+      //! Accumulated payload.
+      std::string payload;
+
+      FragmentSlot(void):
+        active(false),
+        channel(0),
+        seq(0),
+        total(0),
+        next(0),
+        tstamp(0)
+      { }
+
+      //! Release the slot, keeping the payload capacity.
+      void
+      clear(void)
+      {
+        active = false;
+        payload.resize(0);
+      }
     };
 
     struct Task: public DUNE::Tasks::Task
@@ -77,16 +119,15 @@ namespace Sensors
       Arguments m_args;
       //! Current line.
       std::string m_line;
-      //! Saved first part of NMEA 5 class message.
-      std::string m_nmea5_fg;
-      //! Waiting fragment.
-      bool m_nmea5_wait_fg;
-      //! Vehicle Type.
-      std::map<int, std::string> m_systems;
+      //! Fragment reassembly table.
+      FragmentSlot m_slots[c_frag_slots];
+      //! Contact cache.
+      ContactCache m_contacts;
 
       Task(const std::string& name, Tasks::Context& ctx):
         DUNE::Tasks::Task(name, ctx),
-        m_handle(NULL)
+        m_handle(NULL),
+        m_contacts(0)
       {
         // Define configuration parameters.
         param("Serial Port - Device", m_args.uart_dev)
@@ -97,7 +138,23 @@ namespace Sensors
         .defaultValue("38400")
         .description("Serial port baud rate");
 
-        m_nmea5_wait_fg = false;
+        param("Contact Cache Size", m_args.cache_size)
+        .defaultValue("512")
+        .description("Maximum number of cached contacts; the least"
+                     " recently heard contact is evicted when full");
+
+        param("Contact Update Period", m_args.update_period)
+        .units(Units::Second)
+        .defaultValue("1.0")
+        .description("Minimum separation between published position"
+                     " reports of one contact, 0 to publish every"
+                     " report");
+      }
+
+      void
+      onUpdateParameters(void)
+      {
+        m_contacts.setCapacity(m_args.cache_size);
       }
 
       void
@@ -140,76 +197,182 @@ namespace Sensors
         Memory::clear(m_handle);
       }
 
-      //! Process AIS NMEA message.
+      //! Split an AIVDM/AIVDO sentence into its fragmentation
+      //! fields and payload.
+      //! @param[in] stn sentence without line termination.
+      //! @param[out] total total number of fragments.
+      //! @param[out] num fragment number.
+      //! @param[out] seq sequential message identifier, 0 if absent.
+      //! @param[out] channel radio channel, 0 if absent.
+      //! @param[out] payload encoded payload.
+      //! @param[out] pad number of padding bits.
+      //! @return true if the sentence is well formed.
+      static bool
+      split(const std::string& stn, unsigned& total, unsigned& num,
+            char& seq, char& channel, std::string& payload, size_t& pad)
+      {
+        if (stn.empty() || stn[0] != '!')
+          return false;
+
+        // Comma offsets of the six field separators.
+        size_t commas[6];
+        unsigned count = 0;
+        for (size_t i = 0; i < stn.size() && count < 6; ++i)
+        {
+          if (stn[i] == ',')
+            commas[count++] = i;
+        }
+
+        if (count < 6)
+          return false;
+
+        total = 0;
+        for (size_t i = commas[0] + 1; i < commas[1]; ++i)
+          total = total * 10 + (stn[i] - '0');
+
+        num = 0;
+        for (size_t i = commas[1] + 1; i < commas[2]; ++i)
+          num = num * 10 + (stn[i] - '0');
+
+        seq = (commas[3] > commas[2] + 1) ? stn[commas[2] + 1] : 0;
+        channel = (commas[4] > commas[3] + 1) ? stn[commas[3] + 1] : 0;
+        payload.assign(stn, commas[4] + 1, commas[5] - commas[4] - 1);
+
+        pad = 0;
+        if (commas[5] + 1 < stn.size() && isdigit(stn[commas[5] + 1]))
+          pad = stn[commas[5] + 1] - '0';
+
+        return (total > 0) && (num >= 1) && (num <= total);
+      }
+
+      //! Decode a reassembled payload and publish contact updates.
+      //! @param[in] payload encoded payload.
+      //! @param[in] pad number of padding bits.
+      //! @param[in] now current time.
       void
-      process(std::string nmea_msg)
+      decode(const std::string& payload, size_t pad, double now)
       {
-        // Remove carriage return.
-        nmea_msg.erase(std::remove(nmea_msg.begin(), nmea_msg.end(), '\r'), nmea_msg.end());
+        if (payload.empty())
+          return;
+
+        switch (payload[0])
+        {
+          // Position Report Class A.
+          case '1':
+          case '2':
+          case '3':
+          {
+            Ais1_2_3 msg(payload.c_str(), pad);
+            if (msg.had_error())
+              return;
+
+            std::string type;
+            if (!m_contacts.report(msg.mmsi, now, m_args.update_period, type))
+              return;
+
+            IMC::RemoteSensorInfo rsi;
+            rsi.id = String::str("%d", msg.mmsi);
+            rsi.sensor_class = type;
+            rsi.lat = Angles::radians(msg.y);
+            rsi.lon = Angles::radians(msg.x);
+            rsi.heading = Angles::radians(msg.cog);
+            dispatch(rsi);
+            break;
+          }
+
+          // Static and Voyage Related Data.
+          case '5':
+          {
+            Ais5 msg(payload.c_str(), pad);
+            if (msg.had_error())
+              return;
+
+            m_contacts.setType(msg.mmsi, ShipTypeCode::translate(msg.type_and_cargo));
+            break;
+          }
+
+          default:
+            break;
+        }
+      }
 
+      //! Process AIS NMEA message.
+      //! @param[in] nmea_msg sentence without line termination.
+      void
+      process(const std::string& nmea_msg)
+      {
         // Log NMEA msg.
         IMC::DevDataText text;
         text.value = nmea_msg;
         dispatch(text);
 
-        // Get body of NMEA message.
-        std::string nmea_payload = GetBody(nmea_msg.c_str());
+        unsigned total = 0;
+        unsigned num = 0;
+        char seq = 0;
+        char channel = 0;
+        std::string payload;
+        size_t pad = 0;
 
-        // Static and Voyage Related Data, first fragment.
-        if (nmea_payload[0] == '5' && !m_nmea5_wait_fg)
-        {
-          nmea_msg.erase(nmea_msg.size() - c_nmea5_trail - 1, c_nmea5_trail);
-          m_nmea5_fg = nmea_msg;
-          m_nmea5_wait_fg = true;
+        if (!split(nmea_msg, total, num, seq, channel, payload, pad))
           return;
-        }
 
-        // Static and Voyage Related Data, second fragment.
-        if (m_nmea5_wait_fg)
-        {
-          nmea_msg.erase(0, c_nmea5_body_index);
-          nmea_msg = m_nmea5_fg.append(nmea_msg);
-          nmea_payload = GetBody(nmea_msg.c_str());
-        }
+        double now = Clock::get();
 
-        // Static and Voyage Related Data, second fragment.
-        if (m_nmea5_wait_fg)
+        if (total == 1)
         {
-          m_nmea5_wait_fg = false;
-          Ais5 msg(nmea_payload.c_str(), GetPad(nmea_msg));
-
-          // Add system MMSI and Type if not existent.
-          std::map<int, std::string>::iterator itr = m_systems.find(msg.mmsi);
-          if (itr != m_systems.end())
-            return;
-
-          m_systems[msg.mmsi] = ShipTypeCode::translate(msg.type_and_cargo);
+          decode(payload, pad, now);
           return;
         }
 
-        // Position Report Class A.
-        if ((nmea_payload[0] == '1') ||
-            (nmea_payload[0] == '2') ||
-            (nmea_payload[0] == '3'))
+        // Multi-fragment message: fragments of one group share the
+        // channel and sequential identifier and arrive in order,
+        // but groups of different channels may interleave. Each
+        // group claims one reassembly slot.
+        FragmentSlot* slot = NULL;
+        for (size_t i = 0; i < c_frag_slots; ++i)
         {
-          Ais1_2_3 msg(nmea_payload.c_str(), GetPad(nmea_msg));
+          FragmentSlot& cand = m_slots[i];
+          if (cand.active && (now - cand.tstamp) > c_frag_ttl)
+            cand.clear();
 
-          // We are able to send a message with ship information.
-          IMC::RemoteSensorInfo rsi;
-          rsi.id = static_cast<std::ostringstream*>(&(std::ostringstream() << msg.mmsi))->str();
+          if (cand.active && cand.channel == channel && cand.seq == seq)
+          {
+            slot = &cand;
+            break;
+          }
 
-          // Find ship type.
-          std::map<int, std::string>::iterator itr = m_systems.find(msg.mmsi);
-          if (itr != m_systems.end())
-            rsi.sensor_class = itr->second;
+          if (!cand.active && slot == NULL)
+            slot = &cand;
+        }
 
-          rsi.lat = Angles::radians(msg.y);
-          rsi.lon = Angles::radians(msg.x);
-          rsi.heading = Angles::radians(msg.cog);
-          dispatch(rsi);
+        if (slot == NULL)
+          return;
 
+        if (num == 1)
+        {
+          slot->active = true;
+          slot->channel = channel;
+          slot->seq = seq;
+          slot->total = total;
+          slot->next = 1;
+          slot->payload.resize(0);
+        }
+        else if (!slot->active || num != slot->next || total != slot->total)
+        {
+          // Lost or repeated fragment: drop the group.
+          slot->clear();
           return;
         }
+
+        slot->tstamp = now;
+        slot->payload += payload;
+        slot->next = num + 1;
+
+        if (num == total)
+        {
+          decode(slot->payload, pad, now);
+          slot->clear();
+        }
       }
 
       void
@@ -237,6 +400,10 @@ namespace Sensors
             // Detected line termination.
             if (bfr[i] == c_line_term)
             {
+              // Remove carriage return.
+              if (!m_line.empty() && m_line[m_line.size() - 1] == '\r')
+                m_line.erase(m_line.size() - 1);
+
               process(m_line);
               setEntityState(IMC::EntityState::ESTA_NORMAL, Status::CODE_ACTIVE);
               m_line.clear();
@@ -0,0 +1,189 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+#ifndef SENSORS_EDGETECH_2205_READER_HPP_INCLUDED_
+#define SENSORS_EDGETECH_2205_READER_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+namespace Sensors
+{
+  namespace Edgetech2205
+  {
+    using DUNE_NAMESPACES;
+
+    //! Data socket reader. Drains the data socket into a pool of
+    //! reusable buffers from a dedicated thread, so that parsing,
+    //! repackaging and log flushes in other threads never stall
+    //! acquisition and the kernel socket buffer does not overflow
+    //! during dual-frequency runs.
+    class Reader: public Concurrency::Thread
+    {
+    public:
+      //! Buffer holding the contents of one socket read.
+      struct Buffer
+      {
+        //! Buffer data.
+        std::vector<uint8_t> data;
+        //! Number of valid bytes.
+        size_t size;
+      };
+
+      Reader(Tasks::Task* parent, TCPSocket* sock, size_t buffer_count = 16):
+        m_parent(parent),
+        m_sock(sock),
+        m_error(false)
+      {
+        for (size_t i = 0; i < buffer_count; ++i)
+        {
+          Buffer* bfr = new Buffer;
+          bfr->data.resize(c_read_size);
+          bfr->size = 0;
+          m_clean.push(bfr);
+        }
+      }
+
+      ~Reader(void)
+      {
+        clearQueue(m_full);
+        clearQueue(m_clean);
+      }
+
+      //! Wait for a filled buffer.
+      //! @param[in] timeout maximum amount of time to wait.
+      //! @return filled buffer or NULL if none became available.
+      Buffer*
+      poll(double timeout)
+      {
+        if (!m_full.waitForItems(timeout))
+          return NULL;
+
+        return m_full.pop();
+      }
+
+      //! Return a consumed buffer to the pool.
+      //! @param[in] bfr buffer object.
+      void
+      recycle(Buffer* bfr)
+      {
+        m_clean.push(bfr);
+      }
+
+      //! Test if the reader thread encountered a read error.
+      //! @return true if an error occurred, false otherwise.
+      bool
+      hasError(void)
+      {
+        Concurrency::ScopedMutex lock(m_error_lock);
+        return m_error;
+      }
+
+      //! Retrieve the last read error.
+      //! @return error message.
+      std::string
+      getError(void)
+      {
+        Concurrency::ScopedMutex lock(m_error_lock);
+        return m_error_msg;
+      }
+
+    private:
+      //! Size of each read buffer.
+      static const size_t c_read_size = 16 * 1024;
+      //! Parent task.
+      Tasks::Task* m_parent;
+      //! Data socket.
+      TCPSocket* m_sock;
+      //! Queue of filled buffers.
+      Concurrency::TSQueue<Buffer*> m_full;
+      //! Queue of available buffers.
+      Concurrency::TSQueue<Buffer*> m_clean;
+      //! True if a read error occurred.
+      bool m_error;
+      //! Last read error.
+      std::string m_error_msg;
+      //! Error lock.
+      Concurrency::Mutex m_error_lock;
+
+      void
+      clearQueue(Concurrency::TSQueue<Buffer*>& queue)
+      {
+        while (!queue.empty())
+        {
+          Buffer* bfr = queue.pop();
+          if (bfr != NULL)
+            delete bfr;
+        }
+      }
+
+      void
+      setError(const std::string& msg)
+      {
+        Concurrency::ScopedMutex lock(m_error_lock);
+        m_error = true;
+        m_error_msg = msg;
+      }
+
+      void
+      run(void)
+      {
+        while (isRunning())
+        {
+          try
+          {
+            if (!Poll::poll(*m_sock, 1.0))
+              continue;
+
+            Buffer* bfr = m_clean.pop();
+            if (bfr == NULL)
+            {
+              bfr = new Buffer;
+              bfr->data.resize(c_read_size);
+            }
+
+            bfr->size = m_sock->read(&bfr->data[0], bfr->data.size());
+            m_full.push(bfr);
+          }
+          catch (std::exception& e)
+          {
+            setError(e.what());
+            return;
+          }
+        }
+      }
+    };
+  }
+}
+
+#endif
@@ -39,6 +39,7 @@
 #include "CommandLink.hpp"
 #include "SubsystemData.hpp"
 #include "Log.hpp"
+#include "Reader.hpp"
 
 namespace Sensors
 {
@@ -118,12 +119,10 @@ namespace Sensors
 
     struct Task: public Tasks::Task
     {
-      //! Buffer size.
-      static const unsigned c_buffer_size = 256 * 1024;
       //! Data socket.
       TCPSocket* m_sock_dat;
-      //! Read buffer.
-      std::vector<uint8_t> m_bfr;
+      //! Data socket reader.
+      Reader* m_reader;
       //! Parser.
       Parser m_parser;
       //! Command link.
@@ -150,6 +149,7 @@ namespace Sensors
       Task(const std::string& name, Tasks::Context& ctx):
         Tasks::Task(name, ctx),
         m_sock_dat(NULL),
+        m_reader(NULL),
         m_cmd(NULL),
         m_log(NULL),
         m_sm_state(SM_IDLE),
@@ -252,8 +252,6 @@ namespace Sensors
         .defaultValue("10")
         .description("Number of valid samples for initial time delta estimation");
 
-        m_bfr.resize(c_buffer_size);
-
         bind<IMC::EstimatedState>(this);
         bind<IMC::LoggingControl>(this);
         bind<IMC::PowerChannelState>(this);
@@ -400,6 +398,13 @@ namespace Sensors
         setPing(SUBSYS_SSH, "None");
         m_cmd->shutdown();
         Memory::clear(m_cmd);
+
+        if (m_reader != NULL)
+        {
+          m_reader->stopAndJoin();
+          Memory::clear(m_reader);
+        }
+
         Memory::clear(m_sock_dat);
         debug("disconnected");
       }
@@ -426,6 +431,9 @@ namespace Sensors
         m_sock_dat->setSendTimeout(5);
         m_sock_dat->connect(m_args.addr, m_args.port_dat);
 
+        m_reader = new Reader(this, m_sock_dat);
+        m_reader->start();
+
         m_cmd->setPingTrigger(SUBSYS_SSH, TRIG_MODE_INTERNAL);
         m_cmd->setPingTrigger(SUBSYS_SSL, TRIG_MODE_INTERNAL);
 
@@ -777,20 +785,30 @@ namespace Sensors
       bool
       readData(void)
       {
-        if (!Poll::poll(*m_sock_dat, 1.0))
+        if (m_reader->hasError())
+          throw std::runtime_error(m_reader->getError());
+
+        Reader::Buffer* bfr = m_reader->poll(1.0);
+        if (bfr == NULL)
+        {
+          consumeMessages();
           return false;
+        }
 
         consumeMessages();
         if (m_sock_dat == NULL || m_packet == NULL)
+        {
+          m_reader->recycle(bfr);
           return false;
+        }
 
-        size_t rv = m_sock_dat->read(&m_bfr[0], m_bfr.size());
-        for (size_t i = 0; i < rv; ++i)
+        for (size_t i = 0; i < bfr->size; ++i)
         {
-          if (m_parser.parse(m_bfr[i], m_packet))
+          if (m_parser.parse(bfr->data[i], m_packet))
             handlePacket();
         }
 
+        m_reader->recycle(bfr);
         return true;
       }
 
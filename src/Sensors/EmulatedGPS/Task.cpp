@@ -62,6 +62,9 @@ namespace Sensors
       bool send_on_pulse;
     };
 
+    //! Sentence buffer size.
+    static const size_t c_stn_size = 128;
+
     struct Task: public DUNE::Tasks::Task
     {
       //! Serial port handle.
@@ -70,13 +73,23 @@ namespace Sensors
       IMC::EstimatedState m_estate;
       //! Time of last estimated state.
       Counter<double> m_estate_timer;
+      //! Reusable sentence writers, with cached sentence type
+      //! prefixes.
+      NMEAWriter m_wtr_rmc;
+      NMEAWriter m_wtr_vtg;
+      NMEAWriter m_wtr_zda;
+      NMEAWriter m_wtr_hdt;
       //! Task parameters.
       Arguments m_args;
 
       Task(const std::string& name, Tasks::Context& ctx):
         Tasks::Task(name, ctx),
         m_uart(NULL),
-        m_estate_timer(0.0)
+        m_estate_timer(0.0),
+        m_wtr_rmc("GPRMC"),
+        m_wtr_vtg("GPVTG"),
+        m_wtr_zda("GPZDA"),
+        m_wtr_hdt("GPHDT")
       {
         param("Serial Port - Device", m_args.uart_dev)
         .defaultValue("")
@@ -145,8 +158,8 @@ namespace Sensors
           sendSentences(msg->getTimeStamp());
       }
 
-      std::string
-      createRMC(const Time::BrokenDown& bdt, unsigned fsec)
+      size_t
+      createRMC(const Time::BrokenDown& bdt, unsigned fsec, char* bfr, size_t size)
       {
         double lat = m_estate.lat;
         double lon = m_estate.lon;
@@ -158,23 +171,31 @@ namespace Sensors
 
         double vel = Math::norm(m_estate.vx, m_estate.vy);
 
-        NMEAWriter stn("GPRMC");
-        stn << String::str("%02u%02u%02u.%02u", bdt.hour, bdt.minutes, bdt.seconds, fsec)
+        char tstamp[16];
+        String::format(tstamp, sizeof(tstamp), "%02u%02u%02u.%02u",
+                       bdt.hour, bdt.minutes, bdt.seconds, fsec);
+        char date[16];
+        String::format(date, sizeof(date), "%02u%02u%02u",
+                       bdt.day, bdt.month, bdt.year - 2000);
+
+        NMEAWriter& stn = m_wtr_rmc;
+        stn.clear();
+        stn << tstamp
             << "A"
             << lat_nmea
             << lon_nmea
             << vel * DUNE::Units::c_ms_to_knot
             << 0 // azimuth.
-            << String::str("%02u%02u%02u", bdt.day, bdt.month, bdt.year - 2000)
+            << date
             << ""
             << ""
             << "A";
 
-        return stn.sentence();
+        return stn.sentence(bfr, size);
       }
 
-      std::string
-      createVTG(void)
+      size_t
+      createVTG(char* bfr, size_t size)
       {
         double vel = Math::norm(m_estate.vx, m_estate.vy);
         double course = Angles::degrees(std::atan2(m_estate.vy, m_estate.vx));
@@ -186,44 +207,59 @@ namespace Sensors
         //        034.4,M      Magnetic course made good over ground, degrees
         //        005.5,N      Ground speed, N=Knots
         //        010.2,K      Ground speed, K=Kilometers per hour
-        NMEAWriter stn("GPVTG");
-        stn << String::str("%03.1f,T,%03.1f,M,%03.1f,N,%03.1f,K",
-                           course,
-                           course,
-                           vel * DUNE::Units::c_ms_to_knot,
-                           vel * DUNE::Units::c_ms_to_kmh);
-        return stn.sentence();
+        char fields[64];
+        String::format(fields, sizeof(fields), "%03.1f,T,%03.1f,M,%03.1f,N,%03.1f,K",
+                       course,
+                       course,
+                       vel * DUNE::Units::c_ms_to_knot,
+                       vel * DUNE::Units::c_ms_to_kmh);
+
+        NMEAWriter& stn = m_wtr_vtg;
+        stn.clear();
+        stn << fields;
+        return stn.sentence(bfr, size);
       }
 
-      std::string
-      createZDA(const Time::BrokenDown& bdt, unsigned fsec)
+      size_t
+      createZDA(const Time::BrokenDown& bdt, unsigned fsec, char* bfr, size_t size)
       {
-        NMEAWriter stn("GPZDA");
-        stn << String::str("%02u%02u%02u.%02u", bdt.hour, bdt.minutes, bdt.seconds, fsec)
-            << String::str("%02u", bdt.day)
-            << String::str("%02u", bdt.month)
-            << String::str("%04u", bdt.year)
+        char tstamp[16];
+        String::format(tstamp, sizeof(tstamp), "%02u%02u%02u.%02u",
+                       bdt.hour, bdt.minutes, bdt.seconds, fsec);
+        char date[16];
+        String::format(date, sizeof(date), "%02u,%02u,%04u",
+                       bdt.day, bdt.month, bdt.year);
+
+        NMEAWriter& stn = m_wtr_zda;
+        stn.clear();
+        stn << tstamp
+            << date
             << "00"
             << "00";
 
-        return stn.sentence();
+        return stn.sentence(bfr, size);
       }
 
-      std::string
-      createHDT(void)
+      size_t
+      createHDT(char* bfr, size_t size)
       {
-        NMEAWriter stn("GPHDT");
-        stn << String::str("%0.2f", Angles::degrees(m_estate.psi))
+        char heading[16];
+        String::format(heading, sizeof(heading), "%0.2f",
+                       Angles::degrees(m_estate.psi));
+
+        NMEAWriter& stn = m_wtr_hdt;
+        stn.clear();
+        stn << heading
             << "T";
 
-        return stn.sentence();
+        return stn.sentence(bfr, size);
       }
 
       void
-      writeToUART(const std::string& str)
+      writeToUART(const char* bfr, size_t size)
       {
-        trace("%s", sanitize(str).c_str());
-        m_uart->write(str.c_str(), str.size());
+        trace("%s", sanitize(std::string(bfr, size)).c_str());
+        m_uart->write(bfr, size);
       }
 
       void
@@ -240,31 +276,19 @@ namespace Sensors
         double fraction = time_reference - secs;
         unsigned fsec = fraction * 100;
         Time::BrokenDown bdt(secs);
-        std::string stn_str;
+        char bfr[c_stn_size];
 
         if (m_args.send_zda)
-        {
-          stn_str = createZDA(bdt, fsec);
-          writeToUART(stn_str);
-        }
+          writeToUART(bfr, createZDA(bdt, fsec, bfr, sizeof(bfr)));
 
         if (m_args.send_rmc && !m_estate_timer.overflow())
-        {
-          stn_str = createRMC(bdt, fsec);
-          writeToUART(stn_str);
-        }
+          writeToUART(bfr, createRMC(bdt, fsec, bfr, sizeof(bfr)));
 
         if (m_args.send_hdt && !m_estate_timer.overflow())
-        {
-          stn_str = createHDT();
-          writeToUART(stn_str);
-        }
+          writeToUART(bfr, createHDT(bfr, sizeof(bfr)));
 
         if (m_args.send_vtg && !m_estate_timer.overflow())
-        {
-          stn_str = createVTG();
-          writeToUART(stn_str);
-        }
+          writeToUART(bfr, createVTG(bfr, sizeof(bfr)));
       }
 
       void
@@ -257,7 +257,7 @@ namespace Sensors
         if (getEntityState() == IMC::EntityState::ESTA_BOOT)
           m_init_line = msg->value;
         else
-          processSentence(msg->value);
+          processSentence(msg->value, msg->getTimeStamp());
       }
 
       void
@@ -396,8 +396,9 @@ namespace Sensors
 
       //! Process sentence.
       //! @param[in] line line.
+      //! @param[in] tstamp time at which the line was read.
       void
-      processSentence(const std::string& line)
+      processSentence(const std::string& line, double tstamp)
       {
         // Discard leading noise.
         size_t sidx = 0;
@@ -418,6 +419,17 @@ namespace Sensors
         if (sidx >= eidx)
           return;
 
+        // Reject sentences of unconfigured classes before computing
+        // the checksum and splitting fields: bulk output such as GSV
+        // satellite details then costs no more than this scan.
+        size_t cidx = line.find(',', sidx + 1);
+        if (cidx == std::string::npos || cidx > eidx)
+          return;
+
+        std::string code = line.substr(sidx + 1, cidx - sidx - 1);
+        if (std::find(m_args.stn_order.begin(), m_args.stn_order.end(), code) == m_args.stn_order.end())
+          return;
+
         // Compute checksum.
         uint8_t ccsum = 0;
         for (size_t i = sidx + 1; i < eidx; ++i)
@@ -432,19 +444,23 @@ namespace Sensors
         std::vector<std::string> parts;
         String::split(line.substr(sidx + 1, eidx - sidx - 1), ",", parts);
 
-        if (std::find(m_args.stn_order.begin(), m_args.stn_order.end(), parts[0]) != m_args.stn_order.end())
-          interpretSentence(parts);
+        interpretSentence(parts, tstamp);
       }
 
       //! Interpret given sentence.
       //! @param[in] parts vector of strings from sentence.
+      //! @param[in] tstamp time at which the sentence was read.
       void
-      interpretSentence(std::vector<std::string>& parts)
+      interpretSentence(std::vector<std::string>& parts, double tstamp)
       {
         if (parts[0] == m_args.stn_order.front())
         {
+          // Stamp with the read time of the sentence, not the time
+          // it was consumed: UTC time pairs with the instant the
+          // sentence arrived even if parsing queued behind other
+          // input.
           clearMessages();
-          m_fix.setTimeStamp();
+          m_fix.setTimeStamp(tstamp);
           m_euler.setTimeStamp(m_fix.getTimeStamp());
           m_agvel.setTimeStamp(m_fix.getTimeStamp());
         }
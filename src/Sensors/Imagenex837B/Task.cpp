@@ -198,7 +198,13 @@ namespace Sensors
       Frame837* m_frame837;
       //! 83P Frame.
       Frame83P* m_frame83P;
-      //! Sonar Return Data.
+      //! Sonar Return Data ping buffers (double-buffered arena).
+      IMC::SonarData* m_data_bfr[2];
+      //! Shared envelopes holding the ping buffers.
+      IMC::SharedMessage* m_data_env[2];
+      //! Index of the ping buffer being filled.
+      unsigned m_data_idx;
+      //! Sonar Return Data (ping buffer being filled).
       IMC::SonarData* m_data;
       //! External Control frame.
       ExternalControl* m_ec;
@@ -232,9 +238,13 @@ namespace Sensors
         m_udp(NULL),
         m_frame837(NULL),
         m_frame83P(NULL),
+        m_data_idx(0),
         m_data(NULL),
         m_ec(NULL)
       {
+        m_data_bfr[0] = m_data_bfr[1] = NULL;
+        m_data_env[0] = m_data_env[1] = NULL;
+
         // Define configuration parameters.
         paramActive(Tasks::Parameter::SCOPE_MANEUVER,
                     Tasks::Parameter::VISIBILITY_USER);
@@ -415,7 +425,7 @@ namespace Sensors
 
           m_frame837->setProfileTiltAngle(m_args.tilt_angle);
 
-          Memory::clear(m_data);
+          clearSonarData();
           Memory::clear(m_frame83P);
           Memory::clear(m_ec);
         }
@@ -432,7 +442,7 @@ namespace Sensors
 
           m_frame83P->setProfileTiltAngle(m_args.tilt_angle);
 
-          Memory::clear(m_data);
+          clearSonarData();
           Memory::clear(m_frame837);
         }
 
@@ -494,26 +504,78 @@ namespace Sensors
           m_wdog.setTop(m_args.timeout_error);
       }
 
-      //! Initialize IMC sonar data holder.
+      //! Initialize IMC sonar data holders. Both ping buffers of the
+      //! arena are preallocated so that filling and consumption can
+      //! overlap without copying or allocating per ping.
       void
       initializeSonarData(unsigned data_size)
       {
-        if (m_data == NULL)
-          m_data = new IMC::SonarData();
-
         IMC::BeamConfig bc;
         bc.beam_width = Math::Angles::radians(c_beam_width);
         bc.beam_height = Math::Angles::radians(c_beam_height);
-        m_data->beam_config.clear();
-        m_data->beam_config.push_back(bc);
-
-        // Initialize return data.
-        m_data->type = IMC::SonarData::ST_MULTIBEAM;
-        m_data->bits_per_point = 8;
-        m_data->scale_factor = 1.0f;
-        m_data->min_range = 0;
-        m_data->frequency = c_freq;
-        m_data->data.resize(data_size);
+
+        for (unsigned i = 0; i < 2; ++i)
+        {
+          if (m_data_bfr[i] == NULL)
+          {
+            m_data_bfr[i] = new IMC::SonarData();
+            m_data_env[i] = IMC::SharedMessage::wrap(m_data_bfr[i]);
+          }
+
+          m_data_bfr[i]->beam_config.clear();
+          m_data_bfr[i]->beam_config.push_back(bc);
+
+          // Initialize return data.
+          m_data_bfr[i]->type = IMC::SonarData::ST_MULTIBEAM;
+          m_data_bfr[i]->bits_per_point = 8;
+          m_data_bfr[i]->scale_factor = 1.0f;
+          m_data_bfr[i]->min_range = 0;
+          m_data_bfr[i]->frequency = c_freq;
+          m_data_bfr[i]->data.resize(data_size);
+        }
+
+        m_data = m_data_bfr[m_data_idx];
+      }
+
+      //! Release the ping buffer arena.
+      void
+      clearSonarData(void)
+      {
+        for (unsigned i = 0; i < 2; ++i)
+        {
+          if (m_data_env[i] != NULL)
+          {
+            m_data_env[i]->release();
+            m_data_env[i] = NULL;
+            m_data_bfr[i] = NULL;
+          }
+        }
+
+        m_data = NULL;
+      }
+
+      //! Dispatch the filled ping buffer without copying it and flip
+      //! to the other buffer of the arena.
+      void
+      dispatchSonarData(void)
+      {
+        IMC::SonarData* sent = m_data;
+        dispatch(m_data_env[m_data_idx]);
+
+        m_data_idx = 1 - m_data_idx;
+
+        // A slow consumer may still hold a reference to the other
+        // buffer; replace it instead of overwriting it in place.
+        if (!m_data_env[m_data_idx]->isUnique())
+        {
+          m_data_env[m_data_idx]->release();
+          m_data_bfr[m_data_idx] = static_cast<IMC::SonarData*>(sent->clone());
+          m_data_env[m_data_idx] = IMC::SharedMessage::wrap(m_data_bfr[m_data_idx]);
+        }
+
+        m_data = m_data_bfr[m_data_idx];
+        m_data->max_range = sent->max_range;
+        m_data->data.resize(sent->data.size());
       }
 
       void
@@ -529,7 +591,7 @@ namespace Sensors
       {
         Memory::clear(m_frame837);
         Memory::clear(m_frame83P);
-        Memory::clear(m_data);
+        clearSonarData();
         Memory::clear(m_ec);
         requestDeactivation();
       }
@@ -676,14 +738,20 @@ namespace Sensors
         if (msg->value < 0)
           return;
 
+        // Use the shared depth-binned profile instead of the raw
+        // sample, so georeferencing and ranging agree on the value.
+        IMC::EstimatedState state;
+        double depth = m_ctx.sstate.read(state) ? state.depth : 0.0;
+        double svel = m_ctx.svp.get(depth);
+
         if (m_frame837 != NULL)
-          m_frame837->setSoundVelocity(msg->value);
+          m_frame837->setSoundVelocity(svel);
 
         if (m_frame83P != NULL)
-          m_frame83P->setSoundVelocity(msg->value);
+          m_frame83P->setSoundVelocity(svel);
 
         if (m_ec != NULL)
-          m_ec->setSoundVelocity(msg->value);
+          m_ec->setSoundVelocity(svel);
       }
 
       //! Get index from table according with given value.
@@ -837,8 +905,8 @@ namespace Sensors
           rv = m_tcp->read((char*)(m_frame837->getMessageData() + dat_idx), c_rdata_dat_size);
           if (m_data != NULL)
           {
-            std::memcpy((char*)(m_frame837->getMessageData() + dat_idx),
-                        &m_data->data[dat_idx], c_rdata_dat_size);
+            std::memcpy(&m_data->data[dat_idx],
+                        m_frame837->getMessageData() + dat_idx, c_rdata_dat_size);
           }
         }
         else if (m_data != NULL)
@@ -913,8 +981,8 @@ namespace Sensors
         if (m_data != NULL)
         {
           m_data->data.resize(m_frame83P->getMessageSize());
-          std::memcpy((char*)(m_frame83P->getMessageData()),
-                      &m_data->data[0], m_frame83P->getMessageSize());
+          std::memcpy(&m_data->data[0], m_frame83P->getMessageData(),
+                      m_frame83P->getMessageSize());
         }
 
         return true;
@@ -1029,7 +1097,7 @@ namespace Sensors
           writeToFile();
 
         if (m_data != NULL)
-          dispatch(m_data);
+          dispatchSonarData();
 
         m_wdog.reset();
       }
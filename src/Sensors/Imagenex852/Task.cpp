@@ -86,6 +86,8 @@ namespace Sensors
       unsigned profile_range;
       //! Data points.
       unsigned data_points;
+      //! Profile decimation factor.
+      unsigned decimation;
       //! Sound speed on water.
       double sspeed;
       //! Use dynamic sound speed.
@@ -212,6 +214,12 @@ namespace Sensors
         .values("0, 252, 500")
         .description("Number of sonar return data points");
 
+        param("Decimation Factor", m_args.decimation)
+        .defaultValue("1")
+        .minimumValue("1")
+        .description("Decimate the profile by this factor before dispatching,"
+                     " keeping the strongest echo of each group of samples");
+
         param("Sound Speed on Water", m_args.sspeed)
         .defaultValue("1500")
         .minimumValue("1375")
@@ -399,7 +407,11 @@ namespace Sensors
         if (msg->value < 0.0)
           return;
 
-        m_sound_speed = msg->value;
+        // Use the shared depth-binned profile instead of the raw
+        // sample, so all acoustic consumers agree on the value.
+        IMC::EstimatedState state;
+        double depth = m_ctx.sstate.read(state) ? state.depth : 0.0;
+        m_sound_speed = m_ctx.svp.get(depth);
       }
 
       void
@@ -500,6 +512,13 @@ namespace Sensors
               m_profile.setTimeStamp(m_dist.getTimeStamp());
               m_profile.min_range = static_cast<uint16_t>(m_switch.getProfileMinRange());
               m_profile.max_range = m_parser.getRange();
+
+              // Decimate after filtering so range detection runs at
+              // full resolution. The parser resizes the buffer on the
+              // next ping.
+              if (m_args.decimation > 1)
+                decimate(m_profile.data, m_args.decimation);
+
               dispatch(m_profile);
             }
 
@@ -555,6 +574,32 @@ namespace Sensors
         if (!detected)
           dist.value = m_switch.getRange();
       }
+
+      //! Decimate profile data in place, keeping the strongest echo
+      //! of each group of samples so small targets are not averaged
+      //! away.
+      //! @param[in,out] data profile data.
+      //! @param[in] factor decimation factor.
+      void
+      decimate(std::vector<char>& data, unsigned factor)
+      {
+        unsigned count = data.size() / factor;
+        if (count == 0)
+          return;
+
+        for (unsigned i = 0; i < count; ++i)
+        {
+          char peak = data[i * factor];
+          for (unsigned j = 1; j < factor; ++j)
+          {
+            if (data[i * factor + j] > peak)
+              peak = data[i * factor + j];
+          }
+          data[i] = peak;
+        }
+
+        data.resize(count);
+      }
     };
   }
 }
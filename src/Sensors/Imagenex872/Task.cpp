@@ -74,6 +74,8 @@ namespace Sensors
       unsigned frequency;
       // Default range.
       unsigned range;
+      // Ping decimation factor.
+      unsigned decimation;
     };
 
     // List of available ranges.
@@ -163,6 +165,12 @@ namespace Sensors
         .valuesIf("Frequency", "770", "10, 20, 30, 40, 50")
         .description(DTR("Operating range"));
 
+        param("Decimation Factor", m_args.decimation)
+        .defaultValue("1")
+        .minimumValue("1")
+        .description("Decimate each channel by this factor before dispatching,"
+                     " keeping the strongest echo of each group of samples");
+
         // Initialize switch data.
         std::memset(m_sdata, 0, sizeof(m_sdata));
         m_sdata[0] = 0xfe;
@@ -318,6 +326,42 @@ namespace Sensors
         setEntityState(IMC::EntityState::ESTA_NORMAL, Status::CODE_ACTIVE);
       }
 
+      //! Dispatch a decimated copy of the ping, keeping the strongest
+      //! echo of each group of samples per channel. The raw buffer is
+      //! left untouched since ping() writes at fixed indices.
+      //! @param[in] factor decimation factor.
+      void
+      dispatchDecimated(unsigned factor)
+      {
+        unsigned count = c_rdata_dat_size / factor;
+        if (count == 0)
+        {
+          dispatch(m_ping, DF_BULK);
+          return;
+        }
+
+        IMC::SonarData dec(m_ping);
+        for (unsigned side = 0; side < 2; ++side)
+        {
+          unsigned src = side * c_rdata_dat_size;
+          unsigned dst = side * count;
+
+          for (unsigned i = 0; i < count; ++i)
+          {
+            char peak = m_ping.data[src + i * factor];
+            for (unsigned j = 1; j < factor; ++j)
+            {
+              if (m_ping.data[src + i * factor + j] > peak)
+                peak = m_ping.data[src + i * factor + j];
+            }
+            dec.data[dst + i] = peak;
+          }
+        }
+
+        dec.data.resize(count * 2);
+        dispatch(dec, DF_BULK);
+      }
+
       void
       task(void)
       {
@@ -327,7 +371,13 @@ namespace Sensors
         try
         {
           pingBoth();
-          dispatch(m_ping);
+
+          // Pings are declared bulk data: when the logger accepts
+          // them directly they skip the bus entirely.
+          if (m_args.decimation > 1)
+            dispatchDecimated(m_args.decimation);
+          else
+            dispatch(m_ping, DF_BULK);
         }
         catch (std::exception& e)
         {
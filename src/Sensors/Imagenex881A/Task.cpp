@@ -129,6 +129,10 @@ namespace Sensors
       bool use_default;
       // Power channel name.
       std::string power_channel;
+      //! Composite output period.
+      double comp_period;
+      //! Composite grid size.
+      unsigned comp_size;
     };
 
     //! Device query baud rate.
@@ -163,6 +167,10 @@ namespace Sensors
     static const float c_absorption_above = 0.2;
     //! Range threshold for default configuration.
     static const uint8_t c_range_threshold = 5;
+    //! Head position resolution in degrees.
+    static const float c_head_res = 0.3f;
+    //! Number of distinct head positions (±180° at 0.3° steps).
+    static const int c_head_steps = 1201;
 
     struct Task: public DUNE::Tasks::Task
     {
@@ -186,6 +194,16 @@ namespace Sensors
       Counter<double> m_countdown;
       //! Watchdog.
       Counter<double> m_wdog;
+      //! Cartesian composite message.
+      IMC::SonarData m_composite;
+      //! Cartesian composite grid, row-major.
+      std::vector<uint8_t> m_grid;
+      //! Sine of each head position.
+      float m_lut_sin[c_head_steps];
+      //! Cosine of each head position.
+      float m_lut_cos[c_head_steps];
+      //! Composite output timer.
+      Counter<double> m_comp_timer;
       //! Task arguments.
       Arguments m_args;
 
@@ -322,12 +340,39 @@ namespace Sensors
         .defaultValue("Pencil Beam")
         .description("Power channel that controls the power of the device");
 
+        param("Composite - Output Period", m_args.comp_period)
+        .defaultValue("0.0")
+        .units(Units::Second)
+        .description("Period between cartesian composite outputs, zero"
+                     " disables sector stitching");
+
+        param("Composite - Grid Size", m_args.comp_size)
+        .defaultValue("100")
+        .minimumValue("10")
+        .maximumValue("250")
+        .description("Cells per side of the cartesian composite grid");
+
         m_distance.validity = IMC::Distance::DV_VALID;
 
         // Filling constant Sonar Data.
         m_sonar.type = IMC::SonarData::ST_ECHOSOUNDER;
         m_sonar.scale_factor = 1.0f;
 
+        // Filling constant composite data.
+        m_composite.type = IMC::SonarData::ST_MULTIBEAM;
+        m_composite.bits_per_point = 8;
+        m_composite.min_range = 0;
+
+        // The head reports positions on a fixed 0.3° lattice, so the
+        // polar to cartesian rotation reduces to one table lookup per
+        // ping.
+        for (int i = 0; i < c_head_steps; ++i)
+        {
+          float angle = Math::Angles::radians(c_head_res * (i - 600));
+          m_lut_sin[i] = std::sin(angle);
+          m_lut_cos[i] = std::cos(angle);
+        }
+
         // Initialize switch data.
         std::memset(m_sdata, 0, sizeof(m_sdata));
         m_sdata[SD_HDR_1] = 0xfe;
@@ -359,6 +404,7 @@ namespace Sensors
         setStepSize();
         setSectorWidth();
         setTrainAngle();
+        setupComposite();
 
         if (m_args.use_default)
         {
@@ -617,6 +663,76 @@ namespace Sensors
         m_sdata[SD_TRAIN_ANGLE] = (uint8_t)((m_args.train_angle + 180) / 3);
       }
 
+      //! Resize and clear the cartesian composite grid.
+      void
+      setupComposite(void)
+      {
+        m_comp_timer.setTop(m_args.comp_period);
+
+        if (m_args.comp_period <= 0.0)
+        {
+          m_grid.clear();
+          return;
+        }
+
+        m_grid.assign((size_t)m_args.comp_size * m_args.comp_size, 0);
+
+        // Cell size in meters, grid spans ±range on both axes.
+        m_composite.scale_factor = (2.0f * m_args.range) / m_args.comp_size;
+        m_composite.max_range = m_args.range;
+      }
+
+      //! Fold the last ping into the cartesian composite. The head
+      //! position selects the ray direction from the lookup table and
+      //! grid coordinates then advance by a fixed increment per
+      //! sample, so no trigonometry runs in the sample loop.
+      //! @param[in] heading beam orientation.
+      void
+      stitchPing(float heading)
+      {
+        size_t count = m_sonar.data.size();
+        if (count == 0)
+          return;
+
+        int idx = 600 + (int)Math::round(Math::Angles::degrees(Math::Angles::normalizeRadian(heading)) / c_head_res);
+        if (idx < 0 || idx >= c_head_steps)
+          return;
+
+        float step = m_parser.getRange() / (count * m_composite.scale_factor);
+        float dn = step * m_lut_cos[idx];
+        float de = step * m_lut_sin[idx];
+        float n = m_args.comp_size / 2.0f;
+        float e = n;
+
+        for (size_t i = 0; i < count; ++i)
+        {
+          n += dn;
+          e += de;
+
+          int row = (int)n;
+          int col = (int)e;
+
+          // Samples march outwards, once the ray leaves the grid it
+          // does not come back.
+          if (row < 0 || row >= (int)m_args.comp_size || col < 0 || col >= (int)m_args.comp_size)
+            break;
+
+          m_grid[row * m_args.comp_size + col] = (uint8_t)m_sonar.data[i];
+        }
+      }
+
+      //! Dispatch the cartesian composite and age its cells so areas
+      //! the beam no longer sweeps fade out between outputs.
+      void
+      publishComposite(void)
+      {
+        m_composite.data.assign(m_grid.begin(), m_grid.end());
+        dispatch(m_composite);
+
+        for (size_t i = 0; i < m_grid.size(); ++i)
+          m_grid[i] -= m_grid[i] >> 2;
+      }
+
       //! Test communication with device.
       void
       testComms(void)
@@ -680,6 +796,17 @@ namespace Sensors
                 m_sonar.min_range = static_cast<uint16_t>(m_distance.value);
                 m_sonar.max_range = m_parser.getRange();
                 dispatch(m_sonar);
+
+                if (!m_grid.empty())
+                {
+                  stitchPing(m_device_state.psi);
+
+                  if (m_comp_timer.overflow())
+                  {
+                    m_comp_timer.reset();
+                    publishComposite();
+                  }
+                }
               }
 
               // Extract and dispatch data.
@@ -464,6 +464,12 @@ namespace Sensors
         {
           std::vector<unsigned> freqs;
           ctx.config.get("Narrow Band Transponders", txponders[i], "", freqs);
+          if (freqs.size() < 2)
+          {
+            war(DTR("invalid entry '%s' in narrow band transponders"), txponders[i].c_str());
+            continue;
+          }
+
           m_nbmap.insert(std::make_pair(txponders[i], Transponder(freqs[0], freqs[1])));
         }
 
@@ -124,12 +124,20 @@ namespace Sensors
       std::string addr_section;
       //! Navigation turn around time.
       unsigned turn_around_time;
+      //! Adaptive ping timeout safety factor.
+      double tout_factor;
     };
 
+    //! Minimum adaptive ping timeout (s).
+    static const double c_min_adaptive_tout = 2.0;
+    //! Number of reply time samples averaged per beacon.
+    static const unsigned c_reply_time_samples = 5;
+
     // Type definition for mapping addresses.
     typedef std::map<unsigned, unsigned> AddressMap;
     typedef std::map<std::string, Transponder> NarrowBandMap;
     typedef std::map<std::string, unsigned> MicroModemMap;
+    typedef std::map<std::string, MovingAverage<double> > ReplyTimeMap;
 
     struct Task: public DUNE::Tasks::Task
     {
@@ -169,6 +177,10 @@ namespace Sensors
       std::string m_line;
       // System position
       IMC::EstimatedState *m_estate;
+      // Reply time history of each beacon.
+      ReplyTimeMap m_reply_times;
+      // Time the current operation started.
+      double m_op_start;
 
       Task(const std::string& name, Tasks::Context& ctx):
         DUNE::Tasks::Task(name, ctx),
@@ -177,7 +189,8 @@ namespace Sensors
         m_pc(NULL),
         m_op(OP_NONE),
         m_gpio_txd(NULL),
-        m_estate(NULL)
+        m_estate(NULL),
+        m_op_start(-1.0)
       {
         // Define configuration parameters.
         param("Serial Port - Device", m_args.uart_dev)
@@ -230,6 +243,13 @@ namespace Sensors
         .defaultValue("20.0")
         .minimumValue("0");
 
+        param("Timeout - Adaptive Factor", m_args.tout_factor)
+        .defaultValue("0.0")
+        .minimumValue("0")
+        .description("Scale the reply time history of each beacon to obtain"
+                     " its ping timeout, shortening the dead time of missed"
+                     " replies. Zero uses the configured timeouts only");
+
         param("GPIO - Transducer Detection", m_args.gpio_txd)
         .defaultValue("-1");
 
@@ -373,6 +393,7 @@ namespace Sensors
       {
         m_op = OP_NONE;
         m_op_deadline = -1.0;
+        m_op_start = -1.0;
       }
 
       bool
@@ -571,6 +592,44 @@ namespace Sensors
         m_op_deadline = Clock::get() + m_args.tout_abort;
       }
 
+      //! Compute the ping timeout of a beacon: the scaled average of
+      //! its recent reply times, bounded below by a sane minimum and
+      //! above by the configured timeout.
+      //! @param[in] sys system to be ranged.
+      //! @param[in] dflt configured timeout.
+      //! @return timeout in seconds.
+      double
+      adaptiveTimeout(const std::string& sys, double dflt)
+      {
+        if (m_args.tout_factor <= 0.0)
+          return dflt;
+
+        ReplyTimeMap::iterator itr = m_reply_times.find(sys);
+        if (itr == m_reply_times.end())
+          return dflt;
+
+        double tout = itr->second.mean() * m_args.tout_factor;
+        return trimValue(tout, c_min_adaptive_tout, dflt);
+      }
+
+      //! Record the reply time of the beacon answering the current
+      //! operation.
+      void
+      recordReplyTime(void)
+      {
+        if (m_op_start < 0.0)
+          return;
+
+        double elapsed = Clock::get() - m_op_start;
+        m_op_start = -1.0;
+
+        ReplyTimeMap::iterator itr = m_reply_times.find(m_acop.system);
+        if (itr == m_reply_times.end())
+          itr = m_reply_times.insert(std::make_pair(m_acop.system, MovingAverage<double>(c_reply_time_samples))).first;
+
+        itr->second.update(elapsed);
+      }
+
       //! Range system.
       //! @param[in] sys system to be ranged.
       void
@@ -612,7 +671,8 @@ namespace Sensors
         std::string cmd = String::str("$CCMPC,%u,%u\r\n", m_address, itr->second);
         sendCommand(cmd);
         m_op = OP_PING_MM;
-        m_op_deadline = Clock::get() + m_args.tout_mmping;
+        m_op_start = Clock::get();
+        m_op_deadline = m_op_start + adaptiveTimeout(sys, m_args.tout_mmping);
       }
 
       //! Ping a narrow band frequency.
@@ -628,12 +688,17 @@ namespace Sensors
         unsigned query = itr->second.query_freq;
         unsigned reply = itr->second.reply_freq;
 
+        // The modem stops listening at the adaptive timeout as well,
+        // so a missed reply frees the channel earlier.
+        double tout = adaptiveTimeout(sys, m_args.tout_nbping);
+
         std::string cmd = String::str("$CCPNT,%u,%u,%u,%u,%u,0,0,0,1\r\n", query,
                                       m_args.tx_length, m_args.rx_length,
-                                      m_args.tout_nbping * 1000, reply);
+                                      (unsigned)(tout * 1000), reply);
         sendCommand(cmd);
         m_op = OP_PING_NB;
-        m_op_deadline = Clock::get() + m_args.tout_nbping;
+        m_op_start = Clock::get();
+        m_op_deadline = m_op_start + tout;
       }
 
       //! Handle received range from modem.
@@ -659,6 +724,8 @@ namespace Sensors
         if (ttime < 0)
           ttime = 0;
 
+        recordReplyTime();
+
         m_acop_out.op = IMC::AcousticOperation::AOP_RANGE_RECVED;
         m_acop_out.system = m_acop.system;
         m_acop_out.range = ttime * m_args.sspeed;
@@ -686,6 +753,8 @@ namespace Sensors
         if (ttime < 0)
           ttime = 0;
 
+        recordReplyTime();
+
         m_acop_out.op = IMC::AcousticOperation::AOP_RANGE_RECVED;
         m_acop_out.system = m_acop.system;
         m_acop_out.range = ttime * m_args.sspeed;
@@ -98,6 +98,8 @@ namespace Sensors
       IMC::AngularVelocity m_agvel;
       // Temperature message.
       IMC::Temperature m_temp;
+      // Reusable dispatch envelopes, one per output message.
+      IMC::SharedMessage* m_envs[4];
       // Task parameters.
       Arguments m_args;
 
@@ -116,11 +118,20 @@ namespace Sensors
 
         m_bfr = new uint8_t[c_max_bfr_len];
 
+        for (unsigned i = 0; i < 4; ++i)
+          m_envs[i] = NULL;
+
         bind<IMC::Pulse>(this);
       }
 
       ~Task(void)
       {
+        for (unsigned i = 0; i < 4; ++i)
+        {
+          if (m_envs[i] != NULL)
+            m_envs[i]->release();
+        }
+
         delete [] m_bfr;
       }
 
@@ -191,10 +202,10 @@ namespace Sensors
               m_euler.psi = Angles::radians(tmp);
               m_euler.psi_magnetic = m_euler.psi;
 
-              dispatch(m_euler, DF_KEEP_TIME);
-              dispatch(m_accel, DF_KEEP_TIME);
-              dispatch(m_agvel, DF_KEEP_TIME);
-              dispatch(m_temp, DF_KEEP_TIME);
+              dispatchSample(m_envs[0], m_euler);
+              dispatchSample(m_envs[1], m_accel);
+              dispatchSample(m_envs[2], m_agvel);
+              dispatchSample(m_envs[3], m_temp);
 
               uint64_t time_diff = Clock::getMsec() - time_start;
 
@@ -209,6 +220,32 @@ namespace Sensors
         war(DTR("overrun of %lu ms"), (unsigned long)(Clock::getMsec() - time_start));
       }
 
+      //! Dispatch a sample through a reusable envelope. When no
+      //! consumer still holds the previous sample the enclosed
+      //! message is patched in place, avoiding the clone the bus
+      //! performs on every plain dispatch.
+      //! @param[in,out] env reusable envelope, created on demand.
+      //! @param[in] msg message to dispatch.
+      template <typename T>
+      void
+      dispatchSample(IMC::SharedMessage*& env, const T& msg)
+      {
+        if (env != NULL && env->isUnique())
+        {
+          *static_cast<T*>(const_cast<IMC::Message*>(env->get())) = msg;
+          env->touch();
+        }
+        else
+        {
+          if (env != NULL)
+            env->release();
+
+          env = IMC::SharedMessage::create(&msg);
+        }
+
+        dispatch(env, DF_KEEP_TIME);
+      }
+
       int
       parse(uint8_t byte)
       {
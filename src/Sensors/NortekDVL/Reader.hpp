@@ -71,7 +71,8 @@ namespace Sensors
         m_task(task),
         m_handle(handle),
         m_state(MSTA_INIT),
-        m_param(param)
+        m_param(param),
+        m_frame_ts(-1.0)
       {
       }
 
@@ -108,6 +109,8 @@ namespace Sensors
       //! Current line.
       std::string m_line;
       Mutex m_closed_mutex;
+      //! Arrival time of the frame being cached.
+      double m_frame_ts;
 
       void
       dispatch(IMC::Message& msg)
@@ -241,6 +244,10 @@ namespace Sensors
                 for (; pos < rv; ++pos)
                   if ((uint8_t)m_buffer[pos] == 0xA5)
                   {
+                    // Stamp the frame with the arrival time of the
+                    // read that carried its header, not the time at
+                    // which parsing completes.
+                    m_frame_ts = m_handle->getReceiveTimestamp();
                     m_state = MSTA_CACHE_HDR;
                     m_cached = 0;
                     break;
@@ -315,6 +322,16 @@ namespace Sensors
       {
         IMC::DevDataBinary data;
         data.value.assign(m_cache, m_cache + m_cached);
+
+        if (m_frame_ts > 0)
+        {
+          data.setTimeStamp(m_frame_ts);
+          data.setDestination(m_task->getSystemId());
+          data.setDestinationEntity(m_task->getEntityId());
+          m_task->dispatch(data, DF_LOOP_BACK | DF_KEEP_TIME);
+          return;
+        }
+
         dispatch(data);
       }
 
@@ -47,6 +47,8 @@ namespace Sensors
 
     static const double c_pwr_on_delay = 5.0;
     static const double c_init_tout = 10.0;
+    //! Number of bottom-track beams.
+    static const unsigned c_beam_count = 4;
 
     struct Arguments
     {
@@ -62,6 +64,8 @@ namespace Sensors
       std::vector<double> rotation;
       //! Pressure offset in hPa.
       float poff;
+      //! Sections of the bottom-track frame to publish.
+      std::vector<std::string> sections;
 
       Reader::NortekParam params;
     };
@@ -74,6 +78,18 @@ namespace Sensors
       IMC::Temperature m_temp;
       IMC::Pressure m_prs;
       IMC::EulerAngles m_euler;
+      //! Per-beam distances plus filtered altitude.
+      IMC::Distance m_dist[c_beam_count + 1];
+      //! Beam filter.
+      Navigation::BeamFilter* m_filter;
+      //! True to publish ground velocity.
+      bool m_pub_vel;
+      //! True to publish pressure.
+      bool m_pub_prs;
+      //! True to publish temperature.
+      bool m_pub_temp;
+      //! True to publish beam distances.
+      bool m_pub_dist;
       //! Task arguments.
       Arguments m_args;
       std::string m_init_line;
@@ -84,6 +100,11 @@ namespace Sensors
       Task(const std::string& name, Tasks::Context& ctx):
         Tasks::Task(name, ctx),
         m_handle(NULL),
+        m_filter(NULL),
+        m_pub_vel(true),
+        m_pub_prs(true),
+        m_pub_temp(true),
+        m_pub_dist(true),
         m_reader(NULL)
       {
         updateDCM(0, 0, 0);
@@ -149,6 +170,10 @@ namespace Sensors
         .defaultValue("0")
         .description("Pressure offset in hPa");
 
+        param("Published Sections", m_args.sections)
+        .defaultValue("velocity, pressure, temperature, distance")
+        .description("Sections of the bottom-track frame to publish");
+
         m_euler.setSourceEntity(getEntityId());
         m_prs.setSourceEntity(getEntityId());
         m_temp.setSourceEntity(getEntityId());
@@ -178,6 +203,30 @@ namespace Sensors
             updateDCM(m_args.rotation[0] * deg2rad,
                       m_args.rotation[1] * deg2rad,
                       m_args.rotation[2] * deg2rad);
+
+        m_pub_vel = sectionEnabled("velocity");
+        m_pub_prs = sectionEnabled("pressure");
+        m_pub_temp = sectionEnabled("temperature");
+        m_pub_dist = sectionEnabled("distance");
+      }
+
+      bool
+      sectionEnabled(const std::string& name) const
+      {
+        return std::find(m_args.sections.begin(), m_args.sections.end(),
+                         name) != m_args.sections.end();
+      }
+
+      void
+      onEntityReservation(void)
+      {
+        for (unsigned i = 0; i < c_beam_count; ++i)
+        {
+          std::string ename = String::str("%s - Beam %u", getEntityLabel(), i);
+          m_dist[i].setSourceEntity(reserveEntity(ename));
+        }
+
+        m_dist[c_beam_count].setSourceEntity(reserveEntity("DVL Filtered"));
       }
 
       void
@@ -203,6 +252,8 @@ namespace Sensors
           if (!openSocket())
             m_handle = new SerialPort(m_args.uart_dev, m_args.uart_baud);
 
+          m_filter = new Navigation::BeamFilter(this, c_beam_count);
+
           m_reader = new Reader(this, m_handle, m_args.params);
           m_reader->start();
         }
@@ -238,6 +289,7 @@ namespace Sensors
         }
 
         Memory::clear(m_handle);
+        Memory::clear(m_filter);
       }
 
       void
@@ -269,7 +321,7 @@ namespace Sensors
         if (msg->getDestinationEntity() != getEntityId())
           return;
 
-        processFrame(&msg->value[0], msg->value.size());
+        processFrame(&msg->value[0], msg->value.size(), msg->getTimeStamp());
       }
 
       void
@@ -286,12 +338,12 @@ namespace Sensors
       }
 
       void
-      processFrame(const char *data, size_t len)
+      processFrame(const char *data, size_t len, double ts)
       {
         switch (data[2])
         {
           case 0x1B:
-            processBottomTrack(data, len);
+            processBottomTrack(data, len, ts);
             break;
 
           case 0x16:
@@ -304,7 +356,7 @@ namespace Sensors
       }
 
       void
-      processBottomTrack(const char *data, size_t len)
+      processBottomTrack(const char *data, size_t len, double ts)
       {
         uint32_t status;
         std::memcpy(&status, data + HDR_SIZE + 20, sizeof(uint32_t));
@@ -319,17 +371,34 @@ namespace Sensors
         m_gvel.z = vx * m_dcm[6] + vy * m_dcm[7] + vz * m_dcm[8];
         m_gvel.validity = (status >> 12) & 7;
 
-        dispatch(m_gvel);
+        // Keep the arrival time captured by the reader: navigation
+        // uses the ping time, not the parse time.
+        if (m_pub_vel)
+        {
+          m_gvel.setTimeStamp(ts);
+          dispatch(m_gvel, DF_KEEP_TIME);
+        }
 
         float prs;
         std::memcpy(&prs, data + HDR_SIZE + 32, sizeof(float));
-        m_prs.value = prs * 1000 + m_args.poff;
-        dispatch(m_prs);
+        if (m_pub_prs)
+        {
+          m_prs.value = prs * 1000 + m_args.poff;
+          m_prs.setTimeStamp(ts);
+          dispatch(m_prs, DF_KEEP_TIME);
+        }
 
         float temp;
         std::memcpy(&temp, data + HDR_SIZE + 28, sizeof(float));
-        m_temp.value = temp;
-        dispatch(m_temp);
+        if (m_pub_temp)
+        {
+          m_temp.value = temp;
+          m_temp.setTimeStamp(ts);
+          dispatch(m_temp, DF_KEEP_TIME);
+        }
+
+        if (m_pub_dist)
+          publishDistances(data, ts);
 
         spew("vel: (%.2f, %.2f, %.2f), prs: %.2f, temp: %.1f, valid_bits: %d%d%d",
                 m_gvel.x, m_gvel.y, m_gvel.z,
@@ -339,6 +408,37 @@ namespace Sensors
         (void)len;
       }
 
+      //! Publish the per-beam bottom-track distances and the filtered
+      //! altitude computed from them.
+      //! @param[in] data bottom-track frame.
+      //! @param[in] ts ping timestamp.
+      void
+      publishDistances(const char* data, double ts)
+      {
+        for (unsigned i = 0; i < c_beam_count; ++i)
+        {
+          float dist;
+          std::memcpy(&dist, data + HDR_SIZE + 52 + i * sizeof(float), sizeof(float));
+
+          bool valid = (dist > 0.0f);
+          m_dist[i].value = dist;
+          m_dist[i].validity = valid ?
+            IMC::Distance::DV_VALID : IMC::Distance::DV_INVALID;
+          m_filter->setValidity(i, valid ? IMC::Distance::DV_VALID :
+                                IMC::Distance::DV_INVALID);
+          m_filter->update(i, dist);
+
+          m_dist[i].setTimeStamp(ts);
+          dispatch(m_dist[i], DF_KEEP_TIME);
+        }
+
+        m_dist[c_beam_count].value = m_filter->get();
+        m_dist[c_beam_count].validity = (m_dist[c_beam_count].value > 0.0 ?
+                                         IMC::Distance::DV_VALID : IMC::Distance::DV_INVALID);
+        m_dist[c_beam_count].setTimeStamp(ts);
+        dispatch(m_dist[c_beam_count], DF_KEEP_TIME);
+      }
+
       void
       processAverageData(const char *data, size_t len)
       {
@@ -43,17 +43,28 @@ namespace Sensors
       std::string path;
       //! Entity label of temperature sensor.
       std::string elabel_temp;
+      //! Telemetry delta threshold, zero dispatches every sample.
+      double tlm_delta;
+      //! Telemetry refresh period.
+      double tlm_refresh;
     };
 
     struct Task: public Tasks::Periodic
     {
       //! Temperature messages.
       IMC::Temperature m_temp;
+      //! Last dispatched temperature.
+      double m_last;
+      //! True once a temperature was dispatched.
+      bool m_valid;
+      //! Telemetry refresh timer.
+      Time::Counter<double> m_refresh;
       //! Task arguments.
       Arguments m_args;
 
       Task(const std::string& name, Tasks::Context& ctx):
-        Tasks::Periodic(name, ctx)
+        Tasks::Periodic(name, ctx),
+        m_valid(false)
       {
         // Define configuration parameters.
         param("Path", m_args.path)
@@ -63,6 +74,26 @@ namespace Sensors
         param("Entity Label - Temperature", m_args.elabel_temp)
         .defaultValue("Mainboard (Core)")
         .description("Entity label of temperature sensor");
+
+        param("Telemetry Delta Threshold", m_args.tlm_delta)
+        .defaultValue("0.0")
+        .minimumValue("0.0")
+        .description("Minimum temperature change for a sample to be"
+                     " dispatched; zero dispatches every sample");
+
+        param("Telemetry Refresh Period", m_args.tlm_refresh)
+        .defaultValue("10.0")
+        .minimumValue("1.0")
+        .units(Units::Second)
+        .description("Maximum time between dispatches of an unchanged"
+                     " temperature");
+      }
+
+      void
+      onUpdateParameters(void)
+      {
+        m_refresh.setTop(m_args.tlm_refresh);
+        m_valid = false;
       }
 
       void
@@ -92,6 +123,14 @@ namespace Sensors
         try
         {
           m_temp.value = readValue(m_args.path.c_str());
+
+          if (m_valid && m_args.tlm_delta > 0.0 && !m_refresh.overflow()
+              && std::fabs(m_temp.value - m_last) < m_args.tlm_delta)
+            return;
+
+          m_refresh.reset();
+          m_last = m_temp.value;
+          m_valid = true;
           dispatch(m_temp);
         }
         catch (...)
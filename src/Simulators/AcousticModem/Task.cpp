@@ -27,6 +27,14 @@
 // Author: José Braga                                                       *
 //***************************************************************************
 
+// ISO C++ 98 headers.
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <list>
+#include <string>
+#include <vector>
+
 // DUNE headers.
 #include <DUNE/DUNE.hpp>
 
@@ -42,6 +50,16 @@ namespace Simulators
   //! used to receive DUNE::IMC::AcousticMessage from the remote peer which
   //! are translated to DUNE::IMC::UamRxFrame
   //!
+  //! The UDP link itself is instantaneous and lossless, so the task
+  //! emulates the acoustic channel on the receiving side: frames are
+  //! delivered after the propagation delay for the current range
+  //! (positions are exchanged over the same socket) plus the
+  //! transmission time at the configured bit rate, and may be dropped
+  //! by a probabilistic loss model or by a measured channel trace
+  //! replayed from a file. Transmission requests issued outside the
+  //! assigned TDMA slot fail like they would in the water, so
+  //! schedule bugs surface on the bench.
+  //!
   //! @author José Braga
   namespace AcousticModem
   {
@@ -55,25 +73,93 @@ namespace Simulators
       Address addr;
       //! Remote port of the remote DUNE system also running this task
       uint16_t port;
+      //! Transmission speed in bits per second.
+      double tx_speed;
+      //! Propagation speed in meters per second.
+      double prop_speed;
+      //! Probability of losing one frame.
+      double ploss;
+      //! Total number of TDMA slots, zero disables slot checking.
+      unsigned tdma_slot_count;
+      //! TDMA slots assigned to this modem.
+      std::vector<unsigned> tdma_slots;
+      //! Duration of each TDMA slot in seconds.
+      unsigned tdma_duration;
+      //! Path of a measured channel trace, empty disables replay.
+      std::string trace_file;
+      //! Position update period.
+      double pos_period;
+      //! PRNG type.
+      std::string prng_type;
+      //! PRNG seed.
+      int prng_seed;
     };
 
     struct Task: public DUNE::Tasks::Task
     {
       //! Buffer capacity.
-      static const unsigned c_bfr_size = 255;
+      static const unsigned c_bfr_size = 512;
+      //! One record of a measured channel trace.
+      struct TraceRecord
+      {
+        //! One-way latency in seconds.
+        double latency;
+        //! True if the frame was delivered.
+        bool delivered;
+      };
+      //! One frame waiting out its channel delay.
+      struct PendingFrame
+      {
+        //! Delivery time.
+        double time;
+        //! Frame to deliver.
+        IMC::UamRxFrame frame;
+      };
       // Task arguments.
       Arguments m_args;
       // UDP Socket.
       UDPSocket* m_sock;
       //! Read buffer.
       std::vector<uint8_t> m_bfr;
+      //! TDMA slot schedule.
+      Network::TDMA m_tdma;
+      //! True when TDMA slot checking is active.
+      bool m_tdma_enabled;
+      //! Pseudo-random generator.
+      Random::Generator* m_prng;
+      //! Measured channel trace.
+      std::vector<TraceRecord> m_trace;
+      //! Next trace record to replay.
+      size_t m_trace_idx;
+      //! Frames waiting out their channel delay, in delivery order.
+      std::list<PendingFrame> m_pending;
+      //! Local position.
+      IMC::RemoteState m_lstate;
+      //! True when the local position is known.
+      bool m_has_pos;
+      //! Navigation origin.
+      IMC::GpsFix m_origin;
+      //! True when the navigation origin is known.
+      bool m_has_origin;
+      //! Last position received from the peer.
+      IMC::RemoteState m_peer;
+      //! True when the peer position is known.
+      bool m_has_peer;
+      //! Position update timer.
+      Time::Counter<double> m_pos_timer;
 
       //! Constructor.
       //! @param[in] name task name.
       //! @param[in] ctx context.
       Task(const std::string& name, Tasks::Context& ctx):
         DUNE::Tasks::Task(name, ctx),
-        m_sock(NULL)
+        m_sock(NULL),
+        m_tdma_enabled(false),
+        m_prng(NULL),
+        m_trace_idx(0),
+        m_has_pos(false),
+        m_has_origin(false),
+        m_has_peer(false)
       {
         param("Local Port", m_args.local_port)
         .defaultValue("6021")
@@ -91,8 +177,60 @@ namespace Simulators
         .maximumValue("65535")
         .description("UDP port of remote system");
 
+        param("Transmission Speed", m_args.tx_speed)
+        .units(Units::BitPerSecond)
+        .defaultValue("1000")
+        .minimumValue("1")
+        .description("Acoustic transmission speed");
+
+        param("Propagation Speed", m_args.prop_speed)
+        .units(Units::MeterPerSecond)
+        .defaultValue("1500")
+        .minimumValue("1")
+        .description("Speed of sound in the medium");
+
+        param("Probability Of Loss", m_args.ploss)
+        .defaultValue("0.0")
+        .minimumValue("0.0")
+        .maximumValue("1.0")
+        .description("Probability of losing one frame, ignored while a"
+                     " channel trace is being replayed");
+
+        param("TDMA -- Slot Count", m_args.tdma_slot_count)
+        .defaultValue("0")
+        .description("Total number of TDMA slots, zero disables slot checking");
+
+        param("TDMA -- Slot Number", m_args.tdma_slots)
+        .defaultValue("")
+        .description("TDMA slots assigned to this modem");
+
+        param("TDMA -- Slot Duration", m_args.tdma_duration)
+        .units(Units::Second)
+        .defaultValue("0")
+        .description("Duration of each TDMA slot");
+
+        param("Channel Trace", m_args.trace_file)
+        .defaultValue("")
+        .description("File with measured channel records, one"
+                     " '<latency> <delivered>' pair per line, replayed"
+                     " cyclically in place of the analytic delay and"
+                     " loss models");
+
+        param("Position Update Period", m_args.pos_period)
+        .units(Units::Second)
+        .defaultValue("1.0")
+        .description("Period between position updates sent to the peer");
+
+        param("PRNG Type", m_args.prng_type)
+        .defaultValue(Random::Factory::c_default);
+
+        param("PRNG Seed", m_args.prng_seed)
+        .defaultValue("-1");
+
         m_bfr.resize(c_bfr_size);
 
+        bind<IMC::GpsFix>(this);
+        bind<IMC::SimulatedState>(this);
         bind<IMC::UamTxFrame>(this);
       }
 
@@ -108,6 +246,12 @@ namespace Simulators
           if (paramChanged(m_args.port))
             throw RestartNeeded(DTR("restarting to change UDP port"), 1);
         }
+
+        m_tdma_enabled = (m_args.tdma_slot_count > 0) && (m_args.tdma_duration > 0);
+        if (m_tdma_enabled)
+          m_tdma.reset(m_args.tdma_slot_count, m_args.tdma_slots, m_args.tdma_duration);
+
+        m_pos_timer.setTop(m_args.pos_period);
       }
 
       //! Acquire resources by binding to the local UDP port.
@@ -116,6 +260,8 @@ namespace Simulators
       {
         m_sock = new UDPSocket;
         m_sock->bind(m_args.local_port, Address::Any, false);
+        m_prng = Random::Factory::create(m_args.prng_type, m_args.prng_seed);
+        loadTrace();
         setEntityState(IMC::EntityState::ESTA_NORMAL, Status::CODE_ACTIVE);
       }
 
@@ -124,6 +270,87 @@ namespace Simulators
       onResourceRelease(void)
       {
         Memory::clear(m_sock);
+        Memory::clear(m_prng);
+      }
+
+      //! Load the measured channel trace, if one is configured.
+      void
+      loadTrace(void)
+      {
+        m_trace.clear();
+        m_trace_idx = 0;
+
+        if (m_args.trace_file.empty())
+          return;
+
+        std::ifstream ifs(m_args.trace_file.c_str());
+        if (!ifs.is_open())
+          throw RestartNeeded(DTR("failed to open channel trace"), 5);
+
+        std::string line;
+        while (std::getline(ifs, line))
+        {
+          if (line.empty() || line[0] == '#')
+            continue;
+
+          TraceRecord rec;
+          unsigned delivered = 0;
+          if (std::sscanf(line.c_str(), "%lf %u", &rec.latency, &delivered) != 2)
+            continue;
+
+          rec.delivered = (delivered != 0);
+          m_trace.push_back(rec);
+        }
+
+        if (m_trace.empty())
+          throw RestartNeeded(DTR("channel trace holds no records"), 5);
+
+        inf(DTR("replaying channel trace with %u records"),
+            (unsigned)m_trace.size());
+      }
+
+      void
+      consume(const IMC::GpsFix* msg)
+      {
+        if (msg->type != IMC::GpsFix::GFT_MANUAL_INPUT)
+          return;
+
+        m_origin = *msg;
+        m_has_origin = true;
+      }
+
+      void
+      consume(const IMC::SimulatedState* msg)
+      {
+        if (!m_has_origin)
+          return;
+
+        double rlat = m_origin.lat;
+        double rlon = m_origin.lon;
+        WGS84::displace(msg->x, msg->y, &rlat, &rlon);
+        m_lstate.lat = (fp32_t)rlat;
+        m_lstate.lon = (fp32_t)rlon;
+        m_lstate.depth = (uint8_t)msg->z;
+        m_lstate.psi = msg->psi;
+        m_lstate.speed = msg->u;
+        m_has_pos = true;
+      }
+
+      //! Report the outcome of a transmission request.
+      //! @param[in] msg transmission request.
+      //! @param[in] value outcome code.
+      //! @param[in] error error message, if any.
+      void
+      sendTxStatus(const IMC::UamTxFrame* msg, uint8_t value,
+                   const std::string& error = "")
+      {
+        IMC::UamTxStatus status;
+        status.setDestination(msg->getSource());
+        status.setDestinationEntity(msg->getSourceEntity());
+        status.seq = msg->seq;
+        status.value = value;
+        status.error = error;
+        dispatch(status);
       }
 
       //! Translates transmission request to a DUNE::IMC::AcousticMessage and
@@ -135,6 +362,18 @@ namespace Simulators
         if (msg->getSource() != getSystemId())
           return;
 
+        if (m_tdma_enabled)
+        {
+          float utc = (float)std::fmod(Clock::getSinceEpoch(), 86400.0);
+          if (!m_tdma.check(utc))
+          {
+            war(DTR("transmission request outside assigned TDMA slot"));
+            sendTxStatus(msg, IMC::UamTxStatus::UTS_FAILED,
+                         DTR("outside assigned TDMA slot"));
+            return;
+          }
+        }
+
         // Serialize AcousticMessage.
         IMC::AcousticMessage amsg;
         amsg.setSource(getSystemId());
@@ -149,24 +388,60 @@ namespace Simulators
         try
         {
           m_sock->write((const uint8_t*)&m_bfr[0], rv, m_args.addr, m_args.port);
+          sendTxStatus(msg, IMC::UamTxStatus::UTS_DONE);
         }
         catch (...)
-        { }
+        {
+          sendTxStatus(msg, IMC::UamTxStatus::UTS_FAILED,
+                       DTR("failed to reach the remote peer"));
+        }
+      }
+
+      //! Compute the channel delay of one frame and decide if it is
+      //! delivered, replaying the measured trace when one is loaded.
+      //! @param[in] size frame size in bytes.
+      //! @param[out] delay one-way latency in seconds.
+      //! @return true if the frame is delivered.
+      bool
+      applyChannel(size_t size, double& delay)
+      {
+        if (!m_trace.empty())
+        {
+          const TraceRecord& rec = m_trace[m_trace_idx];
+          m_trace_idx = (m_trace_idx + 1) % m_trace.size();
+          delay = rec.latency;
+          return rec.delivered;
+        }
+
+        double range = 0.0;
+        if (m_has_pos && m_has_peer)
+          range = WGS84::distance(m_lstate.lat, m_lstate.lon, m_lstate.depth,
+                                  m_peer.lat, m_peer.lon, m_peer.depth);
+
+        delay = range / m_args.prop_speed + (size * 8.0) / m_args.tx_speed;
+        return m_prng->uniform() >= m_args.ploss;
       }
 
       //! Read incoming datagrams. If incoming data is a DUNE::IMC::AcousticMessage,
       //! and contains a DUNE::IMC::UamTxFrame (inline) it gets translated to a
-      //! @publish DUNE::IMC::UamRxFrame and gets posted to the local bus.
+      //! @publish DUNE::IMC::UamRxFrame and gets queued until its channel
+      //! delay elapses. Incoming DUNE::IMC::RemoteState updates the peer
+      //! position used by the propagation delay model.
       void
       readData(void)
       {
-        if (!Poll::poll(*m_sock, 1.0))
+        if (!Poll::poll(*m_sock, 0.1))
           return;
 
         size_t rv = m_sock->read(&m_bfr[0], m_bfr.size());
         IMC::Message* msg = IMC::Packet::deserialize((uint8_t*)&m_bfr[0], rv);
 
-        if (msg->getId() == DUNE_IMC_ACOUSTICMESSAGE)
+        if (msg->getId() == DUNE_IMC_REMOTESTATE)
+        {
+          m_peer = *static_cast<const IMC::RemoteState*>(msg);
+          m_has_peer = true;
+        }
+        else if (msg->getId() == DUNE_IMC_ACOUSTICMESSAGE)
         {
           const IMC::AcousticMessage* am = static_cast<const IMC::AcousticMessage*>(msg);
           const IMC::Message* m = am->message.get();
@@ -176,18 +451,64 @@ namespace Simulators
             const IMC::UamTxFrame* frame = static_cast<const IMC::UamTxFrame*>(m);
 
             // Check if we are the right destination
-            if (resolveSystemName(frame->sys_dst) != getSystemId())
-              return;
-
-            // Process data.
-            IMC::UamRxFrame rx;
-            rx.sys_src = resolveSystemId(msg->getSource());
-            rx.sys_dst = getSystemName();
-            rx.data = frame->data;
-            debug("received acoustic message from %s", rx.sys_src.c_str());
-            dispatch(rx);
+            if (resolveSystemName(frame->sys_dst) == getSystemId())
+            {
+              double delay = 0;
+              if (applyChannel(frame->data.size(), delay))
+              {
+                // Process data.
+                PendingFrame pending;
+                pending.time = Clock::get() + delay;
+                pending.frame.sys_src = resolveSystemId(msg->getSource());
+                pending.frame.sys_dst = getSystemName();
+                pending.frame.data = frame->data;
+                m_pending.push_back(pending);
+                debug("acoustic message from %s, delivery in %0.3f s",
+                      pending.frame.sys_src.c_str(), delay);
+              }
+              else
+              {
+                debug("acoustic message from %s lost in the channel",
+                      resolveSystemId(msg->getSource()));
+              }
+            }
           }
         }
+
+        delete msg;
+      }
+
+      //! Dispatch the frames whose channel delay has elapsed.
+      void
+      deliverFrames(void)
+      {
+        double now = Clock::get();
+        while (!m_pending.empty() && m_pending.front().time <= now)
+        {
+          debug("received acoustic message from %s",
+                m_pending.front().frame.sys_src.c_str());
+          dispatch(m_pending.front().frame);
+          m_pending.pop_front();
+        }
+      }
+
+      //! Share the local position with the peer.
+      void
+      sendPosition(void)
+      {
+        m_lstate.setSource(getSystemId());
+        m_lstate.setSourceEntity(getEntityId());
+        m_lstate.setTimeStamp();
+
+        size_t rv = IMC::Packet::serialize(&m_lstate, (uint8_t*)&m_bfr[0],
+                                           (uint16_t)m_bfr.size());
+
+        try
+        {
+          m_sock->write((const uint8_t*)&m_bfr[0], rv, m_args.addr, m_args.port);
+        }
+        catch (...)
+        { }
       }
 
       //! Main loop.
@@ -200,6 +521,14 @@ namespace Simulators
 
           if (m_sock != NULL)
             readData();
+
+          deliverFrames();
+
+          if (m_has_pos && m_pos_timer.overflow())
+          {
+            sendPosition();
+            m_pos_timer.reset();
+          }
         }
       }
     };
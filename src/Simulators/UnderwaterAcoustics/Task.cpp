@@ -69,6 +69,16 @@ namespace Simulators
       typedef std::map<int, IMC::RemoteState> RStateMap;
       RStateMap m_positions;
 
+      // Pairwise distances in structure-of-arrays form: node
+      // coordinates and a symmetric distance table, refreshed one
+      // row/column at a time when a node reports a new position, so
+      // per-transmission loss queries are table lookups.
+      typedef std::map<int, unsigned> NodeIndexMap;
+      NodeIndexMap m_node_idx;
+      std::vector<double> m_node_lat;
+      std::vector<double> m_node_lon;
+      std::vector<double> m_dist_tab;
+
       // Handling of simulated traffic.
       IMC::UASimulation* m_pending; // Pending delivery to self
       double m_busy_till; // Time until underwater medium is busy (for collision detection)
@@ -183,6 +193,7 @@ namespace Simulators
         }
 
         m_positions[rstate->getSource()] = *rstate;
+        updateDistances(rstate);
 
         if (m_args.trace)
         {
@@ -194,17 +205,55 @@ namespace Simulators
         }
       }
 
+      void
+      updateDistances(const IMC::RemoteState* rstate)
+      {
+        NodeIndexMap::iterator itr = m_node_idx.find(rstate->getSource());
+        unsigned idx;
+        unsigned count = m_node_lat.size();
+
+        if (itr == m_node_idx.end())
+        {
+          // New node: grow the coordinate arrays and re-layout the
+          // distance table (rare, only on first contact).
+          idx = count++;
+          m_node_idx[rstate->getSource()] = idx;
+          m_node_lat.push_back(rstate->lat);
+          m_node_lon.push_back(rstate->lon);
+          std::vector<double> grown(count * count, 0.0);
+          for (unsigned i = 0; i + 1 < count; ++i)
+            for (unsigned j = 0; j + 1 < count; ++j)
+              grown[i * count + j] = m_dist_tab[i * (count - 1) + j];
+          m_dist_tab.swap(grown);
+        }
+        else
+        {
+          idx = itr->second;
+          m_node_lat[idx] = rstate->lat;
+          m_node_lon[idx] = rstate->lon;
+        }
+
+        // Refresh this node's row and column.
+        for (unsigned i = 0; i < count; ++i)
+        {
+          double d = (i == idx) ? 0.0 :
+                     WGS84::distance(m_node_lat[idx], m_node_lon[idx], 0,
+                                     m_node_lat[i], m_node_lon[i], 0);
+          m_dist_tab[idx * count + i] = d;
+          m_dist_tab[i * count + idx] = d;
+        }
+      }
+
       double
       distance(int src, int dst)
       {
-        RStateMap::iterator sitr = m_positions.find(src);
-        RStateMap::iterator ditr = m_positions.find(dst);
+        NodeIndexMap::iterator sitr = m_node_idx.find(src);
+        NodeIndexMap::iterator ditr = m_node_idx.find(dst);
 
-        if (sitr == m_positions.end() || ditr == m_positions.end())
+        if (sitr == m_node_idx.end() || ditr == m_node_idx.end())
           return -1;
 
-        return WGS84::distance(sitr->second.lat, sitr->second.lon, 0,
-                               ditr->second.lat, ditr->second.lon, 0);
+        return m_dist_tab[sitr->second * m_node_lat.size() + ditr->second];
       }
 
       void
@@ -71,6 +71,31 @@ namespace Supervisors
 
     struct Task: public DUNE::Tasks::Periodic
     {
+      //! Event fed to the vehicle state machine. Transitions are
+      //! evaluated only when one of these happens, not by polling.
+      struct SMEvent
+      {
+        enum Type
+        {
+          //! Entity monitoring state was updated.
+          EV_MONITOR,
+          //! Control loops became enabled.
+          EV_LOOPS_ON,
+          //! Control loops became disabled.
+          EV_LOOPS_OFF,
+          //! Periodic tick, used only for timeout supervision.
+          EV_TICK
+        };
+
+        //! Event type.
+        Type type;
+      };
+
+      //! Vehicle state machine: one handler per operation mode, so
+      //! every transition out of a mode is listed in a single method
+      //! and the worst-case reaction time is one event dispatch.
+      typedef Utils::StateMachine<Task, SMEvent> VSM;
+
       //! Timer to wait for calibration and maneuver requests.
       float m_switch_time;
       //! Currently ignoring errors while executing plan.
@@ -99,6 +124,8 @@ namespace Supervisors
       ManeuverSupervisor* m_man_sup;
       //! A timeout for calibration state
       float m_calib_timeout;
+      //! Vehicle state machine, kept in lockstep with m_vs.op_mode.
+      VSM m_sm;
       //! Task arguments.
       Arguments m_args;
 
@@ -107,7 +134,8 @@ namespace Supervisors
         m_switch_time(-1.0),
         m_ignore_errors(false),
         m_scope_ref(0),
-        m_man_sup(NULL)
+        m_man_sup(NULL),
+        m_sm(&Task::onBoot)
       {
         param("Vital Entities", m_args.vital_ents)
         .defaultValue("")
@@ -186,6 +214,41 @@ namespace Supervisors
         m_eboot = 0;
 
         m_ents_in_error.clear();
+
+        m_sm.reset(&Task::onBoot);
+      }
+
+      //! Get the state handler of a given operation mode.
+      //! @param[in] mode operation mode.
+      //! @return state machine handler.
+      VSM::STATE
+      stateOf(IMC::VehicleState::OperationModeEnum mode)
+      {
+        switch (mode)
+        {
+          case IMC::VehicleState::VS_SERVICE:
+            return &Task::onService;
+          case IMC::VehicleState::VS_CALIBRATION:
+            return &Task::onCalibration;
+          case IMC::VehicleState::VS_ERROR:
+            return &Task::onError;
+          case IMC::VehicleState::VS_MANEUVER:
+            return &Task::onManeuver;
+          case IMC::VehicleState::VS_EXTERNAL:
+            return &Task::onExternal;
+          default:
+            return &Task::onBoot;
+        }
+      }
+
+      //! Feed one event to the state machine.
+      //! @param[in] type event type.
+      void
+      stepMachine(SMEvent::Type type)
+      {
+        SMEvent ev;
+        ev.type = type;
+        m_sm.step(*this, ev);
       }
 
       void
@@ -234,9 +297,173 @@ namespace Supervisors
         }
 
         m_switch_time = -1.0;
+
+        // Mode changes may be redirected above (e.g. to ERROR or
+        // BOOT), so the machine follows the mode that was actually
+        // entered.
+        m_sm.reset(stateOf((IMC::VehicleState::OperationModeEnum)m_vs.op_mode));
+
         dispatch(m_vs);
       }
 
+      //! BOOT mode: wait for every entity to leave the boot state.
+      VSM::STATE
+      onBoot(SMEvent& ev)
+      {
+        switch (ev.type)
+        {
+          case SMEvent::EV_MONITOR:
+            if (!m_vs.error_count)
+              changeMode(IMC::VehicleState::VS_SERVICE);
+            else if (!m_eboot)
+              changeMode(IMC::VehicleState::VS_ERROR);
+            break;
+          case SMEvent::EV_LOOPS_ON:
+            if (nonOverridableLoops())
+              changeMode(IMC::VehicleState::VS_EXTERNAL);
+            else
+              reset(); // try to disable the control loops
+            break;
+          default:
+            break;
+        }
+
+        return 0;
+      }
+
+      //! ERROR mode: wait for entity errors to clear.
+      VSM::STATE
+      onError(SMEvent& ev)
+      {
+        switch (ev.type)
+        {
+          case SMEvent::EV_MONITOR:
+            if (!m_vs.error_count)
+              changeMode(IMC::VehicleState::VS_SERVICE);
+            break;
+          case SMEvent::EV_LOOPS_ON:
+            if (nonOverridableLoops())
+              changeMode(IMC::VehicleState::VS_EXTERNAL);
+            else
+              reset(); // try to disable the control loops
+            break;
+          default:
+            break;
+        }
+
+        return 0;
+      }
+
+      //! SERVICE mode: idle, watching for errors and stray loops.
+      VSM::STATE
+      onService(SMEvent& ev)
+      {
+        switch (ev.type)
+        {
+          case SMEvent::EV_MONITOR:
+            if (entityError())
+            {
+              reset();
+              changeMode(IMC::VehicleState::VS_ERROR);
+            }
+            break;
+          case SMEvent::EV_LOOPS_ON:
+            m_loops_timer.reset();
+            break;
+          case SMEvent::EV_TICK:
+            if (m_vs.control_loops && m_loops_timer.overflow())
+              changeMode(IMC::VehicleState::VS_EXTERNAL);
+            break;
+          default:
+            break;
+        }
+
+        return 0;
+      }
+
+      //! MANEUVER mode: supervise the running maneuver.
+      VSM::STATE
+      onManeuver(SMEvent& ev)
+      {
+        switch (ev.type)
+        {
+          case SMEvent::EV_MONITOR:
+            if (entityError() && !nonOverridableLoops() && !teleoperationOn())
+            {
+              reset();
+              changeMode(IMC::VehicleState::VS_ERROR);
+            }
+            break;
+          case SMEvent::EV_TICK:
+            if (m_switch_time >= 0.0
+                && (Clock::get() - m_switch_time) > c_man_timeout)
+            {
+              inf(DTR("maneuver request timeout"));
+              reset();
+              changeMode(IMC::VehicleState::VS_SERVICE);
+              m_switch_time = -1.0;
+            }
+            break;
+          default:
+            break;
+        }
+
+        return 0;
+      }
+
+      //! CALIBRATION mode: supervise the calibration timeout.
+      VSM::STATE
+      onCalibration(SMEvent& ev)
+      {
+        switch (ev.type)
+        {
+          case SMEvent::EV_TICK:
+            if (m_switch_time >= 0.0
+                && (Clock::get() - m_switch_time) > m_calib_timeout)
+            {
+              inf(DTR("calibration timed out"));
+              reset();
+              changeMode(IMC::VehicleState::VS_SERVICE);
+              m_switch_time = -1.0;
+            }
+            break;
+          default:
+            break;
+        }
+
+        return 0;
+      }
+
+      //! EXTERNAL mode: loops enabled by an outside controller.
+      VSM::STATE
+      onExternal(SMEvent& ev)
+      {
+        switch (ev.type)
+        {
+          case SMEvent::EV_MONITOR:
+            if (entityError() && !nonOverridableLoops() && !teleoperationOn())
+            {
+              reset();
+              changeMode(IMC::VehicleState::VS_ERROR);
+            }
+            break;
+          case SMEvent::EV_LOOPS_OFF:
+            changeMode(IMC::VehicleState::VS_SERVICE);
+            break;
+          case SMEvent::EV_TICK:
+            if (!m_args.ext_control)
+            {
+              err(DTR("this vehicle does not allow for external control, disabling loops"));
+              disableLoops();
+            }
+            break;
+          default:
+            break;
+        }
+
+        return 0;
+      }
+
       void
       consume(const IMC::Abort* msg)
       {
@@ -255,21 +482,7 @@ namespace Supervisors
       {
         debug("some control loops are enabled now");
 
-        switch ((IMC::VehicleState::OperationModeEnum)m_vs.op_mode)
-        {
-          case IMC::VehicleState::VS_SERVICE:
-            m_loops_timer.reset();
-            break;
-          case IMC::VehicleState::VS_ERROR:
-          case IMC::VehicleState::VS_BOOT:
-            if (nonOverridableLoops())
-              changeMode(IMC::VehicleState::VS_EXTERNAL);
-            else
-              reset();  // try to disable the control loops
-            break;
-          default:
-            break; // ignore
-        }
+        stepMachine(SMEvent::EV_LOOPS_ON);
       }
 
       void
@@ -277,10 +490,7 @@ namespace Supervisors
       {
         debug("no control loops are enabled now");
 
-        if (externalMode())
-          changeMode(IMC::VehicleState::VS_SERVICE);
-
-        // ignore otherwise
+        stepMachine(SMEvent::EV_LOOPS_OFF);
       }
 
       void
@@ -364,33 +574,7 @@ namespace Supervisors
           m_err_timer.reset();
         }
 
-        if (errorMode() || bootMode())
-        {
-          if (!m_vs.error_count)
-            changeMode(IMC::VehicleState::VS_SERVICE);
-          else if (!m_eboot && bootMode())
-            changeMode(IMC::VehicleState::VS_ERROR);
-
-          return;
-        }
-
-        // External/maneuver mode
-        if (externalMode() || maneuverMode())
-        {
-          if (entityError() && !nonOverridableLoops() && !teleoperationOn())
-          {
-            reset();
-            changeMode(IMC::VehicleState::VS_ERROR);
-          }
-          return;
-        }
-
-        // Otherwise (SERVICE, MANEUVER modes)
-        if (entityError() && !calibrationMode())
-        {
-          reset();
-          changeMode(IMC::VehicleState::VS_ERROR);
-        }
+        stepMachine(SMEvent::EV_MONITOR);
       }
 
       void
@@ -621,43 +805,14 @@ namespace Supervisors
       void
       task(void)
       {
+        // The periodic cycle is reduced to the state heartbeat and
+        // timeout supervision; all other transitions are evaluated
+        // when the triggering event is consumed.
         dispatch(m_vs);
 
-        if (serviceMode() && m_vs.control_loops && m_loops_timer.overflow())
-          changeMode(IMC::VehicleState::VS_EXTERNAL);
-
-        if (!m_args.ext_control && externalMode())
-        {
-          err(DTR("this vehicle does not allow for external control, disabling loops"));
-          disableLoops();
-        }
-
         m_man_sup->update();
 
-        if (m_switch_time < 0.0)
-          return;
-
-        double delta = Clock::get() - m_switch_time;
-
-        bool timedout = false;
-
-        if (maneuverMode() && (delta > c_man_timeout))
-        {
-          inf(DTR("maneuver request timeout"));
-          timedout = true;
-        }
-        else if (calibrationMode() && (delta > m_calib_timeout))
-        {
-          inf(DTR("calibration timed out"));
-          timedout = true;
-        }
-
-        if (timedout)
-        {
-          reset();
-          changeMode(IMC::VehicleState::VS_SERVICE);
-          m_switch_time = -1.0;
-        }
+        stepMachine(SMEvent::EV_TICK);
       }
 
       //! Check if the entities in error are relevant for performing an emergency plan
@@ -52,10 +52,15 @@ namespace Transports
       bool local;
     };
 
+    //! Position change (m) that triggers an immediate announce.
+    static const double c_pos_delta = 25.0;
+
     struct Arguments
     {
       // Delay between announcements.
       double announce_delay;
+      // Maximum delay between announcements while state is unchanged.
+      double announce_delay_max;
       // Ports.
       std::vector<unsigned> ports;
       // True if multicast is enabled.
@@ -96,6 +101,16 @@ namespace Transports
       IMC::Announce m_announce_ext;
       // Time of last announce.
       double m_last_announce;
+      // Current announce period, grows while state is unchanged.
+      double m_announce_period;
+      // Service strings of the last announce.
+      std::string m_last_services_loc;
+      std::string m_last_services_ext;
+      // Position of the last announce.
+      double m_last_lat;
+      double m_last_lon;
+      // True when the announced state changed since the last announce.
+      bool m_changed;
       // URIs of local services.
       std::set<std::string> m_uris_loc;
       // URIs of external services.
@@ -106,7 +121,11 @@ namespace Transports
       Task(const std::string& name, Tasks::Context& ctx):
         DUNE::Tasks::Task(name, ctx),
         m_estate(0),
-        m_last_announce(-1)
+        m_last_announce(-1),
+        m_announce_period(0),
+        m_last_lat(0),
+        m_last_lon(0),
+        m_changed(true)
       {
         // Define configuration parameters.
         param("Announcement Periodicity", m_args.announce_delay)
@@ -114,6 +133,18 @@ namespace Transports
         .defaultValue("10")
         .description("Periodicity of announcements");
 
+        param("Announcement Periodicity - Maximum", m_args.announce_delay_max)
+        .units(Units::Second)
+        .defaultValue("25")
+        .description("Announces back off exponentially to this periodicity"
+                     " while the announced state is unchanged. Changes to"
+                     " services or position trigger an immediate announce."
+                     " Set to the base periodicity to disable backoff. On"
+                     " idle links announces are what keeps peer contact"
+                     " tables alive, so this must stay below the shortest"
+                     " contact timeout among peers (Transports.UDP defaults"
+                     " to 30 s)");
+
         param("Enable Loopback", m_args.enable_lback)
         .defaultValue("true")
         .description("Enable announcing on loopback interfaces");
@@ -210,6 +241,20 @@ namespace Transports
 
         for (unsigned i = 0; i < m_args.adi_services_ext.size(); ++i)
           m_uris_ext.insert(m_args.adi_services_ext[i]);
+
+        m_announce_period = m_args.announce_delay;
+        markChanged();
+      }
+
+      //! Flag the announced state as changed when it differs from the
+      //! last announce, restarting the backoff and triggering an
+      //! immediate announce.
+      void
+      markChanged(void)
+      {
+        if (m_announce_loc.services != m_last_services_loc ||
+            m_announce_ext.services != m_last_services_ext)
+          m_changed = true;
       }
 
       void
@@ -222,6 +267,15 @@ namespace Transports
           *m_estate = *msg;
         else
           m_estate = new IMC::EstimatedState(*msg);
+
+        // Announce immediately when we moved far from the last
+        // announced position.
+        double lat;
+        double lon;
+        float hae;
+        Coordinates::toWGS84(*m_estate, lat, lon, hae);
+        if (WGS84::distance(m_last_lat, m_last_lon, 0, lat, lon, 0) > c_pos_delta)
+          m_changed = true;
       }
 
       void
@@ -258,6 +312,7 @@ namespace Transports
         }
 
         generateServiceStrings();
+        markChanged();
       }
 
       void
@@ -428,6 +483,20 @@ namespace Transports
           catch (...)
           { }
         }
+
+        // Exponential backoff: announces of unchanged state are
+        // progressively spaced out, changes restart the base period.
+        double period_max = std::max(m_args.announce_delay_max, m_args.announce_delay);
+        if (m_changed)
+          m_announce_period = m_args.announce_delay;
+        else
+          m_announce_period = std::min(m_announce_period * 2.0, period_max);
+
+        m_changed = false;
+        m_last_services_loc = m_announce_loc.services;
+        m_last_services_ext = m_announce_ext.services;
+        m_last_lat = m_announce_loc.lat;
+        m_last_lon = m_announce_loc.lon;
       }
 
       void
@@ -439,7 +508,10 @@ namespace Transports
 
           double now = Clock::get();
 
-          if ((now - m_last_announce) > m_args.announce_delay)
+          // Changes are announced at the base period, unchanged state
+          // at the current backed-off period.
+          double period = m_changed ? m_args.announce_delay : m_announce_period;
+          if ((now - m_last_announce) > period)
           {
             m_last_announce = now;
             announce();
@@ -0,0 +1,280 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// POSIX headers.
+#if defined(DUNE_SYS_HAS_UNISTD_H)
+#  include <unistd.h>
+#endif
+
+#if defined(DUNE_SYS_HAS_FCNTL_H)
+#  include <fcntl.h>
+#endif
+
+#if defined(DUNE_SYS_HAS_SIGNAL_H)
+#  include <signal.h>
+#endif
+
+namespace Transports
+{
+  //! Black-box message recorder.
+  //!
+  //! This task keeps the most recent traffic of a configured set of
+  //! critical messages in a fixed-size memory ring, independently of
+  //! the Logging transport. The ring is flushed to disk when the
+  //! system receives an abort and, where sigaction(2) is available,
+  //! from a crash signal handler, so the seconds leading up to an
+  //! incident survive a logger failure.
+  //!
+  //! Dumps are plain LSF: records wrap around the ring and readers
+  //! recover record boundaries through the IMC synchronization
+  //! number, so the usual log tools apply.
+  namespace BlackBox
+  {
+    using DUNE_NAMESPACES;
+
+    //! Bytes per Kibibyte.
+    static const unsigned c_bytes_per_kib = 1024U;
+
+    //! %Task arguments.
+    struct Arguments
+    {
+      //! List of messages to record.
+      std::vector<std::string> messages;
+      //! Ring capacity.
+      unsigned ring_size;
+    };
+
+    struct Task;
+
+    //! Instance visible to the crash signal handler.
+    static Task* s_instance = NULL;
+
+#if defined(DUNE_SYS_HAS_SIGACTION)
+    extern "C" void
+    handleCrash(int signo);
+#endif
+
+    struct Task: public DUNE::Tasks::Task
+    {
+      //! Message ring.
+      std::vector<uint8_t> m_ring;
+      //! Offset of the next write.
+      size_t m_head;
+      //! Serialization buffer.
+      ByteBuffer m_sink;
+      //! Crash dump path, prepared in advance for the signal handler.
+      char m_crash_path[512];
+      //! Task arguments.
+      Arguments m_args;
+
+      //! Constructor.
+      //! @param[in] name task name.
+      //! @param[in] ctx context.
+      Task(const std::string& name, Tasks::Context& ctx):
+        DUNE::Tasks::Task(name, ctx),
+        m_head(0)
+      {
+        param("Transports", m_args.messages)
+        .defaultValue("")
+        .description("Messages to record");
+
+        param("Ring Size", m_args.ring_size)
+        .defaultValue("4096")
+        .minimumValue("64")
+        .description("Ring capacity in KiB");
+
+        std::memset(m_crash_path, 0, sizeof(m_crash_path));
+
+        bind<IMC::Abort>(this);
+      }
+
+      void
+      onUpdateParameters(void)
+      {
+        if (m_ring.empty() || paramChanged(m_args.ring_size))
+        {
+          m_ring.assign((size_t)m_args.ring_size * c_bytes_per_kib, 0);
+          m_head = 0;
+        }
+
+        bind(this, m_args.messages);
+      }
+
+      void
+      onResourceAcquisition(void)
+      {
+        std::string path = (m_ctx.dir_log / "blackbox-crash.lsf").str();
+        if (path.size() < sizeof(m_crash_path))
+          std::strcpy(m_crash_path, path.c_str());
+
+        s_instance = this;
+        setupCrashHandler();
+      }
+
+      void
+      onResourceRelease(void)
+      {
+        s_instance = NULL;
+      }
+
+      //! Install the crash signal handler. The disposition resets on
+      //! entry so re-raising after the dump still produces the usual
+      //! core.
+      void
+      setupCrashHandler(void)
+      {
+#if defined(DUNE_SYS_HAS_SIGACTION)
+        struct sigaction actions;
+
+        std::memset(&actions, 0, sizeof(actions));
+        sigemptyset(&actions.sa_mask);
+        actions.sa_flags = SA_RESETHAND;
+        actions.sa_handler = handleCrash;
+
+        sigaction(SIGSEGV, &actions, 0);
+        sigaction(SIGBUS, &actions, 0);
+        sigaction(SIGFPE, &actions, 0);
+        sigaction(SIGILL, &actions, 0);
+        sigaction(SIGABRT, &actions, 0);
+#endif
+      }
+
+      //! Append a serialized record to the ring, wrapping around its
+      //! end and overwriting the oldest data.
+      //! @param[in] msg message to record.
+      void
+      record(const IMC::Message* msg)
+      {
+        IMC::Packet::serialize(msg, m_sink);
+
+        const uint8_t* p = m_sink.getBuffer();
+        size_t n = m_sink.getSize();
+
+        if (n > m_ring.size())
+          return;
+
+        size_t tail_room = m_ring.size() - m_head;
+        if (n < tail_room)
+        {
+          std::memcpy(&m_ring[m_head], p, n);
+          m_head += n;
+        }
+        else
+        {
+          std::memcpy(&m_ring[m_head], p, tail_room);
+          std::memcpy(&m_ring[0], p + tail_room, n - tail_room);
+          m_head = n - tail_room;
+        }
+      }
+
+      //! Write the ring to disk, oldest data first.
+      //! @param[in] path destination file.
+      void
+      dump(const std::string& path)
+      {
+        std::ofstream ofs(path.c_str(), std::ios::binary);
+        ofs.write((const char*)&m_ring[m_head], m_ring.size() - m_head);
+        ofs.write((const char*)&m_ring[0], m_head);
+        ofs.close();
+
+        inf(DTR("black box dumped to '%s'"), path.c_str());
+      }
+
+      //! Write the ring using only async-signal-safe calls. Runs on
+      //! whatever thread crashed; a record torn by the interrupted
+      //! recorder is skipped by resynchronization when read back.
+      void
+      crashDump(void)
+      {
+#if defined(DUNE_SYS_HAS_SIGACTION)
+        if (m_crash_path[0] == '\0' || m_ring.empty())
+          return;
+
+        int fd = ::open(m_crash_path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (fd < 0)
+          return;
+
+        ssize_t rv = ::write(fd, &m_ring[m_head], m_ring.size() - m_head);
+        if (rv >= 0)
+          rv = ::write(fd, &m_ring[0], m_head);
+        (void)rv;
+
+        ::close(fd);
+#endif
+      }
+
+      void
+      consume(const IMC::Abort* msg)
+      {
+        if (msg->getDestination() != getSystemId())
+          return;
+
+        dump((m_ctx.dir_log / String::str("blackbox-%0.6f.lsf", Clock::getSinceEpoch())).str());
+      }
+
+      void
+      consume(const IMC::Message* msg)
+      {
+        record(msg);
+      }
+
+      //! Main loop.
+      void
+      onMain(void)
+      {
+        while (!stopping())
+        {
+          waitForMessages(1.0);
+        }
+      }
+    };
+
+#if defined(DUNE_SYS_HAS_SIGACTION)
+    extern "C" void
+    handleCrash(int signo)
+    {
+      if (s_instance != NULL)
+        s_instance->crashDump();
+
+      raise(signo);
+    }
+#endif
+  }
+}
+
+DUNE_TASK
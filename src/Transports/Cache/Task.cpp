@@ -46,6 +46,8 @@ namespace Transports
     {
       // Loading order.
       std::vector<std::string> order;
+      // Telemetry history capacity.
+      unsigned history_capacity;
     };
 
     struct Task: public DUNE::Tasks::Task
@@ -69,6 +71,11 @@ namespace Transports
         .defaultValue("")
         .description("List of messages ordered by loading order");
 
+        param("Telemetry History Capacity", m_args.history_capacity)
+        .defaultValue("600")
+        .description("Number of samples retained per telemetry series"
+                     " (0 to disable the telemetry history)");
+
         // Initialize internal buffer.
         m_buffer_size = 128;
         m_buffer = new uint8_t[m_buffer_size];
@@ -82,6 +89,9 @@ namespace Transports
 
         // Bind messages.
         bind<IMC::CacheControl>(this);
+        bind<IMC::EstimatedState>(this);
+        bind<IMC::Voltage>(this);
+        bind<IMC::Temperature>(this);
       }
 
       ~Task(void)
@@ -89,12 +99,40 @@ namespace Transports
         delete [] m_buffer;
       }
 
+      void
+      onUpdateParameters(void)
+      {
+        if (m_args.history_capacity > 0)
+          m_ctx.tstore.setCapacity(m_args.history_capacity);
+      }
+
       void
       onResourceInitialization(void)
       {
         setEntityState(IMC::EntityState::ESTA_NORMAL, Status::CODE_ACTIVE);
       }
 
+      void
+      consume(const IMC::EstimatedState* msg)
+      {
+        if (m_args.history_capacity > 0)
+          m_ctx.tstore.insert(msg);
+      }
+
+      void
+      consume(const IMC::Voltage* msg)
+      {
+        if (m_args.history_capacity > 0)
+          m_ctx.tstore.insert(msg);
+      }
+
+      void
+      consume(const IMC::Temperature* msg)
+      {
+        if (m_args.history_capacity > 0)
+          m_ctx.tstore.insert(msg);
+      }
+
       void
       consume(const IMC::CacheControl* msg)
       {
@@ -223,9 +223,8 @@ namespace Transports
       void
       sendIM(const uint8_t* data, size_t data_size, unsigned dst, bool ack)
       {
-        std::string cmd = String::str("*SENDIM,%u,%u,%s,", data_size, dst, ack ? "ack" : "noack");
-        cmd.append((char*)data, data_size);
-        sendAT(cmd);
+        sendATPayload(String::str("*SENDIM,%u,%u,%s,", data_size, dst, ack ? "ack" : "noack"),
+                      data, data_size);
         expectOK();
         setBusy(true);
       }
@@ -237,9 +236,7 @@ namespace Transports
       void
       sendBurst(const uint8_t* data, size_t data_size, unsigned dst)
       {
-        std::string cmd = String::str("*SEND,%u,%u,", data_size, dst);
-        cmd.append((char*)data, data_size);
-        sendAT(cmd);
+        sendATPayload(String::str("*SEND,%u,%u,", data_size, dst), data, data_size);
         expectOK();
         setBusy(true);
       }
@@ -252,9 +249,7 @@ namespace Transports
       sendPBM(const uint8_t* data, size_t data_size, unsigned dst)
       {
         // Do not set modem busy.
-        std::string cmd = String::str("*SENDPBM,%u,%u,", data_size, dst);
-        cmd.append((char*)data, data_size);
-        sendAT(cmd);
+        sendATPayload(String::str("*SENDPBM,%u,%u,", data_size, dst), data, data_size);
         expectOK();
       }
 
@@ -499,6 +494,8 @@ namespace Transports
     private:
       //! Firmware version.
       std::string m_version;
+      //! Reusable header buffer for payload commands.
+      std::string m_cmd_bfr;
       //! Physical layer protocol version.
       std::string m_phy_ptl_version;
       //! Data-link layer protocol version.
@@ -506,6 +503,38 @@ namespace Transports
       //! Declination offset.
       double m_declination;
 
+      //! Send an AT command whose payload is streamed from the
+      //! caller's buffer: header and payload bytes go straight to the
+      //! I/O handle, so burst data is never copied through
+      //! intermediate command strings. Only the header is logged,
+      //! keeping binary payloads out of DevDataText.
+      //! @param[in] header command, without the AT prefix and
+      //! trailing payload.
+      //! @param[in] data payload bytes.
+      //! @param[in] data_size number of payload bytes.
+      void
+      sendATPayload(const std::string& header, const uint8_t* data, size_t data_size)
+      {
+        m_cmd_bfr.assign("AT");
+        m_cmd_bfr.append(header);
+        m_last_cmd = m_cmd_bfr;
+
+        IMC::DevDataText txt;
+        txt.value = m_cmd_bfr;
+        txt.setDestination(getTask()->getSystemId());
+        getTask()->dispatch(txt);
+
+        getTask()->trace("send: %s (%u bytes of payload)",
+                         Streams::sanitize(m_cmd_bfr).c_str(), (unsigned)data_size);
+
+        sendRaw((const uint8_t*)m_cmd_bfr.data(), m_cmd_bfr.size());
+        if (data_size > 0)
+          sendRaw(data, data_size);
+
+        const std::string& term = getLineTermOut();
+        sendRaw((const uint8_t*)term.data(), term.size());
+      }
+
       void
       sendInitialization(void)
       {
@@ -28,6 +28,7 @@
 //***************************************************************************
 
 // ISO C++ 98 headers.
+#include <deque>
 #include <vector>
 
 // DUNE headers.
@@ -81,8 +82,15 @@ namespace Transports
       unsigned src_level_underwater;
       //! Name of the section with modem addresses.
       std::string addr_section;
+      //! Transmission queue size.
+      unsigned queue_size;
+      //! Transmission time to live.
+      double queue_ttl;
     };
 
+    //! Maximum size of frames classified as urgent (abort scale).
+    static const size_t c_urgent_max_size = 8;
+
     // Type definition for mapping addresses.
     typedef std::map<unsigned, unsigned> AddressMap;
     typedef std::map<std::string, unsigned> MapName;
@@ -108,6 +116,8 @@ namespace Transports
       bool m_declination;
       //! Current transmission ticket.
       Ticket* m_ticket;
+      //! Queue of tickets waiting for the modem.
+      std::deque<Ticket> m_queue;
       //! Keep-alive counter.
       Counter<double> m_kalive_counter;
       //! Medium.
@@ -207,6 +217,21 @@ namespace Transports
         .defaultValue("1")
         .description("Source level when medium is underwater");
 
+        param("Transmission Queue Size", m_args.queue_size)
+        .defaultValue("8")
+        .minimumValue("0")
+        .maximumValue("64")
+        .description("Maximum number of transmissions waiting for the modem."
+                     " Zero rejects requests while the modem is busy");
+
+        param("Transmission Time To Live", m_args.queue_ttl)
+        .defaultValue("60.0")
+        .minimumValue("0.0")
+        .units(Units::Second)
+        .description("Queued transmissions older than this are dropped"
+                     " instead of sent. Zero disables expiry; urgent frames"
+                     " never expire");
+
         param("Address Section", m_args.addr_section)
         .defaultValue("Evologics Addresses")
         .description("Name of the configuration section with modem addresses");
@@ -282,6 +307,7 @@ namespace Transports
         }
 
         Memory::clear(m_sock);
+        flushQueue(IMC::UamTxStatus::UTS_CANCELED);
         clearTicket(IMC::UamTxStatus::UTS_CANCELED);
       }
 
@@ -505,6 +531,11 @@ namespace Transports
         ticket.seq = msg->seq;
         ticket.ack = (msg->flags & IMC::UamTxFrame::UTF_ACK) != 0;
         ticket.pbm = (msg->flags & IMC::UamTxFrame::UTF_DELAYED) != 0;
+        ticket.data.assign(msg->data.begin(), msg->data.end());
+        ticket.prio = classify(ticket);
+
+        if (ticket.prio != TP_URGENT && m_args.queue_ttl > 0)
+          ticket.deadline = Clock::get() + m_args.queue_ttl;
 
         if (msg->sys_dst == getSystemName())
         {
@@ -523,20 +554,87 @@ namespace Transports
           return;
         }
 
-        // Fail if busy.
         if (m_driver->isBusy())
         {
-          sendTxStatus(ticket, IMC::UamTxStatus::UTS_BUSY);
+          // Small fire-and-forget frames ride along a burst in
+          // flight as piggyback instant messages.
+          if (canPiggyback(ticket))
+          {
+            try
+            {
+              m_driver->sendPBM(&ticket.data[0], ticket.data.size(), ticket.addr);
+              sendTxStatus(ticket, IMC::UamTxStatus::UTS_DONE);
+            }
+            catch (std::runtime_error& e)
+            {
+              sendTxStatus(ticket, IMC::UamTxStatus::UTS_FAILED, e.what());
+            }
+            return;
+          }
+
+          if (m_queue.size() < m_args.queue_size)
+          {
+            m_queue.push_back(ticket);
+            sendTxStatus(ticket, IMC::UamTxStatus::UTS_IP);
+          }
+          else
+          {
+            sendTxStatus(ticket, IMC::UamTxStatus::UTS_BUSY);
+          }
           return;
         }
 
+        startTicket(ticket);
+      }
+
+      //! Assign a priority class to a ticket based on its frame:
+      //! abort-sized frames preempt control and telemetry, which
+      //! preempt burst data.
+      //! @param[in] ticket ticket to classify.
+      //! @return priority class.
+      unsigned
+      classify(const Ticket& ticket) const
+      {
+        if (ticket.data.size() <= c_urgent_max_size)
+          return TP_URGENT;
+
+        if (ticket.data.size() <= c_im_max_size)
+          return TP_CONTROL;
+
+        return TP_BULK;
+      }
+
+      //! Check if a ticket can be piggybacked on the transmission in
+      //! flight.
+      //! @param[in] ticket candidate ticket.
+      //! @return true if the ticket can be sent as a piggyback
+      //! instant message.
+      bool
+      canPiggyback(const Ticket& ticket) const
+      {
+        if (ticket.ack || ticket.pbm)
+          return false;
+
+        if (ticket.data.size() > c_im_max_size)
+          return false;
+
+        // Piggyback frames travel on the burst data channel.
+        return (m_ticket != NULL) && (m_ticket->prio == TP_BULK);
+      }
+
+      //! Start transmitting a ticket, making it current.
+      //! @param[in] ticket ticket to transmit.
+      void
+      startTicket(Ticket& ticket)
+      {
         try
         {
-          transmitData((const uint8_t*)&msg->data[0], msg->data.size(), ticket);
+          transmitData(&ticket.data[0], ticket.data.size(), ticket);
         }
         catch (std::runtime_error& e)
         {
           sendTxStatus(ticket, IMC::UamTxStatus::UTS_FAILED, e.what());
+          return;
         }
 
         // Replace ticket and transmit.
@@ -546,6 +644,45 @@ namespace Transports
         m_kalive_counter.reset();
       }
 
+      //! Start the next queued ticket: highest priority first, FIFO
+      //! within the same class, dropping entries past their deadline.
+      void
+      serviceQueue(void)
+      {
+        while (!m_queue.empty() && !m_driver->isBusy())
+        {
+          size_t best = 0;
+          for (size_t i = 1; i < m_queue.size(); ++i)
+          {
+            if (m_queue[i].prio < m_queue[best].prio)
+              best = i;
+          }
+
+          Ticket ticket = m_queue[best];
+          m_queue.erase(m_queue.begin() + best);
+
+          if (ticket.deadline >= 0 && Clock::get() > ticket.deadline)
+          {
+            sendTxStatus(ticket, IMC::UamTxStatus::UTS_FAILED,
+                         DTR("transmission expired in queue"));
+            continue;
+          }
+
+          startTicket(ticket);
+        }
+      }
+
+      //! Cancel all queued tickets.
+      //! @param[in] reason status sent to the requesters.
+      void
+      flushQueue(IMC::UamTxStatus::ValueEnum reason)
+      {
+        for (size_t i = 0; i < m_queue.size(); ++i)
+          sendTxStatus(m_queue[i], reason);
+
+        m_queue.clear();
+      }
+
       void
       transmitData(const uint8_t* data, unsigned data_size, Ticket& ticket)
       {
@@ -572,6 +709,7 @@ namespace Transports
         (void)str;
         m_driver->setBusy(false);
         clearTicket(IMC::UamTxStatus::UTS_FAILED);
+        serviceQueue();
       }
 
       void
@@ -604,6 +742,7 @@ namespace Transports
         // Clear ticket.
         m_driver->setBusy(false);
         clearTicket(IMC::UamTxStatus::UTS_DONE);
+        serviceQueue();
       }
 
       void
@@ -618,6 +757,7 @@ namespace Transports
         {
           m_driver->setBusy(false);
           clearTicket(IMC::UamTxStatus::UTS_DONE);
+          serviceQueue();
         }
       }
 
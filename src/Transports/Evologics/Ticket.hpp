@@ -33,6 +33,7 @@
 // ISO C++ 98 headers.
 #include <sstream>
 #include <string>
+#include <vector>
 
 // DUNE headers.
 #include <DUNE/DUNE.hpp>
@@ -41,6 +42,17 @@ namespace Transports
 {
   namespace Evologics
   {
+    //! Transmission priority classes, most urgent first.
+    enum TicketPriority
+    {
+      //! Abort-sized frames.
+      TP_URGENT = 0,
+      //! Control and telemetry frames (instant message sized).
+      TP_CONTROL = 1,
+      //! Burst data.
+      TP_BULK = 2
+    };
+
     struct Ticket
     {
       //! IMC source address.
@@ -55,6 +67,23 @@ namespace Transports
       bool ack;
       //! Piggyback message.
       bool pbm;
+      //! Frame contents, kept while the ticket waits in the queue.
+      std::vector<uint8_t> data;
+      //! Priority class.
+      unsigned prio;
+      //! Time after which the ticket is stale, negative for none.
+      double deadline;
+
+      Ticket(void):
+        imc_sid(0),
+        imc_eid(0),
+        seq(0),
+        addr(0),
+        ack(false),
+        pbm(false),
+        prio(TP_CONTROL),
+        deadline(-1.0)
+      { }
     };
   }
 }
@@ -28,6 +28,7 @@
 //***************************************************************************
 
 // ISO C++ 98 headers.
+#include <fstream>
 #include <sstream>
 
 // DUNE headers.
@@ -362,10 +363,93 @@ namespace Transports
       TCPSocket* data = openDataConnection();
 
       if (!data->writeFile(path.c_str(), path.size() - 1, rest_offset))
+      {
+        // The client can verify the partial file with XCRC and
+        // resume from the last good byte with REST.
+        delete data;
+        sendReply(426, "Connection closed; transfer aborted.");
         return;
+      }
 
       closeDataConnection(data);
-      m_rest_offset = 0;
+    }
+
+    void
+    Session::handleXCRC(const std::string& arg)
+    {
+      // Syntax: XCRC <file> [<offset> [<length>]]. The offset and
+      // length select a range of the file, allowing a client to
+      // validate a partially transferred file before resuming it
+      // with REST/RETR instead of pulling it again from zero.
+      std::string name = arg;
+      int64_t offset = 0;
+      int64_t length = -1;
+
+      size_t space = arg.rfind(' ');
+      if (space != std::string::npos)
+      {
+        std::string head = arg.substr(0, space);
+        int64_t v0 = -1;
+        int64_t v1 = -1;
+        size_t space2 = head.rfind(' ');
+
+        if (space2 != std::string::npos
+            && castLexical(head.substr(space2 + 1), v0)
+            && castLexical(arg.substr(space + 1), v1))
+        {
+          name = head.substr(0, space2);
+          offset = v0;
+          length = v1;
+        }
+        else if (castLexical(arg.substr(space + 1), v0))
+        {
+          name = head;
+          offset = v0;
+        }
+      }
+
+      Path path = getAbsolutePath(name);
+      if (!path.isFile() || offset < 0)
+      {
+        sendReply(550, "Requested action not taken.");
+        return;
+      }
+
+      std::ifstream ifs(path.c_str(), std::ios::binary);
+      ifs.seekg(offset);
+      if (!ifs.good())
+      {
+        sendReply(550, "Requested action not taken.");
+        return;
+      }
+
+      if (length < 0)
+        length = path.size() - offset;
+
+      uint32_t crc = 0;
+      int64_t remaining = length;
+      char bfr[16 * 1024];
+      while (remaining > 0 && ifs.good())
+      {
+        std::streamsize amount = sizeof(bfr);
+        if (remaining < (int64_t)sizeof(bfr))
+          amount = remaining;
+
+        ifs.read(bfr, amount);
+        if (ifs.gcount() <= 0)
+          break;
+
+        crc = Algorithms::CRC32::compute((const uint8_t*)bfr, (size_t)ifs.gcount(), crc);
+        remaining -= ifs.gcount();
+      }
+
+      if (remaining > 0)
+      {
+        sendReply(550, "Requested action not taken.");
+        return;
+      }
+
+      sendReply(250, String::str("%08X", crc));
     }
 
     void
@@ -577,6 +661,8 @@ namespace Transports
         handleMODE(arg);
       else if (cmd == "SIZE")
         handleSIZE(arg);
+      else if (cmd == "XCRC")
+        handleXCRC(arg);
       else if (cmd == "RETR")
         handleRETR(arg);
       else if (cmd == "SYST")
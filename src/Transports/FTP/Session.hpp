@@ -122,6 +122,9 @@ namespace Transports
       void
       handleSIZE(const std::string& arg);
 
+      void
+      handleXCRC(const std::string& arg);
+
       void
       handleCWD(const std::string& arg);
 
@@ -27,6 +27,10 @@
 // Author: Ricardo Martins                                                  *
 //***************************************************************************
 
+// ISO C++ 98 headers.
+#include <iomanip>
+#include <sstream>
+
 // DUNE headers.
 #include <DUNE/DUNE.hpp>
 
@@ -41,8 +45,15 @@ namespace Transports
 
     MessageMonitor::MessageMonitor(const std::string& system, uint64_t uid):
       m_uid(uid),
+      m_pc_dirty(false),
       m_last_msgs_json(0),
+      m_msgs_gen(0),
+      m_msgs_json_gen(0),
+      m_entities_upd(0),
+      m_pc_upd(0),
       m_last_logbook_json(0),
+      m_logbook_gen(0),
+      m_logbook_json_gen(0),
       m_log_entry(100)
     {
       // Initialize meta information.
@@ -53,6 +64,7 @@ namespace Transports
          << "  'dune_time_start': '" << std::setprecision(12) << Clock::getSinceEpoch() << "',\n"
          << "  'dune_system': '" << system << "',\n";
       m_meta = os.str();
+      m_entities_frag = "  'dune_entities': { },\n";
     }
 
     MessageMonitor::~MessageMonitor(void)
@@ -81,6 +93,26 @@ namespace Transports
     {
       ScopedMutex l(m_mutex);
       m_entities = entities;
+      ++m_msgs_gen;
+      m_entities_upd = m_msgs_gen;
+
+      // The entity map only changes on (re)configuration, so its
+      // fragment is rendered here instead of per poll.
+      if (m_entities.empty())
+      {
+        m_entities_frag = "  'dune_entities': { },\n";
+        return;
+      }
+
+      std::ostringstream os;
+      os << "  'dune_entities': {\n";
+      EntityMap::iterator itr = m_entities.begin();
+      os << itr->first << " : {" << "\"label\": \"" << itr->second << "\"}";
+      ++itr;
+      for (; itr != m_entities.end(); ++itr)
+        os << ",\n" << itr->first << " : {" << "\"label\": \"" << itr->second << "\"}";
+      os << "\n},";
+      m_entities_frag = os.str();
     }
 
     ByteBuffer*
@@ -98,51 +130,133 @@ namespace Transports
       if (m_msgs.empty())
         return &m_msgs_json;
 
-      std::ostringstream os;
-      os << m_meta
-         << "  'dune_time_current': '" << std::setprecision(12) << Clock::getSinceEpoch() << "',\n";
+      // Nothing changed since the last render: keep serving the same
+      // document so consoles presenting its tag get a short reply.
+      if (m_msgs_json_gen == m_msgs_gen)
+        return &m_msgs_json;
 
-      if (m_entities.empty())
+      renderDirtyFragments();
+
+      std::ostringstream header;
+      header << m_meta
+             << "  'dune_time_current': '" << std::setprecision(12) << Clock::getSinceEpoch() << "',\n";
+
+      // Assemble the document in a reusable buffer: only the header
+      // and changed fragments were serialized this poll.
+      m_doc.setSize(0);
+      std::string str = header.str();
+      m_doc.appendSigned(str.c_str(), (uint32_t)str.size());
+      m_doc.appendSigned(m_entities_frag.c_str(), (uint32_t)m_entities_frag.size());
+      m_doc.appendSigned("  'dune_messages': [\n", 21);
+
+      std::map<unsigned, std::string>::iterator fitr = m_msgs_frag.begin();
+      m_doc.appendSigned(fitr->second.c_str(), (uint32_t)fitr->second.size());
+      ++fitr;
+
+      for (; fitr != m_msgs_frag.end(); ++fitr)
       {
-        os << "  'dune_entities': { },\n";
+        m_doc.appendSigned(",\n", 2);
+        m_doc.appendSigned(fitr->second.c_str(), (uint32_t)fitr->second.size());
       }
-      else
+
+      m_doc.appendSigned(m_pc_frag.c_str(), (uint32_t)m_pc_frag.size());
+      m_doc.appendSigned("\n]\n};", 5);
+
+      GzipCompressor cmp;
+      cmp.compress(m_msgs_json, (char*)m_doc.getBuffer(), (unsigned long)m_doc.getSize());
+      m_msgs_json_gen = m_msgs_gen;
+
+      return &m_msgs_json;
+    }
+
+    void
+    MessageMonitor::renderDirtyFragments(void)
+    {
+      // Re-render only the fragments of messages updated since the
+      // last snapshot; everything else is reused as-is.
+      std::set<unsigned>::iterator ditr = m_dirty.begin();
+      for (; ditr != m_dirty.end(); ++ditr)
       {
-        os << "  'dune_entities': {\n";
-        EntityMap::iterator itr = m_entities.begin();
-        os << itr->first << " : {" << "\"label\": \"" << itr->second << "\"}";
-        ++itr;
-        for (; itr != m_entities.end(); ++itr)
-          os << ",\n" << itr->first << " : {" << "\"label\": \"" << itr->second << "\"}";
-        os << "\n},";
+        std::ostringstream frag;
+        m_msgs[*ditr]->toJSON(frag);
+        m_msgs_frag[*ditr] = frag.str();
       }
+      m_dirty.clear();
 
-      os << "  'dune_messages': [\n";
+      if (m_pc_dirty)
+      {
+        std::ostringstream frag;
+        for (PowerChannelMap::iterator pitr = m_power_channels.begin(); pitr != m_power_channels.end(); ++pitr)
+        {
+          frag << ",\n";
+          pitr->second->toJSON(frag);
+        }
+        m_pc_frag = frag.str();
+        m_pc_dirty = false;
+      }
+    }
 
-      std::map<unsigned, IMC::Message*>::iterator itr = m_msgs.begin();
-      itr->second->toJSON(os);
-      ++itr;
+    std::string
+    MessageMonitor::deltaJSON(uint64_t since)
+    {
+      ScopedMutex l(m_mutex);
+
+      renderDirtyFragments();
+
+      std::ostringstream os;
+      os << "{\n"
+         << "  'dune_generation': '" << m_msgs_gen << "',\n"
+         << "  'dune_time_current': '" << std::setprecision(12)
+         << Clock::getSinceEpoch() << "',\n";
+
+      if (m_entities_upd > since)
+        os << m_entities_frag << "\n";
+
+      os << "  'dune_messages': [\n";
 
-      for (; itr != m_msgs.end(); ++itr)
+      bool first = true;
+      std::map<unsigned, uint64_t>::iterator itr = m_msgs_upd.begin();
+      for (; itr != m_msgs_upd.end(); ++itr)
       {
-        os << ",\n";
-        itr->second->toJSON(os);
+        if (itr->second <= since)
+          continue;
+
+        if (!first)
+          os << ",\n";
+
+        os << m_msgs_frag[itr->first];
+        first = false;
       }
 
-      for (PowerChannelMap::iterator pitr = m_power_channels.begin(); pitr != m_power_channels.end(); ++pitr)
+      if (m_pc_upd > since && m_pc_frag.size() > 2)
       {
-        os << ",\n";
-        pitr->second->toJSON(os);
+        // The power channel fragment carries a leading separator for
+        // appending to a non-empty list.
+        if (first)
+          os << m_pc_frag.substr(2);
+        else
+          os << m_pc_frag;
       }
 
-      os << "\n]"
-         << "\n};";
+      os << "\n]\n}\n";
 
-      GzipCompressor cmp;
-      std::string str = os.str();
-      cmp.compress(m_msgs_json, (char*)str.c_str(), (unsigned long)str.size());
+      return os.str();
+    }
 
-      return &m_msgs_json;
+    std::string
+    MessageMonitor::messagesTag(void)
+    {
+      ScopedMutex l(m_mutex);
+      return String::str("\"%llu-%llu\"", (unsigned long long)m_uid,
+                         (unsigned long long)m_msgs_json_gen);
+    }
+
+    std::string
+    MessageMonitor::logbookTag(void)
+    {
+      ScopedMutex l(m_mutex);
+      return String::str("\"%llu-lb%llu\"", (unsigned long long)m_uid,
+                         (unsigned long long)m_logbook_json_gen);
     }
 
     void
@@ -160,6 +274,12 @@ namespace Transports
         delete m_msgs[key];
 
       m_msgs[key] = tmsg;
+      m_dirty.insert(key);
+      ++m_msgs_gen;
+      m_msgs_upd[key] = m_msgs_gen;
+
+      if (msg->getId() == DUNE_IMC_POWERCHANNELSTATE)
+        m_pc_upd = m_msgs_gen;
     }
 
     ByteBuffer*
@@ -178,6 +298,9 @@ namespace Transports
       if (m_logbook.empty())
         return &m_logbook_json;
 
+      if (m_logbook_json_gen == m_logbook_gen)
+        return &m_logbook_json;
+
       std::ostringstream os;
       unsigned int itr = 0;
 
@@ -199,6 +322,7 @@ namespace Transports
       GzipCompressor cmp;
       std::string str = os.str();
       cmp.compress(m_logbook_json, (char*)str.c_str(), (unsigned long)str.size());
+      m_logbook_json_gen = m_logbook_gen;
 
       return &m_logbook_json;
     }
@@ -212,6 +336,7 @@ namespace Transports
         m_logbook.erase(m_logbook.begin());
 
       m_logbook.push_back(new IMC::LogBookEntry(*msg));
+      ++m_logbook_gen;
     }
 
     void
@@ -222,6 +347,8 @@ namespace Transports
         *itr->second = *msg;
       else
         m_power_channels[msg->name] = new IMC::PowerChannelState(*msg);
+
+      m_pc_dirty = true;
     }
   }
 }
@@ -32,6 +32,7 @@
 
 // ISO C++ 98 headers.
 #include <map>
+#include <set>
 #include <string>
 
 // DUNE headers.
@@ -57,6 +58,29 @@ namespace Transports
       DUNE::Utils::ByteBuffer*
       logbookJSON(void);
 
+      //! Retrieve the entity tag of the document currently served by
+      //! messagesJSON(). The tag only changes when the document does,
+      //! so pollers presenting it back can skip unchanged payloads.
+      //! @return entity tag, quoted as used on the wire.
+      std::string
+      messagesTag(void);
+
+      //! Retrieve the entity tag of the document currently served by
+      //! logbookJSON().
+      //! @return entity tag, quoted as used on the wire.
+      std::string
+      logbookTag(void);
+
+      //! Render the state fragments updated after the given
+      //! generation as a standalone document, carrying the current
+      //! generation for the client to present on its next poll.
+      //! Generation zero yields the full state, so the same request
+      //! bootstraps a new console.
+      //! @param[in] since generation of the client's last poll.
+      //! @return delta document.
+      std::string
+      deltaJSON(uint64_t since);
+
       void
       addLogEntry(const DUNE::IMC::LogBookEntry* msg);
 
@@ -84,6 +108,18 @@ namespace Transports
       std::string m_meta;
       // Table of messages.
       std::map<unsigned, DUNE::IMC::Message*> m_msgs;
+      // Rendered JSON fragment of each message.
+      std::map<unsigned, std::string> m_msgs_frag;
+      // Messages updated since their fragment was rendered.
+      std::set<unsigned> m_dirty;
+      // Rendered JSON fragment of the entity map.
+      std::string m_entities_frag;
+      // Rendered JSON fragment of the power channels.
+      std::string m_pc_frag;
+      // Power channels changed since their fragment was rendered.
+      bool m_pc_dirty;
+      // Reusable buffer holding the assembled document.
+      DUNE::Utils::ByteBuffer m_doc;
       // Entity map.
       EntityMap m_entities;
       // Concurrency mutex.
@@ -94,6 +130,16 @@ namespace Transports
       DUNE::Utils::ByteBuffer m_msgs_json;
       // Last JSON messages refresh.
       uint64_t m_last_msgs_json;
+      // Message table generation, bumped on every update.
+      uint64_t m_msgs_gen;
+      // Generation rendered into m_msgs_json.
+      uint64_t m_msgs_json_gen;
+      // Generation at which each message last updated.
+      std::map<unsigned, uint64_t> m_msgs_upd;
+      // Generation at which the entity map last updated.
+      uint64_t m_entities_upd;
+      // Generation at which the power channels last updated.
+      uint64_t m_pc_upd;
       //! Power channels.
       PowerChannelMap m_power_channels;
       // Logbook messages.
@@ -102,11 +148,20 @@ namespace Transports
       DUNE::Utils::ByteBuffer m_logbook_json;
       // Last logbook generation timestamp.
       uint64_t m_last_logbook_json;
+      // Logbook generation, bumped on every entry.
+      uint64_t m_logbook_gen;
+      // Generation rendered into m_logbook_json.
+      uint64_t m_logbook_json_gen;
       // Number of logbook messages to show.
       unsigned int m_log_entry;
 
       void
       updatePowerChannel(const DUNE::IMC::PowerChannelState* msg);
+
+      //! Render the fragments of messages updated since the last
+      //! render. Must be called with the mutex held.
+      void
+      renderDirtyFragments(void);
     };
   }
 }
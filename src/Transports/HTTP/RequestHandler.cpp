@@ -49,6 +49,7 @@
 #define STATUS_LINE_200 "HTTP/1.0 200 OK\r\n"
 #define STATUS_LINE_201 "HTTP/1.0 201 Created\r\n"
 #define STATUS_LINE_206 "HTTP/1.0 206 Partial Content\r\n"
+#define STATUS_LINE_304 "HTTP/1.0 304 Not Modified\r\n"
 #define STATUS_LINE_403 "HTTP/1.0 403 Forbidden\r\n"
 #define STATUS_LINE_404 "HTTP/1.0 404 Not Found\r\n"
 #define STATUS_LINE_416 "HTTP/1.0 416 Requested Range Not Satisfiable\r\n"
@@ -75,7 +76,8 @@ namespace Transports
          << "Cache-Control: " << "max-age=1, must-revalidate" << "\r\n"
          << "Last-Modified: " << now << "\r\n"
          << "Expires: " << now << "\r\n"
-         << "Accept-Ranges: " << "bytes" << "\r\n";
+         << "Accept-Ranges: " << "bytes" << "\r\n"
+         << "Connection: " << "keep-alive" << "\r\n";
 
       // Add extra header fields.
       if (hdr_fields)
@@ -113,6 +115,12 @@ namespace Transports
       sock->write("Created", 7);
     }
 
+    void
+    RequestHandler::sendResponse304(TCPSocket* sock, HeaderFieldsMap* hdr_fields)
+    {
+      sendHeader(sock, STATUS_LINE_304, 0, hdr_fields);
+    }
+
     void
     RequestHandler::sendResponse403(TCPSocket* sock)
     {
@@ -241,11 +249,12 @@ namespace Transports
       sendResponse404(sock);
     }
 
-    void
+    bool
     RequestHandler::handleRequest(TCPSocket* sock)
     {
       char mtd[16];
       char uri[512];
+      char version[16];
       char bfr[c_max_request_size] = {0};
 
       // Search for end of request.
@@ -281,7 +290,7 @@ namespace Transports
       if (size <= 0)
       {
         DUNE_WRN("HTTP", "request too short");
-        return;
+        return false;
       }
 
       char* hdr = new char[size + 1];
@@ -290,9 +299,21 @@ namespace Transports
 
       Utils::TupleList headers(hdr, ":", "\r\n", true);
 
+      bool keep_alive = false;
+
       // Parse request line.
-      if (std::sscanf(hdr, "%s %s %*s", mtd, uri) == 2)
+      if (std::sscanf(hdr, "%15s %511s %15s", mtd, uri, version) == 3)
       {
+        // Persistent connections: default for HTTP/1.1, opt-in for
+        // older clients, opt-out via 'Connection: close'.
+        keep_alive = (std::strcmp(version, "HTTP/1.1") == 0);
+        std::string con = headers.get("connection");
+        Utils::String::toLowerCase(con);
+        if (con.find("close") != std::string::npos)
+          keep_alive = false;
+        else if (con.find("keep-alive") != std::string::npos)
+          keep_alive = true;
+
         std::string uri_dec = URL::decode(uri);
         const char* uri_clean = uri_dec.c_str();
 
@@ -311,6 +332,7 @@ namespace Transports
       }
 
       delete[] hdr;
+      return keep_alive;
     }
   }
 }
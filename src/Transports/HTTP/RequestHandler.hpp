@@ -77,6 +77,9 @@ namespace Transports
       void
       sendResponse200(TCPSocket* sock);
 
+      void
+      sendResponse304(TCPSocket* sock, HeaderFieldsMap* hdr_fields = 0);
+
       void
       sendResponse403(TCPSocket* sock);
 
@@ -110,7 +113,11 @@ namespace Transports
       void
       sendFile(TCPSocket* sock, const std::string& file, HeaderFieldsMap& hdr_fields, int64_t off_beg = -1, int64_t off_end = -1);
 
-      void
+      //! Read and answer one request.
+      //! @param sock connection socket.
+      //! @return true if the connection should be kept alive for
+      //! further requests, false if it should be closed.
+      bool
       handleRequest(TCPSocket* sock);
     };
   }
@@ -47,15 +47,20 @@ namespace Transports
 {
   namespace HTTP
   {
+    //! Keep-alive connection idle timeout (s).
+    static const double c_keep_alive_tout = 30.0;
+
     class Handler: public Concurrency::Thread
     {
     public:
-      Handler(RequestHandler& hdler, Concurrency::TSQueue<TCPSocket*>& queue):
+      Handler(Server& server, RequestHandler& hdler, Concurrency::TSQueue<TCPSocket*>& queue):
+        m_server(server),
         m_handler(hdler),
         m_queue(queue)
       { }
 
     private:
+      Server& m_server;
       RequestHandler& m_handler;
       Concurrency::TSQueue<TCPSocket*>& m_queue;
 
@@ -74,14 +79,26 @@ namespace Transports
           if (!sock)
             continue;
 
+          bool keep_alive = false;
           try
           {
-            m_handler.handleRequest(sock);
+            // Answer pipelined requests without a round-trip through
+            // the idle list.
+            do
+            {
+              keep_alive = m_handler.handleRequest(sock);
+            }
+            while (keep_alive && IO::Poll::poll(*sock, 0.1));
           }
           catch (...)
-          { }
+          {
+            keep_alive = false;
+          }
 
-          delete sock;
+          if (keep_alive)
+            m_server.recycle(sock);
+          else
+            delete sock;
         }
       }
     };
@@ -91,11 +108,10 @@ namespace Transports
     {
       m_sock.bind(port);
       m_sock.listen(1024);
-      m_poll.add(m_sock);
 
       for (unsigned int i = 0; i < threads; ++i)
       {
-        Concurrency::Thread* t = new Handler(handler, m_queue);
+        Concurrency::Thread* t = new Handler(*this, handler, m_queue);
         m_pool.push_back(t);
         t->start();
       }
@@ -123,26 +139,69 @@ namespace Transports
         if (sock)
           delete sock;
       }
+
+      for (IdleList::iterator itr = m_idle.begin(); itr != m_idle.end(); ++itr)
+        delete itr->first;
+    }
+
+    void
+    Server::recycle(TCPSocket* sock)
+    {
+      Concurrency::ScopedMutex lock(m_idle_lock);
+      m_idle.push_back(std::make_pair(sock, Time::Clock::get() + c_keep_alive_tout));
     }
 
     void
     Server::poll(double timeout)
     {
-      if (m_poll.poll(timeout))
+      IO::Poll poll;
+      poll.add(m_sock);
+
       {
-        if (m_poll.wasTriggered(m_sock))
+        Concurrency::ScopedMutex lock(m_idle_lock);
+        for (IdleList::iterator itr = m_idle.begin(); itr != m_idle.end(); ++itr)
+          poll.add(*itr->first);
+      }
+
+      bool triggered = poll.poll(timeout);
+
+      // Requeue idle connections with a pending request, drop the
+      // ones whose idle timeout expired.
+      double now = Time::Clock::get();
+      {
+        Concurrency::ScopedMutex lock(m_idle_lock);
+        IdleList::iterator itr = m_idle.begin();
+        while (itr != m_idle.end())
         {
-          try
+          if (triggered && poll.wasTriggered(*itr->first))
+          {
+            m_queue.push(itr->first);
+            itr = m_idle.erase(itr);
+          }
+          else if (now > itr->second)
           {
-            TCPSocket* nc = m_sock.accept();
-            m_queue.push(nc);
+            delete itr->first;
+            itr = m_idle.erase(itr);
           }
-          catch (std::runtime_error& e)
+          else
           {
-            DUNE_ERR("Server", e.what());
+            ++itr;
           }
         }
       }
+
+      if (triggered && poll.wasTriggered(m_sock))
+      {
+        try
+        {
+          TCPSocket* nc = m_sock.accept();
+          m_queue.push(nc);
+        }
+        catch (std::runtime_error& e)
+        {
+          DUNE_ERR("Server", e.what());
+        }
+      }
     }
   }
 }
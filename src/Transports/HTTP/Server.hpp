@@ -31,6 +31,8 @@
 #define TRANSPORTS_HTTP_SERVER_HPP_INCLUDED_
 
 // ISO C++ 98 headers.
+#include <list>
+#include <utility>
 #include <vector>
 
 // DUNE headers.
@@ -58,7 +60,16 @@ namespace Transports
       void
       poll(double timeout);
 
+      //! Park a keep-alive connection until its next request or
+      //! until the idle timeout expires.
+      //! @param sock connection socket.
+      void
+      recycle(TCPSocket* sock);
+
     private:
+      //! List of idle keep-alive connections and their deadlines.
+      typedef std::list<std::pair<TCPSocket*, double> > IdleList;
+
       //! HTTP request handler.
       RequestHandler& m_handler;
       //! Server socket.
@@ -67,8 +78,10 @@ namespace Transports
       std::vector<Concurrency::Thread*> m_pool;
       //! Socket queue.
       Concurrency::TSQueue<TCPSocket*> m_queue;
-      //! I/O multiplexing.
-      IO::Poll m_poll;
+      //! Idle keep-alive connections.
+      IdleList m_idle;
+      //! Idle list lock.
+      Concurrency::Mutex m_idle_lock;
     };
   }
 }
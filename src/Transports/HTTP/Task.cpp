@@ -210,6 +210,14 @@ namespace Transports
             sendAgentJSON(sock, headers, uri);
           else if (matchURL(uri, "/dune/state/messages.js"))
             showMessages(sock, headers, uri);
+          else if (matchURL(uri, "/dune/state/delta.js", true))
+            showDelta(sock, headers, uri);
+          else if (matchURL(uri, "/dune/state/queues.js"))
+            showQueues(sock, headers, uri);
+          else if (matchURL(uri, "/dune/state/bus.js"))
+            showBusProfile(sock, headers, uri);
+          else if (matchURL(uri, "/dune/telemetry/", true))
+            showTelemetry(sock, headers, uri);
           else if (matchURL(uri, "/dune/power/channel/", true))
             handlePowerChannel(sock, headers, uri);
           else if (matchURL(uri, "/dune/state/logbook.js", true))
@@ -333,31 +341,218 @@ namespace Transports
       void
       showMessages(TCPSocket* sock, TupleList& headers, const char* uri)
       {
-        (void)headers;
         (void)uri;
 
+        ByteBuffer* bfr = m_msg_mon.messagesJSON();
+
         RequestHandler::HeaderFieldsMap hdr;
+        hdr["ETag"] = m_msg_mon.messagesTag();
+
+        if (headers.get("if-none-match") == hdr["ETag"])
+        {
+          sendResponse304(sock, &hdr);
+          return;
+        }
+
         hdr["Content-Type"] = "text/javascript";
         hdr["Content-Encoding"] = "gzip";
-
-        ByteBuffer* bfr = m_msg_mon.messagesJSON();
         sendData(sock, bfr->getBufferSigned(), bfr->getSize(), &hdr);
       }
 
       void
       showLogBook(TCPSocket* sock, TupleList& headers, const char* uri)
       {
-        (void)headers;
         (void)uri;
 
+        ByteBuffer* bfr = m_msg_mon.logbookJSON();
+
         RequestHandler::HeaderFieldsMap hdr;
+        hdr["ETag"] = m_msg_mon.logbookTag();
+
+        if (headers.get("if-none-match") == hdr["ETag"])
+        {
+          sendResponse304(sock, &hdr);
+          return;
+        }
+
         hdr["Content-Type"] = "text/javascript";
         hdr["Content-Encoding"] = "gzip";
-
-        ByteBuffer* bfr = m_msg_mon.logbookJSON();
         sendData(sock, bfr->getBufferSigned(), bfr->getSize(), &hdr);
       }
 
+      //! Serve the state fragments updated since the generation given
+      //! in the 'since' query argument. A console polls this at its
+      //! own rate, presenting the generation of its previous reply,
+      //! and receives only what changed in between; 'since=0' (or no
+      //! argument) returns the full state.
+      void
+      showDelta(TCPSocket* sock, TupleList& headers, const char* uri)
+      {
+        (void)headers;
+
+        unsigned long long since = 0;
+        const char* query = std::strchr(uri, '?');
+        if (query != NULL)
+          std::sscanf(query, "?since=%llu", &since);
+
+        std::string doc = m_msg_mon.deltaJSON(since);
+
+        RequestHandler::HeaderFieldsMap hdr;
+        hdr["Content-Type"] = "text/javascript";
+        hdr["Cache-Control"] = "no-cache";
+        sendData(sock, doc, &hdr);
+      }
+
+      void
+      showQueues(TCPSocket* sock, TupleList& headers, const char* uri)
+      {
+        (void)headers;
+        (void)uri;
+
+        std::vector<DUNE::Tasks::QueueStats> list;
+        m_ctx.qstats.query(list);
+
+        std::ostringstream os;
+        os << "var queue_latency_bounds = [";
+        for (unsigned j = 0; j + 1 < DUNE::Tasks::c_queue_lat_buckets; ++j)
+        {
+          if (j > 0)
+            os << ", ";
+          os << DUNE::Tasks::c_queue_lat_bounds[j];
+        }
+        os << "];\n";
+
+        os << "var queues = [";
+        for (size_t i = 0; i < list.size(); ++i)
+        {
+          if (i > 0)
+            os << ",";
+
+          os << "\n  {\"name\": \"" << list[i].name << "\""
+             << ", \"depth\": " << list[i].depth
+             << ", \"depth_hwm\": " << list[i].depth_hwm
+             << ", \"consumed\": " << list[i].consumed
+             << ", \"latency\": [";
+
+          for (unsigned j = 0; j < DUNE::Tasks::c_queue_lat_buckets; ++j)
+          {
+            if (j > 0)
+              os << ", ";
+            os << list[i].latency[j];
+          }
+
+          os << "]}";
+        }
+        os << "\n];";
+
+        RequestHandler::HeaderFieldsMap hdr;
+        hdr["Content-Type"] = "text/javascript";
+        sendData(sock, os.str(), &hdr);
+      }
+
+      void
+      showBusProfile(TCPSocket* sock, TupleList& headers, const char* uri)
+      {
+        (void)headers;
+        (void)uri;
+
+        std::vector<IMC::Bus::DispatchStats> dstats;
+        m_ctx.mbus.getDispatchStats(dstats);
+
+        std::vector<DUNE::Tasks::QueueStats> qstats;
+        m_ctx.qstats.query(qstats);
+
+        std::ostringstream os;
+        os << "var bus = {\"dispatch\": [";
+        for (size_t i = 0; i < dstats.size(); ++i)
+        {
+          if (i > 0)
+            os << ",";
+
+          os << "\n  {\"msg\": \"" << IMC::Factory::getAbbrevFromId(dstats[i].id) << "\""
+             << ", \"count\": " << dstats[i].count
+             << ", \"fanout\": " << dstats[i].fanout
+             << "}";
+        }
+
+        // One row per (task, message type): enough to build a flame
+        // view of where consumer time goes.
+        os << "\n], \"consumers\": [";
+        bool first = true;
+        for (size_t i = 0; i < qstats.size(); ++i)
+        {
+          for (size_t j = 0; j < qstats[i].consumers.size(); ++j)
+          {
+            if (!first)
+              os << ",";
+            first = false;
+
+            const DUNE::Tasks::ConsumerStats& cs = qstats[i].consumers[j];
+            os << "\n  {\"task\": \"" << qstats[i].name << "\""
+               << ", \"msg\": \"" << IMC::Factory::getAbbrevFromId(cs.id) << "\""
+               << ", \"count\": " << cs.count
+               << ", \"time_ns\": " << cs.time_nsec
+               << "}";
+          }
+        }
+        os << "\n]};";
+
+        RequestHandler::HeaderFieldsMap hdr;
+        hdr["Content-Type"] = "text/javascript";
+        sendData(sock, os.str(), &hdr);
+      }
+
+      void
+      showTelemetry(TCPSocket* sock, TupleList& headers, const char* uri)
+      {
+        (void)headers;
+
+        RequestHandler::HeaderFieldsMap hdr;
+        hdr["Content-Type"] = "text/javascript";
+
+        std::string lname = String::getRemaining("/dune/telemetry/", uri);
+        std::ostringstream os;
+
+        if (lname == "list.js")
+        {
+          m_ctx.tstore.listJSON(os);
+          sendData(sock, os.str(), &hdr);
+          return;
+        }
+
+        // Window length in seconds may follow the message
+        // abbreviation (e.g. /dune/telemetry/EstimatedState.js/60).
+        double window = -1.0;
+        size_t slash = lname.find('/');
+        if (slash != std::string::npos)
+        {
+          window = std::atof(lname.substr(slash + 1).c_str());
+          lname = lname.substr(0, slash);
+        }
+
+        size_t ext = lname.rfind(".js");
+        if (ext != std::string::npos)
+          lname = lname.substr(0, ext);
+
+        uint16_t id = 0;
+        try
+        {
+          id = IMC::Factory::getIdFromAbbrev(lname);
+        }
+        catch (...)
+        {
+          sendResponse404(sock);
+          return;
+        }
+
+        double begin_time = -1.0;
+        if (window > 0)
+          begin_time = Clock::getSinceEpoch() - window;
+
+        m_ctx.tstore.queryJSON(os, id, begin_time, -1.0);
+        sendData(sock, os.str(), &hdr);
+      }
+
       void
       sendVersionJSON(TCPSocket* sock, TupleList& headers, const char* uri)
       {
@@ -210,6 +210,21 @@ namespace Transports
         }
       }
 
+      void
+      handleBundle(IridiumBundle* bundle)
+      {
+        debug("unpacking Iridium bundle with %u messages",
+              (unsigned)bundle->payloads.size());
+
+        for (size_t i = 0; i < bundle->payloads.size(); ++i)
+        {
+          IMC::IridiumMsgRx rx;
+          rx.setDestination(getSystemId());
+          rx.data.assign(bundle->payloads[i].begin(), bundle->payloads[i].end());
+          consume(&rx);
+        }
+      }
+
       void
       consume(const IMC::IridiumMsgRx* msg)
       {
@@ -247,6 +262,9 @@ namespace Transports
           case (ID_EXTDEVUPDATE):
             handleUpdates(static_cast<ExtendedDeviceUpdate *>(m)->positions);
             break;
+          case (ID_BUNDLE):
+            handleBundle(static_cast<IridiumBundle *>(m));
+            break;
           default:
             DUNE::IMC::ImcIridiumMessage * irMsg =
             static_cast<DUNE::IMC::ImcIridiumMessage *>(m);
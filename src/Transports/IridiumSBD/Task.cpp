@@ -32,6 +32,7 @@
 
 // DUNE headers.
 #include <DUNE/DUNE.hpp>
+#include <DUNE/IMC/IridiumMessageDefinitions.hpp>
 
 // Local headers.
 #include "Driver.hpp"
@@ -46,6 +47,25 @@ namespace Transports
 
     //! Power on delay.
     static const double c_pwr_on_delay = 5.0;
+    //! Maximum MO payload size.
+    static const unsigned c_mo_max_size = 340;
+
+    //! Spool table statement.
+    static const char* c_spool_table_stmt =
+    "create table if not exists Spool ("
+    "id integer primary key, "
+    "src integer not null, "
+    "eid integer not null, "
+    "req integer not null, "
+    "expiration real not null, "
+    "data blob not null)";
+    //! Spool insertion statement.
+    static const char* c_spool_insert_stmt = "insert into Spool values(?,?,?,?,?,?)";
+    //! Spool removal statement.
+    static const char* c_spool_delete_stmt = "delete from Spool where id=?";
+    //! Spool iteration statement.
+    static const char* c_spool_load_stmt =
+    "select id, src, eid, req, expiration, data from Spool order by expiration";
 
     //! %Task arguments.
     struct Arguments
@@ -58,6 +78,10 @@ namespace Transports
       double mbox_check_per;
       //! Maximum transmission rate.
       unsigned max_tx_rate;
+      //! True to keep pending requests in a persistent spool.
+      bool spool;
+      //! True to bundle pending requests into one session.
+      bool bundling;
     };
 
     struct Task: public DUNE::Tasks::Task
@@ -76,6 +100,16 @@ namespace Transports
       Arguments m_args;
       //! Active transmission request.
       TxRequest* m_tx_request;
+      //! Requests bundled with the active transmission request.
+      std::vector<TxRequest*> m_tx_bundle;
+      //! Spool database.
+      Database::Connection* m_db;
+      //! Spool insertion statement.
+      Database::Statement* m_spool_insert_stmt;
+      //! Spool removal statement.
+      Database::Statement* m_spool_delete_stmt;
+      //! Next spool entry identifier.
+      int m_spool_next_id;
 
       //! Constructor.
       //! @param[in] name task name.
@@ -84,7 +118,11 @@ namespace Transports
         DUNE::Tasks::Task(name, ctx),
         m_uart(NULL),
         m_driver(NULL),
-        m_tx_request(NULL)
+        m_tx_request(NULL),
+        m_db(NULL),
+        m_spool_insert_stmt(NULL),
+        m_spool_delete_stmt(NULL),
+        m_spool_next_id(1)
       {
         paramActive(Tasks::Parameter::SCOPE_GLOBAL,
                     Tasks::Parameter::VISIBILITY_USER);
@@ -110,6 +148,17 @@ namespace Transports
         .defaultValue("0")
         .description("");
 
+        param("Persistent Spool", m_args.spool)
+        .defaultValue("false")
+        .description("Keep pending transmission requests in a database"
+                     " so they survive restarts");
+
+        param("Bundle Transmissions", m_args.bundling)
+        .defaultValue("false")
+        .description("Pack several pending transmission requests into a"
+                     " single SBD session. Receivers must understand"
+                     " bundled payloads");
+
         bind<IMC::IridiumMsgTx>(this);
         bind<IMC::IoEvent>(this);
       }
@@ -119,6 +168,10 @@ namespace Transports
       {
         Memory::clear(m_tx_request);
 
+        for (size_t i = 0; i < m_tx_bundle.size(); ++i)
+          delete m_tx_bundle[i];
+        m_tx_bundle.clear();
+
         while (!m_tx_requests.empty())
         {
           TxRequest* req = m_tx_requests.front();
@@ -164,6 +217,7 @@ namespace Transports
       void
       onResourceInitialization(void)
       {
+        spoolOpen();
         setEntityState(IMC::EntityState::ESTA_NORMAL, Status::CODE_IDLE);
       }
 
@@ -192,6 +246,140 @@ namespace Transports
         }
 
         Memory::clear(m_uart);
+
+        if (m_db != NULL)
+        {
+          // Statements are owned by the connection's cache.
+          delete m_db;
+          m_db = NULL;
+          m_spool_insert_stmt = NULL;
+          m_spool_delete_stmt = NULL;
+        }
+      }
+
+      //! Open the persistent spool and restore queued requests.
+      void
+      spoolOpen(void)
+      {
+        if (!m_args.spool || m_db != NULL)
+          return;
+
+        Path db_file = m_ctx.dir_db / "IridiumSBD.db";
+        inf(DTR("spool database file: '%s'"), db_file.c_str());
+
+        m_db = new Database::Connection(db_file.c_str(), Database::Connection::CF_CREATE);
+        m_db->execute(c_spool_table_stmt);
+        m_spool_insert_stmt = m_db->prepared(c_spool_insert_stmt);
+        m_spool_delete_stmt = m_db->prepared(c_spool_delete_stmt);
+
+        // The spool is authoritative: drop in-memory copies of
+        // spooled requests before restoring, so a restart does not
+        // duplicate them.
+        std::list<TxRequest*>::iterator itr = m_tx_requests.begin();
+        while (itr != m_tx_requests.end())
+        {
+          if ((*itr)->getSpoolId() >= 0)
+          {
+            delete *itr;
+            itr = m_tx_requests.erase(itr);
+          }
+          else
+          {
+            ++itr;
+          }
+        }
+
+        unsigned count = 0;
+        std::vector<int> expired;
+        Database::Statement load(c_spool_load_stmt, *m_db);
+        while (load.execute())
+        {
+          int id = 0;
+          int src = 0;
+          int eid = 0;
+          int req = 0;
+          double expiration = 0;
+          Database::Blob data;
+          load >> id >> src >> eid >> req >> expiration >> data;
+
+          if (id >= m_spool_next_id)
+            m_spool_next_id = id + 1;
+
+          double ttl = expiration - Clock::getSinceEpoch();
+          if (ttl <= 0)
+          {
+            expired.push_back(id);
+            continue;
+          }
+
+          TxRequest* request = new TxRequest(src, eid, req, (unsigned)ttl, data);
+          request->setSpoolId(id);
+          enqueueTxRequest(request);
+          ++count;
+        }
+
+        for (size_t i = 0; i < expired.size(); ++i)
+        {
+          *m_spool_delete_stmt << expired[i];
+          m_spool_delete_stmt->execute();
+        }
+
+        if (count > 0)
+          inf(DTR("restored %u queued transmissions from spool"), count);
+      }
+
+      //! Insert a request into the persistent spool.
+      //! @param[in] request transmission request.
+      void
+      spoolInsert(TxRequest* request)
+      {
+        if (m_db == NULL)
+          return;
+
+        try
+        {
+          int id = m_spool_next_id++;
+          // Expiration is spooled as wall-clock time so the TTL
+          // keeps running while the system is powered off.
+          double expiration = Clock::getSinceEpoch()
+          + (request->getExpiration() - Clock::get());
+          const std::vector<uint8_t>& data = request->getData();
+          Database::Blob blob(data.begin(), data.end());
+
+          *m_spool_insert_stmt << id
+                               << (int)request->getSource()
+                               << (int)request->getSourceEntity()
+                               << (int)request->getId()
+                               << expiration
+                               << blob;
+          m_spool_insert_stmt->execute();
+          request->setSpoolId(id);
+        }
+        catch (std::runtime_error& e)
+        {
+          war(DTR("unable to spool request: %s"), e.what());
+        }
+      }
+
+      //! Remove a request from the persistent spool.
+      //! @param[in] request transmission request.
+      void
+      spoolRemove(TxRequest* request)
+      {
+        if (m_db == NULL || request->getSpoolId() < 0)
+          return;
+
+        try
+        {
+          *m_spool_delete_stmt << request->getSpoolId();
+          m_spool_delete_stmt->execute();
+        }
+        catch (std::runtime_error& e)
+        {
+          war(DTR("unable to remove spooled request: %s"), e.what());
+        }
+
+        request->setSpoolId(-1);
       }
 
       void
@@ -218,6 +406,7 @@ namespace Transports
         TxRequest* request = new TxRequest(src_adr, src_eid, msg->req_id,
                                            msg->ttl, msg->data);
 
+        spoolInsert(request);
         enqueueTxRequest(request);
         sendTxRequestStatus(request, IMC::IridiumTxStatus::TXSTATUS_QUEUED);
       }
@@ -263,8 +452,17 @@ namespace Transports
 
         debug("dequeing message");
         m_driver->clearBufferMO();
+        spoolRemove(m_tx_request);
         sendTxRequestStatus(m_tx_request, IMC::IridiumTxStatus::TXSTATUS_OK);
         Memory::clear(m_tx_request);
+
+        for (size_t i = 0; i < m_tx_bundle.size(); ++i)
+        {
+          spoolRemove(m_tx_bundle[i]);
+          sendTxRequestStatus(m_tx_bundle[i], IMC::IridiumTxStatus::TXSTATUS_OK);
+          delete m_tx_bundle[i];
+        }
+        m_tx_bundle.clear();
       }
 
       void
@@ -284,6 +482,11 @@ namespace Transports
 
         enqueueTxRequest(m_tx_request);
         m_tx_request = NULL;
+
+        // Bundled requests go back to the queue individually.
+        for (size_t i = 0; i < m_tx_bundle.size(); ++i)
+          enqueueTxRequest(m_tx_bundle[i]);
+        m_tx_bundle.clear();
       }
 
       void
@@ -338,6 +541,7 @@ namespace Transports
             break;
 
           spew("removing expired");
+          spoolRemove(*itr);
           sendTxRequestStatus(*itr, IMC::IridiumTxStatus::TXSTATUS_EXPIRED);
           delete *itr;
           itr = m_tx_requests.erase(itr);
@@ -368,7 +572,10 @@ namespace Transports
         {
           unsigned msn = m_driver->getMOMSN();
           m_tx_request->setMSN(msn);
-          m_driver->sendSBD(m_tx_request->getData());
+          if (m_tx_bundle.empty())
+            m_driver->sendSBD(m_tx_request->getData());
+          else
+            m_driver->sendSBD(buildBundle());
         }
         else if (m_tx_requests.empty())
         {
@@ -381,9 +588,54 @@ namespace Transports
         {
           m_tx_request = m_tx_requests.front();
           m_tx_requests.pop_front();
+          if (m_args.bundling)
+            bundleTxRequests();
         }
       }
 
+      //! Pull additional pending requests, in expiration order, into
+      //! the bundle of the active transmission request while the
+      //! resulting payload still fits one SBD session.
+      void
+      bundleTxRequests(void)
+      {
+        IMC::IridiumBundle bundle;
+        bundle.payloads.push_back(m_tx_request->getData());
+
+        while (!m_tx_requests.empty())
+        {
+          TxRequest* req = m_tx_requests.front();
+          bundle.payloads.push_back(req->getData());
+          if ((unsigned)bundle.getSerializationSize() > c_mo_max_size)
+            break;
+
+          m_tx_bundle.push_back(req);
+          m_tx_requests.pop_front();
+        }
+      }
+
+      //! Serialize the active transmission request and its bundled
+      //! requests into one SBD payload.
+      //! @return serialized bundle.
+      std::vector<uint8_t>
+      buildBundle(void)
+      {
+        IMC::IridiumBundle bundle;
+        bundle.source = getSystemId();
+        bundle.destination = 0xFFFF;
+        bundle.payloads.push_back(m_tx_request->getData());
+        for (size_t i = 0; i < m_tx_bundle.size(); ++i)
+          bundle.payloads.push_back(m_tx_bundle[i]->getData());
+
+        std::vector<uint8_t> data(bundle.getSerializationSize(), 0);
+        int len = bundle.serialize(&data[0]);
+        data.resize(len);
+
+        debug("bundled %u requests into %d bytes",
+              (unsigned)(m_tx_bundle.size() + 1), len);
+        return data;
+      }
+
       //! Main loop.
       void
       onMain(void)
@@ -52,7 +52,8 @@ namespace Transports
         m_src_adr(src_adr),
         m_src_eid(src_eid),
         m_req_id(req_id),
-        m_msn(-1)
+        m_msn(-1),
+        m_spool_id(-1)
       {
         m_expiration = DUNE::Time::Clock::get() + ttl;
         m_data.insert(m_data.end(), data.begin(), data.end());
@@ -135,6 +136,22 @@ namespace Transports
         return DUNE::Time::Clock::get() > getExpiration();
       }
 
+      //! Associate the request with a persistent spool entry.
+      //! @param[in] spool_id spool entry identifier.
+      void
+      setSpoolId(int spool_id)
+      {
+        m_spool_id = spool_id;
+      }
+
+      //! Retrieve the persistent spool entry identifier.
+      //! @return spool entry identifier, negative if not spooled.
+      int
+      getSpoolId(void) const
+      {
+        return m_spool_id;
+      }
+
     private:
       //! Requester IMC address.
       uint16_t m_src_adr;
@@ -144,6 +161,8 @@ namespace Transports
       uint16_t m_req_id;
       //! MO message sequence number.
       int m_msn;
+      //! Persistent spool entry identifier, negative if not spooled.
+      int m_spool_id;
       //! Expiration time.
       double m_expiration;
       //! Data to be transmitted.
@@ -0,0 +1,240 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+#ifndef TRANSPORTS_LOGGING_BULK_WRITER_HPP_INCLUDED_
+#define TRANSPORTS_LOGGING_BULK_WRITER_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// POSIX headers.
+#if defined(DUNE_SYS_HAS_UNISTD_H)
+#  include <unistd.h>
+#endif
+
+#if defined(DUNE_SYS_HAS_FCNTL_H)
+#  include <fcntl.h>
+#endif
+
+#if defined(DUNE_OS_LINUX) && defined(O_DIRECT)
+#  define TRANSPORTS_LOGGING_BULK_WRITER_ENABLED
+#endif
+
+namespace Transports
+{
+  namespace Logging
+  {
+    using DUNE_NAMESPACES;
+
+    //! Direct I/O writer for high-volume message streams.
+    //!
+    //! Data is gathered in a pooled block-aligned buffer and written
+    //! to a preallocated extent with O_DIRECT, bypassing the page
+    //! cache. This keeps bulk sonar data from sharing writeback with
+    //! the small-message log stream, whose periodic flushes would
+    //! otherwise stall behind it.
+    //!
+    //! Only available on Linux; the constructor throws elsewhere.
+    class BulkWriter
+    {
+    public:
+      //! Constructor: opens the output file and preallocates its
+      //! extent.
+      //! @param[in] file output file.
+      //! @param[in] capacity gather buffer capacity in bytes, rounded
+      //! up to a multiple of the block size.
+      //! @param[in] prealloc_mib extent to preallocate in MiB.
+      BulkWriter(const Path& file, size_t capacity, unsigned prealloc_mib):
+        m_fd(-1),
+        m_bfr(NULL),
+        m_size(0),
+        m_offset(0)
+      {
+        m_capacity = ((capacity + c_block_size - 1) / c_block_size) * c_block_size;
+        if (m_capacity == 0)
+          m_capacity = c_block_size;
+
+#if defined(TRANSPORTS_LOGGING_BULK_WRITER_ENABLED)
+        m_fd = ::open(file.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_DIRECT, 0644);
+        if (m_fd < 0)
+          throw System::Error(errno, DTR("failed to open bulk log"), file.str());
+
+        // Best effort: without the preallocated extent writes still
+        // work, they just pay for block allocation as they go.
+        if (prealloc_mib > 0)
+          posix_fallocate(m_fd, 0, (off_t)prealloc_mib * 1048576);
+
+        void* ptr = NULL;
+        if (posix_memalign(&ptr, c_block_size, m_capacity) != 0)
+        {
+          ::close(m_fd);
+          m_fd = -1;
+          throw std::bad_alloc();
+        }
+
+        m_bfr = (uint8_t*)ptr;
+#else
+        (void)file;
+        (void)prealloc_mib;
+        throw NotImplemented("direct I/O bulk logging");
+#endif
+      }
+
+      //! Destructor.
+      ~BulkWriter(void)
+      {
+        try
+        {
+          close();
+        }
+        catch (...)
+        { }
+
+        std::free(m_bfr);
+      }
+
+      //! Append data to the gather buffer, draining it to disk as it
+      //! fills.
+      //! @param[in] data data to append.
+      //! @param[in] size size of data in bytes.
+      void
+      append(const uint8_t* data, size_t size)
+      {
+        while (size > 0)
+        {
+          size_t amount = std::min(size, m_capacity - m_size);
+          std::memcpy(m_bfr + m_size, data, amount);
+          m_size += amount;
+          data += amount;
+          size -= amount;
+
+          if (m_size == m_capacity)
+            drain();
+        }
+      }
+
+      //! Write all complete blocks to disk. The sub-block tail stays
+      //! in the gather buffer: direct I/O cannot write less than one
+      //! block.
+      void
+      drain(void)
+      {
+        size_t aligned = (m_size / c_block_size) * c_block_size;
+        if (aligned == 0)
+          return;
+
+        writeBlocks(m_bfr, aligned);
+
+        m_size -= aligned;
+        if (m_size > 0)
+          std::memmove(m_bfr, m_bfr + aligned, m_size);
+      }
+
+      //! Write the remaining tail, trim the preallocated extent to
+      //! the data actually written and close the file.
+      void
+      close(void)
+      {
+#if defined(TRANSPORTS_LOGGING_BULK_WRITER_ENABLED)
+        if (m_fd < 0)
+          return;
+
+        drain();
+
+        // The tail and the trim use buffered I/O.
+        int flags = ::fcntl(m_fd, F_GETFL);
+        if (flags >= 0)
+          ::fcntl(m_fd, F_SETFL, flags & ~O_DIRECT);
+
+        if (m_size > 0)
+        {
+          if (::write(m_fd, m_bfr, m_size) == (ssize_t)m_size)
+            m_offset += m_size;
+          m_size = 0;
+        }
+
+        ftruncate(m_fd, m_offset);
+        ::close(m_fd);
+        m_fd = -1;
+#endif
+      }
+
+    private:
+      //! Direct I/O alignment granule.
+      static const size_t c_block_size = 4096;
+
+      //! File descriptor.
+      int m_fd;
+      //! Block-aligned gather buffer.
+      uint8_t* m_bfr;
+      //! Gather buffer capacity.
+      size_t m_capacity;
+      //! Bytes in the gather buffer.
+      size_t m_size;
+      //! Bytes written to disk.
+      uint64_t m_offset;
+
+      //! Write block-aligned data to disk.
+      //! @param[in] data data to write.
+      //! @param[in] size size of data, a multiple of the block size.
+      void
+      writeBlocks(const uint8_t* data, size_t size)
+      {
+#if defined(TRANSPORTS_LOGGING_BULK_WRITER_ENABLED)
+        size_t done = 0;
+        while (done < size)
+        {
+          ssize_t rv = ::write(m_fd, data + done, size - done);
+          if (rv < 0)
+          {
+            if (errno == EINTR)
+              continue;
+            throw System::Error(errno, DTR("failed to write bulk log"));
+          }
+
+          done += rv;
+        }
+
+        m_offset += size;
+#else
+        (void)data;
+        (void)size;
+#endif
+      }
+    };
+  }
+}
+
+#endif
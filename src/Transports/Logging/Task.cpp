@@ -30,6 +30,7 @@
 // ISO C++ 98 headers.
 #include <string>
 #include <vector>
+#include <set>
 #include <fstream>
 #include <algorithm>
 #include <cstddef>
@@ -37,6 +38,9 @@
 // DUNE headers.
 #include <DUNE/DUNE.hpp>
 
+// Local headers.
+#include "BulkWriter.hpp"
+
 namespace Transports
 {
   namespace Logging
@@ -58,9 +62,19 @@ namespace Transports
       unsigned lsf_volume_size;
       // Compression method.
       std::string lsf_compression;
+      // Write buffer capacity.
+      unsigned write_buffer_size;
+      // True to write the integrity sidecar.
+      bool integrity;
+      // List of messages logged through the bulk writer.
+      std::vector<std::string> bulk_messages;
+      // Bulk writer buffer capacity.
+      unsigned bulk_buffer_size;
+      // Bulk writer preallocated extent.
+      unsigned bulk_prealloc;
     };
 
-    struct Task: public Tasks::Task
+    struct Task: public Tasks::Task, public IMC::LogSink
     {
       // Timestamp of last flush.
       double m_last_flush;
@@ -74,10 +88,26 @@ namespace Transports
       Compression::Methods m_compression;
       // Output file stream for LSF/LSF_GZ formats.
       std::ostream* m_lsf;
+      // Integrity sidecar stream.
+      std::ofstream* m_chk;
+      // Offset of the next chunk in the uncompressed LSF stream.
+      uint64_t m_chk_offset;
       // Path to LSF file.
       Path m_lsf_file;
       // Serialization buffer.
       ByteBuffer m_buffer;
+      // Gather buffer: serialized messages are accumulated here and
+      // written to the output stream in large chunks.
+      ByteBuffer m_gather;
+      // Direct I/O writer for bulk messages.
+      BulkWriter* m_bulk;
+      // Lock guarding the bulk writer: producer tasks append
+      // through the log sink interface from their own threads.
+      Concurrency::Mutex m_bulk_mtx;
+      // Serialization buffer of the log sink path.
+      ByteBuffer m_sink_buffer;
+      // Identifiers of messages logged through the bulk writer.
+      std::set<uint32_t> m_bulk_ids;
       // Logging control message.
       IMC::LoggingControl m_log_ctl;
       // True if logging is enabled.
@@ -89,6 +119,9 @@ namespace Transports
         Tasks::Task(name, ctx),
         m_last_flush(0),
         m_lsf(NULL),
+        m_chk(NULL),
+        m_chk_offset(0),
+        m_bulk(NULL),
         m_active(true)
       {
         // Define configuration parameters.
@@ -108,6 +141,29 @@ namespace Transports
         param("LSF Volume Directories", m_args.lsf_volumes)
         .defaultValue("");
 
+        param("Write Buffer Capacity", m_args.write_buffer_size)
+        .units(Units::Byte)
+        .defaultValue("262144")
+        .description("Capacity of the preallocated write buffer; serialized messages are gathered and written to disk in chunks of up to this size");
+
+        param("Integrity Sidecar", m_args.integrity)
+        .defaultValue("true")
+        .description("Write per-chunk CRC-32 checksums to a sidecar file, allowing truncated or corrupted logs to be detected with dune-lsfcheck");
+
+        param("Bulk Messages", m_args.bulk_messages)
+        .defaultValue("")
+        .description("High-volume messages written to a separate file with direct I/O, isolating their writeback from the main log stream");
+
+        param("Bulk Buffer Capacity", m_args.bulk_buffer_size)
+        .units(Units::Byte)
+        .defaultValue("1048576")
+        .description("Capacity of the block aligned bulk gather buffer");
+
+        param("Bulk Preallocation", m_args.bulk_prealloc)
+        .units(Units::Mebibyte)
+        .defaultValue("256")
+        .description("Extent preallocated for the bulk file, trimmed to the written size when the log is closed");
+
         param("Transports", m_args.messages)
         .defaultValue("");
 
@@ -134,7 +190,31 @@ namespace Transports
       void
       onResourceRelease(void)
       {
+        // After this call no producer is inside the sink.
+        m_ctx.lsink.unregisterSink(this);
+
+        writeBuffered();
         Memory::clear(m_lsf);
+        Memory::clear(m_chk);
+
+        ScopedMutex l(m_bulk_mtx);
+        Memory::clear(m_bulk);
+      }
+
+      bool
+      logBulk(const IMC::Message& msg)
+      {
+        ScopedMutex l(m_bulk_mtx);
+
+        if (m_bulk == NULL || !m_active)
+          return false;
+
+        if (m_bulk_ids.find(msg.getId()) == m_bulk_ids.end())
+          return false;
+
+        IMC::Packet::serialize(&msg, m_sink_buffer);
+        m_bulk->append(m_sink_buffer.getBuffer(), m_sink_buffer.getSize());
+        return true;
       }
 
       void
@@ -144,7 +224,35 @@ namespace Transports
         if (m_args.lsf_volumes.empty())
           m_args.lsf_volumes.push_back("");
 
+        // Preallocate the gather buffer.
+        m_gather.grow(m_args.write_buffer_size);
+
         bind(this, m_args.messages);
+
+        // Bulk messages not in the main transport list still need a
+        // consumer of their own.
+        m_bulk_ids.clear();
+        std::vector<std::string> extra;
+        for (size_t i = 0; i < m_args.bulk_messages.size(); ++i)
+        {
+          const std::string& name = m_args.bulk_messages[i];
+
+          try
+          {
+            m_bulk_ids.insert(IMC::Factory::getIdFromAbbrev(name));
+          }
+          catch (...)
+          {
+            war(DTR("invalid bulk message name: %s"), name.c_str());
+            continue;
+          }
+
+          if (std::find(m_args.messages.begin(), m_args.messages.end(), name) == m_args.messages.end())
+            extra.push_back(name);
+        }
+
+        if (!extra.empty())
+          bind(this, extra);
       }
 
       void
@@ -288,11 +396,14 @@ namespace Transports
         if (!ifs.is_open())
           return;
 
+        // Keep the stream ordered with respect to gathered messages.
+        writeBuffered();
+
         char bfr[16 * 1024];
         while (!ifs.eof())
         {
           ifs.read(bfr, sizeof(bfr));
-          m_lsf->write(bfr, ifs.gcount());
+          writeChunk(bfr, ifs.gcount());
         }
       }
 
@@ -355,6 +466,38 @@ namespace Transports
         else
           m_lsf = new Compression::FileOutput(m_lsf_file.c_str(), m_compression);
 
+        m_chk_offset = 0;
+        if (m_args.integrity)
+        {
+          Path chk_file = m_lsf_file + ".chk";
+          m_chk = new std::ofstream(chk_file.c_str());
+          *m_chk << "LSFCHK 1\n";
+        }
+
+        // The bulk stream is never compressed: it exists to move
+        // bytes to disk with as little CPU and writeback as possible.
+        if (!m_bulk_ids.empty())
+        {
+          try
+          {
+            BulkWriter* bulk = new BulkWriter(m_dir / "DataBulk.lsf",
+                                              m_args.bulk_buffer_size,
+                                              m_args.bulk_prealloc);
+            {
+              ScopedMutex l(m_bulk_mtx);
+              m_bulk = bulk;
+            }
+
+            // Accept declared bulk messages straight from producer
+            // tasks (DF_BULK dispatches), bypassing the bus.
+            m_ctx.lsink.registerSink(this);
+          }
+          catch (std::exception& e)
+          {
+            war(DTR("bulk writer disabled: %s"), e.what());
+          }
+        }
+
         // Log LoggingControl to facilitate posterior conversion to LLF.
         m_log_ctl.op = IMC::LoggingControl::COP_STARTED;
         m_log_ctl.name = m_ctx.dir_log.suffix(m_dir);
@@ -390,7 +533,16 @@ namespace Transports
         int64_t mib = Path(m_lsf_file).size();
         mib /= c_bytes_per_mib;
 
+        writeBuffered();
         m_lsf->flush();
+        if (m_chk != NULL)
+          m_chk->flush();
+
+        {
+          ScopedMutex l(m_bulk_mtx);
+          if (m_bulk != NULL)
+            m_bulk->drain();
+        }
 
         if ((m_args.lsf_volume_size > 0) && (mib >= m_args.lsf_volume_size))
           tryStartLog(m_label);
@@ -418,6 +570,38 @@ namespace Transports
         }
       }
 
+      //! Write a chunk to the LSF stream, recording its offset,
+      //! length and CRC-32 in the integrity sidecar. Offsets refer to
+      //! the uncompressed LSF stream.
+      void
+      writeChunk(const char* data, std::streamsize size)
+      {
+        if (size <= 0)
+          return;
+
+        m_lsf->write(data, size);
+
+        if (m_chk != NULL)
+        {
+          uint32_t crc = CRC32::compute((const uint8_t*)data, (size_t)size);
+          *m_chk << m_chk_offset << ' ' << size << ' '
+                 << std::hex << crc << std::dec << '\n';
+          m_chk_offset += size;
+        }
+      }
+
+      //! Write the contents of the gather buffer to the output
+      //! stream in a single operation.
+      void
+      writeBuffered(void)
+      {
+        if (m_lsf == NULL || m_gather.getSize() == 0)
+          return;
+
+        writeChunk(m_gather.getBufferSigned(), m_gather.getSize());
+        m_gather.setSize(0);
+      }
+
       void
       logMessage(const IMC::Message* msg)
       {
@@ -425,7 +609,21 @@ namespace Transports
           return;
 
         IMC::Packet::serialize(msg, m_buffer);
-        m_lsf->write(m_buffer.getBufferSigned(), m_buffer.getSize());
+
+        if (m_bulk_ids.find(msg->getId()) != m_bulk_ids.end())
+        {
+          ScopedMutex l(m_bulk_mtx);
+          if (m_bulk != NULL)
+          {
+            m_bulk->append(m_buffer.getBuffer(), m_buffer.getSize());
+            return;
+          }
+        }
+
+        if (m_gather.getSize() + m_buffer.getSize() > m_args.write_buffer_size)
+          writeBuffered();
+
+        m_gather.append(m_buffer.getBuffer(), m_buffer.getSize());
       }
 
       void
@@ -48,6 +48,8 @@ namespace Transports
       std::string lsf_name;
       //! Log file folder.
       std::string log_folder;
+      //! True to suppress duplicate samples.
+      bool dedup;
     };
 
     struct Task: public DUNE::Tasks::Task
@@ -56,6 +58,8 @@ namespace Transports
       Compression::FileOutput* m_log;
       //! Map of messages.
       std::map<uint32_t, IMC::Message*> m_messages;
+      //! Last sample written to the log, by key.
+      std::map<uint32_t, IMC::Message*> m_logged;
       //! Sampling timer.
       Counter<double> m_sample_timer;
       //! Flush timer.
@@ -92,6 +96,10 @@ namespace Transports
         param("Transports", m_args.messages)
         .defaultValue("");
 
+        param("Duplicate Suppression", m_args.dedup)
+        .defaultValue("true")
+        .description("Do not log a sample whose fields are identical to the last one written for the same message/entity");
+
         bind<IMC::LoggingControl>(this);
         bind<IMC::EntityInfo>(this);
       }
@@ -107,6 +115,16 @@ namespace Transports
         m_messages.clear();
       }
 
+      void
+      clearLogged(void)
+      {
+        std::map<uint32_t, IMC::Message*>::iterator itr = m_logged.begin();
+        for (; itr != m_logged.end(); ++itr)
+          delete itr->second;
+
+        m_logged.clear();
+      }
+
       void
       onResourceInitialization(void)
       {
@@ -179,6 +197,9 @@ namespace Transports
       stopLog(void)
       {
         Memory::clear(m_log);
+        // Each log must carry the first sample of every key, so the
+        // suppression state does not outlive the log.
+        clearLogged();
       }
 
       void
@@ -244,8 +265,30 @@ namespace Transports
         std::map<uint32_t, IMC::Message*>::iterator itr = m_messages.begin();
         for (; itr != m_messages.end(); ++itr)
         {
-          logMessage(itr->second);
-          delete itr->second;
+          if (m_args.dedup)
+          {
+            std::map<uint32_t, IMC::Message*>::iterator old = m_logged.find(itr->first);
+            if (old != m_logged.end() && itr->second->fieldsEqual(*old->second))
+            {
+              // Same fields as the last sample written for this key:
+              // only the timestamp would change.
+              delete itr->second;
+              continue;
+            }
+
+            logMessage(itr->second);
+
+            // Written samples become the reference for suppression.
+            if (old != m_logged.end())
+              delete old->second;
+
+            m_logged[itr->first] = itr->second;
+          }
+          else
+          {
+            logMessage(itr->second);
+            delete itr->second;
+          }
         }
 
         m_messages.clear();
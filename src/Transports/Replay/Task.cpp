@@ -28,10 +28,12 @@
 //***************************************************************************
 
 // ISO C++ 98 headers.
+#include <algorithm>
 #include <string>
 #include <vector>
 #include <map>
 #include <fstream>
+#include <iomanip>
 
 // DUNE headers.
 #include <DUNE/DUNE.hpp>
@@ -47,6 +49,8 @@ namespace Transports
       std::string startup_file;
       std::vector<std::string> msgs;
       std::vector<std::string> ents;
+      double speed;
+      double skip;
     };
 
     static const int c_stats_period = 10;
@@ -69,9 +73,17 @@ namespace Transports
 
       double m_ts_delta;
       double m_start_time;
+      // Original time stamp of the first message in the log.
+      double m_log_start;
+      // Original time stamp where dispatching starts (after skip).
+      double m_replay_base;
 
-      // Replay file handle
+      // Replay file handle (compressed logs).
       std::istream* m_is;
+      // Memory-mapped reader (uncompressed logs).
+      IMC::LSFReader* m_reader;
+      // Message read ahead of the cursor during fast-forward.
+      IMC::Message* m_pending;
       // last state from replay file
       IMC::EstimatedState m_estate;
 
@@ -96,12 +108,28 @@ namespace Transports
 
       Task(const std::string& name, Tasks::Context& ctx):
         Tasks::Task(name, ctx),
-        m_is(0)
+        m_is(0),
+        m_reader(0),
+        m_pending(0)
       {
         param("Load At Start", m_args.startup_file)
         .defaultValue("")
         .description("File to load for replay at startup");
 
+        param("Speed Multiplier", m_args.speed)
+        .defaultValue("1.0")
+        .description("Replay speed multiplier (1.0 = real time, 0 = as fast"
+                     " as possible). Only bus delivery pacing is scaled:"
+                     " message time stamps keep their original spacing, so"
+                     " at multipliers above one they run ahead of the wall"
+                     " clock");
+
+        param("Skip To Time", m_args.skip)
+        .defaultValue("0.0")
+        .description("Seconds from the start of the log to skip before"
+                     " dispatching. Uncompressed logs seek using the LSF"
+                     " index sidecar; compressed logs are scanned");
+
         param("Replay Messages", m_args.msgs)
         .defaultValue("")
         .description("Messages to replay");
@@ -211,13 +239,19 @@ namespace Transports
         {
           Compression::Methods method = Compression::Factory::detect(file.c_str());
           if (method == Compression::METHOD_UNKNOWN)
-            m_is = new std::ifstream(file.c_str(), std::ios::binary);
+          {
+            m_reader = new IMC::LSFReader;
+            m_reader->open(file);
+          }
           else
+          {
             m_is = new Compression::FileInput(file.c_str(), method);
+          }
         }
         catch (std::exception& e)
         {
           err("%s '%s': %s", DTR("could not open"), file.c_str(), e.what());
+          reset();
           return;
         }
 
@@ -225,7 +259,7 @@ namespace Transports
 
         try
         {
-          m = IMC::Packet::deserialize(*m_is);
+          m = readMessage();
         }
         catch (std::exception& e)
         {
@@ -251,7 +285,7 @@ namespace Transports
 
         IMC::LoggingControl* lc = static_cast<IMC::LoggingControl*>(m);
 
-        m_ts_delta = lc->getTimeStamp();
+        m_log_start = lc->getTimeStamp();
 
         size_t spos = lc->name.find_last_of('/');
         if (spos != std::string::npos)
@@ -261,16 +295,116 @@ namespace Transports
         lc->op = IMC::LoggingControl::COP_REQUEST_START;
         dispatch(lc); // change log (if Logging task happens to be active)
 
-        m_ts_delta = lc->getTimeStamp() - m_ts_delta;
+        m_replay_base = m_log_start + std::max(m_args.skip, 0.0);
+        m_ts_delta = lc->getTimeStamp() - m_replay_base;
         m_start_time = lc->getTimeStamp();
         m_next_stats = m_start_time + c_stats_period;
         delete m;
 
+        if (m_args.skip > 0)
+          fastForward(m_replay_base);
+
         requestActivation();
 
         war("%s '%s'", DTR("started replay of"), file.c_str());
       }
 
+      IMC::Message*
+      readMessage(void)
+      {
+        if (m_pending)
+        {
+          IMC::Message* m = m_pending;
+          m_pending = 0;
+          return m;
+        }
+
+        if (m_reader)
+          return m_reader->next();
+
+        IMC::Message* m = DUNE::IMC::Packet::deserialize(*m_is);
+
+        if (m_is->eof())
+        {
+          delete m;
+          return 0;
+        }
+
+        return m;
+      }
+
+      void
+      updateEntityMap(const IMC::EntityInfo* ei)
+      {
+        Name2Eid::iterator itr = m_name2eid.find(ei->label);
+
+        if (itr != m_name2eid.end())
+        {
+          m_eid2eid[ei->id] = itr->second;
+
+          trace("entity %s %d --> %d", ei->label.c_str(), (int)ei->id, (int)itr->second);
+        }
+      }
+
+      void
+      fastForward(double target)
+      {
+        uint64_t count = 0;
+
+        if (m_reader)
+        {
+          // Resolve the destination with the index, then walk the
+          // skipped region reading only headers, deserializing just
+          // the EntityInfo records needed for entity mapping.
+          uint64_t resume = m_reader->getOffset();
+          m_reader->seekTime(target);
+          uint64_t stop = m_reader->getOffset();
+          m_reader->seekOffset(resume);
+
+          IMC::Header hdr;
+          while (m_reader->getOffset() < stop && m_reader->peek(hdr))
+          {
+            if (hdr.mgid == DUNE_IMC_ENTITYINFO)
+            {
+              IMC::Message* m = m_reader->next();
+              if (!m)
+                break;
+
+              updateEntityMap(static_cast<IMC::EntityInfo*>(m));
+              delete m;
+            }
+            else if (!m_reader->skip())
+            {
+              break;
+            }
+
+            ++count;
+          }
+        }
+        else
+        {
+          // Compressed input cannot seek: deserialize and discard,
+          // holding back the first message at or after the target.
+          IMC::Message* m;
+          while ((m = readMessage()) != 0)
+          {
+            if (m->getTimeStamp() >= target)
+            {
+              m_pending = m;
+              break;
+            }
+
+            if (m->getId() == DUNE_IMC_ENTITYINFO)
+              updateEntityMap(static_cast<IMC::EntityInfo*>(m));
+
+            delete m;
+            ++count;
+          }
+        }
+
+        debug("skipped %llu messages", (long long unsigned)count);
+      }
+
       void
       stopReplay(void)
       {
@@ -321,6 +455,19 @@ namespace Transports
           delete m_is;
           m_is = 0;
         }
+
+        if (m_reader)
+        {
+          delete m_reader;
+          m_reader = 0;
+        }
+
+        if (m_pending)
+        {
+          delete m_pending;
+          m_pending = 0;
+        }
+
         m_eid2eid.clear();
         m_name2eid.clear();
         m_eid2name.clear();
@@ -349,7 +496,7 @@ namespace Transports
 
           IMC::Message* m = 0;
 
-          while (!stopping() && (m = DUNE::IMC::Packet::deserialize(*m_is)) != 0 && !m_is->eof())
+          while (!stopping() && (m = readMessage()) != 0)
           {
             consumeMessages();
 
@@ -360,15 +507,7 @@ namespace Transports
             else if (m->getId() == DUNE_IMC_ENTITYINFO)
             {
               // Update entity id map
-              IMC::EntityInfo* ei = static_cast<IMC::EntityInfo*>(m);
-              Name2Eid::iterator itr = m_name2eid.find(ei->label);
-
-              if (itr != m_name2eid.end())
-              {
-                m_eid2eid[ei->id] = itr->second;
-
-                trace("entity %s %d --> %d", ei->label.c_str(), (int)ei->id, (int)itr->second);
-              }
+              updateEntityMap(static_cast<IMC::EntityInfo*>(m));
             }
 
             m->setSourceEntity(mapEntity(m->getSourceEntity()));
@@ -388,7 +527,12 @@ namespace Transports
 
               // Wait till the time is right
               double now = Clock::getSinceEpoch();
-              double delta = new_ts - now;
+              double delta;
+
+              if (m_args.speed > 0)
+                delta = m_start_time + (original_ts - m_replay_base) / m_args.speed - now;
+              else
+                delta = 0;
 
               double delay;
 
@@ -397,7 +541,7 @@ namespace Transports
                 // Delay::wait does not behave satisfactorily otherwise
                 // in some systems
                 Delay::wait(delta);
-                delay = Clock::getSinceEpoch() - new_ts;
+                delay = Clock::getSinceEpoch() - (now + delta);
               }
               else
               {
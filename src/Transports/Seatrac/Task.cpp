@@ -109,6 +109,8 @@ namespace Transports
       DataSeatrac m_data_beacon;
       //! Time of last serial port input.
       double m_last_input;
+      //! Arrival time of the frame being parsed.
+      double m_frame_ts;
       //! Timer to manage the fragmentation of OWAY messages. 
       Time::Counter<double> m_oway_timer;
       //! Map of seatrac modems by name.
@@ -127,7 +129,8 @@ namespace Transports
         DUNE::Tasks::Task(name, ctx),
         m_handle(NULL),
         m_stop_comms(false),
-        m_usbl_receiver(false)
+        m_usbl_receiver(false),
+        m_frame_ts(-1.0)
       {
         // Define configuration parameters.
         paramActive(Tasks::Parameter::SCOPE_MANEUVER,
@@ -191,16 +194,22 @@ namespace Transports
       processSentence(void)
       {
         bool msg_validity = false;
-        uint16_t crc, crc2;
-        if(m_data.size() >= MIN_MESSAGE_LENGTH)
-        {
-          std::string msg = String::fromHex(m_data.substr((m_data.size() - 4), 4));
-          std::memcpy(&crc2, msg.data(), 2);
-          m_datahex = String::fromHex(m_data.erase((m_data.size() - 4), 4));
-          crc = CRC16::compute((uint8_t*) m_datahex.data(), m_datahex.size(),0);
-          if (crc == crc2)
-            msg_validity = true;
-          else
+        if (m_data.size() >= MIN_MESSAGE_LENGTH)
+        {
+          // Decode the whole sentence in one pass: the last two bytes
+          // hold the CRC of the preceding payload.
+          m_datahex = String::fromHex(m_data);
+          if (m_datahex.size() > 2)
+          {
+            uint16_t crc2;
+            std::memcpy(&crc2, m_datahex.data() + m_datahex.size() - 2, 2);
+            m_datahex.resize(m_datahex.size() - 2);
+            uint16_t crc = CRC16::compute((const uint8_t*)m_datahex.data(), m_datahex.size(), 0);
+            if (crc == crc2)
+              msg_validity = true;
+          }
+
+          if (!msg_validity)
             war("%s", DTR(Status::getString(Status::CODE_INVALID_CHECKSUM)));
         }
         return msg_validity;
@@ -255,7 +264,12 @@ namespace Transports
             else
             {
               if (bfr[i] == c_preamble)
+              {
+                // Stamp the frame when its preamble arrives, not when
+                // it is fully parsed.
+                m_frame_ts = m_handle->getReceiveTimestamp();
                 m_data.clear();
+              }
               else if (bfr[i] != '\r')
                 m_data.push_back(bfr[i]);
             }
@@ -513,10 +527,28 @@ namespace Transports
           msg.flags |= IMC::UamRxFrame::URF_PROMISCUOUS;
 
         msg.flags |= IMC::UamRxFrame::URF_DELAYED;
-        dispatch(msg);
+        dispatchFix(msg);
         handleAcousticInformation(m_data_beacon.cid_dat_receive_msg.aco_fix);
       }
 
+      //! Dispatch a message stamped with the arrival time of the
+      //! frame that produced it, so consumers see the time of the
+      //! acoustic event instead of the time the fields were parsed.
+      //! @param[in] msg message to dispatch.
+      void
+      dispatchFix(IMC::Message& msg)
+      {
+        if (m_frame_ts > 0.0)
+        {
+          msg.setTimeStamp(m_frame_ts);
+          dispatch(msg, DF_KEEP_TIME);
+        }
+        else
+        {
+          dispatch(msg);
+        }
+      }
+
       //! Handle acoustic information from received data.
       //! param[in] aco_fix Acoustic information field of the received message.
       void
@@ -545,7 +577,7 @@ namespace Transports
               range.seq = m_ticket->seq;
 
             range.value = range_dist;
-            dispatch(range);
+            dispatchFix(range);
           }
         }
 
@@ -561,7 +593,7 @@ namespace Transports
           usblPosition.n = aco_fix.position_northing / 10.0;
           usblPosition.d = aco_fix.position_depth / 10.0;
 
-          dispatch(usblPosition);
+          dispatchFix(usblPosition);
         }
         else // Mimics Evologic: Only if position is not computed, compute angles.
         {
@@ -578,7 +610,7 @@ namespace Transports
             usblAnglesMsg.theta = Angles::radians(aco_fix.attitude_pitch / 10.0);
             usblAnglesMsg.psi = Angles::radians(aco_fix.attitude_yaw / 10.0);
 
-            dispatch(usblAnglesMsg);
+            dispatchFix(usblAnglesMsg);
           }
         }
       }
@@ -88,6 +88,12 @@ namespace Transports
         onResourceRelease();
       }
 
+      IO::Handle*
+      getIOHandle(void)
+      {
+        return m_uart;
+      }
+
       void
       onDataTransmission(const uint8_t* p, unsigned int n)
       {
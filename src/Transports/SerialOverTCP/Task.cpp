@@ -28,9 +28,11 @@
 //***************************************************************************
 
 // ISO C++ 98 headers.
+#include <algorithm>
 #include <string>
 #include <list>
 #include <memory>
+#include <vector>
 
 // DUNE headers.
 #include <DUNE/DUNE.hpp>
@@ -41,6 +43,11 @@ namespace Transports
   {
     using DUNE_NAMESPACES;
 
+    //! Maximum number of bytes held while clients lag behind. Beyond
+    //! this limit the serial port is no longer drained and the
+    //! device's own flow control takes over.
+    static const size_t c_hold_max = 16384;
+
     struct Arguments
     {
       // Serial port device.
@@ -49,6 +56,10 @@ namespace Transports
       unsigned uart_baud;
       // TCP listening port.
       unsigned tcp_port;
+      // Flush threshold in bytes.
+      unsigned flush_size;
+      // Maximum time a byte is held before flushing.
+      double flush_timeout;
     };
 
     struct Task: public DUNE::Tasks::Task
@@ -63,11 +74,25 @@ namespace Transports
       Poll m_poll;
       // Clients.
       std::list<TCPSocket*> m_clients;
+      //! Bytes read from the serial port, waiting to be flushed.
+      std::vector<char> m_hold;
+      //! Time at which the held bytes must be flushed.
+      double m_deadline;
+      //! Smoothed time taken to write one flush to all clients.
+      double m_rtt;
+      //! True while the serial port is not being drained.
+      bool m_backpressure;
+      //! Entity state report timer.
+      Counter<double> m_report_timer;
 
       Task(const std::string& name, Tasks::Context& ctx):
         Tasks::Task(name, ctx),
         m_sock(NULL),
-        m_uart(NULL)
+        m_uart(NULL),
+        m_deadline(-1),
+        m_rtt(-1),
+        m_backpressure(false),
+        m_report_timer(1.0)
       {
         // Define configuration parameters.
         param("Serial Port - Device", m_args.uart_dev)
@@ -81,6 +106,20 @@ namespace Transports
         param("TCP - Port", m_args.tcp_port)
         .defaultValue("9999")
         .description("TCP port to listen on");
+
+        param("Flush Size", m_args.flush_size)
+        .defaultValue("256")
+        .minimumValue("1")
+        .description("Number of buffered serial bytes that triggers an"
+                     " immediate flush to the TCP clients");
+
+        param("Flush Timeout", m_args.flush_timeout)
+        .units(Units::Second)
+        .defaultValue("0.02")
+        .minimumValue("0.0")
+        .description("Maximum time a serial byte is held waiting for more"
+                     " data before being flushed, bounding the forwarding"
+                     " latency. Zero disables coalescing");
       }
 
       ~Task(void)
@@ -218,6 +257,18 @@ namespace Transports
       {
         if (m_poll.wasTriggered(*m_uart))
         {
+          // Clients are lagging: leave the bytes in the driver so the
+          // device's flow control throttles the sender.
+          if (m_hold.size() >= c_hold_max)
+          {
+            if (!m_backpressure)
+            {
+              war(DTR("clients are lagging, throttling serial reader"));
+              m_backpressure = true;
+            }
+            return;
+          }
+
           char bfr[1024];
           int rv = 0;
 
@@ -226,21 +277,73 @@ namespace Transports
           else
             debug("None character read from uart!");
 
-          dispatchToClients(bfr, rv);
+          if (rv > 0)
+          {
+            if (m_hold.empty())
+              m_deadline = Clock::get() + m_args.flush_timeout;
+            m_hold.insert(m_hold.end(), bfr, bfr + rv);
+          }
         }
       }
 
+      //! Flush held serial bytes to the clients once enough data
+      //! accumulated or the latency bound expired, whichever comes
+      //! first. The time one flush takes to reach all clients is
+      //! smoothed into the round-trip estimate.
+      void
+      flush(void)
+      {
+        if (m_hold.empty())
+          return;
+
+        if (m_hold.size() < m_args.flush_size && Clock::get() < m_deadline)
+          return;
+
+        double start = Clock::get();
+        dispatchToClients(&m_hold[0], m_hold.size());
+        double delta = Clock::get() - start;
+
+        m_rtt = (m_rtt < 0) ? delta : (0.9 * m_rtt + 0.1 * delta);
+        m_hold.clear();
+        m_backpressure = false;
+      }
+
+      //! Report the smoothed client write latency in the entity state.
+      void
+      reportLatency(void)
+      {
+        if (!m_report_timer.overflow())
+          return;
+
+        m_report_timer.reset();
+
+        if (m_rtt < 0)
+          return;
+
+        setEntityState(IMC::EntityState::ESTA_NORMAL,
+                       String::str(DTR("active | write latency %0.1f ms"),
+                                   m_rtt * 1000.0));
+      }
+
       void
       onMain(void)
       {
         while (!stopping())
         {
-          if (m_poll.poll(1.0))
+          // While data is held, wake up in time to honour the bound.
+          double timeout = 1.0;
+          if (!m_hold.empty())
+            timeout = std::max(m_deadline - Clock::get(), 0.0);
+
+          if (m_poll.poll(timeout))
           {
             checkSerialPort();
             checkMainSocket();
             checkClientSockets();
           }
+
+          flush();
+          reportLatency();
         }
       }
     };
@@ -0,0 +1,204 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+#ifndef TRANSPORTS_SHARED_MEMORY_RING_HPP_INCLUDED_
+#define TRANSPORTS_SHARED_MEMORY_RING_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <cstring>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Check if we can use GCC's atomic functions.
+#if defined(DUNE_SYS_HAS___SYNC_ADD_AND_FETCH) && defined(DUNE_SYS_HAS___SYNC_SUB_AND_FETCH)
+#  define TRANSPORTS_SHARED_MEMORY_RING_BARRIER __sync_synchronize()
+#else
+#  define TRANSPORTS_SHARED_MEMORY_RING_BARRIER
+#endif
+
+namespace Transports
+{
+  namespace SharedMemory
+  {
+    //! Single-producer/single-consumer ring of length-prefixed
+    //! records over a raw memory area shared by two processes. The
+    //! transmitting process advances the write index, the receiving
+    //! process advances the read index; each index is written by
+    //! exactly one side, so no locks are needed, only store ordering.
+    class Ring
+    {
+    public:
+      //! Size of the control header stored at the start of the area.
+      static const unsigned c_header_size = 16;
+
+      //! Constructor.
+      //! @param[in] mem shared memory area.
+      //! @param[in] mem_size size of the shared memory area.
+      Ring(void* mem, unsigned mem_size):
+        m_ctl((Control*)mem),
+        m_data((uint8_t*)mem + c_header_size),
+        m_size(mem_size - c_header_size)
+      { }
+
+      //! Initialize the control header. Must be called once, by the
+      //! transmitting side, before any traffic.
+      void
+      initialize(void)
+      {
+        m_ctl->widx = 0;
+        m_ctl->ridx = 0;
+        m_ctl->size = m_size;
+        TRANSPORTS_SHARED_MEMORY_RING_BARRIER;
+        m_ctl->magic = c_magic;
+      }
+
+      //! Check if the control header was initialized by a
+      //! transmitter with a matching layout.
+      //! @return true if the ring is valid, false otherwise.
+      bool
+      isValid(void) const
+      {
+        return m_ctl->magic == c_magic && m_ctl->size == m_size;
+      }
+
+      //! Write one record. Called only by the transmitting process.
+      //! @param[in] data record contents.
+      //! @param[in] data_len record length.
+      //! @return true if the record was written, false if the ring
+      //! is full.
+      bool
+      write(const uint8_t* data, uint16_t data_len)
+      {
+        uint32_t widx = m_ctl->widx;
+        uint32_t free_space = (m_ctl->ridx + m_size - widx - 1) % m_size;
+        uint32_t need = 2 + (uint32_t)data_len;
+
+        if (need > free_space)
+          return false;
+
+        uint8_t len[2] = {(uint8_t)(data_len & 0xff), (uint8_t)(data_len >> 8)};
+        copyIn((widx + 0) % m_size, len, 2);
+        copyIn((widx + 2) % m_size, data, data_len);
+
+        // Publish the record only after its bytes are visible.
+        TRANSPORTS_SHARED_MEMORY_RING_BARRIER;
+        m_ctl->widx = (widx + need) % m_size;
+        return true;
+      }
+
+      //! Read one record. Called only by the receiving process.
+      //! @param[out] bfr destination buffer.
+      //! @param[in] bfr_len destination buffer capacity.
+      //! @return record length, or 0 if the ring is empty or the
+      //! record does not fit the buffer.
+      uint16_t
+      read(uint8_t* bfr, unsigned bfr_len)
+      {
+        uint32_t ridx = m_ctl->ridx;
+
+        if (ridx == m_ctl->widx)
+          return 0;
+
+        TRANSPORTS_SHARED_MEMORY_RING_BARRIER;
+
+        uint8_t len[2];
+        copyOut(len, ridx, 2);
+        uint16_t data_len = len[0] | (len[1] << 8);
+
+        if (data_len > bfr_len)
+        {
+          // Corrupt or oversized record: drop it.
+          m_ctl->ridx = (ridx + 2 + data_len) % m_size;
+          return 0;
+        }
+
+        copyOut(bfr, (ridx + 2) % m_size, data_len);
+        m_ctl->ridx = (ridx + 2 + data_len) % m_size;
+        return data_len;
+      }
+
+    private:
+      //! Control header layout.
+      struct Control
+      {
+        //! Magic number (c_magic once initialized).
+        volatile uint32_t magic;
+        //! Ring data size.
+        volatile uint32_t size;
+        //! Write index, owned by the transmitter.
+        volatile uint32_t widx;
+        //! Read index, owned by the receiver.
+        volatile uint32_t ridx;
+      };
+
+      //! Magic number marking an initialized ring.
+      static const uint32_t c_magic = 0x52494d43;
+
+      //! Control header.
+      Control* m_ctl;
+      //! Ring data area.
+      uint8_t* m_data;
+      //! Ring data size.
+      uint32_t m_size;
+
+      //! Copy data into the ring, wrapping around the end.
+      //! @param[in] off ring offset.
+      //! @param[in] data source data.
+      //! @param[in] data_len amount of data to copy.
+      void
+      copyIn(uint32_t off, const uint8_t* data, uint32_t data_len)
+      {
+        uint32_t run = m_size - off;
+        if (run > data_len)
+          run = data_len;
+
+        std::memcpy(m_data + off, data, run);
+        std::memcpy(m_data, data + run, data_len - run);
+      }
+
+      //! Copy data out of the ring, wrapping around the end.
+      //! @param[out] bfr destination buffer.
+      //! @param[in] off ring offset.
+      //! @param[in] data_len amount of data to copy.
+      void
+      copyOut(uint8_t* bfr, uint32_t off, uint32_t data_len)
+      {
+        uint32_t run = m_size - off;
+        if (run > data_len)
+          run = data_len;
+
+        std::memcpy(bfr, m_data + off, run);
+        std::memcpy(bfr + run, m_data, data_len - run);
+      }
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,273 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+// ISO C++ 98 headers.
+#include <string>
+#include <vector>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "Ring.hpp"
+
+namespace Transports
+{
+  //! Message transport between two DUNE instances running on the
+  //! same host, over a pair of shared memory rings. Each instance
+  //! creates and transmits into its own ring ('Transmit Area') and
+  //! reads from the ring created by its peer ('Receive Area'), so
+  //! the two areas are named symmetrically in the two
+  //! configurations. Messages cross the partition boundary with one
+  //! serialization and one copy, with no sockets involved.
+  namespace SharedMemory
+  {
+    using DUNE_NAMESPACES;
+
+    //! %Task arguments.
+    struct Arguments
+    {
+      //! Name of the transmit memory area.
+      std::string tx_name;
+      //! Name of the receive memory area.
+      std::string rx_name;
+      //! Size of each memory area.
+      unsigned area_size;
+      //! List of messages to transport.
+      std::vector<std::string> messages;
+    };
+
+    //! Serialization buffer size.
+    static const int c_bfr_size = 65535;
+    //! Receive poll period (s).
+    static const double c_poll_per = 0.001;
+    //! Peer ring open retry period (s).
+    static const double c_open_per = 1.0;
+
+    //! Receiver thread: opens the peer's ring when it becomes
+    //! available and dispatches every record as a message.
+    class Reader: public Concurrency::Thread
+    {
+    public:
+      Reader(Tasks::Task& task, const std::string& name, unsigned size):
+        m_task(task),
+        m_shm(name.c_str(), size),
+        m_size(size)
+      { }
+
+    private:
+      //! Parent task.
+      Tasks::Task& m_task;
+      //! Peer's shared memory area.
+      Concurrency::SharedMemory m_shm;
+      //! Size of the memory area.
+      unsigned m_size;
+
+      void
+      run(void)
+      {
+        Ring* ring = NULL;
+        uint8_t* bfr = new uint8_t[c_bfr_size];
+
+        while (!isStopping())
+        {
+          if (ring == NULL)
+          {
+            ring = openPeer();
+            if (ring == NULL)
+            {
+              Time::Delay::wait(c_open_per);
+              continue;
+            }
+          }
+
+          uint16_t rv = ring->read(bfr, c_bfr_size);
+          if (rv == 0)
+          {
+            Time::Delay::wait(c_poll_per);
+            continue;
+          }
+
+          try
+          {
+            IMC::Message* msg = IMC::Packet::deserialize(bfr, rv);
+            m_task.dispatch(msg, DF_KEEP_TIME | DF_KEEP_SRC_EID);
+            delete msg;
+          }
+          catch (std::exception& e)
+          {
+            m_task.debug("error while unpacking message: %s", e.what());
+          }
+        }
+
+        delete ring;
+        delete[] bfr;
+      }
+
+      //! Try to open and validate the peer's ring.
+      //! @return ring object or NULL if not yet available.
+      Ring*
+      openPeer(void)
+      {
+        try
+        {
+          m_shm.open();
+        }
+        catch (...)
+        {
+          return NULL;
+        }
+
+        Ring* ring = new Ring(*m_shm, m_size);
+        if (!ring->isValid())
+        {
+          delete ring;
+          return NULL;
+        }
+
+        m_task.inf(DTR("receiving from memory area '%s'"), m_shm.getName());
+        return ring;
+      }
+    };
+
+    struct Task: public DUNE::Tasks::Task
+    {
+      //! Task arguments.
+      Arguments m_args;
+      //! Serialization buffer.
+      uint8_t* m_bfr;
+      //! Transmit memory area.
+      Concurrency::SharedMemory* m_tx_shm;
+      //! Transmit ring.
+      Ring* m_tx_ring;
+      //! Receiver thread.
+      Reader* m_reader;
+      //! Number of messages dropped on ring overflow.
+      unsigned m_dropped;
+
+      Task(const std::string& name, Tasks::Context& ctx):
+        DUNE::Tasks::Task(name, ctx),
+        m_bfr(NULL),
+        m_tx_shm(NULL),
+        m_tx_ring(NULL),
+        m_reader(NULL),
+        m_dropped(0)
+      {
+        param("Transmit Area", m_args.tx_name)
+        .defaultValue("imc-a2b")
+        .description("Name of the shared memory area used to transmit messages;"
+                     " must match the peer's 'Receive Area'");
+
+        param("Receive Area", m_args.rx_name)
+        .defaultValue("imc-b2a")
+        .description("Name of the shared memory area used to receive messages;"
+                     " must match the peer's 'Transmit Area'");
+
+        param("Area Size", m_args.area_size)
+        .units(Units::Byte)
+        .defaultValue("1048576")
+        .description("Size of each shared memory area; must match the peer's value");
+
+        param("Transports", m_args.messages)
+        .defaultValue("")
+        .description("List of messages to transport");
+
+        m_bfr = new uint8_t[c_bfr_size];
+      }
+
+      ~Task(void)
+      {
+        delete[] m_bfr;
+      }
+
+      void
+      onUpdateParameters(void)
+      {
+        bind(this, m_args.messages);
+      }
+
+      void
+      onResourceAcquisition(void)
+      {
+        m_tx_shm = new Concurrency::SharedMemory(m_args.tx_name.c_str(), m_args.area_size);
+        m_tx_shm->create();
+        m_tx_ring = new Ring(**m_tx_shm, m_args.area_size);
+        m_tx_ring->initialize();
+
+        inf(DTR("transmitting to memory area '%s'"), m_tx_shm->getName());
+
+        m_reader = new Reader(*this, m_args.rx_name, m_args.area_size);
+        m_reader->start();
+
+        setEntityState(IMC::EntityState::ESTA_NORMAL, Status::CODE_ACTIVE);
+      }
+
+      void
+      onResourceRelease(void)
+      {
+        if (m_reader != NULL)
+        {
+          m_reader->stopAndJoin();
+          delete m_reader;
+          m_reader = NULL;
+        }
+
+        Memory::clear(m_tx_ring);
+        Memory::clear(m_tx_shm);
+      }
+
+      void
+      consume(const IMC::Message* msg)
+      {
+        if (m_tx_ring == NULL)
+          return;
+
+        uint16_t rv = IMC::Packet::serialize(msg, m_bfr, c_bfr_size);
+
+        if (!m_tx_ring->write(m_bfr, rv))
+        {
+          // Receiver is not keeping up (or is not running): drop.
+          if ((++m_dropped % 1000) == 1)
+            war(DTR("dropped %u messages on full transmit ring"), m_dropped);
+        }
+      }
+
+      void
+      onMain(void)
+      {
+        while (!stopping())
+        {
+          waitForMessages(1.0);
+        }
+      }
+    };
+  }
+}
+
+DUNE_TASK
@@ -45,16 +45,24 @@ namespace Transports
       {
         Address address; // Server address.
         int port; // Server port.
+        bool nodelay; // Disable Nagle's algorithm.
       };
 
       struct Task: public Tasks::SimpleTransport
       {
+        // Connect timeout (seconds).
+        static const int c_connect_timeout = 5;
+        // Flush the outgoing buffer when it grows beyond this size.
+        static const unsigned c_flush_size = 64 * 1024;
         // Task arguments.
         Arguments m_args;
         // Socket handle.
         TCPSocket* m_sock;
         // Parser handle.
         IMC::Parser m_parser;
+        // Outgoing data, coalesced into one write per poll cycle so
+        // small messages share a TCP segment.
+        ByteBuffer m_out;
 
         Task(const std::string& name, Tasks::Context& ctx):
           Tasks::SimpleTransport(name, ctx),
@@ -67,6 +75,11 @@ namespace Transports
           param("Server - Port", m_args.port)
           .defaultValue("7001")
           .description("Remote server port");
+
+          param("No Delay", m_args.nodelay)
+          .defaultValue("true")
+          .description("Disable Nagle's algorithm; outgoing messages are"
+                       " coalesced per poll cycle");
         }
 
         ~Task(void)
@@ -80,8 +93,9 @@ namespace Transports
           try
           {
             m_sock = new TCPSocket;
-            m_sock->connect(m_args.address, m_args.port);
+            m_sock->connect(m_args.address, m_args.port, c_connect_timeout);
             m_sock->setKeepAlive(true);
+            m_sock->setNoDelay(m_args.nodelay);
 
             inf(DTR("connected to %s:%u"), m_args.address.c_str(), m_args.port);
             setEntityState(IMC::EntityState::ESTA_NORMAL, Status::CODE_ACTIVE);
@@ -102,17 +116,44 @@ namespace Transports
           }
 
           m_parser.reset();
+          m_out.setSize(0);
+        }
+
+        IO::Handle*
+        getIOHandle(void)
+        {
+          return m_sock;
+        }
+
+        void
+        onFlush(void)
+        {
+          flushOutput();
         }
 
         void
         onDataTransmission(const uint8_t* p, unsigned int len)
         {
+          m_out.append(p, len);
+
+          if (m_out.getSize() >= c_flush_size)
+            flushOutput();
+        }
+
+        void
+        flushOutput(void)
+        {
+          if (m_out.getSize() == 0)
+            return;
+
           try
           {
-            m_sock->write((const char*)p, len);
+            m_sock->write((const char*)m_out.getBuffer(), m_out.getSize());
+            m_out.setSize(0);
           }
           catch (std::exception& e)
           {
+            m_out.setSize(0);
             throw RestartNeeded(e.what(), 5);
           }
         }
@@ -120,6 +161,9 @@ namespace Transports
         void
         onDataReception(uint8_t* p, unsigned int n, double timeout)
         {
+          // Send everything queued since the last cycle in one segment.
+          flushOutput();
+
           if (!Poll::poll(*m_sock, timeout))
             return;
 
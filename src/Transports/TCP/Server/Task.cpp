@@ -45,6 +45,10 @@ namespace Transports
         uint16_t port;
         //! True to announce service.
         bool announce;
+        //! True to disable Nagle's algorithm on client sockets.
+        bool nodelay;
+        //! Maximum bytes queued per client before it is disconnected.
+        unsigned credit;
       };
 
       struct Task: public Tasks::SimpleTransport
@@ -57,6 +61,11 @@ namespace Transports
         TCPSocket* m_sock;
         // I/O selector.
         Poll m_poll;
+        // Outgoing data, coalesced into one write per client and poll
+        // cycle so small messages share a TCP segment.
+        ByteBuffer m_out;
+        // Flush the outgoing buffer when it grows beyond this size.
+        static const unsigned c_flush_size = 64 * 1024;
 
         // Client data.
         struct Client
@@ -65,6 +74,8 @@ namespace Transports
           Address address; // Client address.
           uint16_t port; // Client port.
           IMC::Parser parser; // Parser handle
+          ByteBuffer out; // Queued outgoing data (credit window).
+          size_t off; // Bytes of the queue already written.
         };
 
         // Client list.
@@ -82,6 +93,17 @@ namespace Transports
           param("Announce Service", m_args.announce)
           .defaultValue("true")
           .description("Set to true to announce the service");
+
+          param("No Delay", m_args.nodelay)
+          .defaultValue("true")
+          .description("Disable Nagle's algorithm on client sockets; outgoing"
+                       " messages are coalesced per poll cycle");
+
+          param("Client Credit Window", m_args.credit)
+          .defaultValue("1048576")
+          .description("Maximum amount of bytes queued for a client that is"
+                       " not draining its connection; slower clients are"
+                       " disconnected instead of stalling the transport");
         }
 
         ~Task(void)
@@ -192,18 +214,77 @@ namespace Transports
             delete m_sock;
             m_sock = 0;
           }
+
+          m_out.setSize(0);
         }
 
         void
         onDataTransmission(const uint8_t* p, unsigned int n)
         {
+          m_out.append(p, n);
+
+          if (m_out.getSize() >= c_flush_size)
+            flushOutput();
+        }
+
+        void
+        flushOutput(void)
+        {
+          // Move freshly queued data into the per-client windows.
+          if (m_out.getSize() > 0)
+          {
+            ClientList::iterator itr = m_clients.begin();
+
+            while (itr != m_clients.end())
+            {
+              // Reclaim the part of the window already written.
+              if (itr->off > 0)
+              {
+                std::memmove(itr->out.getBuffer(),
+                             itr->out.getBuffer() + itr->off,
+                             itr->out.getSize() - itr->off);
+                itr->out.setSize(itr->out.getSize() - itr->off);
+                itr->off = 0;
+              }
+
+              if (itr->out.getSize() + m_out.getSize() > m_args.credit)
+              {
+                // The client is not draining its connection: cutting it
+                // loose beats blocking the bus or growing without bound.
+                std::runtime_error e(DTR("credit window exhausted"));
+                closeConnection(*itr, e);
+                itr = m_clients.erase(itr);
+                continue;
+              }
+
+              itr->out.append(m_out.getBuffer(), m_out.getSize());
+              ++itr;
+            }
+
+            m_out.setSize(0);
+          }
+
+          // Drain as much of each window as the sockets accept without
+          // blocking on flow control.
           ClientList::iterator itr = m_clients.begin();
 
           while (itr != m_clients.end())
           {
+            size_t pending = itr->out.getSize() - itr->off;
+            if (pending == 0)
+            {
+              ++itr;
+              continue;
+            }
+
             try
             {
-              itr->socket->write((char*)p, n);
+              itr->off += itr->socket->tryWrite(itr->out.getBuffer() + itr->off, pending);
+              if (itr->off == itr->out.getSize())
+              {
+                itr->out.setSize(0);
+                itr->off = 0;
+              }
             }
             catch (std::runtime_error& e)
             {
@@ -211,6 +292,7 @@ namespace Transports
               itr = m_clients.erase(itr);
               continue;
             }
+
             ++itr;
           }
         }
@@ -218,6 +300,9 @@ namespace Transports
         void
         onDataReception(uint8_t* buf, unsigned int cap, double timeout)
         {
+          // Send everything queued since the last cycle in one segment.
+          flushOutput();
+
           // Poll for connections and client data
           if (!m_poll.poll(timeout))
             return;
@@ -235,11 +320,12 @@ namespace Transports
         {
           Client c;
           c.socket = 0;
+          c.off = 0;
           try
           {
             c.socket = m_sock->accept(&c.address, &c.port);
             c.socket->setKeepAlive(true);
-            c.socket->setNoDelay(true);
+            c.socket->setNoDelay(m_args.nodelay);
             c.socket->setReceiveTimeout(5);
             c.socket->setSendTimeout(5);
             m_poll.add(*c.socket);
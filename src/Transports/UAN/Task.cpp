@@ -40,6 +40,12 @@ namespace Transports
     // Synchronization byte.
     static const uint8_t c_sync = 0xA1;
     static const uint8_t c_poly = 0x07;
+    // Number of state snapshots kept for delayed USBL positions.
+    static const size_t c_state_history_size = 512;
+    // Size of each bloom filter generation in bytes.
+    static const size_t c_bloom_size = 512;
+    // Number of bloom filter bits probed per frame.
+    static const unsigned c_bloom_hashes = 4;
 
     enum Codes
     {
@@ -72,12 +78,18 @@ namespace Transports
       float usbl_max_wait;
       //! USBL Modem Announce service.
       bool usbl_announce;
+      //! Enable duplicate frame suppression.
+      bool dedup;
+      //! Duplicate suppression window.
+      double dedup_window;
     };
 
     struct Task: public DUNE::Tasks::Task
     {
       //! Estimated state.
       IMC::EstimatedState m_estate;
+      //! History of state snapshots to fold in late USBL positions.
+      Navigation::StateHistory m_state_history;
       //! Last progress.
       float m_progress;
       //! Last fuel level.
@@ -102,6 +114,12 @@ namespace Transports
       UsblTools::Node* m_usbl_node;
       //! USBL Modem.
       UsblTools::Modem* m_usbl_modem;
+      //! Bloom filter generations for duplicate suppression.
+      std::vector<uint8_t> m_bloom[2];
+      //! Bloom filter generation currently taking insertions.
+      unsigned m_bloom_act;
+      //! Bloom filter rotation timer.
+      Counter<double> m_bloom_timer;
       //! Task arguments.
       Arguments m_args;
 
@@ -110,6 +128,7 @@ namespace Transports
       //! @param[in] ctx context.
       Task(const std::string& name, Tasks::Context& ctx):
         DUNE::Tasks::Task(name, ctx),
+        m_state_history(c_state_history_size),
         m_progress(0),
         m_fuel_level(0),
         m_fuel_conf(0),
@@ -118,8 +137,12 @@ namespace Transports
         m_send_next(false),
         m_reporter(NULL),
         m_usbl_node(NULL),
-        m_usbl_modem(NULL)
+        m_usbl_modem(NULL),
+        m_bloom_act(0)
       {
+        m_bloom[0].resize(c_bloom_size, 0);
+        m_bloom[1].resize(c_bloom_size, 0);
+
         param("Enable Reports", m_args.report_enable)
         .defaultValue("false")
         .description("Enable system state acoustic reporting. When enabled, systems"
@@ -127,6 +150,21 @@ namespace Transports
                      " messages containing the overall state of the system."
                      " When disabled, those requests shall be ignored");
 
+        param("Duplicate Suppression", m_args.dedup)
+        .defaultValue("false")
+        .description("Drop frames whose source and payload were already"
+                     " received within the suppression window. In multi-hop"
+                     " topologies the same frame arrives over several paths"
+                     " and a duplicate plan command is re-dispatched without"
+                     " this filter");
+
+        param("Duplicate Suppression Window", m_args.dedup_window)
+        .defaultValue("30.0")
+        .minimumValue("1.0")
+        .units(Units::Second)
+        .description("A duplicate frame is suppressed for at least this long"
+                     " after the first copy arrives");
+
         param("USBL Node -- Enabled", m_node_args.enabled)
         .defaultValue("false")
         .description("Enable system's USBL mode. When active, this system will"
@@ -202,6 +240,18 @@ namespace Transports
         onResourceRelease();
       }
 
+      //! Update internal state with new parameter values.
+      void
+      onUpdateParameters(void)
+      {
+        if (paramChanged(m_args.dedup_window) || paramChanged(m_args.dedup))
+        {
+          std::fill(m_bloom[0].begin(), m_bloom[0].end(), 0);
+          std::fill(m_bloom[1].begin(), m_bloom[1].end(), 0);
+          m_bloom_timer.setTop(m_args.dedup_window);
+        }
+      }
+
       void
       onResourceAcquisition(void)
       {
@@ -243,6 +293,7 @@ namespace Transports
           return;
 
         m_estate = *msg;
+        m_state_history.insert(*msg);
       }
 
       void
@@ -341,6 +392,12 @@ namespace Transports
           return;
         }
 
+        if (isDuplicate(msg))
+        {
+          debug("dropping duplicate frame from %s", msg->sys_src.c_str());
+          return;
+        }
+
         switch (msg->data[1])
         {
           case CODE_REPORT:
@@ -511,8 +568,14 @@ namespace Transports
         // The target wants an absolute fix?
         if (m_usbl_modem->wantsFix(msg->target))
         {
+          // Use the state at the time of measurement; the position
+          // arrives seconds late and the modem may have moved since.
+          IMC::EstimatedState state;
+          if (!m_state_history.get(msg->getTimeStamp(), state))
+            state = m_estate;
+
           // transform data.
-          IMC::UsblFixExtended fix = UsblTools::toFix(*msg, m_estate);
+          IMC::UsblFixExtended fix = UsblTools::toFix(*msg, state);
           if (m_usbl_modem->encode(&fix, data))
             sendFrame(msg->target, data, false);
         }
@@ -557,6 +620,48 @@ namespace Transports
           m_reporter->consume(msg);
       }
 
+      //! Test a frame against the rolling bloom filter and record it.
+      //! The frame payload carries whatever sequencing the sender
+      //! embedded, so the same source and payload bytes seen again
+      //! within the window are one frame arriving over several paths.
+      //! @param[in] msg received frame.
+      //! @return true if the frame was already received.
+      bool
+      isDuplicate(const IMC::UamRxFrame* msg)
+      {
+        if (!m_args.dedup)
+          return false;
+
+        // Rotate generations: entries are forgotten somewhere between
+        // one and two windows after insertion.
+        if (m_bloom_timer.overflow())
+        {
+          m_bloom_act = 1 - m_bloom_act;
+          std::fill(m_bloom[m_bloom_act].begin(), m_bloom[m_bloom_act].end(), 0);
+          m_bloom_timer.reset();
+        }
+
+        // Double hashing: probe bits h1 + i * h2.
+        uint32_t h1 = Algorithms::CRC32::compute((const uint8_t*)msg->sys_src.c_str(),
+                                                 msg->sys_src.size());
+        h1 = Algorithms::CRC32::compute((const uint8_t*)&msg->data[0],
+                                        msg->data.size(), h1);
+        uint32_t h2 = Algorithms::CRC32::compute((const uint8_t*)&msg->data[0],
+                                                 msg->data.size(), ~h1);
+
+        bool dup = true;
+        for (unsigned i = 0; i < c_bloom_hashes; ++i)
+        {
+          uint32_t bit = (h1 + i * h2) % (c_bloom_size * 8);
+          uint8_t mask = 1 << (bit & 0x07);
+          if (!((m_bloom[0][bit / 8] | m_bloom[1][bit / 8]) & mask))
+            dup = false;
+          m_bloom[m_bloom_act][bit / 8] |= mask;
+        }
+
+        return dup;
+      }
+
       //! Announce USBL service.
       void
       announceUSBL(void)
@@ -0,0 +1,182 @@
+//***************************************************************************
+// Copyright 2007-2017 Universidade do Porto - Faculdade de Engenharia      *
+// Laboratório de Sistemas e Tecnologia Subaquática (LSTS)                  *
+//***************************************************************************
+// This file is part of DUNE: Unified Navigation Environment.               *
+//                                                                          *
+// Commercial Licence Usage                                                 *
+// Licencees holding valid commercial DUNE licences may use this file in    *
+// accordance with the commercial licence agreement provided with the       *
+// Software or, alternatively, in accordance with the terms contained in a  *
+// written agreement between you and Faculdade de Engenharia da             *
+// Universidade do Porto. For licensing terms, conditions, and further      *
+// information contact lsts@fe.up.pt.                                       *
+//                                                                          *
+// Modified European Union Public Licence - EUPL v.1.1 Usage                *
+// Alternatively, this file may be used under the terms of the Modified     *
+// EUPL, Version 1.1 only (the "Licence"), appearing in the file LICENCE.md *
+// included in the packaging of this file. You may not use this work        *
+// except in compliance with the Licence. Unless required by applicable     *
+// law or agreed to in writing, software distributed under the Licence is   *
+// distributed on an "AS IS" basis, WITHOUT WARRANTIES OR CONDITIONS OF     *
+// ANY KIND, either express or implied. See the Licence for the specific    *
+// language governing permissions and limitations at                        *
+// https://github.com/LSTS/dune/blob/master/LICENCE.md and                  *
+// http://ec.europa.eu/idabc/eupl.html.                                     *
+//***************************************************************************
+// Author: Ricardo Martins                                                  *
+//***************************************************************************
+
+#ifndef TRANSPORTS_UDP_AGGREGATOR_HPP_INCLUDED_
+#define TRANSPORTS_UDP_AGGREGATOR_HPP_INCLUDED_
+
+// ISO C++ 98 headers.
+#include <map>
+
+// DUNE headers.
+#include <DUNE/DUNE.hpp>
+
+// Local headers.
+#include "NodeAddress.hpp"
+
+namespace Transports
+{
+  namespace UDP
+  {
+    using DUNE_NAMESPACES;
+
+    //! Datagram aggregator. Packs serialized IMC messages bound for
+    //! the same destination into one datagram, flushing when the
+    //! datagram would exceed a size threshold or when its first
+    //! message exceeds an age threshold. The receiving end un-frames
+    //! the messages, which are simply laid back to back.
+    class Aggregator
+    {
+    public:
+      //! Constructor.
+      //! @param[in] sock UDP socket used to flush datagrams.
+      Aggregator(UDPSocket& sock):
+        m_sock(sock),
+        m_max_size(0),
+        m_max_age(0)
+      { }
+
+      //! Configure aggregation thresholds.
+      //! @param[in] max_size maximum datagram payload size (0 disables).
+      //! @param[in] max_age maximum message age before flush (s).
+      void
+      setup(unsigned max_size, double max_age)
+      {
+        m_max_size = max_size;
+        m_max_age = max_age;
+      }
+
+      //! Test if aggregation is enabled.
+      //! @return true if enabled, false otherwise.
+      bool
+      isEnabled(void) const
+      {
+        return m_max_size > 0;
+      }
+
+      //! Queue data for a given destination, flushing first if the
+      //! pending datagram would exceed the size threshold.
+      //! @param[in] dst destination address.
+      //! @param[in] data serialized message.
+      //! @param[in] data_len length of serialized message.
+      void
+      append(const NodeAddress& dst, const uint8_t* data, unsigned data_len)
+      {
+        // Oversized payloads are sent on their own.
+        if (data_len >= m_max_size)
+        {
+          write(dst, data, data_len);
+          return;
+        }
+
+        Buffer& bfr = m_bfrs[dst];
+
+        if (bfr.data.getSize() + data_len > m_max_size)
+          flush(dst, bfr);
+
+        if (bfr.data.getSize() == 0)
+          bfr.oldest = Time::Clock::get();
+
+        bfr.data.append(data, data_len);
+      }
+
+      //! Flush all pending datagrams whose first message is older
+      //! than the age threshold.
+      void
+      flushExpired(void)
+      {
+        double now = Time::Clock::get();
+
+        std::map<NodeAddress, Buffer>::iterator itr = m_bfrs.begin();
+        for (; itr != m_bfrs.end(); ++itr)
+        {
+          if (itr->second.data.getSize() > 0 && (now - itr->second.oldest) >= m_max_age)
+            flush(itr->first, itr->second);
+        }
+      }
+
+      //! Flush all pending datagrams.
+      void
+      flushAll(void)
+      {
+        std::map<NodeAddress, Buffer>::iterator itr = m_bfrs.begin();
+        for (; itr != m_bfrs.end(); ++itr)
+        {
+          if (itr->second.data.getSize() > 0)
+            flush(itr->first, itr->second);
+        }
+      }
+
+    private:
+      //! Pending datagram.
+      struct Buffer
+      {
+        //! Serialized messages, laid back to back.
+        ByteBuffer data;
+        //! Time of the oldest pending message.
+        double oldest;
+      };
+
+      //! UDP socket used to flush datagrams.
+      UDPSocket& m_sock;
+      //! Maximum datagram payload size (0 disables aggregation).
+      unsigned m_max_size;
+      //! Maximum message age before flush (s).
+      double m_max_age;
+      //! Pending datagrams, by destination.
+      std::map<NodeAddress, Buffer> m_bfrs;
+
+      //! Send a pending datagram and reset its buffer.
+      //! @param[in] dst destination address.
+      //! @param[in] bfr pending datagram.
+      void
+      flush(const NodeAddress& dst, Buffer& bfr)
+      {
+        write(dst, bfr.data.getBuffer(), bfr.data.getSize());
+        bfr.data.setSize(0);
+      }
+
+      //! Send data to a destination, ignoring transient errors.
+      //! @param[in] dst destination address.
+      //! @param[in] data data to send.
+      //! @param[in] data_len length of data.
+      void
+      write(const NodeAddress& dst, const uint8_t* data, unsigned data_len)
+      {
+        try
+        {
+          m_sock.write(data, data_len, dst.getAddress(), dst.getPort());
+        }
+        catch (...)
+        { }
+      }
+    };
+  }
+}
+
+#endif
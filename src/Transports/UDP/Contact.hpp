@@ -83,6 +83,16 @@ namespace Transports
         return !isInactive();
       }
 
+      //! Time left until this contact times out. With a common
+      //! timeout this orders contacts from least to most recently
+      //! heard.
+      //! @return remaining time in seconds.
+      float
+      getFreshness(void) const
+      {
+        return m_counter.getRemaining();
+      }
+
     private:
       // Node id.
       unsigned m_id;
@@ -46,52 +46,130 @@ namespace Transports
   {
     using DUNE_NAMESPACES;
 
+    //! Table of the addresses each node was heard from. Every
+    //! address is a link with its own timeout, so a node reachable
+    //! over several interfaces keeps all of them alive and can fail
+    //! over when one goes silent.
+    //!
+    //! Memory is bounded: when the table is full a new node evicts
+    //! the least recently heard one, and each node keeps a limited
+    //! number of links, so transient peers cannot grow the table
+    //! without limit.
     class ContactTable
     {
     public:
-      ContactTable(float tout):
-        m_tout(tout)
+      ContactTable(float tout, unsigned max_nodes = c_default_max_nodes):
+        m_tout(tout),
+        m_max_nodes(max_nodes)
       { }
 
+      //! Retrieve the best contact of each node: the most recently
+      //! heard address that is still alive or, when every link timed
+      //! out, the one that died last.
+      //! @param[out] list best contact per node.
       void
       getContacts(std::vector<Contact>& list)
       {
         list.clear();
         for (Table::iterator itr = m_table.begin(); itr != m_table.end(); ++itr)
-          list.push_back(itr->second);
+        {
+          std::vector<Contact>& links = itr->second;
+          unsigned best = 0;
+          for (unsigned i = 1; i < links.size(); ++i)
+          {
+            if (links[i].isActive() && !links[best].isActive())
+              best = i;
+            else if (links[i].isActive() == links[best].isActive()
+                     && links[i].getFreshness() > links[best].getFreshness())
+              best = i;
+          }
+
+          list.push_back(links[best]);
+        }
       }
 
       void
       update(unsigned id, const Address& addr)
       {
-        Table::iterator itr = m_table.find(id);
+        Table::iterator node = m_table.find(id);
+        if (node == m_table.end())
+        {
+          if (m_table.size() >= m_max_nodes)
+            evict();
 
-        if (itr == m_table.end())
+          node = m_table.insert(std::make_pair(id, std::vector<Contact>())).first;
+        }
+
+        std::vector<Contact>& links = node->second;
+
+        unsigned stalest = 0;
+        for (unsigned i = 0; i < links.size(); ++i)
         {
-          std::pair<Table::iterator, bool> rv = m_table.insert(Entry(id, Contact(id, addr)));
-          itr = rv.first;
-          itr->second.setTimeout(m_tout);
+          if (links[i].getAddress() == addr)
+          {
+            links[i].update();
+            return;
+          }
+
+          if (links[i].getFreshness() < links[stalest].getFreshness())
+            stalest = i;
         }
 
-        // Address has changed... update it.
-        if (itr->second.getAddress() != addr)
+        if (links.size() >= c_max_links)
         {
-          itr->second = Contact(id, addr);
-          itr->second.setTimeout(m_tout);
+          links[stalest] = Contact(id, addr);
+          links[stalest].setTimeout(m_tout);
+          links[stalest].update();
+          return;
         }
 
-        itr->second.update();
+        links.push_back(Contact(id, addr));
+        links.back().setTimeout(m_tout);
+        links.back().update();
       }
 
     private:
+      // Default maximum number of tracked nodes.
+      static const unsigned c_default_max_nodes = 256;
+      // Maximum number of links kept per node.
+      static const unsigned c_max_links = 8;
       // Table type.
-      typedef std::map<unsigned, Contact> Table;
-      // Map entry.
-      typedef std::pair<unsigned, Contact> Entry;
+      typedef std::map<unsigned, std::vector<Contact> > Table;
       // Table.
       Table m_table;
       // Timeout value to deactivate a contact.
       float m_tout;
+      // Maximum number of tracked nodes.
+      unsigned m_max_nodes;
+
+      //! Drop the least recently heard node: the one whose freshest
+      //! link has the smallest remaining lifetime.
+      void
+      evict(void)
+      {
+        Table::iterator victim = m_table.begin();
+        float victim_freshness = 0;
+
+        for (Table::iterator itr = m_table.begin(); itr != m_table.end(); ++itr)
+        {
+          std::vector<Contact>& links = itr->second;
+          float freshness = links.empty() ? -1 : links[0].getFreshness();
+          for (unsigned i = 1; i < links.size(); ++i)
+          {
+            if (links[i].getFreshness() > freshness)
+              freshness = links[i].getFreshness();
+          }
+
+          if (itr == m_table.begin() || freshness < victim_freshness)
+          {
+            victim = itr;
+            victim_freshness = freshness;
+          }
+        }
+
+        if (victim != m_table.end())
+          m_table.erase(victim);
+      }
     };
   }
 }
@@ -51,10 +51,11 @@ namespace Transports
     {
     public:
       Listener(Tasks::Task& task, UDPSocket& sock, LimitedComms* lcomms,
-               float contact_timeout, bool trace = false):
+               float contact_timeout, bool trace = false, bool dedup = true):
         m_task(task),
         m_sock(sock),
         m_trace(trace),
+        m_dedup(dedup),
         m_contacts(contact_timeout),
         m_lcomms(lcomms)
       {  }
@@ -78,8 +79,10 @@ namespace Transports
       }
 
     private:
-      // Buffer capacity.
+      // Buffer capacity (per datagram).
       static const int c_bfr_size = 65535;
+      // Maximum datagrams received per system call.
+      static const int c_batch_size = 16;
       // Poll timeout in milliseconds.
       static const int c_poll_tout = 1000;
       // Parent task.
@@ -88,6 +91,11 @@ namespace Transports
       UDPSocket& m_sock;
       // True to print incoming messages.
       bool m_trace;
+      // True to suppress duplicates received over multiple paths.
+      bool m_dedup;
+      // Timestamp of the last message seen per source, message and
+      // entity, for duplicate suppression.
+      std::map<uint64_t, double> m_seen;
       // Table of contacts.
       ContactTable m_contacts;
       // Lock to serialize access to m_contacts.
@@ -95,12 +103,81 @@ namespace Transports
       // LimitedComms object
       LimitedComms* m_lcomms;
 
+      //! Check if a message is a copy of the last one received from
+      //! the same source, message type and entity. The sender stamps
+      //! the timestamp once, so copies delivered over several paths
+      //! carry the exact same value.
+      //! @param[in] msg message to check.
+      //! @return true if the message is a duplicate.
+      bool
+      isDuplicate(const IMC::Message* msg)
+      {
+        uint64_t key = ((uint64_t)msg->getSource() << 32)
+                       | ((uint64_t)msg->getId() << 8)
+                       | msg->getSourceEntity();
+
+        std::map<uint64_t, double>::iterator itr = m_seen.find(key);
+        if (itr == m_seen.end())
+        {
+          m_seen.insert(std::pair<uint64_t, double>(key, msg->getTimeStamp()));
+          return false;
+        }
+
+        if (itr->second == msg->getTimeStamp())
+          return true;
+
+        itr->second = msg->getTimeStamp();
+        return false;
+      }
+
+      //! Handle one deserialized message.
+      //! @param[in] msg message (ownership is taken).
+      //! @param[in] addr source address.
+      void
+      handle(IMC::Message* msg, const Address& addr)
+      {
+        if (m_lcomms->isActive())
+        {
+          if (msg->getId() == DUNE_IMC_ANNOUNCE)
+          {
+            m_lcomms->setAnnounce(static_cast<IMC::Announce*>(msg));
+          }
+
+          if (!m_lcomms->isNodeWithinRange(msg->getSource(), msg->getId()))
+          {
+            delete msg;
+            return;
+          }
+        }
+
+        // Duplicates still prove their path is alive, so the contact
+        // is updated before they are dropped.
+        m_contacts_lock.lockWrite();
+        m_contacts.update(msg->getSource(), addr);
+        m_contacts_lock.unlock();
+
+        if (m_dedup && isDuplicate(msg))
+        {
+          delete msg;
+          return;
+        }
+
+        m_task.dispatch(msg, DF_KEEP_TIME | DF_KEEP_SRC_EID);
+
+        if (m_trace)
+          msg->toText(std::cerr);
+
+        delete msg;
+      }
+
       void
       run(void)
       {
-        Address addr;
-        uint8_t* bfr = new uint8_t[c_bfr_size];
+        Address addrs[c_batch_size];
+        size_t lens[c_batch_size];
+        uint8_t* arena = new uint8_t[c_batch_size * c_bfr_size];
         double poll_tout = c_poll_tout / 1000.0;
+        IMC::Parser parser;
 
         while (!isStopping())
         {
@@ -109,33 +186,25 @@ namespace Transports
             if (!Poll::poll(m_sock, poll_tout))
               continue;
 
-            uint16_t rv = m_sock.read(bfr, c_bfr_size, &addr);
-            IMC::Message* msg = IMC::Packet::deserialize(bfr, rv);
+            // Drain a batch of datagrams before parsing, so bursts
+            // are pulled out of the socket buffer as fast as
+            // possible.
+            unsigned count = m_sock.readMulti(arena, c_bfr_size, c_batch_size, lens, addrs);
 
-            if (m_lcomms->isActive())
+            for (unsigned d = 0; d < count; ++d)
             {
-              if (msg->getId() == DUNE_IMC_ANNOUNCE)
-              {
-                m_lcomms->setAnnounce(static_cast<IMC::Announce*>(msg));
-              }
+              const uint8_t* bfr = arena + d * c_bfr_size;
 
-              if (!m_lcomms->isNodeWithinRange(msg->getSource(), msg->getId()))
+              // A datagram may carry several messages laid back to
+              // back; un-frame and handle each one.
+              parser.reset();
+              for (size_t i = 0; i < lens[d]; ++i)
               {
-                delete msg;
-                continue;
+                IMC::Message* msg = parser.parse(bfr[i]);
+                if (msg != NULL)
+                  handle(msg, addrs[d]);
               }
             }
-
-            m_contacts_lock.lockWrite();
-            m_contacts.update(msg->getSource(), addr);
-            m_contacts_lock.unlock();
-
-            m_task.dispatch(msg, DF_KEEP_TIME | DF_KEEP_SRC_EID);
-
-            if (m_trace)
-              msg->toText(std::cerr);
-
-            delete msg;
           }
           catch (std::exception & e)
           {
@@ -143,7 +212,7 @@ namespace Transports
           }
         }
 
-        delete [] bfr;
+        delete [] arena;
       }
     };
   }
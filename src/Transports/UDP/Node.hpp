@@ -35,6 +35,7 @@
 #include <vector>
 #include <cstdio>
 #include <map>
+#include <set>
 
 // DUNE headers.
 #include <DUNE/DUNE.hpp>
@@ -50,7 +51,9 @@ namespace Transports
     public:
       Node(const std::string& name, const std::string& services):
         m_name(name),
-        m_active(m_addrs.end())
+        m_active(m_addrs.end()),
+        m_last_heard(Time::Clock::get()),
+        m_has_subs(false)
       {
         // Search for IMC + UDP services.
         std::vector<std::string> list;
@@ -73,6 +76,9 @@ namespace Transports
       {
         m_name = node.m_name;
         m_addrs = node.m_addrs;
+        m_last_heard = node.m_last_heard;
+        m_subs = node.m_subs;
+        m_has_subs = node.m_has_subs;
 
         if (node.m_active == node.m_addrs.end())
           m_active = m_addrs.end();
@@ -80,6 +86,21 @@ namespace Transports
           m_active = m_addrs.find(node.m_active->first);
       }
 
+      //! Record that the node was just heard announcing itself.
+      void
+      heard(void)
+      {
+        m_last_heard = Time::Clock::get();
+      }
+
+      //! Get the time of the last announce from this node.
+      //! @return last announce time.
+      double
+      getLastHeard(void) const
+      {
+        return m_last_heard;
+      }
+
       //! Get node name.
       //! @return node name.
       const std::string&
@@ -88,6 +109,29 @@ namespace Transports
         return m_name;
       }
 
+      //! Replace the set of messages the node advertised consumers
+      //! for.
+      //! @param[in] subs advertised message identifiers.
+      void
+      setSubscriptions(const std::set<uint16_t>& subs)
+      {
+        m_subs = subs;
+        m_has_subs = true;
+      }
+
+      //! Check if the node advertised a consumer for a given message.
+      //! Nodes that never advertised subscriptions want everything.
+      //! @param[in] msgid IMC message identifier.
+      //! @return true if the message should be sent to this node.
+      bool
+      wants(unsigned msgid) const
+      {
+        if (!m_has_subs)
+          return true;
+
+        return m_subs.find((uint16_t)msgid) != m_subs.end();
+      }
+
       //! Check if address and port are on this node's
       //! list of services.
       //! @param[in] addr address.
@@ -116,8 +160,21 @@ namespace Transports
             return false;
         }
 
-        m_active = m_addrs.find(addr);
-        return (m_active != m_addrs.end());
+        // An unknown address must not deactivate the node.
+        std::map<Address, unsigned>::iterator itr = m_addrs.find(addr);
+        if (itr == m_addrs.end())
+          return false;
+
+        m_active = itr;
+        return true;
+      }
+
+      //! Check if the node has an active address.
+      //! @return true if the node is active, false otherwise.
+      bool
+      isActive(void) const
+      {
+        return m_active != m_addrs.end();
       }
 
       //! Deactivate destination address from list of services.
@@ -137,6 +194,34 @@ namespace Transports
         return true;
       }
 
+      //! Deactivate the node, whatever its active address.
+      //! @return true if deactivation successful, false if already
+      //! deactivated.
+      bool
+      deactivate(void)
+      {
+        if (m_active == m_addrs.end())
+          return false;
+
+        m_active = m_addrs.end();
+        return true;
+      }
+
+      //! Get the active address of this node.
+      //! @param[out] addr active address.
+      //! @param[out] port active port.
+      //! @return true if the node is active, false otherwise.
+      bool
+      getActiveAddress(Address& addr, unsigned& port) const
+      {
+        if (m_active == m_addrs.end())
+          return false;
+
+        addr = m_active->first;
+        port = m_active->second;
+        return true;
+      }
+
       //! Send data to node.
       //! @param[in] sock UDP destination socket.
       //! @param[in] data data to be transmitted.
@@ -162,6 +247,12 @@ namespace Transports
       std::map<Address, unsigned> m_addrs;
       // Active address.
       std::map<Address, unsigned>::iterator m_active;
+      // Time of the last announce.
+      double m_last_heard;
+      // Messages the node advertised consumers for.
+      std::set<uint16_t> m_subs;
+      // Whether the node ever advertised subscriptions.
+      bool m_has_subs;
     };
   }
 }
@@ -33,6 +33,8 @@
 // ISO C++ 98 headers.
 #include <string>
 #include <map>
+#include <set>
+#include <vector>
 #include <cstdio>
 
 // DUNE headers.
@@ -40,6 +42,7 @@
 
 // Local headers.
 #include "Node.hpp"
+#include "NodeAddress.hpp"
 #include "LimitedComms.hpp"
 
 namespace Transports
@@ -48,17 +51,34 @@ namespace Transports
   {
     using DUNE_NAMESPACES;
 
+    //! Table of announced nodes.
+    //!
+    //! Sends iterate a list of the active nodes only, so the cost of
+    //! an outgoing message is bounded by the number of reachable
+    //! peers and not by every node ever announced. The table itself
+    //! is bounded: a new node evicts the inactive node that has been
+    //! silent the longest.
     class NodeTable
     {
     public:
       NodeTable(void):
-        m_active_count(0),
-        m_lcomms(NULL)
+        m_lcomms(NULL),
+        m_subs_filter(false)
       { }
 
       void
       addNode(unsigned id, const std::string& name, const std::string& services)
       {
+        Table::iterator itr = m_table.find(id);
+        if (itr != m_table.end())
+        {
+          itr->second.heard();
+          return;
+        }
+
+        if (m_table.size() >= c_max_nodes)
+          evict();
+
         m_table.insert(std::pair<unsigned, Node>(id, Node(name, services)));
       }
 
@@ -69,10 +89,18 @@ namespace Transports
         if (itr == m_table.end())
           return false;
 
+        // Activation may just switch the active address of an
+        // already active node.
+        bool was_active = itr->second.isActive();
         if (!itr->second.activate(addr))
           return false;
 
-        ++m_active_count;
+        if (!was_active)
+        {
+          ActiveNode an = {id, &itr->second};
+          m_active.push_back(an);
+        }
+
         return true;
       }
 
@@ -86,14 +114,54 @@ namespace Transports
         if (!itr->second.deactivate(addr))
           return false;
 
-        --m_active_count;
+        removeActive(id);
+        return true;
+      }
+
+      bool
+      deactivate(unsigned id)
+      {
+        Table::iterator itr = m_table.find(id);
+        if (itr == m_table.end())
+          return false;
+
+        if (!itr->second.deactivate())
+          return false;
+
+        removeActive(id);
         return true;
       }
 
       unsigned
       getActiveCount(void)
       {
-        return m_active_count;
+        return m_active.size();
+      }
+
+      //! Replace the advertised subscriptions of a node.
+      //! @param[in] id IMC address of the node.
+      //! @param[in] subs advertised message identifiers.
+      //! @return true if the node is known, false otherwise.
+      bool
+      setSubscriptions(unsigned id, const std::set<uint16_t>& subs)
+      {
+        Table::iterator itr = m_table.find(id);
+        if (itr == m_table.end())
+          return false;
+
+        itr->second.setSubscriptions(subs);
+        return true;
+      }
+
+      //! Enable or disable subscription based filtering: when
+      //! enabled, sends skip nodes that advertised subscriptions not
+      //! including the message. Nodes that never advertised still
+      //! receive everything.
+      //! @param[in] enabled true to filter, false to send to all.
+      void
+      setSubscriptionFiltering(bool enabled)
+      {
+        m_subs_filter = enabled;
       }
 
       void
@@ -103,18 +171,64 @@ namespace Transports
         {
           if (m_lcomms->isActive())
           {
-            for (Table::iterator itr = m_table.begin(); itr != m_table.end(); ++itr)
+            for (unsigned i = 0; i < m_active.size(); ++i)
             {
-              if (m_lcomms->isNodeWithinRange(itr->first, msgid))
-                itr->second.send(sock, data, data_len);
+              if (m_subs_filter && !m_active[i].node->wants(msgid))
+                continue;
+
+              if (m_lcomms->isNodeWithinRange(m_active[i].id, msgid))
+                m_active[i].node->send(sock, data, data_len);
             }
 
             return;
           }
         }
 
-        for (Table::iterator itr = m_table.begin(); itr != m_table.end(); ++itr)
-          itr->second.send(sock, data, data_len);
+        for (unsigned i = 0; i < m_active.size(); ++i)
+        {
+          if (m_subs_filter && !m_active[i].node->wants(msgid))
+            continue;
+
+          m_active[i].node->send(sock, data, data_len);
+        }
+      }
+
+      //! Send data to every active node, regardless of advertised
+      //! subscriptions or simulated communication limitations. Used
+      //! for transport control traffic.
+      //! @param[in] sock UDP destination socket.
+      //! @param[in] data data to be transmitted.
+      //! @param[in] data_len length of data to be transmitted.
+      void
+      broadcast(UDPSocket& sock, const uint8_t* data, unsigned data_len)
+      {
+        for (unsigned i = 0; i < m_active.size(); ++i)
+          m_active[i].node->send(sock, data, data_len);
+      }
+
+      //! Collect the destination addresses of active nodes, honouring
+      //! the limited communications simulation for a given message.
+      //! @param[out] dsts destination addresses.
+      //! @param[in] msgid IMC message identifier.
+      void
+      getDestinations(std::vector<NodeAddress>& dsts, unsigned msgid)
+      {
+        for (unsigned i = 0; i < m_active.size(); ++i)
+        {
+          if (m_subs_filter && !m_active[i].node->wants(msgid))
+            continue;
+
+          if (m_lcomms != NULL && m_lcomms->isActive())
+          {
+            if (!m_lcomms->isNodeWithinRange(m_active[i].id, msgid))
+              continue;
+          }
+
+          Address addr;
+          unsigned port = 0;
+          if (m_active[i].node->getActiveAddress(addr, port))
+            dsts.push_back(NodeAddress(addr, port));
+        }
       }
 
       void
@@ -124,13 +238,65 @@ namespace Transports
       }
 
     private:
+      // Maximum number of tracked nodes.
+      static const unsigned c_max_nodes = 256;
+
+      //! Entry of the active node list. The node pointer stays valid
+      //! because map entries are never moved and only inactive nodes
+      //! are ever evicted.
+      struct ActiveNode
+      {
+        //! IMC address.
+        unsigned id;
+        //! Table entry.
+        Node* node;
+      };
+
       typedef std::map<unsigned, Node> Table;
-      // Number of active nodes.
-      unsigned m_active_count;
       // Node table.
       Table m_table;
+      // Active nodes, iterated on every send.
+      std::vector<ActiveNode> m_active;
       // Limited Comms object
       LimitedComms* m_lcomms;
+      // Honour advertised subscriptions when sending.
+      bool m_subs_filter;
+
+      //! Remove a node from the active list.
+      //! @param[in] id IMC address of the node.
+      void
+      removeActive(unsigned id)
+      {
+        for (unsigned i = 0; i < m_active.size(); ++i)
+        {
+          if (m_active[i].id == id)
+          {
+            m_active.erase(m_active.begin() + i);
+            return;
+          }
+        }
+      }
+
+      //! Drop the inactive node that has been silent the longest. If
+      //! every node is active the table is allowed to grow: live
+      //! peers are never discarded.
+      void
+      evict(void)
+      {
+        Table::iterator victim = m_table.end();
+        for (Table::iterator itr = m_table.begin(); itr != m_table.end(); ++itr)
+        {
+          if (itr->second.isActive())
+            continue;
+
+          if (victim == m_table.end()
+              || itr->second.getLastHeard() < victim->second.getLastHeard())
+            victim = itr;
+        }
+
+        if (victim != m_table.end())
+          m_table.erase(victim);
+      }
     };
   }
 }
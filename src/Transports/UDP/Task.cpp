@@ -42,6 +42,7 @@
 #include "NodeTable.hpp"
 #include "Listener.hpp"
 #include "LimitedComms.hpp"
+#include "Aggregator.hpp"
 
 namespace Transports
 {
@@ -64,8 +65,16 @@ namespace Transports
       bool trace_in;
       // Trace outgoing messages.
       bool trace_out;
+      // Suppress duplicates received over multiple paths.
+      bool dedup;
       // Rate limits.
       std::vector<std::string> rate_lims;
+      // Byte rate limits.
+      std::vector<std::string> byte_lims;
+      // Decimation filters.
+      std::vector<std::string> decim;
+      // Decimation queue threshold.
+      unsigned decim_threshold;
       // Filtered entities.
       std::vector<std::string> entities_flt;
       // List of messages to publish.
@@ -82,6 +91,12 @@ namespace Transports
       bool dynamic_nodes;
       // Only transmit messages from local system
       bool only_local;
+      // Maximum aggregated datagram payload size.
+      unsigned agg_size;
+      // Maximum age of an aggregated message before flush.
+      float agg_age;
+      // Forward to each peer only messages it advertised consumers for.
+      bool subs_filter;
     };
 
     // Internal buffer size.
@@ -113,12 +128,15 @@ namespace Transports
       LimitedComms* m_lcomms;
       //! Message Filter
       MessageFilter m_filter;
+      //! Datagram aggregator.
+      Aggregator m_agg;
 
       Task(const std::string& name, Tasks::Context& ctx):
         DUNE::Tasks::Task(name, ctx),
         m_bfr(NULL),
         m_listener(NULL),
-        m_lcomms(NULL)
+        m_lcomms(NULL),
+        m_agg(m_sock)
       {
         param("Local Port", m_args.port)
         .defaultValue("6002")
@@ -140,12 +158,33 @@ namespace Transports
         .defaultValue("false")
         .description("Print incoming messages (Debug)");
 
+        param("Duplicate Suppression", m_args.dedup)
+        .defaultValue("true")
+        .description("Drop copies of a message received over more than one path");
+
         param("Static Destinations", m_args.destinations)
         .description("List of <IPv4>:<Port> destinations that will always receive outgoing messages");
 
         param("Rate Limiters", m_args.rate_lims)
         .description("List of <Message>:<Frequency>");
 
+        param("Bandwidth Limiters", m_args.byte_lims)
+        .defaultValue("")
+        .description("List of <Message>:<BytesPerSecond> byte budgets; messages"
+                     " of a listed type that would exceed their budget are"
+                     " dropped");
+
+        param("Decimation Filters", m_args.decim)
+        .defaultValue("")
+        .description("List of <Message>:<Factor> that define the messages decimated,"
+                     " keeping one in every <Factor>, while the receiving queue is"
+                     " above the decimation threshold");
+
+        param("Decimation Threshold", m_args.decim_threshold)
+        .defaultValue("0")
+        .description("Receiving queue depth above which decimation engages, zero"
+                     " disables decimation");
+
         param("Filtered Entities", m_args.entities_flt)
         .description("List of <Message>:<Entity>+<Entity> that define the source entities allowed to pass message of a specific message type.");
 
@@ -178,11 +217,31 @@ namespace Transports
         .defaultValue("false")
         .description("Only transmit messsages from local system.");
 
+        param("Datagram Aggregation Size", m_args.agg_size)
+        .units(Units::Byte)
+        .defaultValue("0")
+        .description("Pack messages bound for the same destination into datagrams"
+                     " up to this payload size (0 to send one message per datagram)");
+
+        param("Datagram Aggregation Age", m_args.agg_age)
+        .units(Units::Second)
+        .defaultValue("0.1")
+        .description("Maximum time a message may wait in an aggregated datagram"
+                     " before it is flushed");
+
+        param("Subscription Filtering", m_args.subs_filter)
+        .defaultValue("false")
+        .description("Advertise the local bus bindings to peer bridges and"
+                     " forward to each peer only messages it advertised a"
+                     " consumer for; peers that do not advertise receive"
+                     " everything");
+
         // Allocate space for internal buffer.
         m_bfr = new uint8_t[c_bfr_size];
 
         // Register listeners.
         bind<IMC::Announce>(this);
+        bind<IMC::MsgList>(this);
       }
 
       ~Task(void)
@@ -204,11 +263,19 @@ namespace Transports
 
         // Process rate limiters.
         m_filter.setupRates(m_args.rate_lims);
+        // Process byte rate limiters.
+        m_filter.setupByteRates(m_args.byte_lims);
         // Process filtered entities.
         m_filter.setupEntities(m_args.entities_flt, this);
+        // Process decimation filters.
+        m_filter.setupDecimation(m_args.decim, m_args.decim_threshold);
 
         m_underwater_comms = m_args.underwater_comms;
 
+        m_agg.setup(m_args.agg_size, m_args.agg_age);
+
+        m_node_table.setSubscriptionFiltering(m_args.subs_filter);
+
         // Initialize communication limitations parameters.
         if (m_ctx.profiles.isSelected("Simulation") && m_args.comm_range > 0)
         {
@@ -283,7 +350,8 @@ namespace Transports
 
         // Start listener thread.
         m_listener = new Listener(*this, m_sock, m_lcomms,
-                                  m_args.contact_timeout, m_args.trace_in);
+                                  m_args.contact_timeout, m_args.trace_in,
+                                  m_args.dedup);
         m_listener->start();
 
         setEntityState(IMC::EntityState::ESTA_NORMAL, Status::CODE_ACTIVE);
@@ -292,6 +360,8 @@ namespace Transports
       void
       onResourceRelease(void)
       {
+        m_agg.flushAll();
+
         if (m_listener != NULL)
         {
           m_listener->stopAndJoin();
@@ -325,6 +395,24 @@ namespace Transports
 
         uint16_t rv = IMC::Packet::serialize(msg, m_bfr, c_bfr_size);
 
+        if (m_agg.isEnabled())
+        {
+          // Queue for aggregated transmission.
+          std::set<NodeAddress>::iterator itr = m_static_dsts.begin();
+          for (; itr != m_static_dsts.end(); ++itr)
+            m_agg.append(*itr, m_bfr, rv);
+
+          if (m_args.dynamic_nodes)
+          {
+            std::vector<NodeAddress> dsts;
+            m_node_table.getDestinations(dsts, msg->getId());
+            for (unsigned i = 0; i < dsts.size(); ++i)
+              m_agg.append(dsts[i], m_bfr, rv);
+          }
+
+          return;
+        }
+
         // Send to static nodes.
         std::set<NodeAddress>::iterator itr = m_static_dsts.begin();
         for (; itr != m_static_dsts.end(); ++itr)
@@ -360,6 +448,83 @@ namespace Transports
         m_lcomms->setAnnounce(msg);
       }
 
+      void
+      consume(const IMC::MsgList* msg)
+      {
+        // Subscription advertisements are lists holding only
+        // TransportBindings; any other list is not ours to interpret.
+        if (msg->getSource() == getSystemId())
+          return;
+
+        std::set<uint16_t> subs;
+        IMC::MessageList<IMC::Message>::const_iterator itr = msg->msgs.begin();
+        for (; itr != msg->msgs.end(); ++itr)
+        {
+          if (*itr == NULL || (*itr)->getId() != DUNE_IMC_TRANSPORTBINDINGS)
+            return;
+
+          subs.insert(static_cast<const IMC::TransportBindings*>(*itr)->message_id);
+        }
+
+        if (subs.empty())
+          return;
+
+        if (m_node_table.setSubscriptions(msg->getSource(), subs))
+          trace("node '%s' advertised %u subscriptions",
+                resolveSystemId(msg->getSource()), (unsigned)subs.size());
+      }
+
+      //! Advertise the set of messages with local consumers, so peer
+      //! bridges with subscription filtering enabled forward only
+      //! traffic someone on this side will actually consume.
+      void
+      advertiseSubscriptions(void)
+      {
+        if (m_node_table.getActiveCount() == 0 && m_static_dsts.empty())
+          return;
+
+        // This task's own bindings are the transport list itself and
+        // do not represent local interest.
+        std::vector<IMC::TransportBindings*> bindings = m_ctx.mbus.getBindings();
+        std::set<uint16_t> ids;
+        for (unsigned i = 0; i < bindings.size(); ++i)
+        {
+          if (bindings[i]->consumer == getName())
+            continue;
+
+          ids.insert(bindings[i]->message_id);
+        }
+
+        IMC::MsgList adv;
+        std::set<uint16_t>::iterator itr = ids.begin();
+        for (; itr != ids.end(); ++itr)
+        {
+          IMC::TransportBindings tb;
+          tb.consumer = getSystemName();
+          tb.message_id = *itr;
+          adv.msgs.push_back(tb);
+        }
+
+        adv.setSource(getSystemId());
+        adv.setTimeStamp();
+
+        uint16_t rv = IMC::Packet::serialize(&adv, m_bfr, c_bfr_size);
+
+        std::set<NodeAddress>::iterator ditr = m_static_dsts.begin();
+        for (; ditr != m_static_dsts.end(); ++ditr)
+        {
+          try
+          {
+            m_sock.write(m_bfr, rv, ditr->getAddress(), ditr->getPort());
+          }
+          catch (...)
+          { }
+        }
+
+        if (m_args.dynamic_nodes)
+          m_node_table.broadcast(m_sock, m_bfr, rv);
+      }
+
       void
       refreshContacts(void)
       {
@@ -380,7 +545,7 @@ namespace Transports
           }
           else
           {
-            if (m_node_table.deactivate(itr->getId(), itr->getAddress()))
+            if (m_node_table.deactivate(itr->getId()))
               inf(DTR("deactivating transmission to node '%s'"), name.c_str());
           }
         }
@@ -393,12 +558,20 @@ namespace Transports
       {
         while (!stopping())
         {
-          waitForMessages(1.0);
+          double tout = 1.0;
+          if (m_agg.isEnabled() && m_args.agg_age > 0 && m_args.agg_age < tout)
+            tout = m_args.agg_age;
+
+          m_filter.setQueueDepth(getQueueDepth());
+          waitForMessages(tout);
+          m_agg.flushExpired();
 
           // Check if it's time to update the contact list.
           if (m_contacts_refresh_counter.overflow())
           {
             refreshContacts();
+            if (m_args.subs_filter)
+              advertiseSubscriptions();
             m_contacts_refresh_counter.reset();
           }
         }
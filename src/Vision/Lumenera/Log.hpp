@@ -47,6 +47,11 @@ namespace Vision
     static const char* c_log_prefix = "Data_";
     //! Log file suffix.
     static const char* c_log_suffix = ".mjpg";
+    //! Number of pre-allocated frames.
+    static const size_t c_frame_pool_min = 10;
+    //! Maximum number of allocated frames. Bounds memory usage when
+    //! the storage stalls and the dirty queue backs up.
+    static const size_t c_frame_pool_max = 32;
 
     class Log: public Concurrency::Thread
     {
@@ -85,7 +90,8 @@ namespace Vision
 
       Log(Tasks::Task* parent, const Path& folder, unsigned width, unsigned height, unsigned fps):
         m_parent(parent),
-        m_frame_count(0)
+        m_frame_count(0),
+        m_pool_size(0)
       {
         m_path = getLogPath(folder);
         folder.create();
@@ -138,12 +144,18 @@ namespace Vision
         m_free_queue.push(frame);
       }
 
+      //! Retrieve a frame from the pool, growing it up to the pool
+      //! bound.
+      //! @return free frame or NULL if the pool is exhausted.
       Frame*
       getFreeFrame(void)
       {
         Frame* frame = m_free_queue.pop();
-        if (frame == NULL)
+        if (frame == NULL && m_pool_size < c_frame_pool_max)
+        {
           frame = new Frame();
+          ++m_pool_size;
+        }
 
         return frame;
       }
@@ -167,6 +179,8 @@ namespace Vision
       Media::MJPG::Encoder* m_encoder;
       //! Number of frames written so far.
       size_t m_frame_count;
+      //! Number of frames allocated so far.
+      size_t m_pool_size;
 
       static Path
       getLogPath(const Path& folder)
@@ -193,10 +207,11 @@ namespace Vision
       void
       preAllocateFrames(void)
       {
-        for (size_t i = 0; i < 10; ++i)
+        for (size_t i = 0; i < c_frame_pool_min; ++i)
         {
           Frame* frame = new Frame();
           m_free_queue.push(frame);
+          ++m_pool_size;
         }
       }
 
@@ -225,6 +240,10 @@ namespace Vision
           if (m_queue.waitForItems(1.0))
             processQueue();
         }
+
+        // Flush whatever is still queued so asynchronous log
+        // rotation does not lose frames.
+        processQueue();
       }
     };
   }
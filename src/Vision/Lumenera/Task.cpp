@@ -136,8 +136,14 @@ namespace Vision
       Counter<double> m_cooldown_timer;
       //! Log instance.
       Log* m_log;
+      //! Retired log instance, flushing its queue in the background.
+      Log* m_log_old;
       //! Actual frame rate.
       int m_actual_frame_rate;
+      //! Scratch frame used to drain the stream when the pool is dry.
+      Log::Frame m_scratch;
+      //! Number of frames dropped since the pool last had a frame.
+      unsigned m_dropped;
 
       Task(const std::string& name, Tasks::Context& ctx):
         Tasks::Task(name, ctx),
@@ -151,7 +157,9 @@ namespace Vision
         m_slave_entities(NULL),
         m_log_dir_updated(false),
         m_log(NULL),
-        m_actual_frame_rate(-1)
+        m_log_old(NULL),
+        m_actual_frame_rate(-1),
+        m_dropped(0)
       {
         // Retrieve configuration values.
         paramActive(Tasks::Parameter::SCOPE_MANEUVER,
@@ -468,6 +476,8 @@ namespace Vision
         stopVideo();
         inf(DTR("stopped video stream"));
 
+        reapOldLog(true);
+
         if (m_log != NULL)
         {
           m_log->stopAndJoin();
@@ -854,8 +864,12 @@ namespace Vision
       {
         if (m_log != NULL)
         {
-          m_log->stopAndJoin();
-          delete m_log;
+          // Retire the current file asynchronously: its writer
+          // flushes the queue and exits in the background while
+          // capture carries on with the new file.
+          reapOldLog(true);
+          m_log_old = m_log;
+          m_log_old->stop();
           m_log = NULL;
         }
 
@@ -863,6 +877,22 @@ namespace Vision
         m_log->start();
       }
 
+      //! Dispose of a retired log writer.
+      //! @param[in] wait true to block until the writer finishes.
+      void
+      reapOldLog(bool wait)
+      {
+        if (m_log_old == NULL)
+          return;
+
+        if (!wait && !m_log_old->isDead())
+          return;
+
+        m_log_old->join();
+        delete m_log_old;
+        m_log_old = NULL;
+      }
+
       void
       captureAndSave(void)
       {
@@ -875,29 +905,61 @@ namespace Vision
         if (m_log == NULL)
           changeLogFile();
 
+        reapOldLog(false);
+
         Log::Frame* frame = m_log->getFreeFrame();
+        bool drop = (frame == NULL);
+        if (drop)
+        {
+          // Writer is stalled and the pool is dry: keep the capture
+          // cadence by draining the frame from the stream into a
+          // scratch buffer and dropping it.
+          if (m_dropped == 0)
+            war(DTR("frame pool exhausted, dropping frames"));
+
+          frame = &m_scratch;
+        }
 
         try
         {
           double previous_time = m_timestamp;
           if (captureFrame(frame))
           {
-            if (!m_cooldown_timer.overflow())
+            if (drop)
             {
-              m_log->putFree(frame);
+              ++m_dropped;
             }
             else
             {
-              m_log->put(frame);
-              double frame_rate = 1.0 / (m_timestamp - previous_time);
-              if (std::fabs(frame_rate - m_actual_frame_rate) > 0.5)
-                inf("abnormal delta %.1f ms | %f | %u", (m_timestamp - previous_time) * 1000.0, frame_rate, m_actual_frame_rate);
-
+              if (m_dropped > 0)
+              {
+                war(DTR("dropped %u frames while the writer was stalled"), m_dropped);
+                m_dropped = 0;
+              }
+
+              if (!m_cooldown_timer.overflow())
+              {
+                m_log->putFree(frame);
+              }
+              else
+              {
+                m_log->put(frame);
+                double frame_rate = 1.0 / (m_timestamp - previous_time);
+                if (std::fabs(frame_rate - m_actual_frame_rate) > 0.5)
+                  inf("abnormal delta %.1f ms | %f | %u", (m_timestamp - previous_time) * 1000.0, frame_rate, m_actual_frame_rate);
+              }
             }
           }
+          else if (!drop)
+          {
+            m_log->putFree(frame);
+          }
         }
         catch (std::runtime_error& e)
         {
+          if (!drop)
+            m_log->putFree(frame);
+
           debug("frame capture failed: %s", e.what());
           stopVideo();
         }